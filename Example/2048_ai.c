@@ -0,0 +1,217 @@
+/* 2048_ai.c */
+#include <math.h>
+#include <string.h>
+#include "2048_ai.h"
+
+#define TT_ENTRIES      (1u << G2048_AI_TT_BITS)
+#define PROB_MIN        0.0001f     /* Rarer spawn sequences are scored, not searched */
+#define CLOCK_EVERY     1024u       /* Nodes between clock reads */
+
+/* Heuristic weights, per row and per column */
+#define H_BASE          200000.0f   /* Keeps live boards above a lost one (0) */
+#define H_EMPTY         270.0f
+#define H_MERGES        700.0f
+#define H_MONO          47.0f       /* times (rank^4 steps against the slope) */
+#define H_SUM           11.0f       /* times rank^3.5: big tiles spread out cost more */
+
+typedef struct {
+    uint32_t tag;                   /* Hash bits not used for the slot */
+    float    value;
+    uint8_t  depth;                 /* Moves searched below, 0 = empty slot */
+} tt_entry_t;
+
+/* CCM (IRAM2), reachable by the CPU only, so nothing that DMA
+ * touches can live there. Example.sct links it there uninitialised,
+ * overlaid on the snake game's state: G2048AI_Init() clears the
+ * table, and must be called again after another game ran. */
+#if defined(__ARMCC_VERSION)
+#define TT_PLACE        __attribute__((section(".bss.ccm")))
+#else
+#define TT_PLACE
+#endif
+
+static tt_entry_t tt[TT_ENTRIES] TT_PLACE;
+
+static float h_sum_pow[16];         /* rank^3.5 */
+static float h_mono_pow[16];        /* rank^4 */
+
+static uint32_t (*now_ms)(void);
+static uint32_t start_ms, budget;
+static uint32_t nodes;
+static int      depth_limit;
+static int      can_abort, aborted;
+
+/************************************************************
+ * HEURISTIC
+ ************************************************************/
+static float row_heur(uint16_t row)
+{
+    int line[4];
+    int empty = 0, merges = 0, prev = 0, run = 0;
+    float sum = 0.0f, mono_l = 0.0f, mono_r = 0.0f;
+
+    for (int i = 0; i < 4; i++) {
+        int rank = (row >> (4 * i)) & 0xF;
+        line[i] = rank;
+        sum += h_sum_pow[rank];
+
+        if (rank == 0) {
+            empty++;
+        } else {
+            if (prev == rank) {
+                run++;
+            } else if (run > 0) {
+                merges += 1 + run;
+                run = 0;
+            }
+            prev = rank;
+        }
+    }
+    if (run > 0) merges += 1 + run;
+
+    for (int i = 1; i < 4; i++) {
+        if (line[i - 1] > line[i])
+            mono_l += h_mono_pow[line[i - 1]] - h_mono_pow[line[i]];
+        else
+            mono_r += h_mono_pow[line[i]] - h_mono_pow[line[i - 1]];
+    }
+
+    return H_BASE + H_EMPTY * empty + H_MERGES * merges
+         - H_MONO * (mono_l < mono_r ? mono_l : mono_r) - H_SUM * sum;
+}
+
+static float board_heur(g2048_board_t b)
+{
+    g2048_board_t t = G2048_Transpose(b);
+    float h = 0.0f;
+
+    for (int i = 0; i < G2048_SIZE; i++)
+        h += row_heur((uint16_t)(b >> (16 * i))) + row_heur((uint16_t)(t >> (16 * i)));
+    return h;
+}
+
+/************************************************************
+ * SEARCH
+ * move_node: the player picks the best move.
+ * spawn_node: average over the empty cells and the 2/4 tile.
+ * depth counts the moves made since the root.
+ ************************************************************/
+static float spawn_node(g2048_board_t b, int depth, float prob);
+
+static float move_node(g2048_board_t b, int depth, float prob)
+{
+    float best = 0.0f;  /* No legal move: lost */
+
+    for (int d = G2048_UP; d <= G2048_RIGHT; d++) {
+        uint32_t gained = 0;
+        int won = 0;
+        g2048_board_t next = G2048_Move(b, d, &gained, &won);
+
+        if (next != b) {
+            float v = spawn_node(next, depth + 1, prob);
+            if (v > best) best = v;
+        }
+    }
+    return best;
+}
+
+static float spawn_node(g2048_board_t b, int depth, float prob)
+{
+    if (aborted) return 0.0f;
+
+    if ((++nodes % CLOCK_EVERY) == 0 && can_abort && now_ms() - start_ms >= budget) {
+        aborted = 1;
+        return 0.0f;
+    }
+
+    if (depth >= depth_limit || prob < PROB_MIN)
+        return board_heur(b);
+
+    /* Fibonacci hashing: top bits pick the slot, low bits check it */
+    uint64_t h = b * 0x9E3779B97F4A7C15ULL;
+    tt_entry_t *e = &tt[h >> (64 - G2048_AI_TT_BITS)];
+    int left = depth_limit - depth;
+
+    if (e->tag == (uint32_t)h && e->depth >= left)
+        return e->value;
+
+    /* A legal move always leaves a cell free */
+    int empty = 0;
+    for (int i = 0; i < 16; i++)
+        if (((b >> (4 * i)) & 0xF) == 0) empty++;
+
+    float sum = 0.0f;
+    prob /= (float)empty;
+    for (int i = 0; i < 16; i++) {
+        if (((b >> (4 * i)) & 0xF) != 0) continue;
+        sum += 0.9f * move_node(b | ((g2048_board_t)1 << (4 * i)), depth, prob * 0.9f);
+        sum += 0.1f * move_node(b | ((g2048_board_t)2 << (4 * i)), depth, prob * 0.1f);
+    }
+    float v = sum / (float)empty;
+
+    if (!aborted) {
+        e->tag   = (uint32_t)h;
+        e->value = v;
+        e->depth = (uint8_t)left;
+    }
+    return v;
+}
+
+/************************************************************
+ * PUBLIC
+ ************************************************************/
+void G2048AI_Init(uint32_t (*pNowMs)(void))
+{
+    now_ms = pNowMs;
+
+    for (int rank = 0; rank < 16; rank++) {
+        h_sum_pow[rank]  = powf((float)rank, 3.5f);
+        h_mono_pow[rank] = powf((float)rank, 4.0f);
+    }
+    memset(tt, 0, sizeof(tt));
+}
+
+int G2048AI_Search(g2048_board_t b, uint32_t budget_ms, g2048_ai_stats_t *pStats)
+{
+    int best_dir = -1;
+
+    start_ms = now_ms();
+    budget   = budget_ms;
+    nodes    = 0;
+    aborted  = 0;
+    pStats->depth = 0;
+
+    for (depth_limit = 1; depth_limit <= G2048_AI_MAX_DEPTH; depth_limit++)
+    {
+        /* The first pass always finishes, so there is a move to give */
+        can_abort = (depth_limit > 1);
+
+        float best = -1.0f;
+        int dir = -1;
+
+        for (int d = G2048_UP; d <= G2048_RIGHT; d++) {
+            uint32_t gained = 0;
+            int won = 0;
+            g2048_board_t next = G2048_Move(b, d, &gained, &won);
+
+            if (next == b) continue;
+
+            float v = spawn_node(next, 1, 1.0f);
+            if (v > best) {
+                best = v;
+                dir = d;
+            }
+        }
+
+        if (aborted) break;
+
+        best_dir = dir;
+        pStats->depth = depth_limit;
+
+        if (dir < 0 || now_ms() - start_ms >= budget) break;
+    }
+
+    pStats->nodes = nodes;
+    pStats->ms    = now_ms() - start_ms;
+    return best_dir;
+}
@@ -0,0 +1,40 @@
+/* 2048_ai.h */
+#ifndef G2048_AI_H
+#define G2048_AI_H
+
+#include <stdint.h>
+#include "2048_board.h"
+
+/************************************************************
+ * 2048 SOLVER
+ * Expectimax over the player's moves and the tile spawns (a 2
+ * at 90 %, a 4 at 10 %), leaves scored by a heuristic: empty
+ * cells, possible merges, monotone rows and columns. Spawn
+ * sequences less likely than 1 in 10000 are not searched.
+ *
+ * Iterative deepening, one more move per pass, until the time
+ * budget runs out; an unfinished pass is dropped. Spawn nodes
+ * are cached in a transposition table that the target links
+ * into CCM RAM.
+ *
+ * Plain C on top of 2048_board, no emWin or RTOS calls, so it
+ * also builds and runs on a PC.
+ ************************************************************/
+
+#define G2048_AI_TT_BITS    12      /* 4096 entries of 12 bytes, 48 KB */
+#define G2048_AI_MAX_DEPTH  8       /* Moves looked ahead, at most */
+
+typedef struct {
+    int      depth;                 /* Moves looked ahead by the last finished pass */
+    uint32_t nodes;                 /* Positions visited, all passes */
+    uint32_t ms;                    /* Time spent */
+} g2048_ai_stats_t;
+
+/* pNowMs: millisecond clock for the time budget. Clears the table;
+ * on the target, call it each time the game starts (see 2048_ai.c). */
+void G2048AI_Init(uint32_t (*pNowMs)(void));
+
+/* Best direction for b (G2048_UP..), -1 when no move is legal */
+int  G2048AI_Search(g2048_board_t b, uint32_t budget_ms, g2048_ai_stats_t *pStats);
+
+#endif
@@ -0,0 +1,208 @@
+/* 2048_board.c */
+#include <stddef.h>
+#include "2048_board.h"
+#include "2048_tables.h"
+
+/* The grid kernels rely on n being a constant in each wrapper */
+#if defined(__GNUC__)
+#define KERNEL_INLINE   inline __attribute__((always_inline))
+#else
+#define KERNEL_INLINE   inline
+#endif
+
+/************************************************************
+ * MOVES
+ * A move is four lookups in row_left_table: rows as they are
+ * for LEFT, nibble-reversed for RIGHT, and the same on the
+ * transposed board for UP/DOWN. The table also carries the
+ * score and the 2048 flag, so nothing else walks the tiles.
+ ************************************************************/
+
+/* Nibble (r,c) <-> (c,r) */
+g2048_board_t G2048_Transpose(g2048_board_t x)
+{
+    g2048_board_t a1 = x & 0xF0F00F0FF0F00F0FULL;
+    g2048_board_t a2 = x & 0x0000F0F00000F0F0ULL;
+    g2048_board_t a3 = x & 0x0F0F00000F0F0000ULL;
+    g2048_board_t a  = a1 | (a2 << 12) | (a3 >> 12);
+    g2048_board_t b1 = a & 0xFF00FF0000FF00FFULL;
+    g2048_board_t b2 = a & 0x00FF00FF00000000ULL;
+    g2048_board_t b3 = a & 0x00000000FF00FF00ULL;
+    return b1 | (b2 >> 24) | (b3 << 24);
+}
+
+static uint16_t reverse_row(uint16_t row)
+{
+    return (uint16_t)((row >> 12) | ((row >> 4) & 0x00F0) |
+                      ((row << 4) & 0x0F00) | (row << 12));
+}
+
+g2048_board_t G2048_Move(g2048_board_t b, int dir, uint32_t *pScore, int *pWon)
+{
+    int vertical = (dir == G2048_UP || dir == G2048_DOWN);
+    int reversed = (dir == G2048_RIGHT || dir == G2048_DOWN);
+    g2048_board_t t = vertical ? G2048_Transpose(b) : b;
+    g2048_board_t out = 0;
+
+    for (int i = 0; i < G2048_SIZE; i++) {
+        uint16_t row = (uint16_t)(t >> (16 * i));
+        uint32_t e = row_left_table[reversed ? reverse_row(row) : row];
+        uint16_t res = ROW_RESULT(e);
+
+        out |= (g2048_board_t)(reversed ? reverse_row(res) : res) << (16 * i);
+        *pScore += ROW_SCORE(e);
+        *pWon |= ROW_WON(e);
+    }
+    return vertical ? G2048_Transpose(out) : out;
+}
+
+/************************************************************
+ * GRID KERNELS (3x3, 5x5, 6x6)
+ * The grid's rows are loaded into registers with one shift and
+ * mask each, transposed for UP/DOWN and nibble-reversed for
+ * RIGHT/DOWN, slid towards nibble 0, and stored back the same
+ * way. 3x3 rows are one lookup in row_left_table3, 5x5 and 6x6
+ * rows three in slide_pair_table. grid_move() is inlined into
+ * one wrapper per size, so n is a constant in every kernel and
+ * the loops unroll.
+ ************************************************************/
+
+/* Row of n nibbles slid towards nibble 0, two cells per lookup */
+static inline uint32_t slide_row(uint32_t row, int n, uint32_t *pScore, int *pWon)
+{
+    uint32_t out = 0, open = 0;
+    int j = 0;                      /* Tiles finished so far */
+
+    for (int k = 0; k < n; k += 2, row >>= 8) {
+        uint32_t e = slide_pair_table[(open << 8) | (row & 0xFF)];
+
+        out |= PAIR_TILES(e) << (4 * j);
+        j += (int)PAIR_COUNT(e);
+        open = PAIR_OPEN(e);
+        *pScore += PAIR_SCORE(e);
+        *pWon |= PAIR_WON(e);
+    }
+    return out | (open << (4 * j));
+}
+
+/* Nibbles 0..n-1 of row in the opposite order (n <= 6): lined up
+ * at the top of 24 bits, bytes swapped, then nibbles in each byte */
+static inline uint32_t reverse_nibbles(uint32_t row, int n)
+{
+    uint32_t x = row << (4 * (6 - n));
+
+    x = ((x >> 16) & 0xFFu) | (x & 0xFF00u) | ((x & 0xFFu) << 16);
+    return ((x >> 4) & 0x0F0F0Fu) | ((x & 0x0F0F0Fu) << 4);
+}
+
+/* Nibbles (i, c + k) <-> (i + k, c) for the columns c the mask keeps */
+#define SWAP_BLOCKS(a, b, k, keep)  do {                     \
+        uint32_t t_ = (((a) >> (4 * (k))) ^ (b)) & (keep);  \
+        (b) ^= t_;                                          \
+        (a) ^= t_ << (4 * (k));                             \
+    } while (0)
+
+/* Nibble c of rows[r] <-> nibble r of rows[c]. The rows are a 4x4
+ * or 8x8 nibble matrix padded with 0; the off-diagonal blocks are
+ * swapped at block sizes 4 (8x8 only), 2 and 1, as in
+ * G2048_Transpose(). */
+static KERNEL_INLINE void transpose_rows(uint32_t *rows, int n)
+{
+    if (n > 4) {
+        SWAP_BLOCKS(rows[0], rows[4], 4, 0x0000FFFFu);
+        SWAP_BLOCKS(rows[1], rows[5], 4, 0x0000FFFFu);
+        SWAP_BLOCKS(rows[2], rows[6], 4, 0x0000FFFFu);
+        SWAP_BLOCKS(rows[3], rows[7], 4, 0x0000FFFFu);
+        SWAP_BLOCKS(rows[4], rows[6], 2, 0x00FF00FFu);
+        SWAP_BLOCKS(rows[5], rows[7], 2, 0x00FF00FFu);
+        SWAP_BLOCKS(rows[4], rows[5], 1, 0x0F0F0F0Fu);
+        SWAP_BLOCKS(rows[6], rows[7], 1, 0x0F0F0F0Fu);
+    }
+    SWAP_BLOCKS(rows[0], rows[2], 2, 0x00FF00FFu);
+    SWAP_BLOCKS(rows[1], rows[3], 2, 0x00FF00FFu);
+    SWAP_BLOCKS(rows[0], rows[1], 1, 0x0F0F0F0Fu);
+    SWAP_BLOCKS(rows[2], rows[3], 1, 0x0F0F0F0Fu);
+}
+
+static KERNEL_INLINE int grid_move(g2048_grid_t *pGrid, int dir, int n,
+                                   const uint32_t *pTable, uint32_t *pScore, int *pWon)
+{
+    const int per_word = G2048_GRID_ROWS(n);
+    const uint32_t mask = (1u << (4 * n)) - 1;
+    int vertical = (dir == G2048_UP || dir == G2048_DOWN);
+    int reversed = (dir == G2048_RIGHT || dir == G2048_DOWN);
+    uint32_t rows[8] = { 0 };
+    uint32_t score = 0;
+    int won = 0;
+
+    for (int r = 0; r < n; r++)
+        rows[r] = (uint32_t)(pGrid->w[r / per_word] >> (4 * n * (r % per_word))) & mask;
+    if (vertical) transpose_rows(rows, n);
+
+    for (int r = 0; r < n; r++) {
+        uint32_t row = reversed ? reverse_nibbles(rows[r], n) : rows[r];
+
+        if (pTable) {
+            uint32_t e = pTable[row];
+            score += ROW_SCORE(e);
+            won |= ROW_WON(e);
+            row = ROW_RESULT(e);
+        } else {
+            row = slide_row(row, n, &score, &won);
+        }
+        rows[r] = reversed ? reverse_nibbles(row, n) : row;
+    }
+    *pScore += score;
+    *pWon |= won;
+
+    if (vertical) transpose_rows(rows, n);
+
+    g2048_grid_t out = { { 0 } };
+    for (int r = 0; r < n; r++)
+        out.w[r / per_word] |= (uint64_t)rows[r] << (4 * n * (r % per_word));
+
+    int moved = 0;
+    for (int w = 0; w < G2048_GRID_WORDS; w++)
+        moved |= (out.w[w] != pGrid->w[w]);
+    *pGrid = out;
+    return moved;
+}
+
+static int move3(g2048_grid_t *pGrid, int dir, uint32_t *pScore, int *pWon)
+{
+    return grid_move(pGrid, dir, 3, row_left_table3, pScore, pWon);
+}
+
+static int move4(g2048_grid_t *pGrid, int dir, uint32_t *pScore, int *pWon)
+{
+    g2048_board_t next = G2048_Move(pGrid->w[0], dir, pScore, pWon);
+    int moved = (next != pGrid->w[0]);
+
+    pGrid->w[0] = next;
+    return moved;
+}
+
+static int move5(g2048_grid_t *pGrid, int dir, uint32_t *pScore, int *pWon)
+{
+    return grid_move(pGrid, dir, 5, NULL, pScore, pWon);
+}
+
+static int move6(g2048_grid_t *pGrid, int dir, uint32_t *pScore, int *pWon)
+{
+    return grid_move(pGrid, dir, 6, NULL, pScore, pWon);
+}
+
+static const g2048_variant_t variants[] = {
+    { 3, 1, sizeof(row_left_table3),  move3 },
+    { 4, 1, sizeof(row_left_table),   move4 },
+    { 5, 2, sizeof(slide_pair_table), move5 },
+    { 6, 3, sizeof(slide_pair_table), move6 },
+};
+
+const g2048_variant_t *G2048_Variant(int size)
+{
+    for (unsigned i = 0; i < sizeof(variants) / sizeof(variants[0]); i++) {
+        if (variants[i].size == size) return &variants[i];
+    }
+    return NULL;
+}
@@ -0,0 +1,79 @@
+/* 2048_board.h */
+#ifndef G2048_BOARD_H
+#define G2048_BOARD_H
+
+#include <stdint.h>
+
+/************************************************************
+ * 2048 BOARD
+ * 16 tile exponents of 4 bits in one 64-bit word (0 = empty,
+ * n = tile 2^n): row r in bits 16r..16r+15, column c in the
+ * nibble 4c of its row. Moves are lookups in row_left_table.
+ *
+ * Other sizes use a grid of up to three words with the same
+ * layout: a row is size nibbles at a fixed stride, as many rows
+ * per word as fit whole (3x3: all, 5x5: 3, 6x6: 2), so a row is
+ * one shift and mask. A 4x4 grid's first word is the bitboard
+ * above. Vertical moves slide the transposed rows. Tiles stop
+ * at 32768 on all sizes.
+ *
+ *   size  kernel                          flash       undo levels
+ *   3x3   12-bit rows, row table          16 KB           192
+ *   4x4   bitboard, row table            256 KB           192
+ *   5x5   20-bit rows, pair table         16 KB           128
+ *   6x6   24-bit rows, pair table         16 KB            96
+ *
+ * Undo levels: what fits the game's 3 KB snapshot ring.
+ *
+ * Plain C, no emWin or RTOS calls, so it also builds and runs
+ * on a PC.
+ ************************************************************/
+
+typedef uint64_t g2048_board_t;
+
+#define G2048_SIZE              4
+#define G2048_SHIFT(r, c)       (16 * (r) + 4 * (c))
+#define G2048_CELL(b, r, c)     ((int)(((b) >> G2048_SHIFT(r, c)) & 0xF))
+
+#define G2048_MIN_SIZE          3
+#define G2048_MAX_SIZE          6
+#define G2048_GRID_WORDS        3
+
+typedef struct {
+    uint64_t w[G2048_GRID_WORDS];       /* Words past the size's last cell stay 0 */
+} g2048_grid_t;
+
+/* Slot i: nibble i & 15 of word i >> 4. Cell (r, c) of an n x n
+ * grid is in slot G2048_GRID_SLOT(n, r, c); the nibbles past the
+ * last row of a word stay 0. */
+#define G2048_GRID_ROWS(n)          (16 / (n))      /* Rows per word */
+#define G2048_GRID_SLOT(n, r, c)    (16 * ((r) / G2048_GRID_ROWS(n)) + \
+                                     (n) * ((r) % G2048_GRID_ROWS(n)) + (c))
+#define G2048_GRID_WORD(i)          ((i) >> 4)
+#define G2048_GRID_SHIFT(i)         (4 * ((i) & 15))
+#define G2048_GRID_CELL(g, i)       ((int)(((g)->w[G2048_GRID_WORD(i)] >> G2048_GRID_SHIFT(i)) & 0xF))
+
+/* Directions, same order as the game's dir_t */
+enum { G2048_UP, G2048_DOWN, G2048_LEFT, G2048_RIGHT };
+
+/* Swap rows and columns */
+g2048_board_t G2048_Transpose(g2048_board_t b);
+
+/* b after sliding towards dir; adds the merges to *pScore and sets
+ * *pWon when one of them made 2048. Unchanged b: the move is not legal. */
+g2048_board_t G2048_Move(g2048_board_t b, int dir, uint32_t *pScore, int *pWon);
+
+/* One board size */
+typedef struct {
+    int      size;
+    int      words;                     /* Grid words in use */
+    uint32_t flash_bytes;               /* Lookup tables */
+    /* Slides *pGrid towards dir like G2048_Move(); returns 0 when
+     * nothing moved (the grid is then unchanged) */
+    int    (*move)(g2048_grid_t *pGrid, int dir, uint32_t *pScore, int *pWon);
+} g2048_variant_t;
+
+/* Kernel for a size x size board, NULL when there is none */
+const g2048_variant_t *G2048_Variant(int size);
+
+#endif
@@ -2,109 +2,280 @@
 #include "GUI.h"
 #include "LCD.h"
 #include "cmsis_os2.h"
+#include "cmsis_compiler.h"
 #include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
+#include <stddef.h>
 #include "input.h"
+#include "gfx.h"
+#include "perf.h"
+#include "hud.h"
+#include "2048_board.h"
+#include "2048_ai.h"
 
 /************************************************************
  * 2048 GAME ENGINE
  ************************************************************/
 
-#define GRID_SIZE       4
 #define CELL_PADDING    4
+#define BOARD_MARGIN    20      /* Short side of the screen minus the board */
+#define LCD_SHORT_SIDE  240     /* The panel is 240x320, in either orientation */
 #define GAME_SPEED_MS   50
 
+/* Tile bitmap cache: one 1bpp bitmap per exponent (0 = empty .. 15),
+ * sized for the biggest tiles, those of the smallest board (3x3: 66 px) */
+#define TILE_COUNT      16
+#define TILE_MAX_DIM    ((LCD_SHORT_SIDE - BOARD_MARGIN) / G2048_MIN_SIZE - 2 * CELL_PADDING + 1)
+#define TILE_MAX_BYTES  (((TILE_MAX_DIM + 7) / 8) * TILE_MAX_DIM)
+
+/* Slide animation: ANIM_FRAMES steps, one every ANIM_FRAME_MS */
+#define ANIM_FRAMES     5
+#define ANIM_FRAME_MS   16
+#define BOARD_BG_COLOR  0x00444444
+
+/* Keys pressed while an animation plays */
+#define KEY_QUEUE_LEN   4
+
+/* Undo history: a 3 KB ring, as many moves back as fit */
+#define UNDO_WORDS      768
+
+/* Solver: searches in its own low-priority thread, the game loop
+ * only asks and polls, so input and drawing never wait for it */
+#define SOLVER_BUDGET_MS    100
+#define SOLVER_FLAG_WORK    0x0001U
+#define SOLVER_STACK_SZ     (2048U)
+
 /* UI Dimensions */
+static int GRID_SIZE;   /* Tiles per side, G2048_MIN_SIZE..G2048_MAX_SIZE */
 static int BOX_SIZE; 
 static int OFFSET_X;
 static int OFFSET_Y;
+static int TILE_DIM;    /* Inner tile size in pixels (filled area) */
 
+/* Same order as G2048_UP.. */
 typedef enum { DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT } dir_t;
 
+/* One tile of the last slide: from (r0,c0) to (r1,c1), exponent before merging */
+typedef struct { int line, r0, c0, r1, c1, val; } tile_move_t;
+
 /*********** GLOBAL GAME STATE ***********/
-static int board[GRID_SIZE][GRID_SIZE];
+static const g2048_variant_t *variant;     /* Move kernel for GRID_SIZE */
+static g2048_grid_t board;
 static int score;
 static int game_over;
 static int victory; 
+static int game_counted;                    /* Lost once: undo and lose again is the same game */
+
+/* Spawns come from a xorshift stream seeded per game, so a seed
+ * replays the same tiles for the same moves ('C' restarts with it) */
+static uint32_t rng_state;
+static uint32_t game_seed;
+
+/*********** RENDER STATE ***********/
+static U8             tile_bits[TILE_COUNT][TILE_MAX_BYTES];
+static LCD_COLOR      tile_colors[TILE_COUNT][2];
+static GUI_LOGPALETTE tile_pal[TILE_COUNT];
+static GUI_BITMAP     tile_bmp[TILE_COUNT];
+
+static int full_redraw;                     /* Next draw_scene() repaints all */
+static g2048_grid_t shown;                  /* Tiles currently on the LCD */
+static hud_style_t hud_style;
+static hud_field_t hud_score;               /* Score digits on the LCD */
+static int hud_label_x;
+
+/*********** UNDO HISTORY ***********/
+/* Snapshot: the score a move gained (times 2, plus the victory
+ * flag), the spawn stream after it, then the board as pairs of
+ * 32-bit words: 16 bytes on 3x3 and 4x4, 32 on 6x6.
+ * Move n is at hist[(n % hist_levels) * hist_stride]. Moves
+ * hist_base..hist_top are kept, hist_cur is on the board; past
+ * hist_cur is the redo list. */
+static uint32_t hist[UNDO_WORDS];
+static uint32_t hist_stride, hist_levels;
+static uint32_t hist_base, hist_cur, hist_top;
+
+/*********** ANIMATION & INPUT STATE ***********/
+static tile_move_t moves[G2048_MAX_SIZE * G2048_MAX_SIZE];
+static int num_moves;
+static int anim_frame;                      /* Frame being composed */
+static int anim_horizontal;                 /* Strips are rows, not columns */
+static uint32_t anim_max_us;                /* Slowest frame seen */
+static uint32_t anim_overruns;              /* Frames over ANIM_FRAME_MS */
+
+static char key_queue[KEY_QUEUE_LEN];
+static int  key_head, key_count;
+static char last_key;
+
+/*********** SOLVER STATE ***********/
+static osThreadId_t      solver_thread;
+static g2048_board_t     solver_board;      /* Position asked about */
+static volatile uint32_t solver_asked;      /* Requests made, game thread writes */
+static volatile uint32_t solver_answered;   /* Requests answered, solver writes */
+static volatile int      solver_dir;        /* Answer to the last request */
+static int               solver_pending;    /* Asked, answer not yet played */
+static int               autoplay;          /* 'B': the solver plays every move */
+static int               solver_step;       /* 'A': the solver plays one move */
+static uint32_t          games_played;
+
+static uint64_t solver_stack[SOLVER_STACK_SZ / 8];
+static const osThreadAttr_t solver_thread_attr = {
+  .name       = "2048 solver",
+  .stack_mem  = &solver_stack[0],
+  .stack_size = sizeof(solver_stack),
+  .priority   = osPriorityLow
+};
+
+/* Exponent of the tile at (r, c) */
+#define TILE_AT(r, c)   G2048_GRID_CELL(&board, G2048_GRID_SLOT(GRID_SIZE, r, c))
 
 /*********** INTERNAL PROTOTYPES ***********/
-static void init_game(void);
+static void init_game(uint32_t seed);
+static uint32_t fresh_seed(void);
 static void draw_scene(void);
+static void compose_scene(void *p);
 static void spawn_tile(void);
 static int  move_board(dir_t dir);
 static int  can_move(void);
 static GUI_COLOR get_tile_color(int val);
+static void build_tile_cache(void);
+static void draw_tile(int r, int c);
+static void show_tile(int r, int c);
+static void draw_score(void);
 static void draw_game_over(void);
 
+// Undo history
+static void hist_reset(void);
+static void hist_push(uint32_t gained);
+static int  hist_undo(void);
+static int  hist_redo(void);
+
 // Helper for logic
-static void rotate_board(void);
-static int  slide_and_merge_left(void);
+static void line_cell(dir_t dir, int line, int k, int *r, int *c);
+static void record_line_moves(dir_t dir, int line);
+
+// Animation & input queue
+static void play_animation(dir_t dir);
+static void compose_line(void *p);
+static void poll_keys(void);
+static char next_key(void);
+
+// Solver
+static void solver_start(void);
+static void solver_stop(void);
+static int  solver_poll(void);
 
 /************************************************************
- * PUBLIC ENTRY POINT
+ * PUBLIC ENTRY POINTS
  ************************************************************/
 void Start2048Game(void)
 {
+    Start2048GameSize(G2048_SIZE);
+}
+
+void Start2048GameSize(int size)
+{
+    variant = G2048_Variant(size);
+    if (variant == NULL) return;
+    GRID_SIZE = size;
+
     GUI_Clear();
     
-    // 1. Define Debounce State Variable
-    static char last_key = 0;
-
     // Dynamic Layout Calculation
     int scr_w = LCD_GetXSize();
     int scr_h = LCD_GetYSize();
     
     int min_dim = (scr_w < scr_h) ? scr_w : scr_h;
     
-    BOX_SIZE = (min_dim - 20) / GRID_SIZE; 
+    BOX_SIZE = (min_dim - BOARD_MARGIN) / GRID_SIZE; 
     if (BOX_SIZE < 10) BOX_SIZE = 10; 
+    /* A bigger screen gets a smaller board, not tiles cut short of their slots */
+    if (BOX_SIZE > TILE_MAX_DIM + 2 * CELL_PADDING - 1) BOX_SIZE = TILE_MAX_DIM + 2 * CELL_PADDING - 1;
 
     OFFSET_X = (scr_w - (BOX_SIZE * GRID_SIZE)) / 2;
     OFFSET_Y = (scr_h - (BOX_SIZE * GRID_SIZE)) / 2 + 10; 
 
-    init_game();
+    TILE_DIM = BOX_SIZE - (CELL_PADDING * 2) + 1;
+
+    build_tile_cache();
+
+    /* "SCORE: nnnnnn", centered for the widest score */
+    Hud_StyleInit(&hud_style, GUI_FONT_20_ASCII, GUI_WHITE, BOARD_BG_COLOR);
+    int label_w = Hud_LabelWidth(&hud_style, "SCORE: ");
+    hud_label_x = (scr_w - label_w - 6 * hud_style.cell_w) / 2;
+    Hud_FieldInit(&hud_score, &hud_style, hud_label_x + label_w, 5, 6);
+
+    solver_start();
+    autoplay = 0;
+    solver_step = 0;
+    init_game(fresh_seed());
+
+    /* Flash: this size's tables; RAM: its board state and undo ring */
+    Perf_Report(PERF_EVT_2048_SIZE, variant->flash_bytes,
+                (uint32_t)(2 * sizeof(g2048_grid_t) + hist_levels * hist_stride * 4));
 
     while (1)
     {
         /* ------------------------------
          * INPUT CONTROL & DEBOUNCE
          * ------------------------------ */
-        char current_key = Keypad_Get_Key();
+        poll_keys();
+        char current_key = next_key();
         int moved = 0;
+        int prev_score = score;
+        dir_t dir = DIR_UP;
 
-        // CHECK: Key is pressed AND is different from previous frame
-        if (current_key != 0 && current_key != last_key) 
+        // Key edges are queued, so presses made during an animation are kept
+        if (current_key != 0) 
         {
             if (!game_over) {
-                if (current_key == '2')      moved = move_board(DIR_UP);
-                else if (current_key == '8') moved = move_board(DIR_DOWN);
-                else if (current_key == '4') moved = move_board(DIR_LEFT);
-                else if (current_key == '6') moved = move_board(DIR_RIGHT);
+                if (current_key == '2')      moved = move_board(dir = DIR_UP);
+                else if (current_key == '8') moved = move_board(dir = DIR_DOWN);
+                else if (current_key == '4') moved = move_board(dir = DIR_LEFT);
+                else if (current_key == '6') moved = move_board(dir = DIR_RIGHT);
             }
 
+            /* Undo / redo: only the tiles that differ are redrawn */
+            if (current_key == '*') hist_undo();
+            if (current_key == '0') hist_redo();
+
+            /* Solver keys */
+            if (current_key == 'A') solver_step = 1;
+            if (current_key == 'B') autoplay = !autoplay;
+
             /* System Keys */
-            if (current_key == '#') return;
-            if (current_key == 'D') {
-                init_game();
+            if (current_key == '#') { solver_stop(); return; }
+            if (current_key == 'D' || current_key == 'C') {
+                init_game(current_key == 'C' ? game_seed : fresh_seed());
                 osDelay(200);
+                key_count = 0;
+            }
+        }
+
+        /* The solver's move, once its search is done (4x4 only) */
+        if (!moved && !game_over && (autoplay || solver_step) && GRID_SIZE == G2048_SIZE) {
+            int d = solver_poll();
+            if (d >= 0) {
+                solver_step = 0;
+                moved = move_board(dir = (dir_t)d);
             }
+        }
 
-            /* ------------------------------
-             * MISSING LOGIC RESTORED HERE
-             * ------------------------------ */
-            // We only need to check this if a key was actually pressed
-            if (moved) {
-                spawn_tile(); // Add new '2' or '4'
-                
-                if (!can_move()) {
-                    game_over = 1;
+        /* ------------------------------
+         * MISSING LOGIC RESTORED HERE
+         * ------------------------------ */
+        if (moved) {
+            play_animation(dir);
+            spawn_tile(); // Add new '2' or '4'
+            hist_push((uint32_t)(score - prev_score));
+            
+            if (!can_move()) {
+                game_over = 1;
+                if (!game_counted) {
+                    game_counted = 1;
+                    games_played++;
+                    Perf_Report(PERF_EVT_2048_GAME, (uint32_t)score, games_played);
                 }
             }
         }
-        
-        // Update history for next frame
-        last_key = current_key;
 
         /* ------------------------------
          * RENDER
@@ -118,13 +289,22 @@ void Start2048Game(void)
             while (1) {
                 char k = Keypad_Get_Key();
                 
-                if (k == 'D') {
-                    init_game();
+                if (k == 'D' || k == 'C') {
+                    init_game(k == 'C' ? game_seed : fresh_seed());
                     osDelay(200);
+                    key_count = 0;
+                    last_key = k;
                     break;
                 }
                 
-                if (k == '#') return;
+                if (k == '#') { solver_stop(); return; }
+
+                /* Take back the losing move; the repaint clears the box */
+                if (k == '*' && hist_undo()) {
+                    full_redraw = 1;
+                    last_key = k;
+                    break;
+                }
                 
                 osDelay(50);
             }
@@ -138,149 +318,458 @@ void Start2048Game(void)
 /************************************************************
  * INITIALIZATION
  ************************************************************/
-static void init_game(void)
+static void init_game(uint32_t seed)
 {
+    game_seed = seed ? seed : 0x12345678;  /* xorshift sticks at 0 */
+    rng_state = game_seed;
+    Perf_Report(PERF_EVT_2048_SEED, game_seed, (uint32_t)GRID_SIZE);
+
     score = 0;
     game_over = 0;
     victory = 0;
+    game_counted = 0;
+    full_redraw = 1;
+    num_moves = 0;
 
-    // Clear Board
-    for (int r = 0; r < GRID_SIZE; r++) {
-        for (int c = 0; c < GRID_SIZE; c++) {
-            board[r][c] = 0;
-        }
-    }
+    board = (g2048_grid_t){ { 0 } };
 
     // Spawn 2 initial tiles
     spawn_tile();
     spawn_tile();
+    hist_reset();
+}
+
+/* The cycle count at the key press is random enough */
+static uint32_t fresh_seed(void)
+{
+    return Perf_Cycles() ^ (osKernelGetTickCount() << 16);
+}
+
+/******** RNG *********/
+static uint32_t rng_next(void)
+{
+    uint32_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return rng_state = x;
 }
 
+/* Bit 4i set for each empty cell (zero nibble) i of a grid word */
+static uint64_t empty_flags(uint64_t w)
+{
+    w |= w >> 1;
+    w |= w >> 2;
+    return ~w & 0x1111111111111111ULL;
+}
+
+/* Flags in 32 bits: at most 8, so the nibble sum cannot carry */
+static int flag_count(uint32_t f)
+{
+    return (int)((f * 0x11111111u) >> 28);
+}
+
+/* A 2 (90 %) or a 4 on a uniformly chosen empty cell: the k-th set
+ * bit of the empty mask, one xorshift draw, no library calls */
 static void spawn_tile(void)
 {
-    struct { int r, c; } empty[GRID_SIZE * GRID_SIZE];
+    uint32_t half[2 * G2048_GRID_WORDS];    /* Empty flags, 8 slots per entry */
+    int halves = 2 * variant->words;
+    int per_word = G2048_GRID_ROWS(GRID_SIZE);
     int count = 0;
 
-    for (int r = 0; r < GRID_SIZE; r++) {
-        for (int c = 0; c < GRID_SIZE; c++) {
-            if (board[r][c] == 0) {
-                empty[count].r = r;
-                empty[count].c = c;
-                count++;
-            }
-        }
+    for (int w = 0; w < variant->words; w++) {
+        uint64_t f = empty_flags(board.w[w]);
+        int rows = GRID_SIZE - per_word * w;
+        int used = GRID_SIZE * ((rows < per_word) ? rows : per_word);
+        if (used < 16) f &= (1ULL << (4 * used)) - 1;   /* Past the word's last row */
+
+        half[2 * w]     = (uint32_t)f;
+        half[2 * w + 1] = (uint32_t)(f >> 32);
+        count += flag_count(half[2 * w]) + flag_count(half[2 * w + 1]);
     }
+    if (count == 0) return;
 
-    if (count > 0) {
-        int idx = rand() % count;
-        // 10% chance of a 4, 90% chance of a 2
-        board[empty[idx].r][empty[idx].c] = (rand() % 10 == 0) ? 4 : 2;
+    uint32_t r = rng_next();
+    int k = (int)((r & 0xFFFF) % (uint32_t)count);
+    int h = 0;
+
+    while (h < halves - 1 && k >= flag_count(half[h])) {
+        k -= flag_count(half[h]);
+        h++;
     }
+
+    uint32_t f = half[h];
+    while (k-- > 0) f &= f - 1;             /* Drop the k lowest */
+
+    int i = 8 * h + (int)(__CLZ(__RBIT(f)) / 4);
+    int e = ((r >> 16) % 10 == 0) ? 2 : 1;
+    board.w[G2048_GRID_WORD(i)] |= (uint64_t)e << G2048_GRID_SHIFT(i);
 }
 
 /************************************************************
  * CORE LOGIC (SLIDE & MERGE)
+ * The board itself moves in the size's kernel (2048_board.c);
+ * here the slide is only replayed to get each tile's path for
+ * the animation.
  ************************************************************/
 
-static void rotate_board(void)
+/* Cell k of a line, counted from the edge the tiles slide towards */
+static void line_cell(dir_t dir, int line, int k, int *r, int *c)
 {
-    int temp[GRID_SIZE][GRID_SIZE];
-    // Rotate 90 degrees clockwise
-    for (int r = 0; r < GRID_SIZE; r++) {
-        for (int c = 0; c < GRID_SIZE; c++) {
-            temp[c][GRID_SIZE - 1 - r] = board[r][c];
+    switch (dir) {
+        case DIR_LEFT:  *r = line;              *c = k;                 break;
+        case DIR_RIGHT: *r = line;              *c = GRID_SIZE - 1 - k; break;
+        case DIR_UP:    *r = k;                 *c = line;              break;
+        case DIR_DOWN:  *r = GRID_SIZE - 1 - k; *c = line;              break;
+    }
+}
+
+/* Move vectors of one line for the animation, from the board before
+ * the move. Same slide rules as the table. */
+static void record_line_moves(dir_t dir, int line)
+{
+    int rr[G2048_MAX_SIZE], cc[G2048_MAX_SIZE];
+    int temp_row[G2048_MAX_SIZE];
+    int src[G2048_MAX_SIZE], dest[G2048_MAX_SIZE];
+    int pos = 0;
+
+    // 1. Tiles in slide order, and where they came from
+    for (int k = 0; k < GRID_SIZE; k++) {
+        line_cell(dir, line, k, &rr[k], &cc[k]);
+        int e = TILE_AT(rr[k], cc[k]);
+        if (e != 0) {
+            src[pos] = k;
+            temp_row[pos++] = e;
         }
     }
-    // Copy back
-    for (int r = 0; r < GRID_SIZE; r++) {
-        for (int c = 0; c < GRID_SIZE; c++) {
-            board[r][c] = temp[r][c];
+
+    // 2. Each pair merges once; a merged tile follows its partner
+    int slot = 0;
+    for (int i = 0; i < pos; i++) {
+        dest[i] = slot;
+        if (i + 1 < pos && temp_row[i] == temp_row[i + 1] && temp_row[i] < 15) {
+            dest[++i] = slot;
         }
+        slot++;
+    }
+
+    for (int i = 0; i < pos; i++) {
+        tile_move_t *m = &moves[num_moves++];
+        m->line = line;
+        m->r0 = rr[src[i]];  m->c0 = cc[src[i]];
+        m->r1 = rr[dest[i]]; m->c1 = cc[dest[i]];
+        m->val = temp_row[i];
     }
 }
 
-static int slide_and_merge_left(void)
+static int move_board(dir_t dir)
 {
-    int success = 0;
+    uint32_t gained = 0;
+    int won = 0;
 
-    for (int r = 0; r < GRID_SIZE; r++)
-    {
-        // 1. Shift non-zeros to the left (compress)
-        int temp_row[GRID_SIZE] = {0};
-        int pos = 0;
-        for (int c = 0; c < GRID_SIZE; c++) {
-            if (board[r][c] != 0) {
-                temp_row[pos++] = board[r][c];
-            }
+    g2048_grid_t next = board;
+    uint32_t t0 = Perf_Cycles();
+    int moved = variant->move(&next, dir, &gained, &won);
+    Perf_Report(PERF_EVT_2048_MOVE, Perf_Cycles() - t0, dir);
+
+    num_moves = 0;
+    if (!moved) return 0;
+
+    for (int line = 0; line < GRID_SIZE; line++) {
+        record_line_moves(dir, line);
+    }
+    board = next;
+    score += (int)gained;
+    victory |= won;
+    return 1;
+}
+
+/************************************************************
+ * SLIDE ANIMATION
+ * Plays the move vectors recorded by move_board(). Each frame
+ * recomposes only the rows (or columns) that contain a moving
+ * tile. Frames are paced to ANIM_FRAME_MS; if one takes longer
+ * the next frames are skipped so the slide never runs late.
+ ************************************************************/
+static void play_animation(dir_t dir)
+{
+    int line_moving[G2048_MAX_SIZE] = {0};
+    int any = 0;
+
+    for (int i = 0; i < num_moves; i++) {
+        if (moves[i].r0 != moves[i].r1 || moves[i].c0 != moves[i].c1) {
+            line_moving[moves[i].line] = 1;
+            any = 1;
         }
+    }
+    if (!any) return;
+
+    anim_horizontal = (dir == DIR_LEFT || dir == DIR_RIGHT);
+    uint32_t start = Perf_Cycles();
+    uint32_t frame_max_us = 0;
 
-        // 2. Merge adjacent equals
-        for (int i = 0; i < pos - 1; i++) {
-            if (temp_row[i] == temp_row[i+1] && temp_row[i] != 0) {
-                temp_row[i] *= 2;
-                score += temp_row[i];
-                if (temp_row[i] == 2048) victory = 1;
-                temp_row[i+1] = 0;
-                break;// Skip next since it was merged
+    anim_frame = 1;
+    while (anim_frame <= ANIM_FRAMES)
+    {
+        uint32_t t0 = Perf_Cycles();
+
+        for (int line = 0; line < GRID_SIZE; line++) {
+            if (!line_moving[line]) continue;
+
+            int x0, y0, x1, y1;
+            if (anim_horizontal) {
+                x0 = OFFSET_X;
+                y0 = OFFSET_Y + line * BOX_SIZE;
+                x1 = OFFSET_X + GRID_SIZE * BOX_SIZE - 1;
+                y1 = y0 + BOX_SIZE - 1;
+            } else {
+                x0 = OFFSET_X + line * BOX_SIZE;
+                y0 = OFFSET_Y;
+                x1 = x0 + BOX_SIZE - 1;
+                y1 = OFFSET_Y + GRID_SIZE * BOX_SIZE - 1;
             }
-						
+            Gfx_DrawArea(x0, y0, x1, y1, compose_line, &line);
         }
 
-       // 3. Shift again (compress after merge)
-        int final_row[GRID_SIZE] = {0};
-        pos = 0;
-        for (int i = 0; i < GRID_SIZE; i++) {
-            if (temp_row[i] != 0) {
-                final_row[pos++] = temp_row[i];
-            }
+        uint32_t us = Perf_CyclesToUs(Perf_Cycles() - t0);
+        if (us > frame_max_us) frame_max_us = us;
+        if (us > ANIM_FRAME_MS * 1000U) anim_overruns++;
+
+        poll_keys();
+
+        if (anim_frame == ANIM_FRAMES) break;
+
+        /* Wait for the next frame slot, or catch up if we are behind */
+        uint32_t elapsed_ms = Perf_CyclesToUs(Perf_Cycles() - start) / 1000U;
+        uint32_t due_ms = (uint32_t)anim_frame * ANIM_FRAME_MS;
+        if (elapsed_ms < due_ms) {
+            osDelay(due_ms - elapsed_ms);
+            anim_frame++;
+        } else {
+            int frame = (int)(elapsed_ms / ANIM_FRAME_MS) + 1;
+            anim_frame = (frame > ANIM_FRAMES) ? ANIM_FRAMES : frame;
         }
+    }
 
-        // 4. Update board and check for changes
-        for (int c = 0; c < GRID_SIZE; c++) {
-            if (board[r][c] != final_row[c]) {
-                board[r][c] = final_row[c];
-                success = 1;
-            }
+    /* The last frame shows the final board, keep the cache in step */
+    for (int line = 0; line < GRID_SIZE; line++) {
+        if (!line_moving[line]) continue;
+        for (int k = 0; k < GRID_SIZE; k++) {
+            if (anim_horizontal) show_tile(line, k);
+            else                 show_tile(k, line);
         }
     }
-    return success;
+
+    if (frame_max_us > anim_max_us) anim_max_us = frame_max_us;
+    Perf_Report(PERF_EVT_2048_ANIM, frame_max_us, anim_overruns);
 }
 
-static int move_board(dir_t dir)
+/* One row/column strip of the current animation frame */
+static void compose_line(void *p)
 {
-    int moved = 0;
-    
-    switch (dir) {
-        case DIR_LEFT:
-            moved = slide_and_merge_left();
-            break;
-        case DIR_RIGHT:
-            rotate_board(); rotate_board();
-            moved = slide_and_merge_left();
-            rotate_board(); rotate_board();
-            break;
-        case DIR_UP:
-            rotate_board(); rotate_board(); rotate_board();
-            moved = slide_and_merge_left();
-            rotate_board();
-            break;
-        case DIR_DOWN:
-            rotate_board();
-            moved = slide_and_merge_left();
-            rotate_board(); rotate_board(); rotate_board();
-            break;
+    int line = *(int *)p;
+
+    GUI_SetBkColor(BOARD_BG_COLOR);
+    GUI_Clear();
+
+    for (int k = 0; k < GRID_SIZE; k++) {
+        int r = anim_horizontal ? line : k;
+        int c = anim_horizontal ? k : line;
+        int x0 = OFFSET_X + (c * BOX_SIZE) + CELL_PADDING;
+        int y0 = OFFSET_Y + (r * BOX_SIZE) + CELL_PADDING;
+
+        /* Final frame: the board after the move, merges included */
+        int e = (anim_frame == ANIM_FRAMES) ? TILE_AT(r, c) : 0;
+        GUI_DrawBitmap(&tile_bmp[e], x0, y0);
     }
-    return moved;
+
+    if (anim_frame == ANIM_FRAMES) return;
+
+    for (int i = 0; i < num_moves; i++) {
+        const tile_move_t *m = &moves[i];
+        if (m->line != line) continue;
+
+        int xa = OFFSET_X + (m->c0 * BOX_SIZE) + CELL_PADDING;
+        int ya = OFFSET_Y + (m->r0 * BOX_SIZE) + CELL_PADDING;
+        int xb = OFFSET_X + (m->c1 * BOX_SIZE) + CELL_PADDING;
+        int yb = OFFSET_Y + (m->r1 * BOX_SIZE) + CELL_PADDING;
+
+        GUI_DrawBitmap(&tile_bmp[m->val],
+                       xa + (xb - xa) * anim_frame / ANIM_FRAMES,
+                       ya + (yb - ya) * anim_frame / ANIM_FRAMES);
+    }
+}
+
+/************************************************************
+ * UNDO HISTORY
+ * A fixed ring of snapshots, so undo and redo are one copy
+ * each. A move made after an undo drops the redo list; when
+ * the ring is full the oldest move is forgotten.
+ ************************************************************/
+static uint32_t *hist_entry(uint32_t n)
+{
+    return &hist[(n % hist_levels) * hist_stride];
 }
 
+static void hist_store(uint32_t n, uint32_t gained)
+{
+    uint32_t *h = hist_entry(n);
+
+    h[0] = (gained << 1) | (uint32_t)(victory != 0);
+    h[1] = rng_state;
+    for (int w = 0; w < variant->words; w++) {
+        h[2 + 2 * w] = (uint32_t)board.w[w];
+        h[3 + 2 * w] = (uint32_t)(board.w[w] >> 32);
+    }
+}
+
+static void hist_load(uint32_t n)
+{
+    const uint32_t *h = hist_entry(n);
+
+    victory = (int)(h[0] & 1);
+    rng_state = h[1];   /* Same moves from here give the same spawns */
+    for (int w = 0; w < variant->words; w++)
+        board.w[w] = ((uint64_t)h[3 + 2 * w] << 32) | h[2 + 2 * w];
+}
+
+static void hist_reset(void)
+{
+    hist_stride = 2 + 2 * (uint32_t)variant->words;
+    hist_levels = UNDO_WORDS / hist_stride;
+    hist_base = hist_cur = hist_top = 0;
+    hist_store(0, 0);
+}
+
+static void hist_push(uint32_t gained)
+{
+    hist_top = ++hist_cur;
+    hist_store(hist_cur, gained);
+    if (hist_cur - hist_base >= hist_levels)
+        hist_base = hist_cur - (hist_levels - 1);
+}
+
+static int hist_undo(void)
+{
+    if (hist_cur == hist_base) return 0;
+
+    score -= (int)(hist_entry(hist_cur)[0] >> 1);
+    hist_load(--hist_cur);
+    game_over = 0;
+    return 1;
+}
+
+static int hist_redo(void)
+{
+    if (hist_cur == hist_top) return 0;
+
+    hist_load(++hist_cur);
+    score += (int)(hist_entry(hist_cur)[0] >> 1);
+    if (!can_move()) game_over = 1;
+    return 1;
+}
+
+/************************************************************
+ * SOLVER THREAD
+ * One search per request, on a copy of the board. The game
+ * thread writes solver_board only while no search runs, the
+ * solver publishes solver_dir before solver_answered.
+ ************************************************************/
+static uint32_t solver_clock_ms(void)
+{
+    return osKernelGetTickCount();  /* OS_TICK_FREQ is 1000 */
+}
+
+static __NO_RETURN void solver_thread_fn(void *argument)
+{
+    (void)argument;
+
+    while (1)
+    {
+        osThreadFlagsWait(SOLVER_FLAG_WORK, osFlagsWaitAny, osWaitForever);
+
+        uint32_t n = solver_asked;
+        g2048_ai_stats_t st;
+        int d = G2048AI_Search(solver_board, SOLVER_BUDGET_MS, &st);
+
+        solver_dir = d;
+        __DMB();    // answer before the count that publishes it
+        solver_answered = n;
+
+        Perf_Report(PERF_EVT_2048_AI, (uint32_t)st.depth,
+                    st.ms ? st.nodes * 1000U / st.ms : st.nodes);
+    }
+}
+
+/* The table shares CCM with the other games (Example.sct), so it is
+ * cleared on every start, and no search may outlive the game */
+static void solver_start(void)
+{
+    G2048AI_Init(solver_clock_ms);
+    if (solver_thread == NULL)
+        solver_thread = osThreadNew(solver_thread_fn, NULL, &solver_thread_attr);
+}
+
+static void solver_stop(void)
+{
+    while (solver_answered != solver_asked)
+        osDelay(1);
+    solver_pending = 0;
+}
+
+/* Direction to play for the current board, -1 while the solver is
+ * still searching. A board changed meanwhile is asked about again. */
+static int solver_poll(void)
+{
+    if (solver_answered != solver_asked) return -1;
+
+    if (solver_pending && solver_board == board.w[0]) {
+        solver_pending = 0;
+        return solver_dir;
+    }
+
+    solver_board = board.w[0];
+    solver_pending = 1;
+    solver_asked = solver_asked + 1;
+    osThreadFlagsSet(solver_thread, SOLVER_FLAG_WORK);
+    return -1;
+}
+
+/************************************************************
+ * INPUT QUEUE
+ * Key edges are queued so nothing is lost while a slide plays.
+ ************************************************************/
+static void poll_keys(void)
+{
+    char k = Keypad_Get_Key();
+
+    if (k != 0 && k != last_key && key_count < KEY_QUEUE_LEN) {
+        key_queue[(key_head + key_count) % KEY_QUEUE_LEN] = k;
+        key_count++;
+    }
+    last_key = k;
+}
+
+static char next_key(void)
+{
+    if (key_count == 0) return 0;
+
+    char k = key_queue[key_head];
+    key_head = (key_head + 1) % KEY_QUEUE_LEN;
+    key_count--;
+    return k;
+}
+
+/* Some direction changes the board */
 static int can_move(void)
 {
-    for (int r = 0; r < GRID_SIZE; r++) {
-        for (int c = 0; c < GRID_SIZE; c++) {
-            if (board[r][c] == 0) return 1; // Empty spot
-            if (c < GRID_SIZE - 1 && board[r][c] == board[r][c+1]) return 1; // Right neighbor
-            if (r < GRID_SIZE - 1 && board[r][c] == board[r+1][c]) return 1; // Bottom neighbor
-        }
+    uint32_t gained = 0;
+    int won = 0;
+
+    for (int d = DIR_UP; d <= DIR_RIGHT; d++) {
+        g2048_grid_t t = board;
+        if (variant->move(&t, d, &gained, &won)) return 1;
     }
     return 0;
 }
@@ -308,56 +797,131 @@ static GUI_COLOR get_tile_color(int val)
     }
 }
 
+/************************************************************
+ * TILE CACHE
+ * Every tile value is rasterized once per game start for the
+ * current BOX_SIZE, so drawing a tile is a single bitmap blit.
+ * 1bpp + 2 color palette (tile color, white digits) keeps the
+ * whole cache at a few KB instead of 16 full RGB565 tiles.
+ ************************************************************/
+
+/* Largest font the number fits in, for this board's tile size */
+static const GUI_FONT *tile_font(const char *s)
+{
+    static const GUI_FONT *const fonts[] = {
+        GUI_FONT_32B_ASCII, GUI_FONT_24B_ASCII, GUI_FONT_20_ASCII,
+        GUI_FONT_16_ASCII, GUI_FONT_13_ASCII
+    };
+    int n = (int)(sizeof(fonts) / sizeof(fonts[0]));
+
+    for (int i = 0; i < n - 1; i++) {
+        GUI_SetFont(fonts[i]);
+        if (GUI_GetStringDistX(s) <= TILE_DIM - 4 && GUI_GetFontDistY() <= TILE_DIM)
+            return fonts[i];
+    }
+    return fonts[n - 1];
+}
+
+static void build_tile_cache(void)
+{
+    int bytes_per_line = (TILE_DIM + 7) / 8;
+
+    for (int i = 0; i < TILE_COUNT; i++)
+    {
+        int val = i ? (1 << i) : 0;
+
+        tile_colors[i][0] = get_tile_color(val);
+        tile_colors[i][1] = GUI_WHITE;
+
+        tile_pal[i].NumEntries  = 2;
+        tile_pal[i].HasTrans    = 0;
+        tile_pal[i].pPalEntries = tile_colors[i];
+
+        tile_bmp[i].XSize        = (U16)TILE_DIM;
+        tile_bmp[i].YSize        = (U16)TILE_DIM;
+        tile_bmp[i].BytesPerLine = (U16)bytes_per_line;
+        tile_bmp[i].BitsPerPixel = 1;
+        tile_bmp[i].pData        = tile_bits[i];
+        tile_bmp[i].pPal         = &tile_pal[i];
+        tile_bmp[i].pMethods     = NULL;
+
+        for (int b = 0; b < TILE_MAX_BYTES; b++)
+            tile_bits[i][b] = 0;
+
+        if (val > 0) {
+            char num_buf[12];
+            Hud_Format(num_buf, val);
+            Gfx_RenderText1bpp(tile_bits[i], TILE_DIM, TILE_DIM, tile_font(num_buf), num_buf);
+        }
+    }
+}
+
+static void draw_tile(int r, int c)
+{
+    int x0 = OFFSET_X + (c * BOX_SIZE) + CELL_PADDING;
+    int y0 = OFFSET_Y + (r * BOX_SIZE) + CELL_PADDING;
+
+    show_tile(r, c);
+    GUI_DrawBitmap(&tile_bmp[TILE_AT(r, c)], x0, y0);
+}
+
+/* Mark the tile at (r, c) as on the LCD */
+static void show_tile(int r, int c)
+{
+    int i = G2048_GRID_SLOT(GRID_SIZE, r, c);
+    int w = G2048_GRID_WORD(i);
+    uint64_t mask = 0xFULL << G2048_GRID_SHIFT(i);
+
+    shown.w[w] = (shown.w[w] & ~mask) | (board.w[w] & mask);
+}
+
+static void draw_score(void)
+{
+    Hud_Label(&hud_style, "SCORE: ", hud_label_x, 5);
+    Hud_Draw(&hud_score, score);
+}
+
+/************************************************************
+ * DRAW SCENE
+ * Full repaint after init, otherwise only the tiles whose
+ * value differs from what is on screen: the nibbles set in
+ * shown ^ board. An idle board costs a compare per word.
+ ************************************************************/
 static void draw_scene(void)
 {
-    GUI_SetBkColor(0x00444444); 
+    if (full_redraw) {
+        Gfx_DrawFrame(compose_scene, NULL);
+        full_redraw = 0;
+        return;
+    }
+
+    Hud_Update(&hud_score, score);
+
+    int per_word = G2048_GRID_ROWS(GRID_SIZE);
+
+    for (int w = 0; w < variant->words; w++) {
+        uint64_t diff = shown.w[w] ^ board.w[w];
+        for (int j = 0; diff != 0; j++, diff >>= 4) {
+            if (diff & 0xF) draw_tile(per_word * w + j / GRID_SIZE, j % GRID_SIZE);
+        }
+    }
+}
+
+/* Whole frame, composed band by band off-screen */
+static void compose_scene(void *p)
+{
+    (void)p;
+
+    GUI_SetBkColor(BOARD_BG_COLOR);
     GUI_Clear();
 
     /* Draw Header */
-    GUI_SetColor(GUI_WHITE);
-    GUI_SetFont(GUI_FONT_20_ASCII);
-    char score_buf[32];
-    sprintf(score_buf, "SCORE: %d", score);
-    GUI_DispStringHCenterAt(score_buf, LCD_GetXSize() / 2, 5);
+    draw_score();
 
     /* Draw Grid */
-    for (int r = 0; r < GRID_SIZE; r++)
-    {
-        for (int c = 0; c < GRID_SIZE; c++)
-        {
-            int val = board[r][c];
-            int x0 = OFFSET_X + (c * BOX_SIZE) + CELL_PADDING;
-            int y0 = OFFSET_Y + (r * BOX_SIZE) + CELL_PADDING;
-            int x1 = x0 + BOX_SIZE - (CELL_PADDING * 2);
-            int y1 = y0 + BOX_SIZE - (CELL_PADDING * 2);
-
-            // Draw Tile Background
-            GUI_SetColor(get_tile_color(val));
-            GUI_FillRect(x0, y0, x1, y1);
-
-            // Draw Number
-           // Draw Number
-            if (val > 0) {
-                // CHANGED: Force Black color for all numbers
-                GUI_SetColor(GUI_WHITE);         
-                
-                // Adjust font size based on number length
-                if (val < 100) GUI_SetFont(GUI_FONT_32B_ASCII);
-                else if (val < 1000) GUI_SetFont(GUI_FONT_24B_ASCII);
-                else GUI_SetFont(GUI_FONT_20_ASCII);
-
-                char num_buf[8];
-                sprintf(num_buf, "%d", val);
-                
-                // Calculate centering
-                int tx_size = GUI_GetStringDistX(num_buf);
-                int ty_size = GUI_GetFontSizeY();
-                
-                int tx = x0 + ((x1 - x0) - tx_size) / 2;
-                int ty = y0 + ((y1 - y0) - ty_size) / 2;
-                
-                GUI_DispStringAt(num_buf, tx, ty);
-            }
+    for (int r = 0; r < GRID_SIZE; r++) {
+        for (int c = 0; c < GRID_SIZE; c++) {
+            draw_tile(r, c);
         }
     }
 }
@@ -388,5 +952,5 @@ static void draw_game_over(void)
     GUI_SetFont(GUI_FONT_16_ASCII);
     
     /* UPDATED INSTRUCTION TEXT */
-    GUI_DispStringHCenterAt("Press 'D' to Restart", LCD_GetXSize()/2, y + 60);
+    GUI_DispStringHCenterAt("'D' Restart  'C' Replay", LCD_GetXSize()/2, y + 60);
 }
\ No newline at end of file
@@ -2,5 +2,7 @@
 #define G2048_GAME_H
 
 void Start2048Game(void);
+/* Same game on a 3x3, 5x5 or 6x6 board (4 is the default above) */
+void Start2048GameSize(int size);
 
 #endif
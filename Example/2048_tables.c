@@ -0,0 +1,9227 @@
+/* 2048_tables.c - generated by tools/gen_2048_tables.py, do not edit */
+#include "2048_tables.h"
+
+const uint32_t row_left_table[65536] = {
+    0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+    0x00000008, 0x00000009, 0x0000000A, 0x0000000B, 0x0000000C, 0x0000000D, 0x0000000E, 0x0000000F,
+    0x00000001, 0x00010002, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016, 0x00000017,
+    0x00000018, 0x00000019, 0x0000001A, 0x0000001B, 0x0000001C, 0x0000001D, 0x0000001E, 0x0000001F,
+    0x00000002, 0x00000021, 0x00020003, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027,
+    0x00000028, 0x00000029, 0x0000002A, 0x0000002B, 0x0000002C, 0x0000002D, 0x0000002E, 0x0000002F,
+    0x00000003, 0x00000031, 0x00000032, 0x00040004, 0x00000034, 0x00000035, 0x00000036, 0x00000037,
+    0x00000038, 0x00000039, 0x0000003A, 0x0000003B, 0x0000003C, 0x0000003D, 0x0000003E, 0x0000003F,
+    0x00000004, 0x00000041, 0x00000042, 0x00000043, 0x00080005, 0x00000045, 0x00000046, 0x00000047,
+    0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F,
+    0x00000005, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00100006, 0x00000056, 0x00000057,
+    0x00000058, 0x00000059, 0x0000005A, 0x0000005B, 0x0000005C, 0x0000005D, 0x0000005E, 0x0000005F,
+    0x00000006, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00200007, 0x00000067,
+    0x00000068, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F,
+    0x00000007, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00400008,
+    0x00000078, 0x00000079, 0x0000007A, 0x0000007B, 0x0000007C, 0x0000007D, 0x0000007E, 0x0000007F,
+    0x00000008, 0x00000081, 0x00000082, 0x00000083, 0x00000084, 0x00000085, 0x00000086, 0x00000087,
+    0x00800009, 0x00000089, 0x0000008A, 0x0000008B, 0x0000008C, 0x0000008D, 0x0000008E, 0x0000008F,
+    0x00000009, 0x00000091, 0x00000092, 0x00000093, 0x00000094, 0x00000095, 0x00000096, 0x00000097,
+    0x00000098, 0x0100000A, 0x0000009A, 0x0000009B, 0x0000009C, 0x0000009D, 0x0000009E, 0x0000009F,
+    0x0000000A, 0x000000A1, 0x000000A2, 0x000000A3, 0x000000A4, 0x000000A5, 0x000000A6, 0x000000A7,
+    0x000000A8, 0x000000A9, 0x8200000B, 0x000000AB, 0x000000AC, 0x000000AD, 0x000000AE, 0x000000AF,
+    0x0000000B, 0x000000B1, 0x000000B2, 0x000000B3, 0x000000B4, 0x000000B5, 0x000000B6, 0x000000B7,
+    0x000000B8, 0x000000B9, 0x000000BA, 0x0400000C, 0x000000BC, 0x000000BD, 0x000000BE, 0x000000BF,
+    0x0000000C, 0x000000C1, 0x000000C2, 0x000000C3, 0x000000C4, 0x000000C5, 0x000000C6, 0x000000C7,
+    0x000000C8, 0x000000C9, 0x000000CA, 0x000000CB, 0x0800000D, 0x000000CD, 0x000000CE, 0x000000CF,
+    0x0000000D, 0x000000D1, 0x000000D2, 0x000000D3, 0x000000D4, 0x000000D5, 0x000000D6, 0x000000D7,
+    0x000000D8, 0x000000D9, 0x000000DA, 0x000000DB, 0x000000DC, 0x1000000E, 0x000000DE, 0x000000DF,
+    0x0000000E, 0x000000E1, 0x000000E2, 0x000000E3, 0x000000E4, 0x000000E5, 0x000000E6, 0x000000E7,
+    0x000000E8, 0x000000E9, 0x000000EA, 0x000000EB, 0x000000EC, 0x000000ED, 0x2000000F, 0x000000EF,
+    0x0000000F, 0x000000F1, 0x000000F2, 0x000000F3, 0x000000F4, 0x000000F5, 0x000000F6, 0x000000F7,
+    0x000000F8, 0x000000F9, 0x000000FA, 0x000000FB, 0x000000FC, 0x000000FD, 0x000000FE, 0x000000FF,
+    0x00000001, 0x00010002, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016, 0x00000017,
+    0x00000018, 0x00000019, 0x0000001A, 0x0000001B, 0x0000001C, 0x0000001D, 0x0000001E, 0x0000001F,
+    0x00010002, 0x00010012, 0x00010022, 0x00010023, 0x00010024, 0x00010025, 0x00010026, 0x00010027,
+    0x00010028, 0x00010029, 0x0001002A, 0x0001002B, 0x0001002C, 0x0001002D, 0x0001002E, 0x0001002F,
+    0x00000012, 0x00000121, 0x00020013, 0x00000123, 0x00000124, 0x00000125, 0x00000126, 0x00000127,
+    0x00000128, 0x00000129, 0x0000012A, 0x0000012B, 0x0000012C, 0x0000012D, 0x0000012E, 0x0000012F,
+    0x00000013, 0x00000131, 0x00000132, 0x00040014, 0x00000134, 0x00000135, 0x00000136, 0x00000137,
+    0x00000138, 0x00000139, 0x0000013A, 0x0000013B, 0x0000013C, 0x0000013D, 0x0000013E, 0x0000013F,
+    0x00000014, 0x00000141, 0x00000142, 0x00000143, 0x00080015, 0x00000145, 0x00000146, 0x00000147,
+    0x00000148, 0x00000149, 0x0000014A, 0x0000014B, 0x0000014C, 0x0000014D, 0x0000014E, 0x0000014F,
+    0x00000015, 0x00000151, 0x00000152, 0x00000153, 0x00000154, 0x00100016, 0x00000156, 0x00000157,
+    0x00000158, 0x00000159, 0x0000015A, 0x0000015B, 0x0000015C, 0x0000015D, 0x0000015E, 0x0000015F,
+    0x00000016, 0x00000161, 0x00000162, 0x00000163, 0x00000164, 0x00000165, 0x00200017, 0x00000167,
+    0x00000168, 0x00000169, 0x0000016A, 0x0000016B, 0x0000016C, 0x0000016D, 0x0000016E, 0x0000016F,
+    0x00000017, 0x00000171, 0x00000172, 0x00000173, 0x00000174, 0x00000175, 0x00000176, 0x00400018,
+    0x00000178, 0x00000179, 0x0000017A, 0x0000017B, 0x0000017C, 0x0000017D, 0x0000017E, 0x0000017F,
+    0x00000018, 0x00000181, 0x00000182, 0x00000183, 0x00000184, 0x00000185, 0x00000186, 0x00000187,
+    0x00800019, 0x00000189, 0x0000018A, 0x0000018B, 0x0000018C, 0x0000018D, 0x0000018E, 0x0000018F,
+    0x00000019, 0x00000191, 0x00000192, 0x00000193, 0x00000194, 0x00000195, 0x00000196, 0x00000197,
+    0x00000198, 0x0100001A, 0x0000019A, 0x0000019B, 0x0000019C, 0x0000019D, 0x0000019E, 0x0000019F,
+    0x0000001A, 0x000001A1, 0x000001A2, 0x000001A3, 0x000001A4, 0x000001A5, 0x000001A6, 0x000001A7,
+    0x000001A8, 0x000001A9, 0x8200001B, 0x000001AB, 0x000001AC, 0x000001AD, 0x000001AE, 0x000001AF,
+    0x0000001B, 0x000001B1, 0x000001B2, 0x000001B3, 0x000001B4, 0x000001B5, 0x000001B6, 0x000001B7,
+    0x000001B8, 0x000001B9, 0x000001BA, 0x0400001C, 0x000001BC, 0x000001BD, 0x000001BE, 0x000001BF,
+    0x0000001C, 0x000001C1, 0x000001C2, 0x000001C3, 0x000001C4, 0x000001C5, 0x000001C6, 0x000001C7,
+    0x000001C8, 0x000001C9, 0x000001CA, 0x000001CB, 0x0800001D, 0x000001CD, 0x000001CE, 0x000001CF,
+    0x0000001D, 0x000001D1, 0x000001D2, 0x000001D3, 0x000001D4, 0x000001D5, 0x000001D6, 0x000001D7,
+    0x000001D8, 0x000001D9, 0x000001DA, 0x000001DB, 0x000001DC, 0x1000001E, 0x000001DE, 0x000001DF,
+    0x0000001E, 0x000001E1, 0x000001E2, 0x000001E3, 0x000001E4, 0x000001E5, 0x000001E6, 0x000001E7,
+    0x000001E8, 0x000001E9, 0x000001EA, 0x000001EB, 0x000001EC, 0x000001ED, 0x2000001F, 0x000001EF,
+    0x0000001F, 0x000001F1, 0x000001F2, 0x000001F3, 0x000001F4, 0x000001F5, 0x000001F6, 0x000001F7,
+    0x000001F8, 0x000001F9, 0x000001FA, 0x000001FB, 0x000001FC, 0x000001FD, 0x000001FE, 0x000001FF,
+    0x00000002, 0x00000021, 0x00020003, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027,
+    0x00000028, 0x00000029, 0x0000002A, 0x0000002B, 0x0000002C, 0x0000002D, 0x0000002E, 0x0000002F,
+    0x00000021, 0x00010022, 0x00000212, 0x00000213, 0x00000214, 0x00000215, 0x00000216, 0x00000217,
+    0x00000218, 0x00000219, 0x0000021A, 0x0000021B, 0x0000021C, 0x0000021D, 0x0000021E, 0x0000021F,
+    0x00020003, 0x00020031, 0x00020023, 0x00020033, 0x00020034, 0x00020035, 0x00020036, 0x00020037,
+    0x00020038, 0x00020039, 0x0002003A, 0x0002003B, 0x0002003C, 0x0002003D, 0x0002003E, 0x0002003F,
+    0x00000023, 0x00000231, 0x00000232, 0x00040024, 0x00000234, 0x00000235, 0x00000236, 0x00000237,
+    0x00000238, 0x00000239, 0x0000023A, 0x0000023B, 0x0000023C, 0x0000023D, 0x0000023E, 0x0000023F,
+    0x00000024, 0x00000241, 0x00000242, 0x00000243, 0x00080025, 0x00000245, 0x00000246, 0x00000247,
+    0x00000248, 0x00000249, 0x0000024A, 0x0000024B, 0x0000024C, 0x0000024D, 0x0000024E, 0x0000024F,
+    0x00000025, 0x00000251, 0x00000252, 0x00000253, 0x00000254, 0x00100026, 0x00000256, 0x00000257,
+    0x00000258, 0x00000259, 0x0000025A, 0x0000025B, 0x0000025C, 0x0000025D, 0x0000025E, 0x0000025F,
+    0x00000026, 0x00000261, 0x00000262, 0x00000263, 0x00000264, 0x00000265, 0x00200027, 0x00000267,
+    0x00000268, 0x00000269, 0x0000026A, 0x0000026B, 0x0000026C, 0x0000026D, 0x0000026E, 0x0000026F,
+    0x00000027, 0x00000271, 0x00000272, 0x00000273, 0x00000274, 0x00000275, 0x00000276, 0x00400028,
+    0x00000278, 0x00000279, 0x0000027A, 0x0000027B, 0x0000027C, 0x0000027D, 0x0000027E, 0x0000027F,
+    0x00000028, 0x00000281, 0x00000282, 0x00000283, 0x00000284, 0x00000285, 0x00000286, 0x00000287,
+    0x00800029, 0x00000289, 0x0000028A, 0x0000028B, 0x0000028C, 0x0000028D, 0x0000028E, 0x0000028F,
+    0x00000029, 0x00000291, 0x00000292, 0x00000293, 0x00000294, 0x00000295, 0x00000296, 0x00000297,
+    0x00000298, 0x0100002A, 0x0000029A, 0x0000029B, 0x0000029C, 0x0000029D, 0x0000029E, 0x0000029F,
+    0x0000002A, 0x000002A1, 0x000002A2, 0x000002A3, 0x000002A4, 0x000002A5, 0x000002A6, 0x000002A7,
+    0x000002A8, 0x000002A9, 0x8200002B, 0x000002AB, 0x000002AC, 0x000002AD, 0x000002AE, 0x000002AF,
+    0x0000002B, 0x000002B1, 0x000002B2, 0x000002B3, 0x000002B4, 0x000002B5, 0x000002B6, 0x000002B7,
+    0x000002B8, 0x000002B9, 0x000002BA, 0x0400002C, 0x000002BC, 0x000002BD, 0x000002BE, 0x000002BF,
+    0x0000002C, 0x000002C1, 0x000002C2, 0x000002C3, 0x000002C4, 0x000002C5, 0x000002C6, 0x000002C7,
+    0x000002C8, 0x000002C9, 0x000002CA, 0x000002CB, 0x0800002D, 0x000002CD, 0x000002CE, 0x000002CF,
+    0x0000002D, 0x000002D1, 0x000002D2, 0x000002D3, 0x000002D4, 0x000002D5, 0x000002D6, 0x000002D7,
+    0x000002D8, 0x000002D9, 0x000002DA, 0x000002DB, 0x000002DC, 0x1000002E, 0x000002DE, 0x000002DF,
+    0x0000002E, 0x000002E1, 0x000002E2, 0x000002E3, 0x000002E4, 0x000002E5, 0x000002E6, 0x000002E7,
+    0x000002E8, 0x000002E9, 0x000002EA, 0x000002EB, 0x000002EC, 0x000002ED, 0x2000002F, 0x000002EF,
+    0x0000002F, 0x000002F1, 0x000002F2, 0x000002F3, 0x000002F4, 0x000002F5, 0x000002F6, 0x000002F7,
+    0x000002F8, 0x000002F9, 0x000002FA, 0x000002FB, 0x000002FC, 0x000002FD, 0x000002FE, 0x000002FF,
+    0x00000003, 0x00000031, 0x00000032, 0x00040004, 0x00000034, 0x00000035, 0x00000036, 0x00000037,
+    0x00000038, 0x00000039, 0x0000003A, 0x0000003B, 0x0000003C, 0x0000003D, 0x0000003E, 0x0000003F,
+    0x00000031, 0x00010032, 0x00000312, 0x00000313, 0x00000314, 0x00000315, 0x00000316, 0x00000317,
+    0x00000318, 0x00000319, 0x0000031A, 0x0000031B, 0x0000031C, 0x0000031D, 0x0000031E, 0x0000031F,
+    0x00000032, 0x00000321, 0x00020033, 0x00000323, 0x00000324, 0x00000325, 0x00000326, 0x00000327,
+    0x00000328, 0x00000329, 0x0000032A, 0x0000032B, 0x0000032C, 0x0000032D, 0x0000032E, 0x0000032F,
+    0x00040004, 0x00040041, 0x00040042, 0x00040034, 0x00040044, 0x00040045, 0x00040046, 0x00040047,
+    0x00040048, 0x00040049, 0x0004004A, 0x0004004B, 0x0004004C, 0x0004004D, 0x0004004E, 0x0004004F,
+    0x00000034, 0x00000341, 0x00000342, 0x00000343, 0x00080035, 0x00000345, 0x00000346, 0x00000347,
+    0x00000348, 0x00000349, 0x0000034A, 0x0000034B, 0x0000034C, 0x0000034D, 0x0000034E, 0x0000034F,
+    0x00000035, 0x00000351, 0x00000352, 0x00000353, 0x00000354, 0x00100036, 0x00000356, 0x00000357,
+    0x00000358, 0x00000359, 0x0000035A, 0x0000035B, 0x0000035C, 0x0000035D, 0x0000035E, 0x0000035F,
+    0x00000036, 0x00000361, 0x00000362, 0x00000363, 0x00000364, 0x00000365, 0x00200037, 0x00000367,
+    0x00000368, 0x00000369, 0x0000036A, 0x0000036B, 0x0000036C, 0x0000036D, 0x0000036E, 0x0000036F,
+    0x00000037, 0x00000371, 0x00000372, 0x00000373, 0x00000374, 0x00000375, 0x00000376, 0x00400038,
+    0x00000378, 0x00000379, 0x0000037A, 0x0000037B, 0x0000037C, 0x0000037D, 0x0000037E, 0x0000037F,
+    0x00000038, 0x00000381, 0x00000382, 0x00000383, 0x00000384, 0x00000385, 0x00000386, 0x00000387,
+    0x00800039, 0x00000389, 0x0000038A, 0x0000038B, 0x0000038C, 0x0000038D, 0x0000038E, 0x0000038F,
+    0x00000039, 0x00000391, 0x00000392, 0x00000393, 0x00000394, 0x00000395, 0x00000396, 0x00000397,
+    0x00000398, 0x0100003A, 0x0000039A, 0x0000039B, 0x0000039C, 0x0000039D, 0x0000039E, 0x0000039F,
+    0x0000003A, 0x000003A1, 0x000003A2, 0x000003A3, 0x000003A4, 0x000003A5, 0x000003A6, 0x000003A7,
+    0x000003A8, 0x000003A9, 0x8200003B, 0x000003AB, 0x000003AC, 0x000003AD, 0x000003AE, 0x000003AF,
+    0x0000003B, 0x000003B1, 0x000003B2, 0x000003B3, 0x000003B4, 0x000003B5, 0x000003B6, 0x000003B7,
+    0x000003B8, 0x000003B9, 0x000003BA, 0x0400003C, 0x000003BC, 0x000003BD, 0x000003BE, 0x000003BF,
+    0x0000003C, 0x000003C1, 0x000003C2, 0x000003C3, 0x000003C4, 0x000003C5, 0x000003C6, 0x000003C7,
+    0x000003C8, 0x000003C9, 0x000003CA, 0x000003CB, 0x0800003D, 0x000003CD, 0x000003CE, 0x000003CF,
+    0x0000003D, 0x000003D1, 0x000003D2, 0x000003D3, 0x000003D4, 0x000003D5, 0x000003D6, 0x000003D7,
+    0x000003D8, 0x000003D9, 0x000003DA, 0x000003DB, 0x000003DC, 0x1000003E, 0x000003DE, 0x000003DF,
+    0x0000003E, 0x000003E1, 0x000003E2, 0x000003E3, 0x000003E4, 0x000003E5, 0x000003E6, 0x000003E7,
+    0x000003E8, 0x000003E9, 0x000003EA, 0x000003EB, 0x000003EC, 0x000003ED, 0x2000003F, 0x000003EF,
+    0x0000003F, 0x000003F1, 0x000003F2, 0x000003F3, 0x000003F4, 0x000003F5, 0x000003F6, 0x000003F7,
+    0x000003F8, 0x000003F9, 0x000003FA, 0x000003FB, 0x000003FC, 0x000003FD, 0x000003FE, 0x000003FF,
+    0x00000004, 0x00000041, 0x00000042, 0x00000043, 0x00080005, 0x00000045, 0x00000046, 0x00000047,
+    0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F,
+    0x00000041, 0x00010042, 0x00000412, 0x00000413, 0x00000414, 0x00000415, 0x00000416, 0x00000417,
+    0x00000418, 0x00000419, 0x0000041A, 0x0000041B, 0x0000041C, 0x0000041D, 0x0000041E, 0x0000041F,
+    0x00000042, 0x00000421, 0x00020043, 0x00000423, 0x00000424, 0x00000425, 0x00000426, 0x00000427,
+    0x00000428, 0x00000429, 0x0000042A, 0x0000042B, 0x0000042C, 0x0000042D, 0x0000042E, 0x0000042F,
+    0x00000043, 0x00000431, 0x00000432, 0x00040044, 0x00000434, 0x00000435, 0x00000436, 0x00000437,
+    0x00000438, 0x00000439, 0x0000043A, 0x0000043B, 0x0000043C, 0x0000043D, 0x0000043E, 0x0000043F,
+    0x00080005, 0x00080051, 0x00080052, 0x00080053, 0x00080045, 0x00080055, 0x00080056, 0x00080057,
+    0x00080058, 0x00080059, 0x0008005A, 0x0008005B, 0x0008005C, 0x0008005D, 0x0008005E, 0x0008005F,
+    0x00000045, 0x00000451, 0x00000452, 0x00000453, 0x00000454, 0x00100046, 0x00000456, 0x00000457,
+    0x00000458, 0x00000459, 0x0000045A, 0x0000045B, 0x0000045C, 0x0000045D, 0x0000045E, 0x0000045F,
+    0x00000046, 0x00000461, 0x00000462, 0x00000463, 0x00000464, 0x00000465, 0x00200047, 0x00000467,
+    0x00000468, 0x00000469, 0x0000046A, 0x0000046B, 0x0000046C, 0x0000046D, 0x0000046E, 0x0000046F,
+    0x00000047, 0x00000471, 0x00000472, 0x00000473, 0x00000474, 0x00000475, 0x00000476, 0x00400048,
+    0x00000478, 0x00000479, 0x0000047A, 0x0000047B, 0x0000047C, 0x0000047D, 0x0000047E, 0x0000047F,
+    0x00000048, 0x00000481, 0x00000482, 0x00000483, 0x00000484, 0x00000485, 0x00000486, 0x00000487,
+    0x00800049, 0x00000489, 0x0000048A, 0x0000048B, 0x0000048C, 0x0000048D, 0x0000048E, 0x0000048F,
+    0x00000049, 0x00000491, 0x00000492, 0x00000493, 0x00000494, 0x00000495, 0x00000496, 0x00000497,
+    0x00000498, 0x0100004A, 0x0000049A, 0x0000049B, 0x0000049C, 0x0000049D, 0x0000049E, 0x0000049F,
+    0x0000004A, 0x000004A1, 0x000004A2, 0x000004A3, 0x000004A4, 0x000004A5, 0x000004A6, 0x000004A7,
+    0x000004A8, 0x000004A9, 0x8200004B, 0x000004AB, 0x000004AC, 0x000004AD, 0x000004AE, 0x000004AF,
+    0x0000004B, 0x000004B1, 0x000004B2, 0x000004B3, 0x000004B4, 0x000004B5, 0x000004B6, 0x000004B7,
+    0x000004B8, 0x000004B9, 0x000004BA, 0x0400004C, 0x000004BC, 0x000004BD, 0x000004BE, 0x000004BF,
+    0x0000004C, 0x000004C1, 0x000004C2, 0x000004C3, 0x000004C4, 0x000004C5, 0x000004C6, 0x000004C7,
+    0x000004C8, 0x000004C9, 0x000004CA, 0x000004CB, 0x0800004D, 0x000004CD, 0x000004CE, 0x000004CF,
+    0x0000004D, 0x000004D1, 0x000004D2, 0x000004D3, 0x000004D4, 0x000004D5, 0x000004D6, 0x000004D7,
+    0x000004D8, 0x000004D9, 0x000004DA, 0x000004DB, 0x000004DC, 0x1000004E, 0x000004DE, 0x000004DF,
+    0x0000004E, 0x000004E1, 0x000004E2, 0x000004E3, 0x000004E4, 0x000004E5, 0x000004E6, 0x000004E7,
+    0x000004E8, 0x000004E9, 0x000004EA, 0x000004EB, 0x000004EC, 0x000004ED, 0x2000004F, 0x000004EF,
+    0x0000004F, 0x000004F1, 0x000004F2, 0x000004F3, 0x000004F4, 0x000004F5, 0x000004F6, 0x000004F7,
+    0x000004F8, 0x000004F9, 0x000004FA, 0x000004FB, 0x000004FC, 0x000004FD, 0x000004FE, 0x000004FF,
+    0x00000005, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00100006, 0x00000056, 0x00000057,
+    0x00000058, 0x00000059, 0x0000005A, 0x0000005B, 0x0000005C, 0x0000005D, 0x0000005E, 0x0000005F,
+    0x00000051, 0x00010052, 0x00000512, 0x00000513, 0x00000514, 0x00000515, 0x00000516, 0x00000517,
+    0x00000518, 0x00000519, 0x0000051A, 0x0000051B, 0x0000051C, 0x0000051D, 0x0000051E, 0x0000051F,
+    0x00000052, 0x00000521, 0x00020053, 0x00000523, 0x00000524, 0x00000525, 0x00000526, 0x00000527,
+    0x00000528, 0x00000529, 0x0000052A, 0x0000052B, 0x0000052C, 0x0000052D, 0x0000052E, 0x0000052F,
+    0x00000053, 0x00000531, 0x00000532, 0x00040054, 0x00000534, 0x00000535, 0x00000536, 0x00000537,
+    0x00000538, 0x00000539, 0x0000053A, 0x0000053B, 0x0000053C, 0x0000053D, 0x0000053E, 0x0000053F,
+    0x00000054, 0x00000541, 0x00000542, 0x00000543, 0x00080055, 0x00000545, 0x00000546, 0x00000547,
+    0x00000548, 0x00000549, 0x0000054A, 0x0000054B, 0x0000054C, 0x0000054D, 0x0000054E, 0x0000054F,
+    0x00100006, 0x00100061, 0x00100062, 0x00100063, 0x00100064, 0x00100056, 0x00100066, 0x00100067,
+    0x00100068, 0x00100069, 0x0010006A, 0x0010006B, 0x0010006C, 0x0010006D, 0x0010006E, 0x0010006F,
+    0x00000056, 0x00000561, 0x00000562, 0x00000563, 0x00000564, 0x00000565, 0x00200057, 0x00000567,
+    0x00000568, 0x00000569, 0x0000056A, 0x0000056B, 0x0000056C, 0x0000056D, 0x0000056E, 0x0000056F,
+    0x00000057, 0x00000571, 0x00000572, 0x00000573, 0x00000574, 0x00000575, 0x00000576, 0x00400058,
+    0x00000578, 0x00000579, 0x0000057A, 0x0000057B, 0x0000057C, 0x0000057D, 0x0000057E, 0x0000057F,
+    0x00000058, 0x00000581, 0x00000582, 0x00000583, 0x00000584, 0x00000585, 0x00000586, 0x00000587,
+    0x00800059, 0x00000589, 0x0000058A, 0x0000058B, 0x0000058C, 0x0000058D, 0x0000058E, 0x0000058F,
+    0x00000059, 0x00000591, 0x00000592, 0x00000593, 0x00000594, 0x00000595, 0x00000596, 0x00000597,
+    0x00000598, 0x0100005A, 0x0000059A, 0x0000059B, 0x0000059C, 0x0000059D, 0x0000059E, 0x0000059F,
+    0x0000005A, 0x000005A1, 0x000005A2, 0x000005A3, 0x000005A4, 0x000005A5, 0x000005A6, 0x000005A7,
+    0x000005A8, 0x000005A9, 0x8200005B, 0x000005AB, 0x000005AC, 0x000005AD, 0x000005AE, 0x000005AF,
+    0x0000005B, 0x000005B1, 0x000005B2, 0x000005B3, 0x000005B4, 0x000005B5, 0x000005B6, 0x000005B7,
+    0x000005B8, 0x000005B9, 0x000005BA, 0x0400005C, 0x000005BC, 0x000005BD, 0x000005BE, 0x000005BF,
+    0x0000005C, 0x000005C1, 0x000005C2, 0x000005C3, 0x000005C4, 0x000005C5, 0x000005C6, 0x000005C7,
+    0x000005C8, 0x000005C9, 0x000005CA, 0x000005CB, 0x0800005D, 0x000005CD, 0x000005CE, 0x000005CF,
+    0x0000005D, 0x000005D1, 0x000005D2, 0x000005D3, 0x000005D4, 0x000005D5, 0x000005D6, 0x000005D7,
+    0x000005D8, 0x000005D9, 0x000005DA, 0x000005DB, 0x000005DC, 0x1000005E, 0x000005DE, 0x000005DF,
+    0x0000005E, 0x000005E1, 0x000005E2, 0x000005E3, 0x000005E4, 0x000005E5, 0x000005E6, 0x000005E7,
+    0x000005E8, 0x000005E9, 0x000005EA, 0x000005EB, 0x000005EC, 0x000005ED, 0x2000005F, 0x000005EF,
+    0x0000005F, 0x000005F1, 0x000005F2, 0x000005F3, 0x000005F4, 0x000005F5, 0x000005F6, 0x000005F7,
+    0x000005F8, 0x000005F9, 0x000005FA, 0x000005FB, 0x000005FC, 0x000005FD, 0x000005FE, 0x000005FF,
+    0x00000006, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00200007, 0x00000067,
+    0x00000068, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F,
+    0x00000061, 0x00010062, 0x00000612, 0x00000613, 0x00000614, 0x00000615, 0x00000616, 0x00000617,
+    0x00000618, 0x00000619, 0x0000061A, 0x0000061B, 0x0000061C, 0x0000061D, 0x0000061E, 0x0000061F,
+    0x00000062, 0x00000621, 0x00020063, 0x00000623, 0x00000624, 0x00000625, 0x00000626, 0x00000627,
+    0x00000628, 0x00000629, 0x0000062A, 0x0000062B, 0x0000062C, 0x0000062D, 0x0000062E, 0x0000062F,
+    0x00000063, 0x00000631, 0x00000632, 0x00040064, 0x00000634, 0x00000635, 0x00000636, 0x00000637,
+    0x00000638, 0x00000639, 0x0000063A, 0x0000063B, 0x0000063C, 0x0000063D, 0x0000063E, 0x0000063F,
+    0x00000064, 0x00000641, 0x00000642, 0x00000643, 0x00080065, 0x00000645, 0x00000646, 0x00000647,
+    0x00000648, 0x00000649, 0x0000064A, 0x0000064B, 0x0000064C, 0x0000064D, 0x0000064E, 0x0000064F,
+    0x00000065, 0x00000651, 0x00000652, 0x00000653, 0x00000654, 0x00100066, 0x00000656, 0x00000657,
+    0x00000658, 0x00000659, 0x0000065A, 0x0000065B, 0x0000065C, 0x0000065D, 0x0000065E, 0x0000065F,
+    0x00200007, 0x00200071, 0x00200072, 0x00200073, 0x00200074, 0x00200075, 0x00200067, 0x00200077,
+    0x00200078, 0x00200079, 0x0020007A, 0x0020007B, 0x0020007C, 0x0020007D, 0x0020007E, 0x0020007F,
+    0x00000067, 0x00000671, 0x00000672, 0x00000673, 0x00000674, 0x00000675, 0x00000676, 0x00400068,
+    0x00000678, 0x00000679, 0x0000067A, 0x0000067B, 0x0000067C, 0x0000067D, 0x0000067E, 0x0000067F,
+    0x00000068, 0x00000681, 0x00000682, 0x00000683, 0x00000684, 0x00000685, 0x00000686, 0x00000687,
+    0x00800069, 0x00000689, 0x0000068A, 0x0000068B, 0x0000068C, 0x0000068D, 0x0000068E, 0x0000068F,
+    0x00000069, 0x00000691, 0x00000692, 0x00000693, 0x00000694, 0x00000695, 0x00000696, 0x00000697,
+    0x00000698, 0x0100006A, 0x0000069A, 0x0000069B, 0x0000069C, 0x0000069D, 0x0000069E, 0x0000069F,
+    0x0000006A, 0x000006A1, 0x000006A2, 0x000006A3, 0x000006A4, 0x000006A5, 0x000006A6, 0x000006A7,
+    0x000006A8, 0x000006A9, 0x8200006B, 0x000006AB, 0x000006AC, 0x000006AD, 0x000006AE, 0x000006AF,
+    0x0000006B, 0x000006B1, 0x000006B2, 0x000006B3, 0x000006B4, 0x000006B5, 0x000006B6, 0x000006B7,
+    0x000006B8, 0x000006B9, 0x000006BA, 0x0400006C, 0x000006BC, 0x000006BD, 0x000006BE, 0x000006BF,
+    0x0000006C, 0x000006C1, 0x000006C2, 0x000006C3, 0x000006C4, 0x000006C5, 0x000006C6, 0x000006C7,
+    0x000006C8, 0x000006C9, 0x000006CA, 0x000006CB, 0x0800006D, 0x000006CD, 0x000006CE, 0x000006CF,
+    0x0000006D, 0x000006D1, 0x000006D2, 0x000006D3, 0x000006D4, 0x000006D5, 0x000006D6, 0x000006D7,
+    0x000006D8, 0x000006D9, 0x000006DA, 0x000006DB, 0x000006DC, 0x1000006E, 0x000006DE, 0x000006DF,
+    0x0000006E, 0x000006E1, 0x000006E2, 0x000006E3, 0x000006E4, 0x000006E5, 0x000006E6, 0x000006E7,
+    0x000006E8, 0x000006E9, 0x000006EA, 0x000006EB, 0x000006EC, 0x000006ED, 0x2000006F, 0x000006EF,
+    0x0000006F, 0x000006F1, 0x000006F2, 0x000006F3, 0x000006F4, 0x000006F5, 0x000006F6, 0x000006F7,
+    0x000006F8, 0x000006F9, 0x000006FA, 0x000006FB, 0x000006FC, 0x000006FD, 0x000006FE, 0x000006FF,
+    0x00000007, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00400008,
+    0x00000078, 0x00000079, 0x0000007A, 0x0000007B, 0x0000007C, 0x0000007D, 0x0000007E, 0x0000007F,
+    0x00000071, 0x00010072, 0x00000712, 0x00000713, 0x00000714, 0x00000715, 0x00000716, 0x00000717,
+    0x00000718, 0x00000719, 0x0000071A, 0x0000071B, 0x0000071C, 0x0000071D, 0x0000071E, 0x0000071F,
+    0x00000072, 0x00000721, 0x00020073, 0x00000723, 0x00000724, 0x00000725, 0x00000726, 0x00000727,
+    0x00000728, 0x00000729, 0x0000072A, 0x0000072B, 0x0000072C, 0x0000072D, 0x0000072E, 0x0000072F,
+    0x00000073, 0x00000731, 0x00000732, 0x00040074, 0x00000734, 0x00000735, 0x00000736, 0x00000737,
+    0x00000738, 0x00000739, 0x0000073A, 0x0000073B, 0x0000073C, 0x0000073D, 0x0000073E, 0x0000073F,
+    0x00000074, 0x00000741, 0x00000742, 0x00000743, 0x00080075, 0x00000745, 0x00000746, 0x00000747,
+    0x00000748, 0x00000749, 0x0000074A, 0x0000074B, 0x0000074C, 0x0000074D, 0x0000074E, 0x0000074F,
+    0x00000075, 0x00000751, 0x00000752, 0x00000753, 0x00000754, 0x00100076, 0x00000756, 0x00000757,
+    0x00000758, 0x00000759, 0x0000075A, 0x0000075B, 0x0000075C, 0x0000075D, 0x0000075E, 0x0000075F,
+    0x00000076, 0x00000761, 0x00000762, 0x00000763, 0x00000764, 0x00000765, 0x00200077, 0x00000767,
+    0x00000768, 0x00000769, 0x0000076A, 0x0000076B, 0x0000076C, 0x0000076D, 0x0000076E, 0x0000076F,
+    0x00400008, 0x00400081, 0x00400082, 0x00400083, 0x00400084, 0x00400085, 0x00400086, 0x00400078,
+    0x00400088, 0x00400089, 0x0040008A, 0x0040008B, 0x0040008C, 0x0040008D, 0x0040008E, 0x0040008F,
+    0x00000078, 0x00000781, 0x00000782, 0x00000783, 0x00000784, 0x00000785, 0x00000786, 0x00000787,
+    0x00800079, 0x00000789, 0x0000078A, 0x0000078B, 0x0000078C, 0x0000078D, 0x0000078E, 0x0000078F,
+    0x00000079, 0x00000791, 0x00000792, 0x00000793, 0x00000794, 0x00000795, 0x00000796, 0x00000797,
+    0x00000798, 0x0100007A, 0x0000079A, 0x0000079B, 0x0000079C, 0x0000079D, 0x0000079E, 0x0000079F,
+    0x0000007A, 0x000007A1, 0x000007A2, 0x000007A3, 0x000007A4, 0x000007A5, 0x000007A6, 0x000007A7,
+    0x000007A8, 0x000007A9, 0x8200007B, 0x000007AB, 0x000007AC, 0x000007AD, 0x000007AE, 0x000007AF,
+    0x0000007B, 0x000007B1, 0x000007B2, 0x000007B3, 0x000007B4, 0x000007B5, 0x000007B6, 0x000007B7,
+    0x000007B8, 0x000007B9, 0x000007BA, 0x0400007C, 0x000007BC, 0x000007BD, 0x000007BE, 0x000007BF,
+    0x0000007C, 0x000007C1, 0x000007C2, 0x000007C3, 0x000007C4, 0x000007C5, 0x000007C6, 0x000007C7,
+    0x000007C8, 0x000007C9, 0x000007CA, 0x000007CB, 0x0800007D, 0x000007CD, 0x000007CE, 0x000007CF,
+    0x0000007D, 0x000007D1, 0x000007D2, 0x000007D3, 0x000007D4, 0x000007D5, 0x000007D6, 0x000007D7,
+    0x000007D8, 0x000007D9, 0x000007DA, 0x000007DB, 0x000007DC, 0x1000007E, 0x000007DE, 0x000007DF,
+    0x0000007E, 0x000007E1, 0x000007E2, 0x000007E3, 0x000007E4, 0x000007E5, 0x000007E6, 0x000007E7,
+    0x000007E8, 0x000007E9, 0x000007EA, 0x000007EB, 0x000007EC, 0x000007ED, 0x2000007F, 0x000007EF,
+    0x0000007F, 0x000007F1, 0x000007F2, 0x000007F3, 0x000007F4, 0x000007F5, 0x000007F6, 0x000007F7,
+    0x000007F8, 0x000007F9, 0x000007FA, 0x000007FB, 0x000007FC, 0x000007FD, 0x000007FE, 0x000007FF,
+    0x00000008, 0x00000081, 0x00000082, 0x00000083, 0x00000084, 0x00000085, 0x00000086, 0x00000087,
+    0x00800009, 0x00000089, 0x0000008A, 0x0000008B, 0x0000008C, 0x0000008D, 0x0000008E, 0x0000008F,
+    0x00000081, 0x00010082, 0x00000812, 0x00000813, 0x00000814, 0x00000815, 0x00000816, 0x00000817,
+    0x00000818, 0x00000819, 0x0000081A, 0x0000081B, 0x0000081C, 0x0000081D, 0x0000081E, 0x0000081F,
+    0x00000082, 0x00000821, 0x00020083, 0x00000823, 0x00000824, 0x00000825, 0x00000826, 0x00000827,
+    0x00000828, 0x00000829, 0x0000082A, 0x0000082B, 0x0000082C, 0x0000082D, 0x0000082E, 0x0000082F,
+    0x00000083, 0x00000831, 0x00000832, 0x00040084, 0x00000834, 0x00000835, 0x00000836, 0x00000837,
+    0x00000838, 0x00000839, 0x0000083A, 0x0000083B, 0x0000083C, 0x0000083D, 0x0000083E, 0x0000083F,
+    0x00000084, 0x00000841, 0x00000842, 0x00000843, 0x00080085, 0x00000845, 0x00000846, 0x00000847,
+    0x00000848, 0x00000849, 0x0000084A, 0x0000084B, 0x0000084C, 0x0000084D, 0x0000084E, 0x0000084F,
+    0x00000085, 0x00000851, 0x00000852, 0x00000853, 0x00000854, 0x00100086, 0x00000856, 0x00000857,
+    0x00000858, 0x00000859, 0x0000085A, 0x0000085B, 0x0000085C, 0x0000085D, 0x0000085E, 0x0000085F,
+    0x00000086, 0x00000861, 0x00000862, 0x00000863, 0x00000864, 0x00000865, 0x00200087, 0x00000867,
+    0x00000868, 0x00000869, 0x0000086A, 0x0000086B, 0x0000086C, 0x0000086D, 0x0000086E, 0x0000086F,
+    0x00000087, 0x00000871, 0x00000872, 0x00000873, 0x00000874, 0x00000875, 0x00000876, 0x00400088,
+    0x00000878, 0x00000879, 0x0000087A, 0x0000087B, 0x0000087C, 0x0000087D, 0x0000087E, 0x0000087F,
+    0x00800009, 0x00800091, 0x00800092, 0x00800093, 0x00800094, 0x00800095, 0x00800096, 0x00800097,
+    0x00800089, 0x00800099, 0x0080009A, 0x0080009B, 0x0080009C, 0x0080009D, 0x0080009E, 0x0080009F,
+    0x00000089, 0x00000891, 0x00000892, 0x00000893, 0x00000894, 0x00000895, 0x00000896, 0x00000897,
+    0x00000898, 0x0100008A, 0x0000089A, 0x0000089B, 0x0000089C, 0x0000089D, 0x0000089E, 0x0000089F,
+    0x0000008A, 0x000008A1, 0x000008A2, 0x000008A3, 0x000008A4, 0x000008A5, 0x000008A6, 0x000008A7,
+    0x000008A8, 0x000008A9, 0x8200008B, 0x000008AB, 0x000008AC, 0x000008AD, 0x000008AE, 0x000008AF,
+    0x0000008B, 0x000008B1, 0x000008B2, 0x000008B3, 0x000008B4, 0x000008B5, 0x000008B6, 0x000008B7,
+    0x000008B8, 0x000008B9, 0x000008BA, 0x0400008C, 0x000008BC, 0x000008BD, 0x000008BE, 0x000008BF,
+    0x0000008C, 0x000008C1, 0x000008C2, 0x000008C3, 0x000008C4, 0x000008C5, 0x000008C6, 0x000008C7,
+    0x000008C8, 0x000008C9, 0x000008CA, 0x000008CB, 0x0800008D, 0x000008CD, 0x000008CE, 0x000008CF,
+    0x0000008D, 0x000008D1, 0x000008D2, 0x000008D3, 0x000008D4, 0x000008D5, 0x000008D6, 0x000008D7,
+    0x000008D8, 0x000008D9, 0x000008DA, 0x000008DB, 0x000008DC, 0x1000008E, 0x000008DE, 0x000008DF,
+    0x0000008E, 0x000008E1, 0x000008E2, 0x000008E3, 0x000008E4, 0x000008E5, 0x000008E6, 0x000008E7,
+    0x000008E8, 0x000008E9, 0x000008EA, 0x000008EB, 0x000008EC, 0x000008ED, 0x2000008F, 0x000008EF,
+    0x0000008F, 0x000008F1, 0x000008F2, 0x000008F3, 0x000008F4, 0x000008F5, 0x000008F6, 0x000008F7,
+    0x000008F8, 0x000008F9, 0x000008FA, 0x000008FB, 0x000008FC, 0x000008FD, 0x000008FE, 0x000008FF,
+    0x00000009, 0x00000091, 0x00000092, 0x00000093, 0x00000094, 0x00000095, 0x00000096, 0x00000097,
+    0x00000098, 0x0100000A, 0x0000009A, 0x0000009B, 0x0000009C, 0x0000009D, 0x0000009E, 0x0000009F,
+    0x00000091, 0x00010092, 0x00000912, 0x00000913, 0x00000914, 0x00000915, 0x00000916, 0x00000917,
+    0x00000918, 0x00000919, 0x0000091A, 0x0000091B, 0x0000091C, 0x0000091D, 0x0000091E, 0x0000091F,
+    0x00000092, 0x00000921, 0x00020093, 0x00000923, 0x00000924, 0x00000925, 0x00000926, 0x00000927,
+    0x00000928, 0x00000929, 0x0000092A, 0x0000092B, 0x0000092C, 0x0000092D, 0x0000092E, 0x0000092F,
+    0x00000093, 0x00000931, 0x00000932, 0x00040094, 0x00000934, 0x00000935, 0x00000936, 0x00000937,
+    0x00000938, 0x00000939, 0x0000093A, 0x0000093B, 0x0000093C, 0x0000093D, 0x0000093E, 0x0000093F,
+    0x00000094, 0x00000941, 0x00000942, 0x00000943, 0x00080095, 0x00000945, 0x00000946, 0x00000947,
+    0x00000948, 0x00000949, 0x0000094A, 0x0000094B, 0x0000094C, 0x0000094D, 0x0000094E, 0x0000094F,
+    0x00000095, 0x00000951, 0x00000952, 0x00000953, 0x00000954, 0x00100096, 0x00000956, 0x00000957,
+    0x00000958, 0x00000959, 0x0000095A, 0x0000095B, 0x0000095C, 0x0000095D, 0x0000095E, 0x0000095F,
+    0x00000096, 0x00000961, 0x00000962, 0x00000963, 0x00000964, 0x00000965, 0x00200097, 0x00000967,
+    0x00000968, 0x00000969, 0x0000096A, 0x0000096B, 0x0000096C, 0x0000096D, 0x0000096E, 0x0000096F,
+    0x00000097, 0x00000971, 0x00000972, 0x00000973, 0x00000974, 0x00000975, 0x00000976, 0x00400098,
+    0x00000978, 0x00000979, 0x0000097A, 0x0000097B, 0x0000097C, 0x0000097D, 0x0000097E, 0x0000097F,
+    0x00000098, 0x00000981, 0x00000982, 0x00000983, 0x00000984, 0x00000985, 0x00000986, 0x00000987,
+    0x00800099, 0x00000989, 0x0000098A, 0x0000098B, 0x0000098C, 0x0000098D, 0x0000098E, 0x0000098F,
+    0x0100000A, 0x010000A1, 0x010000A2, 0x010000A3, 0x010000A4, 0x010000A5, 0x010000A6, 0x010000A7,
+    0x010000A8, 0x0100009A, 0x010000AA, 0x010000AB, 0x010000AC, 0x010000AD, 0x010000AE, 0x010000AF,
+    0x0000009A, 0x000009A1, 0x000009A2, 0x000009A3, 0x000009A4, 0x000009A5, 0x000009A6, 0x000009A7,
+    0x000009A8, 0x000009A9, 0x8200009B, 0x000009AB, 0x000009AC, 0x000009AD, 0x000009AE, 0x000009AF,
+    0x0000009B, 0x000009B1, 0x000009B2, 0x000009B3, 0x000009B4, 0x000009B5, 0x000009B6, 0x000009B7,
+    0x000009B8, 0x000009B9, 0x000009BA, 0x0400009C, 0x000009BC, 0x000009BD, 0x000009BE, 0x000009BF,
+    0x0000009C, 0x000009C1, 0x000009C2, 0x000009C3, 0x000009C4, 0x000009C5, 0x000009C6, 0x000009C7,
+    0x000009C8, 0x000009C9, 0x000009CA, 0x000009CB, 0x0800009D, 0x000009CD, 0x000009CE, 0x000009CF,
+    0x0000009D, 0x000009D1, 0x000009D2, 0x000009D3, 0x000009D4, 0x000009D5, 0x000009D6, 0x000009D7,
+    0x000009D8, 0x000009D9, 0x000009DA, 0x000009DB, 0x000009DC, 0x1000009E, 0x000009DE, 0x000009DF,
+    0x0000009E, 0x000009E1, 0x000009E2, 0x000009E3, 0x000009E4, 0x000009E5, 0x000009E6, 0x000009E7,
+    0x000009E8, 0x000009E9, 0x000009EA, 0x000009EB, 0x000009EC, 0x000009ED, 0x2000009F, 0x000009EF,
+    0x0000009F, 0x000009F1, 0x000009F2, 0x000009F3, 0x000009F4, 0x000009F5, 0x000009F6, 0x000009F7,
+    0x000009F8, 0x000009F9, 0x000009FA, 0x000009FB, 0x000009FC, 0x000009FD, 0x000009FE, 0x000009FF,
+    0x0000000A, 0x000000A1, 0x000000A2, 0x000000A3, 0x000000A4, 0x000000A5, 0x000000A6, 0x000000A7,
+    0x000000A8, 0x000000A9, 0x8200000B, 0x000000AB, 0x000000AC, 0x000000AD, 0x000000AE, 0x000000AF,
+    0x000000A1, 0x000100A2, 0x00000A12, 0x00000A13, 0x00000A14, 0x00000A15, 0x00000A16, 0x00000A17,
+    0x00000A18, 0x00000A19, 0x00000A1A, 0x00000A1B, 0x00000A1C, 0x00000A1D, 0x00000A1E, 0x00000A1F,
+    0x000000A2, 0x00000A21, 0x000200A3, 0x00000A23, 0x00000A24, 0x00000A25, 0x00000A26, 0x00000A27,
+    0x00000A28, 0x00000A29, 0x00000A2A, 0x00000A2B, 0x00000A2C, 0x00000A2D, 0x00000A2E, 0x00000A2F,
+    0x000000A3, 0x00000A31, 0x00000A32, 0x000400A4, 0x00000A34, 0x00000A35, 0x00000A36, 0x00000A37,
+    0x00000A38, 0x00000A39, 0x00000A3A, 0x00000A3B, 0x00000A3C, 0x00000A3D, 0x00000A3E, 0x00000A3F,
+    0x000000A4, 0x00000A41, 0x00000A42, 0x00000A43, 0x000800A5, 0x00000A45, 0x00000A46, 0x00000A47,
+    0x00000A48, 0x00000A49, 0x00000A4A, 0x00000A4B, 0x00000A4C, 0x00000A4D, 0x00000A4E, 0x00000A4F,
+    0x000000A5, 0x00000A51, 0x00000A52, 0x00000A53, 0x00000A54, 0x001000A6, 0x00000A56, 0x00000A57,
+    0x00000A58, 0x00000A59, 0x00000A5A, 0x00000A5B, 0x00000A5C, 0x00000A5D, 0x00000A5E, 0x00000A5F,
+    0x000000A6, 0x00000A61, 0x00000A62, 0x00000A63, 0x00000A64, 0x00000A65, 0x002000A7, 0x00000A67,
+    0x00000A68, 0x00000A69, 0x00000A6A, 0x00000A6B, 0x00000A6C, 0x00000A6D, 0x00000A6E, 0x00000A6F,
+    0x000000A7, 0x00000A71, 0x00000A72, 0x00000A73, 0x00000A74, 0x00000A75, 0x00000A76, 0x004000A8,
+    0x00000A78, 0x00000A79, 0x00000A7A, 0x00000A7B, 0x00000A7C, 0x00000A7D, 0x00000A7E, 0x00000A7F,
+    0x000000A8, 0x00000A81, 0x00000A82, 0x00000A83, 0x00000A84, 0x00000A85, 0x00000A86, 0x00000A87,
+    0x008000A9, 0x00000A89, 0x00000A8A, 0x00000A8B, 0x00000A8C, 0x00000A8D, 0x00000A8E, 0x00000A8F,
+    0x000000A9, 0x00000A91, 0x00000A92, 0x00000A93, 0x00000A94, 0x00000A95, 0x00000A96, 0x00000A97,
+    0x00000A98, 0x010000AA, 0x00000A9A, 0x00000A9B, 0x00000A9C, 0x00000A9D, 0x00000A9E, 0x00000A9F,
+    0x8200000B, 0x820000B1, 0x820000B2, 0x820000B3, 0x820000B4, 0x820000B5, 0x820000B6, 0x820000B7,
+    0x820000B8, 0x820000B9, 0x820000AB, 0x820000BB, 0x820000BC, 0x820000BD, 0x820000BE, 0x820000BF,
+    0x000000AB, 0x00000AB1, 0x00000AB2, 0x00000AB3, 0x00000AB4, 0x00000AB5, 0x00000AB6, 0x00000AB7,
+    0x00000AB8, 0x00000AB9, 0x00000ABA, 0x040000AC, 0x00000ABC, 0x00000ABD, 0x00000ABE, 0x00000ABF,
+    0x000000AC, 0x00000AC1, 0x00000AC2, 0x00000AC3, 0x00000AC4, 0x00000AC5, 0x00000AC6, 0x00000AC7,
+    0x00000AC8, 0x00000AC9, 0x00000ACA, 0x00000ACB, 0x080000AD, 0x00000ACD, 0x00000ACE, 0x00000ACF,
+    0x000000AD, 0x00000AD1, 0x00000AD2, 0x00000AD3, 0x00000AD4, 0x00000AD5, 0x00000AD6, 0x00000AD7,
+    0x00000AD8, 0x00000AD9, 0x00000ADA, 0x00000ADB, 0x00000ADC, 0x100000AE, 0x00000ADE, 0x00000ADF,
+    0x000000AE, 0x00000AE1, 0x00000AE2, 0x00000AE3, 0x00000AE4, 0x00000AE5, 0x00000AE6, 0x00000AE7,
+    0x00000AE8, 0x00000AE9, 0x00000AEA, 0x00000AEB, 0x00000AEC, 0x00000AED, 0x200000AF, 0x00000AEF,
+    0x000000AF, 0x00000AF1, 0x00000AF2, 0x00000AF3, 0x00000AF4, 0x00000AF5, 0x00000AF6, 0x00000AF7,
+    0x00000AF8, 0x00000AF9, 0x00000AFA, 0x00000AFB, 0x00000AFC, 0x00000AFD, 0x00000AFE, 0x00000AFF,
+    0x0000000B, 0x000000B1, 0x000000B2, 0x000000B3, 0x000000B4, 0x000000B5, 0x000000B6, 0x000000B7,
+    0x000000B8, 0x000000B9, 0x000000BA, 0x0400000C, 0x000000BC, 0x000000BD, 0x000000BE, 0x000000BF,
+    0x000000B1, 0x000100B2, 0x00000B12, 0x00000B13, 0x00000B14, 0x00000B15, 0x00000B16, 0x00000B17,
+    0x00000B18, 0x00000B19, 0x00000B1A, 0x00000B1B, 0x00000B1C, 0x00000B1D, 0x00000B1E, 0x00000B1F,
+    0x000000B2, 0x00000B21, 0x000200B3, 0x00000B23, 0x00000B24, 0x00000B25, 0x00000B26, 0x00000B27,
+    0x00000B28, 0x00000B29, 0x00000B2A, 0x00000B2B, 0x00000B2C, 0x00000B2D, 0x00000B2E, 0x00000B2F,
+    0x000000B3, 0x00000B31, 0x00000B32, 0x000400B4, 0x00000B34, 0x00000B35, 0x00000B36, 0x00000B37,
+    0x00000B38, 0x00000B39, 0x00000B3A, 0x00000B3B, 0x00000B3C, 0x00000B3D, 0x00000B3E, 0x00000B3F,
+    0x000000B4, 0x00000B41, 0x00000B42, 0x00000B43, 0x000800B5, 0x00000B45, 0x00000B46, 0x00000B47,
+    0x00000B48, 0x00000B49, 0x00000B4A, 0x00000B4B, 0x00000B4C, 0x00000B4D, 0x00000B4E, 0x00000B4F,
+    0x000000B5, 0x00000B51, 0x00000B52, 0x00000B53, 0x00000B54, 0x001000B6, 0x00000B56, 0x00000B57,
+    0x00000B58, 0x00000B59, 0x00000B5A, 0x00000B5B, 0x00000B5C, 0x00000B5D, 0x00000B5E, 0x00000B5F,
+    0x000000B6, 0x00000B61, 0x00000B62, 0x00000B63, 0x00000B64, 0x00000B65, 0x002000B7, 0x00000B67,
+    0x00000B68, 0x00000B69, 0x00000B6A, 0x00000B6B, 0x00000B6C, 0x00000B6D, 0x00000B6E, 0x00000B6F,
+    0x000000B7, 0x00000B71, 0x00000B72, 0x00000B73, 0x00000B74, 0x00000B75, 0x00000B76, 0x004000B8,
+    0x00000B78, 0x00000B79, 0x00000B7A, 0x00000B7B, 0x00000B7C, 0x00000B7D, 0x00000B7E, 0x00000B7F,
+    0x000000B8, 0x00000B81, 0x00000B82, 0x00000B83, 0x00000B84, 0x00000B85, 0x00000B86, 0x00000B87,
+    0x008000B9, 0x00000B89, 0x00000B8A, 0x00000B8B, 0x00000B8C, 0x00000B8D, 0x00000B8E, 0x00000B8F,
+    0x000000B9, 0x00000B91, 0x00000B92, 0x00000B93, 0x00000B94, 0x00000B95, 0x00000B96, 0x00000B97,
+    0x00000B98, 0x010000BA, 0x00000B9A, 0x00000B9B, 0x00000B9C, 0x00000B9D, 0x00000B9E, 0x00000B9F,
+    0x000000BA, 0x00000BA1, 0x00000BA2, 0x00000BA3, 0x00000BA4, 0x00000BA5, 0x00000BA6, 0x00000BA7,
+    0x00000BA8, 0x00000BA9, 0x820000BB, 0x00000BAB, 0x00000BAC, 0x00000BAD, 0x00000BAE, 0x00000BAF,
+    0x0400000C, 0x040000C1, 0x040000C2, 0x040000C3, 0x040000C4, 0x040000C5, 0x040000C6, 0x040000C7,
+    0x040000C8, 0x040000C9, 0x040000CA, 0x040000BC, 0x040000CC, 0x040000CD, 0x040000CE, 0x040000CF,
+    0x000000BC, 0x00000BC1, 0x00000BC2, 0x00000BC3, 0x00000BC4, 0x00000BC5, 0x00000BC6, 0x00000BC7,
+    0x00000BC8, 0x00000BC9, 0x00000BCA, 0x00000BCB, 0x080000BD, 0x00000BCD, 0x00000BCE, 0x00000BCF,
+    0x000000BD, 0x00000BD1, 0x00000BD2, 0x00000BD3, 0x00000BD4, 0x00000BD5, 0x00000BD6, 0x00000BD7,
+    0x00000BD8, 0x00000BD9, 0x00000BDA, 0x00000BDB, 0x00000BDC, 0x100000BE, 0x00000BDE, 0x00000BDF,
+    0x000000BE, 0x00000BE1, 0x00000BE2, 0x00000BE3, 0x00000BE4, 0x00000BE5, 0x00000BE6, 0x00000BE7,
+    0x00000BE8, 0x00000BE9, 0x00000BEA, 0x00000BEB, 0x00000BEC, 0x00000BED, 0x200000BF, 0x00000BEF,
+    0x000000BF, 0x00000BF1, 0x00000BF2, 0x00000BF3, 0x00000BF4, 0x00000BF5, 0x00000BF6, 0x00000BF7,
+    0x00000BF8, 0x00000BF9, 0x00000BFA, 0x00000BFB, 0x00000BFC, 0x00000BFD, 0x00000BFE, 0x00000BFF,
+    0x0000000C, 0x000000C1, 0x000000C2, 0x000000C3, 0x000000C4, 0x000000C5, 0x000000C6, 0x000000C7,
+    0x000000C8, 0x000000C9, 0x000000CA, 0x000000CB, 0x0800000D, 0x000000CD, 0x000000CE, 0x000000CF,
+    0x000000C1, 0x000100C2, 0x00000C12, 0x00000C13, 0x00000C14, 0x00000C15, 0x00000C16, 0x00000C17,
+    0x00000C18, 0x00000C19, 0x00000C1A, 0x00000C1B, 0x00000C1C, 0x00000C1D, 0x00000C1E, 0x00000C1F,
+    0x000000C2, 0x00000C21, 0x000200C3, 0x00000C23, 0x00000C24, 0x00000C25, 0x00000C26, 0x00000C27,
+    0x00000C28, 0x00000C29, 0x00000C2A, 0x00000C2B, 0x00000C2C, 0x00000C2D, 0x00000C2E, 0x00000C2F,
+    0x000000C3, 0x00000C31, 0x00000C32, 0x000400C4, 0x00000C34, 0x00000C35, 0x00000C36, 0x00000C37,
+    0x00000C38, 0x00000C39, 0x00000C3A, 0x00000C3B, 0x00000C3C, 0x00000C3D, 0x00000C3E, 0x00000C3F,
+    0x000000C4, 0x00000C41, 0x00000C42, 0x00000C43, 0x000800C5, 0x00000C45, 0x00000C46, 0x00000C47,
+    0x00000C48, 0x00000C49, 0x00000C4A, 0x00000C4B, 0x00000C4C, 0x00000C4D, 0x00000C4E, 0x00000C4F,
+    0x000000C5, 0x00000C51, 0x00000C52, 0x00000C53, 0x00000C54, 0x001000C6, 0x00000C56, 0x00000C57,
+    0x00000C58, 0x00000C59, 0x00000C5A, 0x00000C5B, 0x00000C5C, 0x00000C5D, 0x00000C5E, 0x00000C5F,
+    0x000000C6, 0x00000C61, 0x00000C62, 0x00000C63, 0x00000C64, 0x00000C65, 0x002000C7, 0x00000C67,
+    0x00000C68, 0x00000C69, 0x00000C6A, 0x00000C6B, 0x00000C6C, 0x00000C6D, 0x00000C6E, 0x00000C6F,
+    0x000000C7, 0x00000C71, 0x00000C72, 0x00000C73, 0x00000C74, 0x00000C75, 0x00000C76, 0x004000C8,
+    0x00000C78, 0x00000C79, 0x00000C7A, 0x00000C7B, 0x00000C7C, 0x00000C7D, 0x00000C7E, 0x00000C7F,
+    0x000000C8, 0x00000C81, 0x00000C82, 0x00000C83, 0x00000C84, 0x00000C85, 0x00000C86, 0x00000C87,
+    0x008000C9, 0x00000C89, 0x00000C8A, 0x00000C8B, 0x00000C8C, 0x00000C8D, 0x00000C8E, 0x00000C8F,
+    0x000000C9, 0x00000C91, 0x00000C92, 0x00000C93, 0x00000C94, 0x00000C95, 0x00000C96, 0x00000C97,
+    0x00000C98, 0x010000CA, 0x00000C9A, 0x00000C9B, 0x00000C9C, 0x00000C9D, 0x00000C9E, 0x00000C9F,
+    0x000000CA, 0x00000CA1, 0x00000CA2, 0x00000CA3, 0x00000CA4, 0x00000CA5, 0x00000CA6, 0x00000CA7,
+    0x00000CA8, 0x00000CA9, 0x820000CB, 0x00000CAB, 0x00000CAC, 0x00000CAD, 0x00000CAE, 0x00000CAF,
+    0x000000CB, 0x00000CB1, 0x00000CB2, 0x00000CB3, 0x00000CB4, 0x00000CB5, 0x00000CB6, 0x00000CB7,
+    0x00000CB8, 0x00000CB9, 0x00000CBA, 0x040000CC, 0x00000CBC, 0x00000CBD, 0x00000CBE, 0x00000CBF,
+    0x0800000D, 0x080000D1, 0x080000D2, 0x080000D3, 0x080000D4, 0x080000D5, 0x080000D6, 0x080000D7,
+    0x080000D8, 0x080000D9, 0x080000DA, 0x080000DB, 0x080000CD, 0x080000DD, 0x080000DE, 0x080000DF,
+    0x000000CD, 0x00000CD1, 0x00000CD2, 0x00000CD3, 0x00000CD4, 0x00000CD5, 0x00000CD6, 0x00000CD7,
+    0x00000CD8, 0x00000CD9, 0x00000CDA, 0x00000CDB, 0x00000CDC, 0x100000CE, 0x00000CDE, 0x00000CDF,
+    0x000000CE, 0x00000CE1, 0x00000CE2, 0x00000CE3, 0x00000CE4, 0x00000CE5, 0x00000CE6, 0x00000CE7,
+    0x00000CE8, 0x00000CE9, 0x00000CEA, 0x00000CEB, 0x00000CEC, 0x00000CED, 0x200000CF, 0x00000CEF,
+    0x000000CF, 0x00000CF1, 0x00000CF2, 0x00000CF3, 0x00000CF4, 0x00000CF5, 0x00000CF6, 0x00000CF7,
+    0x00000CF8, 0x00000CF9, 0x00000CFA, 0x00000CFB, 0x00000CFC, 0x00000CFD, 0x00000CFE, 0x00000CFF,
+    0x0000000D, 0x000000D1, 0x000000D2, 0x000000D3, 0x000000D4, 0x000000D5, 0x000000D6, 0x000000D7,
+    0x000000D8, 0x000000D9, 0x000000DA, 0x000000DB, 0x000000DC, 0x1000000E, 0x000000DE, 0x000000DF,
+    0x000000D1, 0x000100D2, 0x00000D12, 0x00000D13, 0x00000D14, 0x00000D15, 0x00000D16, 0x00000D17,
+    0x00000D18, 0x00000D19, 0x00000D1A, 0x00000D1B, 0x00000D1C, 0x00000D1D, 0x00000D1E, 0x00000D1F,
+    0x000000D2, 0x00000D21, 0x000200D3, 0x00000D23, 0x00000D24, 0x00000D25, 0x00000D26, 0x00000D27,
+    0x00000D28, 0x00000D29, 0x00000D2A, 0x00000D2B, 0x00000D2C, 0x00000D2D, 0x00000D2E, 0x00000D2F,
+    0x000000D3, 0x00000D31, 0x00000D32, 0x000400D4, 0x00000D34, 0x00000D35, 0x00000D36, 0x00000D37,
+    0x00000D38, 0x00000D39, 0x00000D3A, 0x00000D3B, 0x00000D3C, 0x00000D3D, 0x00000D3E, 0x00000D3F,
+    0x000000D4, 0x00000D41, 0x00000D42, 0x00000D43, 0x000800D5, 0x00000D45, 0x00000D46, 0x00000D47,
+    0x00000D48, 0x00000D49, 0x00000D4A, 0x00000D4B, 0x00000D4C, 0x00000D4D, 0x00000D4E, 0x00000D4F,
+    0x000000D5, 0x00000D51, 0x00000D52, 0x00000D53, 0x00000D54, 0x001000D6, 0x00000D56, 0x00000D57,
+    0x00000D58, 0x00000D59, 0x00000D5A, 0x00000D5B, 0x00000D5C, 0x00000D5D, 0x00000D5E, 0x00000D5F,
+    0x000000D6, 0x00000D61, 0x00000D62, 0x00000D63, 0x00000D64, 0x00000D65, 0x002000D7, 0x00000D67,
+    0x00000D68, 0x00000D69, 0x00000D6A, 0x00000D6B, 0x00000D6C, 0x00000D6D, 0x00000D6E, 0x00000D6F,
+    0x000000D7, 0x00000D71, 0x00000D72, 0x00000D73, 0x00000D74, 0x00000D75, 0x00000D76, 0x004000D8,
+    0x00000D78, 0x00000D79, 0x00000D7A, 0x00000D7B, 0x00000D7C, 0x00000D7D, 0x00000D7E, 0x00000D7F,
+    0x000000D8, 0x00000D81, 0x00000D82, 0x00000D83, 0x00000D84, 0x00000D85, 0x00000D86, 0x00000D87,
+    0x008000D9, 0x00000D89, 0x00000D8A, 0x00000D8B, 0x00000D8C, 0x00000D8D, 0x00000D8E, 0x00000D8F,
+    0x000000D9, 0x00000D91, 0x00000D92, 0x00000D93, 0x00000D94, 0x00000D95, 0x00000D96, 0x00000D97,
+    0x00000D98, 0x010000DA, 0x00000D9A, 0x00000D9B, 0x00000D9C, 0x00000D9D, 0x00000D9E, 0x00000D9F,
+    0x000000DA, 0x00000DA1, 0x00000DA2, 0x00000DA3, 0x00000DA4, 0x00000DA5, 0x00000DA6, 0x00000DA7,
+    0x00000DA8, 0x00000DA9, 0x820000DB, 0x00000DAB, 0x00000DAC, 0x00000DAD, 0x00000DAE, 0x00000DAF,
+    0x000000DB, 0x00000DB1, 0x00000DB2, 0x00000DB3, 0x00000DB4, 0x00000DB5, 0x00000DB6, 0x00000DB7,
+    0x00000DB8, 0x00000DB9, 0x00000DBA, 0x040000DC, 0x00000DBC, 0x00000DBD, 0x00000DBE, 0x00000DBF,
+    0x000000DC, 0x00000DC1, 0x00000DC2, 0x00000DC3, 0x00000DC4, 0x00000DC5, 0x00000DC6, 0x00000DC7,
+    0x00000DC8, 0x00000DC9, 0x00000DCA, 0x00000DCB, 0x080000DD, 0x00000DCD, 0x00000DCE, 0x00000DCF,
+    0x1000000E, 0x100000E1, 0x100000E2, 0x100000E3, 0x100000E4, 0x100000E5, 0x100000E6, 0x100000E7,
+    0x100000E8, 0x100000E9, 0x100000EA, 0x100000EB, 0x100000EC, 0x100000DE, 0x100000EE, 0x100000EF,
+    0x000000DE, 0x00000DE1, 0x00000DE2, 0x00000DE3, 0x00000DE4, 0x00000DE5, 0x00000DE6, 0x00000DE7,
+    0x00000DE8, 0x00000DE9, 0x00000DEA, 0x00000DEB, 0x00000DEC, 0x00000DED, 0x200000DF, 0x00000DEF,
+    0x000000DF, 0x00000DF1, 0x00000DF2, 0x00000DF3, 0x00000DF4, 0x00000DF5, 0x00000DF6, 0x00000DF7,
+    0x00000DF8, 0x00000DF9, 0x00000DFA, 0x00000DFB, 0x00000DFC, 0x00000DFD, 0x00000DFE, 0x00000DFF,
+    0x0000000E, 0x000000E1, 0x000000E2, 0x000000E3, 0x000000E4, 0x000000E5, 0x000000E6, 0x000000E7,
+    0x000000E8, 0x000000E9, 0x000000EA, 0x000000EB, 0x000000EC, 0x000000ED, 0x2000000F, 0x000000EF,
+    0x000000E1, 0x000100E2, 0x00000E12, 0x00000E13, 0x00000E14, 0x00000E15, 0x00000E16, 0x00000E17,
+    0x00000E18, 0x00000E19, 0x00000E1A, 0x00000E1B, 0x00000E1C, 0x00000E1D, 0x00000E1E, 0x00000E1F,
+    0x000000E2, 0x00000E21, 0x000200E3, 0x00000E23, 0x00000E24, 0x00000E25, 0x00000E26, 0x00000E27,
+    0x00000E28, 0x00000E29, 0x00000E2A, 0x00000E2B, 0x00000E2C, 0x00000E2D, 0x00000E2E, 0x00000E2F,
+    0x000000E3, 0x00000E31, 0x00000E32, 0x000400E4, 0x00000E34, 0x00000E35, 0x00000E36, 0x00000E37,
+    0x00000E38, 0x00000E39, 0x00000E3A, 0x00000E3B, 0x00000E3C, 0x00000E3D, 0x00000E3E, 0x00000E3F,
+    0x000000E4, 0x00000E41, 0x00000E42, 0x00000E43, 0x000800E5, 0x00000E45, 0x00000E46, 0x00000E47,
+    0x00000E48, 0x00000E49, 0x00000E4A, 0x00000E4B, 0x00000E4C, 0x00000E4D, 0x00000E4E, 0x00000E4F,
+    0x000000E5, 0x00000E51, 0x00000E52, 0x00000E53, 0x00000E54, 0x001000E6, 0x00000E56, 0x00000E57,
+    0x00000E58, 0x00000E59, 0x00000E5A, 0x00000E5B, 0x00000E5C, 0x00000E5D, 0x00000E5E, 0x00000E5F,
+    0x000000E6, 0x00000E61, 0x00000E62, 0x00000E63, 0x00000E64, 0x00000E65, 0x002000E7, 0x00000E67,
+    0x00000E68, 0x00000E69, 0x00000E6A, 0x00000E6B, 0x00000E6C, 0x00000E6D, 0x00000E6E, 0x00000E6F,
+    0x000000E7, 0x00000E71, 0x00000E72, 0x00000E73, 0x00000E74, 0x00000E75, 0x00000E76, 0x004000E8,
+    0x00000E78, 0x00000E79, 0x00000E7A, 0x00000E7B, 0x00000E7C, 0x00000E7D, 0x00000E7E, 0x00000E7F,
+    0x000000E8, 0x00000E81, 0x00000E82, 0x00000E83, 0x00000E84, 0x00000E85, 0x00000E86, 0x00000E87,
+    0x008000E9, 0x00000E89, 0x00000E8A, 0x00000E8B, 0x00000E8C, 0x00000E8D, 0x00000E8E, 0x00000E8F,
+    0x000000E9, 0x00000E91, 0x00000E92, 0x00000E93, 0x00000E94, 0x00000E95, 0x00000E96, 0x00000E97,
+    0x00000E98, 0x010000EA, 0x00000E9A, 0x00000E9B, 0x00000E9C, 0x00000E9D, 0x00000E9E, 0x00000E9F,
+    0x000000EA, 0x00000EA1, 0x00000EA2, 0x00000EA3, 0x00000EA4, 0x00000EA5, 0x00000EA6, 0x00000EA7,
+    0x00000EA8, 0x00000EA9, 0x820000EB, 0x00000EAB, 0x00000EAC, 0x00000EAD, 0x00000EAE, 0x00000EAF,
+    0x000000EB, 0x00000EB1, 0x00000EB2, 0x00000EB3, 0x00000EB4, 0x00000EB5, 0x00000EB6, 0x00000EB7,
+    0x00000EB8, 0x00000EB9, 0x00000EBA, 0x040000EC, 0x00000EBC, 0x00000EBD, 0x00000EBE, 0x00000EBF,
+    0x000000EC, 0x00000EC1, 0x00000EC2, 0x00000EC3, 0x00000EC4, 0x00000EC5, 0x00000EC6, 0x00000EC7,
+    0x00000EC8, 0x00000EC9, 0x00000ECA, 0x00000ECB, 0x080000ED, 0x00000ECD, 0x00000ECE, 0x00000ECF,
+    0x000000ED, 0x00000ED1, 0x00000ED2, 0x00000ED3, 0x00000ED4, 0x00000ED5, 0x00000ED6, 0x00000ED7,
+    0x00000ED8, 0x00000ED9, 0x00000EDA, 0x00000EDB, 0x00000EDC, 0x100000EE, 0x00000EDE, 0x00000EDF,
+    0x2000000F, 0x200000F1, 0x200000F2, 0x200000F3, 0x200000F4, 0x200000F5, 0x200000F6, 0x200000F7,
+    0x200000F8, 0x200000F9, 0x200000FA, 0x200000FB, 0x200000FC, 0x200000FD, 0x200000EF, 0x200000FF,
+    0x000000EF, 0x00000EF1, 0x00000EF2, 0x00000EF3, 0x00000EF4, 0x00000EF5, 0x00000EF6, 0x00000EF7,
+    0x00000EF8, 0x00000EF9, 0x00000EFA, 0x00000EFB, 0x00000EFC, 0x00000EFD, 0x00000EFE, 0x00000EFF,
+    0x0000000F, 0x000000F1, 0x000000F2, 0x000000F3, 0x000000F4, 0x000000F5, 0x000000F6, 0x000000F7,
+    0x000000F8, 0x000000F9, 0x000000FA, 0x000000FB, 0x000000FC, 0x000000FD, 0x000000FE, 0x000000FF,
+    0x000000F1, 0x000100F2, 0x00000F12, 0x00000F13, 0x00000F14, 0x00000F15, 0x00000F16, 0x00000F17,
+    0x00000F18, 0x00000F19, 0x00000F1A, 0x00000F1B, 0x00000F1C, 0x00000F1D, 0x00000F1E, 0x00000F1F,
+    0x000000F2, 0x00000F21, 0x000200F3, 0x00000F23, 0x00000F24, 0x00000F25, 0x00000F26, 0x00000F27,
+    0x00000F28, 0x00000F29, 0x00000F2A, 0x00000F2B, 0x00000F2C, 0x00000F2D, 0x00000F2E, 0x00000F2F,
+    0x000000F3, 0x00000F31, 0x00000F32, 0x000400F4, 0x00000F34, 0x00000F35, 0x00000F36, 0x00000F37,
+    0x00000F38, 0x00000F39, 0x00000F3A, 0x00000F3B, 0x00000F3C, 0x00000F3D, 0x00000F3E, 0x00000F3F,
+    0x000000F4, 0x00000F41, 0x00000F42, 0x00000F43, 0x000800F5, 0x00000F45, 0x00000F46, 0x00000F47,
+    0x00000F48, 0x00000F49, 0x00000F4A, 0x00000F4B, 0x00000F4C, 0x00000F4D, 0x00000F4E, 0x00000F4F,
+    0x000000F5, 0x00000F51, 0x00000F52, 0x00000F53, 0x00000F54, 0x001000F6, 0x00000F56, 0x00000F57,
+    0x00000F58, 0x00000F59, 0x00000F5A, 0x00000F5B, 0x00000F5C, 0x00000F5D, 0x00000F5E, 0x00000F5F,
+    0x000000F6, 0x00000F61, 0x00000F62, 0x00000F63, 0x00000F64, 0x00000F65, 0x002000F7, 0x00000F67,
+    0x00000F68, 0x00000F69, 0x00000F6A, 0x00000F6B, 0x00000F6C, 0x00000F6D, 0x00000F6E, 0x00000F6F,
+    0x000000F7, 0x00000F71, 0x00000F72, 0x00000F73, 0x00000F74, 0x00000F75, 0x00000F76, 0x004000F8,
+    0x00000F78, 0x00000F79, 0x00000F7A, 0x00000F7B, 0x00000F7C, 0x00000F7D, 0x00000F7E, 0x00000F7F,
+    0x000000F8, 0x00000F81, 0x00000F82, 0x00000F83, 0x00000F84, 0x00000F85, 0x00000F86, 0x00000F87,
+    0x008000F9, 0x00000F89, 0x00000F8A, 0x00000F8B, 0x00000F8C, 0x00000F8D, 0x00000F8E, 0x00000F8F,
+    0x000000F9, 0x00000F91, 0x00000F92, 0x00000F93, 0x00000F94, 0x00000F95, 0x00000F96, 0x00000F97,
+    0x00000F98, 0x010000FA, 0x00000F9A, 0x00000F9B, 0x00000F9C, 0x00000F9D, 0x00000F9E, 0x00000F9F,
+    0x000000FA, 0x00000FA1, 0x00000FA2, 0x00000FA3, 0x00000FA4, 0x00000FA5, 0x00000FA6, 0x00000FA7,
+    0x00000FA8, 0x00000FA9, 0x820000FB, 0x00000FAB, 0x00000FAC, 0x00000FAD, 0x00000FAE, 0x00000FAF,
+    0x000000FB, 0x00000FB1, 0x00000FB2, 0x00000FB3, 0x00000FB4, 0x00000FB5, 0x00000FB6, 0x00000FB7,
+    0x00000FB8, 0x00000FB9, 0x00000FBA, 0x040000FC, 0x00000FBC, 0x00000FBD, 0x00000FBE, 0x00000FBF,
+    0x000000FC, 0x00000FC1, 0x00000FC2, 0x00000FC3, 0x00000FC4, 0x00000FC5, 0x00000FC6, 0x00000FC7,
+    0x00000FC8, 0x00000FC9, 0x00000FCA, 0x00000FCB, 0x080000FD, 0x00000FCD, 0x00000FCE, 0x00000FCF,
+    0x000000FD, 0x00000FD1, 0x00000FD2, 0x00000FD3, 0x00000FD4, 0x00000FD5, 0x00000FD6, 0x00000FD7,
+    0x00000FD8, 0x00000FD9, 0x00000FDA, 0x00000FDB, 0x00000FDC, 0x100000FE, 0x00000FDE, 0x00000FDF,
+    0x000000FE, 0x00000FE1, 0x00000FE2, 0x00000FE3, 0x00000FE4, 0x00000FE5, 0x00000FE6, 0x00000FE7,
+    0x00000FE8, 0x00000FE9, 0x00000FEA, 0x00000FEB, 0x00000FEC, 0x00000FED, 0x200000FF, 0x00000FEF,
+    0x000000FF, 0x00000FF1, 0x00000FF2, 0x00000FF3, 0x00000FF4, 0x00000FF5, 0x00000FF6, 0x00000FF7,
+    0x00000FF8, 0x00000FF9, 0x00000FFA, 0x00000FFB, 0x00000FFC, 0x00000FFD, 0x00000FFE, 0x00000FFF,
+    0x00000001, 0x00010002, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016, 0x00000017,
+    0x00000018, 0x00000019, 0x0000001A, 0x0000001B, 0x0000001C, 0x0000001D, 0x0000001E, 0x0000001F,
+    0x00010002, 0x00010012, 0x00010022, 0x00010023, 0x00010024, 0x00010025, 0x00010026, 0x00010027,
+    0x00010028, 0x00010029, 0x0001002A, 0x0001002B, 0x0001002C, 0x0001002D, 0x0001002E, 0x0001002F,
+    0x00000012, 0x00000121, 0x00020013, 0x00000123, 0x00000124, 0x00000125, 0x00000126, 0x00000127,
+    0x00000128, 0x00000129, 0x0000012A, 0x0000012B, 0x0000012C, 0x0000012D, 0x0000012E, 0x0000012F,
+    0x00000013, 0x00000131, 0x00000132, 0x00040014, 0x00000134, 0x00000135, 0x00000136, 0x00000137,
+    0x00000138, 0x00000139, 0x0000013A, 0x0000013B, 0x0000013C, 0x0000013D, 0x0000013E, 0x0000013F,
+    0x00000014, 0x00000141, 0x00000142, 0x00000143, 0x00080015, 0x00000145, 0x00000146, 0x00000147,
+    0x00000148, 0x00000149, 0x0000014A, 0x0000014B, 0x0000014C, 0x0000014D, 0x0000014E, 0x0000014F,
+    0x00000015, 0x00000151, 0x00000152, 0x00000153, 0x00000154, 0x00100016, 0x00000156, 0x00000157,
+    0x00000158, 0x00000159, 0x0000015A, 0x0000015B, 0x0000015C, 0x0000015D, 0x0000015E, 0x0000015F,
+    0x00000016, 0x00000161, 0x00000162, 0x00000163, 0x00000164, 0x00000165, 0x00200017, 0x00000167,
+    0x00000168, 0x00000169, 0x0000016A, 0x0000016B, 0x0000016C, 0x0000016D, 0x0000016E, 0x0000016F,
+    0x00000017, 0x00000171, 0x00000172, 0x00000173, 0x00000174, 0x00000175, 0x00000176, 0x00400018,
+    0x00000178, 0x00000179, 0x0000017A, 0x0000017B, 0x0000017C, 0x0000017D, 0x0000017E, 0x0000017F,
+    0x00000018, 0x00000181, 0x00000182, 0x00000183, 0x00000184, 0x00000185, 0x00000186, 0x00000187,
+    0x00800019, 0x00000189, 0x0000018A, 0x0000018B, 0x0000018C, 0x0000018D, 0x0000018E, 0x0000018F,
+    0x00000019, 0x00000191, 0x00000192, 0x00000193, 0x00000194, 0x00000195, 0x00000196, 0x00000197,
+    0x00000198, 0x0100001A, 0x0000019A, 0x0000019B, 0x0000019C, 0x0000019D, 0x0000019E, 0x0000019F,
+    0x0000001A, 0x000001A1, 0x000001A2, 0x000001A3, 0x000001A4, 0x000001A5, 0x000001A6, 0x000001A7,
+    0x000001A8, 0x000001A9, 0x8200001B, 0x000001AB, 0x000001AC, 0x000001AD, 0x000001AE, 0x000001AF,
+    0x0000001B, 0x000001B1, 0x000001B2, 0x000001B3, 0x000001B4, 0x000001B5, 0x000001B6, 0x000001B7,
+    0x000001B8, 0x000001B9, 0x000001BA, 0x0400001C, 0x000001BC, 0x000001BD, 0x000001BE, 0x000001BF,
+    0x0000001C, 0x000001C1, 0x000001C2, 0x000001C3, 0x000001C4, 0x000001C5, 0x000001C6, 0x000001C7,
+    0x000001C8, 0x000001C9, 0x000001CA, 0x000001CB, 0x0800001D, 0x000001CD, 0x000001CE, 0x000001CF,
+    0x0000001D, 0x000001D1, 0x000001D2, 0x000001D3, 0x000001D4, 0x000001D5, 0x000001D6, 0x000001D7,
+    0x000001D8, 0x000001D9, 0x000001DA, 0x000001DB, 0x000001DC, 0x1000001E, 0x000001DE, 0x000001DF,
+    0x0000001E, 0x000001E1, 0x000001E2, 0x000001E3, 0x000001E4, 0x000001E5, 0x000001E6, 0x000001E7,
+    0x000001E8, 0x000001E9, 0x000001EA, 0x000001EB, 0x000001EC, 0x000001ED, 0x2000001F, 0x000001EF,
+    0x0000001F, 0x000001F1, 0x000001F2, 0x000001F3, 0x000001F4, 0x000001F5, 0x000001F6, 0x000001F7,
+    0x000001F8, 0x000001F9, 0x000001FA, 0x000001FB, 0x000001FC, 0x000001FD, 0x000001FE, 0x000001FF,
+    0x00010002, 0x00010012, 0x00010022, 0x00010023, 0x00010024, 0x00010025, 0x00010026, 0x00010027,
+    0x00010028, 0x00010029, 0x0001002A, 0x0001002B, 0x0001002C, 0x0001002D, 0x0001002E, 0x0001002F,
+    0x00010012, 0x00020022, 0x00010122, 0x00010123, 0x00010124, 0x00010125, 0x00010126, 0x00010127,
+    0x00010128, 0x00010129, 0x0001012A, 0x0001012B, 0x0001012C, 0x0001012D, 0x0001012E, 0x0001012F,
+    0x00010022, 0x00010221, 0x00030023, 0x00010223, 0x00010224, 0x00010225, 0x00010226, 0x00010227,
+    0x00010228, 0x00010229, 0x0001022A, 0x0001022B, 0x0001022C, 0x0001022D, 0x0001022E, 0x0001022F,
+    0x00010023, 0x00010231, 0x00010232, 0x00050024, 0x00010234, 0x00010235, 0x00010236, 0x00010237,
+    0x00010238, 0x00010239, 0x0001023A, 0x0001023B, 0x0001023C, 0x0001023D, 0x0001023E, 0x0001023F,
+    0x00010024, 0x00010241, 0x00010242, 0x00010243, 0x00090025, 0x00010245, 0x00010246, 0x00010247,
+    0x00010248, 0x00010249, 0x0001024A, 0x0001024B, 0x0001024C, 0x0001024D, 0x0001024E, 0x0001024F,
+    0x00010025, 0x00010251, 0x00010252, 0x00010253, 0x00010254, 0x00110026, 0x00010256, 0x00010257,
+    0x00010258, 0x00010259, 0x0001025A, 0x0001025B, 0x0001025C, 0x0001025D, 0x0001025E, 0x0001025F,
+    0x00010026, 0x00010261, 0x00010262, 0x00010263, 0x00010264, 0x00010265, 0x00210027, 0x00010267,
+    0x00010268, 0x00010269, 0x0001026A, 0x0001026B, 0x0001026C, 0x0001026D, 0x0001026E, 0x0001026F,
+    0x00010027, 0x00010271, 0x00010272, 0x00010273, 0x00010274, 0x00010275, 0x00010276, 0x00410028,
+    0x00010278, 0x00010279, 0x0001027A, 0x0001027B, 0x0001027C, 0x0001027D, 0x0001027E, 0x0001027F,
+    0x00010028, 0x00010281, 0x00010282, 0x00010283, 0x00010284, 0x00010285, 0x00010286, 0x00010287,
+    0x00810029, 0x00010289, 0x0001028A, 0x0001028B, 0x0001028C, 0x0001028D, 0x0001028E, 0x0001028F,
+    0x00010029, 0x00010291, 0x00010292, 0x00010293, 0x00010294, 0x00010295, 0x00010296, 0x00010297,
+    0x00010298, 0x0101002A, 0x0001029A, 0x0001029B, 0x0001029C, 0x0001029D, 0x0001029E, 0x0001029F,
+    0x0001002A, 0x000102A1, 0x000102A2, 0x000102A3, 0x000102A4, 0x000102A5, 0x000102A6, 0x000102A7,
+    0x000102A8, 0x000102A9, 0x8201002B, 0x000102AB, 0x000102AC, 0x000102AD, 0x000102AE, 0x000102AF,
+    0x0001002B, 0x000102B1, 0x000102B2, 0x000102B3, 0x000102B4, 0x000102B5, 0x000102B6, 0x000102B7,
+    0x000102B8, 0x000102B9, 0x000102BA, 0x0401002C, 0x000102BC, 0x000102BD, 0x000102BE, 0x000102BF,
+    0x0001002C, 0x000102C1, 0x000102C2, 0x000102C3, 0x000102C4, 0x000102C5, 0x000102C6, 0x000102C7,
+    0x000102C8, 0x000102C9, 0x000102CA, 0x000102CB, 0x0801002D, 0x000102CD, 0x000102CE, 0x000102CF,
+    0x0001002D, 0x000102D1, 0x000102D2, 0x000102D3, 0x000102D4, 0x000102D5, 0x000102D6, 0x000102D7,
+    0x000102D8, 0x000102D9, 0x000102DA, 0x000102DB, 0x000102DC, 0x1001002E, 0x000102DE, 0x000102DF,
+    0x0001002E, 0x000102E1, 0x000102E2, 0x000102E3, 0x000102E4, 0x000102E5, 0x000102E6, 0x000102E7,
+    0x000102E8, 0x000102E9, 0x000102EA, 0x000102EB, 0x000102EC, 0x000102ED, 0x2001002F, 0x000102EF,
+    0x0001002F, 0x000102F1, 0x000102F2, 0x000102F3, 0x000102F4, 0x000102F5, 0x000102F6, 0x000102F7,
+    0x000102F8, 0x000102F9, 0x000102FA, 0x000102FB, 0x000102FC, 0x000102FD, 0x000102FE, 0x000102FF,
+    0x00000012, 0x00000121, 0x00020013, 0x00000123, 0x00000124, 0x00000125, 0x00000126, 0x00000127,
+    0x00000128, 0x00000129, 0x0000012A, 0x0000012B, 0x0000012C, 0x0000012D, 0x0000012E, 0x0000012F,
+    0x00000121, 0x00010122, 0x00001212, 0x00001213, 0x00001214, 0x00001215, 0x00001216, 0x00001217,
+    0x00001218, 0x00001219, 0x0000121A, 0x0000121B, 0x0000121C, 0x0000121D, 0x0000121E, 0x0000121F,
+    0x00020013, 0x00020131, 0x00020123, 0x00020133, 0x00020134, 0x00020135, 0x00020136, 0x00020137,
+    0x00020138, 0x00020139, 0x0002013A, 0x0002013B, 0x0002013C, 0x0002013D, 0x0002013E, 0x0002013F,
+    0x00000123, 0x00001231, 0x00001232, 0x00040124, 0x00001234, 0x00001235, 0x00001236, 0x00001237,
+    0x00001238, 0x00001239, 0x0000123A, 0x0000123B, 0x0000123C, 0x0000123D, 0x0000123E, 0x0000123F,
+    0x00000124, 0x00001241, 0x00001242, 0x00001243, 0x00080125, 0x00001245, 0x00001246, 0x00001247,
+    0x00001248, 0x00001249, 0x0000124A, 0x0000124B, 0x0000124C, 0x0000124D, 0x0000124E, 0x0000124F,
+    0x00000125, 0x00001251, 0x00001252, 0x00001253, 0x00001254, 0x00100126, 0x00001256, 0x00001257,
+    0x00001258, 0x00001259, 0x0000125A, 0x0000125B, 0x0000125C, 0x0000125D, 0x0000125E, 0x0000125F,
+    0x00000126, 0x00001261, 0x00001262, 0x00001263, 0x00001264, 0x00001265, 0x00200127, 0x00001267,
+    0x00001268, 0x00001269, 0x0000126A, 0x0000126B, 0x0000126C, 0x0000126D, 0x0000126E, 0x0000126F,
+    0x00000127, 0x00001271, 0x00001272, 0x00001273, 0x00001274, 0x00001275, 0x00001276, 0x00400128,
+    0x00001278, 0x00001279, 0x0000127A, 0x0000127B, 0x0000127C, 0x0000127D, 0x0000127E, 0x0000127F,
+    0x00000128, 0x00001281, 0x00001282, 0x00001283, 0x00001284, 0x00001285, 0x00001286, 0x00001287,
+    0x00800129, 0x00001289, 0x0000128A, 0x0000128B, 0x0000128C, 0x0000128D, 0x0000128E, 0x0000128F,
+    0x00000129, 0x00001291, 0x00001292, 0x00001293, 0x00001294, 0x00001295, 0x00001296, 0x00001297,
+    0x00001298, 0x0100012A, 0x0000129A, 0x0000129B, 0x0000129C, 0x0000129D, 0x0000129E, 0x0000129F,
+    0x0000012A, 0x000012A1, 0x000012A2, 0x000012A3, 0x000012A4, 0x000012A5, 0x000012A6, 0x000012A7,
+    0x000012A8, 0x000012A9, 0x8200012B, 0x000012AB, 0x000012AC, 0x000012AD, 0x000012AE, 0x000012AF,
+    0x0000012B, 0x000012B1, 0x000012B2, 0x000012B3, 0x000012B4, 0x000012B5, 0x000012B6, 0x000012B7,
+    0x000012B8, 0x000012B9, 0x000012BA, 0x0400012C, 0x000012BC, 0x000012BD, 0x000012BE, 0x000012BF,
+    0x0000012C, 0x000012C1, 0x000012C2, 0x000012C3, 0x000012C4, 0x000012C5, 0x000012C6, 0x000012C7,
+    0x000012C8, 0x000012C9, 0x000012CA, 0x000012CB, 0x0800012D, 0x000012CD, 0x000012CE, 0x000012CF,
+    0x0000012D, 0x000012D1, 0x000012D2, 0x000012D3, 0x000012D4, 0x000012D5, 0x000012D6, 0x000012D7,
+    0x000012D8, 0x000012D9, 0x000012DA, 0x000012DB, 0x000012DC, 0x1000012E, 0x000012DE, 0x000012DF,
+    0x0000012E, 0x000012E1, 0x000012E2, 0x000012E3, 0x000012E4, 0x000012E5, 0x000012E6, 0x000012E7,
+    0x000012E8, 0x000012E9, 0x000012EA, 0x000012EB, 0x000012EC, 0x000012ED, 0x2000012F, 0x000012EF,
+    0x0000012F, 0x000012F1, 0x000012F2, 0x000012F3, 0x000012F4, 0x000012F5, 0x000012F6, 0x000012F7,
+    0x000012F8, 0x000012F9, 0x000012FA, 0x000012FB, 0x000012FC, 0x000012FD, 0x000012FE, 0x000012FF,
+    0x00000013, 0x00000131, 0x00000132, 0x00040014, 0x00000134, 0x00000135, 0x00000136, 0x00000137,
+    0x00000138, 0x00000139, 0x0000013A, 0x0000013B, 0x0000013C, 0x0000013D, 0x0000013E, 0x0000013F,
+    0x00000131, 0x00010132, 0x00001312, 0x00001313, 0x00001314, 0x00001315, 0x00001316, 0x00001317,
+    0x00001318, 0x00001319, 0x0000131A, 0x0000131B, 0x0000131C, 0x0000131D, 0x0000131E, 0x0000131F,
+    0x00000132, 0x00001321, 0x00020133, 0x00001323, 0x00001324, 0x00001325, 0x00001326, 0x00001327,
+    0x00001328, 0x00001329, 0x0000132A, 0x0000132B, 0x0000132C, 0x0000132D, 0x0000132E, 0x0000132F,
+    0x00040014, 0x00040141, 0x00040142, 0x00040134, 0x00040144, 0x00040145, 0x00040146, 0x00040147,
+    0x00040148, 0x00040149, 0x0004014A, 0x0004014B, 0x0004014C, 0x0004014D, 0x0004014E, 0x0004014F,
+    0x00000134, 0x00001341, 0x00001342, 0x00001343, 0x00080135, 0x00001345, 0x00001346, 0x00001347,
+    0x00001348, 0x00001349, 0x0000134A, 0x0000134B, 0x0000134C, 0x0000134D, 0x0000134E, 0x0000134F,
+    0x00000135, 0x00001351, 0x00001352, 0x00001353, 0x00001354, 0x00100136, 0x00001356, 0x00001357,
+    0x00001358, 0x00001359, 0x0000135A, 0x0000135B, 0x0000135C, 0x0000135D, 0x0000135E, 0x0000135F,
+    0x00000136, 0x00001361, 0x00001362, 0x00001363, 0x00001364, 0x00001365, 0x00200137, 0x00001367,
+    0x00001368, 0x00001369, 0x0000136A, 0x0000136B, 0x0000136C, 0x0000136D, 0x0000136E, 0x0000136F,
+    0x00000137, 0x00001371, 0x00001372, 0x00001373, 0x00001374, 0x00001375, 0x00001376, 0x00400138,
+    0x00001378, 0x00001379, 0x0000137A, 0x0000137B, 0x0000137C, 0x0000137D, 0x0000137E, 0x0000137F,
+    0x00000138, 0x00001381, 0x00001382, 0x00001383, 0x00001384, 0x00001385, 0x00001386, 0x00001387,
+    0x00800139, 0x00001389, 0x0000138A, 0x0000138B, 0x0000138C, 0x0000138D, 0x0000138E, 0x0000138F,
+    0x00000139, 0x00001391, 0x00001392, 0x00001393, 0x00001394, 0x00001395, 0x00001396, 0x00001397,
+    0x00001398, 0x0100013A, 0x0000139A, 0x0000139B, 0x0000139C, 0x0000139D, 0x0000139E, 0x0000139F,
+    0x0000013A, 0x000013A1, 0x000013A2, 0x000013A3, 0x000013A4, 0x000013A5, 0x000013A6, 0x000013A7,
+    0x000013A8, 0x000013A9, 0x8200013B, 0x000013AB, 0x000013AC, 0x000013AD, 0x000013AE, 0x000013AF,
+    0x0000013B, 0x000013B1, 0x000013B2, 0x000013B3, 0x000013B4, 0x000013B5, 0x000013B6, 0x000013B7,
+    0x000013B8, 0x000013B9, 0x000013BA, 0x0400013C, 0x000013BC, 0x000013BD, 0x000013BE, 0x000013BF,
+    0x0000013C, 0x000013C1, 0x000013C2, 0x000013C3, 0x000013C4, 0x000013C5, 0x000013C6, 0x000013C7,
+    0x000013C8, 0x000013C9, 0x000013CA, 0x000013CB, 0x0800013D, 0x000013CD, 0x000013CE, 0x000013CF,
+    0x0000013D, 0x000013D1, 0x000013D2, 0x000013D3, 0x000013D4, 0x000013D5, 0x000013D6, 0x000013D7,
+    0x000013D8, 0x000013D9, 0x000013DA, 0x000013DB, 0x000013DC, 0x1000013E, 0x000013DE, 0x000013DF,
+    0x0000013E, 0x000013E1, 0x000013E2, 0x000013E3, 0x000013E4, 0x000013E5, 0x000013E6, 0x000013E7,
+    0x000013E8, 0x000013E9, 0x000013EA, 0x000013EB, 0x000013EC, 0x000013ED, 0x2000013F, 0x000013EF,
+    0x0000013F, 0x000013F1, 0x000013F2, 0x000013F3, 0x000013F4, 0x000013F5, 0x000013F6, 0x000013F7,
+    0x000013F8, 0x000013F9, 0x000013FA, 0x000013FB, 0x000013FC, 0x000013FD, 0x000013FE, 0x000013FF,
+    0x00000014, 0x00000141, 0x00000142, 0x00000143, 0x00080015, 0x00000145, 0x00000146, 0x00000147,
+    0x00000148, 0x00000149, 0x0000014A, 0x0000014B, 0x0000014C, 0x0000014D, 0x0000014E, 0x0000014F,
+    0x00000141, 0x00010142, 0x00001412, 0x00001413, 0x00001414, 0x00001415, 0x00001416, 0x00001417,
+    0x00001418, 0x00001419, 0x0000141A, 0x0000141B, 0x0000141C, 0x0000141D, 0x0000141E, 0x0000141F,
+    0x00000142, 0x00001421, 0x00020143, 0x00001423, 0x00001424, 0x00001425, 0x00001426, 0x00001427,
+    0x00001428, 0x00001429, 0x0000142A, 0x0000142B, 0x0000142C, 0x0000142D, 0x0000142E, 0x0000142F,
+    0x00000143, 0x00001431, 0x00001432, 0x00040144, 0x00001434, 0x00001435, 0x00001436, 0x00001437,
+    0x00001438, 0x00001439, 0x0000143A, 0x0000143B, 0x0000143C, 0x0000143D, 0x0000143E, 0x0000143F,
+    0x00080015, 0x00080151, 0x00080152, 0x00080153, 0x00080145, 0x00080155, 0x00080156, 0x00080157,
+    0x00080158, 0x00080159, 0x0008015A, 0x0008015B, 0x0008015C, 0x0008015D, 0x0008015E, 0x0008015F,
+    0x00000145, 0x00001451, 0x00001452, 0x00001453, 0x00001454, 0x00100146, 0x00001456, 0x00001457,
+    0x00001458, 0x00001459, 0x0000145A, 0x0000145B, 0x0000145C, 0x0000145D, 0x0000145E, 0x0000145F,
+    0x00000146, 0x00001461, 0x00001462, 0x00001463, 0x00001464, 0x00001465, 0x00200147, 0x00001467,
+    0x00001468, 0x00001469, 0x0000146A, 0x0000146B, 0x0000146C, 0x0000146D, 0x0000146E, 0x0000146F,
+    0x00000147, 0x00001471, 0x00001472, 0x00001473, 0x00001474, 0x00001475, 0x00001476, 0x00400148,
+    0x00001478, 0x00001479, 0x0000147A, 0x0000147B, 0x0000147C, 0x0000147D, 0x0000147E, 0x0000147F,
+    0x00000148, 0x00001481, 0x00001482, 0x00001483, 0x00001484, 0x00001485, 0x00001486, 0x00001487,
+    0x00800149, 0x00001489, 0x0000148A, 0x0000148B, 0x0000148C, 0x0000148D, 0x0000148E, 0x0000148F,
+    0x00000149, 0x00001491, 0x00001492, 0x00001493, 0x00001494, 0x00001495, 0x00001496, 0x00001497,
+    0x00001498, 0x0100014A, 0x0000149A, 0x0000149B, 0x0000149C, 0x0000149D, 0x0000149E, 0x0000149F,
+    0x0000014A, 0x000014A1, 0x000014A2, 0x000014A3, 0x000014A4, 0x000014A5, 0x000014A6, 0x000014A7,
+    0x000014A8, 0x000014A9, 0x8200014B, 0x000014AB, 0x000014AC, 0x000014AD, 0x000014AE, 0x000014AF,
+    0x0000014B, 0x000014B1, 0x000014B2, 0x000014B3, 0x000014B4, 0x000014B5, 0x000014B6, 0x000014B7,
+    0x000014B8, 0x000014B9, 0x000014BA, 0x0400014C, 0x000014BC, 0x000014BD, 0x000014BE, 0x000014BF,
+    0x0000014C, 0x000014C1, 0x000014C2, 0x000014C3, 0x000014C4, 0x000014C5, 0x000014C6, 0x000014C7,
+    0x000014C8, 0x000014C9, 0x000014CA, 0x000014CB, 0x0800014D, 0x000014CD, 0x000014CE, 0x000014CF,
+    0x0000014D, 0x000014D1, 0x000014D2, 0x000014D3, 0x000014D4, 0x000014D5, 0x000014D6, 0x000014D7,
+    0x000014D8, 0x000014D9, 0x000014DA, 0x000014DB, 0x000014DC, 0x1000014E, 0x000014DE, 0x000014DF,
+    0x0000014E, 0x000014E1, 0x000014E2, 0x000014E3, 0x000014E4, 0x000014E5, 0x000014E6, 0x000014E7,
+    0x000014E8, 0x000014E9, 0x000014EA, 0x000014EB, 0x000014EC, 0x000014ED, 0x2000014F, 0x000014EF,
+    0x0000014F, 0x000014F1, 0x000014F2, 0x000014F3, 0x000014F4, 0x000014F5, 0x000014F6, 0x000014F7,
+    0x000014F8, 0x000014F9, 0x000014FA, 0x000014FB, 0x000014FC, 0x000014FD, 0x000014FE, 0x000014FF,
+    0x00000015, 0x00000151, 0x00000152, 0x00000153, 0x00000154, 0x00100016, 0x00000156, 0x00000157,
+    0x00000158, 0x00000159, 0x0000015A, 0x0000015B, 0x0000015C, 0x0000015D, 0x0000015E, 0x0000015F,
+    0x00000151, 0x00010152, 0x00001512, 0x00001513, 0x00001514, 0x00001515, 0x00001516, 0x00001517,
+    0x00001518, 0x00001519, 0x0000151A, 0x0000151B, 0x0000151C, 0x0000151D, 0x0000151E, 0x0000151F,
+    0x00000152, 0x00001521, 0x00020153, 0x00001523, 0x00001524, 0x00001525, 0x00001526, 0x00001527,
+    0x00001528, 0x00001529, 0x0000152A, 0x0000152B, 0x0000152C, 0x0000152D, 0x0000152E, 0x0000152F,
+    0x00000153, 0x00001531, 0x00001532, 0x00040154, 0x00001534, 0x00001535, 0x00001536, 0x00001537,
+    0x00001538, 0x00001539, 0x0000153A, 0x0000153B, 0x0000153C, 0x0000153D, 0x0000153E, 0x0000153F,
+    0x00000154, 0x00001541, 0x00001542, 0x00001543, 0x00080155, 0x00001545, 0x00001546, 0x00001547,
+    0x00001548, 0x00001549, 0x0000154A, 0x0000154B, 0x0000154C, 0x0000154D, 0x0000154E, 0x0000154F,
+    0x00100016, 0x00100161, 0x00100162, 0x00100163, 0x00100164, 0x00100156, 0x00100166, 0x00100167,
+    0x00100168, 0x00100169, 0x0010016A, 0x0010016B, 0x0010016C, 0x0010016D, 0x0010016E, 0x0010016F,
+    0x00000156, 0x00001561, 0x00001562, 0x00001563, 0x00001564, 0x00001565, 0x00200157, 0x00001567,
+    0x00001568, 0x00001569, 0x0000156A, 0x0000156B, 0x0000156C, 0x0000156D, 0x0000156E, 0x0000156F,
+    0x00000157, 0x00001571, 0x00001572, 0x00001573, 0x00001574, 0x00001575, 0x00001576, 0x00400158,
+    0x00001578, 0x00001579, 0x0000157A, 0x0000157B, 0x0000157C, 0x0000157D, 0x0000157E, 0x0000157F,
+    0x00000158, 0x00001581, 0x00001582, 0x00001583, 0x00001584, 0x00001585, 0x00001586, 0x00001587,
+    0x00800159, 0x00001589, 0x0000158A, 0x0000158B, 0x0000158C, 0x0000158D, 0x0000158E, 0x0000158F,
+    0x00000159, 0x00001591, 0x00001592, 0x00001593, 0x00001594, 0x00001595, 0x00001596, 0x00001597,
+    0x00001598, 0x0100015A, 0x0000159A, 0x0000159B, 0x0000159C, 0x0000159D, 0x0000159E, 0x0000159F,
+    0x0000015A, 0x000015A1, 0x000015A2, 0x000015A3, 0x000015A4, 0x000015A5, 0x000015A6, 0x000015A7,
+    0x000015A8, 0x000015A9, 0x8200015B, 0x000015AB, 0x000015AC, 0x000015AD, 0x000015AE, 0x000015AF,
+    0x0000015B, 0x000015B1, 0x000015B2, 0x000015B3, 0x000015B4, 0x000015B5, 0x000015B6, 0x000015B7,
+    0x000015B8, 0x000015B9, 0x000015BA, 0x0400015C, 0x000015BC, 0x000015BD, 0x000015BE, 0x000015BF,
+    0x0000015C, 0x000015C1, 0x000015C2, 0x000015C3, 0x000015C4, 0x000015C5, 0x000015C6, 0x000015C7,
+    0x000015C8, 0x000015C9, 0x000015CA, 0x000015CB, 0x0800015D, 0x000015CD, 0x000015CE, 0x000015CF,
+    0x0000015D, 0x000015D1, 0x000015D2, 0x000015D3, 0x000015D4, 0x000015D5, 0x000015D6, 0x000015D7,
+    0x000015D8, 0x000015D9, 0x000015DA, 0x000015DB, 0x000015DC, 0x1000015E, 0x000015DE, 0x000015DF,
+    0x0000015E, 0x000015E1, 0x000015E2, 0x000015E3, 0x000015E4, 0x000015E5, 0x000015E6, 0x000015E7,
+    0x000015E8, 0x000015E9, 0x000015EA, 0x000015EB, 0x000015EC, 0x000015ED, 0x2000015F, 0x000015EF,
+    0x0000015F, 0x000015F1, 0x000015F2, 0x000015F3, 0x000015F4, 0x000015F5, 0x000015F6, 0x000015F7,
+    0x000015F8, 0x000015F9, 0x000015FA, 0x000015FB, 0x000015FC, 0x000015FD, 0x000015FE, 0x000015FF,
+    0x00000016, 0x00000161, 0x00000162, 0x00000163, 0x00000164, 0x00000165, 0x00200017, 0x00000167,
+    0x00000168, 0x00000169, 0x0000016A, 0x0000016B, 0x0000016C, 0x0000016D, 0x0000016E, 0x0000016F,
+    0x00000161, 0x00010162, 0x00001612, 0x00001613, 0x00001614, 0x00001615, 0x00001616, 0x00001617,
+    0x00001618, 0x00001619, 0x0000161A, 0x0000161B, 0x0000161C, 0x0000161D, 0x0000161E, 0x0000161F,
+    0x00000162, 0x00001621, 0x00020163, 0x00001623, 0x00001624, 0x00001625, 0x00001626, 0x00001627,
+    0x00001628, 0x00001629, 0x0000162A, 0x0000162B, 0x0000162C, 0x0000162D, 0x0000162E, 0x0000162F,
+    0x00000163, 0x00001631, 0x00001632, 0x00040164, 0x00001634, 0x00001635, 0x00001636, 0x00001637,
+    0x00001638, 0x00001639, 0x0000163A, 0x0000163B, 0x0000163C, 0x0000163D, 0x0000163E, 0x0000163F,
+    0x00000164, 0x00001641, 0x00001642, 0x00001643, 0x00080165, 0x00001645, 0x00001646, 0x00001647,
+    0x00001648, 0x00001649, 0x0000164A, 0x0000164B, 0x0000164C, 0x0000164D, 0x0000164E, 0x0000164F,
+    0x00000165, 0x00001651, 0x00001652, 0x00001653, 0x00001654, 0x00100166, 0x00001656, 0x00001657,
+    0x00001658, 0x00001659, 0x0000165A, 0x0000165B, 0x0000165C, 0x0000165D, 0x0000165E, 0x0000165F,
+    0x00200017, 0x00200171, 0x00200172, 0x00200173, 0x00200174, 0x00200175, 0x00200167, 0x00200177,
+    0x00200178, 0x00200179, 0x0020017A, 0x0020017B, 0x0020017C, 0x0020017D, 0x0020017E, 0x0020017F,
+    0x00000167, 0x00001671, 0x00001672, 0x00001673, 0x00001674, 0x00001675, 0x00001676, 0x00400168,
+    0x00001678, 0x00001679, 0x0000167A, 0x0000167B, 0x0000167C, 0x0000167D, 0x0000167E, 0x0000167F,
+    0x00000168, 0x00001681, 0x00001682, 0x00001683, 0x00001684, 0x00001685, 0x00001686, 0x00001687,
+    0x00800169, 0x00001689, 0x0000168A, 0x0000168B, 0x0000168C, 0x0000168D, 0x0000168E, 0x0000168F,
+    0x00000169, 0x00001691, 0x00001692, 0x00001693, 0x00001694, 0x00001695, 0x00001696, 0x00001697,
+    0x00001698, 0x0100016A, 0x0000169A, 0x0000169B, 0x0000169C, 0x0000169D, 0x0000169E, 0x0000169F,
+    0x0000016A, 0x000016A1, 0x000016A2, 0x000016A3, 0x000016A4, 0x000016A5, 0x000016A6, 0x000016A7,
+    0x000016A8, 0x000016A9, 0x8200016B, 0x000016AB, 0x000016AC, 0x000016AD, 0x000016AE, 0x000016AF,
+    0x0000016B, 0x000016B1, 0x000016B2, 0x000016B3, 0x000016B4, 0x000016B5, 0x000016B6, 0x000016B7,
+    0x000016B8, 0x000016B9, 0x000016BA, 0x0400016C, 0x000016BC, 0x000016BD, 0x000016BE, 0x000016BF,
+    0x0000016C, 0x000016C1, 0x000016C2, 0x000016C3, 0x000016C4, 0x000016C5, 0x000016C6, 0x000016C7,
+    0x000016C8, 0x000016C9, 0x000016CA, 0x000016CB, 0x0800016D, 0x000016CD, 0x000016CE, 0x000016CF,
+    0x0000016D, 0x000016D1, 0x000016D2, 0x000016D3, 0x000016D4, 0x000016D5, 0x000016D6, 0x000016D7,
+    0x000016D8, 0x000016D9, 0x000016DA, 0x000016DB, 0x000016DC, 0x1000016E, 0x000016DE, 0x000016DF,
+    0x0000016E, 0x000016E1, 0x000016E2, 0x000016E3, 0x000016E4, 0x000016E5, 0x000016E6, 0x000016E7,
+    0x000016E8, 0x000016E9, 0x000016EA, 0x000016EB, 0x000016EC, 0x000016ED, 0x2000016F, 0x000016EF,
+    0x0000016F, 0x000016F1, 0x000016F2, 0x000016F3, 0x000016F4, 0x000016F5, 0x000016F6, 0x000016F7,
+    0x000016F8, 0x000016F9, 0x000016FA, 0x000016FB, 0x000016FC, 0x000016FD, 0x000016FE, 0x000016FF,
+    0x00000017, 0x00000171, 0x00000172, 0x00000173, 0x00000174, 0x00000175, 0x00000176, 0x00400018,
+    0x00000178, 0x00000179, 0x0000017A, 0x0000017B, 0x0000017C, 0x0000017D, 0x0000017E, 0x0000017F,
+    0x00000171, 0x00010172, 0x00001712, 0x00001713, 0x00001714, 0x00001715, 0x00001716, 0x00001717,
+    0x00001718, 0x00001719, 0x0000171A, 0x0000171B, 0x0000171C, 0x0000171D, 0x0000171E, 0x0000171F,
+    0x00000172, 0x00001721, 0x00020173, 0x00001723, 0x00001724, 0x00001725, 0x00001726, 0x00001727,
+    0x00001728, 0x00001729, 0x0000172A, 0x0000172B, 0x0000172C, 0x0000172D, 0x0000172E, 0x0000172F,
+    0x00000173, 0x00001731, 0x00001732, 0x00040174, 0x00001734, 0x00001735, 0x00001736, 0x00001737,
+    0x00001738, 0x00001739, 0x0000173A, 0x0000173B, 0x0000173C, 0x0000173D, 0x0000173E, 0x0000173F,
+    0x00000174, 0x00001741, 0x00001742, 0x00001743, 0x00080175, 0x00001745, 0x00001746, 0x00001747,
+    0x00001748, 0x00001749, 0x0000174A, 0x0000174B, 0x0000174C, 0x0000174D, 0x0000174E, 0x0000174F,
+    0x00000175, 0x00001751, 0x00001752, 0x00001753, 0x00001754, 0x00100176, 0x00001756, 0x00001757,
+    0x00001758, 0x00001759, 0x0000175A, 0x0000175B, 0x0000175C, 0x0000175D, 0x0000175E, 0x0000175F,
+    0x00000176, 0x00001761, 0x00001762, 0x00001763, 0x00001764, 0x00001765, 0x00200177, 0x00001767,
+    0x00001768, 0x00001769, 0x0000176A, 0x0000176B, 0x0000176C, 0x0000176D, 0x0000176E, 0x0000176F,
+    0x00400018, 0x00400181, 0x00400182, 0x00400183, 0x00400184, 0x00400185, 0x00400186, 0x00400178,
+    0x00400188, 0x00400189, 0x0040018A, 0x0040018B, 0x0040018C, 0x0040018D, 0x0040018E, 0x0040018F,
+    0x00000178, 0x00001781, 0x00001782, 0x00001783, 0x00001784, 0x00001785, 0x00001786, 0x00001787,
+    0x00800179, 0x00001789, 0x0000178A, 0x0000178B, 0x0000178C, 0x0000178D, 0x0000178E, 0x0000178F,
+    0x00000179, 0x00001791, 0x00001792, 0x00001793, 0x00001794, 0x00001795, 0x00001796, 0x00001797,
+    0x00001798, 0x0100017A, 0x0000179A, 0x0000179B, 0x0000179C, 0x0000179D, 0x0000179E, 0x0000179F,
+    0x0000017A, 0x000017A1, 0x000017A2, 0x000017A3, 0x000017A4, 0x000017A5, 0x000017A6, 0x000017A7,
+    0x000017A8, 0x000017A9, 0x8200017B, 0x000017AB, 0x000017AC, 0x000017AD, 0x000017AE, 0x000017AF,
+    0x0000017B, 0x000017B1, 0x000017B2, 0x000017B3, 0x000017B4, 0x000017B5, 0x000017B6, 0x000017B7,
+    0x000017B8, 0x000017B9, 0x000017BA, 0x0400017C, 0x000017BC, 0x000017BD, 0x000017BE, 0x000017BF,
+    0x0000017C, 0x000017C1, 0x000017C2, 0x000017C3, 0x000017C4, 0x000017C5, 0x000017C6, 0x000017C7,
+    0x000017C8, 0x000017C9, 0x000017CA, 0x000017CB, 0x0800017D, 0x000017CD, 0x000017CE, 0x000017CF,
+    0x0000017D, 0x000017D1, 0x000017D2, 0x000017D3, 0x000017D4, 0x000017D5, 0x000017D6, 0x000017D7,
+    0x000017D8, 0x000017D9, 0x000017DA, 0x000017DB, 0x000017DC, 0x1000017E, 0x000017DE, 0x000017DF,
+    0x0000017E, 0x000017E1, 0x000017E2, 0x000017E3, 0x000017E4, 0x000017E5, 0x000017E6, 0x000017E7,
+    0x000017E8, 0x000017E9, 0x000017EA, 0x000017EB, 0x000017EC, 0x000017ED, 0x2000017F, 0x000017EF,
+    0x0000017F, 0x000017F1, 0x000017F2, 0x000017F3, 0x000017F4, 0x000017F5, 0x000017F6, 0x000017F7,
+    0x000017F8, 0x000017F9, 0x000017FA, 0x000017FB, 0x000017FC, 0x000017FD, 0x000017FE, 0x000017FF,
+    0x00000018, 0x00000181, 0x00000182, 0x00000183, 0x00000184, 0x00000185, 0x00000186, 0x00000187,
+    0x00800019, 0x00000189, 0x0000018A, 0x0000018B, 0x0000018C, 0x0000018D, 0x0000018E, 0x0000018F,
+    0x00000181, 0x00010182, 0x00001812, 0x00001813, 0x00001814, 0x00001815, 0x00001816, 0x00001817,
+    0x00001818, 0x00001819, 0x0000181A, 0x0000181B, 0x0000181C, 0x0000181D, 0x0000181E, 0x0000181F,
+    0x00000182, 0x00001821, 0x00020183, 0x00001823, 0x00001824, 0x00001825, 0x00001826, 0x00001827,
+    0x00001828, 0x00001829, 0x0000182A, 0x0000182B, 0x0000182C, 0x0000182D, 0x0000182E, 0x0000182F,
+    0x00000183, 0x00001831, 0x00001832, 0x00040184, 0x00001834, 0x00001835, 0x00001836, 0x00001837,
+    0x00001838, 0x00001839, 0x0000183A, 0x0000183B, 0x0000183C, 0x0000183D, 0x0000183E, 0x0000183F,
+    0x00000184, 0x00001841, 0x00001842, 0x00001843, 0x00080185, 0x00001845, 0x00001846, 0x00001847,
+    0x00001848, 0x00001849, 0x0000184A, 0x0000184B, 0x0000184C, 0x0000184D, 0x0000184E, 0x0000184F,
+    0x00000185, 0x00001851, 0x00001852, 0x00001853, 0x00001854, 0x00100186, 0x00001856, 0x00001857,
+    0x00001858, 0x00001859, 0x0000185A, 0x0000185B, 0x0000185C, 0x0000185D, 0x0000185E, 0x0000185F,
+    0x00000186, 0x00001861, 0x00001862, 0x00001863, 0x00001864, 0x00001865, 0x00200187, 0x00001867,
+    0x00001868, 0x00001869, 0x0000186A, 0x0000186B, 0x0000186C, 0x0000186D, 0x0000186E, 0x0000186F,
+    0x00000187, 0x00001871, 0x00001872, 0x00001873, 0x00001874, 0x00001875, 0x00001876, 0x00400188,
+    0x00001878, 0x00001879, 0x0000187A, 0x0000187B, 0x0000187C, 0x0000187D, 0x0000187E, 0x0000187F,
+    0x00800019, 0x00800191, 0x00800192, 0x00800193, 0x00800194, 0x00800195, 0x00800196, 0x00800197,
+    0x00800189, 0x00800199, 0x0080019A, 0x0080019B, 0x0080019C, 0x0080019D, 0x0080019E, 0x0080019F,
+    0x00000189, 0x00001891, 0x00001892, 0x00001893, 0x00001894, 0x00001895, 0x00001896, 0x00001897,
+    0x00001898, 0x0100018A, 0x0000189A, 0x0000189B, 0x0000189C, 0x0000189D, 0x0000189E, 0x0000189F,
+    0x0000018A, 0x000018A1, 0x000018A2, 0x000018A3, 0x000018A4, 0x000018A5, 0x000018A6, 0x000018A7,
+    0x000018A8, 0x000018A9, 0x8200018B, 0x000018AB, 0x000018AC, 0x000018AD, 0x000018AE, 0x000018AF,
+    0x0000018B, 0x000018B1, 0x000018B2, 0x000018B3, 0x000018B4, 0x000018B5, 0x000018B6, 0x000018B7,
+    0x000018B8, 0x000018B9, 0x000018BA, 0x0400018C, 0x000018BC, 0x000018BD, 0x000018BE, 0x000018BF,
+    0x0000018C, 0x000018C1, 0x000018C2, 0x000018C3, 0x000018C4, 0x000018C5, 0x000018C6, 0x000018C7,
+    0x000018C8, 0x000018C9, 0x000018CA, 0x000018CB, 0x0800018D, 0x000018CD, 0x000018CE, 0x000018CF,
+    0x0000018D, 0x000018D1, 0x000018D2, 0x000018D3, 0x000018D4, 0x000018D5, 0x000018D6, 0x000018D7,
+    0x000018D8, 0x000018D9, 0x000018DA, 0x000018DB, 0x000018DC, 0x1000018E, 0x000018DE, 0x000018DF,
+    0x0000018E, 0x000018E1, 0x000018E2, 0x000018E3, 0x000018E4, 0x000018E5, 0x000018E6, 0x000018E7,
+    0x000018E8, 0x000018E9, 0x000018EA, 0x000018EB, 0x000018EC, 0x000018ED, 0x2000018F, 0x000018EF,
+    0x0000018F, 0x000018F1, 0x000018F2, 0x000018F3, 0x000018F4, 0x000018F5, 0x000018F6, 0x000018F7,
+    0x000018F8, 0x000018F9, 0x000018FA, 0x000018FB, 0x000018FC, 0x000018FD, 0x000018FE, 0x000018FF,
+    0x00000019, 0x00000191, 0x00000192, 0x00000193, 0x00000194, 0x00000195, 0x00000196, 0x00000197,
+    0x00000198, 0x0100001A, 0x0000019A, 0x0000019B, 0x0000019C, 0x0000019D, 0x0000019E, 0x0000019F,
+    0x00000191, 0x00010192, 0x00001912, 0x00001913, 0x00001914, 0x00001915, 0x00001916, 0x00001917,
+    0x00001918, 0x00001919, 0x0000191A, 0x0000191B, 0x0000191C, 0x0000191D, 0x0000191E, 0x0000191F,
+    0x00000192, 0x00001921, 0x00020193, 0x00001923, 0x00001924, 0x00001925, 0x00001926, 0x00001927,
+    0x00001928, 0x00001929, 0x0000192A, 0x0000192B, 0x0000192C, 0x0000192D, 0x0000192E, 0x0000192F,
+    0x00000193, 0x00001931, 0x00001932, 0x00040194, 0x00001934, 0x00001935, 0x00001936, 0x00001937,
+    0x00001938, 0x00001939, 0x0000193A, 0x0000193B, 0x0000193C, 0x0000193D, 0x0000193E, 0x0000193F,
+    0x00000194, 0x00001941, 0x00001942, 0x00001943, 0x00080195, 0x00001945, 0x00001946, 0x00001947,
+    0x00001948, 0x00001949, 0x0000194A, 0x0000194B, 0x0000194C, 0x0000194D, 0x0000194E, 0x0000194F,
+    0x00000195, 0x00001951, 0x00001952, 0x00001953, 0x00001954, 0x00100196, 0x00001956, 0x00001957,
+    0x00001958, 0x00001959, 0x0000195A, 0x0000195B, 0x0000195C, 0x0000195D, 0x0000195E, 0x0000195F,
+    0x00000196, 0x00001961, 0x00001962, 0x00001963, 0x00001964, 0x00001965, 0x00200197, 0x00001967,
+    0x00001968, 0x00001969, 0x0000196A, 0x0000196B, 0x0000196C, 0x0000196D, 0x0000196E, 0x0000196F,
+    0x00000197, 0x00001971, 0x00001972, 0x00001973, 0x00001974, 0x00001975, 0x00001976, 0x00400198,
+    0x00001978, 0x00001979, 0x0000197A, 0x0000197B, 0x0000197C, 0x0000197D, 0x0000197E, 0x0000197F,
+    0x00000198, 0x00001981, 0x00001982, 0x00001983, 0x00001984, 0x00001985, 0x00001986, 0x00001987,
+    0x00800199, 0x00001989, 0x0000198A, 0x0000198B, 0x0000198C, 0x0000198D, 0x0000198E, 0x0000198F,
+    0x0100001A, 0x010001A1, 0x010001A2, 0x010001A3, 0x010001A4, 0x010001A5, 0x010001A6, 0x010001A7,
+    0x010001A8, 0x0100019A, 0x010001AA, 0x010001AB, 0x010001AC, 0x010001AD, 0x010001AE, 0x010001AF,
+    0x0000019A, 0x000019A1, 0x000019A2, 0x000019A3, 0x000019A4, 0x000019A5, 0x000019A6, 0x000019A7,
+    0x000019A8, 0x000019A9, 0x8200019B, 0x000019AB, 0x000019AC, 0x000019AD, 0x000019AE, 0x000019AF,
+    0x0000019B, 0x000019B1, 0x000019B2, 0x000019B3, 0x000019B4, 0x000019B5, 0x000019B6, 0x000019B7,
+    0x000019B8, 0x000019B9, 0x000019BA, 0x0400019C, 0x000019BC, 0x000019BD, 0x000019BE, 0x000019BF,
+    0x0000019C, 0x000019C1, 0x000019C2, 0x000019C3, 0x000019C4, 0x000019C5, 0x000019C6, 0x000019C7,
+    0x000019C8, 0x000019C9, 0x000019CA, 0x000019CB, 0x0800019D, 0x000019CD, 0x000019CE, 0x000019CF,
+    0x0000019D, 0x000019D1, 0x000019D2, 0x000019D3, 0x000019D4, 0x000019D5, 0x000019D6, 0x000019D7,
+    0x000019D8, 0x000019D9, 0x000019DA, 0x000019DB, 0x000019DC, 0x1000019E, 0x000019DE, 0x000019DF,
+    0x0000019E, 0x000019E1, 0x000019E2, 0x000019E3, 0x000019E4, 0x000019E5, 0x000019E6, 0x000019E7,
+    0x000019E8, 0x000019E9, 0x000019EA, 0x000019EB, 0x000019EC, 0x000019ED, 0x2000019F, 0x000019EF,
+    0x0000019F, 0x000019F1, 0x000019F2, 0x000019F3, 0x000019F4, 0x000019F5, 0x000019F6, 0x000019F7,
+    0x000019F8, 0x000019F9, 0x000019FA, 0x000019FB, 0x000019FC, 0x000019FD, 0x000019FE, 0x000019FF,
+    0x0000001A, 0x000001A1, 0x000001A2, 0x000001A3, 0x000001A4, 0x000001A5, 0x000001A6, 0x000001A7,
+    0x000001A8, 0x000001A9, 0x8200001B, 0x000001AB, 0x000001AC, 0x000001AD, 0x000001AE, 0x000001AF,
+    0x000001A1, 0x000101A2, 0x00001A12, 0x00001A13, 0x00001A14, 0x00001A15, 0x00001A16, 0x00001A17,
+    0x00001A18, 0x00001A19, 0x00001A1A, 0x00001A1B, 0x00001A1C, 0x00001A1D, 0x00001A1E, 0x00001A1F,
+    0x000001A2, 0x00001A21, 0x000201A3, 0x00001A23, 0x00001A24, 0x00001A25, 0x00001A26, 0x00001A27,
+    0x00001A28, 0x00001A29, 0x00001A2A, 0x00001A2B, 0x00001A2C, 0x00001A2D, 0x00001A2E, 0x00001A2F,
+    0x000001A3, 0x00001A31, 0x00001A32, 0x000401A4, 0x00001A34, 0x00001A35, 0x00001A36, 0x00001A37,
+    0x00001A38, 0x00001A39, 0x00001A3A, 0x00001A3B, 0x00001A3C, 0x00001A3D, 0x00001A3E, 0x00001A3F,
+    0x000001A4, 0x00001A41, 0x00001A42, 0x00001A43, 0x000801A5, 0x00001A45, 0x00001A46, 0x00001A47,
+    0x00001A48, 0x00001A49, 0x00001A4A, 0x00001A4B, 0x00001A4C, 0x00001A4D, 0x00001A4E, 0x00001A4F,
+    0x000001A5, 0x00001A51, 0x00001A52, 0x00001A53, 0x00001A54, 0x001001A6, 0x00001A56, 0x00001A57,
+    0x00001A58, 0x00001A59, 0x00001A5A, 0x00001A5B, 0x00001A5C, 0x00001A5D, 0x00001A5E, 0x00001A5F,
+    0x000001A6, 0x00001A61, 0x00001A62, 0x00001A63, 0x00001A64, 0x00001A65, 0x002001A7, 0x00001A67,
+    0x00001A68, 0x00001A69, 0x00001A6A, 0x00001A6B, 0x00001A6C, 0x00001A6D, 0x00001A6E, 0x00001A6F,
+    0x000001A7, 0x00001A71, 0x00001A72, 0x00001A73, 0x00001A74, 0x00001A75, 0x00001A76, 0x004001A8,
+    0x00001A78, 0x00001A79, 0x00001A7A, 0x00001A7B, 0x00001A7C, 0x00001A7D, 0x00001A7E, 0x00001A7F,
+    0x000001A8, 0x00001A81, 0x00001A82, 0x00001A83, 0x00001A84, 0x00001A85, 0x00001A86, 0x00001A87,
+    0x008001A9, 0x00001A89, 0x00001A8A, 0x00001A8B, 0x00001A8C, 0x00001A8D, 0x00001A8E, 0x00001A8F,
+    0x000001A9, 0x00001A91, 0x00001A92, 0x00001A93, 0x00001A94, 0x00001A95, 0x00001A96, 0x00001A97,
+    0x00001A98, 0x010001AA, 0x00001A9A, 0x00001A9B, 0x00001A9C, 0x00001A9D, 0x00001A9E, 0x00001A9F,
+    0x8200001B, 0x820001B1, 0x820001B2, 0x820001B3, 0x820001B4, 0x820001B5, 0x820001B6, 0x820001B7,
+    0x820001B8, 0x820001B9, 0x820001AB, 0x820001BB, 0x820001BC, 0x820001BD, 0x820001BE, 0x820001BF,
+    0x000001AB, 0x00001AB1, 0x00001AB2, 0x00001AB3, 0x00001AB4, 0x00001AB5, 0x00001AB6, 0x00001AB7,
+    0x00001AB8, 0x00001AB9, 0x00001ABA, 0x040001AC, 0x00001ABC, 0x00001ABD, 0x00001ABE, 0x00001ABF,
+    0x000001AC, 0x00001AC1, 0x00001AC2, 0x00001AC3, 0x00001AC4, 0x00001AC5, 0x00001AC6, 0x00001AC7,
+    0x00001AC8, 0x00001AC9, 0x00001ACA, 0x00001ACB, 0x080001AD, 0x00001ACD, 0x00001ACE, 0x00001ACF,
+    0x000001AD, 0x00001AD1, 0x00001AD2, 0x00001AD3, 0x00001AD4, 0x00001AD5, 0x00001AD6, 0x00001AD7,
+    0x00001AD8, 0x00001AD9, 0x00001ADA, 0x00001ADB, 0x00001ADC, 0x100001AE, 0x00001ADE, 0x00001ADF,
+    0x000001AE, 0x00001AE1, 0x00001AE2, 0x00001AE3, 0x00001AE4, 0x00001AE5, 0x00001AE6, 0x00001AE7,
+    0x00001AE8, 0x00001AE9, 0x00001AEA, 0x00001AEB, 0x00001AEC, 0x00001AED, 0x200001AF, 0x00001AEF,
+    0x000001AF, 0x00001AF1, 0x00001AF2, 0x00001AF3, 0x00001AF4, 0x00001AF5, 0x00001AF6, 0x00001AF7,
+    0x00001AF8, 0x00001AF9, 0x00001AFA, 0x00001AFB, 0x00001AFC, 0x00001AFD, 0x00001AFE, 0x00001AFF,
+    0x0000001B, 0x000001B1, 0x000001B2, 0x000001B3, 0x000001B4, 0x000001B5, 0x000001B6, 0x000001B7,
+    0x000001B8, 0x000001B9, 0x000001BA, 0x0400001C, 0x000001BC, 0x000001BD, 0x000001BE, 0x000001BF,
+    0x000001B1, 0x000101B2, 0x00001B12, 0x00001B13, 0x00001B14, 0x00001B15, 0x00001B16, 0x00001B17,
+    0x00001B18, 0x00001B19, 0x00001B1A, 0x00001B1B, 0x00001B1C, 0x00001B1D, 0x00001B1E, 0x00001B1F,
+    0x000001B2, 0x00001B21, 0x000201B3, 0x00001B23, 0x00001B24, 0x00001B25, 0x00001B26, 0x00001B27,
+    0x00001B28, 0x00001B29, 0x00001B2A, 0x00001B2B, 0x00001B2C, 0x00001B2D, 0x00001B2E, 0x00001B2F,
+    0x000001B3, 0x00001B31, 0x00001B32, 0x000401B4, 0x00001B34, 0x00001B35, 0x00001B36, 0x00001B37,
+    0x00001B38, 0x00001B39, 0x00001B3A, 0x00001B3B, 0x00001B3C, 0x00001B3D, 0x00001B3E, 0x00001B3F,
+    0x000001B4, 0x00001B41, 0x00001B42, 0x00001B43, 0x000801B5, 0x00001B45, 0x00001B46, 0x00001B47,
+    0x00001B48, 0x00001B49, 0x00001B4A, 0x00001B4B, 0x00001B4C, 0x00001B4D, 0x00001B4E, 0x00001B4F,
+    0x000001B5, 0x00001B51, 0x00001B52, 0x00001B53, 0x00001B54, 0x001001B6, 0x00001B56, 0x00001B57,
+    0x00001B58, 0x00001B59, 0x00001B5A, 0x00001B5B, 0x00001B5C, 0x00001B5D, 0x00001B5E, 0x00001B5F,
+    0x000001B6, 0x00001B61, 0x00001B62, 0x00001B63, 0x00001B64, 0x00001B65, 0x002001B7, 0x00001B67,
+    0x00001B68, 0x00001B69, 0x00001B6A, 0x00001B6B, 0x00001B6C, 0x00001B6D, 0x00001B6E, 0x00001B6F,
+    0x000001B7, 0x00001B71, 0x00001B72, 0x00001B73, 0x00001B74, 0x00001B75, 0x00001B76, 0x004001B8,
+    0x00001B78, 0x00001B79, 0x00001B7A, 0x00001B7B, 0x00001B7C, 0x00001B7D, 0x00001B7E, 0x00001B7F,
+    0x000001B8, 0x00001B81, 0x00001B82, 0x00001B83, 0x00001B84, 0x00001B85, 0x00001B86, 0x00001B87,
+    0x008001B9, 0x00001B89, 0x00001B8A, 0x00001B8B, 0x00001B8C, 0x00001B8D, 0x00001B8E, 0x00001B8F,
+    0x000001B9, 0x00001B91, 0x00001B92, 0x00001B93, 0x00001B94, 0x00001B95, 0x00001B96, 0x00001B97,
+    0x00001B98, 0x010001BA, 0x00001B9A, 0x00001B9B, 0x00001B9C, 0x00001B9D, 0x00001B9E, 0x00001B9F,
+    0x000001BA, 0x00001BA1, 0x00001BA2, 0x00001BA3, 0x00001BA4, 0x00001BA5, 0x00001BA6, 0x00001BA7,
+    0x00001BA8, 0x00001BA9, 0x820001BB, 0x00001BAB, 0x00001BAC, 0x00001BAD, 0x00001BAE, 0x00001BAF,
+    0x0400001C, 0x040001C1, 0x040001C2, 0x040001C3, 0x040001C4, 0x040001C5, 0x040001C6, 0x040001C7,
+    0x040001C8, 0x040001C9, 0x040001CA, 0x040001BC, 0x040001CC, 0x040001CD, 0x040001CE, 0x040001CF,
+    0x000001BC, 0x00001BC1, 0x00001BC2, 0x00001BC3, 0x00001BC4, 0x00001BC5, 0x00001BC6, 0x00001BC7,
+    0x00001BC8, 0x00001BC9, 0x00001BCA, 0x00001BCB, 0x080001BD, 0x00001BCD, 0x00001BCE, 0x00001BCF,
+    0x000001BD, 0x00001BD1, 0x00001BD2, 0x00001BD3, 0x00001BD4, 0x00001BD5, 0x00001BD6, 0x00001BD7,
+    0x00001BD8, 0x00001BD9, 0x00001BDA, 0x00001BDB, 0x00001BDC, 0x100001BE, 0x00001BDE, 0x00001BDF,
+    0x000001BE, 0x00001BE1, 0x00001BE2, 0x00001BE3, 0x00001BE4, 0x00001BE5, 0x00001BE6, 0x00001BE7,
+    0x00001BE8, 0x00001BE9, 0x00001BEA, 0x00001BEB, 0x00001BEC, 0x00001BED, 0x200001BF, 0x00001BEF,
+    0x000001BF, 0x00001BF1, 0x00001BF2, 0x00001BF3, 0x00001BF4, 0x00001BF5, 0x00001BF6, 0x00001BF7,
+    0x00001BF8, 0x00001BF9, 0x00001BFA, 0x00001BFB, 0x00001BFC, 0x00001BFD, 0x00001BFE, 0x00001BFF,
+    0x0000001C, 0x000001C1, 0x000001C2, 0x000001C3, 0x000001C4, 0x000001C5, 0x000001C6, 0x000001C7,
+    0x000001C8, 0x000001C9, 0x000001CA, 0x000001CB, 0x0800001D, 0x000001CD, 0x000001CE, 0x000001CF,
+    0x000001C1, 0x000101C2, 0x00001C12, 0x00001C13, 0x00001C14, 0x00001C15, 0x00001C16, 0x00001C17,
+    0x00001C18, 0x00001C19, 0x00001C1A, 0x00001C1B, 0x00001C1C, 0x00001C1D, 0x00001C1E, 0x00001C1F,
+    0x000001C2, 0x00001C21, 0x000201C3, 0x00001C23, 0x00001C24, 0x00001C25, 0x00001C26, 0x00001C27,
+    0x00001C28, 0x00001C29, 0x00001C2A, 0x00001C2B, 0x00001C2C, 0x00001C2D, 0x00001C2E, 0x00001C2F,
+    0x000001C3, 0x00001C31, 0x00001C32, 0x000401C4, 0x00001C34, 0x00001C35, 0x00001C36, 0x00001C37,
+    0x00001C38, 0x00001C39, 0x00001C3A, 0x00001C3B, 0x00001C3C, 0x00001C3D, 0x00001C3E, 0x00001C3F,
+    0x000001C4, 0x00001C41, 0x00001C42, 0x00001C43, 0x000801C5, 0x00001C45, 0x00001C46, 0x00001C47,
+    0x00001C48, 0x00001C49, 0x00001C4A, 0x00001C4B, 0x00001C4C, 0x00001C4D, 0x00001C4E, 0x00001C4F,
+    0x000001C5, 0x00001C51, 0x00001C52, 0x00001C53, 0x00001C54, 0x001001C6, 0x00001C56, 0x00001C57,
+    0x00001C58, 0x00001C59, 0x00001C5A, 0x00001C5B, 0x00001C5C, 0x00001C5D, 0x00001C5E, 0x00001C5F,
+    0x000001C6, 0x00001C61, 0x00001C62, 0x00001C63, 0x00001C64, 0x00001C65, 0x002001C7, 0x00001C67,
+    0x00001C68, 0x00001C69, 0x00001C6A, 0x00001C6B, 0x00001C6C, 0x00001C6D, 0x00001C6E, 0x00001C6F,
+    0x000001C7, 0x00001C71, 0x00001C72, 0x00001C73, 0x00001C74, 0x00001C75, 0x00001C76, 0x004001C8,
+    0x00001C78, 0x00001C79, 0x00001C7A, 0x00001C7B, 0x00001C7C, 0x00001C7D, 0x00001C7E, 0x00001C7F,
+    0x000001C8, 0x00001C81, 0x00001C82, 0x00001C83, 0x00001C84, 0x00001C85, 0x00001C86, 0x00001C87,
+    0x008001C9, 0x00001C89, 0x00001C8A, 0x00001C8B, 0x00001C8C, 0x00001C8D, 0x00001C8E, 0x00001C8F,
+    0x000001C9, 0x00001C91, 0x00001C92, 0x00001C93, 0x00001C94, 0x00001C95, 0x00001C96, 0x00001C97,
+    0x00001C98, 0x010001CA, 0x00001C9A, 0x00001C9B, 0x00001C9C, 0x00001C9D, 0x00001C9E, 0x00001C9F,
+    0x000001CA, 0x00001CA1, 0x00001CA2, 0x00001CA3, 0x00001CA4, 0x00001CA5, 0x00001CA6, 0x00001CA7,
+    0x00001CA8, 0x00001CA9, 0x820001CB, 0x00001CAB, 0x00001CAC, 0x00001CAD, 0x00001CAE, 0x00001CAF,
+    0x000001CB, 0x00001CB1, 0x00001CB2, 0x00001CB3, 0x00001CB4, 0x00001CB5, 0x00001CB6, 0x00001CB7,
+    0x00001CB8, 0x00001CB9, 0x00001CBA, 0x040001CC, 0x00001CBC, 0x00001CBD, 0x00001CBE, 0x00001CBF,
+    0x0800001D, 0x080001D1, 0x080001D2, 0x080001D3, 0x080001D4, 0x080001D5, 0x080001D6, 0x080001D7,
+    0x080001D8, 0x080001D9, 0x080001DA, 0x080001DB, 0x080001CD, 0x080001DD, 0x080001DE, 0x080001DF,
+    0x000001CD, 0x00001CD1, 0x00001CD2, 0x00001CD3, 0x00001CD4, 0x00001CD5, 0x00001CD6, 0x00001CD7,
+    0x00001CD8, 0x00001CD9, 0x00001CDA, 0x00001CDB, 0x00001CDC, 0x100001CE, 0x00001CDE, 0x00001CDF,
+    0x000001CE, 0x00001CE1, 0x00001CE2, 0x00001CE3, 0x00001CE4, 0x00001CE5, 0x00001CE6, 0x00001CE7,
+    0x00001CE8, 0x00001CE9, 0x00001CEA, 0x00001CEB, 0x00001CEC, 0x00001CED, 0x200001CF, 0x00001CEF,
+    0x000001CF, 0x00001CF1, 0x00001CF2, 0x00001CF3, 0x00001CF4, 0x00001CF5, 0x00001CF6, 0x00001CF7,
+    0x00001CF8, 0x00001CF9, 0x00001CFA, 0x00001CFB, 0x00001CFC, 0x00001CFD, 0x00001CFE, 0x00001CFF,
+    0x0000001D, 0x000001D1, 0x000001D2, 0x000001D3, 0x000001D4, 0x000001D5, 0x000001D6, 0x000001D7,
+    0x000001D8, 0x000001D9, 0x000001DA, 0x000001DB, 0x000001DC, 0x1000001E, 0x000001DE, 0x000001DF,
+    0x000001D1, 0x000101D2, 0x00001D12, 0x00001D13, 0x00001D14, 0x00001D15, 0x00001D16, 0x00001D17,
+    0x00001D18, 0x00001D19, 0x00001D1A, 0x00001D1B, 0x00001D1C, 0x00001D1D, 0x00001D1E, 0x00001D1F,
+    0x000001D2, 0x00001D21, 0x000201D3, 0x00001D23, 0x00001D24, 0x00001D25, 0x00001D26, 0x00001D27,
+    0x00001D28, 0x00001D29, 0x00001D2A, 0x00001D2B, 0x00001D2C, 0x00001D2D, 0x00001D2E, 0x00001D2F,
+    0x000001D3, 0x00001D31, 0x00001D32, 0x000401D4, 0x00001D34, 0x00001D35, 0x00001D36, 0x00001D37,
+    0x00001D38, 0x00001D39, 0x00001D3A, 0x00001D3B, 0x00001D3C, 0x00001D3D, 0x00001D3E, 0x00001D3F,
+    0x000001D4, 0x00001D41, 0x00001D42, 0x00001D43, 0x000801D5, 0x00001D45, 0x00001D46, 0x00001D47,
+    0x00001D48, 0x00001D49, 0x00001D4A, 0x00001D4B, 0x00001D4C, 0x00001D4D, 0x00001D4E, 0x00001D4F,
+    0x000001D5, 0x00001D51, 0x00001D52, 0x00001D53, 0x00001D54, 0x001001D6, 0x00001D56, 0x00001D57,
+    0x00001D58, 0x00001D59, 0x00001D5A, 0x00001D5B, 0x00001D5C, 0x00001D5D, 0x00001D5E, 0x00001D5F,
+    0x000001D6, 0x00001D61, 0x00001D62, 0x00001D63, 0x00001D64, 0x00001D65, 0x002001D7, 0x00001D67,
+    0x00001D68, 0x00001D69, 0x00001D6A, 0x00001D6B, 0x00001D6C, 0x00001D6D, 0x00001D6E, 0x00001D6F,
+    0x000001D7, 0x00001D71, 0x00001D72, 0x00001D73, 0x00001D74, 0x00001D75, 0x00001D76, 0x004001D8,
+    0x00001D78, 0x00001D79, 0x00001D7A, 0x00001D7B, 0x00001D7C, 0x00001D7D, 0x00001D7E, 0x00001D7F,
+    0x000001D8, 0x00001D81, 0x00001D82, 0x00001D83, 0x00001D84, 0x00001D85, 0x00001D86, 0x00001D87,
+    0x008001D9, 0x00001D89, 0x00001D8A, 0x00001D8B, 0x00001D8C, 0x00001D8D, 0x00001D8E, 0x00001D8F,
+    0x000001D9, 0x00001D91, 0x00001D92, 0x00001D93, 0x00001D94, 0x00001D95, 0x00001D96, 0x00001D97,
+    0x00001D98, 0x010001DA, 0x00001D9A, 0x00001D9B, 0x00001D9C, 0x00001D9D, 0x00001D9E, 0x00001D9F,
+    0x000001DA, 0x00001DA1, 0x00001DA2, 0x00001DA3, 0x00001DA4, 0x00001DA5, 0x00001DA6, 0x00001DA7,
+    0x00001DA8, 0x00001DA9, 0x820001DB, 0x00001DAB, 0x00001DAC, 0x00001DAD, 0x00001DAE, 0x00001DAF,
+    0x000001DB, 0x00001DB1, 0x00001DB2, 0x00001DB3, 0x00001DB4, 0x00001DB5, 0x00001DB6, 0x00001DB7,
+    0x00001DB8, 0x00001DB9, 0x00001DBA, 0x040001DC, 0x00001DBC, 0x00001DBD, 0x00001DBE, 0x00001DBF,
+    0x000001DC, 0x00001DC1, 0x00001DC2, 0x00001DC3, 0x00001DC4, 0x00001DC5, 0x00001DC6, 0x00001DC7,
+    0x00001DC8, 0x00001DC9, 0x00001DCA, 0x00001DCB, 0x080001DD, 0x00001DCD, 0x00001DCE, 0x00001DCF,
+    0x1000001E, 0x100001E1, 0x100001E2, 0x100001E3, 0x100001E4, 0x100001E5, 0x100001E6, 0x100001E7,
+    0x100001E8, 0x100001E9, 0x100001EA, 0x100001EB, 0x100001EC, 0x100001DE, 0x100001EE, 0x100001EF,
+    0x000001DE, 0x00001DE1, 0x00001DE2, 0x00001DE3, 0x00001DE4, 0x00001DE5, 0x00001DE6, 0x00001DE7,
+    0x00001DE8, 0x00001DE9, 0x00001DEA, 0x00001DEB, 0x00001DEC, 0x00001DED, 0x200001DF, 0x00001DEF,
+    0x000001DF, 0x00001DF1, 0x00001DF2, 0x00001DF3, 0x00001DF4, 0x00001DF5, 0x00001DF6, 0x00001DF7,
+    0x00001DF8, 0x00001DF9, 0x00001DFA, 0x00001DFB, 0x00001DFC, 0x00001DFD, 0x00001DFE, 0x00001DFF,
+    0x0000001E, 0x000001E1, 0x000001E2, 0x000001E3, 0x000001E4, 0x000001E5, 0x000001E6, 0x000001E7,
+    0x000001E8, 0x000001E9, 0x000001EA, 0x000001EB, 0x000001EC, 0x000001ED, 0x2000001F, 0x000001EF,
+    0x000001E1, 0x000101E2, 0x00001E12, 0x00001E13, 0x00001E14, 0x00001E15, 0x00001E16, 0x00001E17,
+    0x00001E18, 0x00001E19, 0x00001E1A, 0x00001E1B, 0x00001E1C, 0x00001E1D, 0x00001E1E, 0x00001E1F,
+    0x000001E2, 0x00001E21, 0x000201E3, 0x00001E23, 0x00001E24, 0x00001E25, 0x00001E26, 0x00001E27,
+    0x00001E28, 0x00001E29, 0x00001E2A, 0x00001E2B, 0x00001E2C, 0x00001E2D, 0x00001E2E, 0x00001E2F,
+    0x000001E3, 0x00001E31, 0x00001E32, 0x000401E4, 0x00001E34, 0x00001E35, 0x00001E36, 0x00001E37,
+    0x00001E38, 0x00001E39, 0x00001E3A, 0x00001E3B, 0x00001E3C, 0x00001E3D, 0x00001E3E, 0x00001E3F,
+    0x000001E4, 0x00001E41, 0x00001E42, 0x00001E43, 0x000801E5, 0x00001E45, 0x00001E46, 0x00001E47,
+    0x00001E48, 0x00001E49, 0x00001E4A, 0x00001E4B, 0x00001E4C, 0x00001E4D, 0x00001E4E, 0x00001E4F,
+    0x000001E5, 0x00001E51, 0x00001E52, 0x00001E53, 0x00001E54, 0x001001E6, 0x00001E56, 0x00001E57,
+    0x00001E58, 0x00001E59, 0x00001E5A, 0x00001E5B, 0x00001E5C, 0x00001E5D, 0x00001E5E, 0x00001E5F,
+    0x000001E6, 0x00001E61, 0x00001E62, 0x00001E63, 0x00001E64, 0x00001E65, 0x002001E7, 0x00001E67,
+    0x00001E68, 0x00001E69, 0x00001E6A, 0x00001E6B, 0x00001E6C, 0x00001E6D, 0x00001E6E, 0x00001E6F,
+    0x000001E7, 0x00001E71, 0x00001E72, 0x00001E73, 0x00001E74, 0x00001E75, 0x00001E76, 0x004001E8,
+    0x00001E78, 0x00001E79, 0x00001E7A, 0x00001E7B, 0x00001E7C, 0x00001E7D, 0x00001E7E, 0x00001E7F,
+    0x000001E8, 0x00001E81, 0x00001E82, 0x00001E83, 0x00001E84, 0x00001E85, 0x00001E86, 0x00001E87,
+    0x008001E9, 0x00001E89, 0x00001E8A, 0x00001E8B, 0x00001E8C, 0x00001E8D, 0x00001E8E, 0x00001E8F,
+    0x000001E9, 0x00001E91, 0x00001E92, 0x00001E93, 0x00001E94, 0x00001E95, 0x00001E96, 0x00001E97,
+    0x00001E98, 0x010001EA, 0x00001E9A, 0x00001E9B, 0x00001E9C, 0x00001E9D, 0x00001E9E, 0x00001E9F,
+    0x000001EA, 0x00001EA1, 0x00001EA2, 0x00001EA3, 0x00001EA4, 0x00001EA5, 0x00001EA6, 0x00001EA7,
+    0x00001EA8, 0x00001EA9, 0x820001EB, 0x00001EAB, 0x00001EAC, 0x00001EAD, 0x00001EAE, 0x00001EAF,
+    0x000001EB, 0x00001EB1, 0x00001EB2, 0x00001EB3, 0x00001EB4, 0x00001EB5, 0x00001EB6, 0x00001EB7,
+    0x00001EB8, 0x00001EB9, 0x00001EBA, 0x040001EC, 0x00001EBC, 0x00001EBD, 0x00001EBE, 0x00001EBF,
+    0x000001EC, 0x00001EC1, 0x00001EC2, 0x00001EC3, 0x00001EC4, 0x00001EC5, 0x00001EC6, 0x00001EC7,
+    0x00001EC8, 0x00001EC9, 0x00001ECA, 0x00001ECB, 0x080001ED, 0x00001ECD, 0x00001ECE, 0x00001ECF,
+    0x000001ED, 0x00001ED1, 0x00001ED2, 0x00001ED3, 0x00001ED4, 0x00001ED5, 0x00001ED6, 0x00001ED7,
+    0x00001ED8, 0x00001ED9, 0x00001EDA, 0x00001EDB, 0x00001EDC, 0x100001EE, 0x00001EDE, 0x00001EDF,
+    0x2000001F, 0x200001F1, 0x200001F2, 0x200001F3, 0x200001F4, 0x200001F5, 0x200001F6, 0x200001F7,
+    0x200001F8, 0x200001F9, 0x200001FA, 0x200001FB, 0x200001FC, 0x200001FD, 0x200001EF, 0x200001FF,
+    0x000001EF, 0x00001EF1, 0x00001EF2, 0x00001EF3, 0x00001EF4, 0x00001EF5, 0x00001EF6, 0x00001EF7,
+    0x00001EF8, 0x00001EF9, 0x00001EFA, 0x00001EFB, 0x00001EFC, 0x00001EFD, 0x00001EFE, 0x00001EFF,
+    0x0000001F, 0x000001F1, 0x000001F2, 0x000001F3, 0x000001F4, 0x000001F5, 0x000001F6, 0x000001F7,
+    0x000001F8, 0x000001F9, 0x000001FA, 0x000001FB, 0x000001FC, 0x000001FD, 0x000001FE, 0x000001FF,
+    0x000001F1, 0x000101F2, 0x00001F12, 0x00001F13, 0x00001F14, 0x00001F15, 0x00001F16, 0x00001F17,
+    0x00001F18, 0x00001F19, 0x00001F1A, 0x00001F1B, 0x00001F1C, 0x00001F1D, 0x00001F1E, 0x00001F1F,
+    0x000001F2, 0x00001F21, 0x000201F3, 0x00001F23, 0x00001F24, 0x00001F25, 0x00001F26, 0x00001F27,
+    0x00001F28, 0x00001F29, 0x00001F2A, 0x00001F2B, 0x00001F2C, 0x00001F2D, 0x00001F2E, 0x00001F2F,
+    0x000001F3, 0x00001F31, 0x00001F32, 0x000401F4, 0x00001F34, 0x00001F35, 0x00001F36, 0x00001F37,
+    0x00001F38, 0x00001F39, 0x00001F3A, 0x00001F3B, 0x00001F3C, 0x00001F3D, 0x00001F3E, 0x00001F3F,
+    0x000001F4, 0x00001F41, 0x00001F42, 0x00001F43, 0x000801F5, 0x00001F45, 0x00001F46, 0x00001F47,
+    0x00001F48, 0x00001F49, 0x00001F4A, 0x00001F4B, 0x00001F4C, 0x00001F4D, 0x00001F4E, 0x00001F4F,
+    0x000001F5, 0x00001F51, 0x00001F52, 0x00001F53, 0x00001F54, 0x001001F6, 0x00001F56, 0x00001F57,
+    0x00001F58, 0x00001F59, 0x00001F5A, 0x00001F5B, 0x00001F5C, 0x00001F5D, 0x00001F5E, 0x00001F5F,
+    0x000001F6, 0x00001F61, 0x00001F62, 0x00001F63, 0x00001F64, 0x00001F65, 0x002001F7, 0x00001F67,
+    0x00001F68, 0x00001F69, 0x00001F6A, 0x00001F6B, 0x00001F6C, 0x00001F6D, 0x00001F6E, 0x00001F6F,
+    0x000001F7, 0x00001F71, 0x00001F72, 0x00001F73, 0x00001F74, 0x00001F75, 0x00001F76, 0x004001F8,
+    0x00001F78, 0x00001F79, 0x00001F7A, 0x00001F7B, 0x00001F7C, 0x00001F7D, 0x00001F7E, 0x00001F7F,
+    0x000001F8, 0x00001F81, 0x00001F82, 0x00001F83, 0x00001F84, 0x00001F85, 0x00001F86, 0x00001F87,
+    0x008001F9, 0x00001F89, 0x00001F8A, 0x00001F8B, 0x00001F8C, 0x00001F8D, 0x00001F8E, 0x00001F8F,
+    0x000001F9, 0x00001F91, 0x00001F92, 0x00001F93, 0x00001F94, 0x00001F95, 0x00001F96, 0x00001F97,
+    0x00001F98, 0x010001FA, 0x00001F9A, 0x00001F9B, 0x00001F9C, 0x00001F9D, 0x00001F9E, 0x00001F9F,
+    0x000001FA, 0x00001FA1, 0x00001FA2, 0x00001FA3, 0x00001FA4, 0x00001FA5, 0x00001FA6, 0x00001FA7,
+    0x00001FA8, 0x00001FA9, 0x820001FB, 0x00001FAB, 0x00001FAC, 0x00001FAD, 0x00001FAE, 0x00001FAF,
+    0x000001FB, 0x00001FB1, 0x00001FB2, 0x00001FB3, 0x00001FB4, 0x00001FB5, 0x00001FB6, 0x00001FB7,
+    0x00001FB8, 0x00001FB9, 0x00001FBA, 0x040001FC, 0x00001FBC, 0x00001FBD, 0x00001FBE, 0x00001FBF,
+    0x000001FC, 0x00001FC1, 0x00001FC2, 0x00001FC3, 0x00001FC4, 0x00001FC5, 0x00001FC6, 0x00001FC7,
+    0x00001FC8, 0x00001FC9, 0x00001FCA, 0x00001FCB, 0x080001FD, 0x00001FCD, 0x00001FCE, 0x00001FCF,
+    0x000001FD, 0x00001FD1, 0x00001FD2, 0x00001FD3, 0x00001FD4, 0x00001FD5, 0x00001FD6, 0x00001FD7,
+    0x00001FD8, 0x00001FD9, 0x00001FDA, 0x00001FDB, 0x00001FDC, 0x100001FE, 0x00001FDE, 0x00001FDF,
+    0x000001FE, 0x00001FE1, 0x00001FE2, 0x00001FE3, 0x00001FE4, 0x00001FE5, 0x00001FE6, 0x00001FE7,
+    0x00001FE8, 0x00001FE9, 0x00001FEA, 0x00001FEB, 0x00001FEC, 0x00001FED, 0x200001FF, 0x00001FEF,
+    0x000001FF, 0x00001FF1, 0x00001FF2, 0x00001FF3, 0x00001FF4, 0x00001FF5, 0x00001FF6, 0x00001FF7,
+    0x00001FF8, 0x00001FF9, 0x00001FFA, 0x00001FFB, 0x00001FFC, 0x00001FFD, 0x00001FFE, 0x00001FFF,
+    0x00000002, 0x00000021, 0x00020003, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027,
+    0x00000028, 0x00000029, 0x0000002A, 0x0000002B, 0x0000002C, 0x0000002D, 0x0000002E, 0x0000002F,
+    0x00000021, 0x00010022, 0x00000212, 0x00000213, 0x00000214, 0x00000215, 0x00000216, 0x00000217,
+    0x00000218, 0x00000219, 0x0000021A, 0x0000021B, 0x0000021C, 0x0000021D, 0x0000021E, 0x0000021F,
+    0x00020003, 0x00020031, 0x00020023, 0x00020033, 0x00020034, 0x00020035, 0x00020036, 0x00020037,
+    0x00020038, 0x00020039, 0x0002003A, 0x0002003B, 0x0002003C, 0x0002003D, 0x0002003E, 0x0002003F,
+    0x00000023, 0x00000231, 0x00000232, 0x00040024, 0x00000234, 0x00000235, 0x00000236, 0x00000237,
+    0x00000238, 0x00000239, 0x0000023A, 0x0000023B, 0x0000023C, 0x0000023D, 0x0000023E, 0x0000023F,
+    0x00000024, 0x00000241, 0x00000242, 0x00000243, 0x00080025, 0x00000245, 0x00000246, 0x00000247,
+    0x00000248, 0x00000249, 0x0000024A, 0x0000024B, 0x0000024C, 0x0000024D, 0x0000024E, 0x0000024F,
+    0x00000025, 0x00000251, 0x00000252, 0x00000253, 0x00000254, 0x00100026, 0x00000256, 0x00000257,
+    0x00000258, 0x00000259, 0x0000025A, 0x0000025B, 0x0000025C, 0x0000025D, 0x0000025E, 0x0000025F,
+    0x00000026, 0x00000261, 0x00000262, 0x00000263, 0x00000264, 0x00000265, 0x00200027, 0x00000267,
+    0x00000268, 0x00000269, 0x0000026A, 0x0000026B, 0x0000026C, 0x0000026D, 0x0000026E, 0x0000026F,
+    0x00000027, 0x00000271, 0x00000272, 0x00000273, 0x00000274, 0x00000275, 0x00000276, 0x00400028,
+    0x00000278, 0x00000279, 0x0000027A, 0x0000027B, 0x0000027C, 0x0000027D, 0x0000027E, 0x0000027F,
+    0x00000028, 0x00000281, 0x00000282, 0x00000283, 0x00000284, 0x00000285, 0x00000286, 0x00000287,
+    0x00800029, 0x00000289, 0x0000028A, 0x0000028B, 0x0000028C, 0x0000028D, 0x0000028E, 0x0000028F,
+    0x00000029, 0x00000291, 0x00000292, 0x00000293, 0x00000294, 0x00000295, 0x00000296, 0x00000297,
+    0x00000298, 0x0100002A, 0x0000029A, 0x0000029B, 0x0000029C, 0x0000029D, 0x0000029E, 0x0000029F,
+    0x0000002A, 0x000002A1, 0x000002A2, 0x000002A3, 0x000002A4, 0x000002A5, 0x000002A6, 0x000002A7,
+    0x000002A8, 0x000002A9, 0x8200002B, 0x000002AB, 0x000002AC, 0x000002AD, 0x000002AE, 0x000002AF,
+    0x0000002B, 0x000002B1, 0x000002B2, 0x000002B3, 0x000002B4, 0x000002B5, 0x000002B6, 0x000002B7,
+    0x000002B8, 0x000002B9, 0x000002BA, 0x0400002C, 0x000002BC, 0x000002BD, 0x000002BE, 0x000002BF,
+    0x0000002C, 0x000002C1, 0x000002C2, 0x000002C3, 0x000002C4, 0x000002C5, 0x000002C6, 0x000002C7,
+    0x000002C8, 0x000002C9, 0x000002CA, 0x000002CB, 0x0800002D, 0x000002CD, 0x000002CE, 0x000002CF,
+    0x0000002D, 0x000002D1, 0x000002D2, 0x000002D3, 0x000002D4, 0x000002D5, 0x000002D6, 0x000002D7,
+    0x000002D8, 0x000002D9, 0x000002DA, 0x000002DB, 0x000002DC, 0x1000002E, 0x000002DE, 0x000002DF,
+    0x0000002E, 0x000002E1, 0x000002E2, 0x000002E3, 0x000002E4, 0x000002E5, 0x000002E6, 0x000002E7,
+    0x000002E8, 0x000002E9, 0x000002EA, 0x000002EB, 0x000002EC, 0x000002ED, 0x2000002F, 0x000002EF,
+    0x0000002F, 0x000002F1, 0x000002F2, 0x000002F3, 0x000002F4, 0x000002F5, 0x000002F6, 0x000002F7,
+    0x000002F8, 0x000002F9, 0x000002FA, 0x000002FB, 0x000002FC, 0x000002FD, 0x000002FE, 0x000002FF,
+    0x00000021, 0x00010022, 0x00000212, 0x00000213, 0x00000214, 0x00000215, 0x00000216, 0x00000217,
+    0x00000218, 0x00000219, 0x0000021A, 0x0000021B, 0x0000021C, 0x0000021D, 0x0000021E, 0x0000021F,
+    0x00010022, 0x00010212, 0x00010222, 0x00010223, 0x00010224, 0x00010225, 0x00010226, 0x00010227,
+    0x00010228, 0x00010229, 0x0001022A, 0x0001022B, 0x0001022C, 0x0001022D, 0x0001022E, 0x0001022F,
+    0x00000212, 0x00002121, 0x00020213, 0x00002123, 0x00002124, 0x00002125, 0x00002126, 0x00002127,
+    0x00002128, 0x00002129, 0x0000212A, 0x0000212B, 0x0000212C, 0x0000212D, 0x0000212E, 0x0000212F,
+    0x00000213, 0x00002131, 0x00002132, 0x00040214, 0x00002134, 0x00002135, 0x00002136, 0x00002137,
+    0x00002138, 0x00002139, 0x0000213A, 0x0000213B, 0x0000213C, 0x0000213D, 0x0000213E, 0x0000213F,
+    0x00000214, 0x00002141, 0x00002142, 0x00002143, 0x00080215, 0x00002145, 0x00002146, 0x00002147,
+    0x00002148, 0x00002149, 0x0000214A, 0x0000214B, 0x0000214C, 0x0000214D, 0x0000214E, 0x0000214F,
+    0x00000215, 0x00002151, 0x00002152, 0x00002153, 0x00002154, 0x00100216, 0x00002156, 0x00002157,
+    0x00002158, 0x00002159, 0x0000215A, 0x0000215B, 0x0000215C, 0x0000215D, 0x0000215E, 0x0000215F,
+    0x00000216, 0x00002161, 0x00002162, 0x00002163, 0x00002164, 0x00002165, 0x00200217, 0x00002167,
+    0x00002168, 0x00002169, 0x0000216A, 0x0000216B, 0x0000216C, 0x0000216D, 0x0000216E, 0x0000216F,
+    0x00000217, 0x00002171, 0x00002172, 0x00002173, 0x00002174, 0x00002175, 0x00002176, 0x00400218,
+    0x00002178, 0x00002179, 0x0000217A, 0x0000217B, 0x0000217C, 0x0000217D, 0x0000217E, 0x0000217F,
+    0x00000218, 0x00002181, 0x00002182, 0x00002183, 0x00002184, 0x00002185, 0x00002186, 0x00002187,
+    0x00800219, 0x00002189, 0x0000218A, 0x0000218B, 0x0000218C, 0x0000218D, 0x0000218E, 0x0000218F,
+    0x00000219, 0x00002191, 0x00002192, 0x00002193, 0x00002194, 0x00002195, 0x00002196, 0x00002197,
+    0x00002198, 0x0100021A, 0x0000219A, 0x0000219B, 0x0000219C, 0x0000219D, 0x0000219E, 0x0000219F,
+    0x0000021A, 0x000021A1, 0x000021A2, 0x000021A3, 0x000021A4, 0x000021A5, 0x000021A6, 0x000021A7,
+    0x000021A8, 0x000021A9, 0x8200021B, 0x000021AB, 0x000021AC, 0x000021AD, 0x000021AE, 0x000021AF,
+    0x0000021B, 0x000021B1, 0x000021B2, 0x000021B3, 0x000021B4, 0x000021B5, 0x000021B6, 0x000021B7,
+    0x000021B8, 0x000021B9, 0x000021BA, 0x0400021C, 0x000021BC, 0x000021BD, 0x000021BE, 0x000021BF,
+    0x0000021C, 0x000021C1, 0x000021C2, 0x000021C3, 0x000021C4, 0x000021C5, 0x000021C6, 0x000021C7,
+    0x000021C8, 0x000021C9, 0x000021CA, 0x000021CB, 0x0800021D, 0x000021CD, 0x000021CE, 0x000021CF,
+    0x0000021D, 0x000021D1, 0x000021D2, 0x000021D3, 0x000021D4, 0x000021D5, 0x000021D6, 0x000021D7,
+    0x000021D8, 0x000021D9, 0x000021DA, 0x000021DB, 0x000021DC, 0x1000021E, 0x000021DE, 0x000021DF,
+    0x0000021E, 0x000021E1, 0x000021E2, 0x000021E3, 0x000021E4, 0x000021E5, 0x000021E6, 0x000021E7,
+    0x000021E8, 0x000021E9, 0x000021EA, 0x000021EB, 0x000021EC, 0x000021ED, 0x2000021F, 0x000021EF,
+    0x0000021F, 0x000021F1, 0x000021F2, 0x000021F3, 0x000021F4, 0x000021F5, 0x000021F6, 0x000021F7,
+    0x000021F8, 0x000021F9, 0x000021FA, 0x000021FB, 0x000021FC, 0x000021FD, 0x000021FE, 0x000021FF,
+    0x00020003, 0x00020031, 0x00020023, 0x00020033, 0x00020034, 0x00020035, 0x00020036, 0x00020037,
+    0x00020038, 0x00020039, 0x0002003A, 0x0002003B, 0x0002003C, 0x0002003D, 0x0002003E, 0x0002003F,
+    0x00020031, 0x00030032, 0x00020312, 0x00020313, 0x00020314, 0x00020315, 0x00020316, 0x00020317,
+    0x00020318, 0x00020319, 0x0002031A, 0x0002031B, 0x0002031C, 0x0002031D, 0x0002031E, 0x0002031F,
+    0x00020023, 0x00020231, 0x00040033, 0x00020233, 0x00020234, 0x00020235, 0x00020236, 0x00020237,
+    0x00020238, 0x00020239, 0x0002023A, 0x0002023B, 0x0002023C, 0x0002023D, 0x0002023E, 0x0002023F,
+    0x00020033, 0x00020331, 0x00020332, 0x00060034, 0x00020334, 0x00020335, 0x00020336, 0x00020337,
+    0x00020338, 0x00020339, 0x0002033A, 0x0002033B, 0x0002033C, 0x0002033D, 0x0002033E, 0x0002033F,
+    0x00020034, 0x00020341, 0x00020342, 0x00020343, 0x000A0035, 0x00020345, 0x00020346, 0x00020347,
+    0x00020348, 0x00020349, 0x0002034A, 0x0002034B, 0x0002034C, 0x0002034D, 0x0002034E, 0x0002034F,
+    0x00020035, 0x00020351, 0x00020352, 0x00020353, 0x00020354, 0x00120036, 0x00020356, 0x00020357,
+    0x00020358, 0x00020359, 0x0002035A, 0x0002035B, 0x0002035C, 0x0002035D, 0x0002035E, 0x0002035F,
+    0x00020036, 0x00020361, 0x00020362, 0x00020363, 0x00020364, 0x00020365, 0x00220037, 0x00020367,
+    0x00020368, 0x00020369, 0x0002036A, 0x0002036B, 0x0002036C, 0x0002036D, 0x0002036E, 0x0002036F,
+    0x00020037, 0x00020371, 0x00020372, 0x00020373, 0x00020374, 0x00020375, 0x00020376, 0x00420038,
+    0x00020378, 0x00020379, 0x0002037A, 0x0002037B, 0x0002037C, 0x0002037D, 0x0002037E, 0x0002037F,
+    0x00020038, 0x00020381, 0x00020382, 0x00020383, 0x00020384, 0x00020385, 0x00020386, 0x00020387,
+    0x00820039, 0x00020389, 0x0002038A, 0x0002038B, 0x0002038C, 0x0002038D, 0x0002038E, 0x0002038F,
+    0x00020039, 0x00020391, 0x00020392, 0x00020393, 0x00020394, 0x00020395, 0x00020396, 0x00020397,
+    0x00020398, 0x0102003A, 0x0002039A, 0x0002039B, 0x0002039C, 0x0002039D, 0x0002039E, 0x0002039F,
+    0x0002003A, 0x000203A1, 0x000203A2, 0x000203A3, 0x000203A4, 0x000203A5, 0x000203A6, 0x000203A7,
+    0x000203A8, 0x000203A9, 0x8202003B, 0x000203AB, 0x000203AC, 0x000203AD, 0x000203AE, 0x000203AF,
+    0x0002003B, 0x000203B1, 0x000203B2, 0x000203B3, 0x000203B4, 0x000203B5, 0x000203B6, 0x000203B7,
+    0x000203B8, 0x000203B9, 0x000203BA, 0x0402003C, 0x000203BC, 0x000203BD, 0x000203BE, 0x000203BF,
+    0x0002003C, 0x000203C1, 0x000203C2, 0x000203C3, 0x000203C4, 0x000203C5, 0x000203C6, 0x000203C7,
+    0x000203C8, 0x000203C9, 0x000203CA, 0x000203CB, 0x0802003D, 0x000203CD, 0x000203CE, 0x000203CF,
+    0x0002003D, 0x000203D1, 0x000203D2, 0x000203D3, 0x000203D4, 0x000203D5, 0x000203D6, 0x000203D7,
+    0x000203D8, 0x000203D9, 0x000203DA, 0x000203DB, 0x000203DC, 0x1002003E, 0x000203DE, 0x000203DF,
+    0x0002003E, 0x000203E1, 0x000203E2, 0x000203E3, 0x000203E4, 0x000203E5, 0x000203E6, 0x000203E7,
+    0x000203E8, 0x000203E9, 0x000203EA, 0x000203EB, 0x000203EC, 0x000203ED, 0x2002003F, 0x000203EF,
+    0x0002003F, 0x000203F1, 0x000203F2, 0x000203F3, 0x000203F4, 0x000203F5, 0x000203F6, 0x000203F7,
+    0x000203F8, 0x000203F9, 0x000203FA, 0x000203FB, 0x000203FC, 0x000203FD, 0x000203FE, 0x000203FF,
+    0x00000023, 0x00000231, 0x00000232, 0x00040024, 0x00000234, 0x00000235, 0x00000236, 0x00000237,
+    0x00000238, 0x00000239, 0x0000023A, 0x0000023B, 0x0000023C, 0x0000023D, 0x0000023E, 0x0000023F,
+    0x00000231, 0x00010232, 0x00002312, 0x00002313, 0x00002314, 0x00002315, 0x00002316, 0x00002317,
+    0x00002318, 0x00002319, 0x0000231A, 0x0000231B, 0x0000231C, 0x0000231D, 0x0000231E, 0x0000231F,
+    0x00000232, 0x00002321, 0x00020233, 0x00002323, 0x00002324, 0x00002325, 0x00002326, 0x00002327,
+    0x00002328, 0x00002329, 0x0000232A, 0x0000232B, 0x0000232C, 0x0000232D, 0x0000232E, 0x0000232F,
+    0x00040024, 0x00040241, 0x00040242, 0x00040234, 0x00040244, 0x00040245, 0x00040246, 0x00040247,
+    0x00040248, 0x00040249, 0x0004024A, 0x0004024B, 0x0004024C, 0x0004024D, 0x0004024E, 0x0004024F,
+    0x00000234, 0x00002341, 0x00002342, 0x00002343, 0x00080235, 0x00002345, 0x00002346, 0x00002347,
+    0x00002348, 0x00002349, 0x0000234A, 0x0000234B, 0x0000234C, 0x0000234D, 0x0000234E, 0x0000234F,
+    0x00000235, 0x00002351, 0x00002352, 0x00002353, 0x00002354, 0x00100236, 0x00002356, 0x00002357,
+    0x00002358, 0x00002359, 0x0000235A, 0x0000235B, 0x0000235C, 0x0000235D, 0x0000235E, 0x0000235F,
+    0x00000236, 0x00002361, 0x00002362, 0x00002363, 0x00002364, 0x00002365, 0x00200237, 0x00002367,
+    0x00002368, 0x00002369, 0x0000236A, 0x0000236B, 0x0000236C, 0x0000236D, 0x0000236E, 0x0000236F,
+    0x00000237, 0x00002371, 0x00002372, 0x00002373, 0x00002374, 0x00002375, 0x00002376, 0x00400238,
+    0x00002378, 0x00002379, 0x0000237A, 0x0000237B, 0x0000237C, 0x0000237D, 0x0000237E, 0x0000237F,
+    0x00000238, 0x00002381, 0x00002382, 0x00002383, 0x00002384, 0x00002385, 0x00002386, 0x00002387,
+    0x00800239, 0x00002389, 0x0000238A, 0x0000238B, 0x0000238C, 0x0000238D, 0x0000238E, 0x0000238F,
+    0x00000239, 0x00002391, 0x00002392, 0x00002393, 0x00002394, 0x00002395, 0x00002396, 0x00002397,
+    0x00002398, 0x0100023A, 0x0000239A, 0x0000239B, 0x0000239C, 0x0000239D, 0x0000239E, 0x0000239F,
+    0x0000023A, 0x000023A1, 0x000023A2, 0x000023A3, 0x000023A4, 0x000023A5, 0x000023A6, 0x000023A7,
+    0x000023A8, 0x000023A9, 0x8200023B, 0x000023AB, 0x000023AC, 0x000023AD, 0x000023AE, 0x000023AF,
+    0x0000023B, 0x000023B1, 0x000023B2, 0x000023B3, 0x000023B4, 0x000023B5, 0x000023B6, 0x000023B7,
+    0x000023B8, 0x000023B9, 0x000023BA, 0x0400023C, 0x000023BC, 0x000023BD, 0x000023BE, 0x000023BF,
+    0x0000023C, 0x000023C1, 0x000023C2, 0x000023C3, 0x000023C4, 0x000023C5, 0x000023C6, 0x000023C7,
+    0x000023C8, 0x000023C9, 0x000023CA, 0x000023CB, 0x0800023D, 0x000023CD, 0x000023CE, 0x000023CF,
+    0x0000023D, 0x000023D1, 0x000023D2, 0x000023D3, 0x000023D4, 0x000023D5, 0x000023D6, 0x000023D7,
+    0x000023D8, 0x000023D9, 0x000023DA, 0x000023DB, 0x000023DC, 0x1000023E, 0x000023DE, 0x000023DF,
+    0x0000023E, 0x000023E1, 0x000023E2, 0x000023E3, 0x000023E4, 0x000023E5, 0x000023E6, 0x000023E7,
+    0x000023E8, 0x000023E9, 0x000023EA, 0x000023EB, 0x000023EC, 0x000023ED, 0x2000023F, 0x000023EF,
+    0x0000023F, 0x000023F1, 0x000023F2, 0x000023F3, 0x000023F4, 0x000023F5, 0x000023F6, 0x000023F7,
+    0x000023F8, 0x000023F9, 0x000023FA, 0x000023FB, 0x000023FC, 0x000023FD, 0x000023FE, 0x000023FF,
+    0x00000024, 0x00000241, 0x00000242, 0x00000243, 0x00080025, 0x00000245, 0x00000246, 0x00000247,
+    0x00000248, 0x00000249, 0x0000024A, 0x0000024B, 0x0000024C, 0x0000024D, 0x0000024E, 0x0000024F,
+    0x00000241, 0x00010242, 0x00002412, 0x00002413, 0x00002414, 0x00002415, 0x00002416, 0x00002417,
+    0x00002418, 0x00002419, 0x0000241A, 0x0000241B, 0x0000241C, 0x0000241D, 0x0000241E, 0x0000241F,
+    0x00000242, 0x00002421, 0x00020243, 0x00002423, 0x00002424, 0x00002425, 0x00002426, 0x00002427,
+    0x00002428, 0x00002429, 0x0000242A, 0x0000242B, 0x0000242C, 0x0000242D, 0x0000242E, 0x0000242F,
+    0x00000243, 0x00002431, 0x00002432, 0x00040244, 0x00002434, 0x00002435, 0x00002436, 0x00002437,
+    0x00002438, 0x00002439, 0x0000243A, 0x0000243B, 0x0000243C, 0x0000243D, 0x0000243E, 0x0000243F,
+    0x00080025, 0x00080251, 0x00080252, 0x00080253, 0x00080245, 0x00080255, 0x00080256, 0x00080257,
+    0x00080258, 0x00080259, 0x0008025A, 0x0008025B, 0x0008025C, 0x0008025D, 0x0008025E, 0x0008025F,
+    0x00000245, 0x00002451, 0x00002452, 0x00002453, 0x00002454, 0x00100246, 0x00002456, 0x00002457,
+    0x00002458, 0x00002459, 0x0000245A, 0x0000245B, 0x0000245C, 0x0000245D, 0x0000245E, 0x0000245F,
+    0x00000246, 0x00002461, 0x00002462, 0x00002463, 0x00002464, 0x00002465, 0x00200247, 0x00002467,
+    0x00002468, 0x00002469, 0x0000246A, 0x0000246B, 0x0000246C, 0x0000246D, 0x0000246E, 0x0000246F,
+    0x00000247, 0x00002471, 0x00002472, 0x00002473, 0x00002474, 0x00002475, 0x00002476, 0x00400248,
+    0x00002478, 0x00002479, 0x0000247A, 0x0000247B, 0x0000247C, 0x0000247D, 0x0000247E, 0x0000247F,
+    0x00000248, 0x00002481, 0x00002482, 0x00002483, 0x00002484, 0x00002485, 0x00002486, 0x00002487,
+    0x00800249, 0x00002489, 0x0000248A, 0x0000248B, 0x0000248C, 0x0000248D, 0x0000248E, 0x0000248F,
+    0x00000249, 0x00002491, 0x00002492, 0x00002493, 0x00002494, 0x00002495, 0x00002496, 0x00002497,
+    0x00002498, 0x0100024A, 0x0000249A, 0x0000249B, 0x0000249C, 0x0000249D, 0x0000249E, 0x0000249F,
+    0x0000024A, 0x000024A1, 0x000024A2, 0x000024A3, 0x000024A4, 0x000024A5, 0x000024A6, 0x000024A7,
+    0x000024A8, 0x000024A9, 0x8200024B, 0x000024AB, 0x000024AC, 0x000024AD, 0x000024AE, 0x000024AF,
+    0x0000024B, 0x000024B1, 0x000024B2, 0x000024B3, 0x000024B4, 0x000024B5, 0x000024B6, 0x000024B7,
+    0x000024B8, 0x000024B9, 0x000024BA, 0x0400024C, 0x000024BC, 0x000024BD, 0x000024BE, 0x000024BF,
+    0x0000024C, 0x000024C1, 0x000024C2, 0x000024C3, 0x000024C4, 0x000024C5, 0x000024C6, 0x000024C7,
+    0x000024C8, 0x000024C9, 0x000024CA, 0x000024CB, 0x0800024D, 0x000024CD, 0x000024CE, 0x000024CF,
+    0x0000024D, 0x000024D1, 0x000024D2, 0x000024D3, 0x000024D4, 0x000024D5, 0x000024D6, 0x000024D7,
+    0x000024D8, 0x000024D9, 0x000024DA, 0x000024DB, 0x000024DC, 0x1000024E, 0x000024DE, 0x000024DF,
+    0x0000024E, 0x000024E1, 0x000024E2, 0x000024E3, 0x000024E4, 0x000024E5, 0x000024E6, 0x000024E7,
+    0x000024E8, 0x000024E9, 0x000024EA, 0x000024EB, 0x000024EC, 0x000024ED, 0x2000024F, 0x000024EF,
+    0x0000024F, 0x000024F1, 0x000024F2, 0x000024F3, 0x000024F4, 0x000024F5, 0x000024F6, 0x000024F7,
+    0x000024F8, 0x000024F9, 0x000024FA, 0x000024FB, 0x000024FC, 0x000024FD, 0x000024FE, 0x000024FF,
+    0x00000025, 0x00000251, 0x00000252, 0x00000253, 0x00000254, 0x00100026, 0x00000256, 0x00000257,
+    0x00000258, 0x00000259, 0x0000025A, 0x0000025B, 0x0000025C, 0x0000025D, 0x0000025E, 0x0000025F,
+    0x00000251, 0x00010252, 0x00002512, 0x00002513, 0x00002514, 0x00002515, 0x00002516, 0x00002517,
+    0x00002518, 0x00002519, 0x0000251A, 0x0000251B, 0x0000251C, 0x0000251D, 0x0000251E, 0x0000251F,
+    0x00000252, 0x00002521, 0x00020253, 0x00002523, 0x00002524, 0x00002525, 0x00002526, 0x00002527,
+    0x00002528, 0x00002529, 0x0000252A, 0x0000252B, 0x0000252C, 0x0000252D, 0x0000252E, 0x0000252F,
+    0x00000253, 0x00002531, 0x00002532, 0x00040254, 0x00002534, 0x00002535, 0x00002536, 0x00002537,
+    0x00002538, 0x00002539, 0x0000253A, 0x0000253B, 0x0000253C, 0x0000253D, 0x0000253E, 0x0000253F,
+    0x00000254, 0x00002541, 0x00002542, 0x00002543, 0x00080255, 0x00002545, 0x00002546, 0x00002547,
+    0x00002548, 0x00002549, 0x0000254A, 0x0000254B, 0x0000254C, 0x0000254D, 0x0000254E, 0x0000254F,
+    0x00100026, 0x00100261, 0x00100262, 0x00100263, 0x00100264, 0x00100256, 0x00100266, 0x00100267,
+    0x00100268, 0x00100269, 0x0010026A, 0x0010026B, 0x0010026C, 0x0010026D, 0x0010026E, 0x0010026F,
+    0x00000256, 0x00002561, 0x00002562, 0x00002563, 0x00002564, 0x00002565, 0x00200257, 0x00002567,
+    0x00002568, 0x00002569, 0x0000256A, 0x0000256B, 0x0000256C, 0x0000256D, 0x0000256E, 0x0000256F,
+    0x00000257, 0x00002571, 0x00002572, 0x00002573, 0x00002574, 0x00002575, 0x00002576, 0x00400258,
+    0x00002578, 0x00002579, 0x0000257A, 0x0000257B, 0x0000257C, 0x0000257D, 0x0000257E, 0x0000257F,
+    0x00000258, 0x00002581, 0x00002582, 0x00002583, 0x00002584, 0x00002585, 0x00002586, 0x00002587,
+    0x00800259, 0x00002589, 0x0000258A, 0x0000258B, 0x0000258C, 0x0000258D, 0x0000258E, 0x0000258F,
+    0x00000259, 0x00002591, 0x00002592, 0x00002593, 0x00002594, 0x00002595, 0x00002596, 0x00002597,
+    0x00002598, 0x0100025A, 0x0000259A, 0x0000259B, 0x0000259C, 0x0000259D, 0x0000259E, 0x0000259F,
+    0x0000025A, 0x000025A1, 0x000025A2, 0x000025A3, 0x000025A4, 0x000025A5, 0x000025A6, 0x000025A7,
+    0x000025A8, 0x000025A9, 0x8200025B, 0x000025AB, 0x000025AC, 0x000025AD, 0x000025AE, 0x000025AF,
+    0x0000025B, 0x000025B1, 0x000025B2, 0x000025B3, 0x000025B4, 0x000025B5, 0x000025B6, 0x000025B7,
+    0x000025B8, 0x000025B9, 0x000025BA, 0x0400025C, 0x000025BC, 0x000025BD, 0x000025BE, 0x000025BF,
+    0x0000025C, 0x000025C1, 0x000025C2, 0x000025C3, 0x000025C4, 0x000025C5, 0x000025C6, 0x000025C7,
+    0x000025C8, 0x000025C9, 0x000025CA, 0x000025CB, 0x0800025D, 0x000025CD, 0x000025CE, 0x000025CF,
+    0x0000025D, 0x000025D1, 0x000025D2, 0x000025D3, 0x000025D4, 0x000025D5, 0x000025D6, 0x000025D7,
+    0x000025D8, 0x000025D9, 0x000025DA, 0x000025DB, 0x000025DC, 0x1000025E, 0x000025DE, 0x000025DF,
+    0x0000025E, 0x000025E1, 0x000025E2, 0x000025E3, 0x000025E4, 0x000025E5, 0x000025E6, 0x000025E7,
+    0x000025E8, 0x000025E9, 0x000025EA, 0x000025EB, 0x000025EC, 0x000025ED, 0x2000025F, 0x000025EF,
+    0x0000025F, 0x000025F1, 0x000025F2, 0x000025F3, 0x000025F4, 0x000025F5, 0x000025F6, 0x000025F7,
+    0x000025F8, 0x000025F9, 0x000025FA, 0x000025FB, 0x000025FC, 0x000025FD, 0x000025FE, 0x000025FF,
+    0x00000026, 0x00000261, 0x00000262, 0x00000263, 0x00000264, 0x00000265, 0x00200027, 0x00000267,
+    0x00000268, 0x00000269, 0x0000026A, 0x0000026B, 0x0000026C, 0x0000026D, 0x0000026E, 0x0000026F,
+    0x00000261, 0x00010262, 0x00002612, 0x00002613, 0x00002614, 0x00002615, 0x00002616, 0x00002617,
+    0x00002618, 0x00002619, 0x0000261A, 0x0000261B, 0x0000261C, 0x0000261D, 0x0000261E, 0x0000261F,
+    0x00000262, 0x00002621, 0x00020263, 0x00002623, 0x00002624, 0x00002625, 0x00002626, 0x00002627,
+    0x00002628, 0x00002629, 0x0000262A, 0x0000262B, 0x0000262C, 0x0000262D, 0x0000262E, 0x0000262F,
+    0x00000263, 0x00002631, 0x00002632, 0x00040264, 0x00002634, 0x00002635, 0x00002636, 0x00002637,
+    0x00002638, 0x00002639, 0x0000263A, 0x0000263B, 0x0000263C, 0x0000263D, 0x0000263E, 0x0000263F,
+    0x00000264, 0x00002641, 0x00002642, 0x00002643, 0x00080265, 0x00002645, 0x00002646, 0x00002647,
+    0x00002648, 0x00002649, 0x0000264A, 0x0000264B, 0x0000264C, 0x0000264D, 0x0000264E, 0x0000264F,
+    0x00000265, 0x00002651, 0x00002652, 0x00002653, 0x00002654, 0x00100266, 0x00002656, 0x00002657,
+    0x00002658, 0x00002659, 0x0000265A, 0x0000265B, 0x0000265C, 0x0000265D, 0x0000265E, 0x0000265F,
+    0x00200027, 0x00200271, 0x00200272, 0x00200273, 0x00200274, 0x00200275, 0x00200267, 0x00200277,
+    0x00200278, 0x00200279, 0x0020027A, 0x0020027B, 0x0020027C, 0x0020027D, 0x0020027E, 0x0020027F,
+    0x00000267, 0x00002671, 0x00002672, 0x00002673, 0x00002674, 0x00002675, 0x00002676, 0x00400268,
+    0x00002678, 0x00002679, 0x0000267A, 0x0000267B, 0x0000267C, 0x0000267D, 0x0000267E, 0x0000267F,
+    0x00000268, 0x00002681, 0x00002682, 0x00002683, 0x00002684, 0x00002685, 0x00002686, 0x00002687,
+    0x00800269, 0x00002689, 0x0000268A, 0x0000268B, 0x0000268C, 0x0000268D, 0x0000268E, 0x0000268F,
+    0x00000269, 0x00002691, 0x00002692, 0x00002693, 0x00002694, 0x00002695, 0x00002696, 0x00002697,
+    0x00002698, 0x0100026A, 0x0000269A, 0x0000269B, 0x0000269C, 0x0000269D, 0x0000269E, 0x0000269F,
+    0x0000026A, 0x000026A1, 0x000026A2, 0x000026A3, 0x000026A4, 0x000026A5, 0x000026A6, 0x000026A7,
+    0x000026A8, 0x000026A9, 0x8200026B, 0x000026AB, 0x000026AC, 0x000026AD, 0x000026AE, 0x000026AF,
+    0x0000026B, 0x000026B1, 0x000026B2, 0x000026B3, 0x000026B4, 0x000026B5, 0x000026B6, 0x000026B7,
+    0x000026B8, 0x000026B9, 0x000026BA, 0x0400026C, 0x000026BC, 0x000026BD, 0x000026BE, 0x000026BF,
+    0x0000026C, 0x000026C1, 0x000026C2, 0x000026C3, 0x000026C4, 0x000026C5, 0x000026C6, 0x000026C7,
+    0x000026C8, 0x000026C9, 0x000026CA, 0x000026CB, 0x0800026D, 0x000026CD, 0x000026CE, 0x000026CF,
+    0x0000026D, 0x000026D1, 0x000026D2, 0x000026D3, 0x000026D4, 0x000026D5, 0x000026D6, 0x000026D7,
+    0x000026D8, 0x000026D9, 0x000026DA, 0x000026DB, 0x000026DC, 0x1000026E, 0x000026DE, 0x000026DF,
+    0x0000026E, 0x000026E1, 0x000026E2, 0x000026E3, 0x000026E4, 0x000026E5, 0x000026E6, 0x000026E7,
+    0x000026E8, 0x000026E9, 0x000026EA, 0x000026EB, 0x000026EC, 0x000026ED, 0x2000026F, 0x000026EF,
+    0x0000026F, 0x000026F1, 0x000026F2, 0x000026F3, 0x000026F4, 0x000026F5, 0x000026F6, 0x000026F7,
+    0x000026F8, 0x000026F9, 0x000026FA, 0x000026FB, 0x000026FC, 0x000026FD, 0x000026FE, 0x000026FF,
+    0x00000027, 0x00000271, 0x00000272, 0x00000273, 0x00000274, 0x00000275, 0x00000276, 0x00400028,
+    0x00000278, 0x00000279, 0x0000027A, 0x0000027B, 0x0000027C, 0x0000027D, 0x0000027E, 0x0000027F,
+    0x00000271, 0x00010272, 0x00002712, 0x00002713, 0x00002714, 0x00002715, 0x00002716, 0x00002717,
+    0x00002718, 0x00002719, 0x0000271A, 0x0000271B, 0x0000271C, 0x0000271D, 0x0000271E, 0x0000271F,
+    0x00000272, 0x00002721, 0x00020273, 0x00002723, 0x00002724, 0x00002725, 0x00002726, 0x00002727,
+    0x00002728, 0x00002729, 0x0000272A, 0x0000272B, 0x0000272C, 0x0000272D, 0x0000272E, 0x0000272F,
+    0x00000273, 0x00002731, 0x00002732, 0x00040274, 0x00002734, 0x00002735, 0x00002736, 0x00002737,
+    0x00002738, 0x00002739, 0x0000273A, 0x0000273B, 0x0000273C, 0x0000273D, 0x0000273E, 0x0000273F,
+    0x00000274, 0x00002741, 0x00002742, 0x00002743, 0x00080275, 0x00002745, 0x00002746, 0x00002747,
+    0x00002748, 0x00002749, 0x0000274A, 0x0000274B, 0x0000274C, 0x0000274D, 0x0000274E, 0x0000274F,
+    0x00000275, 0x00002751, 0x00002752, 0x00002753, 0x00002754, 0x00100276, 0x00002756, 0x00002757,
+    0x00002758, 0x00002759, 0x0000275A, 0x0000275B, 0x0000275C, 0x0000275D, 0x0000275E, 0x0000275F,
+    0x00000276, 0x00002761, 0x00002762, 0x00002763, 0x00002764, 0x00002765, 0x00200277, 0x00002767,
+    0x00002768, 0x00002769, 0x0000276A, 0x0000276B, 0x0000276C, 0x0000276D, 0x0000276E, 0x0000276F,
+    0x00400028, 0x00400281, 0x00400282, 0x00400283, 0x00400284, 0x00400285, 0x00400286, 0x00400278,
+    0x00400288, 0x00400289, 0x0040028A, 0x0040028B, 0x0040028C, 0x0040028D, 0x0040028E, 0x0040028F,
+    0x00000278, 0x00002781, 0x00002782, 0x00002783, 0x00002784, 0x00002785, 0x00002786, 0x00002787,
+    0x00800279, 0x00002789, 0x0000278A, 0x0000278B, 0x0000278C, 0x0000278D, 0x0000278E, 0x0000278F,
+    0x00000279, 0x00002791, 0x00002792, 0x00002793, 0x00002794, 0x00002795, 0x00002796, 0x00002797,
+    0x00002798, 0x0100027A, 0x0000279A, 0x0000279B, 0x0000279C, 0x0000279D, 0x0000279E, 0x0000279F,
+    0x0000027A, 0x000027A1, 0x000027A2, 0x000027A3, 0x000027A4, 0x000027A5, 0x000027A6, 0x000027A7,
+    0x000027A8, 0x000027A9, 0x8200027B, 0x000027AB, 0x000027AC, 0x000027AD, 0x000027AE, 0x000027AF,
+    0x0000027B, 0x000027B1, 0x000027B2, 0x000027B3, 0x000027B4, 0x000027B5, 0x000027B6, 0x000027B7,
+    0x000027B8, 0x000027B9, 0x000027BA, 0x0400027C, 0x000027BC, 0x000027BD, 0x000027BE, 0x000027BF,
+    0x0000027C, 0x000027C1, 0x000027C2, 0x000027C3, 0x000027C4, 0x000027C5, 0x000027C6, 0x000027C7,
+    0x000027C8, 0x000027C9, 0x000027CA, 0x000027CB, 0x0800027D, 0x000027CD, 0x000027CE, 0x000027CF,
+    0x0000027D, 0x000027D1, 0x000027D2, 0x000027D3, 0x000027D4, 0x000027D5, 0x000027D6, 0x000027D7,
+    0x000027D8, 0x000027D9, 0x000027DA, 0x000027DB, 0x000027DC, 0x1000027E, 0x000027DE, 0x000027DF,
+    0x0000027E, 0x000027E1, 0x000027E2, 0x000027E3, 0x000027E4, 0x000027E5, 0x000027E6, 0x000027E7,
+    0x000027E8, 0x000027E9, 0x000027EA, 0x000027EB, 0x000027EC, 0x000027ED, 0x2000027F, 0x000027EF,
+    0x0000027F, 0x000027F1, 0x000027F2, 0x000027F3, 0x000027F4, 0x000027F5, 0x000027F6, 0x000027F7,
+    0x000027F8, 0x000027F9, 0x000027FA, 0x000027FB, 0x000027FC, 0x000027FD, 0x000027FE, 0x000027FF,
+    0x00000028, 0x00000281, 0x00000282, 0x00000283, 0x00000284, 0x00000285, 0x00000286, 0x00000287,
+    0x00800029, 0x00000289, 0x0000028A, 0x0000028B, 0x0000028C, 0x0000028D, 0x0000028E, 0x0000028F,
+    0x00000281, 0x00010282, 0x00002812, 0x00002813, 0x00002814, 0x00002815, 0x00002816, 0x00002817,
+    0x00002818, 0x00002819, 0x0000281A, 0x0000281B, 0x0000281C, 0x0000281D, 0x0000281E, 0x0000281F,
+    0x00000282, 0x00002821, 0x00020283, 0x00002823, 0x00002824, 0x00002825, 0x00002826, 0x00002827,
+    0x00002828, 0x00002829, 0x0000282A, 0x0000282B, 0x0000282C, 0x0000282D, 0x0000282E, 0x0000282F,
+    0x00000283, 0x00002831, 0x00002832, 0x00040284, 0x00002834, 0x00002835, 0x00002836, 0x00002837,
+    0x00002838, 0x00002839, 0x0000283A, 0x0000283B, 0x0000283C, 0x0000283D, 0x0000283E, 0x0000283F,
+    0x00000284, 0x00002841, 0x00002842, 0x00002843, 0x00080285, 0x00002845, 0x00002846, 0x00002847,
+    0x00002848, 0x00002849, 0x0000284A, 0x0000284B, 0x0000284C, 0x0000284D, 0x0000284E, 0x0000284F,
+    0x00000285, 0x00002851, 0x00002852, 0x00002853, 0x00002854, 0x00100286, 0x00002856, 0x00002857,
+    0x00002858, 0x00002859, 0x0000285A, 0x0000285B, 0x0000285C, 0x0000285D, 0x0000285E, 0x0000285F,
+    0x00000286, 0x00002861, 0x00002862, 0x00002863, 0x00002864, 0x00002865, 0x00200287, 0x00002867,
+    0x00002868, 0x00002869, 0x0000286A, 0x0000286B, 0x0000286C, 0x0000286D, 0x0000286E, 0x0000286F,
+    0x00000287, 0x00002871, 0x00002872, 0x00002873, 0x00002874, 0x00002875, 0x00002876, 0x00400288,
+    0x00002878, 0x00002879, 0x0000287A, 0x0000287B, 0x0000287C, 0x0000287D, 0x0000287E, 0x0000287F,
+    0x00800029, 0x00800291, 0x00800292, 0x00800293, 0x00800294, 0x00800295, 0x00800296, 0x00800297,
+    0x00800289, 0x00800299, 0x0080029A, 0x0080029B, 0x0080029C, 0x0080029D, 0x0080029E, 0x0080029F,
+    0x00000289, 0x00002891, 0x00002892, 0x00002893, 0x00002894, 0x00002895, 0x00002896, 0x00002897,
+    0x00002898, 0x0100028A, 0x0000289A, 0x0000289B, 0x0000289C, 0x0000289D, 0x0000289E, 0x0000289F,
+    0x0000028A, 0x000028A1, 0x000028A2, 0x000028A3, 0x000028A4, 0x000028A5, 0x000028A6, 0x000028A7,
+    0x000028A8, 0x000028A9, 0x8200028B, 0x000028AB, 0x000028AC, 0x000028AD, 0x000028AE, 0x000028AF,
+    0x0000028B, 0x000028B1, 0x000028B2, 0x000028B3, 0x000028B4, 0x000028B5, 0x000028B6, 0x000028B7,
+    0x000028B8, 0x000028B9, 0x000028BA, 0x0400028C, 0x000028BC, 0x000028BD, 0x000028BE, 0x000028BF,
+    0x0000028C, 0x000028C1, 0x000028C2, 0x000028C3, 0x000028C4, 0x000028C5, 0x000028C6, 0x000028C7,
+    0x000028C8, 0x000028C9, 0x000028CA, 0x000028CB, 0x0800028D, 0x000028CD, 0x000028CE, 0x000028CF,
+    0x0000028D, 0x000028D1, 0x000028D2, 0x000028D3, 0x000028D4, 0x000028D5, 0x000028D6, 0x000028D7,
+    0x000028D8, 0x000028D9, 0x000028DA, 0x000028DB, 0x000028DC, 0x1000028E, 0x000028DE, 0x000028DF,
+    0x0000028E, 0x000028E1, 0x000028E2, 0x000028E3, 0x000028E4, 0x000028E5, 0x000028E6, 0x000028E7,
+    0x000028E8, 0x000028E9, 0x000028EA, 0x000028EB, 0x000028EC, 0x000028ED, 0x2000028F, 0x000028EF,
+    0x0000028F, 0x000028F1, 0x000028F2, 0x000028F3, 0x000028F4, 0x000028F5, 0x000028F6, 0x000028F7,
+    0x000028F8, 0x000028F9, 0x000028FA, 0x000028FB, 0x000028FC, 0x000028FD, 0x000028FE, 0x000028FF,
+    0x00000029, 0x00000291, 0x00000292, 0x00000293, 0x00000294, 0x00000295, 0x00000296, 0x00000297,
+    0x00000298, 0x0100002A, 0x0000029A, 0x0000029B, 0x0000029C, 0x0000029D, 0x0000029E, 0x0000029F,
+    0x00000291, 0x00010292, 0x00002912, 0x00002913, 0x00002914, 0x00002915, 0x00002916, 0x00002917,
+    0x00002918, 0x00002919, 0x0000291A, 0x0000291B, 0x0000291C, 0x0000291D, 0x0000291E, 0x0000291F,
+    0x00000292, 0x00002921, 0x00020293, 0x00002923, 0x00002924, 0x00002925, 0x00002926, 0x00002927,
+    0x00002928, 0x00002929, 0x0000292A, 0x0000292B, 0x0000292C, 0x0000292D, 0x0000292E, 0x0000292F,
+    0x00000293, 0x00002931, 0x00002932, 0x00040294, 0x00002934, 0x00002935, 0x00002936, 0x00002937,
+    0x00002938, 0x00002939, 0x0000293A, 0x0000293B, 0x0000293C, 0x0000293D, 0x0000293E, 0x0000293F,
+    0x00000294, 0x00002941, 0x00002942, 0x00002943, 0x00080295, 0x00002945, 0x00002946, 0x00002947,
+    0x00002948, 0x00002949, 0x0000294A, 0x0000294B, 0x0000294C, 0x0000294D, 0x0000294E, 0x0000294F,
+    0x00000295, 0x00002951, 0x00002952, 0x00002953, 0x00002954, 0x00100296, 0x00002956, 0x00002957,
+    0x00002958, 0x00002959, 0x0000295A, 0x0000295B, 0x0000295C, 0x0000295D, 0x0000295E, 0x0000295F,
+    0x00000296, 0x00002961, 0x00002962, 0x00002963, 0x00002964, 0x00002965, 0x00200297, 0x00002967,
+    0x00002968, 0x00002969, 0x0000296A, 0x0000296B, 0x0000296C, 0x0000296D, 0x0000296E, 0x0000296F,
+    0x00000297, 0x00002971, 0x00002972, 0x00002973, 0x00002974, 0x00002975, 0x00002976, 0x00400298,
+    0x00002978, 0x00002979, 0x0000297A, 0x0000297B, 0x0000297C, 0x0000297D, 0x0000297E, 0x0000297F,
+    0x00000298, 0x00002981, 0x00002982, 0x00002983, 0x00002984, 0x00002985, 0x00002986, 0x00002987,
+    0x00800299, 0x00002989, 0x0000298A, 0x0000298B, 0x0000298C, 0x0000298D, 0x0000298E, 0x0000298F,
+    0x0100002A, 0x010002A1, 0x010002A2, 0x010002A3, 0x010002A4, 0x010002A5, 0x010002A6, 0x010002A7,
+    0x010002A8, 0x0100029A, 0x010002AA, 0x010002AB, 0x010002AC, 0x010002AD, 0x010002AE, 0x010002AF,
+    0x0000029A, 0x000029A1, 0x000029A2, 0x000029A3, 0x000029A4, 0x000029A5, 0x000029A6, 0x000029A7,
+    0x000029A8, 0x000029A9, 0x8200029B, 0x000029AB, 0x000029AC, 0x000029AD, 0x000029AE, 0x000029AF,
+    0x0000029B, 0x000029B1, 0x000029B2, 0x000029B3, 0x000029B4, 0x000029B5, 0x000029B6, 0x000029B7,
+    0x000029B8, 0x000029B9, 0x000029BA, 0x0400029C, 0x000029BC, 0x000029BD, 0x000029BE, 0x000029BF,
+    0x0000029C, 0x000029C1, 0x000029C2, 0x000029C3, 0x000029C4, 0x000029C5, 0x000029C6, 0x000029C7,
+    0x000029C8, 0x000029C9, 0x000029CA, 0x000029CB, 0x0800029D, 0x000029CD, 0x000029CE, 0x000029CF,
+    0x0000029D, 0x000029D1, 0x000029D2, 0x000029D3, 0x000029D4, 0x000029D5, 0x000029D6, 0x000029D7,
+    0x000029D8, 0x000029D9, 0x000029DA, 0x000029DB, 0x000029DC, 0x1000029E, 0x000029DE, 0x000029DF,
+    0x0000029E, 0x000029E1, 0x000029E2, 0x000029E3, 0x000029E4, 0x000029E5, 0x000029E6, 0x000029E7,
+    0x000029E8, 0x000029E9, 0x000029EA, 0x000029EB, 0x000029EC, 0x000029ED, 0x2000029F, 0x000029EF,
+    0x0000029F, 0x000029F1, 0x000029F2, 0x000029F3, 0x000029F4, 0x000029F5, 0x000029F6, 0x000029F7,
+    0x000029F8, 0x000029F9, 0x000029FA, 0x000029FB, 0x000029FC, 0x000029FD, 0x000029FE, 0x000029FF,
+    0x0000002A, 0x000002A1, 0x000002A2, 0x000002A3, 0x000002A4, 0x000002A5, 0x000002A6, 0x000002A7,
+    0x000002A8, 0x000002A9, 0x8200002B, 0x000002AB, 0x000002AC, 0x000002AD, 0x000002AE, 0x000002AF,
+    0x000002A1, 0x000102A2, 0x00002A12, 0x00002A13, 0x00002A14, 0x00002A15, 0x00002A16, 0x00002A17,
+    0x00002A18, 0x00002A19, 0x00002A1A, 0x00002A1B, 0x00002A1C, 0x00002A1D, 0x00002A1E, 0x00002A1F,
+    0x000002A2, 0x00002A21, 0x000202A3, 0x00002A23, 0x00002A24, 0x00002A25, 0x00002A26, 0x00002A27,
+    0x00002A28, 0x00002A29, 0x00002A2A, 0x00002A2B, 0x00002A2C, 0x00002A2D, 0x00002A2E, 0x00002A2F,
+    0x000002A3, 0x00002A31, 0x00002A32, 0x000402A4, 0x00002A34, 0x00002A35, 0x00002A36, 0x00002A37,
+    0x00002A38, 0x00002A39, 0x00002A3A, 0x00002A3B, 0x00002A3C, 0x00002A3D, 0x00002A3E, 0x00002A3F,
+    0x000002A4, 0x00002A41, 0x00002A42, 0x00002A43, 0x000802A5, 0x00002A45, 0x00002A46, 0x00002A47,
+    0x00002A48, 0x00002A49, 0x00002A4A, 0x00002A4B, 0x00002A4C, 0x00002A4D, 0x00002A4E, 0x00002A4F,
+    0x000002A5, 0x00002A51, 0x00002A52, 0x00002A53, 0x00002A54, 0x001002A6, 0x00002A56, 0x00002A57,
+    0x00002A58, 0x00002A59, 0x00002A5A, 0x00002A5B, 0x00002A5C, 0x00002A5D, 0x00002A5E, 0x00002A5F,
+    0x000002A6, 0x00002A61, 0x00002A62, 0x00002A63, 0x00002A64, 0x00002A65, 0x002002A7, 0x00002A67,
+    0x00002A68, 0x00002A69, 0x00002A6A, 0x00002A6B, 0x00002A6C, 0x00002A6D, 0x00002A6E, 0x00002A6F,
+    0x000002A7, 0x00002A71, 0x00002A72, 0x00002A73, 0x00002A74, 0x00002A75, 0x00002A76, 0x004002A8,
+    0x00002A78, 0x00002A79, 0x00002A7A, 0x00002A7B, 0x00002A7C, 0x00002A7D, 0x00002A7E, 0x00002A7F,
+    0x000002A8, 0x00002A81, 0x00002A82, 0x00002A83, 0x00002A84, 0x00002A85, 0x00002A86, 0x00002A87,
+    0x008002A9, 0x00002A89, 0x00002A8A, 0x00002A8B, 0x00002A8C, 0x00002A8D, 0x00002A8E, 0x00002A8F,
+    0x000002A9, 0x00002A91, 0x00002A92, 0x00002A93, 0x00002A94, 0x00002A95, 0x00002A96, 0x00002A97,
+    0x00002A98, 0x010002AA, 0x00002A9A, 0x00002A9B, 0x00002A9C, 0x00002A9D, 0x00002A9E, 0x00002A9F,
+    0x8200002B, 0x820002B1, 0x820002B2, 0x820002B3, 0x820002B4, 0x820002B5, 0x820002B6, 0x820002B7,
+    0x820002B8, 0x820002B9, 0x820002AB, 0x820002BB, 0x820002BC, 0x820002BD, 0x820002BE, 0x820002BF,
+    0x000002AB, 0x00002AB1, 0x00002AB2, 0x00002AB3, 0x00002AB4, 0x00002AB5, 0x00002AB6, 0x00002AB7,
+    0x00002AB8, 0x00002AB9, 0x00002ABA, 0x040002AC, 0x00002ABC, 0x00002ABD, 0x00002ABE, 0x00002ABF,
+    0x000002AC, 0x00002AC1, 0x00002AC2, 0x00002AC3, 0x00002AC4, 0x00002AC5, 0x00002AC6, 0x00002AC7,
+    0x00002AC8, 0x00002AC9, 0x00002ACA, 0x00002ACB, 0x080002AD, 0x00002ACD, 0x00002ACE, 0x00002ACF,
+    0x000002AD, 0x00002AD1, 0x00002AD2, 0x00002AD3, 0x00002AD4, 0x00002AD5, 0x00002AD6, 0x00002AD7,
+    0x00002AD8, 0x00002AD9, 0x00002ADA, 0x00002ADB, 0x00002ADC, 0x100002AE, 0x00002ADE, 0x00002ADF,
+    0x000002AE, 0x00002AE1, 0x00002AE2, 0x00002AE3, 0x00002AE4, 0x00002AE5, 0x00002AE6, 0x00002AE7,
+    0x00002AE8, 0x00002AE9, 0x00002AEA, 0x00002AEB, 0x00002AEC, 0x00002AED, 0x200002AF, 0x00002AEF,
+    0x000002AF, 0x00002AF1, 0x00002AF2, 0x00002AF3, 0x00002AF4, 0x00002AF5, 0x00002AF6, 0x00002AF7,
+    0x00002AF8, 0x00002AF9, 0x00002AFA, 0x00002AFB, 0x00002AFC, 0x00002AFD, 0x00002AFE, 0x00002AFF,
+    0x0000002B, 0x000002B1, 0x000002B2, 0x000002B3, 0x000002B4, 0x000002B5, 0x000002B6, 0x000002B7,
+    0x000002B8, 0x000002B9, 0x000002BA, 0x0400002C, 0x000002BC, 0x000002BD, 0x000002BE, 0x000002BF,
+    0x000002B1, 0x000102B2, 0x00002B12, 0x00002B13, 0x00002B14, 0x00002B15, 0x00002B16, 0x00002B17,
+    0x00002B18, 0x00002B19, 0x00002B1A, 0x00002B1B, 0x00002B1C, 0x00002B1D, 0x00002B1E, 0x00002B1F,
+    0x000002B2, 0x00002B21, 0x000202B3, 0x00002B23, 0x00002B24, 0x00002B25, 0x00002B26, 0x00002B27,
+    0x00002B28, 0x00002B29, 0x00002B2A, 0x00002B2B, 0x00002B2C, 0x00002B2D, 0x00002B2E, 0x00002B2F,
+    0x000002B3, 0x00002B31, 0x00002B32, 0x000402B4, 0x00002B34, 0x00002B35, 0x00002B36, 0x00002B37,
+    0x00002B38, 0x00002B39, 0x00002B3A, 0x00002B3B, 0x00002B3C, 0x00002B3D, 0x00002B3E, 0x00002B3F,
+    0x000002B4, 0x00002B41, 0x00002B42, 0x00002B43, 0x000802B5, 0x00002B45, 0x00002B46, 0x00002B47,
+    0x00002B48, 0x00002B49, 0x00002B4A, 0x00002B4B, 0x00002B4C, 0x00002B4D, 0x00002B4E, 0x00002B4F,
+    0x000002B5, 0x00002B51, 0x00002B52, 0x00002B53, 0x00002B54, 0x001002B6, 0x00002B56, 0x00002B57,
+    0x00002B58, 0x00002B59, 0x00002B5A, 0x00002B5B, 0x00002B5C, 0x00002B5D, 0x00002B5E, 0x00002B5F,
+    0x000002B6, 0x00002B61, 0x00002B62, 0x00002B63, 0x00002B64, 0x00002B65, 0x002002B7, 0x00002B67,
+    0x00002B68, 0x00002B69, 0x00002B6A, 0x00002B6B, 0x00002B6C, 0x00002B6D, 0x00002B6E, 0x00002B6F,
+    0x000002B7, 0x00002B71, 0x00002B72, 0x00002B73, 0x00002B74, 0x00002B75, 0x00002B76, 0x004002B8,
+    0x00002B78, 0x00002B79, 0x00002B7A, 0x00002B7B, 0x00002B7C, 0x00002B7D, 0x00002B7E, 0x00002B7F,
+    0x000002B8, 0x00002B81, 0x00002B82, 0x00002B83, 0x00002B84, 0x00002B85, 0x00002B86, 0x00002B87,
+    0x008002B9, 0x00002B89, 0x00002B8A, 0x00002B8B, 0x00002B8C, 0x00002B8D, 0x00002B8E, 0x00002B8F,
+    0x000002B9, 0x00002B91, 0x00002B92, 0x00002B93, 0x00002B94, 0x00002B95, 0x00002B96, 0x00002B97,
+    0x00002B98, 0x010002BA, 0x00002B9A, 0x00002B9B, 0x00002B9C, 0x00002B9D, 0x00002B9E, 0x00002B9F,
+    0x000002BA, 0x00002BA1, 0x00002BA2, 0x00002BA3, 0x00002BA4, 0x00002BA5, 0x00002BA6, 0x00002BA7,
+    0x00002BA8, 0x00002BA9, 0x820002BB, 0x00002BAB, 0x00002BAC, 0x00002BAD, 0x00002BAE, 0x00002BAF,
+    0x0400002C, 0x040002C1, 0x040002C2, 0x040002C3, 0x040002C4, 0x040002C5, 0x040002C6, 0x040002C7,
+    0x040002C8, 0x040002C9, 0x040002CA, 0x040002BC, 0x040002CC, 0x040002CD, 0x040002CE, 0x040002CF,
+    0x000002BC, 0x00002BC1, 0x00002BC2, 0x00002BC3, 0x00002BC4, 0x00002BC5, 0x00002BC6, 0x00002BC7,
+    0x00002BC8, 0x00002BC9, 0x00002BCA, 0x00002BCB, 0x080002BD, 0x00002BCD, 0x00002BCE, 0x00002BCF,
+    0x000002BD, 0x00002BD1, 0x00002BD2, 0x00002BD3, 0x00002BD4, 0x00002BD5, 0x00002BD6, 0x00002BD7,
+    0x00002BD8, 0x00002BD9, 0x00002BDA, 0x00002BDB, 0x00002BDC, 0x100002BE, 0x00002BDE, 0x00002BDF,
+    0x000002BE, 0x00002BE1, 0x00002BE2, 0x00002BE3, 0x00002BE4, 0x00002BE5, 0x00002BE6, 0x00002BE7,
+    0x00002BE8, 0x00002BE9, 0x00002BEA, 0x00002BEB, 0x00002BEC, 0x00002BED, 0x200002BF, 0x00002BEF,
+    0x000002BF, 0x00002BF1, 0x00002BF2, 0x00002BF3, 0x00002BF4, 0x00002BF5, 0x00002BF6, 0x00002BF7,
+    0x00002BF8, 0x00002BF9, 0x00002BFA, 0x00002BFB, 0x00002BFC, 0x00002BFD, 0x00002BFE, 0x00002BFF,
+    0x0000002C, 0x000002C1, 0x000002C2, 0x000002C3, 0x000002C4, 0x000002C5, 0x000002C6, 0x000002C7,
+    0x000002C8, 0x000002C9, 0x000002CA, 0x000002CB, 0x0800002D, 0x000002CD, 0x000002CE, 0x000002CF,
+    0x000002C1, 0x000102C2, 0x00002C12, 0x00002C13, 0x00002C14, 0x00002C15, 0x00002C16, 0x00002C17,
+    0x00002C18, 0x00002C19, 0x00002C1A, 0x00002C1B, 0x00002C1C, 0x00002C1D, 0x00002C1E, 0x00002C1F,
+    0x000002C2, 0x00002C21, 0x000202C3, 0x00002C23, 0x00002C24, 0x00002C25, 0x00002C26, 0x00002C27,
+    0x00002C28, 0x00002C29, 0x00002C2A, 0x00002C2B, 0x00002C2C, 0x00002C2D, 0x00002C2E, 0x00002C2F,
+    0x000002C3, 0x00002C31, 0x00002C32, 0x000402C4, 0x00002C34, 0x00002C35, 0x00002C36, 0x00002C37,
+    0x00002C38, 0x00002C39, 0x00002C3A, 0x00002C3B, 0x00002C3C, 0x00002C3D, 0x00002C3E, 0x00002C3F,
+    0x000002C4, 0x00002C41, 0x00002C42, 0x00002C43, 0x000802C5, 0x00002C45, 0x00002C46, 0x00002C47,
+    0x00002C48, 0x00002C49, 0x00002C4A, 0x00002C4B, 0x00002C4C, 0x00002C4D, 0x00002C4E, 0x00002C4F,
+    0x000002C5, 0x00002C51, 0x00002C52, 0x00002C53, 0x00002C54, 0x001002C6, 0x00002C56, 0x00002C57,
+    0x00002C58, 0x00002C59, 0x00002C5A, 0x00002C5B, 0x00002C5C, 0x00002C5D, 0x00002C5E, 0x00002C5F,
+    0x000002C6, 0x00002C61, 0x00002C62, 0x00002C63, 0x00002C64, 0x00002C65, 0x002002C7, 0x00002C67,
+    0x00002C68, 0x00002C69, 0x00002C6A, 0x00002C6B, 0x00002C6C, 0x00002C6D, 0x00002C6E, 0x00002C6F,
+    0x000002C7, 0x00002C71, 0x00002C72, 0x00002C73, 0x00002C74, 0x00002C75, 0x00002C76, 0x004002C8,
+    0x00002C78, 0x00002C79, 0x00002C7A, 0x00002C7B, 0x00002C7C, 0x00002C7D, 0x00002C7E, 0x00002C7F,
+    0x000002C8, 0x00002C81, 0x00002C82, 0x00002C83, 0x00002C84, 0x00002C85, 0x00002C86, 0x00002C87,
+    0x008002C9, 0x00002C89, 0x00002C8A, 0x00002C8B, 0x00002C8C, 0x00002C8D, 0x00002C8E, 0x00002C8F,
+    0x000002C9, 0x00002C91, 0x00002C92, 0x00002C93, 0x00002C94, 0x00002C95, 0x00002C96, 0x00002C97,
+    0x00002C98, 0x010002CA, 0x00002C9A, 0x00002C9B, 0x00002C9C, 0x00002C9D, 0x00002C9E, 0x00002C9F,
+    0x000002CA, 0x00002CA1, 0x00002CA2, 0x00002CA3, 0x00002CA4, 0x00002CA5, 0x00002CA6, 0x00002CA7,
+    0x00002CA8, 0x00002CA9, 0x820002CB, 0x00002CAB, 0x00002CAC, 0x00002CAD, 0x00002CAE, 0x00002CAF,
+    0x000002CB, 0x00002CB1, 0x00002CB2, 0x00002CB3, 0x00002CB4, 0x00002CB5, 0x00002CB6, 0x00002CB7,
+    0x00002CB8, 0x00002CB9, 0x00002CBA, 0x040002CC, 0x00002CBC, 0x00002CBD, 0x00002CBE, 0x00002CBF,
+    0x0800002D, 0x080002D1, 0x080002D2, 0x080002D3, 0x080002D4, 0x080002D5, 0x080002D6, 0x080002D7,
+    0x080002D8, 0x080002D9, 0x080002DA, 0x080002DB, 0x080002CD, 0x080002DD, 0x080002DE, 0x080002DF,
+    0x000002CD, 0x00002CD1, 0x00002CD2, 0x00002CD3, 0x00002CD4, 0x00002CD5, 0x00002CD6, 0x00002CD7,
+    0x00002CD8, 0x00002CD9, 0x00002CDA, 0x00002CDB, 0x00002CDC, 0x100002CE, 0x00002CDE, 0x00002CDF,
+    0x000002CE, 0x00002CE1, 0x00002CE2, 0x00002CE3, 0x00002CE4, 0x00002CE5, 0x00002CE6, 0x00002CE7,
+    0x00002CE8, 0x00002CE9, 0x00002CEA, 0x00002CEB, 0x00002CEC, 0x00002CED, 0x200002CF, 0x00002CEF,
+    0x000002CF, 0x00002CF1, 0x00002CF2, 0x00002CF3, 0x00002CF4, 0x00002CF5, 0x00002CF6, 0x00002CF7,
+    0x00002CF8, 0x00002CF9, 0x00002CFA, 0x00002CFB, 0x00002CFC, 0x00002CFD, 0x00002CFE, 0x00002CFF,
+    0x0000002D, 0x000002D1, 0x000002D2, 0x000002D3, 0x000002D4, 0x000002D5, 0x000002D6, 0x000002D7,
+    0x000002D8, 0x000002D9, 0x000002DA, 0x000002DB, 0x000002DC, 0x1000002E, 0x000002DE, 0x000002DF,
+    0x000002D1, 0x000102D2, 0x00002D12, 0x00002D13, 0x00002D14, 0x00002D15, 0x00002D16, 0x00002D17,
+    0x00002D18, 0x00002D19, 0x00002D1A, 0x00002D1B, 0x00002D1C, 0x00002D1D, 0x00002D1E, 0x00002D1F,
+    0x000002D2, 0x00002D21, 0x000202D3, 0x00002D23, 0x00002D24, 0x00002D25, 0x00002D26, 0x00002D27,
+    0x00002D28, 0x00002D29, 0x00002D2A, 0x00002D2B, 0x00002D2C, 0x00002D2D, 0x00002D2E, 0x00002D2F,
+    0x000002D3, 0x00002D31, 0x00002D32, 0x000402D4, 0x00002D34, 0x00002D35, 0x00002D36, 0x00002D37,
+    0x00002D38, 0x00002D39, 0x00002D3A, 0x00002D3B, 0x00002D3C, 0x00002D3D, 0x00002D3E, 0x00002D3F,
+    0x000002D4, 0x00002D41, 0x00002D42, 0x00002D43, 0x000802D5, 0x00002D45, 0x00002D46, 0x00002D47,
+    0x00002D48, 0x00002D49, 0x00002D4A, 0x00002D4B, 0x00002D4C, 0x00002D4D, 0x00002D4E, 0x00002D4F,
+    0x000002D5, 0x00002D51, 0x00002D52, 0x00002D53, 0x00002D54, 0x001002D6, 0x00002D56, 0x00002D57,
+    0x00002D58, 0x00002D59, 0x00002D5A, 0x00002D5B, 0x00002D5C, 0x00002D5D, 0x00002D5E, 0x00002D5F,
+    0x000002D6, 0x00002D61, 0x00002D62, 0x00002D63, 0x00002D64, 0x00002D65, 0x002002D7, 0x00002D67,
+    0x00002D68, 0x00002D69, 0x00002D6A, 0x00002D6B, 0x00002D6C, 0x00002D6D, 0x00002D6E, 0x00002D6F,
+    0x000002D7, 0x00002D71, 0x00002D72, 0x00002D73, 0x00002D74, 0x00002D75, 0x00002D76, 0x004002D8,
+    0x00002D78, 0x00002D79, 0x00002D7A, 0x00002D7B, 0x00002D7C, 0x00002D7D, 0x00002D7E, 0x00002D7F,
+    0x000002D8, 0x00002D81, 0x00002D82, 0x00002D83, 0x00002D84, 0x00002D85, 0x00002D86, 0x00002D87,
+    0x008002D9, 0x00002D89, 0x00002D8A, 0x00002D8B, 0x00002D8C, 0x00002D8D, 0x00002D8E, 0x00002D8F,
+    0x000002D9, 0x00002D91, 0x00002D92, 0x00002D93, 0x00002D94, 0x00002D95, 0x00002D96, 0x00002D97,
+    0x00002D98, 0x010002DA, 0x00002D9A, 0x00002D9B, 0x00002D9C, 0x00002D9D, 0x00002D9E, 0x00002D9F,
+    0x000002DA, 0x00002DA1, 0x00002DA2, 0x00002DA3, 0x00002DA4, 0x00002DA5, 0x00002DA6, 0x00002DA7,
+    0x00002DA8, 0x00002DA9, 0x820002DB, 0x00002DAB, 0x00002DAC, 0x00002DAD, 0x00002DAE, 0x00002DAF,
+    0x000002DB, 0x00002DB1, 0x00002DB2, 0x00002DB3, 0x00002DB4, 0x00002DB5, 0x00002DB6, 0x00002DB7,
+    0x00002DB8, 0x00002DB9, 0x00002DBA, 0x040002DC, 0x00002DBC, 0x00002DBD, 0x00002DBE, 0x00002DBF,
+    0x000002DC, 0x00002DC1, 0x00002DC2, 0x00002DC3, 0x00002DC4, 0x00002DC5, 0x00002DC6, 0x00002DC7,
+    0x00002DC8, 0x00002DC9, 0x00002DCA, 0x00002DCB, 0x080002DD, 0x00002DCD, 0x00002DCE, 0x00002DCF,
+    0x1000002E, 0x100002E1, 0x100002E2, 0x100002E3, 0x100002E4, 0x100002E5, 0x100002E6, 0x100002E7,
+    0x100002E8, 0x100002E9, 0x100002EA, 0x100002EB, 0x100002EC, 0x100002DE, 0x100002EE, 0x100002EF,
+    0x000002DE, 0x00002DE1, 0x00002DE2, 0x00002DE3, 0x00002DE4, 0x00002DE5, 0x00002DE6, 0x00002DE7,
+    0x00002DE8, 0x00002DE9, 0x00002DEA, 0x00002DEB, 0x00002DEC, 0x00002DED, 0x200002DF, 0x00002DEF,
+    0x000002DF, 0x00002DF1, 0x00002DF2, 0x00002DF3, 0x00002DF4, 0x00002DF5, 0x00002DF6, 0x00002DF7,
+    0x00002DF8, 0x00002DF9, 0x00002DFA, 0x00002DFB, 0x00002DFC, 0x00002DFD, 0x00002DFE, 0x00002DFF,
+    0x0000002E, 0x000002E1, 0x000002E2, 0x000002E3, 0x000002E4, 0x000002E5, 0x000002E6, 0x000002E7,
+    0x000002E8, 0x000002E9, 0x000002EA, 0x000002EB, 0x000002EC, 0x000002ED, 0x2000002F, 0x000002EF,
+    0x000002E1, 0x000102E2, 0x00002E12, 0x00002E13, 0x00002E14, 0x00002E15, 0x00002E16, 0x00002E17,
+    0x00002E18, 0x00002E19, 0x00002E1A, 0x00002E1B, 0x00002E1C, 0x00002E1D, 0x00002E1E, 0x00002E1F,
+    0x000002E2, 0x00002E21, 0x000202E3, 0x00002E23, 0x00002E24, 0x00002E25, 0x00002E26, 0x00002E27,
+    0x00002E28, 0x00002E29, 0x00002E2A, 0x00002E2B, 0x00002E2C, 0x00002E2D, 0x00002E2E, 0x00002E2F,
+    0x000002E3, 0x00002E31, 0x00002E32, 0x000402E4, 0x00002E34, 0x00002E35, 0x00002E36, 0x00002E37,
+    0x00002E38, 0x00002E39, 0x00002E3A, 0x00002E3B, 0x00002E3C, 0x00002E3D, 0x00002E3E, 0x00002E3F,
+    0x000002E4, 0x00002E41, 0x00002E42, 0x00002E43, 0x000802E5, 0x00002E45, 0x00002E46, 0x00002E47,
+    0x00002E48, 0x00002E49, 0x00002E4A, 0x00002E4B, 0x00002E4C, 0x00002E4D, 0x00002E4E, 0x00002E4F,
+    0x000002E5, 0x00002E51, 0x00002E52, 0x00002E53, 0x00002E54, 0x001002E6, 0x00002E56, 0x00002E57,
+    0x00002E58, 0x00002E59, 0x00002E5A, 0x00002E5B, 0x00002E5C, 0x00002E5D, 0x00002E5E, 0x00002E5F,
+    0x000002E6, 0x00002E61, 0x00002E62, 0x00002E63, 0x00002E64, 0x00002E65, 0x002002E7, 0x00002E67,
+    0x00002E68, 0x00002E69, 0x00002E6A, 0x00002E6B, 0x00002E6C, 0x00002E6D, 0x00002E6E, 0x00002E6F,
+    0x000002E7, 0x00002E71, 0x00002E72, 0x00002E73, 0x00002E74, 0x00002E75, 0x00002E76, 0x004002E8,
+    0x00002E78, 0x00002E79, 0x00002E7A, 0x00002E7B, 0x00002E7C, 0x00002E7D, 0x00002E7E, 0x00002E7F,
+    0x000002E8, 0x00002E81, 0x00002E82, 0x00002E83, 0x00002E84, 0x00002E85, 0x00002E86, 0x00002E87,
+    0x008002E9, 0x00002E89, 0x00002E8A, 0x00002E8B, 0x00002E8C, 0x00002E8D, 0x00002E8E, 0x00002E8F,
+    0x000002E9, 0x00002E91, 0x00002E92, 0x00002E93, 0x00002E94, 0x00002E95, 0x00002E96, 0x00002E97,
+    0x00002E98, 0x010002EA, 0x00002E9A, 0x00002E9B, 0x00002E9C, 0x00002E9D, 0x00002E9E, 0x00002E9F,
+    0x000002EA, 0x00002EA1, 0x00002EA2, 0x00002EA3, 0x00002EA4, 0x00002EA5, 0x00002EA6, 0x00002EA7,
+    0x00002EA8, 0x00002EA9, 0x820002EB, 0x00002EAB, 0x00002EAC, 0x00002EAD, 0x00002EAE, 0x00002EAF,
+    0x000002EB, 0x00002EB1, 0x00002EB2, 0x00002EB3, 0x00002EB4, 0x00002EB5, 0x00002EB6, 0x00002EB7,
+    0x00002EB8, 0x00002EB9, 0x00002EBA, 0x040002EC, 0x00002EBC, 0x00002EBD, 0x00002EBE, 0x00002EBF,
+    0x000002EC, 0x00002EC1, 0x00002EC2, 0x00002EC3, 0x00002EC4, 0x00002EC5, 0x00002EC6, 0x00002EC7,
+    0x00002EC8, 0x00002EC9, 0x00002ECA, 0x00002ECB, 0x080002ED, 0x00002ECD, 0x00002ECE, 0x00002ECF,
+    0x000002ED, 0x00002ED1, 0x00002ED2, 0x00002ED3, 0x00002ED4, 0x00002ED5, 0x00002ED6, 0x00002ED7,
+    0x00002ED8, 0x00002ED9, 0x00002EDA, 0x00002EDB, 0x00002EDC, 0x100002EE, 0x00002EDE, 0x00002EDF,
+    0x2000002F, 0x200002F1, 0x200002F2, 0x200002F3, 0x200002F4, 0x200002F5, 0x200002F6, 0x200002F7,
+    0x200002F8, 0x200002F9, 0x200002FA, 0x200002FB, 0x200002FC, 0x200002FD, 0x200002EF, 0x200002FF,
+    0x000002EF, 0x00002EF1, 0x00002EF2, 0x00002EF3, 0x00002EF4, 0x00002EF5, 0x00002EF6, 0x00002EF7,
+    0x00002EF8, 0x00002EF9, 0x00002EFA, 0x00002EFB, 0x00002EFC, 0x00002EFD, 0x00002EFE, 0x00002EFF,
+    0x0000002F, 0x000002F1, 0x000002F2, 0x000002F3, 0x000002F4, 0x000002F5, 0x000002F6, 0x000002F7,
+    0x000002F8, 0x000002F9, 0x000002FA, 0x000002FB, 0x000002FC, 0x000002FD, 0x000002FE, 0x000002FF,
+    0x000002F1, 0x000102F2, 0x00002F12, 0x00002F13, 0x00002F14, 0x00002F15, 0x00002F16, 0x00002F17,
+    0x00002F18, 0x00002F19, 0x00002F1A, 0x00002F1B, 0x00002F1C, 0x00002F1D, 0x00002F1E, 0x00002F1F,
+    0x000002F2, 0x00002F21, 0x000202F3, 0x00002F23, 0x00002F24, 0x00002F25, 0x00002F26, 0x00002F27,
+    0x00002F28, 0x00002F29, 0x00002F2A, 0x00002F2B, 0x00002F2C, 0x00002F2D, 0x00002F2E, 0x00002F2F,
+    0x000002F3, 0x00002F31, 0x00002F32, 0x000402F4, 0x00002F34, 0x00002F35, 0x00002F36, 0x00002F37,
+    0x00002F38, 0x00002F39, 0x00002F3A, 0x00002F3B, 0x00002F3C, 0x00002F3D, 0x00002F3E, 0x00002F3F,
+    0x000002F4, 0x00002F41, 0x00002F42, 0x00002F43, 0x000802F5, 0x00002F45, 0x00002F46, 0x00002F47,
+    0x00002F48, 0x00002F49, 0x00002F4A, 0x00002F4B, 0x00002F4C, 0x00002F4D, 0x00002F4E, 0x00002F4F,
+    0x000002F5, 0x00002F51, 0x00002F52, 0x00002F53, 0x00002F54, 0x001002F6, 0x00002F56, 0x00002F57,
+    0x00002F58, 0x00002F59, 0x00002F5A, 0x00002F5B, 0x00002F5C, 0x00002F5D, 0x00002F5E, 0x00002F5F,
+    0x000002F6, 0x00002F61, 0x00002F62, 0x00002F63, 0x00002F64, 0x00002F65, 0x002002F7, 0x00002F67,
+    0x00002F68, 0x00002F69, 0x00002F6A, 0x00002F6B, 0x00002F6C, 0x00002F6D, 0x00002F6E, 0x00002F6F,
+    0x000002F7, 0x00002F71, 0x00002F72, 0x00002F73, 0x00002F74, 0x00002F75, 0x00002F76, 0x004002F8,
+    0x00002F78, 0x00002F79, 0x00002F7A, 0x00002F7B, 0x00002F7C, 0x00002F7D, 0x00002F7E, 0x00002F7F,
+    0x000002F8, 0x00002F81, 0x00002F82, 0x00002F83, 0x00002F84, 0x00002F85, 0x00002F86, 0x00002F87,
+    0x008002F9, 0x00002F89, 0x00002F8A, 0x00002F8B, 0x00002F8C, 0x00002F8D, 0x00002F8E, 0x00002F8F,
+    0x000002F9, 0x00002F91, 0x00002F92, 0x00002F93, 0x00002F94, 0x00002F95, 0x00002F96, 0x00002F97,
+    0x00002F98, 0x010002FA, 0x00002F9A, 0x00002F9B, 0x00002F9C, 0x00002F9D, 0x00002F9E, 0x00002F9F,
+    0x000002FA, 0x00002FA1, 0x00002FA2, 0x00002FA3, 0x00002FA4, 0x00002FA5, 0x00002FA6, 0x00002FA7,
+    0x00002FA8, 0x00002FA9, 0x820002FB, 0x00002FAB, 0x00002FAC, 0x00002FAD, 0x00002FAE, 0x00002FAF,
+    0x000002FB, 0x00002FB1, 0x00002FB2, 0x00002FB3, 0x00002FB4, 0x00002FB5, 0x00002FB6, 0x00002FB7,
+    0x00002FB8, 0x00002FB9, 0x00002FBA, 0x040002FC, 0x00002FBC, 0x00002FBD, 0x00002FBE, 0x00002FBF,
+    0x000002FC, 0x00002FC1, 0x00002FC2, 0x00002FC3, 0x00002FC4, 0x00002FC5, 0x00002FC6, 0x00002FC7,
+    0x00002FC8, 0x00002FC9, 0x00002FCA, 0x00002FCB, 0x080002FD, 0x00002FCD, 0x00002FCE, 0x00002FCF,
+    0x000002FD, 0x00002FD1, 0x00002FD2, 0x00002FD3, 0x00002FD4, 0x00002FD5, 0x00002FD6, 0x00002FD7,
+    0x00002FD8, 0x00002FD9, 0x00002FDA, 0x00002FDB, 0x00002FDC, 0x100002FE, 0x00002FDE, 0x00002FDF,
+    0x000002FE, 0x00002FE1, 0x00002FE2, 0x00002FE3, 0x00002FE4, 0x00002FE5, 0x00002FE6, 0x00002FE7,
+    0x00002FE8, 0x00002FE9, 0x00002FEA, 0x00002FEB, 0x00002FEC, 0x00002FED, 0x200002FF, 0x00002FEF,
+    0x000002FF, 0x00002FF1, 0x00002FF2, 0x00002FF3, 0x00002FF4, 0x00002FF5, 0x00002FF6, 0x00002FF7,
+    0x00002FF8, 0x00002FF9, 0x00002FFA, 0x00002FFB, 0x00002FFC, 0x00002FFD, 0x00002FFE, 0x00002FFF,
+    0x00000003, 0x00000031, 0x00000032, 0x00040004, 0x00000034, 0x00000035, 0x00000036, 0x00000037,
+    0x00000038, 0x00000039, 0x0000003A, 0x0000003B, 0x0000003C, 0x0000003D, 0x0000003E, 0x0000003F,
+    0x00000031, 0x00010032, 0x00000312, 0x00000313, 0x00000314, 0x00000315, 0x00000316, 0x00000317,
+    0x00000318, 0x00000319, 0x0000031A, 0x0000031B, 0x0000031C, 0x0000031D, 0x0000031E, 0x0000031F,
+    0x00000032, 0x00000321, 0x00020033, 0x00000323, 0x00000324, 0x00000325, 0x00000326, 0x00000327,
+    0x00000328, 0x00000329, 0x0000032A, 0x0000032B, 0x0000032C, 0x0000032D, 0x0000032E, 0x0000032F,
+    0x00040004, 0x00040041, 0x00040042, 0x00040034, 0x00040044, 0x00040045, 0x00040046, 0x00040047,
+    0x00040048, 0x00040049, 0x0004004A, 0x0004004B, 0x0004004C, 0x0004004D, 0x0004004E, 0x0004004F,
+    0x00000034, 0x00000341, 0x00000342, 0x00000343, 0x00080035, 0x00000345, 0x00000346, 0x00000347,
+    0x00000348, 0x00000349, 0x0000034A, 0x0000034B, 0x0000034C, 0x0000034D, 0x0000034E, 0x0000034F,
+    0x00000035, 0x00000351, 0x00000352, 0x00000353, 0x00000354, 0x00100036, 0x00000356, 0x00000357,
+    0x00000358, 0x00000359, 0x0000035A, 0x0000035B, 0x0000035C, 0x0000035D, 0x0000035E, 0x0000035F,
+    0x00000036, 0x00000361, 0x00000362, 0x00000363, 0x00000364, 0x00000365, 0x00200037, 0x00000367,
+    0x00000368, 0x00000369, 0x0000036A, 0x0000036B, 0x0000036C, 0x0000036D, 0x0000036E, 0x0000036F,
+    0x00000037, 0x00000371, 0x00000372, 0x00000373, 0x00000374, 0x00000375, 0x00000376, 0x00400038,
+    0x00000378, 0x00000379, 0x0000037A, 0x0000037B, 0x0000037C, 0x0000037D, 0x0000037E, 0x0000037F,
+    0x00000038, 0x00000381, 0x00000382, 0x00000383, 0x00000384, 0x00000385, 0x00000386, 0x00000387,
+    0x00800039, 0x00000389, 0x0000038A, 0x0000038B, 0x0000038C, 0x0000038D, 0x0000038E, 0x0000038F,
+    0x00000039, 0x00000391, 0x00000392, 0x00000393, 0x00000394, 0x00000395, 0x00000396, 0x00000397,
+    0x00000398, 0x0100003A, 0x0000039A, 0x0000039B, 0x0000039C, 0x0000039D, 0x0000039E, 0x0000039F,
+    0x0000003A, 0x000003A1, 0x000003A2, 0x000003A3, 0x000003A4, 0x000003A5, 0x000003A6, 0x000003A7,
+    0x000003A8, 0x000003A9, 0x8200003B, 0x000003AB, 0x000003AC, 0x000003AD, 0x000003AE, 0x000003AF,
+    0x0000003B, 0x000003B1, 0x000003B2, 0x000003B3, 0x000003B4, 0x000003B5, 0x000003B6, 0x000003B7,
+    0x000003B8, 0x000003B9, 0x000003BA, 0x0400003C, 0x000003BC, 0x000003BD, 0x000003BE, 0x000003BF,
+    0x0000003C, 0x000003C1, 0x000003C2, 0x000003C3, 0x000003C4, 0x000003C5, 0x000003C6, 0x000003C7,
+    0x000003C8, 0x000003C9, 0x000003CA, 0x000003CB, 0x0800003D, 0x000003CD, 0x000003CE, 0x000003CF,
+    0x0000003D, 0x000003D1, 0x000003D2, 0x000003D3, 0x000003D4, 0x000003D5, 0x000003D6, 0x000003D7,
+    0x000003D8, 0x000003D9, 0x000003DA, 0x000003DB, 0x000003DC, 0x1000003E, 0x000003DE, 0x000003DF,
+    0x0000003E, 0x000003E1, 0x000003E2, 0x000003E3, 0x000003E4, 0x000003E5, 0x000003E6, 0x000003E7,
+    0x000003E8, 0x000003E9, 0x000003EA, 0x000003EB, 0x000003EC, 0x000003ED, 0x2000003F, 0x000003EF,
+    0x0000003F, 0x000003F1, 0x000003F2, 0x000003F3, 0x000003F4, 0x000003F5, 0x000003F6, 0x000003F7,
+    0x000003F8, 0x000003F9, 0x000003FA, 0x000003FB, 0x000003FC, 0x000003FD, 0x000003FE, 0x000003FF,
+    0x00000031, 0x00010032, 0x00000312, 0x00000313, 0x00000314, 0x00000315, 0x00000316, 0x00000317,
+    0x00000318, 0x00000319, 0x0000031A, 0x0000031B, 0x0000031C, 0x0000031D, 0x0000031E, 0x0000031F,
+    0x00010032, 0x00010312, 0x00010322, 0x00010323, 0x00010324, 0x00010325, 0x00010326, 0x00010327,
+    0x00010328, 0x00010329, 0x0001032A, 0x0001032B, 0x0001032C, 0x0001032D, 0x0001032E, 0x0001032F,
+    0x00000312, 0x00003121, 0x00020313, 0x00003123, 0x00003124, 0x00003125, 0x00003126, 0x00003127,
+    0x00003128, 0x00003129, 0x0000312A, 0x0000312B, 0x0000312C, 0x0000312D, 0x0000312E, 0x0000312F,
+    0x00000313, 0x00003131, 0x00003132, 0x00040314, 0x00003134, 0x00003135, 0x00003136, 0x00003137,
+    0x00003138, 0x00003139, 0x0000313A, 0x0000313B, 0x0000313C, 0x0000313D, 0x0000313E, 0x0000313F,
+    0x00000314, 0x00003141, 0x00003142, 0x00003143, 0x00080315, 0x00003145, 0x00003146, 0x00003147,
+    0x00003148, 0x00003149, 0x0000314A, 0x0000314B, 0x0000314C, 0x0000314D, 0x0000314E, 0x0000314F,
+    0x00000315, 0x00003151, 0x00003152, 0x00003153, 0x00003154, 0x00100316, 0x00003156, 0x00003157,
+    0x00003158, 0x00003159, 0x0000315A, 0x0000315B, 0x0000315C, 0x0000315D, 0x0000315E, 0x0000315F,
+    0x00000316, 0x00003161, 0x00003162, 0x00003163, 0x00003164, 0x00003165, 0x00200317, 0x00003167,
+    0x00003168, 0x00003169, 0x0000316A, 0x0000316B, 0x0000316C, 0x0000316D, 0x0000316E, 0x0000316F,
+    0x00000317, 0x00003171, 0x00003172, 0x00003173, 0x00003174, 0x00003175, 0x00003176, 0x00400318,
+    0x00003178, 0x00003179, 0x0000317A, 0x0000317B, 0x0000317C, 0x0000317D, 0x0000317E, 0x0000317F,
+    0x00000318, 0x00003181, 0x00003182, 0x00003183, 0x00003184, 0x00003185, 0x00003186, 0x00003187,
+    0x00800319, 0x00003189, 0x0000318A, 0x0000318B, 0x0000318C, 0x0000318D, 0x0000318E, 0x0000318F,
+    0x00000319, 0x00003191, 0x00003192, 0x00003193, 0x00003194, 0x00003195, 0x00003196, 0x00003197,
+    0x00003198, 0x0100031A, 0x0000319A, 0x0000319B, 0x0000319C, 0x0000319D, 0x0000319E, 0x0000319F,
+    0x0000031A, 0x000031A1, 0x000031A2, 0x000031A3, 0x000031A4, 0x000031A5, 0x000031A6, 0x000031A7,
+    0x000031A8, 0x000031A9, 0x8200031B, 0x000031AB, 0x000031AC, 0x000031AD, 0x000031AE, 0x000031AF,
+    0x0000031B, 0x000031B1, 0x000031B2, 0x000031B3, 0x000031B4, 0x000031B5, 0x000031B6, 0x000031B7,
+    0x000031B8, 0x000031B9, 0x000031BA, 0x0400031C, 0x000031BC, 0x000031BD, 0x000031BE, 0x000031BF,
+    0x0000031C, 0x000031C1, 0x000031C2, 0x000031C3, 0x000031C4, 0x000031C5, 0x000031C6, 0x000031C7,
+    0x000031C8, 0x000031C9, 0x000031CA, 0x000031CB, 0x0800031D, 0x000031CD, 0x000031CE, 0x000031CF,
+    0x0000031D, 0x000031D1, 0x000031D2, 0x000031D3, 0x000031D4, 0x000031D5, 0x000031D6, 0x000031D7,
+    0x000031D8, 0x000031D9, 0x000031DA, 0x000031DB, 0x000031DC, 0x1000031E, 0x000031DE, 0x000031DF,
+    0x0000031E, 0x000031E1, 0x000031E2, 0x000031E3, 0x000031E4, 0x000031E5, 0x000031E6, 0x000031E7,
+    0x000031E8, 0x000031E9, 0x000031EA, 0x000031EB, 0x000031EC, 0x000031ED, 0x2000031F, 0x000031EF,
+    0x0000031F, 0x000031F1, 0x000031F2, 0x000031F3, 0x000031F4, 0x000031F5, 0x000031F6, 0x000031F7,
+    0x000031F8, 0x000031F9, 0x000031FA, 0x000031FB, 0x000031FC, 0x000031FD, 0x000031FE, 0x000031FF,
+    0x00000032, 0x00000321, 0x00020033, 0x00000323, 0x00000324, 0x00000325, 0x00000326, 0x00000327,
+    0x00000328, 0x00000329, 0x0000032A, 0x0000032B, 0x0000032C, 0x0000032D, 0x0000032E, 0x0000032F,
+    0x00000321, 0x00010322, 0x00003212, 0x00003213, 0x00003214, 0x00003215, 0x00003216, 0x00003217,
+    0x00003218, 0x00003219, 0x0000321A, 0x0000321B, 0x0000321C, 0x0000321D, 0x0000321E, 0x0000321F,
+    0x00020033, 0x00020331, 0x00020323, 0x00020333, 0x00020334, 0x00020335, 0x00020336, 0x00020337,
+    0x00020338, 0x00020339, 0x0002033A, 0x0002033B, 0x0002033C, 0x0002033D, 0x0002033E, 0x0002033F,
+    0x00000323, 0x00003231, 0x00003232, 0x00040324, 0x00003234, 0x00003235, 0x00003236, 0x00003237,
+    0x00003238, 0x00003239, 0x0000323A, 0x0000323B, 0x0000323C, 0x0000323D, 0x0000323E, 0x0000323F,
+    0x00000324, 0x00003241, 0x00003242, 0x00003243, 0x00080325, 0x00003245, 0x00003246, 0x00003247,
+    0x00003248, 0x00003249, 0x0000324A, 0x0000324B, 0x0000324C, 0x0000324D, 0x0000324E, 0x0000324F,
+    0x00000325, 0x00003251, 0x00003252, 0x00003253, 0x00003254, 0x00100326, 0x00003256, 0x00003257,
+    0x00003258, 0x00003259, 0x0000325A, 0x0000325B, 0x0000325C, 0x0000325D, 0x0000325E, 0x0000325F,
+    0x00000326, 0x00003261, 0x00003262, 0x00003263, 0x00003264, 0x00003265, 0x00200327, 0x00003267,
+    0x00003268, 0x00003269, 0x0000326A, 0x0000326B, 0x0000326C, 0x0000326D, 0x0000326E, 0x0000326F,
+    0x00000327, 0x00003271, 0x00003272, 0x00003273, 0x00003274, 0x00003275, 0x00003276, 0x00400328,
+    0x00003278, 0x00003279, 0x0000327A, 0x0000327B, 0x0000327C, 0x0000327D, 0x0000327E, 0x0000327F,
+    0x00000328, 0x00003281, 0x00003282, 0x00003283, 0x00003284, 0x00003285, 0x00003286, 0x00003287,
+    0x00800329, 0x00003289, 0x0000328A, 0x0000328B, 0x0000328C, 0x0000328D, 0x0000328E, 0x0000328F,
+    0x00000329, 0x00003291, 0x00003292, 0x00003293, 0x00003294, 0x00003295, 0x00003296, 0x00003297,
+    0x00003298, 0x0100032A, 0x0000329A, 0x0000329B, 0x0000329C, 0x0000329D, 0x0000329E, 0x0000329F,
+    0x0000032A, 0x000032A1, 0x000032A2, 0x000032A3, 0x000032A4, 0x000032A5, 0x000032A6, 0x000032A7,
+    0x000032A8, 0x000032A9, 0x8200032B, 0x000032AB, 0x000032AC, 0x000032AD, 0x000032AE, 0x000032AF,
+    0x0000032B, 0x000032B1, 0x000032B2, 0x000032B3, 0x000032B4, 0x000032B5, 0x000032B6, 0x000032B7,
+    0x000032B8, 0x000032B9, 0x000032BA, 0x0400032C, 0x000032BC, 0x000032BD, 0x000032BE, 0x000032BF,
+    0x0000032C, 0x000032C1, 0x000032C2, 0x000032C3, 0x000032C4, 0x000032C5, 0x000032C6, 0x000032C7,
+    0x000032C8, 0x000032C9, 0x000032CA, 0x000032CB, 0x0800032D, 0x000032CD, 0x000032CE, 0x000032CF,
+    0x0000032D, 0x000032D1, 0x000032D2, 0x000032D3, 0x000032D4, 0x000032D5, 0x000032D6, 0x000032D7,
+    0x000032D8, 0x000032D9, 0x000032DA, 0x000032DB, 0x000032DC, 0x1000032E, 0x000032DE, 0x000032DF,
+    0x0000032E, 0x000032E1, 0x000032E2, 0x000032E3, 0x000032E4, 0x000032E5, 0x000032E6, 0x000032E7,
+    0x000032E8, 0x000032E9, 0x000032EA, 0x000032EB, 0x000032EC, 0x000032ED, 0x2000032F, 0x000032EF,
+    0x0000032F, 0x000032F1, 0x000032F2, 0x000032F3, 0x000032F4, 0x000032F5, 0x000032F6, 0x000032F7,
+    0x000032F8, 0x000032F9, 0x000032FA, 0x000032FB, 0x000032FC, 0x000032FD, 0x000032FE, 0x000032FF,
+    0x00040004, 0x00040041, 0x00040042, 0x00040034, 0x00040044, 0x00040045, 0x00040046, 0x00040047,
+    0x00040048, 0x00040049, 0x0004004A, 0x0004004B, 0x0004004C, 0x0004004D, 0x0004004E, 0x0004004F,
+    0x00040041, 0x00050042, 0x00040412, 0x00040413, 0x00040414, 0x00040415, 0x00040416, 0x00040417,
+    0x00040418, 0x00040419, 0x0004041A, 0x0004041B, 0x0004041C, 0x0004041D, 0x0004041E, 0x0004041F,
+    0x00040042, 0x00040421, 0x00060043, 0x00040423, 0x00040424, 0x00040425, 0x00040426, 0x00040427,
+    0x00040428, 0x00040429, 0x0004042A, 0x0004042B, 0x0004042C, 0x0004042D, 0x0004042E, 0x0004042F,
+    0x00040034, 0x00040341, 0x00040342, 0x00080044, 0x00040344, 0x00040345, 0x00040346, 0x00040347,
+    0x00040348, 0x00040349, 0x0004034A, 0x0004034B, 0x0004034C, 0x0004034D, 0x0004034E, 0x0004034F,
+    0x00040044, 0x00040441, 0x00040442, 0x00040443, 0x000C0045, 0x00040445, 0x00040446, 0x00040447,
+    0x00040448, 0x00040449, 0x0004044A, 0x0004044B, 0x0004044C, 0x0004044D, 0x0004044E, 0x0004044F,
+    0x00040045, 0x00040451, 0x00040452, 0x00040453, 0x00040454, 0x00140046, 0x00040456, 0x00040457,
+    0x00040458, 0x00040459, 0x0004045A, 0x0004045B, 0x0004045C, 0x0004045D, 0x0004045E, 0x0004045F,
+    0x00040046, 0x00040461, 0x00040462, 0x00040463, 0x00040464, 0x00040465, 0x00240047, 0x00040467,
+    0x00040468, 0x00040469, 0x0004046A, 0x0004046B, 0x0004046C, 0x0004046D, 0x0004046E, 0x0004046F,
+    0x00040047, 0x00040471, 0x00040472, 0x00040473, 0x00040474, 0x00040475, 0x00040476, 0x00440048,
+    0x00040478, 0x00040479, 0x0004047A, 0x0004047B, 0x0004047C, 0x0004047D, 0x0004047E, 0x0004047F,
+    0x00040048, 0x00040481, 0x00040482, 0x00040483, 0x00040484, 0x00040485, 0x00040486, 0x00040487,
+    0x00840049, 0x00040489, 0x0004048A, 0x0004048B, 0x0004048C, 0x0004048D, 0x0004048E, 0x0004048F,
+    0x00040049, 0x00040491, 0x00040492, 0x00040493, 0x00040494, 0x00040495, 0x00040496, 0x00040497,
+    0x00040498, 0x0104004A, 0x0004049A, 0x0004049B, 0x0004049C, 0x0004049D, 0x0004049E, 0x0004049F,
+    0x0004004A, 0x000404A1, 0x000404A2, 0x000404A3, 0x000404A4, 0x000404A5, 0x000404A6, 0x000404A7,
+    0x000404A8, 0x000404A9, 0x8204004B, 0x000404AB, 0x000404AC, 0x000404AD, 0x000404AE, 0x000404AF,
+    0x0004004B, 0x000404B1, 0x000404B2, 0x000404B3, 0x000404B4, 0x000404B5, 0x000404B6, 0x000404B7,
+    0x000404B8, 0x000404B9, 0x000404BA, 0x0404004C, 0x000404BC, 0x000404BD, 0x000404BE, 0x000404BF,
+    0x0004004C, 0x000404C1, 0x000404C2, 0x000404C3, 0x000404C4, 0x000404C5, 0x000404C6, 0x000404C7,
+    0x000404C8, 0x000404C9, 0x000404CA, 0x000404CB, 0x0804004D, 0x000404CD, 0x000404CE, 0x000404CF,
+    0x0004004D, 0x000404D1, 0x000404D2, 0x000404D3, 0x000404D4, 0x000404D5, 0x000404D6, 0x000404D7,
+    0x000404D8, 0x000404D9, 0x000404DA, 0x000404DB, 0x000404DC, 0x1004004E, 0x000404DE, 0x000404DF,
+    0x0004004E, 0x000404E1, 0x000404E2, 0x000404E3, 0x000404E4, 0x000404E5, 0x000404E6, 0x000404E7,
+    0x000404E8, 0x000404E9, 0x000404EA, 0x000404EB, 0x000404EC, 0x000404ED, 0x2004004F, 0x000404EF,
+    0x0004004F, 0x000404F1, 0x000404F2, 0x000404F3, 0x000404F4, 0x000404F5, 0x000404F6, 0x000404F7,
+    0x000404F8, 0x000404F9, 0x000404FA, 0x000404FB, 0x000404FC, 0x000404FD, 0x000404FE, 0x000404FF,
+    0x00000034, 0x00000341, 0x00000342, 0x00000343, 0x00080035, 0x00000345, 0x00000346, 0x00000347,
+    0x00000348, 0x00000349, 0x0000034A, 0x0000034B, 0x0000034C, 0x0000034D, 0x0000034E, 0x0000034F,
+    0x00000341, 0x00010342, 0x00003412, 0x00003413, 0x00003414, 0x00003415, 0x00003416, 0x00003417,
+    0x00003418, 0x00003419, 0x0000341A, 0x0000341B, 0x0000341C, 0x0000341D, 0x0000341E, 0x0000341F,
+    0x00000342, 0x00003421, 0x00020343, 0x00003423, 0x00003424, 0x00003425, 0x00003426, 0x00003427,
+    0x00003428, 0x00003429, 0x0000342A, 0x0000342B, 0x0000342C, 0x0000342D, 0x0000342E, 0x0000342F,
+    0x00000343, 0x00003431, 0x00003432, 0x00040344, 0x00003434, 0x00003435, 0x00003436, 0x00003437,
+    0x00003438, 0x00003439, 0x0000343A, 0x0000343B, 0x0000343C, 0x0000343D, 0x0000343E, 0x0000343F,
+    0x00080035, 0x00080351, 0x00080352, 0x00080353, 0x00080345, 0x00080355, 0x00080356, 0x00080357,
+    0x00080358, 0x00080359, 0x0008035A, 0x0008035B, 0x0008035C, 0x0008035D, 0x0008035E, 0x0008035F,
+    0x00000345, 0x00003451, 0x00003452, 0x00003453, 0x00003454, 0x00100346, 0x00003456, 0x00003457,
+    0x00003458, 0x00003459, 0x0000345A, 0x0000345B, 0x0000345C, 0x0000345D, 0x0000345E, 0x0000345F,
+    0x00000346, 0x00003461, 0x00003462, 0x00003463, 0x00003464, 0x00003465, 0x00200347, 0x00003467,
+    0x00003468, 0x00003469, 0x0000346A, 0x0000346B, 0x0000346C, 0x0000346D, 0x0000346E, 0x0000346F,
+    0x00000347, 0x00003471, 0x00003472, 0x00003473, 0x00003474, 0x00003475, 0x00003476, 0x00400348,
+    0x00003478, 0x00003479, 0x0000347A, 0x0000347B, 0x0000347C, 0x0000347D, 0x0000347E, 0x0000347F,
+    0x00000348, 0x00003481, 0x00003482, 0x00003483, 0x00003484, 0x00003485, 0x00003486, 0x00003487,
+    0x00800349, 0x00003489, 0x0000348A, 0x0000348B, 0x0000348C, 0x0000348D, 0x0000348E, 0x0000348F,
+    0x00000349, 0x00003491, 0x00003492, 0x00003493, 0x00003494, 0x00003495, 0x00003496, 0x00003497,
+    0x00003498, 0x0100034A, 0x0000349A, 0x0000349B, 0x0000349C, 0x0000349D, 0x0000349E, 0x0000349F,
+    0x0000034A, 0x000034A1, 0x000034A2, 0x000034A3, 0x000034A4, 0x000034A5, 0x000034A6, 0x000034A7,
+    0x000034A8, 0x000034A9, 0x8200034B, 0x000034AB, 0x000034AC, 0x000034AD, 0x000034AE, 0x000034AF,
+    0x0000034B, 0x000034B1, 0x000034B2, 0x000034B3, 0x000034B4, 0x000034B5, 0x000034B6, 0x000034B7,
+    0x000034B8, 0x000034B9, 0x000034BA, 0x0400034C, 0x000034BC, 0x000034BD, 0x000034BE, 0x000034BF,
+    0x0000034C, 0x000034C1, 0x000034C2, 0x000034C3, 0x000034C4, 0x000034C5, 0x000034C6, 0x000034C7,
+    0x000034C8, 0x000034C9, 0x000034CA, 0x000034CB, 0x0800034D, 0x000034CD, 0x000034CE, 0x000034CF,
+    0x0000034D, 0x000034D1, 0x000034D2, 0x000034D3, 0x000034D4, 0x000034D5, 0x000034D6, 0x000034D7,
+    0x000034D8, 0x000034D9, 0x000034DA, 0x000034DB, 0x000034DC, 0x1000034E, 0x000034DE, 0x000034DF,
+    0x0000034E, 0x000034E1, 0x000034E2, 0x000034E3, 0x000034E4, 0x000034E5, 0x000034E6, 0x000034E7,
+    0x000034E8, 0x000034E9, 0x000034EA, 0x000034EB, 0x000034EC, 0x000034ED, 0x2000034F, 0x000034EF,
+    0x0000034F, 0x000034F1, 0x000034F2, 0x000034F3, 0x000034F4, 0x000034F5, 0x000034F6, 0x000034F7,
+    0x000034F8, 0x000034F9, 0x000034FA, 0x000034FB, 0x000034FC, 0x000034FD, 0x000034FE, 0x000034FF,
+    0x00000035, 0x00000351, 0x00000352, 0x00000353, 0x00000354, 0x00100036, 0x00000356, 0x00000357,
+    0x00000358, 0x00000359, 0x0000035A, 0x0000035B, 0x0000035C, 0x0000035D, 0x0000035E, 0x0000035F,
+    0x00000351, 0x00010352, 0x00003512, 0x00003513, 0x00003514, 0x00003515, 0x00003516, 0x00003517,
+    0x00003518, 0x00003519, 0x0000351A, 0x0000351B, 0x0000351C, 0x0000351D, 0x0000351E, 0x0000351F,
+    0x00000352, 0x00003521, 0x00020353, 0x00003523, 0x00003524, 0x00003525, 0x00003526, 0x00003527,
+    0x00003528, 0x00003529, 0x0000352A, 0x0000352B, 0x0000352C, 0x0000352D, 0x0000352E, 0x0000352F,
+    0x00000353, 0x00003531, 0x00003532, 0x00040354, 0x00003534, 0x00003535, 0x00003536, 0x00003537,
+    0x00003538, 0x00003539, 0x0000353A, 0x0000353B, 0x0000353C, 0x0000353D, 0x0000353E, 0x0000353F,
+    0x00000354, 0x00003541, 0x00003542, 0x00003543, 0x00080355, 0x00003545, 0x00003546, 0x00003547,
+    0x00003548, 0x00003549, 0x0000354A, 0x0000354B, 0x0000354C, 0x0000354D, 0x0000354E, 0x0000354F,
+    0x00100036, 0x00100361, 0x00100362, 0x00100363, 0x00100364, 0x00100356, 0x00100366, 0x00100367,
+    0x00100368, 0x00100369, 0x0010036A, 0x0010036B, 0x0010036C, 0x0010036D, 0x0010036E, 0x0010036F,
+    0x00000356, 0x00003561, 0x00003562, 0x00003563, 0x00003564, 0x00003565, 0x00200357, 0x00003567,
+    0x00003568, 0x00003569, 0x0000356A, 0x0000356B, 0x0000356C, 0x0000356D, 0x0000356E, 0x0000356F,
+    0x00000357, 0x00003571, 0x00003572, 0x00003573, 0x00003574, 0x00003575, 0x00003576, 0x00400358,
+    0x00003578, 0x00003579, 0x0000357A, 0x0000357B, 0x0000357C, 0x0000357D, 0x0000357E, 0x0000357F,
+    0x00000358, 0x00003581, 0x00003582, 0x00003583, 0x00003584, 0x00003585, 0x00003586, 0x00003587,
+    0x00800359, 0x00003589, 0x0000358A, 0x0000358B, 0x0000358C, 0x0000358D, 0x0000358E, 0x0000358F,
+    0x00000359, 0x00003591, 0x00003592, 0x00003593, 0x00003594, 0x00003595, 0x00003596, 0x00003597,
+    0x00003598, 0x0100035A, 0x0000359A, 0x0000359B, 0x0000359C, 0x0000359D, 0x0000359E, 0x0000359F,
+    0x0000035A, 0x000035A1, 0x000035A2, 0x000035A3, 0x000035A4, 0x000035A5, 0x000035A6, 0x000035A7,
+    0x000035A8, 0x000035A9, 0x8200035B, 0x000035AB, 0x000035AC, 0x000035AD, 0x000035AE, 0x000035AF,
+    0x0000035B, 0x000035B1, 0x000035B2, 0x000035B3, 0x000035B4, 0x000035B5, 0x000035B6, 0x000035B7,
+    0x000035B8, 0x000035B9, 0x000035BA, 0x0400035C, 0x000035BC, 0x000035BD, 0x000035BE, 0x000035BF,
+    0x0000035C, 0x000035C1, 0x000035C2, 0x000035C3, 0x000035C4, 0x000035C5, 0x000035C6, 0x000035C7,
+    0x000035C8, 0x000035C9, 0x000035CA, 0x000035CB, 0x0800035D, 0x000035CD, 0x000035CE, 0x000035CF,
+    0x0000035D, 0x000035D1, 0x000035D2, 0x000035D3, 0x000035D4, 0x000035D5, 0x000035D6, 0x000035D7,
+    0x000035D8, 0x000035D9, 0x000035DA, 0x000035DB, 0x000035DC, 0x1000035E, 0x000035DE, 0x000035DF,
+    0x0000035E, 0x000035E1, 0x000035E2, 0x000035E3, 0x000035E4, 0x000035E5, 0x000035E6, 0x000035E7,
+    0x000035E8, 0x000035E9, 0x000035EA, 0x000035EB, 0x000035EC, 0x000035ED, 0x2000035F, 0x000035EF,
+    0x0000035F, 0x000035F1, 0x000035F2, 0x000035F3, 0x000035F4, 0x000035F5, 0x000035F6, 0x000035F7,
+    0x000035F8, 0x000035F9, 0x000035FA, 0x000035FB, 0x000035FC, 0x000035FD, 0x000035FE, 0x000035FF,
+    0x00000036, 0x00000361, 0x00000362, 0x00000363, 0x00000364, 0x00000365, 0x00200037, 0x00000367,
+    0x00000368, 0x00000369, 0x0000036A, 0x0000036B, 0x0000036C, 0x0000036D, 0x0000036E, 0x0000036F,
+    0x00000361, 0x00010362, 0x00003612, 0x00003613, 0x00003614, 0x00003615, 0x00003616, 0x00003617,
+    0x00003618, 0x00003619, 0x0000361A, 0x0000361B, 0x0000361C, 0x0000361D, 0x0000361E, 0x0000361F,
+    0x00000362, 0x00003621, 0x00020363, 0x00003623, 0x00003624, 0x00003625, 0x00003626, 0x00003627,
+    0x00003628, 0x00003629, 0x0000362A, 0x0000362B, 0x0000362C, 0x0000362D, 0x0000362E, 0x0000362F,
+    0x00000363, 0x00003631, 0x00003632, 0x00040364, 0x00003634, 0x00003635, 0x00003636, 0x00003637,
+    0x00003638, 0x00003639, 0x0000363A, 0x0000363B, 0x0000363C, 0x0000363D, 0x0000363E, 0x0000363F,
+    0x00000364, 0x00003641, 0x00003642, 0x00003643, 0x00080365, 0x00003645, 0x00003646, 0x00003647,
+    0x00003648, 0x00003649, 0x0000364A, 0x0000364B, 0x0000364C, 0x0000364D, 0x0000364E, 0x0000364F,
+    0x00000365, 0x00003651, 0x00003652, 0x00003653, 0x00003654, 0x00100366, 0x00003656, 0x00003657,
+    0x00003658, 0x00003659, 0x0000365A, 0x0000365B, 0x0000365C, 0x0000365D, 0x0000365E, 0x0000365F,
+    0x00200037, 0x00200371, 0x00200372, 0x00200373, 0x00200374, 0x00200375, 0x00200367, 0x00200377,
+    0x00200378, 0x00200379, 0x0020037A, 0x0020037B, 0x0020037C, 0x0020037D, 0x0020037E, 0x0020037F,
+    0x00000367, 0x00003671, 0x00003672, 0x00003673, 0x00003674, 0x00003675, 0x00003676, 0x00400368,
+    0x00003678, 0x00003679, 0x0000367A, 0x0000367B, 0x0000367C, 0x0000367D, 0x0000367E, 0x0000367F,
+    0x00000368, 0x00003681, 0x00003682, 0x00003683, 0x00003684, 0x00003685, 0x00003686, 0x00003687,
+    0x00800369, 0x00003689, 0x0000368A, 0x0000368B, 0x0000368C, 0x0000368D, 0x0000368E, 0x0000368F,
+    0x00000369, 0x00003691, 0x00003692, 0x00003693, 0x00003694, 0x00003695, 0x00003696, 0x00003697,
+    0x00003698, 0x0100036A, 0x0000369A, 0x0000369B, 0x0000369C, 0x0000369D, 0x0000369E, 0x0000369F,
+    0x0000036A, 0x000036A1, 0x000036A2, 0x000036A3, 0x000036A4, 0x000036A5, 0x000036A6, 0x000036A7,
+    0x000036A8, 0x000036A9, 0x8200036B, 0x000036AB, 0x000036AC, 0x000036AD, 0x000036AE, 0x000036AF,
+    0x0000036B, 0x000036B1, 0x000036B2, 0x000036B3, 0x000036B4, 0x000036B5, 0x000036B6, 0x000036B7,
+    0x000036B8, 0x000036B9, 0x000036BA, 0x0400036C, 0x000036BC, 0x000036BD, 0x000036BE, 0x000036BF,
+    0x0000036C, 0x000036C1, 0x000036C2, 0x000036C3, 0x000036C4, 0x000036C5, 0x000036C6, 0x000036C7,
+    0x000036C8, 0x000036C9, 0x000036CA, 0x000036CB, 0x0800036D, 0x000036CD, 0x000036CE, 0x000036CF,
+    0x0000036D, 0x000036D1, 0x000036D2, 0x000036D3, 0x000036D4, 0x000036D5, 0x000036D6, 0x000036D7,
+    0x000036D8, 0x000036D9, 0x000036DA, 0x000036DB, 0x000036DC, 0x1000036E, 0x000036DE, 0x000036DF,
+    0x0000036E, 0x000036E1, 0x000036E2, 0x000036E3, 0x000036E4, 0x000036E5, 0x000036E6, 0x000036E7,
+    0x000036E8, 0x000036E9, 0x000036EA, 0x000036EB, 0x000036EC, 0x000036ED, 0x2000036F, 0x000036EF,
+    0x0000036F, 0x000036F1, 0x000036F2, 0x000036F3, 0x000036F4, 0x000036F5, 0x000036F6, 0x000036F7,
+    0x000036F8, 0x000036F9, 0x000036FA, 0x000036FB, 0x000036FC, 0x000036FD, 0x000036FE, 0x000036FF,
+    0x00000037, 0x00000371, 0x00000372, 0x00000373, 0x00000374, 0x00000375, 0x00000376, 0x00400038,
+    0x00000378, 0x00000379, 0x0000037A, 0x0000037B, 0x0000037C, 0x0000037D, 0x0000037E, 0x0000037F,
+    0x00000371, 0x00010372, 0x00003712, 0x00003713, 0x00003714, 0x00003715, 0x00003716, 0x00003717,
+    0x00003718, 0x00003719, 0x0000371A, 0x0000371B, 0x0000371C, 0x0000371D, 0x0000371E, 0x0000371F,
+    0x00000372, 0x00003721, 0x00020373, 0x00003723, 0x00003724, 0x00003725, 0x00003726, 0x00003727,
+    0x00003728, 0x00003729, 0x0000372A, 0x0000372B, 0x0000372C, 0x0000372D, 0x0000372E, 0x0000372F,
+    0x00000373, 0x00003731, 0x00003732, 0x00040374, 0x00003734, 0x00003735, 0x00003736, 0x00003737,
+    0x00003738, 0x00003739, 0x0000373A, 0x0000373B, 0x0000373C, 0x0000373D, 0x0000373E, 0x0000373F,
+    0x00000374, 0x00003741, 0x00003742, 0x00003743, 0x00080375, 0x00003745, 0x00003746, 0x00003747,
+    0x00003748, 0x00003749, 0x0000374A, 0x0000374B, 0x0000374C, 0x0000374D, 0x0000374E, 0x0000374F,
+    0x00000375, 0x00003751, 0x00003752, 0x00003753, 0x00003754, 0x00100376, 0x00003756, 0x00003757,
+    0x00003758, 0x00003759, 0x0000375A, 0x0000375B, 0x0000375C, 0x0000375D, 0x0000375E, 0x0000375F,
+    0x00000376, 0x00003761, 0x00003762, 0x00003763, 0x00003764, 0x00003765, 0x00200377, 0x00003767,
+    0x00003768, 0x00003769, 0x0000376A, 0x0000376B, 0x0000376C, 0x0000376D, 0x0000376E, 0x0000376F,
+    0x00400038, 0x00400381, 0x00400382, 0x00400383, 0x00400384, 0x00400385, 0x00400386, 0x00400378,
+    0x00400388, 0x00400389, 0x0040038A, 0x0040038B, 0x0040038C, 0x0040038D, 0x0040038E, 0x0040038F,
+    0x00000378, 0x00003781, 0x00003782, 0x00003783, 0x00003784, 0x00003785, 0x00003786, 0x00003787,
+    0x00800379, 0x00003789, 0x0000378A, 0x0000378B, 0x0000378C, 0x0000378D, 0x0000378E, 0x0000378F,
+    0x00000379, 0x00003791, 0x00003792, 0x00003793, 0x00003794, 0x00003795, 0x00003796, 0x00003797,
+    0x00003798, 0x0100037A, 0x0000379A, 0x0000379B, 0x0000379C, 0x0000379D, 0x0000379E, 0x0000379F,
+    0x0000037A, 0x000037A1, 0x000037A2, 0x000037A3, 0x000037A4, 0x000037A5, 0x000037A6, 0x000037A7,
+    0x000037A8, 0x000037A9, 0x8200037B, 0x000037AB, 0x000037AC, 0x000037AD, 0x000037AE, 0x000037AF,
+    0x0000037B, 0x000037B1, 0x000037B2, 0x000037B3, 0x000037B4, 0x000037B5, 0x000037B6, 0x000037B7,
+    0x000037B8, 0x000037B9, 0x000037BA, 0x0400037C, 0x000037BC, 0x000037BD, 0x000037BE, 0x000037BF,
+    0x0000037C, 0x000037C1, 0x000037C2, 0x000037C3, 0x000037C4, 0x000037C5, 0x000037C6, 0x000037C7,
+    0x000037C8, 0x000037C9, 0x000037CA, 0x000037CB, 0x0800037D, 0x000037CD, 0x000037CE, 0x000037CF,
+    0x0000037D, 0x000037D1, 0x000037D2, 0x000037D3, 0x000037D4, 0x000037D5, 0x000037D6, 0x000037D7,
+    0x000037D8, 0x000037D9, 0x000037DA, 0x000037DB, 0x000037DC, 0x1000037E, 0x000037DE, 0x000037DF,
+    0x0000037E, 0x000037E1, 0x000037E2, 0x000037E3, 0x000037E4, 0x000037E5, 0x000037E6, 0x000037E7,
+    0x000037E8, 0x000037E9, 0x000037EA, 0x000037EB, 0x000037EC, 0x000037ED, 0x2000037F, 0x000037EF,
+    0x0000037F, 0x000037F1, 0x000037F2, 0x000037F3, 0x000037F4, 0x000037F5, 0x000037F6, 0x000037F7,
+    0x000037F8, 0x000037F9, 0x000037FA, 0x000037FB, 0x000037FC, 0x000037FD, 0x000037FE, 0x000037FF,
+    0x00000038, 0x00000381, 0x00000382, 0x00000383, 0x00000384, 0x00000385, 0x00000386, 0x00000387,
+    0x00800039, 0x00000389, 0x0000038A, 0x0000038B, 0x0000038C, 0x0000038D, 0x0000038E, 0x0000038F,
+    0x00000381, 0x00010382, 0x00003812, 0x00003813, 0x00003814, 0x00003815, 0x00003816, 0x00003817,
+    0x00003818, 0x00003819, 0x0000381A, 0x0000381B, 0x0000381C, 0x0000381D, 0x0000381E, 0x0000381F,
+    0x00000382, 0x00003821, 0x00020383, 0x00003823, 0x00003824, 0x00003825, 0x00003826, 0x00003827,
+    0x00003828, 0x00003829, 0x0000382A, 0x0000382B, 0x0000382C, 0x0000382D, 0x0000382E, 0x0000382F,
+    0x00000383, 0x00003831, 0x00003832, 0x00040384, 0x00003834, 0x00003835, 0x00003836, 0x00003837,
+    0x00003838, 0x00003839, 0x0000383A, 0x0000383B, 0x0000383C, 0x0000383D, 0x0000383E, 0x0000383F,
+    0x00000384, 0x00003841, 0x00003842, 0x00003843, 0x00080385, 0x00003845, 0x00003846, 0x00003847,
+    0x00003848, 0x00003849, 0x0000384A, 0x0000384B, 0x0000384C, 0x0000384D, 0x0000384E, 0x0000384F,
+    0x00000385, 0x00003851, 0x00003852, 0x00003853, 0x00003854, 0x00100386, 0x00003856, 0x00003857,
+    0x00003858, 0x00003859, 0x0000385A, 0x0000385B, 0x0000385C, 0x0000385D, 0x0000385E, 0x0000385F,
+    0x00000386, 0x00003861, 0x00003862, 0x00003863, 0x00003864, 0x00003865, 0x00200387, 0x00003867,
+    0x00003868, 0x00003869, 0x0000386A, 0x0000386B, 0x0000386C, 0x0000386D, 0x0000386E, 0x0000386F,
+    0x00000387, 0x00003871, 0x00003872, 0x00003873, 0x00003874, 0x00003875, 0x00003876, 0x00400388,
+    0x00003878, 0x00003879, 0x0000387A, 0x0000387B, 0x0000387C, 0x0000387D, 0x0000387E, 0x0000387F,
+    0x00800039, 0x00800391, 0x00800392, 0x00800393, 0x00800394, 0x00800395, 0x00800396, 0x00800397,
+    0x00800389, 0x00800399, 0x0080039A, 0x0080039B, 0x0080039C, 0x0080039D, 0x0080039E, 0x0080039F,
+    0x00000389, 0x00003891, 0x00003892, 0x00003893, 0x00003894, 0x00003895, 0x00003896, 0x00003897,
+    0x00003898, 0x0100038A, 0x0000389A, 0x0000389B, 0x0000389C, 0x0000389D, 0x0000389E, 0x0000389F,
+    0x0000038A, 0x000038A1, 0x000038A2, 0x000038A3, 0x000038A4, 0x000038A5, 0x000038A6, 0x000038A7,
+    0x000038A8, 0x000038A9, 0x8200038B, 0x000038AB, 0x000038AC, 0x000038AD, 0x000038AE, 0x000038AF,
+    0x0000038B, 0x000038B1, 0x000038B2, 0x000038B3, 0x000038B4, 0x000038B5, 0x000038B6, 0x000038B7,
+    0x000038B8, 0x000038B9, 0x000038BA, 0x0400038C, 0x000038BC, 0x000038BD, 0x000038BE, 0x000038BF,
+    0x0000038C, 0x000038C1, 0x000038C2, 0x000038C3, 0x000038C4, 0x000038C5, 0x000038C6, 0x000038C7,
+    0x000038C8, 0x000038C9, 0x000038CA, 0x000038CB, 0x0800038D, 0x000038CD, 0x000038CE, 0x000038CF,
+    0x0000038D, 0x000038D1, 0x000038D2, 0x000038D3, 0x000038D4, 0x000038D5, 0x000038D6, 0x000038D7,
+    0x000038D8, 0x000038D9, 0x000038DA, 0x000038DB, 0x000038DC, 0x1000038E, 0x000038DE, 0x000038DF,
+    0x0000038E, 0x000038E1, 0x000038E2, 0x000038E3, 0x000038E4, 0x000038E5, 0x000038E6, 0x000038E7,
+    0x000038E8, 0x000038E9, 0x000038EA, 0x000038EB, 0x000038EC, 0x000038ED, 0x2000038F, 0x000038EF,
+    0x0000038F, 0x000038F1, 0x000038F2, 0x000038F3, 0x000038F4, 0x000038F5, 0x000038F6, 0x000038F7,
+    0x000038F8, 0x000038F9, 0x000038FA, 0x000038FB, 0x000038FC, 0x000038FD, 0x000038FE, 0x000038FF,
+    0x00000039, 0x00000391, 0x00000392, 0x00000393, 0x00000394, 0x00000395, 0x00000396, 0x00000397,
+    0x00000398, 0x0100003A, 0x0000039A, 0x0000039B, 0x0000039C, 0x0000039D, 0x0000039E, 0x0000039F,
+    0x00000391, 0x00010392, 0x00003912, 0x00003913, 0x00003914, 0x00003915, 0x00003916, 0x00003917,
+    0x00003918, 0x00003919, 0x0000391A, 0x0000391B, 0x0000391C, 0x0000391D, 0x0000391E, 0x0000391F,
+    0x00000392, 0x00003921, 0x00020393, 0x00003923, 0x00003924, 0x00003925, 0x00003926, 0x00003927,
+    0x00003928, 0x00003929, 0x0000392A, 0x0000392B, 0x0000392C, 0x0000392D, 0x0000392E, 0x0000392F,
+    0x00000393, 0x00003931, 0x00003932, 0x00040394, 0x00003934, 0x00003935, 0x00003936, 0x00003937,
+    0x00003938, 0x00003939, 0x0000393A, 0x0000393B, 0x0000393C, 0x0000393D, 0x0000393E, 0x0000393F,
+    0x00000394, 0x00003941, 0x00003942, 0x00003943, 0x00080395, 0x00003945, 0x00003946, 0x00003947,
+    0x00003948, 0x00003949, 0x0000394A, 0x0000394B, 0x0000394C, 0x0000394D, 0x0000394E, 0x0000394F,
+    0x00000395, 0x00003951, 0x00003952, 0x00003953, 0x00003954, 0x00100396, 0x00003956, 0x00003957,
+    0x00003958, 0x00003959, 0x0000395A, 0x0000395B, 0x0000395C, 0x0000395D, 0x0000395E, 0x0000395F,
+    0x00000396, 0x00003961, 0x00003962, 0x00003963, 0x00003964, 0x00003965, 0x00200397, 0x00003967,
+    0x00003968, 0x00003969, 0x0000396A, 0x0000396B, 0x0000396C, 0x0000396D, 0x0000396E, 0x0000396F,
+    0x00000397, 0x00003971, 0x00003972, 0x00003973, 0x00003974, 0x00003975, 0x00003976, 0x00400398,
+    0x00003978, 0x00003979, 0x0000397A, 0x0000397B, 0x0000397C, 0x0000397D, 0x0000397E, 0x0000397F,
+    0x00000398, 0x00003981, 0x00003982, 0x00003983, 0x00003984, 0x00003985, 0x00003986, 0x00003987,
+    0x00800399, 0x00003989, 0x0000398A, 0x0000398B, 0x0000398C, 0x0000398D, 0x0000398E, 0x0000398F,
+    0x0100003A, 0x010003A1, 0x010003A2, 0x010003A3, 0x010003A4, 0x010003A5, 0x010003A6, 0x010003A7,
+    0x010003A8, 0x0100039A, 0x010003AA, 0x010003AB, 0x010003AC, 0x010003AD, 0x010003AE, 0x010003AF,
+    0x0000039A, 0x000039A1, 0x000039A2, 0x000039A3, 0x000039A4, 0x000039A5, 0x000039A6, 0x000039A7,
+    0x000039A8, 0x000039A9, 0x8200039B, 0x000039AB, 0x000039AC, 0x000039AD, 0x000039AE, 0x000039AF,
+    0x0000039B, 0x000039B1, 0x000039B2, 0x000039B3, 0x000039B4, 0x000039B5, 0x000039B6, 0x000039B7,
+    0x000039B8, 0x000039B9, 0x000039BA, 0x0400039C, 0x000039BC, 0x000039BD, 0x000039BE, 0x000039BF,
+    0x0000039C, 0x000039C1, 0x000039C2, 0x000039C3, 0x000039C4, 0x000039C5, 0x000039C6, 0x000039C7,
+    0x000039C8, 0x000039C9, 0x000039CA, 0x000039CB, 0x0800039D, 0x000039CD, 0x000039CE, 0x000039CF,
+    0x0000039D, 0x000039D1, 0x000039D2, 0x000039D3, 0x000039D4, 0x000039D5, 0x000039D6, 0x000039D7,
+    0x000039D8, 0x000039D9, 0x000039DA, 0x000039DB, 0x000039DC, 0x1000039E, 0x000039DE, 0x000039DF,
+    0x0000039E, 0x000039E1, 0x000039E2, 0x000039E3, 0x000039E4, 0x000039E5, 0x000039E6, 0x000039E7,
+    0x000039E8, 0x000039E9, 0x000039EA, 0x000039EB, 0x000039EC, 0x000039ED, 0x2000039F, 0x000039EF,
+    0x0000039F, 0x000039F1, 0x000039F2, 0x000039F3, 0x000039F4, 0x000039F5, 0x000039F6, 0x000039F7,
+    0x000039F8, 0x000039F9, 0x000039FA, 0x000039FB, 0x000039FC, 0x000039FD, 0x000039FE, 0x000039FF,
+    0x0000003A, 0x000003A1, 0x000003A2, 0x000003A3, 0x000003A4, 0x000003A5, 0x000003A6, 0x000003A7,
+    0x000003A8, 0x000003A9, 0x8200003B, 0x000003AB, 0x000003AC, 0x000003AD, 0x000003AE, 0x000003AF,
+    0x000003A1, 0x000103A2, 0x00003A12, 0x00003A13, 0x00003A14, 0x00003A15, 0x00003A16, 0x00003A17,
+    0x00003A18, 0x00003A19, 0x00003A1A, 0x00003A1B, 0x00003A1C, 0x00003A1D, 0x00003A1E, 0x00003A1F,
+    0x000003A2, 0x00003A21, 0x000203A3, 0x00003A23, 0x00003A24, 0x00003A25, 0x00003A26, 0x00003A27,
+    0x00003A28, 0x00003A29, 0x00003A2A, 0x00003A2B, 0x00003A2C, 0x00003A2D, 0x00003A2E, 0x00003A2F,
+    0x000003A3, 0x00003A31, 0x00003A32, 0x000403A4, 0x00003A34, 0x00003A35, 0x00003A36, 0x00003A37,
+    0x00003A38, 0x00003A39, 0x00003A3A, 0x00003A3B, 0x00003A3C, 0x00003A3D, 0x00003A3E, 0x00003A3F,
+    0x000003A4, 0x00003A41, 0x00003A42, 0x00003A43, 0x000803A5, 0x00003A45, 0x00003A46, 0x00003A47,
+    0x00003A48, 0x00003A49, 0x00003A4A, 0x00003A4B, 0x00003A4C, 0x00003A4D, 0x00003A4E, 0x00003A4F,
+    0x000003A5, 0x00003A51, 0x00003A52, 0x00003A53, 0x00003A54, 0x001003A6, 0x00003A56, 0x00003A57,
+    0x00003A58, 0x00003A59, 0x00003A5A, 0x00003A5B, 0x00003A5C, 0x00003A5D, 0x00003A5E, 0x00003A5F,
+    0x000003A6, 0x00003A61, 0x00003A62, 0x00003A63, 0x00003A64, 0x00003A65, 0x002003A7, 0x00003A67,
+    0x00003A68, 0x00003A69, 0x00003A6A, 0x00003A6B, 0x00003A6C, 0x00003A6D, 0x00003A6E, 0x00003A6F,
+    0x000003A7, 0x00003A71, 0x00003A72, 0x00003A73, 0x00003A74, 0x00003A75, 0x00003A76, 0x004003A8,
+    0x00003A78, 0x00003A79, 0x00003A7A, 0x00003A7B, 0x00003A7C, 0x00003A7D, 0x00003A7E, 0x00003A7F,
+    0x000003A8, 0x00003A81, 0x00003A82, 0x00003A83, 0x00003A84, 0x00003A85, 0x00003A86, 0x00003A87,
+    0x008003A9, 0x00003A89, 0x00003A8A, 0x00003A8B, 0x00003A8C, 0x00003A8D, 0x00003A8E, 0x00003A8F,
+    0x000003A9, 0x00003A91, 0x00003A92, 0x00003A93, 0x00003A94, 0x00003A95, 0x00003A96, 0x00003A97,
+    0x00003A98, 0x010003AA, 0x00003A9A, 0x00003A9B, 0x00003A9C, 0x00003A9D, 0x00003A9E, 0x00003A9F,
+    0x8200003B, 0x820003B1, 0x820003B2, 0x820003B3, 0x820003B4, 0x820003B5, 0x820003B6, 0x820003B7,
+    0x820003B8, 0x820003B9, 0x820003AB, 0x820003BB, 0x820003BC, 0x820003BD, 0x820003BE, 0x820003BF,
+    0x000003AB, 0x00003AB1, 0x00003AB2, 0x00003AB3, 0x00003AB4, 0x00003AB5, 0x00003AB6, 0x00003AB7,
+    0x00003AB8, 0x00003AB9, 0x00003ABA, 0x040003AC, 0x00003ABC, 0x00003ABD, 0x00003ABE, 0x00003ABF,
+    0x000003AC, 0x00003AC1, 0x00003AC2, 0x00003AC3, 0x00003AC4, 0x00003AC5, 0x00003AC6, 0x00003AC7,
+    0x00003AC8, 0x00003AC9, 0x00003ACA, 0x00003ACB, 0x080003AD, 0x00003ACD, 0x00003ACE, 0x00003ACF,
+    0x000003AD, 0x00003AD1, 0x00003AD2, 0x00003AD3, 0x00003AD4, 0x00003AD5, 0x00003AD6, 0x00003AD7,
+    0x00003AD8, 0x00003AD9, 0x00003ADA, 0x00003ADB, 0x00003ADC, 0x100003AE, 0x00003ADE, 0x00003ADF,
+    0x000003AE, 0x00003AE1, 0x00003AE2, 0x00003AE3, 0x00003AE4, 0x00003AE5, 0x00003AE6, 0x00003AE7,
+    0x00003AE8, 0x00003AE9, 0x00003AEA, 0x00003AEB, 0x00003AEC, 0x00003AED, 0x200003AF, 0x00003AEF,
+    0x000003AF, 0x00003AF1, 0x00003AF2, 0x00003AF3, 0x00003AF4, 0x00003AF5, 0x00003AF6, 0x00003AF7,
+    0x00003AF8, 0x00003AF9, 0x00003AFA, 0x00003AFB, 0x00003AFC, 0x00003AFD, 0x00003AFE, 0x00003AFF,
+    0x0000003B, 0x000003B1, 0x000003B2, 0x000003B3, 0x000003B4, 0x000003B5, 0x000003B6, 0x000003B7,
+    0x000003B8, 0x000003B9, 0x000003BA, 0x0400003C, 0x000003BC, 0x000003BD, 0x000003BE, 0x000003BF,
+    0x000003B1, 0x000103B2, 0x00003B12, 0x00003B13, 0x00003B14, 0x00003B15, 0x00003B16, 0x00003B17,
+    0x00003B18, 0x00003B19, 0x00003B1A, 0x00003B1B, 0x00003B1C, 0x00003B1D, 0x00003B1E, 0x00003B1F,
+    0x000003B2, 0x00003B21, 0x000203B3, 0x00003B23, 0x00003B24, 0x00003B25, 0x00003B26, 0x00003B27,
+    0x00003B28, 0x00003B29, 0x00003B2A, 0x00003B2B, 0x00003B2C, 0x00003B2D, 0x00003B2E, 0x00003B2F,
+    0x000003B3, 0x00003B31, 0x00003B32, 0x000403B4, 0x00003B34, 0x00003B35, 0x00003B36, 0x00003B37,
+    0x00003B38, 0x00003B39, 0x00003B3A, 0x00003B3B, 0x00003B3C, 0x00003B3D, 0x00003B3E, 0x00003B3F,
+    0x000003B4, 0x00003B41, 0x00003B42, 0x00003B43, 0x000803B5, 0x00003B45, 0x00003B46, 0x00003B47,
+    0x00003B48, 0x00003B49, 0x00003B4A, 0x00003B4B, 0x00003B4C, 0x00003B4D, 0x00003B4E, 0x00003B4F,
+    0x000003B5, 0x00003B51, 0x00003B52, 0x00003B53, 0x00003B54, 0x001003B6, 0x00003B56, 0x00003B57,
+    0x00003B58, 0x00003B59, 0x00003B5A, 0x00003B5B, 0x00003B5C, 0x00003B5D, 0x00003B5E, 0x00003B5F,
+    0x000003B6, 0x00003B61, 0x00003B62, 0x00003B63, 0x00003B64, 0x00003B65, 0x002003B7, 0x00003B67,
+    0x00003B68, 0x00003B69, 0x00003B6A, 0x00003B6B, 0x00003B6C, 0x00003B6D, 0x00003B6E, 0x00003B6F,
+    0x000003B7, 0x00003B71, 0x00003B72, 0x00003B73, 0x00003B74, 0x00003B75, 0x00003B76, 0x004003B8,
+    0x00003B78, 0x00003B79, 0x00003B7A, 0x00003B7B, 0x00003B7C, 0x00003B7D, 0x00003B7E, 0x00003B7F,
+    0x000003B8, 0x00003B81, 0x00003B82, 0x00003B83, 0x00003B84, 0x00003B85, 0x00003B86, 0x00003B87,
+    0x008003B9, 0x00003B89, 0x00003B8A, 0x00003B8B, 0x00003B8C, 0x00003B8D, 0x00003B8E, 0x00003B8F,
+    0x000003B9, 0x00003B91, 0x00003B92, 0x00003B93, 0x00003B94, 0x00003B95, 0x00003B96, 0x00003B97,
+    0x00003B98, 0x010003BA, 0x00003B9A, 0x00003B9B, 0x00003B9C, 0x00003B9D, 0x00003B9E, 0x00003B9F,
+    0x000003BA, 0x00003BA1, 0x00003BA2, 0x00003BA3, 0x00003BA4, 0x00003BA5, 0x00003BA6, 0x00003BA7,
+    0x00003BA8, 0x00003BA9, 0x820003BB, 0x00003BAB, 0x00003BAC, 0x00003BAD, 0x00003BAE, 0x00003BAF,
+    0x0400003C, 0x040003C1, 0x040003C2, 0x040003C3, 0x040003C4, 0x040003C5, 0x040003C6, 0x040003C7,
+    0x040003C8, 0x040003C9, 0x040003CA, 0x040003BC, 0x040003CC, 0x040003CD, 0x040003CE, 0x040003CF,
+    0x000003BC, 0x00003BC1, 0x00003BC2, 0x00003BC3, 0x00003BC4, 0x00003BC5, 0x00003BC6, 0x00003BC7,
+    0x00003BC8, 0x00003BC9, 0x00003BCA, 0x00003BCB, 0x080003BD, 0x00003BCD, 0x00003BCE, 0x00003BCF,
+    0x000003BD, 0x00003BD1, 0x00003BD2, 0x00003BD3, 0x00003BD4, 0x00003BD5, 0x00003BD6, 0x00003BD7,
+    0x00003BD8, 0x00003BD9, 0x00003BDA, 0x00003BDB, 0x00003BDC, 0x100003BE, 0x00003BDE, 0x00003BDF,
+    0x000003BE, 0x00003BE1, 0x00003BE2, 0x00003BE3, 0x00003BE4, 0x00003BE5, 0x00003BE6, 0x00003BE7,
+    0x00003BE8, 0x00003BE9, 0x00003BEA, 0x00003BEB, 0x00003BEC, 0x00003BED, 0x200003BF, 0x00003BEF,
+    0x000003BF, 0x00003BF1, 0x00003BF2, 0x00003BF3, 0x00003BF4, 0x00003BF5, 0x00003BF6, 0x00003BF7,
+    0x00003BF8, 0x00003BF9, 0x00003BFA, 0x00003BFB, 0x00003BFC, 0x00003BFD, 0x00003BFE, 0x00003BFF,
+    0x0000003C, 0x000003C1, 0x000003C2, 0x000003C3, 0x000003C4, 0x000003C5, 0x000003C6, 0x000003C7,
+    0x000003C8, 0x000003C9, 0x000003CA, 0x000003CB, 0x0800003D, 0x000003CD, 0x000003CE, 0x000003CF,
+    0x000003C1, 0x000103C2, 0x00003C12, 0x00003C13, 0x00003C14, 0x00003C15, 0x00003C16, 0x00003C17,
+    0x00003C18, 0x00003C19, 0x00003C1A, 0x00003C1B, 0x00003C1C, 0x00003C1D, 0x00003C1E, 0x00003C1F,
+    0x000003C2, 0x00003C21, 0x000203C3, 0x00003C23, 0x00003C24, 0x00003C25, 0x00003C26, 0x00003C27,
+    0x00003C28, 0x00003C29, 0x00003C2A, 0x00003C2B, 0x00003C2C, 0x00003C2D, 0x00003C2E, 0x00003C2F,
+    0x000003C3, 0x00003C31, 0x00003C32, 0x000403C4, 0x00003C34, 0x00003C35, 0x00003C36, 0x00003C37,
+    0x00003C38, 0x00003C39, 0x00003C3A, 0x00003C3B, 0x00003C3C, 0x00003C3D, 0x00003C3E, 0x00003C3F,
+    0x000003C4, 0x00003C41, 0x00003C42, 0x00003C43, 0x000803C5, 0x00003C45, 0x00003C46, 0x00003C47,
+    0x00003C48, 0x00003C49, 0x00003C4A, 0x00003C4B, 0x00003C4C, 0x00003C4D, 0x00003C4E, 0x00003C4F,
+    0x000003C5, 0x00003C51, 0x00003C52, 0x00003C53, 0x00003C54, 0x001003C6, 0x00003C56, 0x00003C57,
+    0x00003C58, 0x00003C59, 0x00003C5A, 0x00003C5B, 0x00003C5C, 0x00003C5D, 0x00003C5E, 0x00003C5F,
+    0x000003C6, 0x00003C61, 0x00003C62, 0x00003C63, 0x00003C64, 0x00003C65, 0x002003C7, 0x00003C67,
+    0x00003C68, 0x00003C69, 0x00003C6A, 0x00003C6B, 0x00003C6C, 0x00003C6D, 0x00003C6E, 0x00003C6F,
+    0x000003C7, 0x00003C71, 0x00003C72, 0x00003C73, 0x00003C74, 0x00003C75, 0x00003C76, 0x004003C8,
+    0x00003C78, 0x00003C79, 0x00003C7A, 0x00003C7B, 0x00003C7C, 0x00003C7D, 0x00003C7E, 0x00003C7F,
+    0x000003C8, 0x00003C81, 0x00003C82, 0x00003C83, 0x00003C84, 0x00003C85, 0x00003C86, 0x00003C87,
+    0x008003C9, 0x00003C89, 0x00003C8A, 0x00003C8B, 0x00003C8C, 0x00003C8D, 0x00003C8E, 0x00003C8F,
+    0x000003C9, 0x00003C91, 0x00003C92, 0x00003C93, 0x00003C94, 0x00003C95, 0x00003C96, 0x00003C97,
+    0x00003C98, 0x010003CA, 0x00003C9A, 0x00003C9B, 0x00003C9C, 0x00003C9D, 0x00003C9E, 0x00003C9F,
+    0x000003CA, 0x00003CA1, 0x00003CA2, 0x00003CA3, 0x00003CA4, 0x00003CA5, 0x00003CA6, 0x00003CA7,
+    0x00003CA8, 0x00003CA9, 0x820003CB, 0x00003CAB, 0x00003CAC, 0x00003CAD, 0x00003CAE, 0x00003CAF,
+    0x000003CB, 0x00003CB1, 0x00003CB2, 0x00003CB3, 0x00003CB4, 0x00003CB5, 0x00003CB6, 0x00003CB7,
+    0x00003CB8, 0x00003CB9, 0x00003CBA, 0x040003CC, 0x00003CBC, 0x00003CBD, 0x00003CBE, 0x00003CBF,
+    0x0800003D, 0x080003D1, 0x080003D2, 0x080003D3, 0x080003D4, 0x080003D5, 0x080003D6, 0x080003D7,
+    0x080003D8, 0x080003D9, 0x080003DA, 0x080003DB, 0x080003CD, 0x080003DD, 0x080003DE, 0x080003DF,
+    0x000003CD, 0x00003CD1, 0x00003CD2, 0x00003CD3, 0x00003CD4, 0x00003CD5, 0x00003CD6, 0x00003CD7,
+    0x00003CD8, 0x00003CD9, 0x00003CDA, 0x00003CDB, 0x00003CDC, 0x100003CE, 0x00003CDE, 0x00003CDF,
+    0x000003CE, 0x00003CE1, 0x00003CE2, 0x00003CE3, 0x00003CE4, 0x00003CE5, 0x00003CE6, 0x00003CE7,
+    0x00003CE8, 0x00003CE9, 0x00003CEA, 0x00003CEB, 0x00003CEC, 0x00003CED, 0x200003CF, 0x00003CEF,
+    0x000003CF, 0x00003CF1, 0x00003CF2, 0x00003CF3, 0x00003CF4, 0x00003CF5, 0x00003CF6, 0x00003CF7,
+    0x00003CF8, 0x00003CF9, 0x00003CFA, 0x00003CFB, 0x00003CFC, 0x00003CFD, 0x00003CFE, 0x00003CFF,
+    0x0000003D, 0x000003D1, 0x000003D2, 0x000003D3, 0x000003D4, 0x000003D5, 0x000003D6, 0x000003D7,
+    0x000003D8, 0x000003D9, 0x000003DA, 0x000003DB, 0x000003DC, 0x1000003E, 0x000003DE, 0x000003DF,
+    0x000003D1, 0x000103D2, 0x00003D12, 0x00003D13, 0x00003D14, 0x00003D15, 0x00003D16, 0x00003D17,
+    0x00003D18, 0x00003D19, 0x00003D1A, 0x00003D1B, 0x00003D1C, 0x00003D1D, 0x00003D1E, 0x00003D1F,
+    0x000003D2, 0x00003D21, 0x000203D3, 0x00003D23, 0x00003D24, 0x00003D25, 0x00003D26, 0x00003D27,
+    0x00003D28, 0x00003D29, 0x00003D2A, 0x00003D2B, 0x00003D2C, 0x00003D2D, 0x00003D2E, 0x00003D2F,
+    0x000003D3, 0x00003D31, 0x00003D32, 0x000403D4, 0x00003D34, 0x00003D35, 0x00003D36, 0x00003D37,
+    0x00003D38, 0x00003D39, 0x00003D3A, 0x00003D3B, 0x00003D3C, 0x00003D3D, 0x00003D3E, 0x00003D3F,
+    0x000003D4, 0x00003D41, 0x00003D42, 0x00003D43, 0x000803D5, 0x00003D45, 0x00003D46, 0x00003D47,
+    0x00003D48, 0x00003D49, 0x00003D4A, 0x00003D4B, 0x00003D4C, 0x00003D4D, 0x00003D4E, 0x00003D4F,
+    0x000003D5, 0x00003D51, 0x00003D52, 0x00003D53, 0x00003D54, 0x001003D6, 0x00003D56, 0x00003D57,
+    0x00003D58, 0x00003D59, 0x00003D5A, 0x00003D5B, 0x00003D5C, 0x00003D5D, 0x00003D5E, 0x00003D5F,
+    0x000003D6, 0x00003D61, 0x00003D62, 0x00003D63, 0x00003D64, 0x00003D65, 0x002003D7, 0x00003D67,
+    0x00003D68, 0x00003D69, 0x00003D6A, 0x00003D6B, 0x00003D6C, 0x00003D6D, 0x00003D6E, 0x00003D6F,
+    0x000003D7, 0x00003D71, 0x00003D72, 0x00003D73, 0x00003D74, 0x00003D75, 0x00003D76, 0x004003D8,
+    0x00003D78, 0x00003D79, 0x00003D7A, 0x00003D7B, 0x00003D7C, 0x00003D7D, 0x00003D7E, 0x00003D7F,
+    0x000003D8, 0x00003D81, 0x00003D82, 0x00003D83, 0x00003D84, 0x00003D85, 0x00003D86, 0x00003D87,
+    0x008003D9, 0x00003D89, 0x00003D8A, 0x00003D8B, 0x00003D8C, 0x00003D8D, 0x00003D8E, 0x00003D8F,
+    0x000003D9, 0x00003D91, 0x00003D92, 0x00003D93, 0x00003D94, 0x00003D95, 0x00003D96, 0x00003D97,
+    0x00003D98, 0x010003DA, 0x00003D9A, 0x00003D9B, 0x00003D9C, 0x00003D9D, 0x00003D9E, 0x00003D9F,
+    0x000003DA, 0x00003DA1, 0x00003DA2, 0x00003DA3, 0x00003DA4, 0x00003DA5, 0x00003DA6, 0x00003DA7,
+    0x00003DA8, 0x00003DA9, 0x820003DB, 0x00003DAB, 0x00003DAC, 0x00003DAD, 0x00003DAE, 0x00003DAF,
+    0x000003DB, 0x00003DB1, 0x00003DB2, 0x00003DB3, 0x00003DB4, 0x00003DB5, 0x00003DB6, 0x00003DB7,
+    0x00003DB8, 0x00003DB9, 0x00003DBA, 0x040003DC, 0x00003DBC, 0x00003DBD, 0x00003DBE, 0x00003DBF,
+    0x000003DC, 0x00003DC1, 0x00003DC2, 0x00003DC3, 0x00003DC4, 0x00003DC5, 0x00003DC6, 0x00003DC7,
+    0x00003DC8, 0x00003DC9, 0x00003DCA, 0x00003DCB, 0x080003DD, 0x00003DCD, 0x00003DCE, 0x00003DCF,
+    0x1000003E, 0x100003E1, 0x100003E2, 0x100003E3, 0x100003E4, 0x100003E5, 0x100003E6, 0x100003E7,
+    0x100003E8, 0x100003E9, 0x100003EA, 0x100003EB, 0x100003EC, 0x100003DE, 0x100003EE, 0x100003EF,
+    0x000003DE, 0x00003DE1, 0x00003DE2, 0x00003DE3, 0x00003DE4, 0x00003DE5, 0x00003DE6, 0x00003DE7,
+    0x00003DE8, 0x00003DE9, 0x00003DEA, 0x00003DEB, 0x00003DEC, 0x00003DED, 0x200003DF, 0x00003DEF,
+    0x000003DF, 0x00003DF1, 0x00003DF2, 0x00003DF3, 0x00003DF4, 0x00003DF5, 0x00003DF6, 0x00003DF7,
+    0x00003DF8, 0x00003DF9, 0x00003DFA, 0x00003DFB, 0x00003DFC, 0x00003DFD, 0x00003DFE, 0x00003DFF,
+    0x0000003E, 0x000003E1, 0x000003E2, 0x000003E3, 0x000003E4, 0x000003E5, 0x000003E6, 0x000003E7,
+    0x000003E8, 0x000003E9, 0x000003EA, 0x000003EB, 0x000003EC, 0x000003ED, 0x2000003F, 0x000003EF,
+    0x000003E1, 0x000103E2, 0x00003E12, 0x00003E13, 0x00003E14, 0x00003E15, 0x00003E16, 0x00003E17,
+    0x00003E18, 0x00003E19, 0x00003E1A, 0x00003E1B, 0x00003E1C, 0x00003E1D, 0x00003E1E, 0x00003E1F,
+    0x000003E2, 0x00003E21, 0x000203E3, 0x00003E23, 0x00003E24, 0x00003E25, 0x00003E26, 0x00003E27,
+    0x00003E28, 0x00003E29, 0x00003E2A, 0x00003E2B, 0x00003E2C, 0x00003E2D, 0x00003E2E, 0x00003E2F,
+    0x000003E3, 0x00003E31, 0x00003E32, 0x000403E4, 0x00003E34, 0x00003E35, 0x00003E36, 0x00003E37,
+    0x00003E38, 0x00003E39, 0x00003E3A, 0x00003E3B, 0x00003E3C, 0x00003E3D, 0x00003E3E, 0x00003E3F,
+    0x000003E4, 0x00003E41, 0x00003E42, 0x00003E43, 0x000803E5, 0x00003E45, 0x00003E46, 0x00003E47,
+    0x00003E48, 0x00003E49, 0x00003E4A, 0x00003E4B, 0x00003E4C, 0x00003E4D, 0x00003E4E, 0x00003E4F,
+    0x000003E5, 0x00003E51, 0x00003E52, 0x00003E53, 0x00003E54, 0x001003E6, 0x00003E56, 0x00003E57,
+    0x00003E58, 0x00003E59, 0x00003E5A, 0x00003E5B, 0x00003E5C, 0x00003E5D, 0x00003E5E, 0x00003E5F,
+    0x000003E6, 0x00003E61, 0x00003E62, 0x00003E63, 0x00003E64, 0x00003E65, 0x002003E7, 0x00003E67,
+    0x00003E68, 0x00003E69, 0x00003E6A, 0x00003E6B, 0x00003E6C, 0x00003E6D, 0x00003E6E, 0x00003E6F,
+    0x000003E7, 0x00003E71, 0x00003E72, 0x00003E73, 0x00003E74, 0x00003E75, 0x00003E76, 0x004003E8,
+    0x00003E78, 0x00003E79, 0x00003E7A, 0x00003E7B, 0x00003E7C, 0x00003E7D, 0x00003E7E, 0x00003E7F,
+    0x000003E8, 0x00003E81, 0x00003E82, 0x00003E83, 0x00003E84, 0x00003E85, 0x00003E86, 0x00003E87,
+    0x008003E9, 0x00003E89, 0x00003E8A, 0x00003E8B, 0x00003E8C, 0x00003E8D, 0x00003E8E, 0x00003E8F,
+    0x000003E9, 0x00003E91, 0x00003E92, 0x00003E93, 0x00003E94, 0x00003E95, 0x00003E96, 0x00003E97,
+    0x00003E98, 0x010003EA, 0x00003E9A, 0x00003E9B, 0x00003E9C, 0x00003E9D, 0x00003E9E, 0x00003E9F,
+    0x000003EA, 0x00003EA1, 0x00003EA2, 0x00003EA3, 0x00003EA4, 0x00003EA5, 0x00003EA6, 0x00003EA7,
+    0x00003EA8, 0x00003EA9, 0x820003EB, 0x00003EAB, 0x00003EAC, 0x00003EAD, 0x00003EAE, 0x00003EAF,
+    0x000003EB, 0x00003EB1, 0x00003EB2, 0x00003EB3, 0x00003EB4, 0x00003EB5, 0x00003EB6, 0x00003EB7,
+    0x00003EB8, 0x00003EB9, 0x00003EBA, 0x040003EC, 0x00003EBC, 0x00003EBD, 0x00003EBE, 0x00003EBF,
+    0x000003EC, 0x00003EC1, 0x00003EC2, 0x00003EC3, 0x00003EC4, 0x00003EC5, 0x00003EC6, 0x00003EC7,
+    0x00003EC8, 0x00003EC9, 0x00003ECA, 0x00003ECB, 0x080003ED, 0x00003ECD, 0x00003ECE, 0x00003ECF,
+    0x000003ED, 0x00003ED1, 0x00003ED2, 0x00003ED3, 0x00003ED4, 0x00003ED5, 0x00003ED6, 0x00003ED7,
+    0x00003ED8, 0x00003ED9, 0x00003EDA, 0x00003EDB, 0x00003EDC, 0x100003EE, 0x00003EDE, 0x00003EDF,
+    0x2000003F, 0x200003F1, 0x200003F2, 0x200003F3, 0x200003F4, 0x200003F5, 0x200003F6, 0x200003F7,
+    0x200003F8, 0x200003F9, 0x200003FA, 0x200003FB, 0x200003FC, 0x200003FD, 0x200003EF, 0x200003FF,
+    0x000003EF, 0x00003EF1, 0x00003EF2, 0x00003EF3, 0x00003EF4, 0x00003EF5, 0x00003EF6, 0x00003EF7,
+    0x00003EF8, 0x00003EF9, 0x00003EFA, 0x00003EFB, 0x00003EFC, 0x00003EFD, 0x00003EFE, 0x00003EFF,
+    0x0000003F, 0x000003F1, 0x000003F2, 0x000003F3, 0x000003F4, 0x000003F5, 0x000003F6, 0x000003F7,
+    0x000003F8, 0x000003F9, 0x000003FA, 0x000003FB, 0x000003FC, 0x000003FD, 0x000003FE, 0x000003FF,
+    0x000003F1, 0x000103F2, 0x00003F12, 0x00003F13, 0x00003F14, 0x00003F15, 0x00003F16, 0x00003F17,
+    0x00003F18, 0x00003F19, 0x00003F1A, 0x00003F1B, 0x00003F1C, 0x00003F1D, 0x00003F1E, 0x00003F1F,
+    0x000003F2, 0x00003F21, 0x000203F3, 0x00003F23, 0x00003F24, 0x00003F25, 0x00003F26, 0x00003F27,
+    0x00003F28, 0x00003F29, 0x00003F2A, 0x00003F2B, 0x00003F2C, 0x00003F2D, 0x00003F2E, 0x00003F2F,
+    0x000003F3, 0x00003F31, 0x00003F32, 0x000403F4, 0x00003F34, 0x00003F35, 0x00003F36, 0x00003F37,
+    0x00003F38, 0x00003F39, 0x00003F3A, 0x00003F3B, 0x00003F3C, 0x00003F3D, 0x00003F3E, 0x00003F3F,
+    0x000003F4, 0x00003F41, 0x00003F42, 0x00003F43, 0x000803F5, 0x00003F45, 0x00003F46, 0x00003F47,
+    0x00003F48, 0x00003F49, 0x00003F4A, 0x00003F4B, 0x00003F4C, 0x00003F4D, 0x00003F4E, 0x00003F4F,
+    0x000003F5, 0x00003F51, 0x00003F52, 0x00003F53, 0x00003F54, 0x001003F6, 0x00003F56, 0x00003F57,
+    0x00003F58, 0x00003F59, 0x00003F5A, 0x00003F5B, 0x00003F5C, 0x00003F5D, 0x00003F5E, 0x00003F5F,
+    0x000003F6, 0x00003F61, 0x00003F62, 0x00003F63, 0x00003F64, 0x00003F65, 0x002003F7, 0x00003F67,
+    0x00003F68, 0x00003F69, 0x00003F6A, 0x00003F6B, 0x00003F6C, 0x00003F6D, 0x00003F6E, 0x00003F6F,
+    0x000003F7, 0x00003F71, 0x00003F72, 0x00003F73, 0x00003F74, 0x00003F75, 0x00003F76, 0x004003F8,
+    0x00003F78, 0x00003F79, 0x00003F7A, 0x00003F7B, 0x00003F7C, 0x00003F7D, 0x00003F7E, 0x00003F7F,
+    0x000003F8, 0x00003F81, 0x00003F82, 0x00003F83, 0x00003F84, 0x00003F85, 0x00003F86, 0x00003F87,
+    0x008003F9, 0x00003F89, 0x00003F8A, 0x00003F8B, 0x00003F8C, 0x00003F8D, 0x00003F8E, 0x00003F8F,
+    0x000003F9, 0x00003F91, 0x00003F92, 0x00003F93, 0x00003F94, 0x00003F95, 0x00003F96, 0x00003F97,
+    0x00003F98, 0x010003FA, 0x00003F9A, 0x00003F9B, 0x00003F9C, 0x00003F9D, 0x00003F9E, 0x00003F9F,
+    0x000003FA, 0x00003FA1, 0x00003FA2, 0x00003FA3, 0x00003FA4, 0x00003FA5, 0x00003FA6, 0x00003FA7,
+    0x00003FA8, 0x00003FA9, 0x820003FB, 0x00003FAB, 0x00003FAC, 0x00003FAD, 0x00003FAE, 0x00003FAF,
+    0x000003FB, 0x00003FB1, 0x00003FB2, 0x00003FB3, 0x00003FB4, 0x00003FB5, 0x00003FB6, 0x00003FB7,
+    0x00003FB8, 0x00003FB9, 0x00003FBA, 0x040003FC, 0x00003FBC, 0x00003FBD, 0x00003FBE, 0x00003FBF,
+    0x000003FC, 0x00003FC1, 0x00003FC2, 0x00003FC3, 0x00003FC4, 0x00003FC5, 0x00003FC6, 0x00003FC7,
+    0x00003FC8, 0x00003FC9, 0x00003FCA, 0x00003FCB, 0x080003FD, 0x00003FCD, 0x00003FCE, 0x00003FCF,
+    0x000003FD, 0x00003FD1, 0x00003FD2, 0x00003FD3, 0x00003FD4, 0x00003FD5, 0x00003FD6, 0x00003FD7,
+    0x00003FD8, 0x00003FD9, 0x00003FDA, 0x00003FDB, 0x00003FDC, 0x100003FE, 0x00003FDE, 0x00003FDF,
+    0x000003FE, 0x00003FE1, 0x00003FE2, 0x00003FE3, 0x00003FE4, 0x00003FE5, 0x00003FE6, 0x00003FE7,
+    0x00003FE8, 0x00003FE9, 0x00003FEA, 0x00003FEB, 0x00003FEC, 0x00003FED, 0x200003FF, 0x00003FEF,
+    0x000003FF, 0x00003FF1, 0x00003FF2, 0x00003FF3, 0x00003FF4, 0x00003FF5, 0x00003FF6, 0x00003FF7,
+    0x00003FF8, 0x00003FF9, 0x00003FFA, 0x00003FFB, 0x00003FFC, 0x00003FFD, 0x00003FFE, 0x00003FFF,
+    0x00000004, 0x00000041, 0x00000042, 0x00000043, 0x00080005, 0x00000045, 0x00000046, 0x00000047,
+    0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F,
+    0x00000041, 0x00010042, 0x00000412, 0x00000413, 0x00000414, 0x00000415, 0x00000416, 0x00000417,
+    0x00000418, 0x00000419, 0x0000041A, 0x0000041B, 0x0000041C, 0x0000041D, 0x0000041E, 0x0000041F,
+    0x00000042, 0x00000421, 0x00020043, 0x00000423, 0x00000424, 0x00000425, 0x00000426, 0x00000427,
+    0x00000428, 0x00000429, 0x0000042A, 0x0000042B, 0x0000042C, 0x0000042D, 0x0000042E, 0x0000042F,
+    0x00000043, 0x00000431, 0x00000432, 0x00040044, 0x00000434, 0x00000435, 0x00000436, 0x00000437,
+    0x00000438, 0x00000439, 0x0000043A, 0x0000043B, 0x0000043C, 0x0000043D, 0x0000043E, 0x0000043F,
+    0x00080005, 0x00080051, 0x00080052, 0x00080053, 0x00080045, 0x00080055, 0x00080056, 0x00080057,
+    0x00080058, 0x00080059, 0x0008005A, 0x0008005B, 0x0008005C, 0x0008005D, 0x0008005E, 0x0008005F,
+    0x00000045, 0x00000451, 0x00000452, 0x00000453, 0x00000454, 0x00100046, 0x00000456, 0x00000457,
+    0x00000458, 0x00000459, 0x0000045A, 0x0000045B, 0x0000045C, 0x0000045D, 0x0000045E, 0x0000045F,
+    0x00000046, 0x00000461, 0x00000462, 0x00000463, 0x00000464, 0x00000465, 0x00200047, 0x00000467,
+    0x00000468, 0x00000469, 0x0000046A, 0x0000046B, 0x0000046C, 0x0000046D, 0x0000046E, 0x0000046F,
+    0x00000047, 0x00000471, 0x00000472, 0x00000473, 0x00000474, 0x00000475, 0x00000476, 0x00400048,
+    0x00000478, 0x00000479, 0x0000047A, 0x0000047B, 0x0000047C, 0x0000047D, 0x0000047E, 0x0000047F,
+    0x00000048, 0x00000481, 0x00000482, 0x00000483, 0x00000484, 0x00000485, 0x00000486, 0x00000487,
+    0x00800049, 0x00000489, 0x0000048A, 0x0000048B, 0x0000048C, 0x0000048D, 0x0000048E, 0x0000048F,
+    0x00000049, 0x00000491, 0x00000492, 0x00000493, 0x00000494, 0x00000495, 0x00000496, 0x00000497,
+    0x00000498, 0x0100004A, 0x0000049A, 0x0000049B, 0x0000049C, 0x0000049D, 0x0000049E, 0x0000049F,
+    0x0000004A, 0x000004A1, 0x000004A2, 0x000004A3, 0x000004A4, 0x000004A5, 0x000004A6, 0x000004A7,
+    0x000004A8, 0x000004A9, 0x8200004B, 0x000004AB, 0x000004AC, 0x000004AD, 0x000004AE, 0x000004AF,
+    0x0000004B, 0x000004B1, 0x000004B2, 0x000004B3, 0x000004B4, 0x000004B5, 0x000004B6, 0x000004B7,
+    0x000004B8, 0x000004B9, 0x000004BA, 0x0400004C, 0x000004BC, 0x000004BD, 0x000004BE, 0x000004BF,
+    0x0000004C, 0x000004C1, 0x000004C2, 0x000004C3, 0x000004C4, 0x000004C5, 0x000004C6, 0x000004C7,
+    0x000004C8, 0x000004C9, 0x000004CA, 0x000004CB, 0x0800004D, 0x000004CD, 0x000004CE, 0x000004CF,
+    0x0000004D, 0x000004D1, 0x000004D2, 0x000004D3, 0x000004D4, 0x000004D5, 0x000004D6, 0x000004D7,
+    0x000004D8, 0x000004D9, 0x000004DA, 0x000004DB, 0x000004DC, 0x1000004E, 0x000004DE, 0x000004DF,
+    0x0000004E, 0x000004E1, 0x000004E2, 0x000004E3, 0x000004E4, 0x000004E5, 0x000004E6, 0x000004E7,
+    0x000004E8, 0x000004E9, 0x000004EA, 0x000004EB, 0x000004EC, 0x000004ED, 0x2000004F, 0x000004EF,
+    0x0000004F, 0x000004F1, 0x000004F2, 0x000004F3, 0x000004F4, 0x000004F5, 0x000004F6, 0x000004F7,
+    0x000004F8, 0x000004F9, 0x000004FA, 0x000004FB, 0x000004FC, 0x000004FD, 0x000004FE, 0x000004FF,
+    0x00000041, 0x00010042, 0x00000412, 0x00000413, 0x00000414, 0x00000415, 0x00000416, 0x00000417,
+    0x00000418, 0x00000419, 0x0000041A, 0x0000041B, 0x0000041C, 0x0000041D, 0x0000041E, 0x0000041F,
+    0x00010042, 0x00010412, 0x00010422, 0x00010423, 0x00010424, 0x00010425, 0x00010426, 0x00010427,
+    0x00010428, 0x00010429, 0x0001042A, 0x0001042B, 0x0001042C, 0x0001042D, 0x0001042E, 0x0001042F,
+    0x00000412, 0x00004121, 0x00020413, 0x00004123, 0x00004124, 0x00004125, 0x00004126, 0x00004127,
+    0x00004128, 0x00004129, 0x0000412A, 0x0000412B, 0x0000412C, 0x0000412D, 0x0000412E, 0x0000412F,
+    0x00000413, 0x00004131, 0x00004132, 0x00040414, 0x00004134, 0x00004135, 0x00004136, 0x00004137,
+    0x00004138, 0x00004139, 0x0000413A, 0x0000413B, 0x0000413C, 0x0000413D, 0x0000413E, 0x0000413F,
+    0x00000414, 0x00004141, 0x00004142, 0x00004143, 0x00080415, 0x00004145, 0x00004146, 0x00004147,
+    0x00004148, 0x00004149, 0x0000414A, 0x0000414B, 0x0000414C, 0x0000414D, 0x0000414E, 0x0000414F,
+    0x00000415, 0x00004151, 0x00004152, 0x00004153, 0x00004154, 0x00100416, 0x00004156, 0x00004157,
+    0x00004158, 0x00004159, 0x0000415A, 0x0000415B, 0x0000415C, 0x0000415D, 0x0000415E, 0x0000415F,
+    0x00000416, 0x00004161, 0x00004162, 0x00004163, 0x00004164, 0x00004165, 0x00200417, 0x00004167,
+    0x00004168, 0x00004169, 0x0000416A, 0x0000416B, 0x0000416C, 0x0000416D, 0x0000416E, 0x0000416F,
+    0x00000417, 0x00004171, 0x00004172, 0x00004173, 0x00004174, 0x00004175, 0x00004176, 0x00400418,
+    0x00004178, 0x00004179, 0x0000417A, 0x0000417B, 0x0000417C, 0x0000417D, 0x0000417E, 0x0000417F,
+    0x00000418, 0x00004181, 0x00004182, 0x00004183, 0x00004184, 0x00004185, 0x00004186, 0x00004187,
+    0x00800419, 0x00004189, 0x0000418A, 0x0000418B, 0x0000418C, 0x0000418D, 0x0000418E, 0x0000418F,
+    0x00000419, 0x00004191, 0x00004192, 0x00004193, 0x00004194, 0x00004195, 0x00004196, 0x00004197,
+    0x00004198, 0x0100041A, 0x0000419A, 0x0000419B, 0x0000419C, 0x0000419D, 0x0000419E, 0x0000419F,
+    0x0000041A, 0x000041A1, 0x000041A2, 0x000041A3, 0x000041A4, 0x000041A5, 0x000041A6, 0x000041A7,
+    0x000041A8, 0x000041A9, 0x8200041B, 0x000041AB, 0x000041AC, 0x000041AD, 0x000041AE, 0x000041AF,
+    0x0000041B, 0x000041B1, 0x000041B2, 0x000041B3, 0x000041B4, 0x000041B5, 0x000041B6, 0x000041B7,
+    0x000041B8, 0x000041B9, 0x000041BA, 0x0400041C, 0x000041BC, 0x000041BD, 0x000041BE, 0x000041BF,
+    0x0000041C, 0x000041C1, 0x000041C2, 0x000041C3, 0x000041C4, 0x000041C5, 0x000041C6, 0x000041C7,
+    0x000041C8, 0x000041C9, 0x000041CA, 0x000041CB, 0x0800041D, 0x000041CD, 0x000041CE, 0x000041CF,
+    0x0000041D, 0x000041D1, 0x000041D2, 0x000041D3, 0x000041D4, 0x000041D5, 0x000041D6, 0x000041D7,
+    0x000041D8, 0x000041D9, 0x000041DA, 0x000041DB, 0x000041DC, 0x1000041E, 0x000041DE, 0x000041DF,
+    0x0000041E, 0x000041E1, 0x000041E2, 0x000041E3, 0x000041E4, 0x000041E5, 0x000041E6, 0x000041E7,
+    0x000041E8, 0x000041E9, 0x000041EA, 0x000041EB, 0x000041EC, 0x000041ED, 0x2000041F, 0x000041EF,
+    0x0000041F, 0x000041F1, 0x000041F2, 0x000041F3, 0x000041F4, 0x000041F5, 0x000041F6, 0x000041F7,
+    0x000041F8, 0x000041F9, 0x000041FA, 0x000041FB, 0x000041FC, 0x000041FD, 0x000041FE, 0x000041FF,
+    0x00000042, 0x00000421, 0x00020043, 0x00000423, 0x00000424, 0x00000425, 0x00000426, 0x00000427,
+    0x00000428, 0x00000429, 0x0000042A, 0x0000042B, 0x0000042C, 0x0000042D, 0x0000042E, 0x0000042F,
+    0x00000421, 0x00010422, 0x00004212, 0x00004213, 0x00004214, 0x00004215, 0x00004216, 0x00004217,
+    0x00004218, 0x00004219, 0x0000421A, 0x0000421B, 0x0000421C, 0x0000421D, 0x0000421E, 0x0000421F,
+    0x00020043, 0x00020431, 0x00020423, 0x00020433, 0x00020434, 0x00020435, 0x00020436, 0x00020437,
+    0x00020438, 0x00020439, 0x0002043A, 0x0002043B, 0x0002043C, 0x0002043D, 0x0002043E, 0x0002043F,
+    0x00000423, 0x00004231, 0x00004232, 0x00040424, 0x00004234, 0x00004235, 0x00004236, 0x00004237,
+    0x00004238, 0x00004239, 0x0000423A, 0x0000423B, 0x0000423C, 0x0000423D, 0x0000423E, 0x0000423F,
+    0x00000424, 0x00004241, 0x00004242, 0x00004243, 0x00080425, 0x00004245, 0x00004246, 0x00004247,
+    0x00004248, 0x00004249, 0x0000424A, 0x0000424B, 0x0000424C, 0x0000424D, 0x0000424E, 0x0000424F,
+    0x00000425, 0x00004251, 0x00004252, 0x00004253, 0x00004254, 0x00100426, 0x00004256, 0x00004257,
+    0x00004258, 0x00004259, 0x0000425A, 0x0000425B, 0x0000425C, 0x0000425D, 0x0000425E, 0x0000425F,
+    0x00000426, 0x00004261, 0x00004262, 0x00004263, 0x00004264, 0x00004265, 0x00200427, 0x00004267,
+    0x00004268, 0x00004269, 0x0000426A, 0x0000426B, 0x0000426C, 0x0000426D, 0x0000426E, 0x0000426F,
+    0x00000427, 0x00004271, 0x00004272, 0x00004273, 0x00004274, 0x00004275, 0x00004276, 0x00400428,
+    0x00004278, 0x00004279, 0x0000427A, 0x0000427B, 0x0000427C, 0x0000427D, 0x0000427E, 0x0000427F,
+    0x00000428, 0x00004281, 0x00004282, 0x00004283, 0x00004284, 0x00004285, 0x00004286, 0x00004287,
+    0x00800429, 0x00004289, 0x0000428A, 0x0000428B, 0x0000428C, 0x0000428D, 0x0000428E, 0x0000428F,
+    0x00000429, 0x00004291, 0x00004292, 0x00004293, 0x00004294, 0x00004295, 0x00004296, 0x00004297,
+    0x00004298, 0x0100042A, 0x0000429A, 0x0000429B, 0x0000429C, 0x0000429D, 0x0000429E, 0x0000429F,
+    0x0000042A, 0x000042A1, 0x000042A2, 0x000042A3, 0x000042A4, 0x000042A5, 0x000042A6, 0x000042A7,
+    0x000042A8, 0x000042A9, 0x8200042B, 0x000042AB, 0x000042AC, 0x000042AD, 0x000042AE, 0x000042AF,
+    0x0000042B, 0x000042B1, 0x000042B2, 0x000042B3, 0x000042B4, 0x000042B5, 0x000042B6, 0x000042B7,
+    0x000042B8, 0x000042B9, 0x000042BA, 0x0400042C, 0x000042BC, 0x000042BD, 0x000042BE, 0x000042BF,
+    0x0000042C, 0x000042C1, 0x000042C2, 0x000042C3, 0x000042C4, 0x000042C5, 0x000042C6, 0x000042C7,
+    0x000042C8, 0x000042C9, 0x000042CA, 0x000042CB, 0x0800042D, 0x000042CD, 0x000042CE, 0x000042CF,
+    0x0000042D, 0x000042D1, 0x000042D2, 0x000042D3, 0x000042D4, 0x000042D5, 0x000042D6, 0x000042D7,
+    0x000042D8, 0x000042D9, 0x000042DA, 0x000042DB, 0x000042DC, 0x1000042E, 0x000042DE, 0x000042DF,
+    0x0000042E, 0x000042E1, 0x000042E2, 0x000042E3, 0x000042E4, 0x000042E5, 0x000042E6, 0x000042E7,
+    0x000042E8, 0x000042E9, 0x000042EA, 0x000042EB, 0x000042EC, 0x000042ED, 0x2000042F, 0x000042EF,
+    0x0000042F, 0x000042F1, 0x000042F2, 0x000042F3, 0x000042F4, 0x000042F5, 0x000042F6, 0x000042F7,
+    0x000042F8, 0x000042F9, 0x000042FA, 0x000042FB, 0x000042FC, 0x000042FD, 0x000042FE, 0x000042FF,
+    0x00000043, 0x00000431, 0x00000432, 0x00040044, 0x00000434, 0x00000435, 0x00000436, 0x00000437,
+    0x00000438, 0x00000439, 0x0000043A, 0x0000043B, 0x0000043C, 0x0000043D, 0x0000043E, 0x0000043F,
+    0x00000431, 0x00010432, 0x00004312, 0x00004313, 0x00004314, 0x00004315, 0x00004316, 0x00004317,
+    0x00004318, 0x00004319, 0x0000431A, 0x0000431B, 0x0000431C, 0x0000431D, 0x0000431E, 0x0000431F,
+    0x00000432, 0x00004321, 0x00020433, 0x00004323, 0x00004324, 0x00004325, 0x00004326, 0x00004327,
+    0x00004328, 0x00004329, 0x0000432A, 0x0000432B, 0x0000432C, 0x0000432D, 0x0000432E, 0x0000432F,
+    0x00040044, 0x00040441, 0x00040442, 0x00040434, 0x00040444, 0x00040445, 0x00040446, 0x00040447,
+    0x00040448, 0x00040449, 0x0004044A, 0x0004044B, 0x0004044C, 0x0004044D, 0x0004044E, 0x0004044F,
+    0x00000434, 0x00004341, 0x00004342, 0x00004343, 0x00080435, 0x00004345, 0x00004346, 0x00004347,
+    0x00004348, 0x00004349, 0x0000434A, 0x0000434B, 0x0000434C, 0x0000434D, 0x0000434E, 0x0000434F,
+    0x00000435, 0x00004351, 0x00004352, 0x00004353, 0x00004354, 0x00100436, 0x00004356, 0x00004357,
+    0x00004358, 0x00004359, 0x0000435A, 0x0000435B, 0x0000435C, 0x0000435D, 0x0000435E, 0x0000435F,
+    0x00000436, 0x00004361, 0x00004362, 0x00004363, 0x00004364, 0x00004365, 0x00200437, 0x00004367,
+    0x00004368, 0x00004369, 0x0000436A, 0x0000436B, 0x0000436C, 0x0000436D, 0x0000436E, 0x0000436F,
+    0x00000437, 0x00004371, 0x00004372, 0x00004373, 0x00004374, 0x00004375, 0x00004376, 0x00400438,
+    0x00004378, 0x00004379, 0x0000437A, 0x0000437B, 0x0000437C, 0x0000437D, 0x0000437E, 0x0000437F,
+    0x00000438, 0x00004381, 0x00004382, 0x00004383, 0x00004384, 0x00004385, 0x00004386, 0x00004387,
+    0x00800439, 0x00004389, 0x0000438A, 0x0000438B, 0x0000438C, 0x0000438D, 0x0000438E, 0x0000438F,
+    0x00000439, 0x00004391, 0x00004392, 0x00004393, 0x00004394, 0x00004395, 0x00004396, 0x00004397,
+    0x00004398, 0x0100043A, 0x0000439A, 0x0000439B, 0x0000439C, 0x0000439D, 0x0000439E, 0x0000439F,
+    0x0000043A, 0x000043A1, 0x000043A2, 0x000043A3, 0x000043A4, 0x000043A5, 0x000043A6, 0x000043A7,
+    0x000043A8, 0x000043A9, 0x8200043B, 0x000043AB, 0x000043AC, 0x000043AD, 0x000043AE, 0x000043AF,
+    0x0000043B, 0x000043B1, 0x000043B2, 0x000043B3, 0x000043B4, 0x000043B5, 0x000043B6, 0x000043B7,
+    0x000043B8, 0x000043B9, 0x000043BA, 0x0400043C, 0x000043BC, 0x000043BD, 0x000043BE, 0x000043BF,
+    0x0000043C, 0x000043C1, 0x000043C2, 0x000043C3, 0x000043C4, 0x000043C5, 0x000043C6, 0x000043C7,
+    0x000043C8, 0x000043C9, 0x000043CA, 0x000043CB, 0x0800043D, 0x000043CD, 0x000043CE, 0x000043CF,
+    0x0000043D, 0x000043D1, 0x000043D2, 0x000043D3, 0x000043D4, 0x000043D5, 0x000043D6, 0x000043D7,
+    0x000043D8, 0x000043D9, 0x000043DA, 0x000043DB, 0x000043DC, 0x1000043E, 0x000043DE, 0x000043DF,
+    0x0000043E, 0x000043E1, 0x000043E2, 0x000043E3, 0x000043E4, 0x000043E5, 0x000043E6, 0x000043E7,
+    0x000043E8, 0x000043E9, 0x000043EA, 0x000043EB, 0x000043EC, 0x000043ED, 0x2000043F, 0x000043EF,
+    0x0000043F, 0x000043F1, 0x000043F2, 0x000043F3, 0x000043F4, 0x000043F5, 0x000043F6, 0x000043F7,
+    0x000043F8, 0x000043F9, 0x000043FA, 0x000043FB, 0x000043FC, 0x000043FD, 0x000043FE, 0x000043FF,
+    0x00080005, 0x00080051, 0x00080052, 0x00080053, 0x00080045, 0x00080055, 0x00080056, 0x00080057,
+    0x00080058, 0x00080059, 0x0008005A, 0x0008005B, 0x0008005C, 0x0008005D, 0x0008005E, 0x0008005F,
+    0x00080051, 0x00090052, 0x00080512, 0x00080513, 0x00080514, 0x00080515, 0x00080516, 0x00080517,
+    0x00080518, 0x00080519, 0x0008051A, 0x0008051B, 0x0008051C, 0x0008051D, 0x0008051E, 0x0008051F,
+    0x00080052, 0x00080521, 0x000A0053, 0x00080523, 0x00080524, 0x00080525, 0x00080526, 0x00080527,
+    0x00080528, 0x00080529, 0x0008052A, 0x0008052B, 0x0008052C, 0x0008052D, 0x0008052E, 0x0008052F,
+    0x00080053, 0x00080531, 0x00080532, 0x000C0054, 0x00080534, 0x00080535, 0x00080536, 0x00080537,
+    0x00080538, 0x00080539, 0x0008053A, 0x0008053B, 0x0008053C, 0x0008053D, 0x0008053E, 0x0008053F,
+    0x00080045, 0x00080451, 0x00080452, 0x00080453, 0x00100055, 0x00080455, 0x00080456, 0x00080457,
+    0x00080458, 0x00080459, 0x0008045A, 0x0008045B, 0x0008045C, 0x0008045D, 0x0008045E, 0x0008045F,
+    0x00080055, 0x00080551, 0x00080552, 0x00080553, 0x00080554, 0x00180056, 0x00080556, 0x00080557,
+    0x00080558, 0x00080559, 0x0008055A, 0x0008055B, 0x0008055C, 0x0008055D, 0x0008055E, 0x0008055F,
+    0x00080056, 0x00080561, 0x00080562, 0x00080563, 0x00080564, 0x00080565, 0x00280057, 0x00080567,
+    0x00080568, 0x00080569, 0x0008056A, 0x0008056B, 0x0008056C, 0x0008056D, 0x0008056E, 0x0008056F,
+    0x00080057, 0x00080571, 0x00080572, 0x00080573, 0x00080574, 0x00080575, 0x00080576, 0x00480058,
+    0x00080578, 0x00080579, 0x0008057A, 0x0008057B, 0x0008057C, 0x0008057D, 0x0008057E, 0x0008057F,
+    0x00080058, 0x00080581, 0x00080582, 0x00080583, 0x00080584, 0x00080585, 0x00080586, 0x00080587,
+    0x00880059, 0x00080589, 0x0008058A, 0x0008058B, 0x0008058C, 0x0008058D, 0x0008058E, 0x0008058F,
+    0x00080059, 0x00080591, 0x00080592, 0x00080593, 0x00080594, 0x00080595, 0x00080596, 0x00080597,
+    0x00080598, 0x0108005A, 0x0008059A, 0x0008059B, 0x0008059C, 0x0008059D, 0x0008059E, 0x0008059F,
+    0x0008005A, 0x000805A1, 0x000805A2, 0x000805A3, 0x000805A4, 0x000805A5, 0x000805A6, 0x000805A7,
+    0x000805A8, 0x000805A9, 0x8208005B, 0x000805AB, 0x000805AC, 0x000805AD, 0x000805AE, 0x000805AF,
+    0x0008005B, 0x000805B1, 0x000805B2, 0x000805B3, 0x000805B4, 0x000805B5, 0x000805B6, 0x000805B7,
+    0x000805B8, 0x000805B9, 0x000805BA, 0x0408005C, 0x000805BC, 0x000805BD, 0x000805BE, 0x000805BF,
+    0x0008005C, 0x000805C1, 0x000805C2, 0x000805C3, 0x000805C4, 0x000805C5, 0x000805C6, 0x000805C7,
+    0x000805C8, 0x000805C9, 0x000805CA, 0x000805CB, 0x0808005D, 0x000805CD, 0x000805CE, 0x000805CF,
+    0x0008005D, 0x000805D1, 0x000805D2, 0x000805D3, 0x000805D4, 0x000805D5, 0x000805D6, 0x000805D7,
+    0x000805D8, 0x000805D9, 0x000805DA, 0x000805DB, 0x000805DC, 0x1008005E, 0x000805DE, 0x000805DF,
+    0x0008005E, 0x000805E1, 0x000805E2, 0x000805E3, 0x000805E4, 0x000805E5, 0x000805E6, 0x000805E7,
+    0x000805E8, 0x000805E9, 0x000805EA, 0x000805EB, 0x000805EC, 0x000805ED, 0x2008005F, 0x000805EF,
+    0x0008005F, 0x000805F1, 0x000805F2, 0x000805F3, 0x000805F4, 0x000805F5, 0x000805F6, 0x000805F7,
+    0x000805F8, 0x000805F9, 0x000805FA, 0x000805FB, 0x000805FC, 0x000805FD, 0x000805FE, 0x000805FF,
+    0x00000045, 0x00000451, 0x00000452, 0x00000453, 0x00000454, 0x00100046, 0x00000456, 0x00000457,
+    0x00000458, 0x00000459, 0x0000045A, 0x0000045B, 0x0000045C, 0x0000045D, 0x0000045E, 0x0000045F,
+    0x00000451, 0x00010452, 0x00004512, 0x00004513, 0x00004514, 0x00004515, 0x00004516, 0x00004517,
+    0x00004518, 0x00004519, 0x0000451A, 0x0000451B, 0x0000451C, 0x0000451D, 0x0000451E, 0x0000451F,
+    0x00000452, 0x00004521, 0x00020453, 0x00004523, 0x00004524, 0x00004525, 0x00004526, 0x00004527,
+    0x00004528, 0x00004529, 0x0000452A, 0x0000452B, 0x0000452C, 0x0000452D, 0x0000452E, 0x0000452F,
+    0x00000453, 0x00004531, 0x00004532, 0x00040454, 0x00004534, 0x00004535, 0x00004536, 0x00004537,
+    0x00004538, 0x00004539, 0x0000453A, 0x0000453B, 0x0000453C, 0x0000453D, 0x0000453E, 0x0000453F,
+    0x00000454, 0x00004541, 0x00004542, 0x00004543, 0x00080455, 0x00004545, 0x00004546, 0x00004547,
+    0x00004548, 0x00004549, 0x0000454A, 0x0000454B, 0x0000454C, 0x0000454D, 0x0000454E, 0x0000454F,
+    0x00100046, 0x00100461, 0x00100462, 0x00100463, 0x00100464, 0x00100456, 0x00100466, 0x00100467,
+    0x00100468, 0x00100469, 0x0010046A, 0x0010046B, 0x0010046C, 0x0010046D, 0x0010046E, 0x0010046F,
+    0x00000456, 0x00004561, 0x00004562, 0x00004563, 0x00004564, 0x00004565, 0x00200457, 0x00004567,
+    0x00004568, 0x00004569, 0x0000456A, 0x0000456B, 0x0000456C, 0x0000456D, 0x0000456E, 0x0000456F,
+    0x00000457, 0x00004571, 0x00004572, 0x00004573, 0x00004574, 0x00004575, 0x00004576, 0x00400458,
+    0x00004578, 0x00004579, 0x0000457A, 0x0000457B, 0x0000457C, 0x0000457D, 0x0000457E, 0x0000457F,
+    0x00000458, 0x00004581, 0x00004582, 0x00004583, 0x00004584, 0x00004585, 0x00004586, 0x00004587,
+    0x00800459, 0x00004589, 0x0000458A, 0x0000458B, 0x0000458C, 0x0000458D, 0x0000458E, 0x0000458F,
+    0x00000459, 0x00004591, 0x00004592, 0x00004593, 0x00004594, 0x00004595, 0x00004596, 0x00004597,
+    0x00004598, 0x0100045A, 0x0000459A, 0x0000459B, 0x0000459C, 0x0000459D, 0x0000459E, 0x0000459F,
+    0x0000045A, 0x000045A1, 0x000045A2, 0x000045A3, 0x000045A4, 0x000045A5, 0x000045A6, 0x000045A7,
+    0x000045A8, 0x000045A9, 0x8200045B, 0x000045AB, 0x000045AC, 0x000045AD, 0x000045AE, 0x000045AF,
+    0x0000045B, 0x000045B1, 0x000045B2, 0x000045B3, 0x000045B4, 0x000045B5, 0x000045B6, 0x000045B7,
+    0x000045B8, 0x000045B9, 0x000045BA, 0x0400045C, 0x000045BC, 0x000045BD, 0x000045BE, 0x000045BF,
+    0x0000045C, 0x000045C1, 0x000045C2, 0x000045C3, 0x000045C4, 0x000045C5, 0x000045C6, 0x000045C7,
+    0x000045C8, 0x000045C9, 0x000045CA, 0x000045CB, 0x0800045D, 0x000045CD, 0x000045CE, 0x000045CF,
+    0x0000045D, 0x000045D1, 0x000045D2, 0x000045D3, 0x000045D4, 0x000045D5, 0x000045D6, 0x000045D7,
+    0x000045D8, 0x000045D9, 0x000045DA, 0x000045DB, 0x000045DC, 0x1000045E, 0x000045DE, 0x000045DF,
+    0x0000045E, 0x000045E1, 0x000045E2, 0x000045E3, 0x000045E4, 0x000045E5, 0x000045E6, 0x000045E7,
+    0x000045E8, 0x000045E9, 0x000045EA, 0x000045EB, 0x000045EC, 0x000045ED, 0x2000045F, 0x000045EF,
+    0x0000045F, 0x000045F1, 0x000045F2, 0x000045F3, 0x000045F4, 0x000045F5, 0x000045F6, 0x000045F7,
+    0x000045F8, 0x000045F9, 0x000045FA, 0x000045FB, 0x000045FC, 0x000045FD, 0x000045FE, 0x000045FF,
+    0x00000046, 0x00000461, 0x00000462, 0x00000463, 0x00000464, 0x00000465, 0x00200047, 0x00000467,
+    0x00000468, 0x00000469, 0x0000046A, 0x0000046B, 0x0000046C, 0x0000046D, 0x0000046E, 0x0000046F,
+    0x00000461, 0x00010462, 0x00004612, 0x00004613, 0x00004614, 0x00004615, 0x00004616, 0x00004617,
+    0x00004618, 0x00004619, 0x0000461A, 0x0000461B, 0x0000461C, 0x0000461D, 0x0000461E, 0x0000461F,
+    0x00000462, 0x00004621, 0x00020463, 0x00004623, 0x00004624, 0x00004625, 0x00004626, 0x00004627,
+    0x00004628, 0x00004629, 0x0000462A, 0x0000462B, 0x0000462C, 0x0000462D, 0x0000462E, 0x0000462F,
+    0x00000463, 0x00004631, 0x00004632, 0x00040464, 0x00004634, 0x00004635, 0x00004636, 0x00004637,
+    0x00004638, 0x00004639, 0x0000463A, 0x0000463B, 0x0000463C, 0x0000463D, 0x0000463E, 0x0000463F,
+    0x00000464, 0x00004641, 0x00004642, 0x00004643, 0x00080465, 0x00004645, 0x00004646, 0x00004647,
+    0x00004648, 0x00004649, 0x0000464A, 0x0000464B, 0x0000464C, 0x0000464D, 0x0000464E, 0x0000464F,
+    0x00000465, 0x00004651, 0x00004652, 0x00004653, 0x00004654, 0x00100466, 0x00004656, 0x00004657,
+    0x00004658, 0x00004659, 0x0000465A, 0x0000465B, 0x0000465C, 0x0000465D, 0x0000465E, 0x0000465F,
+    0x00200047, 0x00200471, 0x00200472, 0x00200473, 0x00200474, 0x00200475, 0x00200467, 0x00200477,
+    0x00200478, 0x00200479, 0x0020047A, 0x0020047B, 0x0020047C, 0x0020047D, 0x0020047E, 0x0020047F,
+    0x00000467, 0x00004671, 0x00004672, 0x00004673, 0x00004674, 0x00004675, 0x00004676, 0x00400468,
+    0x00004678, 0x00004679, 0x0000467A, 0x0000467B, 0x0000467C, 0x0000467D, 0x0000467E, 0x0000467F,
+    0x00000468, 0x00004681, 0x00004682, 0x00004683, 0x00004684, 0x00004685, 0x00004686, 0x00004687,
+    0x00800469, 0x00004689, 0x0000468A, 0x0000468B, 0x0000468C, 0x0000468D, 0x0000468E, 0x0000468F,
+    0x00000469, 0x00004691, 0x00004692, 0x00004693, 0x00004694, 0x00004695, 0x00004696, 0x00004697,
+    0x00004698, 0x0100046A, 0x0000469A, 0x0000469B, 0x0000469C, 0x0000469D, 0x0000469E, 0x0000469F,
+    0x0000046A, 0x000046A1, 0x000046A2, 0x000046A3, 0x000046A4, 0x000046A5, 0x000046A6, 0x000046A7,
+    0x000046A8, 0x000046A9, 0x8200046B, 0x000046AB, 0x000046AC, 0x000046AD, 0x000046AE, 0x000046AF,
+    0x0000046B, 0x000046B1, 0x000046B2, 0x000046B3, 0x000046B4, 0x000046B5, 0x000046B6, 0x000046B7,
+    0x000046B8, 0x000046B9, 0x000046BA, 0x0400046C, 0x000046BC, 0x000046BD, 0x000046BE, 0x000046BF,
+    0x0000046C, 0x000046C1, 0x000046C2, 0x000046C3, 0x000046C4, 0x000046C5, 0x000046C6, 0x000046C7,
+    0x000046C8, 0x000046C9, 0x000046CA, 0x000046CB, 0x0800046D, 0x000046CD, 0x000046CE, 0x000046CF,
+    0x0000046D, 0x000046D1, 0x000046D2, 0x000046D3, 0x000046D4, 0x000046D5, 0x000046D6, 0x000046D7,
+    0x000046D8, 0x000046D9, 0x000046DA, 0x000046DB, 0x000046DC, 0x1000046E, 0x000046DE, 0x000046DF,
+    0x0000046E, 0x000046E1, 0x000046E2, 0x000046E3, 0x000046E4, 0x000046E5, 0x000046E6, 0x000046E7,
+    0x000046E8, 0x000046E9, 0x000046EA, 0x000046EB, 0x000046EC, 0x000046ED, 0x2000046F, 0x000046EF,
+    0x0000046F, 0x000046F1, 0x000046F2, 0x000046F3, 0x000046F4, 0x000046F5, 0x000046F6, 0x000046F7,
+    0x000046F8, 0x000046F9, 0x000046FA, 0x000046FB, 0x000046FC, 0x000046FD, 0x000046FE, 0x000046FF,
+    0x00000047, 0x00000471, 0x00000472, 0x00000473, 0x00000474, 0x00000475, 0x00000476, 0x00400048,
+    0x00000478, 0x00000479, 0x0000047A, 0x0000047B, 0x0000047C, 0x0000047D, 0x0000047E, 0x0000047F,
+    0x00000471, 0x00010472, 0x00004712, 0x00004713, 0x00004714, 0x00004715, 0x00004716, 0x00004717,
+    0x00004718, 0x00004719, 0x0000471A, 0x0000471B, 0x0000471C, 0x0000471D, 0x0000471E, 0x0000471F,
+    0x00000472, 0x00004721, 0x00020473, 0x00004723, 0x00004724, 0x00004725, 0x00004726, 0x00004727,
+    0x00004728, 0x00004729, 0x0000472A, 0x0000472B, 0x0000472C, 0x0000472D, 0x0000472E, 0x0000472F,
+    0x00000473, 0x00004731, 0x00004732, 0x00040474, 0x00004734, 0x00004735, 0x00004736, 0x00004737,
+    0x00004738, 0x00004739, 0x0000473A, 0x0000473B, 0x0000473C, 0x0000473D, 0x0000473E, 0x0000473F,
+    0x00000474, 0x00004741, 0x00004742, 0x00004743, 0x00080475, 0x00004745, 0x00004746, 0x00004747,
+    0x00004748, 0x00004749, 0x0000474A, 0x0000474B, 0x0000474C, 0x0000474D, 0x0000474E, 0x0000474F,
+    0x00000475, 0x00004751, 0x00004752, 0x00004753, 0x00004754, 0x00100476, 0x00004756, 0x00004757,
+    0x00004758, 0x00004759, 0x0000475A, 0x0000475B, 0x0000475C, 0x0000475D, 0x0000475E, 0x0000475F,
+    0x00000476, 0x00004761, 0x00004762, 0x00004763, 0x00004764, 0x00004765, 0x00200477, 0x00004767,
+    0x00004768, 0x00004769, 0x0000476A, 0x0000476B, 0x0000476C, 0x0000476D, 0x0000476E, 0x0000476F,
+    0x00400048, 0x00400481, 0x00400482, 0x00400483, 0x00400484, 0x00400485, 0x00400486, 0x00400478,
+    0x00400488, 0x00400489, 0x0040048A, 0x0040048B, 0x0040048C, 0x0040048D, 0x0040048E, 0x0040048F,
+    0x00000478, 0x00004781, 0x00004782, 0x00004783, 0x00004784, 0x00004785, 0x00004786, 0x00004787,
+    0x00800479, 0x00004789, 0x0000478A, 0x0000478B, 0x0000478C, 0x0000478D, 0x0000478E, 0x0000478F,
+    0x00000479, 0x00004791, 0x00004792, 0x00004793, 0x00004794, 0x00004795, 0x00004796, 0x00004797,
+    0x00004798, 0x0100047A, 0x0000479A, 0x0000479B, 0x0000479C, 0x0000479D, 0x0000479E, 0x0000479F,
+    0x0000047A, 0x000047A1, 0x000047A2, 0x000047A3, 0x000047A4, 0x000047A5, 0x000047A6, 0x000047A7,
+    0x000047A8, 0x000047A9, 0x8200047B, 0x000047AB, 0x000047AC, 0x000047AD, 0x000047AE, 0x000047AF,
+    0x0000047B, 0x000047B1, 0x000047B2, 0x000047B3, 0x000047B4, 0x000047B5, 0x000047B6, 0x000047B7,
+    0x000047B8, 0x000047B9, 0x000047BA, 0x0400047C, 0x000047BC, 0x000047BD, 0x000047BE, 0x000047BF,
+    0x0000047C, 0x000047C1, 0x000047C2, 0x000047C3, 0x000047C4, 0x000047C5, 0x000047C6, 0x000047C7,
+    0x000047C8, 0x000047C9, 0x000047CA, 0x000047CB, 0x0800047D, 0x000047CD, 0x000047CE, 0x000047CF,
+    0x0000047D, 0x000047D1, 0x000047D2, 0x000047D3, 0x000047D4, 0x000047D5, 0x000047D6, 0x000047D7,
+    0x000047D8, 0x000047D9, 0x000047DA, 0x000047DB, 0x000047DC, 0x1000047E, 0x000047DE, 0x000047DF,
+    0x0000047E, 0x000047E1, 0x000047E2, 0x000047E3, 0x000047E4, 0x000047E5, 0x000047E6, 0x000047E7,
+    0x000047E8, 0x000047E9, 0x000047EA, 0x000047EB, 0x000047EC, 0x000047ED, 0x2000047F, 0x000047EF,
+    0x0000047F, 0x000047F1, 0x000047F2, 0x000047F3, 0x000047F4, 0x000047F5, 0x000047F6, 0x000047F7,
+    0x000047F8, 0x000047F9, 0x000047FA, 0x000047FB, 0x000047FC, 0x000047FD, 0x000047FE, 0x000047FF,
+    0x00000048, 0x00000481, 0x00000482, 0x00000483, 0x00000484, 0x00000485, 0x00000486, 0x00000487,
+    0x00800049, 0x00000489, 0x0000048A, 0x0000048B, 0x0000048C, 0x0000048D, 0x0000048E, 0x0000048F,
+    0x00000481, 0x00010482, 0x00004812, 0x00004813, 0x00004814, 0x00004815, 0x00004816, 0x00004817,
+    0x00004818, 0x00004819, 0x0000481A, 0x0000481B, 0x0000481C, 0x0000481D, 0x0000481E, 0x0000481F,
+    0x00000482, 0x00004821, 0x00020483, 0x00004823, 0x00004824, 0x00004825, 0x00004826, 0x00004827,
+    0x00004828, 0x00004829, 0x0000482A, 0x0000482B, 0x0000482C, 0x0000482D, 0x0000482E, 0x0000482F,
+    0x00000483, 0x00004831, 0x00004832, 0x00040484, 0x00004834, 0x00004835, 0x00004836, 0x00004837,
+    0x00004838, 0x00004839, 0x0000483A, 0x0000483B, 0x0000483C, 0x0000483D, 0x0000483E, 0x0000483F,
+    0x00000484, 0x00004841, 0x00004842, 0x00004843, 0x00080485, 0x00004845, 0x00004846, 0x00004847,
+    0x00004848, 0x00004849, 0x0000484A, 0x0000484B, 0x0000484C, 0x0000484D, 0x0000484E, 0x0000484F,
+    0x00000485, 0x00004851, 0x00004852, 0x00004853, 0x00004854, 0x00100486, 0x00004856, 0x00004857,
+    0x00004858, 0x00004859, 0x0000485A, 0x0000485B, 0x0000485C, 0x0000485D, 0x0000485E, 0x0000485F,
+    0x00000486, 0x00004861, 0x00004862, 0x00004863, 0x00004864, 0x00004865, 0x00200487, 0x00004867,
+    0x00004868, 0x00004869, 0x0000486A, 0x0000486B, 0x0000486C, 0x0000486D, 0x0000486E, 0x0000486F,
+    0x00000487, 0x00004871, 0x00004872, 0x00004873, 0x00004874, 0x00004875, 0x00004876, 0x00400488,
+    0x00004878, 0x00004879, 0x0000487A, 0x0000487B, 0x0000487C, 0x0000487D, 0x0000487E, 0x0000487F,
+    0x00800049, 0x00800491, 0x00800492, 0x00800493, 0x00800494, 0x00800495, 0x00800496, 0x00800497,
+    0x00800489, 0x00800499, 0x0080049A, 0x0080049B, 0x0080049C, 0x0080049D, 0x0080049E, 0x0080049F,
+    0x00000489, 0x00004891, 0x00004892, 0x00004893, 0x00004894, 0x00004895, 0x00004896, 0x00004897,
+    0x00004898, 0x0100048A, 0x0000489A, 0x0000489B, 0x0000489C, 0x0000489D, 0x0000489E, 0x0000489F,
+    0x0000048A, 0x000048A1, 0x000048A2, 0x000048A3, 0x000048A4, 0x000048A5, 0x000048A6, 0x000048A7,
+    0x000048A8, 0x000048A9, 0x8200048B, 0x000048AB, 0x000048AC, 0x000048AD, 0x000048AE, 0x000048AF,
+    0x0000048B, 0x000048B1, 0x000048B2, 0x000048B3, 0x000048B4, 0x000048B5, 0x000048B6, 0x000048B7,
+    0x000048B8, 0x000048B9, 0x000048BA, 0x0400048C, 0x000048BC, 0x000048BD, 0x000048BE, 0x000048BF,
+    0x0000048C, 0x000048C1, 0x000048C2, 0x000048C3, 0x000048C4, 0x000048C5, 0x000048C6, 0x000048C7,
+    0x000048C8, 0x000048C9, 0x000048CA, 0x000048CB, 0x0800048D, 0x000048CD, 0x000048CE, 0x000048CF,
+    0x0000048D, 0x000048D1, 0x000048D2, 0x000048D3, 0x000048D4, 0x000048D5, 0x000048D6, 0x000048D7,
+    0x000048D8, 0x000048D9, 0x000048DA, 0x000048DB, 0x000048DC, 0x1000048E, 0x000048DE, 0x000048DF,
+    0x0000048E, 0x000048E1, 0x000048E2, 0x000048E3, 0x000048E4, 0x000048E5, 0x000048E6, 0x000048E7,
+    0x000048E8, 0x000048E9, 0x000048EA, 0x000048EB, 0x000048EC, 0x000048ED, 0x2000048F, 0x000048EF,
+    0x0000048F, 0x000048F1, 0x000048F2, 0x000048F3, 0x000048F4, 0x000048F5, 0x000048F6, 0x000048F7,
+    0x000048F8, 0x000048F9, 0x000048FA, 0x000048FB, 0x000048FC, 0x000048FD, 0x000048FE, 0x000048FF,
+    0x00000049, 0x00000491, 0x00000492, 0x00000493, 0x00000494, 0x00000495, 0x00000496, 0x00000497,
+    0x00000498, 0x0100004A, 0x0000049A, 0x0000049B, 0x0000049C, 0x0000049D, 0x0000049E, 0x0000049F,
+    0x00000491, 0x00010492, 0x00004912, 0x00004913, 0x00004914, 0x00004915, 0x00004916, 0x00004917,
+    0x00004918, 0x00004919, 0x0000491A, 0x0000491B, 0x0000491C, 0x0000491D, 0x0000491E, 0x0000491F,
+    0x00000492, 0x00004921, 0x00020493, 0x00004923, 0x00004924, 0x00004925, 0x00004926, 0x00004927,
+    0x00004928, 0x00004929, 0x0000492A, 0x0000492B, 0x0000492C, 0x0000492D, 0x0000492E, 0x0000492F,
+    0x00000493, 0x00004931, 0x00004932, 0x00040494, 0x00004934, 0x00004935, 0x00004936, 0x00004937,
+    0x00004938, 0x00004939, 0x0000493A, 0x0000493B, 0x0000493C, 0x0000493D, 0x0000493E, 0x0000493F,
+    0x00000494, 0x00004941, 0x00004942, 0x00004943, 0x00080495, 0x00004945, 0x00004946, 0x00004947,
+    0x00004948, 0x00004949, 0x0000494A, 0x0000494B, 0x0000494C, 0x0000494D, 0x0000494E, 0x0000494F,
+    0x00000495, 0x00004951, 0x00004952, 0x00004953, 0x00004954, 0x00100496, 0x00004956, 0x00004957,
+    0x00004958, 0x00004959, 0x0000495A, 0x0000495B, 0x0000495C, 0x0000495D, 0x0000495E, 0x0000495F,
+    0x00000496, 0x00004961, 0x00004962, 0x00004963, 0x00004964, 0x00004965, 0x00200497, 0x00004967,
+    0x00004968, 0x00004969, 0x0000496A, 0x0000496B, 0x0000496C, 0x0000496D, 0x0000496E, 0x0000496F,
+    0x00000497, 0x00004971, 0x00004972, 0x00004973, 0x00004974, 0x00004975, 0x00004976, 0x00400498,
+    0x00004978, 0x00004979, 0x0000497A, 0x0000497B, 0x0000497C, 0x0000497D, 0x0000497E, 0x0000497F,
+    0x00000498, 0x00004981, 0x00004982, 0x00004983, 0x00004984, 0x00004985, 0x00004986, 0x00004987,
+    0x00800499, 0x00004989, 0x0000498A, 0x0000498B, 0x0000498C, 0x0000498D, 0x0000498E, 0x0000498F,
+    0x0100004A, 0x010004A1, 0x010004A2, 0x010004A3, 0x010004A4, 0x010004A5, 0x010004A6, 0x010004A7,
+    0x010004A8, 0x0100049A, 0x010004AA, 0x010004AB, 0x010004AC, 0x010004AD, 0x010004AE, 0x010004AF,
+    0x0000049A, 0x000049A1, 0x000049A2, 0x000049A3, 0x000049A4, 0x000049A5, 0x000049A6, 0x000049A7,
+    0x000049A8, 0x000049A9, 0x8200049B, 0x000049AB, 0x000049AC, 0x000049AD, 0x000049AE, 0x000049AF,
+    0x0000049B, 0x000049B1, 0x000049B2, 0x000049B3, 0x000049B4, 0x000049B5, 0x000049B6, 0x000049B7,
+    0x000049B8, 0x000049B9, 0x000049BA, 0x0400049C, 0x000049BC, 0x000049BD, 0x000049BE, 0x000049BF,
+    0x0000049C, 0x000049C1, 0x000049C2, 0x000049C3, 0x000049C4, 0x000049C5, 0x000049C6, 0x000049C7,
+    0x000049C8, 0x000049C9, 0x000049CA, 0x000049CB, 0x0800049D, 0x000049CD, 0x000049CE, 0x000049CF,
+    0x0000049D, 0x000049D1, 0x000049D2, 0x000049D3, 0x000049D4, 0x000049D5, 0x000049D6, 0x000049D7,
+    0x000049D8, 0x000049D9, 0x000049DA, 0x000049DB, 0x000049DC, 0x1000049E, 0x000049DE, 0x000049DF,
+    0x0000049E, 0x000049E1, 0x000049E2, 0x000049E3, 0x000049E4, 0x000049E5, 0x000049E6, 0x000049E7,
+    0x000049E8, 0x000049E9, 0x000049EA, 0x000049EB, 0x000049EC, 0x000049ED, 0x2000049F, 0x000049EF,
+    0x0000049F, 0x000049F1, 0x000049F2, 0x000049F3, 0x000049F4, 0x000049F5, 0x000049F6, 0x000049F7,
+    0x000049F8, 0x000049F9, 0x000049FA, 0x000049FB, 0x000049FC, 0x000049FD, 0x000049FE, 0x000049FF,
+    0x0000004A, 0x000004A1, 0x000004A2, 0x000004A3, 0x000004A4, 0x000004A5, 0x000004A6, 0x000004A7,
+    0x000004A8, 0x000004A9, 0x8200004B, 0x000004AB, 0x000004AC, 0x000004AD, 0x000004AE, 0x000004AF,
+    0x000004A1, 0x000104A2, 0x00004A12, 0x00004A13, 0x00004A14, 0x00004A15, 0x00004A16, 0x00004A17,
+    0x00004A18, 0x00004A19, 0x00004A1A, 0x00004A1B, 0x00004A1C, 0x00004A1D, 0x00004A1E, 0x00004A1F,
+    0x000004A2, 0x00004A21, 0x000204A3, 0x00004A23, 0x00004A24, 0x00004A25, 0x00004A26, 0x00004A27,
+    0x00004A28, 0x00004A29, 0x00004A2A, 0x00004A2B, 0x00004A2C, 0x00004A2D, 0x00004A2E, 0x00004A2F,
+    0x000004A3, 0x00004A31, 0x00004A32, 0x000404A4, 0x00004A34, 0x00004A35, 0x00004A36, 0x00004A37,
+    0x00004A38, 0x00004A39, 0x00004A3A, 0x00004A3B, 0x00004A3C, 0x00004A3D, 0x00004A3E, 0x00004A3F,
+    0x000004A4, 0x00004A41, 0x00004A42, 0x00004A43, 0x000804A5, 0x00004A45, 0x00004A46, 0x00004A47,
+    0x00004A48, 0x00004A49, 0x00004A4A, 0x00004A4B, 0x00004A4C, 0x00004A4D, 0x00004A4E, 0x00004A4F,
+    0x000004A5, 0x00004A51, 0x00004A52, 0x00004A53, 0x00004A54, 0x001004A6, 0x00004A56, 0x00004A57,
+    0x00004A58, 0x00004A59, 0x00004A5A, 0x00004A5B, 0x00004A5C, 0x00004A5D, 0x00004A5E, 0x00004A5F,
+    0x000004A6, 0x00004A61, 0x00004A62, 0x00004A63, 0x00004A64, 0x00004A65, 0x002004A7, 0x00004A67,
+    0x00004A68, 0x00004A69, 0x00004A6A, 0x00004A6B, 0x00004A6C, 0x00004A6D, 0x00004A6E, 0x00004A6F,
+    0x000004A7, 0x00004A71, 0x00004A72, 0x00004A73, 0x00004A74, 0x00004A75, 0x00004A76, 0x004004A8,
+    0x00004A78, 0x00004A79, 0x00004A7A, 0x00004A7B, 0x00004A7C, 0x00004A7D, 0x00004A7E, 0x00004A7F,
+    0x000004A8, 0x00004A81, 0x00004A82, 0x00004A83, 0x00004A84, 0x00004A85, 0x00004A86, 0x00004A87,
+    0x008004A9, 0x00004A89, 0x00004A8A, 0x00004A8B, 0x00004A8C, 0x00004A8D, 0x00004A8E, 0x00004A8F,
+    0x000004A9, 0x00004A91, 0x00004A92, 0x00004A93, 0x00004A94, 0x00004A95, 0x00004A96, 0x00004A97,
+    0x00004A98, 0x010004AA, 0x00004A9A, 0x00004A9B, 0x00004A9C, 0x00004A9D, 0x00004A9E, 0x00004A9F,
+    0x8200004B, 0x820004B1, 0x820004B2, 0x820004B3, 0x820004B4, 0x820004B5, 0x820004B6, 0x820004B7,
+    0x820004B8, 0x820004B9, 0x820004AB, 0x820004BB, 0x820004BC, 0x820004BD, 0x820004BE, 0x820004BF,
+    0x000004AB, 0x00004AB1, 0x00004AB2, 0x00004AB3, 0x00004AB4, 0x00004AB5, 0x00004AB6, 0x00004AB7,
+    0x00004AB8, 0x00004AB9, 0x00004ABA, 0x040004AC, 0x00004ABC, 0x00004ABD, 0x00004ABE, 0x00004ABF,
+    0x000004AC, 0x00004AC1, 0x00004AC2, 0x00004AC3, 0x00004AC4, 0x00004AC5, 0x00004AC6, 0x00004AC7,
+    0x00004AC8, 0x00004AC9, 0x00004ACA, 0x00004ACB, 0x080004AD, 0x00004ACD, 0x00004ACE, 0x00004ACF,
+    0x000004AD, 0x00004AD1, 0x00004AD2, 0x00004AD3, 0x00004AD4, 0x00004AD5, 0x00004AD6, 0x00004AD7,
+    0x00004AD8, 0x00004AD9, 0x00004ADA, 0x00004ADB, 0x00004ADC, 0x100004AE, 0x00004ADE, 0x00004ADF,
+    0x000004AE, 0x00004AE1, 0x00004AE2, 0x00004AE3, 0x00004AE4, 0x00004AE5, 0x00004AE6, 0x00004AE7,
+    0x00004AE8, 0x00004AE9, 0x00004AEA, 0x00004AEB, 0x00004AEC, 0x00004AED, 0x200004AF, 0x00004AEF,
+    0x000004AF, 0x00004AF1, 0x00004AF2, 0x00004AF3, 0x00004AF4, 0x00004AF5, 0x00004AF6, 0x00004AF7,
+    0x00004AF8, 0x00004AF9, 0x00004AFA, 0x00004AFB, 0x00004AFC, 0x00004AFD, 0x00004AFE, 0x00004AFF,
+    0x0000004B, 0x000004B1, 0x000004B2, 0x000004B3, 0x000004B4, 0x000004B5, 0x000004B6, 0x000004B7,
+    0x000004B8, 0x000004B9, 0x000004BA, 0x0400004C, 0x000004BC, 0x000004BD, 0x000004BE, 0x000004BF,
+    0x000004B1, 0x000104B2, 0x00004B12, 0x00004B13, 0x00004B14, 0x00004B15, 0x00004B16, 0x00004B17,
+    0x00004B18, 0x00004B19, 0x00004B1A, 0x00004B1B, 0x00004B1C, 0x00004B1D, 0x00004B1E, 0x00004B1F,
+    0x000004B2, 0x00004B21, 0x000204B3, 0x00004B23, 0x00004B24, 0x00004B25, 0x00004B26, 0x00004B27,
+    0x00004B28, 0x00004B29, 0x00004B2A, 0x00004B2B, 0x00004B2C, 0x00004B2D, 0x00004B2E, 0x00004B2F,
+    0x000004B3, 0x00004B31, 0x00004B32, 0x000404B4, 0x00004B34, 0x00004B35, 0x00004B36, 0x00004B37,
+    0x00004B38, 0x00004B39, 0x00004B3A, 0x00004B3B, 0x00004B3C, 0x00004B3D, 0x00004B3E, 0x00004B3F,
+    0x000004B4, 0x00004B41, 0x00004B42, 0x00004B43, 0x000804B5, 0x00004B45, 0x00004B46, 0x00004B47,
+    0x00004B48, 0x00004B49, 0x00004B4A, 0x00004B4B, 0x00004B4C, 0x00004B4D, 0x00004B4E, 0x00004B4F,
+    0x000004B5, 0x00004B51, 0x00004B52, 0x00004B53, 0x00004B54, 0x001004B6, 0x00004B56, 0x00004B57,
+    0x00004B58, 0x00004B59, 0x00004B5A, 0x00004B5B, 0x00004B5C, 0x00004B5D, 0x00004B5E, 0x00004B5F,
+    0x000004B6, 0x00004B61, 0x00004B62, 0x00004B63, 0x00004B64, 0x00004B65, 0x002004B7, 0x00004B67,
+    0x00004B68, 0x00004B69, 0x00004B6A, 0x00004B6B, 0x00004B6C, 0x00004B6D, 0x00004B6E, 0x00004B6F,
+    0x000004B7, 0x00004B71, 0x00004B72, 0x00004B73, 0x00004B74, 0x00004B75, 0x00004B76, 0x004004B8,
+    0x00004B78, 0x00004B79, 0x00004B7A, 0x00004B7B, 0x00004B7C, 0x00004B7D, 0x00004B7E, 0x00004B7F,
+    0x000004B8, 0x00004B81, 0x00004B82, 0x00004B83, 0x00004B84, 0x00004B85, 0x00004B86, 0x00004B87,
+    0x008004B9, 0x00004B89, 0x00004B8A, 0x00004B8B, 0x00004B8C, 0x00004B8D, 0x00004B8E, 0x00004B8F,
+    0x000004B9, 0x00004B91, 0x00004B92, 0x00004B93, 0x00004B94, 0x00004B95, 0x00004B96, 0x00004B97,
+    0x00004B98, 0x010004BA, 0x00004B9A, 0x00004B9B, 0x00004B9C, 0x00004B9D, 0x00004B9E, 0x00004B9F,
+    0x000004BA, 0x00004BA1, 0x00004BA2, 0x00004BA3, 0x00004BA4, 0x00004BA5, 0x00004BA6, 0x00004BA7,
+    0x00004BA8, 0x00004BA9, 0x820004BB, 0x00004BAB, 0x00004BAC, 0x00004BAD, 0x00004BAE, 0x00004BAF,
+    0x0400004C, 0x040004C1, 0x040004C2, 0x040004C3, 0x040004C4, 0x040004C5, 0x040004C6, 0x040004C7,
+    0x040004C8, 0x040004C9, 0x040004CA, 0x040004BC, 0x040004CC, 0x040004CD, 0x040004CE, 0x040004CF,
+    0x000004BC, 0x00004BC1, 0x00004BC2, 0x00004BC3, 0x00004BC4, 0x00004BC5, 0x00004BC6, 0x00004BC7,
+    0x00004BC8, 0x00004BC9, 0x00004BCA, 0x00004BCB, 0x080004BD, 0x00004BCD, 0x00004BCE, 0x00004BCF,
+    0x000004BD, 0x00004BD1, 0x00004BD2, 0x00004BD3, 0x00004BD4, 0x00004BD5, 0x00004BD6, 0x00004BD7,
+    0x00004BD8, 0x00004BD9, 0x00004BDA, 0x00004BDB, 0x00004BDC, 0x100004BE, 0x00004BDE, 0x00004BDF,
+    0x000004BE, 0x00004BE1, 0x00004BE2, 0x00004BE3, 0x00004BE4, 0x00004BE5, 0x00004BE6, 0x00004BE7,
+    0x00004BE8, 0x00004BE9, 0x00004BEA, 0x00004BEB, 0x00004BEC, 0x00004BED, 0x200004BF, 0x00004BEF,
+    0x000004BF, 0x00004BF1, 0x00004BF2, 0x00004BF3, 0x00004BF4, 0x00004BF5, 0x00004BF6, 0x00004BF7,
+    0x00004BF8, 0x00004BF9, 0x00004BFA, 0x00004BFB, 0x00004BFC, 0x00004BFD, 0x00004BFE, 0x00004BFF,
+    0x0000004C, 0x000004C1, 0x000004C2, 0x000004C3, 0x000004C4, 0x000004C5, 0x000004C6, 0x000004C7,
+    0x000004C8, 0x000004C9, 0x000004CA, 0x000004CB, 0x0800004D, 0x000004CD, 0x000004CE, 0x000004CF,
+    0x000004C1, 0x000104C2, 0x00004C12, 0x00004C13, 0x00004C14, 0x00004C15, 0x00004C16, 0x00004C17,
+    0x00004C18, 0x00004C19, 0x00004C1A, 0x00004C1B, 0x00004C1C, 0x00004C1D, 0x00004C1E, 0x00004C1F,
+    0x000004C2, 0x00004C21, 0x000204C3, 0x00004C23, 0x00004C24, 0x00004C25, 0x00004C26, 0x00004C27,
+    0x00004C28, 0x00004C29, 0x00004C2A, 0x00004C2B, 0x00004C2C, 0x00004C2D, 0x00004C2E, 0x00004C2F,
+    0x000004C3, 0x00004C31, 0x00004C32, 0x000404C4, 0x00004C34, 0x00004C35, 0x00004C36, 0x00004C37,
+    0x00004C38, 0x00004C39, 0x00004C3A, 0x00004C3B, 0x00004C3C, 0x00004C3D, 0x00004C3E, 0x00004C3F,
+    0x000004C4, 0x00004C41, 0x00004C42, 0x00004C43, 0x000804C5, 0x00004C45, 0x00004C46, 0x00004C47,
+    0x00004C48, 0x00004C49, 0x00004C4A, 0x00004C4B, 0x00004C4C, 0x00004C4D, 0x00004C4E, 0x00004C4F,
+    0x000004C5, 0x00004C51, 0x00004C52, 0x00004C53, 0x00004C54, 0x001004C6, 0x00004C56, 0x00004C57,
+    0x00004C58, 0x00004C59, 0x00004C5A, 0x00004C5B, 0x00004C5C, 0x00004C5D, 0x00004C5E, 0x00004C5F,
+    0x000004C6, 0x00004C61, 0x00004C62, 0x00004C63, 0x00004C64, 0x00004C65, 0x002004C7, 0x00004C67,
+    0x00004C68, 0x00004C69, 0x00004C6A, 0x00004C6B, 0x00004C6C, 0x00004C6D, 0x00004C6E, 0x00004C6F,
+    0x000004C7, 0x00004C71, 0x00004C72, 0x00004C73, 0x00004C74, 0x00004C75, 0x00004C76, 0x004004C8,
+    0x00004C78, 0x00004C79, 0x00004C7A, 0x00004C7B, 0x00004C7C, 0x00004C7D, 0x00004C7E, 0x00004C7F,
+    0x000004C8, 0x00004C81, 0x00004C82, 0x00004C83, 0x00004C84, 0x00004C85, 0x00004C86, 0x00004C87,
+    0x008004C9, 0x00004C89, 0x00004C8A, 0x00004C8B, 0x00004C8C, 0x00004C8D, 0x00004C8E, 0x00004C8F,
+    0x000004C9, 0x00004C91, 0x00004C92, 0x00004C93, 0x00004C94, 0x00004C95, 0x00004C96, 0x00004C97,
+    0x00004C98, 0x010004CA, 0x00004C9A, 0x00004C9B, 0x00004C9C, 0x00004C9D, 0x00004C9E, 0x00004C9F,
+    0x000004CA, 0x00004CA1, 0x00004CA2, 0x00004CA3, 0x00004CA4, 0x00004CA5, 0x00004CA6, 0x00004CA7,
+    0x00004CA8, 0x00004CA9, 0x820004CB, 0x00004CAB, 0x00004CAC, 0x00004CAD, 0x00004CAE, 0x00004CAF,
+    0x000004CB, 0x00004CB1, 0x00004CB2, 0x00004CB3, 0x00004CB4, 0x00004CB5, 0x00004CB6, 0x00004CB7,
+    0x00004CB8, 0x00004CB9, 0x00004CBA, 0x040004CC, 0x00004CBC, 0x00004CBD, 0x00004CBE, 0x00004CBF,
+    0x0800004D, 0x080004D1, 0x080004D2, 0x080004D3, 0x080004D4, 0x080004D5, 0x080004D6, 0x080004D7,
+    0x080004D8, 0x080004D9, 0x080004DA, 0x080004DB, 0x080004CD, 0x080004DD, 0x080004DE, 0x080004DF,
+    0x000004CD, 0x00004CD1, 0x00004CD2, 0x00004CD3, 0x00004CD4, 0x00004CD5, 0x00004CD6, 0x00004CD7,
+    0x00004CD8, 0x00004CD9, 0x00004CDA, 0x00004CDB, 0x00004CDC, 0x100004CE, 0x00004CDE, 0x00004CDF,
+    0x000004CE, 0x00004CE1, 0x00004CE2, 0x00004CE3, 0x00004CE4, 0x00004CE5, 0x00004CE6, 0x00004CE7,
+    0x00004CE8, 0x00004CE9, 0x00004CEA, 0x00004CEB, 0x00004CEC, 0x00004CED, 0x200004CF, 0x00004CEF,
+    0x000004CF, 0x00004CF1, 0x00004CF2, 0x00004CF3, 0x00004CF4, 0x00004CF5, 0x00004CF6, 0x00004CF7,
+    0x00004CF8, 0x00004CF9, 0x00004CFA, 0x00004CFB, 0x00004CFC, 0x00004CFD, 0x00004CFE, 0x00004CFF,
+    0x0000004D, 0x000004D1, 0x000004D2, 0x000004D3, 0x000004D4, 0x000004D5, 0x000004D6, 0x000004D7,
+    0x000004D8, 0x000004D9, 0x000004DA, 0x000004DB, 0x000004DC, 0x1000004E, 0x000004DE, 0x000004DF,
+    0x000004D1, 0x000104D2, 0x00004D12, 0x00004D13, 0x00004D14, 0x00004D15, 0x00004D16, 0x00004D17,
+    0x00004D18, 0x00004D19, 0x00004D1A, 0x00004D1B, 0x00004D1C, 0x00004D1D, 0x00004D1E, 0x00004D1F,
+    0x000004D2, 0x00004D21, 0x000204D3, 0x00004D23, 0x00004D24, 0x00004D25, 0x00004D26, 0x00004D27,
+    0x00004D28, 0x00004D29, 0x00004D2A, 0x00004D2B, 0x00004D2C, 0x00004D2D, 0x00004D2E, 0x00004D2F,
+    0x000004D3, 0x00004D31, 0x00004D32, 0x000404D4, 0x00004D34, 0x00004D35, 0x00004D36, 0x00004D37,
+    0x00004D38, 0x00004D39, 0x00004D3A, 0x00004D3B, 0x00004D3C, 0x00004D3D, 0x00004D3E, 0x00004D3F,
+    0x000004D4, 0x00004D41, 0x00004D42, 0x00004D43, 0x000804D5, 0x00004D45, 0x00004D46, 0x00004D47,
+    0x00004D48, 0x00004D49, 0x00004D4A, 0x00004D4B, 0x00004D4C, 0x00004D4D, 0x00004D4E, 0x00004D4F,
+    0x000004D5, 0x00004D51, 0x00004D52, 0x00004D53, 0x00004D54, 0x001004D6, 0x00004D56, 0x00004D57,
+    0x00004D58, 0x00004D59, 0x00004D5A, 0x00004D5B, 0x00004D5C, 0x00004D5D, 0x00004D5E, 0x00004D5F,
+    0x000004D6, 0x00004D61, 0x00004D62, 0x00004D63, 0x00004D64, 0x00004D65, 0x002004D7, 0x00004D67,
+    0x00004D68, 0x00004D69, 0x00004D6A, 0x00004D6B, 0x00004D6C, 0x00004D6D, 0x00004D6E, 0x00004D6F,
+    0x000004D7, 0x00004D71, 0x00004D72, 0x00004D73, 0x00004D74, 0x00004D75, 0x00004D76, 0x004004D8,
+    0x00004D78, 0x00004D79, 0x00004D7A, 0x00004D7B, 0x00004D7C, 0x00004D7D, 0x00004D7E, 0x00004D7F,
+    0x000004D8, 0x00004D81, 0x00004D82, 0x00004D83, 0x00004D84, 0x00004D85, 0x00004D86, 0x00004D87,
+    0x008004D9, 0x00004D89, 0x00004D8A, 0x00004D8B, 0x00004D8C, 0x00004D8D, 0x00004D8E, 0x00004D8F,
+    0x000004D9, 0x00004D91, 0x00004D92, 0x00004D93, 0x00004D94, 0x00004D95, 0x00004D96, 0x00004D97,
+    0x00004D98, 0x010004DA, 0x00004D9A, 0x00004D9B, 0x00004D9C, 0x00004D9D, 0x00004D9E, 0x00004D9F,
+    0x000004DA, 0x00004DA1, 0x00004DA2, 0x00004DA3, 0x00004DA4, 0x00004DA5, 0x00004DA6, 0x00004DA7,
+    0x00004DA8, 0x00004DA9, 0x820004DB, 0x00004DAB, 0x00004DAC, 0x00004DAD, 0x00004DAE, 0x00004DAF,
+    0x000004DB, 0x00004DB1, 0x00004DB2, 0x00004DB3, 0x00004DB4, 0x00004DB5, 0x00004DB6, 0x00004DB7,
+    0x00004DB8, 0x00004DB9, 0x00004DBA, 0x040004DC, 0x00004DBC, 0x00004DBD, 0x00004DBE, 0x00004DBF,
+    0x000004DC, 0x00004DC1, 0x00004DC2, 0x00004DC3, 0x00004DC4, 0x00004DC5, 0x00004DC6, 0x00004DC7,
+    0x00004DC8, 0x00004DC9, 0x00004DCA, 0x00004DCB, 0x080004DD, 0x00004DCD, 0x00004DCE, 0x00004DCF,
+    0x1000004E, 0x100004E1, 0x100004E2, 0x100004E3, 0x100004E4, 0x100004E5, 0x100004E6, 0x100004E7,
+    0x100004E8, 0x100004E9, 0x100004EA, 0x100004EB, 0x100004EC, 0x100004DE, 0x100004EE, 0x100004EF,
+    0x000004DE, 0x00004DE1, 0x00004DE2, 0x00004DE3, 0x00004DE4, 0x00004DE5, 0x00004DE6, 0x00004DE7,
+    0x00004DE8, 0x00004DE9, 0x00004DEA, 0x00004DEB, 0x00004DEC, 0x00004DED, 0x200004DF, 0x00004DEF,
+    0x000004DF, 0x00004DF1, 0x00004DF2, 0x00004DF3, 0x00004DF4, 0x00004DF5, 0x00004DF6, 0x00004DF7,
+    0x00004DF8, 0x00004DF9, 0x00004DFA, 0x00004DFB, 0x00004DFC, 0x00004DFD, 0x00004DFE, 0x00004DFF,
+    0x0000004E, 0x000004E1, 0x000004E2, 0x000004E3, 0x000004E4, 0x000004E5, 0x000004E6, 0x000004E7,
+    0x000004E8, 0x000004E9, 0x000004EA, 0x000004EB, 0x000004EC, 0x000004ED, 0x2000004F, 0x000004EF,
+    0x000004E1, 0x000104E2, 0x00004E12, 0x00004E13, 0x00004E14, 0x00004E15, 0x00004E16, 0x00004E17,
+    0x00004E18, 0x00004E19, 0x00004E1A, 0x00004E1B, 0x00004E1C, 0x00004E1D, 0x00004E1E, 0x00004E1F,
+    0x000004E2, 0x00004E21, 0x000204E3, 0x00004E23, 0x00004E24, 0x00004E25, 0x00004E26, 0x00004E27,
+    0x00004E28, 0x00004E29, 0x00004E2A, 0x00004E2B, 0x00004E2C, 0x00004E2D, 0x00004E2E, 0x00004E2F,
+    0x000004E3, 0x00004E31, 0x00004E32, 0x000404E4, 0x00004E34, 0x00004E35, 0x00004E36, 0x00004E37,
+    0x00004E38, 0x00004E39, 0x00004E3A, 0x00004E3B, 0x00004E3C, 0x00004E3D, 0x00004E3E, 0x00004E3F,
+    0x000004E4, 0x00004E41, 0x00004E42, 0x00004E43, 0x000804E5, 0x00004E45, 0x00004E46, 0x00004E47,
+    0x00004E48, 0x00004E49, 0x00004E4A, 0x00004E4B, 0x00004E4C, 0x00004E4D, 0x00004E4E, 0x00004E4F,
+    0x000004E5, 0x00004E51, 0x00004E52, 0x00004E53, 0x00004E54, 0x001004E6, 0x00004E56, 0x00004E57,
+    0x00004E58, 0x00004E59, 0x00004E5A, 0x00004E5B, 0x00004E5C, 0x00004E5D, 0x00004E5E, 0x00004E5F,
+    0x000004E6, 0x00004E61, 0x00004E62, 0x00004E63, 0x00004E64, 0x00004E65, 0x002004E7, 0x00004E67,
+    0x00004E68, 0x00004E69, 0x00004E6A, 0x00004E6B, 0x00004E6C, 0x00004E6D, 0x00004E6E, 0x00004E6F,
+    0x000004E7, 0x00004E71, 0x00004E72, 0x00004E73, 0x00004E74, 0x00004E75, 0x00004E76, 0x004004E8,
+    0x00004E78, 0x00004E79, 0x00004E7A, 0x00004E7B, 0x00004E7C, 0x00004E7D, 0x00004E7E, 0x00004E7F,
+    0x000004E8, 0x00004E81, 0x00004E82, 0x00004E83, 0x00004E84, 0x00004E85, 0x00004E86, 0x00004E87,
+    0x008004E9, 0x00004E89, 0x00004E8A, 0x00004E8B, 0x00004E8C, 0x00004E8D, 0x00004E8E, 0x00004E8F,
+    0x000004E9, 0x00004E91, 0x00004E92, 0x00004E93, 0x00004E94, 0x00004E95, 0x00004E96, 0x00004E97,
+    0x00004E98, 0x010004EA, 0x00004E9A, 0x00004E9B, 0x00004E9C, 0x00004E9D, 0x00004E9E, 0x00004E9F,
+    0x000004EA, 0x00004EA1, 0x00004EA2, 0x00004EA3, 0x00004EA4, 0x00004EA5, 0x00004EA6, 0x00004EA7,
+    0x00004EA8, 0x00004EA9, 0x820004EB, 0x00004EAB, 0x00004EAC, 0x00004EAD, 0x00004EAE, 0x00004EAF,
+    0x000004EB, 0x00004EB1, 0x00004EB2, 0x00004EB3, 0x00004EB4, 0x00004EB5, 0x00004EB6, 0x00004EB7,
+    0x00004EB8, 0x00004EB9, 0x00004EBA, 0x040004EC, 0x00004EBC, 0x00004EBD, 0x00004EBE, 0x00004EBF,
+    0x000004EC, 0x00004EC1, 0x00004EC2, 0x00004EC3, 0x00004EC4, 0x00004EC5, 0x00004EC6, 0x00004EC7,
+    0x00004EC8, 0x00004EC9, 0x00004ECA, 0x00004ECB, 0x080004ED, 0x00004ECD, 0x00004ECE, 0x00004ECF,
+    0x000004ED, 0x00004ED1, 0x00004ED2, 0x00004ED3, 0x00004ED4, 0x00004ED5, 0x00004ED6, 0x00004ED7,
+    0x00004ED8, 0x00004ED9, 0x00004EDA, 0x00004EDB, 0x00004EDC, 0x100004EE, 0x00004EDE, 0x00004EDF,
+    0x2000004F, 0x200004F1, 0x200004F2, 0x200004F3, 0x200004F4, 0x200004F5, 0x200004F6, 0x200004F7,
+    0x200004F8, 0x200004F9, 0x200004FA, 0x200004FB, 0x200004FC, 0x200004FD, 0x200004EF, 0x200004FF,
+    0x000004EF, 0x00004EF1, 0x00004EF2, 0x00004EF3, 0x00004EF4, 0x00004EF5, 0x00004EF6, 0x00004EF7,
+    0x00004EF8, 0x00004EF9, 0x00004EFA, 0x00004EFB, 0x00004EFC, 0x00004EFD, 0x00004EFE, 0x00004EFF,
+    0x0000004F, 0x000004F1, 0x000004F2, 0x000004F3, 0x000004F4, 0x000004F5, 0x000004F6, 0x000004F7,
+    0x000004F8, 0x000004F9, 0x000004FA, 0x000004FB, 0x000004FC, 0x000004FD, 0x000004FE, 0x000004FF,
+    0x000004F1, 0x000104F2, 0x00004F12, 0x00004F13, 0x00004F14, 0x00004F15, 0x00004F16, 0x00004F17,
+    0x00004F18, 0x00004F19, 0x00004F1A, 0x00004F1B, 0x00004F1C, 0x00004F1D, 0x00004F1E, 0x00004F1F,
+    0x000004F2, 0x00004F21, 0x000204F3, 0x00004F23, 0x00004F24, 0x00004F25, 0x00004F26, 0x00004F27,
+    0x00004F28, 0x00004F29, 0x00004F2A, 0x00004F2B, 0x00004F2C, 0x00004F2D, 0x00004F2E, 0x00004F2F,
+    0x000004F3, 0x00004F31, 0x00004F32, 0x000404F4, 0x00004F34, 0x00004F35, 0x00004F36, 0x00004F37,
+    0x00004F38, 0x00004F39, 0x00004F3A, 0x00004F3B, 0x00004F3C, 0x00004F3D, 0x00004F3E, 0x00004F3F,
+    0x000004F4, 0x00004F41, 0x00004F42, 0x00004F43, 0x000804F5, 0x00004F45, 0x00004F46, 0x00004F47,
+    0x00004F48, 0x00004F49, 0x00004F4A, 0x00004F4B, 0x00004F4C, 0x00004F4D, 0x00004F4E, 0x00004F4F,
+    0x000004F5, 0x00004F51, 0x00004F52, 0x00004F53, 0x00004F54, 0x001004F6, 0x00004F56, 0x00004F57,
+    0x00004F58, 0x00004F59, 0x00004F5A, 0x00004F5B, 0x00004F5C, 0x00004F5D, 0x00004F5E, 0x00004F5F,
+    0x000004F6, 0x00004F61, 0x00004F62, 0x00004F63, 0x00004F64, 0x00004F65, 0x002004F7, 0x00004F67,
+    0x00004F68, 0x00004F69, 0x00004F6A, 0x00004F6B, 0x00004F6C, 0x00004F6D, 0x00004F6E, 0x00004F6F,
+    0x000004F7, 0x00004F71, 0x00004F72, 0x00004F73, 0x00004F74, 0x00004F75, 0x00004F76, 0x004004F8,
+    0x00004F78, 0x00004F79, 0x00004F7A, 0x00004F7B, 0x00004F7C, 0x00004F7D, 0x00004F7E, 0x00004F7F,
+    0x000004F8, 0x00004F81, 0x00004F82, 0x00004F83, 0x00004F84, 0x00004F85, 0x00004F86, 0x00004F87,
+    0x008004F9, 0x00004F89, 0x00004F8A, 0x00004F8B, 0x00004F8C, 0x00004F8D, 0x00004F8E, 0x00004F8F,
+    0x000004F9, 0x00004F91, 0x00004F92, 0x00004F93, 0x00004F94, 0x00004F95, 0x00004F96, 0x00004F97,
+    0x00004F98, 0x010004FA, 0x00004F9A, 0x00004F9B, 0x00004F9C, 0x00004F9D, 0x00004F9E, 0x00004F9F,
+    0x000004FA, 0x00004FA1, 0x00004FA2, 0x00004FA3, 0x00004FA4, 0x00004FA5, 0x00004FA6, 0x00004FA7,
+    0x00004FA8, 0x00004FA9, 0x820004FB, 0x00004FAB, 0x00004FAC, 0x00004FAD, 0x00004FAE, 0x00004FAF,
+    0x000004FB, 0x00004FB1, 0x00004FB2, 0x00004FB3, 0x00004FB4, 0x00004FB5, 0x00004FB6, 0x00004FB7,
+    0x00004FB8, 0x00004FB9, 0x00004FBA, 0x040004FC, 0x00004FBC, 0x00004FBD, 0x00004FBE, 0x00004FBF,
+    0x000004FC, 0x00004FC1, 0x00004FC2, 0x00004FC3, 0x00004FC4, 0x00004FC5, 0x00004FC6, 0x00004FC7,
+    0x00004FC8, 0x00004FC9, 0x00004FCA, 0x00004FCB, 0x080004FD, 0x00004FCD, 0x00004FCE, 0x00004FCF,
+    0x000004FD, 0x00004FD1, 0x00004FD2, 0x00004FD3, 0x00004FD4, 0x00004FD5, 0x00004FD6, 0x00004FD7,
+    0x00004FD8, 0x00004FD9, 0x00004FDA, 0x00004FDB, 0x00004FDC, 0x100004FE, 0x00004FDE, 0x00004FDF,
+    0x000004FE, 0x00004FE1, 0x00004FE2, 0x00004FE3, 0x00004FE4, 0x00004FE5, 0x00004FE6, 0x00004FE7,
+    0x00004FE8, 0x00004FE9, 0x00004FEA, 0x00004FEB, 0x00004FEC, 0x00004FED, 0x200004FF, 0x00004FEF,
+    0x000004FF, 0x00004FF1, 0x00004FF2, 0x00004FF3, 0x00004FF4, 0x00004FF5, 0x00004FF6, 0x00004FF7,
+    0x00004FF8, 0x00004FF9, 0x00004FFA, 0x00004FFB, 0x00004FFC, 0x00004FFD, 0x00004FFE, 0x00004FFF,
+    0x00000005, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00100006, 0x00000056, 0x00000057,
+    0x00000058, 0x00000059, 0x0000005A, 0x0000005B, 0x0000005C, 0x0000005D, 0x0000005E, 0x0000005F,
+    0x00000051, 0x00010052, 0x00000512, 0x00000513, 0x00000514, 0x00000515, 0x00000516, 0x00000517,
+    0x00000518, 0x00000519, 0x0000051A, 0x0000051B, 0x0000051C, 0x0000051D, 0x0000051E, 0x0000051F,
+    0x00000052, 0x00000521, 0x00020053, 0x00000523, 0x00000524, 0x00000525, 0x00000526, 0x00000527,
+    0x00000528, 0x00000529, 0x0000052A, 0x0000052B, 0x0000052C, 0x0000052D, 0x0000052E, 0x0000052F,
+    0x00000053, 0x00000531, 0x00000532, 0x00040054, 0x00000534, 0x00000535, 0x00000536, 0x00000537,
+    0x00000538, 0x00000539, 0x0000053A, 0x0000053B, 0x0000053C, 0x0000053D, 0x0000053E, 0x0000053F,
+    0x00000054, 0x00000541, 0x00000542, 0x00000543, 0x00080055, 0x00000545, 0x00000546, 0x00000547,
+    0x00000548, 0x00000549, 0x0000054A, 0x0000054B, 0x0000054C, 0x0000054D, 0x0000054E, 0x0000054F,
+    0x00100006, 0x00100061, 0x00100062, 0x00100063, 0x00100064, 0x00100056, 0x00100066, 0x00100067,
+    0x00100068, 0x00100069, 0x0010006A, 0x0010006B, 0x0010006C, 0x0010006D, 0x0010006E, 0x0010006F,
+    0x00000056, 0x00000561, 0x00000562, 0x00000563, 0x00000564, 0x00000565, 0x00200057, 0x00000567,
+    0x00000568, 0x00000569, 0x0000056A, 0x0000056B, 0x0000056C, 0x0000056D, 0x0000056E, 0x0000056F,
+    0x00000057, 0x00000571, 0x00000572, 0x00000573, 0x00000574, 0x00000575, 0x00000576, 0x00400058,
+    0x00000578, 0x00000579, 0x0000057A, 0x0000057B, 0x0000057C, 0x0000057D, 0x0000057E, 0x0000057F,
+    0x00000058, 0x00000581, 0x00000582, 0x00000583, 0x00000584, 0x00000585, 0x00000586, 0x00000587,
+    0x00800059, 0x00000589, 0x0000058A, 0x0000058B, 0x0000058C, 0x0000058D, 0x0000058E, 0x0000058F,
+    0x00000059, 0x00000591, 0x00000592, 0x00000593, 0x00000594, 0x00000595, 0x00000596, 0x00000597,
+    0x00000598, 0x0100005A, 0x0000059A, 0x0000059B, 0x0000059C, 0x0000059D, 0x0000059E, 0x0000059F,
+    0x0000005A, 0x000005A1, 0x000005A2, 0x000005A3, 0x000005A4, 0x000005A5, 0x000005A6, 0x000005A7,
+    0x000005A8, 0x000005A9, 0x8200005B, 0x000005AB, 0x000005AC, 0x000005AD, 0x000005AE, 0x000005AF,
+    0x0000005B, 0x000005B1, 0x000005B2, 0x000005B3, 0x000005B4, 0x000005B5, 0x000005B6, 0x000005B7,
+    0x000005B8, 0x000005B9, 0x000005BA, 0x0400005C, 0x000005BC, 0x000005BD, 0x000005BE, 0x000005BF,
+    0x0000005C, 0x000005C1, 0x000005C2, 0x000005C3, 0x000005C4, 0x000005C5, 0x000005C6, 0x000005C7,
+    0x000005C8, 0x000005C9, 0x000005CA, 0x000005CB, 0x0800005D, 0x000005CD, 0x000005CE, 0x000005CF,
+    0x0000005D, 0x000005D1, 0x000005D2, 0x000005D3, 0x000005D4, 0x000005D5, 0x000005D6, 0x000005D7,
+    0x000005D8, 0x000005D9, 0x000005DA, 0x000005DB, 0x000005DC, 0x1000005E, 0x000005DE, 0x000005DF,
+    0x0000005E, 0x000005E1, 0x000005E2, 0x000005E3, 0x000005E4, 0x000005E5, 0x000005E6, 0x000005E7,
+    0x000005E8, 0x000005E9, 0x000005EA, 0x000005EB, 0x000005EC, 0x000005ED, 0x2000005F, 0x000005EF,
+    0x0000005F, 0x000005F1, 0x000005F2, 0x000005F3, 0x000005F4, 0x000005F5, 0x000005F6, 0x000005F7,
+    0x000005F8, 0x000005F9, 0x000005FA, 0x000005FB, 0x000005FC, 0x000005FD, 0x000005FE, 0x000005FF,
+    0x00000051, 0x00010052, 0x00000512, 0x00000513, 0x00000514, 0x00000515, 0x00000516, 0x00000517,
+    0x00000518, 0x00000519, 0x0000051A, 0x0000051B, 0x0000051C, 0x0000051D, 0x0000051E, 0x0000051F,
+    0x00010052, 0x00010512, 0x00010522, 0x00010523, 0x00010524, 0x00010525, 0x00010526, 0x00010527,
+    0x00010528, 0x00010529, 0x0001052A, 0x0001052B, 0x0001052C, 0x0001052D, 0x0001052E, 0x0001052F,
+    0x00000512, 0x00005121, 0x00020513, 0x00005123, 0x00005124, 0x00005125, 0x00005126, 0x00005127,
+    0x00005128, 0x00005129, 0x0000512A, 0x0000512B, 0x0000512C, 0x0000512D, 0x0000512E, 0x0000512F,
+    0x00000513, 0x00005131, 0x00005132, 0x00040514, 0x00005134, 0x00005135, 0x00005136, 0x00005137,
+    0x00005138, 0x00005139, 0x0000513A, 0x0000513B, 0x0000513C, 0x0000513D, 0x0000513E, 0x0000513F,
+    0x00000514, 0x00005141, 0x00005142, 0x00005143, 0x00080515, 0x00005145, 0x00005146, 0x00005147,
+    0x00005148, 0x00005149, 0x0000514A, 0x0000514B, 0x0000514C, 0x0000514D, 0x0000514E, 0x0000514F,
+    0x00000515, 0x00005151, 0x00005152, 0x00005153, 0x00005154, 0x00100516, 0x00005156, 0x00005157,
+    0x00005158, 0x00005159, 0x0000515A, 0x0000515B, 0x0000515C, 0x0000515D, 0x0000515E, 0x0000515F,
+    0x00000516, 0x00005161, 0x00005162, 0x00005163, 0x00005164, 0x00005165, 0x00200517, 0x00005167,
+    0x00005168, 0x00005169, 0x0000516A, 0x0000516B, 0x0000516C, 0x0000516D, 0x0000516E, 0x0000516F,
+    0x00000517, 0x00005171, 0x00005172, 0x00005173, 0x00005174, 0x00005175, 0x00005176, 0x00400518,
+    0x00005178, 0x00005179, 0x0000517A, 0x0000517B, 0x0000517C, 0x0000517D, 0x0000517E, 0x0000517F,
+    0x00000518, 0x00005181, 0x00005182, 0x00005183, 0x00005184, 0x00005185, 0x00005186, 0x00005187,
+    0x00800519, 0x00005189, 0x0000518A, 0x0000518B, 0x0000518C, 0x0000518D, 0x0000518E, 0x0000518F,
+    0x00000519, 0x00005191, 0x00005192, 0x00005193, 0x00005194, 0x00005195, 0x00005196, 0x00005197,
+    0x00005198, 0x0100051A, 0x0000519A, 0x0000519B, 0x0000519C, 0x0000519D, 0x0000519E, 0x0000519F,
+    0x0000051A, 0x000051A1, 0x000051A2, 0x000051A3, 0x000051A4, 0x000051A5, 0x000051A6, 0x000051A7,
+    0x000051A8, 0x000051A9, 0x8200051B, 0x000051AB, 0x000051AC, 0x000051AD, 0x000051AE, 0x000051AF,
+    0x0000051B, 0x000051B1, 0x000051B2, 0x000051B3, 0x000051B4, 0x000051B5, 0x000051B6, 0x000051B7,
+    0x000051B8, 0x000051B9, 0x000051BA, 0x0400051C, 0x000051BC, 0x000051BD, 0x000051BE, 0x000051BF,
+    0x0000051C, 0x000051C1, 0x000051C2, 0x000051C3, 0x000051C4, 0x000051C5, 0x000051C6, 0x000051C7,
+    0x000051C8, 0x000051C9, 0x000051CA, 0x000051CB, 0x0800051D, 0x000051CD, 0x000051CE, 0x000051CF,
+    0x0000051D, 0x000051D1, 0x000051D2, 0x000051D3, 0x000051D4, 0x000051D5, 0x000051D6, 0x000051D7,
+    0x000051D8, 0x000051D9, 0x000051DA, 0x000051DB, 0x000051DC, 0x1000051E, 0x000051DE, 0x000051DF,
+    0x0000051E, 0x000051E1, 0x000051E2, 0x000051E3, 0x000051E4, 0x000051E5, 0x000051E6, 0x000051E7,
+    0x000051E8, 0x000051E9, 0x000051EA, 0x000051EB, 0x000051EC, 0x000051ED, 0x2000051F, 0x000051EF,
+    0x0000051F, 0x000051F1, 0x000051F2, 0x000051F3, 0x000051F4, 0x000051F5, 0x000051F6, 0x000051F7,
+    0x000051F8, 0x000051F9, 0x000051FA, 0x000051FB, 0x000051FC, 0x000051FD, 0x000051FE, 0x000051FF,
+    0x00000052, 0x00000521, 0x00020053, 0x00000523, 0x00000524, 0x00000525, 0x00000526, 0x00000527,
+    0x00000528, 0x00000529, 0x0000052A, 0x0000052B, 0x0000052C, 0x0000052D, 0x0000052E, 0x0000052F,
+    0x00000521, 0x00010522, 0x00005212, 0x00005213, 0x00005214, 0x00005215, 0x00005216, 0x00005217,
+    0x00005218, 0x00005219, 0x0000521A, 0x0000521B, 0x0000521C, 0x0000521D, 0x0000521E, 0x0000521F,
+    0x00020053, 0x00020531, 0x00020523, 0x00020533, 0x00020534, 0x00020535, 0x00020536, 0x00020537,
+    0x00020538, 0x00020539, 0x0002053A, 0x0002053B, 0x0002053C, 0x0002053D, 0x0002053E, 0x0002053F,
+    0x00000523, 0x00005231, 0x00005232, 0x00040524, 0x00005234, 0x00005235, 0x00005236, 0x00005237,
+    0x00005238, 0x00005239, 0x0000523A, 0x0000523B, 0x0000523C, 0x0000523D, 0x0000523E, 0x0000523F,
+    0x00000524, 0x00005241, 0x00005242, 0x00005243, 0x00080525, 0x00005245, 0x00005246, 0x00005247,
+    0x00005248, 0x00005249, 0x0000524A, 0x0000524B, 0x0000524C, 0x0000524D, 0x0000524E, 0x0000524F,
+    0x00000525, 0x00005251, 0x00005252, 0x00005253, 0x00005254, 0x00100526, 0x00005256, 0x00005257,
+    0x00005258, 0x00005259, 0x0000525A, 0x0000525B, 0x0000525C, 0x0000525D, 0x0000525E, 0x0000525F,
+    0x00000526, 0x00005261, 0x00005262, 0x00005263, 0x00005264, 0x00005265, 0x00200527, 0x00005267,
+    0x00005268, 0x00005269, 0x0000526A, 0x0000526B, 0x0000526C, 0x0000526D, 0x0000526E, 0x0000526F,
+    0x00000527, 0x00005271, 0x00005272, 0x00005273, 0x00005274, 0x00005275, 0x00005276, 0x00400528,
+    0x00005278, 0x00005279, 0x0000527A, 0x0000527B, 0x0000527C, 0x0000527D, 0x0000527E, 0x0000527F,
+    0x00000528, 0x00005281, 0x00005282, 0x00005283, 0x00005284, 0x00005285, 0x00005286, 0x00005287,
+    0x00800529, 0x00005289, 0x0000528A, 0x0000528B, 0x0000528C, 0x0000528D, 0x0000528E, 0x0000528F,
+    0x00000529, 0x00005291, 0x00005292, 0x00005293, 0x00005294, 0x00005295, 0x00005296, 0x00005297,
+    0x00005298, 0x0100052A, 0x0000529A, 0x0000529B, 0x0000529C, 0x0000529D, 0x0000529E, 0x0000529F,
+    0x0000052A, 0x000052A1, 0x000052A2, 0x000052A3, 0x000052A4, 0x000052A5, 0x000052A6, 0x000052A7,
+    0x000052A8, 0x000052A9, 0x8200052B, 0x000052AB, 0x000052AC, 0x000052AD, 0x000052AE, 0x000052AF,
+    0x0000052B, 0x000052B1, 0x000052B2, 0x000052B3, 0x000052B4, 0x000052B5, 0x000052B6, 0x000052B7,
+    0x000052B8, 0x000052B9, 0x000052BA, 0x0400052C, 0x000052BC, 0x000052BD, 0x000052BE, 0x000052BF,
+    0x0000052C, 0x000052C1, 0x000052C2, 0x000052C3, 0x000052C4, 0x000052C5, 0x000052C6, 0x000052C7,
+    0x000052C8, 0x000052C9, 0x000052CA, 0x000052CB, 0x0800052D, 0x000052CD, 0x000052CE, 0x000052CF,
+    0x0000052D, 0x000052D1, 0x000052D2, 0x000052D3, 0x000052D4, 0x000052D5, 0x000052D6, 0x000052D7,
+    0x000052D8, 0x000052D9, 0x000052DA, 0x000052DB, 0x000052DC, 0x1000052E, 0x000052DE, 0x000052DF,
+    0x0000052E, 0x000052E1, 0x000052E2, 0x000052E3, 0x000052E4, 0x000052E5, 0x000052E6, 0x000052E7,
+    0x000052E8, 0x000052E9, 0x000052EA, 0x000052EB, 0x000052EC, 0x000052ED, 0x2000052F, 0x000052EF,
+    0x0000052F, 0x000052F1, 0x000052F2, 0x000052F3, 0x000052F4, 0x000052F5, 0x000052F6, 0x000052F7,
+    0x000052F8, 0x000052F9, 0x000052FA, 0x000052FB, 0x000052FC, 0x000052FD, 0x000052FE, 0x000052FF,
+    0x00000053, 0x00000531, 0x00000532, 0x00040054, 0x00000534, 0x00000535, 0x00000536, 0x00000537,
+    0x00000538, 0x00000539, 0x0000053A, 0x0000053B, 0x0000053C, 0x0000053D, 0x0000053E, 0x0000053F,
+    0x00000531, 0x00010532, 0x00005312, 0x00005313, 0x00005314, 0x00005315, 0x00005316, 0x00005317,
+    0x00005318, 0x00005319, 0x0000531A, 0x0000531B, 0x0000531C, 0x0000531D, 0x0000531E, 0x0000531F,
+    0x00000532, 0x00005321, 0x00020533, 0x00005323, 0x00005324, 0x00005325, 0x00005326, 0x00005327,
+    0x00005328, 0x00005329, 0x0000532A, 0x0000532B, 0x0000532C, 0x0000532D, 0x0000532E, 0x0000532F,
+    0x00040054, 0x00040541, 0x00040542, 0x00040534, 0x00040544, 0x00040545, 0x00040546, 0x00040547,
+    0x00040548, 0x00040549, 0x0004054A, 0x0004054B, 0x0004054C, 0x0004054D, 0x0004054E, 0x0004054F,
+    0x00000534, 0x00005341, 0x00005342, 0x00005343, 0x00080535, 0x00005345, 0x00005346, 0x00005347,
+    0x00005348, 0x00005349, 0x0000534A, 0x0000534B, 0x0000534C, 0x0000534D, 0x0000534E, 0x0000534F,
+    0x00000535, 0x00005351, 0x00005352, 0x00005353, 0x00005354, 0x00100536, 0x00005356, 0x00005357,
+    0x00005358, 0x00005359, 0x0000535A, 0x0000535B, 0x0000535C, 0x0000535D, 0x0000535E, 0x0000535F,
+    0x00000536, 0x00005361, 0x00005362, 0x00005363, 0x00005364, 0x00005365, 0x00200537, 0x00005367,
+    0x00005368, 0x00005369, 0x0000536A, 0x0000536B, 0x0000536C, 0x0000536D, 0x0000536E, 0x0000536F,
+    0x00000537, 0x00005371, 0x00005372, 0x00005373, 0x00005374, 0x00005375, 0x00005376, 0x00400538,
+    0x00005378, 0x00005379, 0x0000537A, 0x0000537B, 0x0000537C, 0x0000537D, 0x0000537E, 0x0000537F,
+    0x00000538, 0x00005381, 0x00005382, 0x00005383, 0x00005384, 0x00005385, 0x00005386, 0x00005387,
+    0x00800539, 0x00005389, 0x0000538A, 0x0000538B, 0x0000538C, 0x0000538D, 0x0000538E, 0x0000538F,
+    0x00000539, 0x00005391, 0x00005392, 0x00005393, 0x00005394, 0x00005395, 0x00005396, 0x00005397,
+    0x00005398, 0x0100053A, 0x0000539A, 0x0000539B, 0x0000539C, 0x0000539D, 0x0000539E, 0x0000539F,
+    0x0000053A, 0x000053A1, 0x000053A2, 0x000053A3, 0x000053A4, 0x000053A5, 0x000053A6, 0x000053A7,
+    0x000053A8, 0x000053A9, 0x8200053B, 0x000053AB, 0x000053AC, 0x000053AD, 0x000053AE, 0x000053AF,
+    0x0000053B, 0x000053B1, 0x000053B2, 0x000053B3, 0x000053B4, 0x000053B5, 0x000053B6, 0x000053B7,
+    0x000053B8, 0x000053B9, 0x000053BA, 0x0400053C, 0x000053BC, 0x000053BD, 0x000053BE, 0x000053BF,
+    0x0000053C, 0x000053C1, 0x000053C2, 0x000053C3, 0x000053C4, 0x000053C5, 0x000053C6, 0x000053C7,
+    0x000053C8, 0x000053C9, 0x000053CA, 0x000053CB, 0x0800053D, 0x000053CD, 0x000053CE, 0x000053CF,
+    0x0000053D, 0x000053D1, 0x000053D2, 0x000053D3, 0x000053D4, 0x000053D5, 0x000053D6, 0x000053D7,
+    0x000053D8, 0x000053D9, 0x000053DA, 0x000053DB, 0x000053DC, 0x1000053E, 0x000053DE, 0x000053DF,
+    0x0000053E, 0x000053E1, 0x000053E2, 0x000053E3, 0x000053E4, 0x000053E5, 0x000053E6, 0x000053E7,
+    0x000053E8, 0x000053E9, 0x000053EA, 0x000053EB, 0x000053EC, 0x000053ED, 0x2000053F, 0x000053EF,
+    0x0000053F, 0x000053F1, 0x000053F2, 0x000053F3, 0x000053F4, 0x000053F5, 0x000053F6, 0x000053F7,
+    0x000053F8, 0x000053F9, 0x000053FA, 0x000053FB, 0x000053FC, 0x000053FD, 0x000053FE, 0x000053FF,
+    0x00000054, 0x00000541, 0x00000542, 0x00000543, 0x00080055, 0x00000545, 0x00000546, 0x00000547,
+    0x00000548, 0x00000549, 0x0000054A, 0x0000054B, 0x0000054C, 0x0000054D, 0x0000054E, 0x0000054F,
+    0x00000541, 0x00010542, 0x00005412, 0x00005413, 0x00005414, 0x00005415, 0x00005416, 0x00005417,
+    0x00005418, 0x00005419, 0x0000541A, 0x0000541B, 0x0000541C, 0x0000541D, 0x0000541E, 0x0000541F,
+    0x00000542, 0x00005421, 0x00020543, 0x00005423, 0x00005424, 0x00005425, 0x00005426, 0x00005427,
+    0x00005428, 0x00005429, 0x0000542A, 0x0000542B, 0x0000542C, 0x0000542D, 0x0000542E, 0x0000542F,
+    0x00000543, 0x00005431, 0x00005432, 0x00040544, 0x00005434, 0x00005435, 0x00005436, 0x00005437,
+    0x00005438, 0x00005439, 0x0000543A, 0x0000543B, 0x0000543C, 0x0000543D, 0x0000543E, 0x0000543F,
+    0x00080055, 0x00080551, 0x00080552, 0x00080553, 0x00080545, 0x00080555, 0x00080556, 0x00080557,
+    0x00080558, 0x00080559, 0x0008055A, 0x0008055B, 0x0008055C, 0x0008055D, 0x0008055E, 0x0008055F,
+    0x00000545, 0x00005451, 0x00005452, 0x00005453, 0x00005454, 0x00100546, 0x00005456, 0x00005457,
+    0x00005458, 0x00005459, 0x0000545A, 0x0000545B, 0x0000545C, 0x0000545D, 0x0000545E, 0x0000545F,
+    0x00000546, 0x00005461, 0x00005462, 0x00005463, 0x00005464, 0x00005465, 0x00200547, 0x00005467,
+    0x00005468, 0x00005469, 0x0000546A, 0x0000546B, 0x0000546C, 0x0000546D, 0x0000546E, 0x0000546F,
+    0x00000547, 0x00005471, 0x00005472, 0x00005473, 0x00005474, 0x00005475, 0x00005476, 0x00400548,
+    0x00005478, 0x00005479, 0x0000547A, 0x0000547B, 0x0000547C, 0x0000547D, 0x0000547E, 0x0000547F,
+    0x00000548, 0x00005481, 0x00005482, 0x00005483, 0x00005484, 0x00005485, 0x00005486, 0x00005487,
+    0x00800549, 0x00005489, 0x0000548A, 0x0000548B, 0x0000548C, 0x0000548D, 0x0000548E, 0x0000548F,
+    0x00000549, 0x00005491, 0x00005492, 0x00005493, 0x00005494, 0x00005495, 0x00005496, 0x00005497,
+    0x00005498, 0x0100054A, 0x0000549A, 0x0000549B, 0x0000549C, 0x0000549D, 0x0000549E, 0x0000549F,
+    0x0000054A, 0x000054A1, 0x000054A2, 0x000054A3, 0x000054A4, 0x000054A5, 0x000054A6, 0x000054A7,
+    0x000054A8, 0x000054A9, 0x8200054B, 0x000054AB, 0x000054AC, 0x000054AD, 0x000054AE, 0x000054AF,
+    0x0000054B, 0x000054B1, 0x000054B2, 0x000054B3, 0x000054B4, 0x000054B5, 0x000054B6, 0x000054B7,
+    0x000054B8, 0x000054B9, 0x000054BA, 0x0400054C, 0x000054BC, 0x000054BD, 0x000054BE, 0x000054BF,
+    0x0000054C, 0x000054C1, 0x000054C2, 0x000054C3, 0x000054C4, 0x000054C5, 0x000054C6, 0x000054C7,
+    0x000054C8, 0x000054C9, 0x000054CA, 0x000054CB, 0x0800054D, 0x000054CD, 0x000054CE, 0x000054CF,
+    0x0000054D, 0x000054D1, 0x000054D2, 0x000054D3, 0x000054D4, 0x000054D5, 0x000054D6, 0x000054D7,
+    0x000054D8, 0x000054D9, 0x000054DA, 0x000054DB, 0x000054DC, 0x1000054E, 0x000054DE, 0x000054DF,
+    0x0000054E, 0x000054E1, 0x000054E2, 0x000054E3, 0x000054E4, 0x000054E5, 0x000054E6, 0x000054E7,
+    0x000054E8, 0x000054E9, 0x000054EA, 0x000054EB, 0x000054EC, 0x000054ED, 0x2000054F, 0x000054EF,
+    0x0000054F, 0x000054F1, 0x000054F2, 0x000054F3, 0x000054F4, 0x000054F5, 0x000054F6, 0x000054F7,
+    0x000054F8, 0x000054F9, 0x000054FA, 0x000054FB, 0x000054FC, 0x000054FD, 0x000054FE, 0x000054FF,
+    0x00100006, 0x00100061, 0x00100062, 0x00100063, 0x00100064, 0x00100056, 0x00100066, 0x00100067,
+    0x00100068, 0x00100069, 0x0010006A, 0x0010006B, 0x0010006C, 0x0010006D, 0x0010006E, 0x0010006F,
+    0x00100061, 0x00110062, 0x00100612, 0x00100613, 0x00100614, 0x00100615, 0x00100616, 0x00100617,
+    0x00100618, 0x00100619, 0x0010061A, 0x0010061B, 0x0010061C, 0x0010061D, 0x0010061E, 0x0010061F,
+    0x00100062, 0x00100621, 0x00120063, 0x00100623, 0x00100624, 0x00100625, 0x00100626, 0x00100627,
+    0x00100628, 0x00100629, 0x0010062A, 0x0010062B, 0x0010062C, 0x0010062D, 0x0010062E, 0x0010062F,
+    0x00100063, 0x00100631, 0x00100632, 0x00140064, 0x00100634, 0x00100635, 0x00100636, 0x00100637,
+    0x00100638, 0x00100639, 0x0010063A, 0x0010063B, 0x0010063C, 0x0010063D, 0x0010063E, 0x0010063F,
+    0x00100064, 0x00100641, 0x00100642, 0x00100643, 0x00180065, 0x00100645, 0x00100646, 0x00100647,
+    0x00100648, 0x00100649, 0x0010064A, 0x0010064B, 0x0010064C, 0x0010064D, 0x0010064E, 0x0010064F,
+    0x00100056, 0x00100561, 0x00100562, 0x00100563, 0x00100564, 0x00200066, 0x00100566, 0x00100567,
+    0x00100568, 0x00100569, 0x0010056A, 0x0010056B, 0x0010056C, 0x0010056D, 0x0010056E, 0x0010056F,
+    0x00100066, 0x00100661, 0x00100662, 0x00100663, 0x00100664, 0x00100665, 0x00300067, 0x00100667,
+    0x00100668, 0x00100669, 0x0010066A, 0x0010066B, 0x0010066C, 0x0010066D, 0x0010066E, 0x0010066F,
+    0x00100067, 0x00100671, 0x00100672, 0x00100673, 0x00100674, 0x00100675, 0x00100676, 0x00500068,
+    0x00100678, 0x00100679, 0x0010067A, 0x0010067B, 0x0010067C, 0x0010067D, 0x0010067E, 0x0010067F,
+    0x00100068, 0x00100681, 0x00100682, 0x00100683, 0x00100684, 0x00100685, 0x00100686, 0x00100687,
+    0x00900069, 0x00100689, 0x0010068A, 0x0010068B, 0x0010068C, 0x0010068D, 0x0010068E, 0x0010068F,
+    0x00100069, 0x00100691, 0x00100692, 0x00100693, 0x00100694, 0x00100695, 0x00100696, 0x00100697,
+    0x00100698, 0x0110006A, 0x0010069A, 0x0010069B, 0x0010069C, 0x0010069D, 0x0010069E, 0x0010069F,
+    0x0010006A, 0x001006A1, 0x001006A2, 0x001006A3, 0x001006A4, 0x001006A5, 0x001006A6, 0x001006A7,
+    0x001006A8, 0x001006A9, 0x8210006B, 0x001006AB, 0x001006AC, 0x001006AD, 0x001006AE, 0x001006AF,
+    0x0010006B, 0x001006B1, 0x001006B2, 0x001006B3, 0x001006B4, 0x001006B5, 0x001006B6, 0x001006B7,
+    0x001006B8, 0x001006B9, 0x001006BA, 0x0410006C, 0x001006BC, 0x001006BD, 0x001006BE, 0x001006BF,
+    0x0010006C, 0x001006C1, 0x001006C2, 0x001006C3, 0x001006C4, 0x001006C5, 0x001006C6, 0x001006C7,
+    0x001006C8, 0x001006C9, 0x001006CA, 0x001006CB, 0x0810006D, 0x001006CD, 0x001006CE, 0x001006CF,
+    0x0010006D, 0x001006D1, 0x001006D2, 0x001006D3, 0x001006D4, 0x001006D5, 0x001006D6, 0x001006D7,
+    0x001006D8, 0x001006D9, 0x001006DA, 0x001006DB, 0x001006DC, 0x1010006E, 0x001006DE, 0x001006DF,
+    0x0010006E, 0x001006E1, 0x001006E2, 0x001006E3, 0x001006E4, 0x001006E5, 0x001006E6, 0x001006E7,
+    0x001006E8, 0x001006E9, 0x001006EA, 0x001006EB, 0x001006EC, 0x001006ED, 0x2010006F, 0x001006EF,
+    0x0010006F, 0x001006F1, 0x001006F2, 0x001006F3, 0x001006F4, 0x001006F5, 0x001006F6, 0x001006F7,
+    0x001006F8, 0x001006F9, 0x001006FA, 0x001006FB, 0x001006FC, 0x001006FD, 0x001006FE, 0x001006FF,
+    0x00000056, 0x00000561, 0x00000562, 0x00000563, 0x00000564, 0x00000565, 0x00200057, 0x00000567,
+    0x00000568, 0x00000569, 0x0000056A, 0x0000056B, 0x0000056C, 0x0000056D, 0x0000056E, 0x0000056F,
+    0x00000561, 0x00010562, 0x00005612, 0x00005613, 0x00005614, 0x00005615, 0x00005616, 0x00005617,
+    0x00005618, 0x00005619, 0x0000561A, 0x0000561B, 0x0000561C, 0x0000561D, 0x0000561E, 0x0000561F,
+    0x00000562, 0x00005621, 0x00020563, 0x00005623, 0x00005624, 0x00005625, 0x00005626, 0x00005627,
+    0x00005628, 0x00005629, 0x0000562A, 0x0000562B, 0x0000562C, 0x0000562D, 0x0000562E, 0x0000562F,
+    0x00000563, 0x00005631, 0x00005632, 0x00040564, 0x00005634, 0x00005635, 0x00005636, 0x00005637,
+    0x00005638, 0x00005639, 0x0000563A, 0x0000563B, 0x0000563C, 0x0000563D, 0x0000563E, 0x0000563F,
+    0x00000564, 0x00005641, 0x00005642, 0x00005643, 0x00080565, 0x00005645, 0x00005646, 0x00005647,
+    0x00005648, 0x00005649, 0x0000564A, 0x0000564B, 0x0000564C, 0x0000564D, 0x0000564E, 0x0000564F,
+    0x00000565, 0x00005651, 0x00005652, 0x00005653, 0x00005654, 0x00100566, 0x00005656, 0x00005657,
+    0x00005658, 0x00005659, 0x0000565A, 0x0000565B, 0x0000565C, 0x0000565D, 0x0000565E, 0x0000565F,
+    0x00200057, 0x00200571, 0x00200572, 0x00200573, 0x00200574, 0x00200575, 0x00200567, 0x00200577,
+    0x00200578, 0x00200579, 0x0020057A, 0x0020057B, 0x0020057C, 0x0020057D, 0x0020057E, 0x0020057F,
+    0x00000567, 0x00005671, 0x00005672, 0x00005673, 0x00005674, 0x00005675, 0x00005676, 0x00400568,
+    0x00005678, 0x00005679, 0x0000567A, 0x0000567B, 0x0000567C, 0x0000567D, 0x0000567E, 0x0000567F,
+    0x00000568, 0x00005681, 0x00005682, 0x00005683, 0x00005684, 0x00005685, 0x00005686, 0x00005687,
+    0x00800569, 0x00005689, 0x0000568A, 0x0000568B, 0x0000568C, 0x0000568D, 0x0000568E, 0x0000568F,
+    0x00000569, 0x00005691, 0x00005692, 0x00005693, 0x00005694, 0x00005695, 0x00005696, 0x00005697,
+    0x00005698, 0x0100056A, 0x0000569A, 0x0000569B, 0x0000569C, 0x0000569D, 0x0000569E, 0x0000569F,
+    0x0000056A, 0x000056A1, 0x000056A2, 0x000056A3, 0x000056A4, 0x000056A5, 0x000056A6, 0x000056A7,
+    0x000056A8, 0x000056A9, 0x8200056B, 0x000056AB, 0x000056AC, 0x000056AD, 0x000056AE, 0x000056AF,
+    0x0000056B, 0x000056B1, 0x000056B2, 0x000056B3, 0x000056B4, 0x000056B5, 0x000056B6, 0x000056B7,
+    0x000056B8, 0x000056B9, 0x000056BA, 0x0400056C, 0x000056BC, 0x000056BD, 0x000056BE, 0x000056BF,
+    0x0000056C, 0x000056C1, 0x000056C2, 0x000056C3, 0x000056C4, 0x000056C5, 0x000056C6, 0x000056C7,
+    0x000056C8, 0x000056C9, 0x000056CA, 0x000056CB, 0x0800056D, 0x000056CD, 0x000056CE, 0x000056CF,
+    0x0000056D, 0x000056D1, 0x000056D2, 0x000056D3, 0x000056D4, 0x000056D5, 0x000056D6, 0x000056D7,
+    0x000056D8, 0x000056D9, 0x000056DA, 0x000056DB, 0x000056DC, 0x1000056E, 0x000056DE, 0x000056DF,
+    0x0000056E, 0x000056E1, 0x000056E2, 0x000056E3, 0x000056E4, 0x000056E5, 0x000056E6, 0x000056E7,
+    0x000056E8, 0x000056E9, 0x000056EA, 0x000056EB, 0x000056EC, 0x000056ED, 0x2000056F, 0x000056EF,
+    0x0000056F, 0x000056F1, 0x000056F2, 0x000056F3, 0x000056F4, 0x000056F5, 0x000056F6, 0x000056F7,
+    0x000056F8, 0x000056F9, 0x000056FA, 0x000056FB, 0x000056FC, 0x000056FD, 0x000056FE, 0x000056FF,
+    0x00000057, 0x00000571, 0x00000572, 0x00000573, 0x00000574, 0x00000575, 0x00000576, 0x00400058,
+    0x00000578, 0x00000579, 0x0000057A, 0x0000057B, 0x0000057C, 0x0000057D, 0x0000057E, 0x0000057F,
+    0x00000571, 0x00010572, 0x00005712, 0x00005713, 0x00005714, 0x00005715, 0x00005716, 0x00005717,
+    0x00005718, 0x00005719, 0x0000571A, 0x0000571B, 0x0000571C, 0x0000571D, 0x0000571E, 0x0000571F,
+    0x00000572, 0x00005721, 0x00020573, 0x00005723, 0x00005724, 0x00005725, 0x00005726, 0x00005727,
+    0x00005728, 0x00005729, 0x0000572A, 0x0000572B, 0x0000572C, 0x0000572D, 0x0000572E, 0x0000572F,
+    0x00000573, 0x00005731, 0x00005732, 0x00040574, 0x00005734, 0x00005735, 0x00005736, 0x00005737,
+    0x00005738, 0x00005739, 0x0000573A, 0x0000573B, 0x0000573C, 0x0000573D, 0x0000573E, 0x0000573F,
+    0x00000574, 0x00005741, 0x00005742, 0x00005743, 0x00080575, 0x00005745, 0x00005746, 0x00005747,
+    0x00005748, 0x00005749, 0x0000574A, 0x0000574B, 0x0000574C, 0x0000574D, 0x0000574E, 0x0000574F,
+    0x00000575, 0x00005751, 0x00005752, 0x00005753, 0x00005754, 0x00100576, 0x00005756, 0x00005757,
+    0x00005758, 0x00005759, 0x0000575A, 0x0000575B, 0x0000575C, 0x0000575D, 0x0000575E, 0x0000575F,
+    0x00000576, 0x00005761, 0x00005762, 0x00005763, 0x00005764, 0x00005765, 0x00200577, 0x00005767,
+    0x00005768, 0x00005769, 0x0000576A, 0x0000576B, 0x0000576C, 0x0000576D, 0x0000576E, 0x0000576F,
+    0x00400058, 0x00400581, 0x00400582, 0x00400583, 0x00400584, 0x00400585, 0x00400586, 0x00400578,
+    0x00400588, 0x00400589, 0x0040058A, 0x0040058B, 0x0040058C, 0x0040058D, 0x0040058E, 0x0040058F,
+    0x00000578, 0x00005781, 0x00005782, 0x00005783, 0x00005784, 0x00005785, 0x00005786, 0x00005787,
+    0x00800579, 0x00005789, 0x0000578A, 0x0000578B, 0x0000578C, 0x0000578D, 0x0000578E, 0x0000578F,
+    0x00000579, 0x00005791, 0x00005792, 0x00005793, 0x00005794, 0x00005795, 0x00005796, 0x00005797,
+    0x00005798, 0x0100057A, 0x0000579A, 0x0000579B, 0x0000579C, 0x0000579D, 0x0000579E, 0x0000579F,
+    0x0000057A, 0x000057A1, 0x000057A2, 0x000057A3, 0x000057A4, 0x000057A5, 0x000057A6, 0x000057A7,
+    0x000057A8, 0x000057A9, 0x8200057B, 0x000057AB, 0x000057AC, 0x000057AD, 0x000057AE, 0x000057AF,
+    0x0000057B, 0x000057B1, 0x000057B2, 0x000057B3, 0x000057B4, 0x000057B5, 0x000057B6, 0x000057B7,
+    0x000057B8, 0x000057B9, 0x000057BA, 0x0400057C, 0x000057BC, 0x000057BD, 0x000057BE, 0x000057BF,
+    0x0000057C, 0x000057C1, 0x000057C2, 0x000057C3, 0x000057C4, 0x000057C5, 0x000057C6, 0x000057C7,
+    0x000057C8, 0x000057C9, 0x000057CA, 0x000057CB, 0x0800057D, 0x000057CD, 0x000057CE, 0x000057CF,
+    0x0000057D, 0x000057D1, 0x000057D2, 0x000057D3, 0x000057D4, 0x000057D5, 0x000057D6, 0x000057D7,
+    0x000057D8, 0x000057D9, 0x000057DA, 0x000057DB, 0x000057DC, 0x1000057E, 0x000057DE, 0x000057DF,
+    0x0000057E, 0x000057E1, 0x000057E2, 0x000057E3, 0x000057E4, 0x000057E5, 0x000057E6, 0x000057E7,
+    0x000057E8, 0x000057E9, 0x000057EA, 0x000057EB, 0x000057EC, 0x000057ED, 0x2000057F, 0x000057EF,
+    0x0000057F, 0x000057F1, 0x000057F2, 0x000057F3, 0x000057F4, 0x000057F5, 0x000057F6, 0x000057F7,
+    0x000057F8, 0x000057F9, 0x000057FA, 0x000057FB, 0x000057FC, 0x000057FD, 0x000057FE, 0x000057FF,
+    0x00000058, 0x00000581, 0x00000582, 0x00000583, 0x00000584, 0x00000585, 0x00000586, 0x00000587,
+    0x00800059, 0x00000589, 0x0000058A, 0x0000058B, 0x0000058C, 0x0000058D, 0x0000058E, 0x0000058F,
+    0x00000581, 0x00010582, 0x00005812, 0x00005813, 0x00005814, 0x00005815, 0x00005816, 0x00005817,
+    0x00005818, 0x00005819, 0x0000581A, 0x0000581B, 0x0000581C, 0x0000581D, 0x0000581E, 0x0000581F,
+    0x00000582, 0x00005821, 0x00020583, 0x00005823, 0x00005824, 0x00005825, 0x00005826, 0x00005827,
+    0x00005828, 0x00005829, 0x0000582A, 0x0000582B, 0x0000582C, 0x0000582D, 0x0000582E, 0x0000582F,
+    0x00000583, 0x00005831, 0x00005832, 0x00040584, 0x00005834, 0x00005835, 0x00005836, 0x00005837,
+    0x00005838, 0x00005839, 0x0000583A, 0x0000583B, 0x0000583C, 0x0000583D, 0x0000583E, 0x0000583F,
+    0x00000584, 0x00005841, 0x00005842, 0x00005843, 0x00080585, 0x00005845, 0x00005846, 0x00005847,
+    0x00005848, 0x00005849, 0x0000584A, 0x0000584B, 0x0000584C, 0x0000584D, 0x0000584E, 0x0000584F,
+    0x00000585, 0x00005851, 0x00005852, 0x00005853, 0x00005854, 0x00100586, 0x00005856, 0x00005857,
+    0x00005858, 0x00005859, 0x0000585A, 0x0000585B, 0x0000585C, 0x0000585D, 0x0000585E, 0x0000585F,
+    0x00000586, 0x00005861, 0x00005862, 0x00005863, 0x00005864, 0x00005865, 0x00200587, 0x00005867,
+    0x00005868, 0x00005869, 0x0000586A, 0x0000586B, 0x0000586C, 0x0000586D, 0x0000586E, 0x0000586F,
+    0x00000587, 0x00005871, 0x00005872, 0x00005873, 0x00005874, 0x00005875, 0x00005876, 0x00400588,
+    0x00005878, 0x00005879, 0x0000587A, 0x0000587B, 0x0000587C, 0x0000587D, 0x0000587E, 0x0000587F,
+    0x00800059, 0x00800591, 0x00800592, 0x00800593, 0x00800594, 0x00800595, 0x00800596, 0x00800597,
+    0x00800589, 0x00800599, 0x0080059A, 0x0080059B, 0x0080059C, 0x0080059D, 0x0080059E, 0x0080059F,
+    0x00000589, 0x00005891, 0x00005892, 0x00005893, 0x00005894, 0x00005895, 0x00005896, 0x00005897,
+    0x00005898, 0x0100058A, 0x0000589A, 0x0000589B, 0x0000589C, 0x0000589D, 0x0000589E, 0x0000589F,
+    0x0000058A, 0x000058A1, 0x000058A2, 0x000058A3, 0x000058A4, 0x000058A5, 0x000058A6, 0x000058A7,
+    0x000058A8, 0x000058A9, 0x8200058B, 0x000058AB, 0x000058AC, 0x000058AD, 0x000058AE, 0x000058AF,
+    0x0000058B, 0x000058B1, 0x000058B2, 0x000058B3, 0x000058B4, 0x000058B5, 0x000058B6, 0x000058B7,
+    0x000058B8, 0x000058B9, 0x000058BA, 0x0400058C, 0x000058BC, 0x000058BD, 0x000058BE, 0x000058BF,
+    0x0000058C, 0x000058C1, 0x000058C2, 0x000058C3, 0x000058C4, 0x000058C5, 0x000058C6, 0x000058C7,
+    0x000058C8, 0x000058C9, 0x000058CA, 0x000058CB, 0x0800058D, 0x000058CD, 0x000058CE, 0x000058CF,
+    0x0000058D, 0x000058D1, 0x000058D2, 0x000058D3, 0x000058D4, 0x000058D5, 0x000058D6, 0x000058D7,
+    0x000058D8, 0x000058D9, 0x000058DA, 0x000058DB, 0x000058DC, 0x1000058E, 0x000058DE, 0x000058DF,
+    0x0000058E, 0x000058E1, 0x000058E2, 0x000058E3, 0x000058E4, 0x000058E5, 0x000058E6, 0x000058E7,
+    0x000058E8, 0x000058E9, 0x000058EA, 0x000058EB, 0x000058EC, 0x000058ED, 0x2000058F, 0x000058EF,
+    0x0000058F, 0x000058F1, 0x000058F2, 0x000058F3, 0x000058F4, 0x000058F5, 0x000058F6, 0x000058F7,
+    0x000058F8, 0x000058F9, 0x000058FA, 0x000058FB, 0x000058FC, 0x000058FD, 0x000058FE, 0x000058FF,
+    0x00000059, 0x00000591, 0x00000592, 0x00000593, 0x00000594, 0x00000595, 0x00000596, 0x00000597,
+    0x00000598, 0x0100005A, 0x0000059A, 0x0000059B, 0x0000059C, 0x0000059D, 0x0000059E, 0x0000059F,
+    0x00000591, 0x00010592, 0x00005912, 0x00005913, 0x00005914, 0x00005915, 0x00005916, 0x00005917,
+    0x00005918, 0x00005919, 0x0000591A, 0x0000591B, 0x0000591C, 0x0000591D, 0x0000591E, 0x0000591F,
+    0x00000592, 0x00005921, 0x00020593, 0x00005923, 0x00005924, 0x00005925, 0x00005926, 0x00005927,
+    0x00005928, 0x00005929, 0x0000592A, 0x0000592B, 0x0000592C, 0x0000592D, 0x0000592E, 0x0000592F,
+    0x00000593, 0x00005931, 0x00005932, 0x00040594, 0x00005934, 0x00005935, 0x00005936, 0x00005937,
+    0x00005938, 0x00005939, 0x0000593A, 0x0000593B, 0x0000593C, 0x0000593D, 0x0000593E, 0x0000593F,
+    0x00000594, 0x00005941, 0x00005942, 0x00005943, 0x00080595, 0x00005945, 0x00005946, 0x00005947,
+    0x00005948, 0x00005949, 0x0000594A, 0x0000594B, 0x0000594C, 0x0000594D, 0x0000594E, 0x0000594F,
+    0x00000595, 0x00005951, 0x00005952, 0x00005953, 0x00005954, 0x00100596, 0x00005956, 0x00005957,
+    0x00005958, 0x00005959, 0x0000595A, 0x0000595B, 0x0000595C, 0x0000595D, 0x0000595E, 0x0000595F,
+    0x00000596, 0x00005961, 0x00005962, 0x00005963, 0x00005964, 0x00005965, 0x00200597, 0x00005967,
+    0x00005968, 0x00005969, 0x0000596A, 0x0000596B, 0x0000596C, 0x0000596D, 0x0000596E, 0x0000596F,
+    0x00000597, 0x00005971, 0x00005972, 0x00005973, 0x00005974, 0x00005975, 0x00005976, 0x00400598,
+    0x00005978, 0x00005979, 0x0000597A, 0x0000597B, 0x0000597C, 0x0000597D, 0x0000597E, 0x0000597F,
+    0x00000598, 0x00005981, 0x00005982, 0x00005983, 0x00005984, 0x00005985, 0x00005986, 0x00005987,
+    0x00800599, 0x00005989, 0x0000598A, 0x0000598B, 0x0000598C, 0x0000598D, 0x0000598E, 0x0000598F,
+    0x0100005A, 0x010005A1, 0x010005A2, 0x010005A3, 0x010005A4, 0x010005A5, 0x010005A6, 0x010005A7,
+    0x010005A8, 0x0100059A, 0x010005AA, 0x010005AB, 0x010005AC, 0x010005AD, 0x010005AE, 0x010005AF,
+    0x0000059A, 0x000059A1, 0x000059A2, 0x000059A3, 0x000059A4, 0x000059A5, 0x000059A6, 0x000059A7,
+    0x000059A8, 0x000059A9, 0x8200059B, 0x000059AB, 0x000059AC, 0x000059AD, 0x000059AE, 0x000059AF,
+    0x0000059B, 0x000059B1, 0x000059B2, 0x000059B3, 0x000059B4, 0x000059B5, 0x000059B6, 0x000059B7,
+    0x000059B8, 0x000059B9, 0x000059BA, 0x0400059C, 0x000059BC, 0x000059BD, 0x000059BE, 0x000059BF,
+    0x0000059C, 0x000059C1, 0x000059C2, 0x000059C3, 0x000059C4, 0x000059C5, 0x000059C6, 0x000059C7,
+    0x000059C8, 0x000059C9, 0x000059CA, 0x000059CB, 0x0800059D, 0x000059CD, 0x000059CE, 0x000059CF,
+    0x0000059D, 0x000059D1, 0x000059D2, 0x000059D3, 0x000059D4, 0x000059D5, 0x000059D6, 0x000059D7,
+    0x000059D8, 0x000059D9, 0x000059DA, 0x000059DB, 0x000059DC, 0x1000059E, 0x000059DE, 0x000059DF,
+    0x0000059E, 0x000059E1, 0x000059E2, 0x000059E3, 0x000059E4, 0x000059E5, 0x000059E6, 0x000059E7,
+    0x000059E8, 0x000059E9, 0x000059EA, 0x000059EB, 0x000059EC, 0x000059ED, 0x2000059F, 0x000059EF,
+    0x0000059F, 0x000059F1, 0x000059F2, 0x000059F3, 0x000059F4, 0x000059F5, 0x000059F6, 0x000059F7,
+    0x000059F8, 0x000059F9, 0x000059FA, 0x000059FB, 0x000059FC, 0x000059FD, 0x000059FE, 0x000059FF,
+    0x0000005A, 0x000005A1, 0x000005A2, 0x000005A3, 0x000005A4, 0x000005A5, 0x000005A6, 0x000005A7,
+    0x000005A8, 0x000005A9, 0x8200005B, 0x000005AB, 0x000005AC, 0x000005AD, 0x000005AE, 0x000005AF,
+    0x000005A1, 0x000105A2, 0x00005A12, 0x00005A13, 0x00005A14, 0x00005A15, 0x00005A16, 0x00005A17,
+    0x00005A18, 0x00005A19, 0x00005A1A, 0x00005A1B, 0x00005A1C, 0x00005A1D, 0x00005A1E, 0x00005A1F,
+    0x000005A2, 0x00005A21, 0x000205A3, 0x00005A23, 0x00005A24, 0x00005A25, 0x00005A26, 0x00005A27,
+    0x00005A28, 0x00005A29, 0x00005A2A, 0x00005A2B, 0x00005A2C, 0x00005A2D, 0x00005A2E, 0x00005A2F,
+    0x000005A3, 0x00005A31, 0x00005A32, 0x000405A4, 0x00005A34, 0x00005A35, 0x00005A36, 0x00005A37,
+    0x00005A38, 0x00005A39, 0x00005A3A, 0x00005A3B, 0x00005A3C, 0x00005A3D, 0x00005A3E, 0x00005A3F,
+    0x000005A4, 0x00005A41, 0x00005A42, 0x00005A43, 0x000805A5, 0x00005A45, 0x00005A46, 0x00005A47,
+    0x00005A48, 0x00005A49, 0x00005A4A, 0x00005A4B, 0x00005A4C, 0x00005A4D, 0x00005A4E, 0x00005A4F,
+    0x000005A5, 0x00005A51, 0x00005A52, 0x00005A53, 0x00005A54, 0x001005A6, 0x00005A56, 0x00005A57,
+    0x00005A58, 0x00005A59, 0x00005A5A, 0x00005A5B, 0x00005A5C, 0x00005A5D, 0x00005A5E, 0x00005A5F,
+    0x000005A6, 0x00005A61, 0x00005A62, 0x00005A63, 0x00005A64, 0x00005A65, 0x002005A7, 0x00005A67,
+    0x00005A68, 0x00005A69, 0x00005A6A, 0x00005A6B, 0x00005A6C, 0x00005A6D, 0x00005A6E, 0x00005A6F,
+    0x000005A7, 0x00005A71, 0x00005A72, 0x00005A73, 0x00005A74, 0x00005A75, 0x00005A76, 0x004005A8,
+    0x00005A78, 0x00005A79, 0x00005A7A, 0x00005A7B, 0x00005A7C, 0x00005A7D, 0x00005A7E, 0x00005A7F,
+    0x000005A8, 0x00005A81, 0x00005A82, 0x00005A83, 0x00005A84, 0x00005A85, 0x00005A86, 0x00005A87,
+    0x008005A9, 0x00005A89, 0x00005A8A, 0x00005A8B, 0x00005A8C, 0x00005A8D, 0x00005A8E, 0x00005A8F,
+    0x000005A9, 0x00005A91, 0x00005A92, 0x00005A93, 0x00005A94, 0x00005A95, 0x00005A96, 0x00005A97,
+    0x00005A98, 0x010005AA, 0x00005A9A, 0x00005A9B, 0x00005A9C, 0x00005A9D, 0x00005A9E, 0x00005A9F,
+    0x8200005B, 0x820005B1, 0x820005B2, 0x820005B3, 0x820005B4, 0x820005B5, 0x820005B6, 0x820005B7,
+    0x820005B8, 0x820005B9, 0x820005AB, 0x820005BB, 0x820005BC, 0x820005BD, 0x820005BE, 0x820005BF,
+    0x000005AB, 0x00005AB1, 0x00005AB2, 0x00005AB3, 0x00005AB4, 0x00005AB5, 0x00005AB6, 0x00005AB7,
+    0x00005AB8, 0x00005AB9, 0x00005ABA, 0x040005AC, 0x00005ABC, 0x00005ABD, 0x00005ABE, 0x00005ABF,
+    0x000005AC, 0x00005AC1, 0x00005AC2, 0x00005AC3, 0x00005AC4, 0x00005AC5, 0x00005AC6, 0x00005AC7,
+    0x00005AC8, 0x00005AC9, 0x00005ACA, 0x00005ACB, 0x080005AD, 0x00005ACD, 0x00005ACE, 0x00005ACF,
+    0x000005AD, 0x00005AD1, 0x00005AD2, 0x00005AD3, 0x00005AD4, 0x00005AD5, 0x00005AD6, 0x00005AD7,
+    0x00005AD8, 0x00005AD9, 0x00005ADA, 0x00005ADB, 0x00005ADC, 0x100005AE, 0x00005ADE, 0x00005ADF,
+    0x000005AE, 0x00005AE1, 0x00005AE2, 0x00005AE3, 0x00005AE4, 0x00005AE5, 0x00005AE6, 0x00005AE7,
+    0x00005AE8, 0x00005AE9, 0x00005AEA, 0x00005AEB, 0x00005AEC, 0x00005AED, 0x200005AF, 0x00005AEF,
+    0x000005AF, 0x00005AF1, 0x00005AF2, 0x00005AF3, 0x00005AF4, 0x00005AF5, 0x00005AF6, 0x00005AF7,
+    0x00005AF8, 0x00005AF9, 0x00005AFA, 0x00005AFB, 0x00005AFC, 0x00005AFD, 0x00005AFE, 0x00005AFF,
+    0x0000005B, 0x000005B1, 0x000005B2, 0x000005B3, 0x000005B4, 0x000005B5, 0x000005B6, 0x000005B7,
+    0x000005B8, 0x000005B9, 0x000005BA, 0x0400005C, 0x000005BC, 0x000005BD, 0x000005BE, 0x000005BF,
+    0x000005B1, 0x000105B2, 0x00005B12, 0x00005B13, 0x00005B14, 0x00005B15, 0x00005B16, 0x00005B17,
+    0x00005B18, 0x00005B19, 0x00005B1A, 0x00005B1B, 0x00005B1C, 0x00005B1D, 0x00005B1E, 0x00005B1F,
+    0x000005B2, 0x00005B21, 0x000205B3, 0x00005B23, 0x00005B24, 0x00005B25, 0x00005B26, 0x00005B27,
+    0x00005B28, 0x00005B29, 0x00005B2A, 0x00005B2B, 0x00005B2C, 0x00005B2D, 0x00005B2E, 0x00005B2F,
+    0x000005B3, 0x00005B31, 0x00005B32, 0x000405B4, 0x00005B34, 0x00005B35, 0x00005B36, 0x00005B37,
+    0x00005B38, 0x00005B39, 0x00005B3A, 0x00005B3B, 0x00005B3C, 0x00005B3D, 0x00005B3E, 0x00005B3F,
+    0x000005B4, 0x00005B41, 0x00005B42, 0x00005B43, 0x000805B5, 0x00005B45, 0x00005B46, 0x00005B47,
+    0x00005B48, 0x00005B49, 0x00005B4A, 0x00005B4B, 0x00005B4C, 0x00005B4D, 0x00005B4E, 0x00005B4F,
+    0x000005B5, 0x00005B51, 0x00005B52, 0x00005B53, 0x00005B54, 0x001005B6, 0x00005B56, 0x00005B57,
+    0x00005B58, 0x00005B59, 0x00005B5A, 0x00005B5B, 0x00005B5C, 0x00005B5D, 0x00005B5E, 0x00005B5F,
+    0x000005B6, 0x00005B61, 0x00005B62, 0x00005B63, 0x00005B64, 0x00005B65, 0x002005B7, 0x00005B67,
+    0x00005B68, 0x00005B69, 0x00005B6A, 0x00005B6B, 0x00005B6C, 0x00005B6D, 0x00005B6E, 0x00005B6F,
+    0x000005B7, 0x00005B71, 0x00005B72, 0x00005B73, 0x00005B74, 0x00005B75, 0x00005B76, 0x004005B8,
+    0x00005B78, 0x00005B79, 0x00005B7A, 0x00005B7B, 0x00005B7C, 0x00005B7D, 0x00005B7E, 0x00005B7F,
+    0x000005B8, 0x00005B81, 0x00005B82, 0x00005B83, 0x00005B84, 0x00005B85, 0x00005B86, 0x00005B87,
+    0x008005B9, 0x00005B89, 0x00005B8A, 0x00005B8B, 0x00005B8C, 0x00005B8D, 0x00005B8E, 0x00005B8F,
+    0x000005B9, 0x00005B91, 0x00005B92, 0x00005B93, 0x00005B94, 0x00005B95, 0x00005B96, 0x00005B97,
+    0x00005B98, 0x010005BA, 0x00005B9A, 0x00005B9B, 0x00005B9C, 0x00005B9D, 0x00005B9E, 0x00005B9F,
+    0x000005BA, 0x00005BA1, 0x00005BA2, 0x00005BA3, 0x00005BA4, 0x00005BA5, 0x00005BA6, 0x00005BA7,
+    0x00005BA8, 0x00005BA9, 0x820005BB, 0x00005BAB, 0x00005BAC, 0x00005BAD, 0x00005BAE, 0x00005BAF,
+    0x0400005C, 0x040005C1, 0x040005C2, 0x040005C3, 0x040005C4, 0x040005C5, 0x040005C6, 0x040005C7,
+    0x040005C8, 0x040005C9, 0x040005CA, 0x040005BC, 0x040005CC, 0x040005CD, 0x040005CE, 0x040005CF,
+    0x000005BC, 0x00005BC1, 0x00005BC2, 0x00005BC3, 0x00005BC4, 0x00005BC5, 0x00005BC6, 0x00005BC7,
+    0x00005BC8, 0x00005BC9, 0x00005BCA, 0x00005BCB, 0x080005BD, 0x00005BCD, 0x00005BCE, 0x00005BCF,
+    0x000005BD, 0x00005BD1, 0x00005BD2, 0x00005BD3, 0x00005BD4, 0x00005BD5, 0x00005BD6, 0x00005BD7,
+    0x00005BD8, 0x00005BD9, 0x00005BDA, 0x00005BDB, 0x00005BDC, 0x100005BE, 0x00005BDE, 0x00005BDF,
+    0x000005BE, 0x00005BE1, 0x00005BE2, 0x00005BE3, 0x00005BE4, 0x00005BE5, 0x00005BE6, 0x00005BE7,
+    0x00005BE8, 0x00005BE9, 0x00005BEA, 0x00005BEB, 0x00005BEC, 0x00005BED, 0x200005BF, 0x00005BEF,
+    0x000005BF, 0x00005BF1, 0x00005BF2, 0x00005BF3, 0x00005BF4, 0x00005BF5, 0x00005BF6, 0x00005BF7,
+    0x00005BF8, 0x00005BF9, 0x00005BFA, 0x00005BFB, 0x00005BFC, 0x00005BFD, 0x00005BFE, 0x00005BFF,
+    0x0000005C, 0x000005C1, 0x000005C2, 0x000005C3, 0x000005C4, 0x000005C5, 0x000005C6, 0x000005C7,
+    0x000005C8, 0x000005C9, 0x000005CA, 0x000005CB, 0x0800005D, 0x000005CD, 0x000005CE, 0x000005CF,
+    0x000005C1, 0x000105C2, 0x00005C12, 0x00005C13, 0x00005C14, 0x00005C15, 0x00005C16, 0x00005C17,
+    0x00005C18, 0x00005C19, 0x00005C1A, 0x00005C1B, 0x00005C1C, 0x00005C1D, 0x00005C1E, 0x00005C1F,
+    0x000005C2, 0x00005C21, 0x000205C3, 0x00005C23, 0x00005C24, 0x00005C25, 0x00005C26, 0x00005C27,
+    0x00005C28, 0x00005C29, 0x00005C2A, 0x00005C2B, 0x00005C2C, 0x00005C2D, 0x00005C2E, 0x00005C2F,
+    0x000005C3, 0x00005C31, 0x00005C32, 0x000405C4, 0x00005C34, 0x00005C35, 0x00005C36, 0x00005C37,
+    0x00005C38, 0x00005C39, 0x00005C3A, 0x00005C3B, 0x00005C3C, 0x00005C3D, 0x00005C3E, 0x00005C3F,
+    0x000005C4, 0x00005C41, 0x00005C42, 0x00005C43, 0x000805C5, 0x00005C45, 0x00005C46, 0x00005C47,
+    0x00005C48, 0x00005C49, 0x00005C4A, 0x00005C4B, 0x00005C4C, 0x00005C4D, 0x00005C4E, 0x00005C4F,
+    0x000005C5, 0x00005C51, 0x00005C52, 0x00005C53, 0x00005C54, 0x001005C6, 0x00005C56, 0x00005C57,
+    0x00005C58, 0x00005C59, 0x00005C5A, 0x00005C5B, 0x00005C5C, 0x00005C5D, 0x00005C5E, 0x00005C5F,
+    0x000005C6, 0x00005C61, 0x00005C62, 0x00005C63, 0x00005C64, 0x00005C65, 0x002005C7, 0x00005C67,
+    0x00005C68, 0x00005C69, 0x00005C6A, 0x00005C6B, 0x00005C6C, 0x00005C6D, 0x00005C6E, 0x00005C6F,
+    0x000005C7, 0x00005C71, 0x00005C72, 0x00005C73, 0x00005C74, 0x00005C75, 0x00005C76, 0x004005C8,
+    0x00005C78, 0x00005C79, 0x00005C7A, 0x00005C7B, 0x00005C7C, 0x00005C7D, 0x00005C7E, 0x00005C7F,
+    0x000005C8, 0x00005C81, 0x00005C82, 0x00005C83, 0x00005C84, 0x00005C85, 0x00005C86, 0x00005C87,
+    0x008005C9, 0x00005C89, 0x00005C8A, 0x00005C8B, 0x00005C8C, 0x00005C8D, 0x00005C8E, 0x00005C8F,
+    0x000005C9, 0x00005C91, 0x00005C92, 0x00005C93, 0x00005C94, 0x00005C95, 0x00005C96, 0x00005C97,
+    0x00005C98, 0x010005CA, 0x00005C9A, 0x00005C9B, 0x00005C9C, 0x00005C9D, 0x00005C9E, 0x00005C9F,
+    0x000005CA, 0x00005CA1, 0x00005CA2, 0x00005CA3, 0x00005CA4, 0x00005CA5, 0x00005CA6, 0x00005CA7,
+    0x00005CA8, 0x00005CA9, 0x820005CB, 0x00005CAB, 0x00005CAC, 0x00005CAD, 0x00005CAE, 0x00005CAF,
+    0x000005CB, 0x00005CB1, 0x00005CB2, 0x00005CB3, 0x00005CB4, 0x00005CB5, 0x00005CB6, 0x00005CB7,
+    0x00005CB8, 0x00005CB9, 0x00005CBA, 0x040005CC, 0x00005CBC, 0x00005CBD, 0x00005CBE, 0x00005CBF,
+    0x0800005D, 0x080005D1, 0x080005D2, 0x080005D3, 0x080005D4, 0x080005D5, 0x080005D6, 0x080005D7,
+    0x080005D8, 0x080005D9, 0x080005DA, 0x080005DB, 0x080005CD, 0x080005DD, 0x080005DE, 0x080005DF,
+    0x000005CD, 0x00005CD1, 0x00005CD2, 0x00005CD3, 0x00005CD4, 0x00005CD5, 0x00005CD6, 0x00005CD7,
+    0x00005CD8, 0x00005CD9, 0x00005CDA, 0x00005CDB, 0x00005CDC, 0x100005CE, 0x00005CDE, 0x00005CDF,
+    0x000005CE, 0x00005CE1, 0x00005CE2, 0x00005CE3, 0x00005CE4, 0x00005CE5, 0x00005CE6, 0x00005CE7,
+    0x00005CE8, 0x00005CE9, 0x00005CEA, 0x00005CEB, 0x00005CEC, 0x00005CED, 0x200005CF, 0x00005CEF,
+    0x000005CF, 0x00005CF1, 0x00005CF2, 0x00005CF3, 0x00005CF4, 0x00005CF5, 0x00005CF6, 0x00005CF7,
+    0x00005CF8, 0x00005CF9, 0x00005CFA, 0x00005CFB, 0x00005CFC, 0x00005CFD, 0x00005CFE, 0x00005CFF,
+    0x0000005D, 0x000005D1, 0x000005D2, 0x000005D3, 0x000005D4, 0x000005D5, 0x000005D6, 0x000005D7,
+    0x000005D8, 0x000005D9, 0x000005DA, 0x000005DB, 0x000005DC, 0x1000005E, 0x000005DE, 0x000005DF,
+    0x000005D1, 0x000105D2, 0x00005D12, 0x00005D13, 0x00005D14, 0x00005D15, 0x00005D16, 0x00005D17,
+    0x00005D18, 0x00005D19, 0x00005D1A, 0x00005D1B, 0x00005D1C, 0x00005D1D, 0x00005D1E, 0x00005D1F,
+    0x000005D2, 0x00005D21, 0x000205D3, 0x00005D23, 0x00005D24, 0x00005D25, 0x00005D26, 0x00005D27,
+    0x00005D28, 0x00005D29, 0x00005D2A, 0x00005D2B, 0x00005D2C, 0x00005D2D, 0x00005D2E, 0x00005D2F,
+    0x000005D3, 0x00005D31, 0x00005D32, 0x000405D4, 0x00005D34, 0x00005D35, 0x00005D36, 0x00005D37,
+    0x00005D38, 0x00005D39, 0x00005D3A, 0x00005D3B, 0x00005D3C, 0x00005D3D, 0x00005D3E, 0x00005D3F,
+    0x000005D4, 0x00005D41, 0x00005D42, 0x00005D43, 0x000805D5, 0x00005D45, 0x00005D46, 0x00005D47,
+    0x00005D48, 0x00005D49, 0x00005D4A, 0x00005D4B, 0x00005D4C, 0x00005D4D, 0x00005D4E, 0x00005D4F,
+    0x000005D5, 0x00005D51, 0x00005D52, 0x00005D53, 0x00005D54, 0x001005D6, 0x00005D56, 0x00005D57,
+    0x00005D58, 0x00005D59, 0x00005D5A, 0x00005D5B, 0x00005D5C, 0x00005D5D, 0x00005D5E, 0x00005D5F,
+    0x000005D6, 0x00005D61, 0x00005D62, 0x00005D63, 0x00005D64, 0x00005D65, 0x002005D7, 0x00005D67,
+    0x00005D68, 0x00005D69, 0x00005D6A, 0x00005D6B, 0x00005D6C, 0x00005D6D, 0x00005D6E, 0x00005D6F,
+    0x000005D7, 0x00005D71, 0x00005D72, 0x00005D73, 0x00005D74, 0x00005D75, 0x00005D76, 0x004005D8,
+    0x00005D78, 0x00005D79, 0x00005D7A, 0x00005D7B, 0x00005D7C, 0x00005D7D, 0x00005D7E, 0x00005D7F,
+    0x000005D8, 0x00005D81, 0x00005D82, 0x00005D83, 0x00005D84, 0x00005D85, 0x00005D86, 0x00005D87,
+    0x008005D9, 0x00005D89, 0x00005D8A, 0x00005D8B, 0x00005D8C, 0x00005D8D, 0x00005D8E, 0x00005D8F,
+    0x000005D9, 0x00005D91, 0x00005D92, 0x00005D93, 0x00005D94, 0x00005D95, 0x00005D96, 0x00005D97,
+    0x00005D98, 0x010005DA, 0x00005D9A, 0x00005D9B, 0x00005D9C, 0x00005D9D, 0x00005D9E, 0x00005D9F,
+    0x000005DA, 0x00005DA1, 0x00005DA2, 0x00005DA3, 0x00005DA4, 0x00005DA5, 0x00005DA6, 0x00005DA7,
+    0x00005DA8, 0x00005DA9, 0x820005DB, 0x00005DAB, 0x00005DAC, 0x00005DAD, 0x00005DAE, 0x00005DAF,
+    0x000005DB, 0x00005DB1, 0x00005DB2, 0x00005DB3, 0x00005DB4, 0x00005DB5, 0x00005DB6, 0x00005DB7,
+    0x00005DB8, 0x00005DB9, 0x00005DBA, 0x040005DC, 0x00005DBC, 0x00005DBD, 0x00005DBE, 0x00005DBF,
+    0x000005DC, 0x00005DC1, 0x00005DC2, 0x00005DC3, 0x00005DC4, 0x00005DC5, 0x00005DC6, 0x00005DC7,
+    0x00005DC8, 0x00005DC9, 0x00005DCA, 0x00005DCB, 0x080005DD, 0x00005DCD, 0x00005DCE, 0x00005DCF,
+    0x1000005E, 0x100005E1, 0x100005E2, 0x100005E3, 0x100005E4, 0x100005E5, 0x100005E6, 0x100005E7,
+    0x100005E8, 0x100005E9, 0x100005EA, 0x100005EB, 0x100005EC, 0x100005DE, 0x100005EE, 0x100005EF,
+    0x000005DE, 0x00005DE1, 0x00005DE2, 0x00005DE3, 0x00005DE4, 0x00005DE5, 0x00005DE6, 0x00005DE7,
+    0x00005DE8, 0x00005DE9, 0x00005DEA, 0x00005DEB, 0x00005DEC, 0x00005DED, 0x200005DF, 0x00005DEF,
+    0x000005DF, 0x00005DF1, 0x00005DF2, 0x00005DF3, 0x00005DF4, 0x00005DF5, 0x00005DF6, 0x00005DF7,
+    0x00005DF8, 0x00005DF9, 0x00005DFA, 0x00005DFB, 0x00005DFC, 0x00005DFD, 0x00005DFE, 0x00005DFF,
+    0x0000005E, 0x000005E1, 0x000005E2, 0x000005E3, 0x000005E4, 0x000005E5, 0x000005E6, 0x000005E7,
+    0x000005E8, 0x000005E9, 0x000005EA, 0x000005EB, 0x000005EC, 0x000005ED, 0x2000005F, 0x000005EF,
+    0x000005E1, 0x000105E2, 0x00005E12, 0x00005E13, 0x00005E14, 0x00005E15, 0x00005E16, 0x00005E17,
+    0x00005E18, 0x00005E19, 0x00005E1A, 0x00005E1B, 0x00005E1C, 0x00005E1D, 0x00005E1E, 0x00005E1F,
+    0x000005E2, 0x00005E21, 0x000205E3, 0x00005E23, 0x00005E24, 0x00005E25, 0x00005E26, 0x00005E27,
+    0x00005E28, 0x00005E29, 0x00005E2A, 0x00005E2B, 0x00005E2C, 0x00005E2D, 0x00005E2E, 0x00005E2F,
+    0x000005E3, 0x00005E31, 0x00005E32, 0x000405E4, 0x00005E34, 0x00005E35, 0x00005E36, 0x00005E37,
+    0x00005E38, 0x00005E39, 0x00005E3A, 0x00005E3B, 0x00005E3C, 0x00005E3D, 0x00005E3E, 0x00005E3F,
+    0x000005E4, 0x00005E41, 0x00005E42, 0x00005E43, 0x000805E5, 0x00005E45, 0x00005E46, 0x00005E47,
+    0x00005E48, 0x00005E49, 0x00005E4A, 0x00005E4B, 0x00005E4C, 0x00005E4D, 0x00005E4E, 0x00005E4F,
+    0x000005E5, 0x00005E51, 0x00005E52, 0x00005E53, 0x00005E54, 0x001005E6, 0x00005E56, 0x00005E57,
+    0x00005E58, 0x00005E59, 0x00005E5A, 0x00005E5B, 0x00005E5C, 0x00005E5D, 0x00005E5E, 0x00005E5F,
+    0x000005E6, 0x00005E61, 0x00005E62, 0x00005E63, 0x00005E64, 0x00005E65, 0x002005E7, 0x00005E67,
+    0x00005E68, 0x00005E69, 0x00005E6A, 0x00005E6B, 0x00005E6C, 0x00005E6D, 0x00005E6E, 0x00005E6F,
+    0x000005E7, 0x00005E71, 0x00005E72, 0x00005E73, 0x00005E74, 0x00005E75, 0x00005E76, 0x004005E8,
+    0x00005E78, 0x00005E79, 0x00005E7A, 0x00005E7B, 0x00005E7C, 0x00005E7D, 0x00005E7E, 0x00005E7F,
+    0x000005E8, 0x00005E81, 0x00005E82, 0x00005E83, 0x00005E84, 0x00005E85, 0x00005E86, 0x00005E87,
+    0x008005E9, 0x00005E89, 0x00005E8A, 0x00005E8B, 0x00005E8C, 0x00005E8D, 0x00005E8E, 0x00005E8F,
+    0x000005E9, 0x00005E91, 0x00005E92, 0x00005E93, 0x00005E94, 0x00005E95, 0x00005E96, 0x00005E97,
+    0x00005E98, 0x010005EA, 0x00005E9A, 0x00005E9B, 0x00005E9C, 0x00005E9D, 0x00005E9E, 0x00005E9F,
+    0x000005EA, 0x00005EA1, 0x00005EA2, 0x00005EA3, 0x00005EA4, 0x00005EA5, 0x00005EA6, 0x00005EA7,
+    0x00005EA8, 0x00005EA9, 0x820005EB, 0x00005EAB, 0x00005EAC, 0x00005EAD, 0x00005EAE, 0x00005EAF,
+    0x000005EB, 0x00005EB1, 0x00005EB2, 0x00005EB3, 0x00005EB4, 0x00005EB5, 0x00005EB6, 0x00005EB7,
+    0x00005EB8, 0x00005EB9, 0x00005EBA, 0x040005EC, 0x00005EBC, 0x00005EBD, 0x00005EBE, 0x00005EBF,
+    0x000005EC, 0x00005EC1, 0x00005EC2, 0x00005EC3, 0x00005EC4, 0x00005EC5, 0x00005EC6, 0x00005EC7,
+    0x00005EC8, 0x00005EC9, 0x00005ECA, 0x00005ECB, 0x080005ED, 0x00005ECD, 0x00005ECE, 0x00005ECF,
+    0x000005ED, 0x00005ED1, 0x00005ED2, 0x00005ED3, 0x00005ED4, 0x00005ED5, 0x00005ED6, 0x00005ED7,
+    0x00005ED8, 0x00005ED9, 0x00005EDA, 0x00005EDB, 0x00005EDC, 0x100005EE, 0x00005EDE, 0x00005EDF,
+    0x2000005F, 0x200005F1, 0x200005F2, 0x200005F3, 0x200005F4, 0x200005F5, 0x200005F6, 0x200005F7,
+    0x200005F8, 0x200005F9, 0x200005FA, 0x200005FB, 0x200005FC, 0x200005FD, 0x200005EF, 0x200005FF,
+    0x000005EF, 0x00005EF1, 0x00005EF2, 0x00005EF3, 0x00005EF4, 0x00005EF5, 0x00005EF6, 0x00005EF7,
+    0x00005EF8, 0x00005EF9, 0x00005EFA, 0x00005EFB, 0x00005EFC, 0x00005EFD, 0x00005EFE, 0x00005EFF,
+    0x0000005F, 0x000005F1, 0x000005F2, 0x000005F3, 0x000005F4, 0x000005F5, 0x000005F6, 0x000005F7,
+    0x000005F8, 0x000005F9, 0x000005FA, 0x000005FB, 0x000005FC, 0x000005FD, 0x000005FE, 0x000005FF,
+    0x000005F1, 0x000105F2, 0x00005F12, 0x00005F13, 0x00005F14, 0x00005F15, 0x00005F16, 0x00005F17,
+    0x00005F18, 0x00005F19, 0x00005F1A, 0x00005F1B, 0x00005F1C, 0x00005F1D, 0x00005F1E, 0x00005F1F,
+    0x000005F2, 0x00005F21, 0x000205F3, 0x00005F23, 0x00005F24, 0x00005F25, 0x00005F26, 0x00005F27,
+    0x00005F28, 0x00005F29, 0x00005F2A, 0x00005F2B, 0x00005F2C, 0x00005F2D, 0x00005F2E, 0x00005F2F,
+    0x000005F3, 0x00005F31, 0x00005F32, 0x000405F4, 0x00005F34, 0x00005F35, 0x00005F36, 0x00005F37,
+    0x00005F38, 0x00005F39, 0x00005F3A, 0x00005F3B, 0x00005F3C, 0x00005F3D, 0x00005F3E, 0x00005F3F,
+    0x000005F4, 0x00005F41, 0x00005F42, 0x00005F43, 0x000805F5, 0x00005F45, 0x00005F46, 0x00005F47,
+    0x00005F48, 0x00005F49, 0x00005F4A, 0x00005F4B, 0x00005F4C, 0x00005F4D, 0x00005F4E, 0x00005F4F,
+    0x000005F5, 0x00005F51, 0x00005F52, 0x00005F53, 0x00005F54, 0x001005F6, 0x00005F56, 0x00005F57,
+    0x00005F58, 0x00005F59, 0x00005F5A, 0x00005F5B, 0x00005F5C, 0x00005F5D, 0x00005F5E, 0x00005F5F,
+    0x000005F6, 0x00005F61, 0x00005F62, 0x00005F63, 0x00005F64, 0x00005F65, 0x002005F7, 0x00005F67,
+    0x00005F68, 0x00005F69, 0x00005F6A, 0x00005F6B, 0x00005F6C, 0x00005F6D, 0x00005F6E, 0x00005F6F,
+    0x000005F7, 0x00005F71, 0x00005F72, 0x00005F73, 0x00005F74, 0x00005F75, 0x00005F76, 0x004005F8,
+    0x00005F78, 0x00005F79, 0x00005F7A, 0x00005F7B, 0x00005F7C, 0x00005F7D, 0x00005F7E, 0x00005F7F,
+    0x000005F8, 0x00005F81, 0x00005F82, 0x00005F83, 0x00005F84, 0x00005F85, 0x00005F86, 0x00005F87,
+    0x008005F9, 0x00005F89, 0x00005F8A, 0x00005F8B, 0x00005F8C, 0x00005F8D, 0x00005F8E, 0x00005F8F,
+    0x000005F9, 0x00005F91, 0x00005F92, 0x00005F93, 0x00005F94, 0x00005F95, 0x00005F96, 0x00005F97,
+    0x00005F98, 0x010005FA, 0x00005F9A, 0x00005F9B, 0x00005F9C, 0x00005F9D, 0x00005F9E, 0x00005F9F,
+    0x000005FA, 0x00005FA1, 0x00005FA2, 0x00005FA3, 0x00005FA4, 0x00005FA5, 0x00005FA6, 0x00005FA7,
+    0x00005FA8, 0x00005FA9, 0x820005FB, 0x00005FAB, 0x00005FAC, 0x00005FAD, 0x00005FAE, 0x00005FAF,
+    0x000005FB, 0x00005FB1, 0x00005FB2, 0x00005FB3, 0x00005FB4, 0x00005FB5, 0x00005FB6, 0x00005FB7,
+    0x00005FB8, 0x00005FB9, 0x00005FBA, 0x040005FC, 0x00005FBC, 0x00005FBD, 0x00005FBE, 0x00005FBF,
+    0x000005FC, 0x00005FC1, 0x00005FC2, 0x00005FC3, 0x00005FC4, 0x00005FC5, 0x00005FC6, 0x00005FC7,
+    0x00005FC8, 0x00005FC9, 0x00005FCA, 0x00005FCB, 0x080005FD, 0x00005FCD, 0x00005FCE, 0x00005FCF,
+    0x000005FD, 0x00005FD1, 0x00005FD2, 0x00005FD3, 0x00005FD4, 0x00005FD5, 0x00005FD6, 0x00005FD7,
+    0x00005FD8, 0x00005FD9, 0x00005FDA, 0x00005FDB, 0x00005FDC, 0x100005FE, 0x00005FDE, 0x00005FDF,
+    0x000005FE, 0x00005FE1, 0x00005FE2, 0x00005FE3, 0x00005FE4, 0x00005FE5, 0x00005FE6, 0x00005FE7,
+    0x00005FE8, 0x00005FE9, 0x00005FEA, 0x00005FEB, 0x00005FEC, 0x00005FED, 0x200005FF, 0x00005FEF,
+    0x000005FF, 0x00005FF1, 0x00005FF2, 0x00005FF3, 0x00005FF4, 0x00005FF5, 0x00005FF6, 0x00005FF7,
+    0x00005FF8, 0x00005FF9, 0x00005FFA, 0x00005FFB, 0x00005FFC, 0x00005FFD, 0x00005FFE, 0x00005FFF,
+    0x00000006, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00200007, 0x00000067,
+    0x00000068, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F,
+    0x00000061, 0x00010062, 0x00000612, 0x00000613, 0x00000614, 0x00000615, 0x00000616, 0x00000617,
+    0x00000618, 0x00000619, 0x0000061A, 0x0000061B, 0x0000061C, 0x0000061D, 0x0000061E, 0x0000061F,
+    0x00000062, 0x00000621, 0x00020063, 0x00000623, 0x00000624, 0x00000625, 0x00000626, 0x00000627,
+    0x00000628, 0x00000629, 0x0000062A, 0x0000062B, 0x0000062C, 0x0000062D, 0x0000062E, 0x0000062F,
+    0x00000063, 0x00000631, 0x00000632, 0x00040064, 0x00000634, 0x00000635, 0x00000636, 0x00000637,
+    0x00000638, 0x00000639, 0x0000063A, 0x0000063B, 0x0000063C, 0x0000063D, 0x0000063E, 0x0000063F,
+    0x00000064, 0x00000641, 0x00000642, 0x00000643, 0x00080065, 0x00000645, 0x00000646, 0x00000647,
+    0x00000648, 0x00000649, 0x0000064A, 0x0000064B, 0x0000064C, 0x0000064D, 0x0000064E, 0x0000064F,
+    0x00000065, 0x00000651, 0x00000652, 0x00000653, 0x00000654, 0x00100066, 0x00000656, 0x00000657,
+    0x00000658, 0x00000659, 0x0000065A, 0x0000065B, 0x0000065C, 0x0000065D, 0x0000065E, 0x0000065F,
+    0x00200007, 0x00200071, 0x00200072, 0x00200073, 0x00200074, 0x00200075, 0x00200067, 0x00200077,
+    0x00200078, 0x00200079, 0x0020007A, 0x0020007B, 0x0020007C, 0x0020007D, 0x0020007E, 0x0020007F,
+    0x00000067, 0x00000671, 0x00000672, 0x00000673, 0x00000674, 0x00000675, 0x00000676, 0x00400068,
+    0x00000678, 0x00000679, 0x0000067A, 0x0000067B, 0x0000067C, 0x0000067D, 0x0000067E, 0x0000067F,
+    0x00000068, 0x00000681, 0x00000682, 0x00000683, 0x00000684, 0x00000685, 0x00000686, 0x00000687,
+    0x00800069, 0x00000689, 0x0000068A, 0x0000068B, 0x0000068C, 0x0000068D, 0x0000068E, 0x0000068F,
+    0x00000069, 0x00000691, 0x00000692, 0x00000693, 0x00000694, 0x00000695, 0x00000696, 0x00000697,
+    0x00000698, 0x0100006A, 0x0000069A, 0x0000069B, 0x0000069C, 0x0000069D, 0x0000069E, 0x0000069F,
+    0x0000006A, 0x000006A1, 0x000006A2, 0x000006A3, 0x000006A4, 0x000006A5, 0x000006A6, 0x000006A7,
+    0x000006A8, 0x000006A9, 0x8200006B, 0x000006AB, 0x000006AC, 0x000006AD, 0x000006AE, 0x000006AF,
+    0x0000006B, 0x000006B1, 0x000006B2, 0x000006B3, 0x000006B4, 0x000006B5, 0x000006B6, 0x000006B7,
+    0x000006B8, 0x000006B9, 0x000006BA, 0x0400006C, 0x000006BC, 0x000006BD, 0x000006BE, 0x000006BF,
+    0x0000006C, 0x000006C1, 0x000006C2, 0x000006C3, 0x000006C4, 0x000006C5, 0x000006C6, 0x000006C7,
+    0x000006C8, 0x000006C9, 0x000006CA, 0x000006CB, 0x0800006D, 0x000006CD, 0x000006CE, 0x000006CF,
+    0x0000006D, 0x000006D1, 0x000006D2, 0x000006D3, 0x000006D4, 0x000006D5, 0x000006D6, 0x000006D7,
+    0x000006D8, 0x000006D9, 0x000006DA, 0x000006DB, 0x000006DC, 0x1000006E, 0x000006DE, 0x000006DF,
+    0x0000006E, 0x000006E1, 0x000006E2, 0x000006E3, 0x000006E4, 0x000006E5, 0x000006E6, 0x000006E7,
+    0x000006E8, 0x000006E9, 0x000006EA, 0x000006EB, 0x000006EC, 0x000006ED, 0x2000006F, 0x000006EF,
+    0x0000006F, 0x000006F1, 0x000006F2, 0x000006F3, 0x000006F4, 0x000006F5, 0x000006F6, 0x000006F7,
+    0x000006F8, 0x000006F9, 0x000006FA, 0x000006FB, 0x000006FC, 0x000006FD, 0x000006FE, 0x000006FF,
+    0x00000061, 0x00010062, 0x00000612, 0x00000613, 0x00000614, 0x00000615, 0x00000616, 0x00000617,
+    0x00000618, 0x00000619, 0x0000061A, 0x0000061B, 0x0000061C, 0x0000061D, 0x0000061E, 0x0000061F,
+    0x00010062, 0x00010612, 0x00010622, 0x00010623, 0x00010624, 0x00010625, 0x00010626, 0x00010627,
+    0x00010628, 0x00010629, 0x0001062A, 0x0001062B, 0x0001062C, 0x0001062D, 0x0001062E, 0x0001062F,
+    0x00000612, 0x00006121, 0x00020613, 0x00006123, 0x00006124, 0x00006125, 0x00006126, 0x00006127,
+    0x00006128, 0x00006129, 0x0000612A, 0x0000612B, 0x0000612C, 0x0000612D, 0x0000612E, 0x0000612F,
+    0x00000613, 0x00006131, 0x00006132, 0x00040614, 0x00006134, 0x00006135, 0x00006136, 0x00006137,
+    0x00006138, 0x00006139, 0x0000613A, 0x0000613B, 0x0000613C, 0x0000613D, 0x0000613E, 0x0000613F,
+    0x00000614, 0x00006141, 0x00006142, 0x00006143, 0x00080615, 0x00006145, 0x00006146, 0x00006147,
+    0x00006148, 0x00006149, 0x0000614A, 0x0000614B, 0x0000614C, 0x0000614D, 0x0000614E, 0x0000614F,
+    0x00000615, 0x00006151, 0x00006152, 0x00006153, 0x00006154, 0x00100616, 0x00006156, 0x00006157,
+    0x00006158, 0x00006159, 0x0000615A, 0x0000615B, 0x0000615C, 0x0000615D, 0x0000615E, 0x0000615F,
+    0x00000616, 0x00006161, 0x00006162, 0x00006163, 0x00006164, 0x00006165, 0x00200617, 0x00006167,
+    0x00006168, 0x00006169, 0x0000616A, 0x0000616B, 0x0000616C, 0x0000616D, 0x0000616E, 0x0000616F,
+    0x00000617, 0x00006171, 0x00006172, 0x00006173, 0x00006174, 0x00006175, 0x00006176, 0x00400618,
+    0x00006178, 0x00006179, 0x0000617A, 0x0000617B, 0x0000617C, 0x0000617D, 0x0000617E, 0x0000617F,
+    0x00000618, 0x00006181, 0x00006182, 0x00006183, 0x00006184, 0x00006185, 0x00006186, 0x00006187,
+    0x00800619, 0x00006189, 0x0000618A, 0x0000618B, 0x0000618C, 0x0000618D, 0x0000618E, 0x0000618F,
+    0x00000619, 0x00006191, 0x00006192, 0x00006193, 0x00006194, 0x00006195, 0x00006196, 0x00006197,
+    0x00006198, 0x0100061A, 0x0000619A, 0x0000619B, 0x0000619C, 0x0000619D, 0x0000619E, 0x0000619F,
+    0x0000061A, 0x000061A1, 0x000061A2, 0x000061A3, 0x000061A4, 0x000061A5, 0x000061A6, 0x000061A7,
+    0x000061A8, 0x000061A9, 0x8200061B, 0x000061AB, 0x000061AC, 0x000061AD, 0x000061AE, 0x000061AF,
+    0x0000061B, 0x000061B1, 0x000061B2, 0x000061B3, 0x000061B4, 0x000061B5, 0x000061B6, 0x000061B7,
+    0x000061B8, 0x000061B9, 0x000061BA, 0x0400061C, 0x000061BC, 0x000061BD, 0x000061BE, 0x000061BF,
+    0x0000061C, 0x000061C1, 0x000061C2, 0x000061C3, 0x000061C4, 0x000061C5, 0x000061C6, 0x000061C7,
+    0x000061C8, 0x000061C9, 0x000061CA, 0x000061CB, 0x0800061D, 0x000061CD, 0x000061CE, 0x000061CF,
+    0x0000061D, 0x000061D1, 0x000061D2, 0x000061D3, 0x000061D4, 0x000061D5, 0x000061D6, 0x000061D7,
+    0x000061D8, 0x000061D9, 0x000061DA, 0x000061DB, 0x000061DC, 0x1000061E, 0x000061DE, 0x000061DF,
+    0x0000061E, 0x000061E1, 0x000061E2, 0x000061E3, 0x000061E4, 0x000061E5, 0x000061E6, 0x000061E7,
+    0x000061E8, 0x000061E9, 0x000061EA, 0x000061EB, 0x000061EC, 0x000061ED, 0x2000061F, 0x000061EF,
+    0x0000061F, 0x000061F1, 0x000061F2, 0x000061F3, 0x000061F4, 0x000061F5, 0x000061F6, 0x000061F7,
+    0x000061F8, 0x000061F9, 0x000061FA, 0x000061FB, 0x000061FC, 0x000061FD, 0x000061FE, 0x000061FF,
+    0x00000062, 0x00000621, 0x00020063, 0x00000623, 0x00000624, 0x00000625, 0x00000626, 0x00000627,
+    0x00000628, 0x00000629, 0x0000062A, 0x0000062B, 0x0000062C, 0x0000062D, 0x0000062E, 0x0000062F,
+    0x00000621, 0x00010622, 0x00006212, 0x00006213, 0x00006214, 0x00006215, 0x00006216, 0x00006217,
+    0x00006218, 0x00006219, 0x0000621A, 0x0000621B, 0x0000621C, 0x0000621D, 0x0000621E, 0x0000621F,
+    0x00020063, 0x00020631, 0x00020623, 0x00020633, 0x00020634, 0x00020635, 0x00020636, 0x00020637,
+    0x00020638, 0x00020639, 0x0002063A, 0x0002063B, 0x0002063C, 0x0002063D, 0x0002063E, 0x0002063F,
+    0x00000623, 0x00006231, 0x00006232, 0x00040624, 0x00006234, 0x00006235, 0x00006236, 0x00006237,
+    0x00006238, 0x00006239, 0x0000623A, 0x0000623B, 0x0000623C, 0x0000623D, 0x0000623E, 0x0000623F,
+    0x00000624, 0x00006241, 0x00006242, 0x00006243, 0x00080625, 0x00006245, 0x00006246, 0x00006247,
+    0x00006248, 0x00006249, 0x0000624A, 0x0000624B, 0x0000624C, 0x0000624D, 0x0000624E, 0x0000624F,
+    0x00000625, 0x00006251, 0x00006252, 0x00006253, 0x00006254, 0x00100626, 0x00006256, 0x00006257,
+    0x00006258, 0x00006259, 0x0000625A, 0x0000625B, 0x0000625C, 0x0000625D, 0x0000625E, 0x0000625F,
+    0x00000626, 0x00006261, 0x00006262, 0x00006263, 0x00006264, 0x00006265, 0x00200627, 0x00006267,
+    0x00006268, 0x00006269, 0x0000626A, 0x0000626B, 0x0000626C, 0x0000626D, 0x0000626E, 0x0000626F,
+    0x00000627, 0x00006271, 0x00006272, 0x00006273, 0x00006274, 0x00006275, 0x00006276, 0x00400628,
+    0x00006278, 0x00006279, 0x0000627A, 0x0000627B, 0x0000627C, 0x0000627D, 0x0000627E, 0x0000627F,
+    0x00000628, 0x00006281, 0x00006282, 0x00006283, 0x00006284, 0x00006285, 0x00006286, 0x00006287,
+    0x00800629, 0x00006289, 0x0000628A, 0x0000628B, 0x0000628C, 0x0000628D, 0x0000628E, 0x0000628F,
+    0x00000629, 0x00006291, 0x00006292, 0x00006293, 0x00006294, 0x00006295, 0x00006296, 0x00006297,
+    0x00006298, 0x0100062A, 0x0000629A, 0x0000629B, 0x0000629C, 0x0000629D, 0x0000629E, 0x0000629F,
+    0x0000062A, 0x000062A1, 0x000062A2, 0x000062A3, 0x000062A4, 0x000062A5, 0x000062A6, 0x000062A7,
+    0x000062A8, 0x000062A9, 0x8200062B, 0x000062AB, 0x000062AC, 0x000062AD, 0x000062AE, 0x000062AF,
+    0x0000062B, 0x000062B1, 0x000062B2, 0x000062B3, 0x000062B4, 0x000062B5, 0x000062B6, 0x000062B7,
+    0x000062B8, 0x000062B9, 0x000062BA, 0x0400062C, 0x000062BC, 0x000062BD, 0x000062BE, 0x000062BF,
+    0x0000062C, 0x000062C1, 0x000062C2, 0x000062C3, 0x000062C4, 0x000062C5, 0x000062C6, 0x000062C7,
+    0x000062C8, 0x000062C9, 0x000062CA, 0x000062CB, 0x0800062D, 0x000062CD, 0x000062CE, 0x000062CF,
+    0x0000062D, 0x000062D1, 0x000062D2, 0x000062D3, 0x000062D4, 0x000062D5, 0x000062D6, 0x000062D7,
+    0x000062D8, 0x000062D9, 0x000062DA, 0x000062DB, 0x000062DC, 0x1000062E, 0x000062DE, 0x000062DF,
+    0x0000062E, 0x000062E1, 0x000062E2, 0x000062E3, 0x000062E4, 0x000062E5, 0x000062E6, 0x000062E7,
+    0x000062E8, 0x000062E9, 0x000062EA, 0x000062EB, 0x000062EC, 0x000062ED, 0x2000062F, 0x000062EF,
+    0x0000062F, 0x000062F1, 0x000062F2, 0x000062F3, 0x000062F4, 0x000062F5, 0x000062F6, 0x000062F7,
+    0x000062F8, 0x000062F9, 0x000062FA, 0x000062FB, 0x000062FC, 0x000062FD, 0x000062FE, 0x000062FF,
+    0x00000063, 0x00000631, 0x00000632, 0x00040064, 0x00000634, 0x00000635, 0x00000636, 0x00000637,
+    0x00000638, 0x00000639, 0x0000063A, 0x0000063B, 0x0000063C, 0x0000063D, 0x0000063E, 0x0000063F,
+    0x00000631, 0x00010632, 0x00006312, 0x00006313, 0x00006314, 0x00006315, 0x00006316, 0x00006317,
+    0x00006318, 0x00006319, 0x0000631A, 0x0000631B, 0x0000631C, 0x0000631D, 0x0000631E, 0x0000631F,
+    0x00000632, 0x00006321, 0x00020633, 0x00006323, 0x00006324, 0x00006325, 0x00006326, 0x00006327,
+    0x00006328, 0x00006329, 0x0000632A, 0x0000632B, 0x0000632C, 0x0000632D, 0x0000632E, 0x0000632F,
+    0x00040064, 0x00040641, 0x00040642, 0x00040634, 0x00040644, 0x00040645, 0x00040646, 0x00040647,
+    0x00040648, 0x00040649, 0x0004064A, 0x0004064B, 0x0004064C, 0x0004064D, 0x0004064E, 0x0004064F,
+    0x00000634, 0x00006341, 0x00006342, 0x00006343, 0x00080635, 0x00006345, 0x00006346, 0x00006347,
+    0x00006348, 0x00006349, 0x0000634A, 0x0000634B, 0x0000634C, 0x0000634D, 0x0000634E, 0x0000634F,
+    0x00000635, 0x00006351, 0x00006352, 0x00006353, 0x00006354, 0x00100636, 0x00006356, 0x00006357,
+    0x00006358, 0x00006359, 0x0000635A, 0x0000635B, 0x0000635C, 0x0000635D, 0x0000635E, 0x0000635F,
+    0x00000636, 0x00006361, 0x00006362, 0x00006363, 0x00006364, 0x00006365, 0x00200637, 0x00006367,
+    0x00006368, 0x00006369, 0x0000636A, 0x0000636B, 0x0000636C, 0x0000636D, 0x0000636E, 0x0000636F,
+    0x00000637, 0x00006371, 0x00006372, 0x00006373, 0x00006374, 0x00006375, 0x00006376, 0x00400638,
+    0x00006378, 0x00006379, 0x0000637A, 0x0000637B, 0x0000637C, 0x0000637D, 0x0000637E, 0x0000637F,
+    0x00000638, 0x00006381, 0x00006382, 0x00006383, 0x00006384, 0x00006385, 0x00006386, 0x00006387,
+    0x00800639, 0x00006389, 0x0000638A, 0x0000638B, 0x0000638C, 0x0000638D, 0x0000638E, 0x0000638F,
+    0x00000639, 0x00006391, 0x00006392, 0x00006393, 0x00006394, 0x00006395, 0x00006396, 0x00006397,
+    0x00006398, 0x0100063A, 0x0000639A, 0x0000639B, 0x0000639C, 0x0000639D, 0x0000639E, 0x0000639F,
+    0x0000063A, 0x000063A1, 0x000063A2, 0x000063A3, 0x000063A4, 0x000063A5, 0x000063A6, 0x000063A7,
+    0x000063A8, 0x000063A9, 0x8200063B, 0x000063AB, 0x000063AC, 0x000063AD, 0x000063AE, 0x000063AF,
+    0x0000063B, 0x000063B1, 0x000063B2, 0x000063B3, 0x000063B4, 0x000063B5, 0x000063B6, 0x000063B7,
+    0x000063B8, 0x000063B9, 0x000063BA, 0x0400063C, 0x000063BC, 0x000063BD, 0x000063BE, 0x000063BF,
+    0x0000063C, 0x000063C1, 0x000063C2, 0x000063C3, 0x000063C4, 0x000063C5, 0x000063C6, 0x000063C7,
+    0x000063C8, 0x000063C9, 0x000063CA, 0x000063CB, 0x0800063D, 0x000063CD, 0x000063CE, 0x000063CF,
+    0x0000063D, 0x000063D1, 0x000063D2, 0x000063D3, 0x000063D4, 0x000063D5, 0x000063D6, 0x000063D7,
+    0x000063D8, 0x000063D9, 0x000063DA, 0x000063DB, 0x000063DC, 0x1000063E, 0x000063DE, 0x000063DF,
+    0x0000063E, 0x000063E1, 0x000063E2, 0x000063E3, 0x000063E4, 0x000063E5, 0x000063E6, 0x000063E7,
+    0x000063E8, 0x000063E9, 0x000063EA, 0x000063EB, 0x000063EC, 0x000063ED, 0x2000063F, 0x000063EF,
+    0x0000063F, 0x000063F1, 0x000063F2, 0x000063F3, 0x000063F4, 0x000063F5, 0x000063F6, 0x000063F7,
+    0x000063F8, 0x000063F9, 0x000063FA, 0x000063FB, 0x000063FC, 0x000063FD, 0x000063FE, 0x000063FF,
+    0x00000064, 0x00000641, 0x00000642, 0x00000643, 0x00080065, 0x00000645, 0x00000646, 0x00000647,
+    0x00000648, 0x00000649, 0x0000064A, 0x0000064B, 0x0000064C, 0x0000064D, 0x0000064E, 0x0000064F,
+    0x00000641, 0x00010642, 0x00006412, 0x00006413, 0x00006414, 0x00006415, 0x00006416, 0x00006417,
+    0x00006418, 0x00006419, 0x0000641A, 0x0000641B, 0x0000641C, 0x0000641D, 0x0000641E, 0x0000641F,
+    0x00000642, 0x00006421, 0x00020643, 0x00006423, 0x00006424, 0x00006425, 0x00006426, 0x00006427,
+    0x00006428, 0x00006429, 0x0000642A, 0x0000642B, 0x0000642C, 0x0000642D, 0x0000642E, 0x0000642F,
+    0x00000643, 0x00006431, 0x00006432, 0x00040644, 0x00006434, 0x00006435, 0x00006436, 0x00006437,
+    0x00006438, 0x00006439, 0x0000643A, 0x0000643B, 0x0000643C, 0x0000643D, 0x0000643E, 0x0000643F,
+    0x00080065, 0x00080651, 0x00080652, 0x00080653, 0x00080645, 0x00080655, 0x00080656, 0x00080657,
+    0x00080658, 0x00080659, 0x0008065A, 0x0008065B, 0x0008065C, 0x0008065D, 0x0008065E, 0x0008065F,
+    0x00000645, 0x00006451, 0x00006452, 0x00006453, 0x00006454, 0x00100646, 0x00006456, 0x00006457,
+    0x00006458, 0x00006459, 0x0000645A, 0x0000645B, 0x0000645C, 0x0000645D, 0x0000645E, 0x0000645F,
+    0x00000646, 0x00006461, 0x00006462, 0x00006463, 0x00006464, 0x00006465, 0x00200647, 0x00006467,
+    0x00006468, 0x00006469, 0x0000646A, 0x0000646B, 0x0000646C, 0x0000646D, 0x0000646E, 0x0000646F,
+    0x00000647, 0x00006471, 0x00006472, 0x00006473, 0x00006474, 0x00006475, 0x00006476, 0x00400648,
+    0x00006478, 0x00006479, 0x0000647A, 0x0000647B, 0x0000647C, 0x0000647D, 0x0000647E, 0x0000647F,
+    0x00000648, 0x00006481, 0x00006482, 0x00006483, 0x00006484, 0x00006485, 0x00006486, 0x00006487,
+    0x00800649, 0x00006489, 0x0000648A, 0x0000648B, 0x0000648C, 0x0000648D, 0x0000648E, 0x0000648F,
+    0x00000649, 0x00006491, 0x00006492, 0x00006493, 0x00006494, 0x00006495, 0x00006496, 0x00006497,
+    0x00006498, 0x0100064A, 0x0000649A, 0x0000649B, 0x0000649C, 0x0000649D, 0x0000649E, 0x0000649F,
+    0x0000064A, 0x000064A1, 0x000064A2, 0x000064A3, 0x000064A4, 0x000064A5, 0x000064A6, 0x000064A7,
+    0x000064A8, 0x000064A9, 0x8200064B, 0x000064AB, 0x000064AC, 0x000064AD, 0x000064AE, 0x000064AF,
+    0x0000064B, 0x000064B1, 0x000064B2, 0x000064B3, 0x000064B4, 0x000064B5, 0x000064B6, 0x000064B7,
+    0x000064B8, 0x000064B9, 0x000064BA, 0x0400064C, 0x000064BC, 0x000064BD, 0x000064BE, 0x000064BF,
+    0x0000064C, 0x000064C1, 0x000064C2, 0x000064C3, 0x000064C4, 0x000064C5, 0x000064C6, 0x000064C7,
+    0x000064C8, 0x000064C9, 0x000064CA, 0x000064CB, 0x0800064D, 0x000064CD, 0x000064CE, 0x000064CF,
+    0x0000064D, 0x000064D1, 0x000064D2, 0x000064D3, 0x000064D4, 0x000064D5, 0x000064D6, 0x000064D7,
+    0x000064D8, 0x000064D9, 0x000064DA, 0x000064DB, 0x000064DC, 0x1000064E, 0x000064DE, 0x000064DF,
+    0x0000064E, 0x000064E1, 0x000064E2, 0x000064E3, 0x000064E4, 0x000064E5, 0x000064E6, 0x000064E7,
+    0x000064E8, 0x000064E9, 0x000064EA, 0x000064EB, 0x000064EC, 0x000064ED, 0x2000064F, 0x000064EF,
+    0x0000064F, 0x000064F1, 0x000064F2, 0x000064F3, 0x000064F4, 0x000064F5, 0x000064F6, 0x000064F7,
+    0x000064F8, 0x000064F9, 0x000064FA, 0x000064FB, 0x000064FC, 0x000064FD, 0x000064FE, 0x000064FF,
+    0x00000065, 0x00000651, 0x00000652, 0x00000653, 0x00000654, 0x00100066, 0x00000656, 0x00000657,
+    0x00000658, 0x00000659, 0x0000065A, 0x0000065B, 0x0000065C, 0x0000065D, 0x0000065E, 0x0000065F,
+    0x00000651, 0x00010652, 0x00006512, 0x00006513, 0x00006514, 0x00006515, 0x00006516, 0x00006517,
+    0x00006518, 0x00006519, 0x0000651A, 0x0000651B, 0x0000651C, 0x0000651D, 0x0000651E, 0x0000651F,
+    0x00000652, 0x00006521, 0x00020653, 0x00006523, 0x00006524, 0x00006525, 0x00006526, 0x00006527,
+    0x00006528, 0x00006529, 0x0000652A, 0x0000652B, 0x0000652C, 0x0000652D, 0x0000652E, 0x0000652F,
+    0x00000653, 0x00006531, 0x00006532, 0x00040654, 0x00006534, 0x00006535, 0x00006536, 0x00006537,
+    0x00006538, 0x00006539, 0x0000653A, 0x0000653B, 0x0000653C, 0x0000653D, 0x0000653E, 0x0000653F,
+    0x00000654, 0x00006541, 0x00006542, 0x00006543, 0x00080655, 0x00006545, 0x00006546, 0x00006547,
+    0x00006548, 0x00006549, 0x0000654A, 0x0000654B, 0x0000654C, 0x0000654D, 0x0000654E, 0x0000654F,
+    0x00100066, 0x00100661, 0x00100662, 0x00100663, 0x00100664, 0x00100656, 0x00100666, 0x00100667,
+    0x00100668, 0x00100669, 0x0010066A, 0x0010066B, 0x0010066C, 0x0010066D, 0x0010066E, 0x0010066F,
+    0x00000656, 0x00006561, 0x00006562, 0x00006563, 0x00006564, 0x00006565, 0x00200657, 0x00006567,
+    0x00006568, 0x00006569, 0x0000656A, 0x0000656B, 0x0000656C, 0x0000656D, 0x0000656E, 0x0000656F,
+    0x00000657, 0x00006571, 0x00006572, 0x00006573, 0x00006574, 0x00006575, 0x00006576, 0x00400658,
+    0x00006578, 0x00006579, 0x0000657A, 0x0000657B, 0x0000657C, 0x0000657D, 0x0000657E, 0x0000657F,
+    0x00000658, 0x00006581, 0x00006582, 0x00006583, 0x00006584, 0x00006585, 0x00006586, 0x00006587,
+    0x00800659, 0x00006589, 0x0000658A, 0x0000658B, 0x0000658C, 0x0000658D, 0x0000658E, 0x0000658F,
+    0x00000659, 0x00006591, 0x00006592, 0x00006593, 0x00006594, 0x00006595, 0x00006596, 0x00006597,
+    0x00006598, 0x0100065A, 0x0000659A, 0x0000659B, 0x0000659C, 0x0000659D, 0x0000659E, 0x0000659F,
+    0x0000065A, 0x000065A1, 0x000065A2, 0x000065A3, 0x000065A4, 0x000065A5, 0x000065A6, 0x000065A7,
+    0x000065A8, 0x000065A9, 0x8200065B, 0x000065AB, 0x000065AC, 0x000065AD, 0x000065AE, 0x000065AF,
+    0x0000065B, 0x000065B1, 0x000065B2, 0x000065B3, 0x000065B4, 0x000065B5, 0x000065B6, 0x000065B7,
+    0x000065B8, 0x000065B9, 0x000065BA, 0x0400065C, 0x000065BC, 0x000065BD, 0x000065BE, 0x000065BF,
+    0x0000065C, 0x000065C1, 0x000065C2, 0x000065C3, 0x000065C4, 0x000065C5, 0x000065C6, 0x000065C7,
+    0x000065C8, 0x000065C9, 0x000065CA, 0x000065CB, 0x0800065D, 0x000065CD, 0x000065CE, 0x000065CF,
+    0x0000065D, 0x000065D1, 0x000065D2, 0x000065D3, 0x000065D4, 0x000065D5, 0x000065D6, 0x000065D7,
+    0x000065D8, 0x000065D9, 0x000065DA, 0x000065DB, 0x000065DC, 0x1000065E, 0x000065DE, 0x000065DF,
+    0x0000065E, 0x000065E1, 0x000065E2, 0x000065E3, 0x000065E4, 0x000065E5, 0x000065E6, 0x000065E7,
+    0x000065E8, 0x000065E9, 0x000065EA, 0x000065EB, 0x000065EC, 0x000065ED, 0x2000065F, 0x000065EF,
+    0x0000065F, 0x000065F1, 0x000065F2, 0x000065F3, 0x000065F4, 0x000065F5, 0x000065F6, 0x000065F7,
+    0x000065F8, 0x000065F9, 0x000065FA, 0x000065FB, 0x000065FC, 0x000065FD, 0x000065FE, 0x000065FF,
+    0x00200007, 0x00200071, 0x00200072, 0x00200073, 0x00200074, 0x00200075, 0x00200067, 0x00200077,
+    0x00200078, 0x00200079, 0x0020007A, 0x0020007B, 0x0020007C, 0x0020007D, 0x0020007E, 0x0020007F,
+    0x00200071, 0x00210072, 0x00200712, 0x00200713, 0x00200714, 0x00200715, 0x00200716, 0x00200717,
+    0x00200718, 0x00200719, 0x0020071A, 0x0020071B, 0x0020071C, 0x0020071D, 0x0020071E, 0x0020071F,
+    0x00200072, 0x00200721, 0x00220073, 0x00200723, 0x00200724, 0x00200725, 0x00200726, 0x00200727,
+    0x00200728, 0x00200729, 0x0020072A, 0x0020072B, 0x0020072C, 0x0020072D, 0x0020072E, 0x0020072F,
+    0x00200073, 0x00200731, 0x00200732, 0x00240074, 0x00200734, 0x00200735, 0x00200736, 0x00200737,
+    0x00200738, 0x00200739, 0x0020073A, 0x0020073B, 0x0020073C, 0x0020073D, 0x0020073E, 0x0020073F,
+    0x00200074, 0x00200741, 0x00200742, 0x00200743, 0x00280075, 0x00200745, 0x00200746, 0x00200747,
+    0x00200748, 0x00200749, 0x0020074A, 0x0020074B, 0x0020074C, 0x0020074D, 0x0020074E, 0x0020074F,
+    0x00200075, 0x00200751, 0x00200752, 0x00200753, 0x00200754, 0x00300076, 0x00200756, 0x00200757,
+    0x00200758, 0x00200759, 0x0020075A, 0x0020075B, 0x0020075C, 0x0020075D, 0x0020075E, 0x0020075F,
+    0x00200067, 0x00200671, 0x00200672, 0x00200673, 0x00200674, 0x00200675, 0x00400077, 0x00200677,
+    0x00200678, 0x00200679, 0x0020067A, 0x0020067B, 0x0020067C, 0x0020067D, 0x0020067E, 0x0020067F,
+    0x00200077, 0x00200771, 0x00200772, 0x00200773, 0x00200774, 0x00200775, 0x00200776, 0x00600078,
+    0x00200778, 0x00200779, 0x0020077A, 0x0020077B, 0x0020077C, 0x0020077D, 0x0020077E, 0x0020077F,
+    0x00200078, 0x00200781, 0x00200782, 0x00200783, 0x00200784, 0x00200785, 0x00200786, 0x00200787,
+    0x00A00079, 0x00200789, 0x0020078A, 0x0020078B, 0x0020078C, 0x0020078D, 0x0020078E, 0x0020078F,
+    0x00200079, 0x00200791, 0x00200792, 0x00200793, 0x00200794, 0x00200795, 0x00200796, 0x00200797,
+    0x00200798, 0x0120007A, 0x0020079A, 0x0020079B, 0x0020079C, 0x0020079D, 0x0020079E, 0x0020079F,
+    0x0020007A, 0x002007A1, 0x002007A2, 0x002007A3, 0x002007A4, 0x002007A5, 0x002007A6, 0x002007A7,
+    0x002007A8, 0x002007A9, 0x8220007B, 0x002007AB, 0x002007AC, 0x002007AD, 0x002007AE, 0x002007AF,
+    0x0020007B, 0x002007B1, 0x002007B2, 0x002007B3, 0x002007B4, 0x002007B5, 0x002007B6, 0x002007B7,
+    0x002007B8, 0x002007B9, 0x002007BA, 0x0420007C, 0x002007BC, 0x002007BD, 0x002007BE, 0x002007BF,
+    0x0020007C, 0x002007C1, 0x002007C2, 0x002007C3, 0x002007C4, 0x002007C5, 0x002007C6, 0x002007C7,
+    0x002007C8, 0x002007C9, 0x002007CA, 0x002007CB, 0x0820007D, 0x002007CD, 0x002007CE, 0x002007CF,
+    0x0020007D, 0x002007D1, 0x002007D2, 0x002007D3, 0x002007D4, 0x002007D5, 0x002007D6, 0x002007D7,
+    0x002007D8, 0x002007D9, 0x002007DA, 0x002007DB, 0x002007DC, 0x1020007E, 0x002007DE, 0x002007DF,
+    0x0020007E, 0x002007E1, 0x002007E2, 0x002007E3, 0x002007E4, 0x002007E5, 0x002007E6, 0x002007E7,
+    0x002007E8, 0x002007E9, 0x002007EA, 0x002007EB, 0x002007EC, 0x002007ED, 0x2020007F, 0x002007EF,
+    0x0020007F, 0x002007F1, 0x002007F2, 0x002007F3, 0x002007F4, 0x002007F5, 0x002007F6, 0x002007F7,
+    0x002007F8, 0x002007F9, 0x002007FA, 0x002007FB, 0x002007FC, 0x002007FD, 0x002007FE, 0x002007FF,
+    0x00000067, 0x00000671, 0x00000672, 0x00000673, 0x00000674, 0x00000675, 0x00000676, 0x00400068,
+    0x00000678, 0x00000679, 0x0000067A, 0x0000067B, 0x0000067C, 0x0000067D, 0x0000067E, 0x0000067F,
+    0x00000671, 0x00010672, 0x00006712, 0x00006713, 0x00006714, 0x00006715, 0x00006716, 0x00006717,
+    0x00006718, 0x00006719, 0x0000671A, 0x0000671B, 0x0000671C, 0x0000671D, 0x0000671E, 0x0000671F,
+    0x00000672, 0x00006721, 0x00020673, 0x00006723, 0x00006724, 0x00006725, 0x00006726, 0x00006727,
+    0x00006728, 0x00006729, 0x0000672A, 0x0000672B, 0x0000672C, 0x0000672D, 0x0000672E, 0x0000672F,
+    0x00000673, 0x00006731, 0x00006732, 0x00040674, 0x00006734, 0x00006735, 0x00006736, 0x00006737,
+    0x00006738, 0x00006739, 0x0000673A, 0x0000673B, 0x0000673C, 0x0000673D, 0x0000673E, 0x0000673F,
+    0x00000674, 0x00006741, 0x00006742, 0x00006743, 0x00080675, 0x00006745, 0x00006746, 0x00006747,
+    0x00006748, 0x00006749, 0x0000674A, 0x0000674B, 0x0000674C, 0x0000674D, 0x0000674E, 0x0000674F,
+    0x00000675, 0x00006751, 0x00006752, 0x00006753, 0x00006754, 0x00100676, 0x00006756, 0x00006757,
+    0x00006758, 0x00006759, 0x0000675A, 0x0000675B, 0x0000675C, 0x0000675D, 0x0000675E, 0x0000675F,
+    0x00000676, 0x00006761, 0x00006762, 0x00006763, 0x00006764, 0x00006765, 0x00200677, 0x00006767,
+    0x00006768, 0x00006769, 0x0000676A, 0x0000676B, 0x0000676C, 0x0000676D, 0x0000676E, 0x0000676F,
+    0x00400068, 0x00400681, 0x00400682, 0x00400683, 0x00400684, 0x00400685, 0x00400686, 0x00400678,
+    0x00400688, 0x00400689, 0x0040068A, 0x0040068B, 0x0040068C, 0x0040068D, 0x0040068E, 0x0040068F,
+    0x00000678, 0x00006781, 0x00006782, 0x00006783, 0x00006784, 0x00006785, 0x00006786, 0x00006787,
+    0x00800679, 0x00006789, 0x0000678A, 0x0000678B, 0x0000678C, 0x0000678D, 0x0000678E, 0x0000678F,
+    0x00000679, 0x00006791, 0x00006792, 0x00006793, 0x00006794, 0x00006795, 0x00006796, 0x00006797,
+    0x00006798, 0x0100067A, 0x0000679A, 0x0000679B, 0x0000679C, 0x0000679D, 0x0000679E, 0x0000679F,
+    0x0000067A, 0x000067A1, 0x000067A2, 0x000067A3, 0x000067A4, 0x000067A5, 0x000067A6, 0x000067A7,
+    0x000067A8, 0x000067A9, 0x8200067B, 0x000067AB, 0x000067AC, 0x000067AD, 0x000067AE, 0x000067AF,
+    0x0000067B, 0x000067B1, 0x000067B2, 0x000067B3, 0x000067B4, 0x000067B5, 0x000067B6, 0x000067B7,
+    0x000067B8, 0x000067B9, 0x000067BA, 0x0400067C, 0x000067BC, 0x000067BD, 0x000067BE, 0x000067BF,
+    0x0000067C, 0x000067C1, 0x000067C2, 0x000067C3, 0x000067C4, 0x000067C5, 0x000067C6, 0x000067C7,
+    0x000067C8, 0x000067C9, 0x000067CA, 0x000067CB, 0x0800067D, 0x000067CD, 0x000067CE, 0x000067CF,
+    0x0000067D, 0x000067D1, 0x000067D2, 0x000067D3, 0x000067D4, 0x000067D5, 0x000067D6, 0x000067D7,
+    0x000067D8, 0x000067D9, 0x000067DA, 0x000067DB, 0x000067DC, 0x1000067E, 0x000067DE, 0x000067DF,
+    0x0000067E, 0x000067E1, 0x000067E2, 0x000067E3, 0x000067E4, 0x000067E5, 0x000067E6, 0x000067E7,
+    0x000067E8, 0x000067E9, 0x000067EA, 0x000067EB, 0x000067EC, 0x000067ED, 0x2000067F, 0x000067EF,
+    0x0000067F, 0x000067F1, 0x000067F2, 0x000067F3, 0x000067F4, 0x000067F5, 0x000067F6, 0x000067F7,
+    0x000067F8, 0x000067F9, 0x000067FA, 0x000067FB, 0x000067FC, 0x000067FD, 0x000067FE, 0x000067FF,
+    0x00000068, 0x00000681, 0x00000682, 0x00000683, 0x00000684, 0x00000685, 0x00000686, 0x00000687,
+    0x00800069, 0x00000689, 0x0000068A, 0x0000068B, 0x0000068C, 0x0000068D, 0x0000068E, 0x0000068F,
+    0x00000681, 0x00010682, 0x00006812, 0x00006813, 0x00006814, 0x00006815, 0x00006816, 0x00006817,
+    0x00006818, 0x00006819, 0x0000681A, 0x0000681B, 0x0000681C, 0x0000681D, 0x0000681E, 0x0000681F,
+    0x00000682, 0x00006821, 0x00020683, 0x00006823, 0x00006824, 0x00006825, 0x00006826, 0x00006827,
+    0x00006828, 0x00006829, 0x0000682A, 0x0000682B, 0x0000682C, 0x0000682D, 0x0000682E, 0x0000682F,
+    0x00000683, 0x00006831, 0x00006832, 0x00040684, 0x00006834, 0x00006835, 0x00006836, 0x00006837,
+    0x00006838, 0x00006839, 0x0000683A, 0x0000683B, 0x0000683C, 0x0000683D, 0x0000683E, 0x0000683F,
+    0x00000684, 0x00006841, 0x00006842, 0x00006843, 0x00080685, 0x00006845, 0x00006846, 0x00006847,
+    0x00006848, 0x00006849, 0x0000684A, 0x0000684B, 0x0000684C, 0x0000684D, 0x0000684E, 0x0000684F,
+    0x00000685, 0x00006851, 0x00006852, 0x00006853, 0x00006854, 0x00100686, 0x00006856, 0x00006857,
+    0x00006858, 0x00006859, 0x0000685A, 0x0000685B, 0x0000685C, 0x0000685D, 0x0000685E, 0x0000685F,
+    0x00000686, 0x00006861, 0x00006862, 0x00006863, 0x00006864, 0x00006865, 0x00200687, 0x00006867,
+    0x00006868, 0x00006869, 0x0000686A, 0x0000686B, 0x0000686C, 0x0000686D, 0x0000686E, 0x0000686F,
+    0x00000687, 0x00006871, 0x00006872, 0x00006873, 0x00006874, 0x00006875, 0x00006876, 0x00400688,
+    0x00006878, 0x00006879, 0x0000687A, 0x0000687B, 0x0000687C, 0x0000687D, 0x0000687E, 0x0000687F,
+    0x00800069, 0x00800691, 0x00800692, 0x00800693, 0x00800694, 0x00800695, 0x00800696, 0x00800697,
+    0x00800689, 0x00800699, 0x0080069A, 0x0080069B, 0x0080069C, 0x0080069D, 0x0080069E, 0x0080069F,
+    0x00000689, 0x00006891, 0x00006892, 0x00006893, 0x00006894, 0x00006895, 0x00006896, 0x00006897,
+    0x00006898, 0x0100068A, 0x0000689A, 0x0000689B, 0x0000689C, 0x0000689D, 0x0000689E, 0x0000689F,
+    0x0000068A, 0x000068A1, 0x000068A2, 0x000068A3, 0x000068A4, 0x000068A5, 0x000068A6, 0x000068A7,
+    0x000068A8, 0x000068A9, 0x8200068B, 0x000068AB, 0x000068AC, 0x000068AD, 0x000068AE, 0x000068AF,
+    0x0000068B, 0x000068B1, 0x000068B2, 0x000068B3, 0x000068B4, 0x000068B5, 0x000068B6, 0x000068B7,
+    0x000068B8, 0x000068B9, 0x000068BA, 0x0400068C, 0x000068BC, 0x000068BD, 0x000068BE, 0x000068BF,
+    0x0000068C, 0x000068C1, 0x000068C2, 0x000068C3, 0x000068C4, 0x000068C5, 0x000068C6, 0x000068C7,
+    0x000068C8, 0x000068C9, 0x000068CA, 0x000068CB, 0x0800068D, 0x000068CD, 0x000068CE, 0x000068CF,
+    0x0000068D, 0x000068D1, 0x000068D2, 0x000068D3, 0x000068D4, 0x000068D5, 0x000068D6, 0x000068D7,
+    0x000068D8, 0x000068D9, 0x000068DA, 0x000068DB, 0x000068DC, 0x1000068E, 0x000068DE, 0x000068DF,
+    0x0000068E, 0x000068E1, 0x000068E2, 0x000068E3, 0x000068E4, 0x000068E5, 0x000068E6, 0x000068E7,
+    0x000068E8, 0x000068E9, 0x000068EA, 0x000068EB, 0x000068EC, 0x000068ED, 0x2000068F, 0x000068EF,
+    0x0000068F, 0x000068F1, 0x000068F2, 0x000068F3, 0x000068F4, 0x000068F5, 0x000068F6, 0x000068F7,
+    0x000068F8, 0x000068F9, 0x000068FA, 0x000068FB, 0x000068FC, 0x000068FD, 0x000068FE, 0x000068FF,
+    0x00000069, 0x00000691, 0x00000692, 0x00000693, 0x00000694, 0x00000695, 0x00000696, 0x00000697,
+    0x00000698, 0x0100006A, 0x0000069A, 0x0000069B, 0x0000069C, 0x0000069D, 0x0000069E, 0x0000069F,
+    0x00000691, 0x00010692, 0x00006912, 0x00006913, 0x00006914, 0x00006915, 0x00006916, 0x00006917,
+    0x00006918, 0x00006919, 0x0000691A, 0x0000691B, 0x0000691C, 0x0000691D, 0x0000691E, 0x0000691F,
+    0x00000692, 0x00006921, 0x00020693, 0x00006923, 0x00006924, 0x00006925, 0x00006926, 0x00006927,
+    0x00006928, 0x00006929, 0x0000692A, 0x0000692B, 0x0000692C, 0x0000692D, 0x0000692E, 0x0000692F,
+    0x00000693, 0x00006931, 0x00006932, 0x00040694, 0x00006934, 0x00006935, 0x00006936, 0x00006937,
+    0x00006938, 0x00006939, 0x0000693A, 0x0000693B, 0x0000693C, 0x0000693D, 0x0000693E, 0x0000693F,
+    0x00000694, 0x00006941, 0x00006942, 0x00006943, 0x00080695, 0x00006945, 0x00006946, 0x00006947,
+    0x00006948, 0x00006949, 0x0000694A, 0x0000694B, 0x0000694C, 0x0000694D, 0x0000694E, 0x0000694F,
+    0x00000695, 0x00006951, 0x00006952, 0x00006953, 0x00006954, 0x00100696, 0x00006956, 0x00006957,
+    0x00006958, 0x00006959, 0x0000695A, 0x0000695B, 0x0000695C, 0x0000695D, 0x0000695E, 0x0000695F,
+    0x00000696, 0x00006961, 0x00006962, 0x00006963, 0x00006964, 0x00006965, 0x00200697, 0x00006967,
+    0x00006968, 0x00006969, 0x0000696A, 0x0000696B, 0x0000696C, 0x0000696D, 0x0000696E, 0x0000696F,
+    0x00000697, 0x00006971, 0x00006972, 0x00006973, 0x00006974, 0x00006975, 0x00006976, 0x00400698,
+    0x00006978, 0x00006979, 0x0000697A, 0x0000697B, 0x0000697C, 0x0000697D, 0x0000697E, 0x0000697F,
+    0x00000698, 0x00006981, 0x00006982, 0x00006983, 0x00006984, 0x00006985, 0x00006986, 0x00006987,
+    0x00800699, 0x00006989, 0x0000698A, 0x0000698B, 0x0000698C, 0x0000698D, 0x0000698E, 0x0000698F,
+    0x0100006A, 0x010006A1, 0x010006A2, 0x010006A3, 0x010006A4, 0x010006A5, 0x010006A6, 0x010006A7,
+    0x010006A8, 0x0100069A, 0x010006AA, 0x010006AB, 0x010006AC, 0x010006AD, 0x010006AE, 0x010006AF,
+    0x0000069A, 0x000069A1, 0x000069A2, 0x000069A3, 0x000069A4, 0x000069A5, 0x000069A6, 0x000069A7,
+    0x000069A8, 0x000069A9, 0x8200069B, 0x000069AB, 0x000069AC, 0x000069AD, 0x000069AE, 0x000069AF,
+    0x0000069B, 0x000069B1, 0x000069B2, 0x000069B3, 0x000069B4, 0x000069B5, 0x000069B6, 0x000069B7,
+    0x000069B8, 0x000069B9, 0x000069BA, 0x0400069C, 0x000069BC, 0x000069BD, 0x000069BE, 0x000069BF,
+    0x0000069C, 0x000069C1, 0x000069C2, 0x000069C3, 0x000069C4, 0x000069C5, 0x000069C6, 0x000069C7,
+    0x000069C8, 0x000069C9, 0x000069CA, 0x000069CB, 0x0800069D, 0x000069CD, 0x000069CE, 0x000069CF,
+    0x0000069D, 0x000069D1, 0x000069D2, 0x000069D3, 0x000069D4, 0x000069D5, 0x000069D6, 0x000069D7,
+    0x000069D8, 0x000069D9, 0x000069DA, 0x000069DB, 0x000069DC, 0x1000069E, 0x000069DE, 0x000069DF,
+    0x0000069E, 0x000069E1, 0x000069E2, 0x000069E3, 0x000069E4, 0x000069E5, 0x000069E6, 0x000069E7,
+    0x000069E8, 0x000069E9, 0x000069EA, 0x000069EB, 0x000069EC, 0x000069ED, 0x2000069F, 0x000069EF,
+    0x0000069F, 0x000069F1, 0x000069F2, 0x000069F3, 0x000069F4, 0x000069F5, 0x000069F6, 0x000069F7,
+    0x000069F8, 0x000069F9, 0x000069FA, 0x000069FB, 0x000069FC, 0x000069FD, 0x000069FE, 0x000069FF,
+    0x0000006A, 0x000006A1, 0x000006A2, 0x000006A3, 0x000006A4, 0x000006A5, 0x000006A6, 0x000006A7,
+    0x000006A8, 0x000006A9, 0x8200006B, 0x000006AB, 0x000006AC, 0x000006AD, 0x000006AE, 0x000006AF,
+    0x000006A1, 0x000106A2, 0x00006A12, 0x00006A13, 0x00006A14, 0x00006A15, 0x00006A16, 0x00006A17,
+    0x00006A18, 0x00006A19, 0x00006A1A, 0x00006A1B, 0x00006A1C, 0x00006A1D, 0x00006A1E, 0x00006A1F,
+    0x000006A2, 0x00006A21, 0x000206A3, 0x00006A23, 0x00006A24, 0x00006A25, 0x00006A26, 0x00006A27,
+    0x00006A28, 0x00006A29, 0x00006A2A, 0x00006A2B, 0x00006A2C, 0x00006A2D, 0x00006A2E, 0x00006A2F,
+    0x000006A3, 0x00006A31, 0x00006A32, 0x000406A4, 0x00006A34, 0x00006A35, 0x00006A36, 0x00006A37,
+    0x00006A38, 0x00006A39, 0x00006A3A, 0x00006A3B, 0x00006A3C, 0x00006A3D, 0x00006A3E, 0x00006A3F,
+    0x000006A4, 0x00006A41, 0x00006A42, 0x00006A43, 0x000806A5, 0x00006A45, 0x00006A46, 0x00006A47,
+    0x00006A48, 0x00006A49, 0x00006A4A, 0x00006A4B, 0x00006A4C, 0x00006A4D, 0x00006A4E, 0x00006A4F,
+    0x000006A5, 0x00006A51, 0x00006A52, 0x00006A53, 0x00006A54, 0x001006A6, 0x00006A56, 0x00006A57,
+    0x00006A58, 0x00006A59, 0x00006A5A, 0x00006A5B, 0x00006A5C, 0x00006A5D, 0x00006A5E, 0x00006A5F,
+    0x000006A6, 0x00006A61, 0x00006A62, 0x00006A63, 0x00006A64, 0x00006A65, 0x002006A7, 0x00006A67,
+    0x00006A68, 0x00006A69, 0x00006A6A, 0x00006A6B, 0x00006A6C, 0x00006A6D, 0x00006A6E, 0x00006A6F,
+    0x000006A7, 0x00006A71, 0x00006A72, 0x00006A73, 0x00006A74, 0x00006A75, 0x00006A76, 0x004006A8,
+    0x00006A78, 0x00006A79, 0x00006A7A, 0x00006A7B, 0x00006A7C, 0x00006A7D, 0x00006A7E, 0x00006A7F,
+    0x000006A8, 0x00006A81, 0x00006A82, 0x00006A83, 0x00006A84, 0x00006A85, 0x00006A86, 0x00006A87,
+    0x008006A9, 0x00006A89, 0x00006A8A, 0x00006A8B, 0x00006A8C, 0x00006A8D, 0x00006A8E, 0x00006A8F,
+    0x000006A9, 0x00006A91, 0x00006A92, 0x00006A93, 0x00006A94, 0x00006A95, 0x00006A96, 0x00006A97,
+    0x00006A98, 0x010006AA, 0x00006A9A, 0x00006A9B, 0x00006A9C, 0x00006A9D, 0x00006A9E, 0x00006A9F,
+    0x8200006B, 0x820006B1, 0x820006B2, 0x820006B3, 0x820006B4, 0x820006B5, 0x820006B6, 0x820006B7,
+    0x820006B8, 0x820006B9, 0x820006AB, 0x820006BB, 0x820006BC, 0x820006BD, 0x820006BE, 0x820006BF,
+    0x000006AB, 0x00006AB1, 0x00006AB2, 0x00006AB3, 0x00006AB4, 0x00006AB5, 0x00006AB6, 0x00006AB7,
+    0x00006AB8, 0x00006AB9, 0x00006ABA, 0x040006AC, 0x00006ABC, 0x00006ABD, 0x00006ABE, 0x00006ABF,
+    0x000006AC, 0x00006AC1, 0x00006AC2, 0x00006AC3, 0x00006AC4, 0x00006AC5, 0x00006AC6, 0x00006AC7,
+    0x00006AC8, 0x00006AC9, 0x00006ACA, 0x00006ACB, 0x080006AD, 0x00006ACD, 0x00006ACE, 0x00006ACF,
+    0x000006AD, 0x00006AD1, 0x00006AD2, 0x00006AD3, 0x00006AD4, 0x00006AD5, 0x00006AD6, 0x00006AD7,
+    0x00006AD8, 0x00006AD9, 0x00006ADA, 0x00006ADB, 0x00006ADC, 0x100006AE, 0x00006ADE, 0x00006ADF,
+    0x000006AE, 0x00006AE1, 0x00006AE2, 0x00006AE3, 0x00006AE4, 0x00006AE5, 0x00006AE6, 0x00006AE7,
+    0x00006AE8, 0x00006AE9, 0x00006AEA, 0x00006AEB, 0x00006AEC, 0x00006AED, 0x200006AF, 0x00006AEF,
+    0x000006AF, 0x00006AF1, 0x00006AF2, 0x00006AF3, 0x00006AF4, 0x00006AF5, 0x00006AF6, 0x00006AF7,
+    0x00006AF8, 0x00006AF9, 0x00006AFA, 0x00006AFB, 0x00006AFC, 0x00006AFD, 0x00006AFE, 0x00006AFF,
+    0x0000006B, 0x000006B1, 0x000006B2, 0x000006B3, 0x000006B4, 0x000006B5, 0x000006B6, 0x000006B7,
+    0x000006B8, 0x000006B9, 0x000006BA, 0x0400006C, 0x000006BC, 0x000006BD, 0x000006BE, 0x000006BF,
+    0x000006B1, 0x000106B2, 0x00006B12, 0x00006B13, 0x00006B14, 0x00006B15, 0x00006B16, 0x00006B17,
+    0x00006B18, 0x00006B19, 0x00006B1A, 0x00006B1B, 0x00006B1C, 0x00006B1D, 0x00006B1E, 0x00006B1F,
+    0x000006B2, 0x00006B21, 0x000206B3, 0x00006B23, 0x00006B24, 0x00006B25, 0x00006B26, 0x00006B27,
+    0x00006B28, 0x00006B29, 0x00006B2A, 0x00006B2B, 0x00006B2C, 0x00006B2D, 0x00006B2E, 0x00006B2F,
+    0x000006B3, 0x00006B31, 0x00006B32, 0x000406B4, 0x00006B34, 0x00006B35, 0x00006B36, 0x00006B37,
+    0x00006B38, 0x00006B39, 0x00006B3A, 0x00006B3B, 0x00006B3C, 0x00006B3D, 0x00006B3E, 0x00006B3F,
+    0x000006B4, 0x00006B41, 0x00006B42, 0x00006B43, 0x000806B5, 0x00006B45, 0x00006B46, 0x00006B47,
+    0x00006B48, 0x00006B49, 0x00006B4A, 0x00006B4B, 0x00006B4C, 0x00006B4D, 0x00006B4E, 0x00006B4F,
+    0x000006B5, 0x00006B51, 0x00006B52, 0x00006B53, 0x00006B54, 0x001006B6, 0x00006B56, 0x00006B57,
+    0x00006B58, 0x00006B59, 0x00006B5A, 0x00006B5B, 0x00006B5C, 0x00006B5D, 0x00006B5E, 0x00006B5F,
+    0x000006B6, 0x00006B61, 0x00006B62, 0x00006B63, 0x00006B64, 0x00006B65, 0x002006B7, 0x00006B67,
+    0x00006B68, 0x00006B69, 0x00006B6A, 0x00006B6B, 0x00006B6C, 0x00006B6D, 0x00006B6E, 0x00006B6F,
+    0x000006B7, 0x00006B71, 0x00006B72, 0x00006B73, 0x00006B74, 0x00006B75, 0x00006B76, 0x004006B8,
+    0x00006B78, 0x00006B79, 0x00006B7A, 0x00006B7B, 0x00006B7C, 0x00006B7D, 0x00006B7E, 0x00006B7F,
+    0x000006B8, 0x00006B81, 0x00006B82, 0x00006B83, 0x00006B84, 0x00006B85, 0x00006B86, 0x00006B87,
+    0x008006B9, 0x00006B89, 0x00006B8A, 0x00006B8B, 0x00006B8C, 0x00006B8D, 0x00006B8E, 0x00006B8F,
+    0x000006B9, 0x00006B91, 0x00006B92, 0x00006B93, 0x00006B94, 0x00006B95, 0x00006B96, 0x00006B97,
+    0x00006B98, 0x010006BA, 0x00006B9A, 0x00006B9B, 0x00006B9C, 0x00006B9D, 0x00006B9E, 0x00006B9F,
+    0x000006BA, 0x00006BA1, 0x00006BA2, 0x00006BA3, 0x00006BA4, 0x00006BA5, 0x00006BA6, 0x00006BA7,
+    0x00006BA8, 0x00006BA9, 0x820006BB, 0x00006BAB, 0x00006BAC, 0x00006BAD, 0x00006BAE, 0x00006BAF,
+    0x0400006C, 0x040006C1, 0x040006C2, 0x040006C3, 0x040006C4, 0x040006C5, 0x040006C6, 0x040006C7,
+    0x040006C8, 0x040006C9, 0x040006CA, 0x040006BC, 0x040006CC, 0x040006CD, 0x040006CE, 0x040006CF,
+    0x000006BC, 0x00006BC1, 0x00006BC2, 0x00006BC3, 0x00006BC4, 0x00006BC5, 0x00006BC6, 0x00006BC7,
+    0x00006BC8, 0x00006BC9, 0x00006BCA, 0x00006BCB, 0x080006BD, 0x00006BCD, 0x00006BCE, 0x00006BCF,
+    0x000006BD, 0x00006BD1, 0x00006BD2, 0x00006BD3, 0x00006BD4, 0x00006BD5, 0x00006BD6, 0x00006BD7,
+    0x00006BD8, 0x00006BD9, 0x00006BDA, 0x00006BDB, 0x00006BDC, 0x100006BE, 0x00006BDE, 0x00006BDF,
+    0x000006BE, 0x00006BE1, 0x00006BE2, 0x00006BE3, 0x00006BE4, 0x00006BE5, 0x00006BE6, 0x00006BE7,
+    0x00006BE8, 0x00006BE9, 0x00006BEA, 0x00006BEB, 0x00006BEC, 0x00006BED, 0x200006BF, 0x00006BEF,
+    0x000006BF, 0x00006BF1, 0x00006BF2, 0x00006BF3, 0x00006BF4, 0x00006BF5, 0x00006BF6, 0x00006BF7,
+    0x00006BF8, 0x00006BF9, 0x00006BFA, 0x00006BFB, 0x00006BFC, 0x00006BFD, 0x00006BFE, 0x00006BFF,
+    0x0000006C, 0x000006C1, 0x000006C2, 0x000006C3, 0x000006C4, 0x000006C5, 0x000006C6, 0x000006C7,
+    0x000006C8, 0x000006C9, 0x000006CA, 0x000006CB, 0x0800006D, 0x000006CD, 0x000006CE, 0x000006CF,
+    0x000006C1, 0x000106C2, 0x00006C12, 0x00006C13, 0x00006C14, 0x00006C15, 0x00006C16, 0x00006C17,
+    0x00006C18, 0x00006C19, 0x00006C1A, 0x00006C1B, 0x00006C1C, 0x00006C1D, 0x00006C1E, 0x00006C1F,
+    0x000006C2, 0x00006C21, 0x000206C3, 0x00006C23, 0x00006C24, 0x00006C25, 0x00006C26, 0x00006C27,
+    0x00006C28, 0x00006C29, 0x00006C2A, 0x00006C2B, 0x00006C2C, 0x00006C2D, 0x00006C2E, 0x00006C2F,
+    0x000006C3, 0x00006C31, 0x00006C32, 0x000406C4, 0x00006C34, 0x00006C35, 0x00006C36, 0x00006C37,
+    0x00006C38, 0x00006C39, 0x00006C3A, 0x00006C3B, 0x00006C3C, 0x00006C3D, 0x00006C3E, 0x00006C3F,
+    0x000006C4, 0x00006C41, 0x00006C42, 0x00006C43, 0x000806C5, 0x00006C45, 0x00006C46, 0x00006C47,
+    0x00006C48, 0x00006C49, 0x00006C4A, 0x00006C4B, 0x00006C4C, 0x00006C4D, 0x00006C4E, 0x00006C4F,
+    0x000006C5, 0x00006C51, 0x00006C52, 0x00006C53, 0x00006C54, 0x001006C6, 0x00006C56, 0x00006C57,
+    0x00006C58, 0x00006C59, 0x00006C5A, 0x00006C5B, 0x00006C5C, 0x00006C5D, 0x00006C5E, 0x00006C5F,
+    0x000006C6, 0x00006C61, 0x00006C62, 0x00006C63, 0x00006C64, 0x00006C65, 0x002006C7, 0x00006C67,
+    0x00006C68, 0x00006C69, 0x00006C6A, 0x00006C6B, 0x00006C6C, 0x00006C6D, 0x00006C6E, 0x00006C6F,
+    0x000006C7, 0x00006C71, 0x00006C72, 0x00006C73, 0x00006C74, 0x00006C75, 0x00006C76, 0x004006C8,
+    0x00006C78, 0x00006C79, 0x00006C7A, 0x00006C7B, 0x00006C7C, 0x00006C7D, 0x00006C7E, 0x00006C7F,
+    0x000006C8, 0x00006C81, 0x00006C82, 0x00006C83, 0x00006C84, 0x00006C85, 0x00006C86, 0x00006C87,
+    0x008006C9, 0x00006C89, 0x00006C8A, 0x00006C8B, 0x00006C8C, 0x00006C8D, 0x00006C8E, 0x00006C8F,
+    0x000006C9, 0x00006C91, 0x00006C92, 0x00006C93, 0x00006C94, 0x00006C95, 0x00006C96, 0x00006C97,
+    0x00006C98, 0x010006CA, 0x00006C9A, 0x00006C9B, 0x00006C9C, 0x00006C9D, 0x00006C9E, 0x00006C9F,
+    0x000006CA, 0x00006CA1, 0x00006CA2, 0x00006CA3, 0x00006CA4, 0x00006CA5, 0x00006CA6, 0x00006CA7,
+    0x00006CA8, 0x00006CA9, 0x820006CB, 0x00006CAB, 0x00006CAC, 0x00006CAD, 0x00006CAE, 0x00006CAF,
+    0x000006CB, 0x00006CB1, 0x00006CB2, 0x00006CB3, 0x00006CB4, 0x00006CB5, 0x00006CB6, 0x00006CB7,
+    0x00006CB8, 0x00006CB9, 0x00006CBA, 0x040006CC, 0x00006CBC, 0x00006CBD, 0x00006CBE, 0x00006CBF,
+    0x0800006D, 0x080006D1, 0x080006D2, 0x080006D3, 0x080006D4, 0x080006D5, 0x080006D6, 0x080006D7,
+    0x080006D8, 0x080006D9, 0x080006DA, 0x080006DB, 0x080006CD, 0x080006DD, 0x080006DE, 0x080006DF,
+    0x000006CD, 0x00006CD1, 0x00006CD2, 0x00006CD3, 0x00006CD4, 0x00006CD5, 0x00006CD6, 0x00006CD7,
+    0x00006CD8, 0x00006CD9, 0x00006CDA, 0x00006CDB, 0x00006CDC, 0x100006CE, 0x00006CDE, 0x00006CDF,
+    0x000006CE, 0x00006CE1, 0x00006CE2, 0x00006CE3, 0x00006CE4, 0x00006CE5, 0x00006CE6, 0x00006CE7,
+    0x00006CE8, 0x00006CE9, 0x00006CEA, 0x00006CEB, 0x00006CEC, 0x00006CED, 0x200006CF, 0x00006CEF,
+    0x000006CF, 0x00006CF1, 0x00006CF2, 0x00006CF3, 0x00006CF4, 0x00006CF5, 0x00006CF6, 0x00006CF7,
+    0x00006CF8, 0x00006CF9, 0x00006CFA, 0x00006CFB, 0x00006CFC, 0x00006CFD, 0x00006CFE, 0x00006CFF,
+    0x0000006D, 0x000006D1, 0x000006D2, 0x000006D3, 0x000006D4, 0x000006D5, 0x000006D6, 0x000006D7,
+    0x000006D8, 0x000006D9, 0x000006DA, 0x000006DB, 0x000006DC, 0x1000006E, 0x000006DE, 0x000006DF,
+    0x000006D1, 0x000106D2, 0x00006D12, 0x00006D13, 0x00006D14, 0x00006D15, 0x00006D16, 0x00006D17,
+    0x00006D18, 0x00006D19, 0x00006D1A, 0x00006D1B, 0x00006D1C, 0x00006D1D, 0x00006D1E, 0x00006D1F,
+    0x000006D2, 0x00006D21, 0x000206D3, 0x00006D23, 0x00006D24, 0x00006D25, 0x00006D26, 0x00006D27,
+    0x00006D28, 0x00006D29, 0x00006D2A, 0x00006D2B, 0x00006D2C, 0x00006D2D, 0x00006D2E, 0x00006D2F,
+    0x000006D3, 0x00006D31, 0x00006D32, 0x000406D4, 0x00006D34, 0x00006D35, 0x00006D36, 0x00006D37,
+    0x00006D38, 0x00006D39, 0x00006D3A, 0x00006D3B, 0x00006D3C, 0x00006D3D, 0x00006D3E, 0x00006D3F,
+    0x000006D4, 0x00006D41, 0x00006D42, 0x00006D43, 0x000806D5, 0x00006D45, 0x00006D46, 0x00006D47,
+    0x00006D48, 0x00006D49, 0x00006D4A, 0x00006D4B, 0x00006D4C, 0x00006D4D, 0x00006D4E, 0x00006D4F,
+    0x000006D5, 0x00006D51, 0x00006D52, 0x00006D53, 0x00006D54, 0x001006D6, 0x00006D56, 0x00006D57,
+    0x00006D58, 0x00006D59, 0x00006D5A, 0x00006D5B, 0x00006D5C, 0x00006D5D, 0x00006D5E, 0x00006D5F,
+    0x000006D6, 0x00006D61, 0x00006D62, 0x00006D63, 0x00006D64, 0x00006D65, 0x002006D7, 0x00006D67,
+    0x00006D68, 0x00006D69, 0x00006D6A, 0x00006D6B, 0x00006D6C, 0x00006D6D, 0x00006D6E, 0x00006D6F,
+    0x000006D7, 0x00006D71, 0x00006D72, 0x00006D73, 0x00006D74, 0x00006D75, 0x00006D76, 0x004006D8,
+    0x00006D78, 0x00006D79, 0x00006D7A, 0x00006D7B, 0x00006D7C, 0x00006D7D, 0x00006D7E, 0x00006D7F,
+    0x000006D8, 0x00006D81, 0x00006D82, 0x00006D83, 0x00006D84, 0x00006D85, 0x00006D86, 0x00006D87,
+    0x008006D9, 0x00006D89, 0x00006D8A, 0x00006D8B, 0x00006D8C, 0x00006D8D, 0x00006D8E, 0x00006D8F,
+    0x000006D9, 0x00006D91, 0x00006D92, 0x00006D93, 0x00006D94, 0x00006D95, 0x00006D96, 0x00006D97,
+    0x00006D98, 0x010006DA, 0x00006D9A, 0x00006D9B, 0x00006D9C, 0x00006D9D, 0x00006D9E, 0x00006D9F,
+    0x000006DA, 0x00006DA1, 0x00006DA2, 0x00006DA3, 0x00006DA4, 0x00006DA5, 0x00006DA6, 0x00006DA7,
+    0x00006DA8, 0x00006DA9, 0x820006DB, 0x00006DAB, 0x00006DAC, 0x00006DAD, 0x00006DAE, 0x00006DAF,
+    0x000006DB, 0x00006DB1, 0x00006DB2, 0x00006DB3, 0x00006DB4, 0x00006DB5, 0x00006DB6, 0x00006DB7,
+    0x00006DB8, 0x00006DB9, 0x00006DBA, 0x040006DC, 0x00006DBC, 0x00006DBD, 0x00006DBE, 0x00006DBF,
+    0x000006DC, 0x00006DC1, 0x00006DC2, 0x00006DC3, 0x00006DC4, 0x00006DC5, 0x00006DC6, 0x00006DC7,
+    0x00006DC8, 0x00006DC9, 0x00006DCA, 0x00006DCB, 0x080006DD, 0x00006DCD, 0x00006DCE, 0x00006DCF,
+    0x1000006E, 0x100006E1, 0x100006E2, 0x100006E3, 0x100006E4, 0x100006E5, 0x100006E6, 0x100006E7,
+    0x100006E8, 0x100006E9, 0x100006EA, 0x100006EB, 0x100006EC, 0x100006DE, 0x100006EE, 0x100006EF,
+    0x000006DE, 0x00006DE1, 0x00006DE2, 0x00006DE3, 0x00006DE4, 0x00006DE5, 0x00006DE6, 0x00006DE7,
+    0x00006DE8, 0x00006DE9, 0x00006DEA, 0x00006DEB, 0x00006DEC, 0x00006DED, 0x200006DF, 0x00006DEF,
+    0x000006DF, 0x00006DF1, 0x00006DF2, 0x00006DF3, 0x00006DF4, 0x00006DF5, 0x00006DF6, 0x00006DF7,
+    0x00006DF8, 0x00006DF9, 0x00006DFA, 0x00006DFB, 0x00006DFC, 0x00006DFD, 0x00006DFE, 0x00006DFF,
+    0x0000006E, 0x000006E1, 0x000006E2, 0x000006E3, 0x000006E4, 0x000006E5, 0x000006E6, 0x000006E7,
+    0x000006E8, 0x000006E9, 0x000006EA, 0x000006EB, 0x000006EC, 0x000006ED, 0x2000006F, 0x000006EF,
+    0x000006E1, 0x000106E2, 0x00006E12, 0x00006E13, 0x00006E14, 0x00006E15, 0x00006E16, 0x00006E17,
+    0x00006E18, 0x00006E19, 0x00006E1A, 0x00006E1B, 0x00006E1C, 0x00006E1D, 0x00006E1E, 0x00006E1F,
+    0x000006E2, 0x00006E21, 0x000206E3, 0x00006E23, 0x00006E24, 0x00006E25, 0x00006E26, 0x00006E27,
+    0x00006E28, 0x00006E29, 0x00006E2A, 0x00006E2B, 0x00006E2C, 0x00006E2D, 0x00006E2E, 0x00006E2F,
+    0x000006E3, 0x00006E31, 0x00006E32, 0x000406E4, 0x00006E34, 0x00006E35, 0x00006E36, 0x00006E37,
+    0x00006E38, 0x00006E39, 0x00006E3A, 0x00006E3B, 0x00006E3C, 0x00006E3D, 0x00006E3E, 0x00006E3F,
+    0x000006E4, 0x00006E41, 0x00006E42, 0x00006E43, 0x000806E5, 0x00006E45, 0x00006E46, 0x00006E47,
+    0x00006E48, 0x00006E49, 0x00006E4A, 0x00006E4B, 0x00006E4C, 0x00006E4D, 0x00006E4E, 0x00006E4F,
+    0x000006E5, 0x00006E51, 0x00006E52, 0x00006E53, 0x00006E54, 0x001006E6, 0x00006E56, 0x00006E57,
+    0x00006E58, 0x00006E59, 0x00006E5A, 0x00006E5B, 0x00006E5C, 0x00006E5D, 0x00006E5E, 0x00006E5F,
+    0x000006E6, 0x00006E61, 0x00006E62, 0x00006E63, 0x00006E64, 0x00006E65, 0x002006E7, 0x00006E67,
+    0x00006E68, 0x00006E69, 0x00006E6A, 0x00006E6B, 0x00006E6C, 0x00006E6D, 0x00006E6E, 0x00006E6F,
+    0x000006E7, 0x00006E71, 0x00006E72, 0x00006E73, 0x00006E74, 0x00006E75, 0x00006E76, 0x004006E8,
+    0x00006E78, 0x00006E79, 0x00006E7A, 0x00006E7B, 0x00006E7C, 0x00006E7D, 0x00006E7E, 0x00006E7F,
+    0x000006E8, 0x00006E81, 0x00006E82, 0x00006E83, 0x00006E84, 0x00006E85, 0x00006E86, 0x00006E87,
+    0x008006E9, 0x00006E89, 0x00006E8A, 0x00006E8B, 0x00006E8C, 0x00006E8D, 0x00006E8E, 0x00006E8F,
+    0x000006E9, 0x00006E91, 0x00006E92, 0x00006E93, 0x00006E94, 0x00006E95, 0x00006E96, 0x00006E97,
+    0x00006E98, 0x010006EA, 0x00006E9A, 0x00006E9B, 0x00006E9C, 0x00006E9D, 0x00006E9E, 0x00006E9F,
+    0x000006EA, 0x00006EA1, 0x00006EA2, 0x00006EA3, 0x00006EA4, 0x00006EA5, 0x00006EA6, 0x00006EA7,
+    0x00006EA8, 0x00006EA9, 0x820006EB, 0x00006EAB, 0x00006EAC, 0x00006EAD, 0x00006EAE, 0x00006EAF,
+    0x000006EB, 0x00006EB1, 0x00006EB2, 0x00006EB3, 0x00006EB4, 0x00006EB5, 0x00006EB6, 0x00006EB7,
+    0x00006EB8, 0x00006EB9, 0x00006EBA, 0x040006EC, 0x00006EBC, 0x00006EBD, 0x00006EBE, 0x00006EBF,
+    0x000006EC, 0x00006EC1, 0x00006EC2, 0x00006EC3, 0x00006EC4, 0x00006EC5, 0x00006EC6, 0x00006EC7,
+    0x00006EC8, 0x00006EC9, 0x00006ECA, 0x00006ECB, 0x080006ED, 0x00006ECD, 0x00006ECE, 0x00006ECF,
+    0x000006ED, 0x00006ED1, 0x00006ED2, 0x00006ED3, 0x00006ED4, 0x00006ED5, 0x00006ED6, 0x00006ED7,
+    0x00006ED8, 0x00006ED9, 0x00006EDA, 0x00006EDB, 0x00006EDC, 0x100006EE, 0x00006EDE, 0x00006EDF,
+    0x2000006F, 0x200006F1, 0x200006F2, 0x200006F3, 0x200006F4, 0x200006F5, 0x200006F6, 0x200006F7,
+    0x200006F8, 0x200006F9, 0x200006FA, 0x200006FB, 0x200006FC, 0x200006FD, 0x200006EF, 0x200006FF,
+    0x000006EF, 0x00006EF1, 0x00006EF2, 0x00006EF3, 0x00006EF4, 0x00006EF5, 0x00006EF6, 0x00006EF7,
+    0x00006EF8, 0x00006EF9, 0x00006EFA, 0x00006EFB, 0x00006EFC, 0x00006EFD, 0x00006EFE, 0x00006EFF,
+    0x0000006F, 0x000006F1, 0x000006F2, 0x000006F3, 0x000006F4, 0x000006F5, 0x000006F6, 0x000006F7,
+    0x000006F8, 0x000006F9, 0x000006FA, 0x000006FB, 0x000006FC, 0x000006FD, 0x000006FE, 0x000006FF,
+    0x000006F1, 0x000106F2, 0x00006F12, 0x00006F13, 0x00006F14, 0x00006F15, 0x00006F16, 0x00006F17,
+    0x00006F18, 0x00006F19, 0x00006F1A, 0x00006F1B, 0x00006F1C, 0x00006F1D, 0x00006F1E, 0x00006F1F,
+    0x000006F2, 0x00006F21, 0x000206F3, 0x00006F23, 0x00006F24, 0x00006F25, 0x00006F26, 0x00006F27,
+    0x00006F28, 0x00006F29, 0x00006F2A, 0x00006F2B, 0x00006F2C, 0x00006F2D, 0x00006F2E, 0x00006F2F,
+    0x000006F3, 0x00006F31, 0x00006F32, 0x000406F4, 0x00006F34, 0x00006F35, 0x00006F36, 0x00006F37,
+    0x00006F38, 0x00006F39, 0x00006F3A, 0x00006F3B, 0x00006F3C, 0x00006F3D, 0x00006F3E, 0x00006F3F,
+    0x000006F4, 0x00006F41, 0x00006F42, 0x00006F43, 0x000806F5, 0x00006F45, 0x00006F46, 0x00006F47,
+    0x00006F48, 0x00006F49, 0x00006F4A, 0x00006F4B, 0x00006F4C, 0x00006F4D, 0x00006F4E, 0x00006F4F,
+    0x000006F5, 0x00006F51, 0x00006F52, 0x00006F53, 0x00006F54, 0x001006F6, 0x00006F56, 0x00006F57,
+    0x00006F58, 0x00006F59, 0x00006F5A, 0x00006F5B, 0x00006F5C, 0x00006F5D, 0x00006F5E, 0x00006F5F,
+    0x000006F6, 0x00006F61, 0x00006F62, 0x00006F63, 0x00006F64, 0x00006F65, 0x002006F7, 0x00006F67,
+    0x00006F68, 0x00006F69, 0x00006F6A, 0x00006F6B, 0x00006F6C, 0x00006F6D, 0x00006F6E, 0x00006F6F,
+    0x000006F7, 0x00006F71, 0x00006F72, 0x00006F73, 0x00006F74, 0x00006F75, 0x00006F76, 0x004006F8,
+    0x00006F78, 0x00006F79, 0x00006F7A, 0x00006F7B, 0x00006F7C, 0x00006F7D, 0x00006F7E, 0x00006F7F,
+    0x000006F8, 0x00006F81, 0x00006F82, 0x00006F83, 0x00006F84, 0x00006F85, 0x00006F86, 0x00006F87,
+    0x008006F9, 0x00006F89, 0x00006F8A, 0x00006F8B, 0x00006F8C, 0x00006F8D, 0x00006F8E, 0x00006F8F,
+    0x000006F9, 0x00006F91, 0x00006F92, 0x00006F93, 0x00006F94, 0x00006F95, 0x00006F96, 0x00006F97,
+    0x00006F98, 0x010006FA, 0x00006F9A, 0x00006F9B, 0x00006F9C, 0x00006F9D, 0x00006F9E, 0x00006F9F,
+    0x000006FA, 0x00006FA1, 0x00006FA2, 0x00006FA3, 0x00006FA4, 0x00006FA5, 0x00006FA6, 0x00006FA7,
+    0x00006FA8, 0x00006FA9, 0x820006FB, 0x00006FAB, 0x00006FAC, 0x00006FAD, 0x00006FAE, 0x00006FAF,
+    0x000006FB, 0x00006FB1, 0x00006FB2, 0x00006FB3, 0x00006FB4, 0x00006FB5, 0x00006FB6, 0x00006FB7,
+    0x00006FB8, 0x00006FB9, 0x00006FBA, 0x040006FC, 0x00006FBC, 0x00006FBD, 0x00006FBE, 0x00006FBF,
+    0x000006FC, 0x00006FC1, 0x00006FC2, 0x00006FC3, 0x00006FC4, 0x00006FC5, 0x00006FC6, 0x00006FC7,
+    0x00006FC8, 0x00006FC9, 0x00006FCA, 0x00006FCB, 0x080006FD, 0x00006FCD, 0x00006FCE, 0x00006FCF,
+    0x000006FD, 0x00006FD1, 0x00006FD2, 0x00006FD3, 0x00006FD4, 0x00006FD5, 0x00006FD6, 0x00006FD7,
+    0x00006FD8, 0x00006FD9, 0x00006FDA, 0x00006FDB, 0x00006FDC, 0x100006FE, 0x00006FDE, 0x00006FDF,
+    0x000006FE, 0x00006FE1, 0x00006FE2, 0x00006FE3, 0x00006FE4, 0x00006FE5, 0x00006FE6, 0x00006FE7,
+    0x00006FE8, 0x00006FE9, 0x00006FEA, 0x00006FEB, 0x00006FEC, 0x00006FED, 0x200006FF, 0x00006FEF,
+    0x000006FF, 0x00006FF1, 0x00006FF2, 0x00006FF3, 0x00006FF4, 0x00006FF5, 0x00006FF6, 0x00006FF7,
+    0x00006FF8, 0x00006FF9, 0x00006FFA, 0x00006FFB, 0x00006FFC, 0x00006FFD, 0x00006FFE, 0x00006FFF,
+    0x00000007, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00400008,
+    0x00000078, 0x00000079, 0x0000007A, 0x0000007B, 0x0000007C, 0x0000007D, 0x0000007E, 0x0000007F,
+    0x00000071, 0x00010072, 0x00000712, 0x00000713, 0x00000714, 0x00000715, 0x00000716, 0x00000717,
+    0x00000718, 0x00000719, 0x0000071A, 0x0000071B, 0x0000071C, 0x0000071D, 0x0000071E, 0x0000071F,
+    0x00000072, 0x00000721, 0x00020073, 0x00000723, 0x00000724, 0x00000725, 0x00000726, 0x00000727,
+    0x00000728, 0x00000729, 0x0000072A, 0x0000072B, 0x0000072C, 0x0000072D, 0x0000072E, 0x0000072F,
+    0x00000073, 0x00000731, 0x00000732, 0x00040074, 0x00000734, 0x00000735, 0x00000736, 0x00000737,
+    0x00000738, 0x00000739, 0x0000073A, 0x0000073B, 0x0000073C, 0x0000073D, 0x0000073E, 0x0000073F,
+    0x00000074, 0x00000741, 0x00000742, 0x00000743, 0x00080075, 0x00000745, 0x00000746, 0x00000747,
+    0x00000748, 0x00000749, 0x0000074A, 0x0000074B, 0x0000074C, 0x0000074D, 0x0000074E, 0x0000074F,
+    0x00000075, 0x00000751, 0x00000752, 0x00000753, 0x00000754, 0x00100076, 0x00000756, 0x00000757,
+    0x00000758, 0x00000759, 0x0000075A, 0x0000075B, 0x0000075C, 0x0000075D, 0x0000075E, 0x0000075F,
+    0x00000076, 0x00000761, 0x00000762, 0x00000763, 0x00000764, 0x00000765, 0x00200077, 0x00000767,
+    0x00000768, 0x00000769, 0x0000076A, 0x0000076B, 0x0000076C, 0x0000076D, 0x0000076E, 0x0000076F,
+    0x00400008, 0x00400081, 0x00400082, 0x00400083, 0x00400084, 0x00400085, 0x00400086, 0x00400078,
+    0x00400088, 0x00400089, 0x0040008A, 0x0040008B, 0x0040008C, 0x0040008D, 0x0040008E, 0x0040008F,
+    0x00000078, 0x00000781, 0x00000782, 0x00000783, 0x00000784, 0x00000785, 0x00000786, 0x00000787,
+    0x00800079, 0x00000789, 0x0000078A, 0x0000078B, 0x0000078C, 0x0000078D, 0x0000078E, 0x0000078F,
+    0x00000079, 0x00000791, 0x00000792, 0x00000793, 0x00000794, 0x00000795, 0x00000796, 0x00000797,
+    0x00000798, 0x0100007A, 0x0000079A, 0x0000079B, 0x0000079C, 0x0000079D, 0x0000079E, 0x0000079F,
+    0x0000007A, 0x000007A1, 0x000007A2, 0x000007A3, 0x000007A4, 0x000007A5, 0x000007A6, 0x000007A7,
+    0x000007A8, 0x000007A9, 0x8200007B, 0x000007AB, 0x000007AC, 0x000007AD, 0x000007AE, 0x000007AF,
+    0x0000007B, 0x000007B1, 0x000007B2, 0x000007B3, 0x000007B4, 0x000007B5, 0x000007B6, 0x000007B7,
+    0x000007B8, 0x000007B9, 0x000007BA, 0x0400007C, 0x000007BC, 0x000007BD, 0x000007BE, 0x000007BF,
+    0x0000007C, 0x000007C1, 0x000007C2, 0x000007C3, 0x000007C4, 0x000007C5, 0x000007C6, 0x000007C7,
+    0x000007C8, 0x000007C9, 0x000007CA, 0x000007CB, 0x0800007D, 0x000007CD, 0x000007CE, 0x000007CF,
+    0x0000007D, 0x000007D1, 0x000007D2, 0x000007D3, 0x000007D4, 0x000007D5, 0x000007D6, 0x000007D7,
+    0x000007D8, 0x000007D9, 0x000007DA, 0x000007DB, 0x000007DC, 0x1000007E, 0x000007DE, 0x000007DF,
+    0x0000007E, 0x000007E1, 0x000007E2, 0x000007E3, 0x000007E4, 0x000007E5, 0x000007E6, 0x000007E7,
+    0x000007E8, 0x000007E9, 0x000007EA, 0x000007EB, 0x000007EC, 0x000007ED, 0x2000007F, 0x000007EF,
+    0x0000007F, 0x000007F1, 0x000007F2, 0x000007F3, 0x000007F4, 0x000007F5, 0x000007F6, 0x000007F7,
+    0x000007F8, 0x000007F9, 0x000007FA, 0x000007FB, 0x000007FC, 0x000007FD, 0x000007FE, 0x000007FF,
+    0x00000071, 0x00010072, 0x00000712, 0x00000713, 0x00000714, 0x00000715, 0x00000716, 0x00000717,
+    0x00000718, 0x00000719, 0x0000071A, 0x0000071B, 0x0000071C, 0x0000071D, 0x0000071E, 0x0000071F,
+    0x00010072, 0x00010712, 0x00010722, 0x00010723, 0x00010724, 0x00010725, 0x00010726, 0x00010727,
+    0x00010728, 0x00010729, 0x0001072A, 0x0001072B, 0x0001072C, 0x0001072D, 0x0001072E, 0x0001072F,
+    0x00000712, 0x00007121, 0x00020713, 0x00007123, 0x00007124, 0x00007125, 0x00007126, 0x00007127,
+    0x00007128, 0x00007129, 0x0000712A, 0x0000712B, 0x0000712C, 0x0000712D, 0x0000712E, 0x0000712F,
+    0x00000713, 0x00007131, 0x00007132, 0x00040714, 0x00007134, 0x00007135, 0x00007136, 0x00007137,
+    0x00007138, 0x00007139, 0x0000713A, 0x0000713B, 0x0000713C, 0x0000713D, 0x0000713E, 0x0000713F,
+    0x00000714, 0x00007141, 0x00007142, 0x00007143, 0x00080715, 0x00007145, 0x00007146, 0x00007147,
+    0x00007148, 0x00007149, 0x0000714A, 0x0000714B, 0x0000714C, 0x0000714D, 0x0000714E, 0x0000714F,
+    0x00000715, 0x00007151, 0x00007152, 0x00007153, 0x00007154, 0x00100716, 0x00007156, 0x00007157,
+    0x00007158, 0x00007159, 0x0000715A, 0x0000715B, 0x0000715C, 0x0000715D, 0x0000715E, 0x0000715F,
+    0x00000716, 0x00007161, 0x00007162, 0x00007163, 0x00007164, 0x00007165, 0x00200717, 0x00007167,
+    0x00007168, 0x00007169, 0x0000716A, 0x0000716B, 0x0000716C, 0x0000716D, 0x0000716E, 0x0000716F,
+    0x00000717, 0x00007171, 0x00007172, 0x00007173, 0x00007174, 0x00007175, 0x00007176, 0x00400718,
+    0x00007178, 0x00007179, 0x0000717A, 0x0000717B, 0x0000717C, 0x0000717D, 0x0000717E, 0x0000717F,
+    0x00000718, 0x00007181, 0x00007182, 0x00007183, 0x00007184, 0x00007185, 0x00007186, 0x00007187,
+    0x00800719, 0x00007189, 0x0000718A, 0x0000718B, 0x0000718C, 0x0000718D, 0x0000718E, 0x0000718F,
+    0x00000719, 0x00007191, 0x00007192, 0x00007193, 0x00007194, 0x00007195, 0x00007196, 0x00007197,
+    0x00007198, 0x0100071A, 0x0000719A, 0x0000719B, 0x0000719C, 0x0000719D, 0x0000719E, 0x0000719F,
+    0x0000071A, 0x000071A1, 0x000071A2, 0x000071A3, 0x000071A4, 0x000071A5, 0x000071A6, 0x000071A7,
+    0x000071A8, 0x000071A9, 0x8200071B, 0x000071AB, 0x000071AC, 0x000071AD, 0x000071AE, 0x000071AF,
+    0x0000071B, 0x000071B1, 0x000071B2, 0x000071B3, 0x000071B4, 0x000071B5, 0x000071B6, 0x000071B7,
+    0x000071B8, 0x000071B9, 0x000071BA, 0x0400071C, 0x000071BC, 0x000071BD, 0x000071BE, 0x000071BF,
+    0x0000071C, 0x000071C1, 0x000071C2, 0x000071C3, 0x000071C4, 0x000071C5, 0x000071C6, 0x000071C7,
+    0x000071C8, 0x000071C9, 0x000071CA, 0x000071CB, 0x0800071D, 0x000071CD, 0x000071CE, 0x000071CF,
+    0x0000071D, 0x000071D1, 0x000071D2, 0x000071D3, 0x000071D4, 0x000071D5, 0x000071D6, 0x000071D7,
+    0x000071D8, 0x000071D9, 0x000071DA, 0x000071DB, 0x000071DC, 0x1000071E, 0x000071DE, 0x000071DF,
+    0x0000071E, 0x000071E1, 0x000071E2, 0x000071E3, 0x000071E4, 0x000071E5, 0x000071E6, 0x000071E7,
+    0x000071E8, 0x000071E9, 0x000071EA, 0x000071EB, 0x000071EC, 0x000071ED, 0x2000071F, 0x000071EF,
+    0x0000071F, 0x000071F1, 0x000071F2, 0x000071F3, 0x000071F4, 0x000071F5, 0x000071F6, 0x000071F7,
+    0x000071F8, 0x000071F9, 0x000071FA, 0x000071FB, 0x000071FC, 0x000071FD, 0x000071FE, 0x000071FF,
+    0x00000072, 0x00000721, 0x00020073, 0x00000723, 0x00000724, 0x00000725, 0x00000726, 0x00000727,
+    0x00000728, 0x00000729, 0x0000072A, 0x0000072B, 0x0000072C, 0x0000072D, 0x0000072E, 0x0000072F,
+    0x00000721, 0x00010722, 0x00007212, 0x00007213, 0x00007214, 0x00007215, 0x00007216, 0x00007217,
+    0x00007218, 0x00007219, 0x0000721A, 0x0000721B, 0x0000721C, 0x0000721D, 0x0000721E, 0x0000721F,
+    0x00020073, 0x00020731, 0x00020723, 0x00020733, 0x00020734, 0x00020735, 0x00020736, 0x00020737,
+    0x00020738, 0x00020739, 0x0002073A, 0x0002073B, 0x0002073C, 0x0002073D, 0x0002073E, 0x0002073F,
+    0x00000723, 0x00007231, 0x00007232, 0x00040724, 0x00007234, 0x00007235, 0x00007236, 0x00007237,
+    0x00007238, 0x00007239, 0x0000723A, 0x0000723B, 0x0000723C, 0x0000723D, 0x0000723E, 0x0000723F,
+    0x00000724, 0x00007241, 0x00007242, 0x00007243, 0x00080725, 0x00007245, 0x00007246, 0x00007247,
+    0x00007248, 0x00007249, 0x0000724A, 0x0000724B, 0x0000724C, 0x0000724D, 0x0000724E, 0x0000724F,
+    0x00000725, 0x00007251, 0x00007252, 0x00007253, 0x00007254, 0x00100726, 0x00007256, 0x00007257,
+    0x00007258, 0x00007259, 0x0000725A, 0x0000725B, 0x0000725C, 0x0000725D, 0x0000725E, 0x0000725F,
+    0x00000726, 0x00007261, 0x00007262, 0x00007263, 0x00007264, 0x00007265, 0x00200727, 0x00007267,
+    0x00007268, 0x00007269, 0x0000726A, 0x0000726B, 0x0000726C, 0x0000726D, 0x0000726E, 0x0000726F,
+    0x00000727, 0x00007271, 0x00007272, 0x00007273, 0x00007274, 0x00007275, 0x00007276, 0x00400728,
+    0x00007278, 0x00007279, 0x0000727A, 0x0000727B, 0x0000727C, 0x0000727D, 0x0000727E, 0x0000727F,
+    0x00000728, 0x00007281, 0x00007282, 0x00007283, 0x00007284, 0x00007285, 0x00007286, 0x00007287,
+    0x00800729, 0x00007289, 0x0000728A, 0x0000728B, 0x0000728C, 0x0000728D, 0x0000728E, 0x0000728F,
+    0x00000729, 0x00007291, 0x00007292, 0x00007293, 0x00007294, 0x00007295, 0x00007296, 0x00007297,
+    0x00007298, 0x0100072A, 0x0000729A, 0x0000729B, 0x0000729C, 0x0000729D, 0x0000729E, 0x0000729F,
+    0x0000072A, 0x000072A1, 0x000072A2, 0x000072A3, 0x000072A4, 0x000072A5, 0x000072A6, 0x000072A7,
+    0x000072A8, 0x000072A9, 0x8200072B, 0x000072AB, 0x000072AC, 0x000072AD, 0x000072AE, 0x000072AF,
+    0x0000072B, 0x000072B1, 0x000072B2, 0x000072B3, 0x000072B4, 0x000072B5, 0x000072B6, 0x000072B7,
+    0x000072B8, 0x000072B9, 0x000072BA, 0x0400072C, 0x000072BC, 0x000072BD, 0x000072BE, 0x000072BF,
+    0x0000072C, 0x000072C1, 0x000072C2, 0x000072C3, 0x000072C4, 0x000072C5, 0x000072C6, 0x000072C7,
+    0x000072C8, 0x000072C9, 0x000072CA, 0x000072CB, 0x0800072D, 0x000072CD, 0x000072CE, 0x000072CF,
+    0x0000072D, 0x000072D1, 0x000072D2, 0x000072D3, 0x000072D4, 0x000072D5, 0x000072D6, 0x000072D7,
+    0x000072D8, 0x000072D9, 0x000072DA, 0x000072DB, 0x000072DC, 0x1000072E, 0x000072DE, 0x000072DF,
+    0x0000072E, 0x000072E1, 0x000072E2, 0x000072E3, 0x000072E4, 0x000072E5, 0x000072E6, 0x000072E7,
+    0x000072E8, 0x000072E9, 0x000072EA, 0x000072EB, 0x000072EC, 0x000072ED, 0x2000072F, 0x000072EF,
+    0x0000072F, 0x000072F1, 0x000072F2, 0x000072F3, 0x000072F4, 0x000072F5, 0x000072F6, 0x000072F7,
+    0x000072F8, 0x000072F9, 0x000072FA, 0x000072FB, 0x000072FC, 0x000072FD, 0x000072FE, 0x000072FF,
+    0x00000073, 0x00000731, 0x00000732, 0x00040074, 0x00000734, 0x00000735, 0x00000736, 0x00000737,
+    0x00000738, 0x00000739, 0x0000073A, 0x0000073B, 0x0000073C, 0x0000073D, 0x0000073E, 0x0000073F,
+    0x00000731, 0x00010732, 0x00007312, 0x00007313, 0x00007314, 0x00007315, 0x00007316, 0x00007317,
+    0x00007318, 0x00007319, 0x0000731A, 0x0000731B, 0x0000731C, 0x0000731D, 0x0000731E, 0x0000731F,
+    0x00000732, 0x00007321, 0x00020733, 0x00007323, 0x00007324, 0x00007325, 0x00007326, 0x00007327,
+    0x00007328, 0x00007329, 0x0000732A, 0x0000732B, 0x0000732C, 0x0000732D, 0x0000732E, 0x0000732F,
+    0x00040074, 0x00040741, 0x00040742, 0x00040734, 0x00040744, 0x00040745, 0x00040746, 0x00040747,
+    0x00040748, 0x00040749, 0x0004074A, 0x0004074B, 0x0004074C, 0x0004074D, 0x0004074E, 0x0004074F,
+    0x00000734, 0x00007341, 0x00007342, 0x00007343, 0x00080735, 0x00007345, 0x00007346, 0x00007347,
+    0x00007348, 0x00007349, 0x0000734A, 0x0000734B, 0x0000734C, 0x0000734D, 0x0000734E, 0x0000734F,
+    0x00000735, 0x00007351, 0x00007352, 0x00007353, 0x00007354, 0x00100736, 0x00007356, 0x00007357,
+    0x00007358, 0x00007359, 0x0000735A, 0x0000735B, 0x0000735C, 0x0000735D, 0x0000735E, 0x0000735F,
+    0x00000736, 0x00007361, 0x00007362, 0x00007363, 0x00007364, 0x00007365, 0x00200737, 0x00007367,
+    0x00007368, 0x00007369, 0x0000736A, 0x0000736B, 0x0000736C, 0x0000736D, 0x0000736E, 0x0000736F,
+    0x00000737, 0x00007371, 0x00007372, 0x00007373, 0x00007374, 0x00007375, 0x00007376, 0x00400738,
+    0x00007378, 0x00007379, 0x0000737A, 0x0000737B, 0x0000737C, 0x0000737D, 0x0000737E, 0x0000737F,
+    0x00000738, 0x00007381, 0x00007382, 0x00007383, 0x00007384, 0x00007385, 0x00007386, 0x00007387,
+    0x00800739, 0x00007389, 0x0000738A, 0x0000738B, 0x0000738C, 0x0000738D, 0x0000738E, 0x0000738F,
+    0x00000739, 0x00007391, 0x00007392, 0x00007393, 0x00007394, 0x00007395, 0x00007396, 0x00007397,
+    0x00007398, 0x0100073A, 0x0000739A, 0x0000739B, 0x0000739C, 0x0000739D, 0x0000739E, 0x0000739F,
+    0x0000073A, 0x000073A1, 0x000073A2, 0x000073A3, 0x000073A4, 0x000073A5, 0x000073A6, 0x000073A7,
+    0x000073A8, 0x000073A9, 0x8200073B, 0x000073AB, 0x000073AC, 0x000073AD, 0x000073AE, 0x000073AF,
+    0x0000073B, 0x000073B1, 0x000073B2, 0x000073B3, 0x000073B4, 0x000073B5, 0x000073B6, 0x000073B7,
+    0x000073B8, 0x000073B9, 0x000073BA, 0x0400073C, 0x000073BC, 0x000073BD, 0x000073BE, 0x000073BF,
+    0x0000073C, 0x000073C1, 0x000073C2, 0x000073C3, 0x000073C4, 0x000073C5, 0x000073C6, 0x000073C7,
+    0x000073C8, 0x000073C9, 0x000073CA, 0x000073CB, 0x0800073D, 0x000073CD, 0x000073CE, 0x000073CF,
+    0x0000073D, 0x000073D1, 0x000073D2, 0x000073D3, 0x000073D4, 0x000073D5, 0x000073D6, 0x000073D7,
+    0x000073D8, 0x000073D9, 0x000073DA, 0x000073DB, 0x000073DC, 0x1000073E, 0x000073DE, 0x000073DF,
+    0x0000073E, 0x000073E1, 0x000073E2, 0x000073E3, 0x000073E4, 0x000073E5, 0x000073E6, 0x000073E7,
+    0x000073E8, 0x000073E9, 0x000073EA, 0x000073EB, 0x000073EC, 0x000073ED, 0x2000073F, 0x000073EF,
+    0x0000073F, 0x000073F1, 0x000073F2, 0x000073F3, 0x000073F4, 0x000073F5, 0x000073F6, 0x000073F7,
+    0x000073F8, 0x000073F9, 0x000073FA, 0x000073FB, 0x000073FC, 0x000073FD, 0x000073FE, 0x000073FF,
+    0x00000074, 0x00000741, 0x00000742, 0x00000743, 0x00080075, 0x00000745, 0x00000746, 0x00000747,
+    0x00000748, 0x00000749, 0x0000074A, 0x0000074B, 0x0000074C, 0x0000074D, 0x0000074E, 0x0000074F,
+    0x00000741, 0x00010742, 0x00007412, 0x00007413, 0x00007414, 0x00007415, 0x00007416, 0x00007417,
+    0x00007418, 0x00007419, 0x0000741A, 0x0000741B, 0x0000741C, 0x0000741D, 0x0000741E, 0x0000741F,
+    0x00000742, 0x00007421, 0x00020743, 0x00007423, 0x00007424, 0x00007425, 0x00007426, 0x00007427,
+    0x00007428, 0x00007429, 0x0000742A, 0x0000742B, 0x0000742C, 0x0000742D, 0x0000742E, 0x0000742F,
+    0x00000743, 0x00007431, 0x00007432, 0x00040744, 0x00007434, 0x00007435, 0x00007436, 0x00007437,
+    0x00007438, 0x00007439, 0x0000743A, 0x0000743B, 0x0000743C, 0x0000743D, 0x0000743E, 0x0000743F,
+    0x00080075, 0x00080751, 0x00080752, 0x00080753, 0x00080745, 0x00080755, 0x00080756, 0x00080757,
+    0x00080758, 0x00080759, 0x0008075A, 0x0008075B, 0x0008075C, 0x0008075D, 0x0008075E, 0x0008075F,
+    0x00000745, 0x00007451, 0x00007452, 0x00007453, 0x00007454, 0x00100746, 0x00007456, 0x00007457,
+    0x00007458, 0x00007459, 0x0000745A, 0x0000745B, 0x0000745C, 0x0000745D, 0x0000745E, 0x0000745F,
+    0x00000746, 0x00007461, 0x00007462, 0x00007463, 0x00007464, 0x00007465, 0x00200747, 0x00007467,
+    0x00007468, 0x00007469, 0x0000746A, 0x0000746B, 0x0000746C, 0x0000746D, 0x0000746E, 0x0000746F,
+    0x00000747, 0x00007471, 0x00007472, 0x00007473, 0x00007474, 0x00007475, 0x00007476, 0x00400748,
+    0x00007478, 0x00007479, 0x0000747A, 0x0000747B, 0x0000747C, 0x0000747D, 0x0000747E, 0x0000747F,
+    0x00000748, 0x00007481, 0x00007482, 0x00007483, 0x00007484, 0x00007485, 0x00007486, 0x00007487,
+    0x00800749, 0x00007489, 0x0000748A, 0x0000748B, 0x0000748C, 0x0000748D, 0x0000748E, 0x0000748F,
+    0x00000749, 0x00007491, 0x00007492, 0x00007493, 0x00007494, 0x00007495, 0x00007496, 0x00007497,
+    0x00007498, 0x0100074A, 0x0000749A, 0x0000749B, 0x0000749C, 0x0000749D, 0x0000749E, 0x0000749F,
+    0x0000074A, 0x000074A1, 0x000074A2, 0x000074A3, 0x000074A4, 0x000074A5, 0x000074A6, 0x000074A7,
+    0x000074A8, 0x000074A9, 0x8200074B, 0x000074AB, 0x000074AC, 0x000074AD, 0x000074AE, 0x000074AF,
+    0x0000074B, 0x000074B1, 0x000074B2, 0x000074B3, 0x000074B4, 0x000074B5, 0x000074B6, 0x000074B7,
+    0x000074B8, 0x000074B9, 0x000074BA, 0x0400074C, 0x000074BC, 0x000074BD, 0x000074BE, 0x000074BF,
+    0x0000074C, 0x000074C1, 0x000074C2, 0x000074C3, 0x000074C4, 0x000074C5, 0x000074C6, 0x000074C7,
+    0x000074C8, 0x000074C9, 0x000074CA, 0x000074CB, 0x0800074D, 0x000074CD, 0x000074CE, 0x000074CF,
+    0x0000074D, 0x000074D1, 0x000074D2, 0x000074D3, 0x000074D4, 0x000074D5, 0x000074D6, 0x000074D7,
+    0x000074D8, 0x000074D9, 0x000074DA, 0x000074DB, 0x000074DC, 0x1000074E, 0x000074DE, 0x000074DF,
+    0x0000074E, 0x000074E1, 0x000074E2, 0x000074E3, 0x000074E4, 0x000074E5, 0x000074E6, 0x000074E7,
+    0x000074E8, 0x000074E9, 0x000074EA, 0x000074EB, 0x000074EC, 0x000074ED, 0x2000074F, 0x000074EF,
+    0x0000074F, 0x000074F1, 0x000074F2, 0x000074F3, 0x000074F4, 0x000074F5, 0x000074F6, 0x000074F7,
+    0x000074F8, 0x000074F9, 0x000074FA, 0x000074FB, 0x000074FC, 0x000074FD, 0x000074FE, 0x000074FF,
+    0x00000075, 0x00000751, 0x00000752, 0x00000753, 0x00000754, 0x00100076, 0x00000756, 0x00000757,
+    0x00000758, 0x00000759, 0x0000075A, 0x0000075B, 0x0000075C, 0x0000075D, 0x0000075E, 0x0000075F,
+    0x00000751, 0x00010752, 0x00007512, 0x00007513, 0x00007514, 0x00007515, 0x00007516, 0x00007517,
+    0x00007518, 0x00007519, 0x0000751A, 0x0000751B, 0x0000751C, 0x0000751D, 0x0000751E, 0x0000751F,
+    0x00000752, 0x00007521, 0x00020753, 0x00007523, 0x00007524, 0x00007525, 0x00007526, 0x00007527,
+    0x00007528, 0x00007529, 0x0000752A, 0x0000752B, 0x0000752C, 0x0000752D, 0x0000752E, 0x0000752F,
+    0x00000753, 0x00007531, 0x00007532, 0x00040754, 0x00007534, 0x00007535, 0x00007536, 0x00007537,
+    0x00007538, 0x00007539, 0x0000753A, 0x0000753B, 0x0000753C, 0x0000753D, 0x0000753E, 0x0000753F,
+    0x00000754, 0x00007541, 0x00007542, 0x00007543, 0x00080755, 0x00007545, 0x00007546, 0x00007547,
+    0x00007548, 0x00007549, 0x0000754A, 0x0000754B, 0x0000754C, 0x0000754D, 0x0000754E, 0x0000754F,
+    0x00100076, 0x00100761, 0x00100762, 0x00100763, 0x00100764, 0x00100756, 0x00100766, 0x00100767,
+    0x00100768, 0x00100769, 0x0010076A, 0x0010076B, 0x0010076C, 0x0010076D, 0x0010076E, 0x0010076F,
+    0x00000756, 0x00007561, 0x00007562, 0x00007563, 0x00007564, 0x00007565, 0x00200757, 0x00007567,
+    0x00007568, 0x00007569, 0x0000756A, 0x0000756B, 0x0000756C, 0x0000756D, 0x0000756E, 0x0000756F,
+    0x00000757, 0x00007571, 0x00007572, 0x00007573, 0x00007574, 0x00007575, 0x00007576, 0x00400758,
+    0x00007578, 0x00007579, 0x0000757A, 0x0000757B, 0x0000757C, 0x0000757D, 0x0000757E, 0x0000757F,
+    0x00000758, 0x00007581, 0x00007582, 0x00007583, 0x00007584, 0x00007585, 0x00007586, 0x00007587,
+    0x00800759, 0x00007589, 0x0000758A, 0x0000758B, 0x0000758C, 0x0000758D, 0x0000758E, 0x0000758F,
+    0x00000759, 0x00007591, 0x00007592, 0x00007593, 0x00007594, 0x00007595, 0x00007596, 0x00007597,
+    0x00007598, 0x0100075A, 0x0000759A, 0x0000759B, 0x0000759C, 0x0000759D, 0x0000759E, 0x0000759F,
+    0x0000075A, 0x000075A1, 0x000075A2, 0x000075A3, 0x000075A4, 0x000075A5, 0x000075A6, 0x000075A7,
+    0x000075A8, 0x000075A9, 0x8200075B, 0x000075AB, 0x000075AC, 0x000075AD, 0x000075AE, 0x000075AF,
+    0x0000075B, 0x000075B1, 0x000075B2, 0x000075B3, 0x000075B4, 0x000075B5, 0x000075B6, 0x000075B7,
+    0x000075B8, 0x000075B9, 0x000075BA, 0x0400075C, 0x000075BC, 0x000075BD, 0x000075BE, 0x000075BF,
+    0x0000075C, 0x000075C1, 0x000075C2, 0x000075C3, 0x000075C4, 0x000075C5, 0x000075C6, 0x000075C7,
+    0x000075C8, 0x000075C9, 0x000075CA, 0x000075CB, 0x0800075D, 0x000075CD, 0x000075CE, 0x000075CF,
+    0x0000075D, 0x000075D1, 0x000075D2, 0x000075D3, 0x000075D4, 0x000075D5, 0x000075D6, 0x000075D7,
+    0x000075D8, 0x000075D9, 0x000075DA, 0x000075DB, 0x000075DC, 0x1000075E, 0x000075DE, 0x000075DF,
+    0x0000075E, 0x000075E1, 0x000075E2, 0x000075E3, 0x000075E4, 0x000075E5, 0x000075E6, 0x000075E7,
+    0x000075E8, 0x000075E9, 0x000075EA, 0x000075EB, 0x000075EC, 0x000075ED, 0x2000075F, 0x000075EF,
+    0x0000075F, 0x000075F1, 0x000075F2, 0x000075F3, 0x000075F4, 0x000075F5, 0x000075F6, 0x000075F7,
+    0x000075F8, 0x000075F9, 0x000075FA, 0x000075FB, 0x000075FC, 0x000075FD, 0x000075FE, 0x000075FF,
+    0x00000076, 0x00000761, 0x00000762, 0x00000763, 0x00000764, 0x00000765, 0x00200077, 0x00000767,
+    0x00000768, 0x00000769, 0x0000076A, 0x0000076B, 0x0000076C, 0x0000076D, 0x0000076E, 0x0000076F,
+    0x00000761, 0x00010762, 0x00007612, 0x00007613, 0x00007614, 0x00007615, 0x00007616, 0x00007617,
+    0x00007618, 0x00007619, 0x0000761A, 0x0000761B, 0x0000761C, 0x0000761D, 0x0000761E, 0x0000761F,
+    0x00000762, 0x00007621, 0x00020763, 0x00007623, 0x00007624, 0x00007625, 0x00007626, 0x00007627,
+    0x00007628, 0x00007629, 0x0000762A, 0x0000762B, 0x0000762C, 0x0000762D, 0x0000762E, 0x0000762F,
+    0x00000763, 0x00007631, 0x00007632, 0x00040764, 0x00007634, 0x00007635, 0x00007636, 0x00007637,
+    0x00007638, 0x00007639, 0x0000763A, 0x0000763B, 0x0000763C, 0x0000763D, 0x0000763E, 0x0000763F,
+    0x00000764, 0x00007641, 0x00007642, 0x00007643, 0x00080765, 0x00007645, 0x00007646, 0x00007647,
+    0x00007648, 0x00007649, 0x0000764A, 0x0000764B, 0x0000764C, 0x0000764D, 0x0000764E, 0x0000764F,
+    0x00000765, 0x00007651, 0x00007652, 0x00007653, 0x00007654, 0x00100766, 0x00007656, 0x00007657,
+    0x00007658, 0x00007659, 0x0000765A, 0x0000765B, 0x0000765C, 0x0000765D, 0x0000765E, 0x0000765F,
+    0x00200077, 0x00200771, 0x00200772, 0x00200773, 0x00200774, 0x00200775, 0x00200767, 0x00200777,
+    0x00200778, 0x00200779, 0x0020077A, 0x0020077B, 0x0020077C, 0x0020077D, 0x0020077E, 0x0020077F,
+    0x00000767, 0x00007671, 0x00007672, 0x00007673, 0x00007674, 0x00007675, 0x00007676, 0x00400768,
+    0x00007678, 0x00007679, 0x0000767A, 0x0000767B, 0x0000767C, 0x0000767D, 0x0000767E, 0x0000767F,
+    0x00000768, 0x00007681, 0x00007682, 0x00007683, 0x00007684, 0x00007685, 0x00007686, 0x00007687,
+    0x00800769, 0x00007689, 0x0000768A, 0x0000768B, 0x0000768C, 0x0000768D, 0x0000768E, 0x0000768F,
+    0x00000769, 0x00007691, 0x00007692, 0x00007693, 0x00007694, 0x00007695, 0x00007696, 0x00007697,
+    0x00007698, 0x0100076A, 0x0000769A, 0x0000769B, 0x0000769C, 0x0000769D, 0x0000769E, 0x0000769F,
+    0x0000076A, 0x000076A1, 0x000076A2, 0x000076A3, 0x000076A4, 0x000076A5, 0x000076A6, 0x000076A7,
+    0x000076A8, 0x000076A9, 0x8200076B, 0x000076AB, 0x000076AC, 0x000076AD, 0x000076AE, 0x000076AF,
+    0x0000076B, 0x000076B1, 0x000076B2, 0x000076B3, 0x000076B4, 0x000076B5, 0x000076B6, 0x000076B7,
+    0x000076B8, 0x000076B9, 0x000076BA, 0x0400076C, 0x000076BC, 0x000076BD, 0x000076BE, 0x000076BF,
+    0x0000076C, 0x000076C1, 0x000076C2, 0x000076C3, 0x000076C4, 0x000076C5, 0x000076C6, 0x000076C7,
+    0x000076C8, 0x000076C9, 0x000076CA, 0x000076CB, 0x0800076D, 0x000076CD, 0x000076CE, 0x000076CF,
+    0x0000076D, 0x000076D1, 0x000076D2, 0x000076D3, 0x000076D4, 0x000076D5, 0x000076D6, 0x000076D7,
+    0x000076D8, 0x000076D9, 0x000076DA, 0x000076DB, 0x000076DC, 0x1000076E, 0x000076DE, 0x000076DF,
+    0x0000076E, 0x000076E1, 0x000076E2, 0x000076E3, 0x000076E4, 0x000076E5, 0x000076E6, 0x000076E7,
+    0x000076E8, 0x000076E9, 0x000076EA, 0x000076EB, 0x000076EC, 0x000076ED, 0x2000076F, 0x000076EF,
+    0x0000076F, 0x000076F1, 0x000076F2, 0x000076F3, 0x000076F4, 0x000076F5, 0x000076F6, 0x000076F7,
+    0x000076F8, 0x000076F9, 0x000076FA, 0x000076FB, 0x000076FC, 0x000076FD, 0x000076FE, 0x000076FF,
+    0x00400008, 0x00400081, 0x00400082, 0x00400083, 0x00400084, 0x00400085, 0x00400086, 0x00400078,
+    0x00400088, 0x00400089, 0x0040008A, 0x0040008B, 0x0040008C, 0x0040008D, 0x0040008E, 0x0040008F,
+    0x00400081, 0x00410082, 0x00400812, 0x00400813, 0x00400814, 0x00400815, 0x00400816, 0x00400817,
+    0x00400818, 0x00400819, 0x0040081A, 0x0040081B, 0x0040081C, 0x0040081D, 0x0040081E, 0x0040081F,
+    0x00400082, 0x00400821, 0x00420083, 0x00400823, 0x00400824, 0x00400825, 0x00400826, 0x00400827,
+    0x00400828, 0x00400829, 0x0040082A, 0x0040082B, 0x0040082C, 0x0040082D, 0x0040082E, 0x0040082F,
+    0x00400083, 0x00400831, 0x00400832, 0x00440084, 0x00400834, 0x00400835, 0x00400836, 0x00400837,
+    0x00400838, 0x00400839, 0x0040083A, 0x0040083B, 0x0040083C, 0x0040083D, 0x0040083E, 0x0040083F,
+    0x00400084, 0x00400841, 0x00400842, 0x00400843, 0x00480085, 0x00400845, 0x00400846, 0x00400847,
+    0x00400848, 0x00400849, 0x0040084A, 0x0040084B, 0x0040084C, 0x0040084D, 0x0040084E, 0x0040084F,
+    0x00400085, 0x00400851, 0x00400852, 0x00400853, 0x00400854, 0x00500086, 0x00400856, 0x00400857,
+    0x00400858, 0x00400859, 0x0040085A, 0x0040085B, 0x0040085C, 0x0040085D, 0x0040085E, 0x0040085F,
+    0x00400086, 0x00400861, 0x00400862, 0x00400863, 0x00400864, 0x00400865, 0x00600087, 0x00400867,
+    0x00400868, 0x00400869, 0x0040086A, 0x0040086B, 0x0040086C, 0x0040086D, 0x0040086E, 0x0040086F,
+    0x00400078, 0x00400781, 0x00400782, 0x00400783, 0x00400784, 0x00400785, 0x00400786, 0x00800088,
+    0x00400788, 0x00400789, 0x0040078A, 0x0040078B, 0x0040078C, 0x0040078D, 0x0040078E, 0x0040078F,
+    0x00400088, 0x00400881, 0x00400882, 0x00400883, 0x00400884, 0x00400885, 0x00400886, 0x00400887,
+    0x00C00089, 0x00400889, 0x0040088A, 0x0040088B, 0x0040088C, 0x0040088D, 0x0040088E, 0x0040088F,
+    0x00400089, 0x00400891, 0x00400892, 0x00400893, 0x00400894, 0x00400895, 0x00400896, 0x00400897,
+    0x00400898, 0x0140008A, 0x0040089A, 0x0040089B, 0x0040089C, 0x0040089D, 0x0040089E, 0x0040089F,
+    0x0040008A, 0x004008A1, 0x004008A2, 0x004008A3, 0x004008A4, 0x004008A5, 0x004008A6, 0x004008A7,
+    0x004008A8, 0x004008A9, 0x8240008B, 0x004008AB, 0x004008AC, 0x004008AD, 0x004008AE, 0x004008AF,
+    0x0040008B, 0x004008B1, 0x004008B2, 0x004008B3, 0x004008B4, 0x004008B5, 0x004008B6, 0x004008B7,
+    0x004008B8, 0x004008B9, 0x004008BA, 0x0440008C, 0x004008BC, 0x004008BD, 0x004008BE, 0x004008BF,
+    0x0040008C, 0x004008C1, 0x004008C2, 0x004008C3, 0x004008C4, 0x004008C5, 0x004008C6, 0x004008C7,
+    0x004008C8, 0x004008C9, 0x004008CA, 0x004008CB, 0x0840008D, 0x004008CD, 0x004008CE, 0x004008CF,
+    0x0040008D, 0x004008D1, 0x004008D2, 0x004008D3, 0x004008D4, 0x004008D5, 0x004008D6, 0x004008D7,
+    0x004008D8, 0x004008D9, 0x004008DA, 0x004008DB, 0x004008DC, 0x1040008E, 0x004008DE, 0x004008DF,
+    0x0040008E, 0x004008E1, 0x004008E2, 0x004008E3, 0x004008E4, 0x004008E5, 0x004008E6, 0x004008E7,
+    0x004008E8, 0x004008E9, 0x004008EA, 0x004008EB, 0x004008EC, 0x004008ED, 0x2040008F, 0x004008EF,
+    0x0040008F, 0x004008F1, 0x004008F2, 0x004008F3, 0x004008F4, 0x004008F5, 0x004008F6, 0x004008F7,
+    0x004008F8, 0x004008F9, 0x004008FA, 0x004008FB, 0x004008FC, 0x004008FD, 0x004008FE, 0x004008FF,
+    0x00000078, 0x00000781, 0x00000782, 0x00000783, 0x00000784, 0x00000785, 0x00000786, 0x00000787,
+    0x00800079, 0x00000789, 0x0000078A, 0x0000078B, 0x0000078C, 0x0000078D, 0x0000078E, 0x0000078F,
+    0x00000781, 0x00010782, 0x00007812, 0x00007813, 0x00007814, 0x00007815, 0x00007816, 0x00007817,
+    0x00007818, 0x00007819, 0x0000781A, 0x0000781B, 0x0000781C, 0x0000781D, 0x0000781E, 0x0000781F,
+    0x00000782, 0x00007821, 0x00020783, 0x00007823, 0x00007824, 0x00007825, 0x00007826, 0x00007827,
+    0x00007828, 0x00007829, 0x0000782A, 0x0000782B, 0x0000782C, 0x0000782D, 0x0000782E, 0x0000782F,
+    0x00000783, 0x00007831, 0x00007832, 0x00040784, 0x00007834, 0x00007835, 0x00007836, 0x00007837,
+    0x00007838, 0x00007839, 0x0000783A, 0x0000783B, 0x0000783C, 0x0000783D, 0x0000783E, 0x0000783F,
+    0x00000784, 0x00007841, 0x00007842, 0x00007843, 0x00080785, 0x00007845, 0x00007846, 0x00007847,
+    0x00007848, 0x00007849, 0x0000784A, 0x0000784B, 0x0000784C, 0x0000784D, 0x0000784E, 0x0000784F,
+    0x00000785, 0x00007851, 0x00007852, 0x00007853, 0x00007854, 0x00100786, 0x00007856, 0x00007857,
+    0x00007858, 0x00007859, 0x0000785A, 0x0000785B, 0x0000785C, 0x0000785D, 0x0000785E, 0x0000785F,
+    0x00000786, 0x00007861, 0x00007862, 0x00007863, 0x00007864, 0x00007865, 0x00200787, 0x00007867,
+    0x00007868, 0x00007869, 0x0000786A, 0x0000786B, 0x0000786C, 0x0000786D, 0x0000786E, 0x0000786F,
+    0x00000787, 0x00007871, 0x00007872, 0x00007873, 0x00007874, 0x00007875, 0x00007876, 0x00400788,
+    0x00007878, 0x00007879, 0x0000787A, 0x0000787B, 0x0000787C, 0x0000787D, 0x0000787E, 0x0000787F,
+    0x00800079, 0x00800791, 0x00800792, 0x00800793, 0x00800794, 0x00800795, 0x00800796, 0x00800797,
+    0x00800789, 0x00800799, 0x0080079A, 0x0080079B, 0x0080079C, 0x0080079D, 0x0080079E, 0x0080079F,
+    0x00000789, 0x00007891, 0x00007892, 0x00007893, 0x00007894, 0x00007895, 0x00007896, 0x00007897,
+    0x00007898, 0x0100078A, 0x0000789A, 0x0000789B, 0x0000789C, 0x0000789D, 0x0000789E, 0x0000789F,
+    0x0000078A, 0x000078A1, 0x000078A2, 0x000078A3, 0x000078A4, 0x000078A5, 0x000078A6, 0x000078A7,
+    0x000078A8, 0x000078A9, 0x8200078B, 0x000078AB, 0x000078AC, 0x000078AD, 0x000078AE, 0x000078AF,
+    0x0000078B, 0x000078B1, 0x000078B2, 0x000078B3, 0x000078B4, 0x000078B5, 0x000078B6, 0x000078B7,
+    0x000078B8, 0x000078B9, 0x000078BA, 0x0400078C, 0x000078BC, 0x000078BD, 0x000078BE, 0x000078BF,
+    0x0000078C, 0x000078C1, 0x000078C2, 0x000078C3, 0x000078C4, 0x000078C5, 0x000078C6, 0x000078C7,
+    0x000078C8, 0x000078C9, 0x000078CA, 0x000078CB, 0x0800078D, 0x000078CD, 0x000078CE, 0x000078CF,
+    0x0000078D, 0x000078D1, 0x000078D2, 0x000078D3, 0x000078D4, 0x000078D5, 0x000078D6, 0x000078D7,
+    0x000078D8, 0x000078D9, 0x000078DA, 0x000078DB, 0x000078DC, 0x1000078E, 0x000078DE, 0x000078DF,
+    0x0000078E, 0x000078E1, 0x000078E2, 0x000078E3, 0x000078E4, 0x000078E5, 0x000078E6, 0x000078E7,
+    0x000078E8, 0x000078E9, 0x000078EA, 0x000078EB, 0x000078EC, 0x000078ED, 0x2000078F, 0x000078EF,
+    0x0000078F, 0x000078F1, 0x000078F2, 0x000078F3, 0x000078F4, 0x000078F5, 0x000078F6, 0x000078F7,
+    0x000078F8, 0x000078F9, 0x000078FA, 0x000078FB, 0x000078FC, 0x000078FD, 0x000078FE, 0x000078FF,
+    0x00000079, 0x00000791, 0x00000792, 0x00000793, 0x00000794, 0x00000795, 0x00000796, 0x00000797,
+    0x00000798, 0x0100007A, 0x0000079A, 0x0000079B, 0x0000079C, 0x0000079D, 0x0000079E, 0x0000079F,
+    0x00000791, 0x00010792, 0x00007912, 0x00007913, 0x00007914, 0x00007915, 0x00007916, 0x00007917,
+    0x00007918, 0x00007919, 0x0000791A, 0x0000791B, 0x0000791C, 0x0000791D, 0x0000791E, 0x0000791F,
+    0x00000792, 0x00007921, 0x00020793, 0x00007923, 0x00007924, 0x00007925, 0x00007926, 0x00007927,
+    0x00007928, 0x00007929, 0x0000792A, 0x0000792B, 0x0000792C, 0x0000792D, 0x0000792E, 0x0000792F,
+    0x00000793, 0x00007931, 0x00007932, 0x00040794, 0x00007934, 0x00007935, 0x00007936, 0x00007937,
+    0x00007938, 0x00007939, 0x0000793A, 0x0000793B, 0x0000793C, 0x0000793D, 0x0000793E, 0x0000793F,
+    0x00000794, 0x00007941, 0x00007942, 0x00007943, 0x00080795, 0x00007945, 0x00007946, 0x00007947,
+    0x00007948, 0x00007949, 0x0000794A, 0x0000794B, 0x0000794C, 0x0000794D, 0x0000794E, 0x0000794F,
+    0x00000795, 0x00007951, 0x00007952, 0x00007953, 0x00007954, 0x00100796, 0x00007956, 0x00007957,
+    0x00007958, 0x00007959, 0x0000795A, 0x0000795B, 0x0000795C, 0x0000795D, 0x0000795E, 0x0000795F,
+    0x00000796, 0x00007961, 0x00007962, 0x00007963, 0x00007964, 0x00007965, 0x00200797, 0x00007967,
+    0x00007968, 0x00007969, 0x0000796A, 0x0000796B, 0x0000796C, 0x0000796D, 0x0000796E, 0x0000796F,
+    0x00000797, 0x00007971, 0x00007972, 0x00007973, 0x00007974, 0x00007975, 0x00007976, 0x00400798,
+    0x00007978, 0x00007979, 0x0000797A, 0x0000797B, 0x0000797C, 0x0000797D, 0x0000797E, 0x0000797F,
+    0x00000798, 0x00007981, 0x00007982, 0x00007983, 0x00007984, 0x00007985, 0x00007986, 0x00007987,
+    0x00800799, 0x00007989, 0x0000798A, 0x0000798B, 0x0000798C, 0x0000798D, 0x0000798E, 0x0000798F,
+    0x0100007A, 0x010007A1, 0x010007A2, 0x010007A3, 0x010007A4, 0x010007A5, 0x010007A6, 0x010007A7,
+    0x010007A8, 0x0100079A, 0x010007AA, 0x010007AB, 0x010007AC, 0x010007AD, 0x010007AE, 0x010007AF,
+    0x0000079A, 0x000079A1, 0x000079A2, 0x000079A3, 0x000079A4, 0x000079A5, 0x000079A6, 0x000079A7,
+    0x000079A8, 0x000079A9, 0x8200079B, 0x000079AB, 0x000079AC, 0x000079AD, 0x000079AE, 0x000079AF,
+    0x0000079B, 0x000079B1, 0x000079B2, 0x000079B3, 0x000079B4, 0x000079B5, 0x000079B6, 0x000079B7,
+    0x000079B8, 0x000079B9, 0x000079BA, 0x0400079C, 0x000079BC, 0x000079BD, 0x000079BE, 0x000079BF,
+    0x0000079C, 0x000079C1, 0x000079C2, 0x000079C3, 0x000079C4, 0x000079C5, 0x000079C6, 0x000079C7,
+    0x000079C8, 0x000079C9, 0x000079CA, 0x000079CB, 0x0800079D, 0x000079CD, 0x000079CE, 0x000079CF,
+    0x0000079D, 0x000079D1, 0x000079D2, 0x000079D3, 0x000079D4, 0x000079D5, 0x000079D6, 0x000079D7,
+    0x000079D8, 0x000079D9, 0x000079DA, 0x000079DB, 0x000079DC, 0x1000079E, 0x000079DE, 0x000079DF,
+    0x0000079E, 0x000079E1, 0x000079E2, 0x000079E3, 0x000079E4, 0x000079E5, 0x000079E6, 0x000079E7,
+    0x000079E8, 0x000079E9, 0x000079EA, 0x000079EB, 0x000079EC, 0x000079ED, 0x2000079F, 0x000079EF,
+    0x0000079F, 0x000079F1, 0x000079F2, 0x000079F3, 0x000079F4, 0x000079F5, 0x000079F6, 0x000079F7,
+    0x000079F8, 0x000079F9, 0x000079FA, 0x000079FB, 0x000079FC, 0x000079FD, 0x000079FE, 0x000079FF,
+    0x0000007A, 0x000007A1, 0x000007A2, 0x000007A3, 0x000007A4, 0x000007A5, 0x000007A6, 0x000007A7,
+    0x000007A8, 0x000007A9, 0x8200007B, 0x000007AB, 0x000007AC, 0x000007AD, 0x000007AE, 0x000007AF,
+    0x000007A1, 0x000107A2, 0x00007A12, 0x00007A13, 0x00007A14, 0x00007A15, 0x00007A16, 0x00007A17,
+    0x00007A18, 0x00007A19, 0x00007A1A, 0x00007A1B, 0x00007A1C, 0x00007A1D, 0x00007A1E, 0x00007A1F,
+    0x000007A2, 0x00007A21, 0x000207A3, 0x00007A23, 0x00007A24, 0x00007A25, 0x00007A26, 0x00007A27,
+    0x00007A28, 0x00007A29, 0x00007A2A, 0x00007A2B, 0x00007A2C, 0x00007A2D, 0x00007A2E, 0x00007A2F,
+    0x000007A3, 0x00007A31, 0x00007A32, 0x000407A4, 0x00007A34, 0x00007A35, 0x00007A36, 0x00007A37,
+    0x00007A38, 0x00007A39, 0x00007A3A, 0x00007A3B, 0x00007A3C, 0x00007A3D, 0x00007A3E, 0x00007A3F,
+    0x000007A4, 0x00007A41, 0x00007A42, 0x00007A43, 0x000807A5, 0x00007A45, 0x00007A46, 0x00007A47,
+    0x00007A48, 0x00007A49, 0x00007A4A, 0x00007A4B, 0x00007A4C, 0x00007A4D, 0x00007A4E, 0x00007A4F,
+    0x000007A5, 0x00007A51, 0x00007A52, 0x00007A53, 0x00007A54, 0x001007A6, 0x00007A56, 0x00007A57,
+    0x00007A58, 0x00007A59, 0x00007A5A, 0x00007A5B, 0x00007A5C, 0x00007A5D, 0x00007A5E, 0x00007A5F,
+    0x000007A6, 0x00007A61, 0x00007A62, 0x00007A63, 0x00007A64, 0x00007A65, 0x002007A7, 0x00007A67,
+    0x00007A68, 0x00007A69, 0x00007A6A, 0x00007A6B, 0x00007A6C, 0x00007A6D, 0x00007A6E, 0x00007A6F,
+    0x000007A7, 0x00007A71, 0x00007A72, 0x00007A73, 0x00007A74, 0x00007A75, 0x00007A76, 0x004007A8,
+    0x00007A78, 0x00007A79, 0x00007A7A, 0x00007A7B, 0x00007A7C, 0x00007A7D, 0x00007A7E, 0x00007A7F,
+    0x000007A8, 0x00007A81, 0x00007A82, 0x00007A83, 0x00007A84, 0x00007A85, 0x00007A86, 0x00007A87,
+    0x008007A9, 0x00007A89, 0x00007A8A, 0x00007A8B, 0x00007A8C, 0x00007A8D, 0x00007A8E, 0x00007A8F,
+    0x000007A9, 0x00007A91, 0x00007A92, 0x00007A93, 0x00007A94, 0x00007A95, 0x00007A96, 0x00007A97,
+    0x00007A98, 0x010007AA, 0x00007A9A, 0x00007A9B, 0x00007A9C, 0x00007A9D, 0x00007A9E, 0x00007A9F,
+    0x8200007B, 0x820007B1, 0x820007B2, 0x820007B3, 0x820007B4, 0x820007B5, 0x820007B6, 0x820007B7,
+    0x820007B8, 0x820007B9, 0x820007AB, 0x820007BB, 0x820007BC, 0x820007BD, 0x820007BE, 0x820007BF,
+    0x000007AB, 0x00007AB1, 0x00007AB2, 0x00007AB3, 0x00007AB4, 0x00007AB5, 0x00007AB6, 0x00007AB7,
+    0x00007AB8, 0x00007AB9, 0x00007ABA, 0x040007AC, 0x00007ABC, 0x00007ABD, 0x00007ABE, 0x00007ABF,
+    0x000007AC, 0x00007AC1, 0x00007AC2, 0x00007AC3, 0x00007AC4, 0x00007AC5, 0x00007AC6, 0x00007AC7,
+    0x00007AC8, 0x00007AC9, 0x00007ACA, 0x00007ACB, 0x080007AD, 0x00007ACD, 0x00007ACE, 0x00007ACF,
+    0x000007AD, 0x00007AD1, 0x00007AD2, 0x00007AD3, 0x00007AD4, 0x00007AD5, 0x00007AD6, 0x00007AD7,
+    0x00007AD8, 0x00007AD9, 0x00007ADA, 0x00007ADB, 0x00007ADC, 0x100007AE, 0x00007ADE, 0x00007ADF,
+    0x000007AE, 0x00007AE1, 0x00007AE2, 0x00007AE3, 0x00007AE4, 0x00007AE5, 0x00007AE6, 0x00007AE7,
+    0x00007AE8, 0x00007AE9, 0x00007AEA, 0x00007AEB, 0x00007AEC, 0x00007AED, 0x200007AF, 0x00007AEF,
+    0x000007AF, 0x00007AF1, 0x00007AF2, 0x00007AF3, 0x00007AF4, 0x00007AF5, 0x00007AF6, 0x00007AF7,
+    0x00007AF8, 0x00007AF9, 0x00007AFA, 0x00007AFB, 0x00007AFC, 0x00007AFD, 0x00007AFE, 0x00007AFF,
+    0x0000007B, 0x000007B1, 0x000007B2, 0x000007B3, 0x000007B4, 0x000007B5, 0x000007B6, 0x000007B7,
+    0x000007B8, 0x000007B9, 0x000007BA, 0x0400007C, 0x000007BC, 0x000007BD, 0x000007BE, 0x000007BF,
+    0x000007B1, 0x000107B2, 0x00007B12, 0x00007B13, 0x00007B14, 0x00007B15, 0x00007B16, 0x00007B17,
+    0x00007B18, 0x00007B19, 0x00007B1A, 0x00007B1B, 0x00007B1C, 0x00007B1D, 0x00007B1E, 0x00007B1F,
+    0x000007B2, 0x00007B21, 0x000207B3, 0x00007B23, 0x00007B24, 0x00007B25, 0x00007B26, 0x00007B27,
+    0x00007B28, 0x00007B29, 0x00007B2A, 0x00007B2B, 0x00007B2C, 0x00007B2D, 0x00007B2E, 0x00007B2F,
+    0x000007B3, 0x00007B31, 0x00007B32, 0x000407B4, 0x00007B34, 0x00007B35, 0x00007B36, 0x00007B37,
+    0x00007B38, 0x00007B39, 0x00007B3A, 0x00007B3B, 0x00007B3C, 0x00007B3D, 0x00007B3E, 0x00007B3F,
+    0x000007B4, 0x00007B41, 0x00007B42, 0x00007B43, 0x000807B5, 0x00007B45, 0x00007B46, 0x00007B47,
+    0x00007B48, 0x00007B49, 0x00007B4A, 0x00007B4B, 0x00007B4C, 0x00007B4D, 0x00007B4E, 0x00007B4F,
+    0x000007B5, 0x00007B51, 0x00007B52, 0x00007B53, 0x00007B54, 0x001007B6, 0x00007B56, 0x00007B57,
+    0x00007B58, 0x00007B59, 0x00007B5A, 0x00007B5B, 0x00007B5C, 0x00007B5D, 0x00007B5E, 0x00007B5F,
+    0x000007B6, 0x00007B61, 0x00007B62, 0x00007B63, 0x00007B64, 0x00007B65, 0x002007B7, 0x00007B67,
+    0x00007B68, 0x00007B69, 0x00007B6A, 0x00007B6B, 0x00007B6C, 0x00007B6D, 0x00007B6E, 0x00007B6F,
+    0x000007B7, 0x00007B71, 0x00007B72, 0x00007B73, 0x00007B74, 0x00007B75, 0x00007B76, 0x004007B8,
+    0x00007B78, 0x00007B79, 0x00007B7A, 0x00007B7B, 0x00007B7C, 0x00007B7D, 0x00007B7E, 0x00007B7F,
+    0x000007B8, 0x00007B81, 0x00007B82, 0x00007B83, 0x00007B84, 0x00007B85, 0x00007B86, 0x00007B87,
+    0x008007B9, 0x00007B89, 0x00007B8A, 0x00007B8B, 0x00007B8C, 0x00007B8D, 0x00007B8E, 0x00007B8F,
+    0x000007B9, 0x00007B91, 0x00007B92, 0x00007B93, 0x00007B94, 0x00007B95, 0x00007B96, 0x00007B97,
+    0x00007B98, 0x010007BA, 0x00007B9A, 0x00007B9B, 0x00007B9C, 0x00007B9D, 0x00007B9E, 0x00007B9F,
+    0x000007BA, 0x00007BA1, 0x00007BA2, 0x00007BA3, 0x00007BA4, 0x00007BA5, 0x00007BA6, 0x00007BA7,
+    0x00007BA8, 0x00007BA9, 0x820007BB, 0x00007BAB, 0x00007BAC, 0x00007BAD, 0x00007BAE, 0x00007BAF,
+    0x0400007C, 0x040007C1, 0x040007C2, 0x040007C3, 0x040007C4, 0x040007C5, 0x040007C6, 0x040007C7,
+    0x040007C8, 0x040007C9, 0x040007CA, 0x040007BC, 0x040007CC, 0x040007CD, 0x040007CE, 0x040007CF,
+    0x000007BC, 0x00007BC1, 0x00007BC2, 0x00007BC3, 0x00007BC4, 0x00007BC5, 0x00007BC6, 0x00007BC7,
+    0x00007BC8, 0x00007BC9, 0x00007BCA, 0x00007BCB, 0x080007BD, 0x00007BCD, 0x00007BCE, 0x00007BCF,
+    0x000007BD, 0x00007BD1, 0x00007BD2, 0x00007BD3, 0x00007BD4, 0x00007BD5, 0x00007BD6, 0x00007BD7,
+    0x00007BD8, 0x00007BD9, 0x00007BDA, 0x00007BDB, 0x00007BDC, 0x100007BE, 0x00007BDE, 0x00007BDF,
+    0x000007BE, 0x00007BE1, 0x00007BE2, 0x00007BE3, 0x00007BE4, 0x00007BE5, 0x00007BE6, 0x00007BE7,
+    0x00007BE8, 0x00007BE9, 0x00007BEA, 0x00007BEB, 0x00007BEC, 0x00007BED, 0x200007BF, 0x00007BEF,
+    0x000007BF, 0x00007BF1, 0x00007BF2, 0x00007BF3, 0x00007BF4, 0x00007BF5, 0x00007BF6, 0x00007BF7,
+    0x00007BF8, 0x00007BF9, 0x00007BFA, 0x00007BFB, 0x00007BFC, 0x00007BFD, 0x00007BFE, 0x00007BFF,
+    0x0000007C, 0x000007C1, 0x000007C2, 0x000007C3, 0x000007C4, 0x000007C5, 0x000007C6, 0x000007C7,
+    0x000007C8, 0x000007C9, 0x000007CA, 0x000007CB, 0x0800007D, 0x000007CD, 0x000007CE, 0x000007CF,
+    0x000007C1, 0x000107C2, 0x00007C12, 0x00007C13, 0x00007C14, 0x00007C15, 0x00007C16, 0x00007C17,
+    0x00007C18, 0x00007C19, 0x00007C1A, 0x00007C1B, 0x00007C1C, 0x00007C1D, 0x00007C1E, 0x00007C1F,
+    0x000007C2, 0x00007C21, 0x000207C3, 0x00007C23, 0x00007C24, 0x00007C25, 0x00007C26, 0x00007C27,
+    0x00007C28, 0x00007C29, 0x00007C2A, 0x00007C2B, 0x00007C2C, 0x00007C2D, 0x00007C2E, 0x00007C2F,
+    0x000007C3, 0x00007C31, 0x00007C32, 0x000407C4, 0x00007C34, 0x00007C35, 0x00007C36, 0x00007C37,
+    0x00007C38, 0x00007C39, 0x00007C3A, 0x00007C3B, 0x00007C3C, 0x00007C3D, 0x00007C3E, 0x00007C3F,
+    0x000007C4, 0x00007C41, 0x00007C42, 0x00007C43, 0x000807C5, 0x00007C45, 0x00007C46, 0x00007C47,
+    0x00007C48, 0x00007C49, 0x00007C4A, 0x00007C4B, 0x00007C4C, 0x00007C4D, 0x00007C4E, 0x00007C4F,
+    0x000007C5, 0x00007C51, 0x00007C52, 0x00007C53, 0x00007C54, 0x001007C6, 0x00007C56, 0x00007C57,
+    0x00007C58, 0x00007C59, 0x00007C5A, 0x00007C5B, 0x00007C5C, 0x00007C5D, 0x00007C5E, 0x00007C5F,
+    0x000007C6, 0x00007C61, 0x00007C62, 0x00007C63, 0x00007C64, 0x00007C65, 0x002007C7, 0x00007C67,
+    0x00007C68, 0x00007C69, 0x00007C6A, 0x00007C6B, 0x00007C6C, 0x00007C6D, 0x00007C6E, 0x00007C6F,
+    0x000007C7, 0x00007C71, 0x00007C72, 0x00007C73, 0x00007C74, 0x00007C75, 0x00007C76, 0x004007C8,
+    0x00007C78, 0x00007C79, 0x00007C7A, 0x00007C7B, 0x00007C7C, 0x00007C7D, 0x00007C7E, 0x00007C7F,
+    0x000007C8, 0x00007C81, 0x00007C82, 0x00007C83, 0x00007C84, 0x00007C85, 0x00007C86, 0x00007C87,
+    0x008007C9, 0x00007C89, 0x00007C8A, 0x00007C8B, 0x00007C8C, 0x00007C8D, 0x00007C8E, 0x00007C8F,
+    0x000007C9, 0x00007C91, 0x00007C92, 0x00007C93, 0x00007C94, 0x00007C95, 0x00007C96, 0x00007C97,
+    0x00007C98, 0x010007CA, 0x00007C9A, 0x00007C9B, 0x00007C9C, 0x00007C9D, 0x00007C9E, 0x00007C9F,
+    0x000007CA, 0x00007CA1, 0x00007CA2, 0x00007CA3, 0x00007CA4, 0x00007CA5, 0x00007CA6, 0x00007CA7,
+    0x00007CA8, 0x00007CA9, 0x820007CB, 0x00007CAB, 0x00007CAC, 0x00007CAD, 0x00007CAE, 0x00007CAF,
+    0x000007CB, 0x00007CB1, 0x00007CB2, 0x00007CB3, 0x00007CB4, 0x00007CB5, 0x00007CB6, 0x00007CB7,
+    0x00007CB8, 0x00007CB9, 0x00007CBA, 0x040007CC, 0x00007CBC, 0x00007CBD, 0x00007CBE, 0x00007CBF,
+    0x0800007D, 0x080007D1, 0x080007D2, 0x080007D3, 0x080007D4, 0x080007D5, 0x080007D6, 0x080007D7,
+    0x080007D8, 0x080007D9, 0x080007DA, 0x080007DB, 0x080007CD, 0x080007DD, 0x080007DE, 0x080007DF,
+    0x000007CD, 0x00007CD1, 0x00007CD2, 0x00007CD3, 0x00007CD4, 0x00007CD5, 0x00007CD6, 0x00007CD7,
+    0x00007CD8, 0x00007CD9, 0x00007CDA, 0x00007CDB, 0x00007CDC, 0x100007CE, 0x00007CDE, 0x00007CDF,
+    0x000007CE, 0x00007CE1, 0x00007CE2, 0x00007CE3, 0x00007CE4, 0x00007CE5, 0x00007CE6, 0x00007CE7,
+    0x00007CE8, 0x00007CE9, 0x00007CEA, 0x00007CEB, 0x00007CEC, 0x00007CED, 0x200007CF, 0x00007CEF,
+    0x000007CF, 0x00007CF1, 0x00007CF2, 0x00007CF3, 0x00007CF4, 0x00007CF5, 0x00007CF6, 0x00007CF7,
+    0x00007CF8, 0x00007CF9, 0x00007CFA, 0x00007CFB, 0x00007CFC, 0x00007CFD, 0x00007CFE, 0x00007CFF,
+    0x0000007D, 0x000007D1, 0x000007D2, 0x000007D3, 0x000007D4, 0x000007D5, 0x000007D6, 0x000007D7,
+    0x000007D8, 0x000007D9, 0x000007DA, 0x000007DB, 0x000007DC, 0x1000007E, 0x000007DE, 0x000007DF,
+    0x000007D1, 0x000107D2, 0x00007D12, 0x00007D13, 0x00007D14, 0x00007D15, 0x00007D16, 0x00007D17,
+    0x00007D18, 0x00007D19, 0x00007D1A, 0x00007D1B, 0x00007D1C, 0x00007D1D, 0x00007D1E, 0x00007D1F,
+    0x000007D2, 0x00007D21, 0x000207D3, 0x00007D23, 0x00007D24, 0x00007D25, 0x00007D26, 0x00007D27,
+    0x00007D28, 0x00007D29, 0x00007D2A, 0x00007D2B, 0x00007D2C, 0x00007D2D, 0x00007D2E, 0x00007D2F,
+    0x000007D3, 0x00007D31, 0x00007D32, 0x000407D4, 0x00007D34, 0x00007D35, 0x00007D36, 0x00007D37,
+    0x00007D38, 0x00007D39, 0x00007D3A, 0x00007D3B, 0x00007D3C, 0x00007D3D, 0x00007D3E, 0x00007D3F,
+    0x000007D4, 0x00007D41, 0x00007D42, 0x00007D43, 0x000807D5, 0x00007D45, 0x00007D46, 0x00007D47,
+    0x00007D48, 0x00007D49, 0x00007D4A, 0x00007D4B, 0x00007D4C, 0x00007D4D, 0x00007D4E, 0x00007D4F,
+    0x000007D5, 0x00007D51, 0x00007D52, 0x00007D53, 0x00007D54, 0x001007D6, 0x00007D56, 0x00007D57,
+    0x00007D58, 0x00007D59, 0x00007D5A, 0x00007D5B, 0x00007D5C, 0x00007D5D, 0x00007D5E, 0x00007D5F,
+    0x000007D6, 0x00007D61, 0x00007D62, 0x00007D63, 0x00007D64, 0x00007D65, 0x002007D7, 0x00007D67,
+    0x00007D68, 0x00007D69, 0x00007D6A, 0x00007D6B, 0x00007D6C, 0x00007D6D, 0x00007D6E, 0x00007D6F,
+    0x000007D7, 0x00007D71, 0x00007D72, 0x00007D73, 0x00007D74, 0x00007D75, 0x00007D76, 0x004007D8,
+    0x00007D78, 0x00007D79, 0x00007D7A, 0x00007D7B, 0x00007D7C, 0x00007D7D, 0x00007D7E, 0x00007D7F,
+    0x000007D8, 0x00007D81, 0x00007D82, 0x00007D83, 0x00007D84, 0x00007D85, 0x00007D86, 0x00007D87,
+    0x008007D9, 0x00007D89, 0x00007D8A, 0x00007D8B, 0x00007D8C, 0x00007D8D, 0x00007D8E, 0x00007D8F,
+    0x000007D9, 0x00007D91, 0x00007D92, 0x00007D93, 0x00007D94, 0x00007D95, 0x00007D96, 0x00007D97,
+    0x00007D98, 0x010007DA, 0x00007D9A, 0x00007D9B, 0x00007D9C, 0x00007D9D, 0x00007D9E, 0x00007D9F,
+    0x000007DA, 0x00007DA1, 0x00007DA2, 0x00007DA3, 0x00007DA4, 0x00007DA5, 0x00007DA6, 0x00007DA7,
+    0x00007DA8, 0x00007DA9, 0x820007DB, 0x00007DAB, 0x00007DAC, 0x00007DAD, 0x00007DAE, 0x00007DAF,
+    0x000007DB, 0x00007DB1, 0x00007DB2, 0x00007DB3, 0x00007DB4, 0x00007DB5, 0x00007DB6, 0x00007DB7,
+    0x00007DB8, 0x00007DB9, 0x00007DBA, 0x040007DC, 0x00007DBC, 0x00007DBD, 0x00007DBE, 0x00007DBF,
+    0x000007DC, 0x00007DC1, 0x00007DC2, 0x00007DC3, 0x00007DC4, 0x00007DC5, 0x00007DC6, 0x00007DC7,
+    0x00007DC8, 0x00007DC9, 0x00007DCA, 0x00007DCB, 0x080007DD, 0x00007DCD, 0x00007DCE, 0x00007DCF,
+    0x1000007E, 0x100007E1, 0x100007E2, 0x100007E3, 0x100007E4, 0x100007E5, 0x100007E6, 0x100007E7,
+    0x100007E8, 0x100007E9, 0x100007EA, 0x100007EB, 0x100007EC, 0x100007DE, 0x100007EE, 0x100007EF,
+    0x000007DE, 0x00007DE1, 0x00007DE2, 0x00007DE3, 0x00007DE4, 0x00007DE5, 0x00007DE6, 0x00007DE7,
+    0x00007DE8, 0x00007DE9, 0x00007DEA, 0x00007DEB, 0x00007DEC, 0x00007DED, 0x200007DF, 0x00007DEF,
+    0x000007DF, 0x00007DF1, 0x00007DF2, 0x00007DF3, 0x00007DF4, 0x00007DF5, 0x00007DF6, 0x00007DF7,
+    0x00007DF8, 0x00007DF9, 0x00007DFA, 0x00007DFB, 0x00007DFC, 0x00007DFD, 0x00007DFE, 0x00007DFF,
+    0x0000007E, 0x000007E1, 0x000007E2, 0x000007E3, 0x000007E4, 0x000007E5, 0x000007E6, 0x000007E7,
+    0x000007E8, 0x000007E9, 0x000007EA, 0x000007EB, 0x000007EC, 0x000007ED, 0x2000007F, 0x000007EF,
+    0x000007E1, 0x000107E2, 0x00007E12, 0x00007E13, 0x00007E14, 0x00007E15, 0x00007E16, 0x00007E17,
+    0x00007E18, 0x00007E19, 0x00007E1A, 0x00007E1B, 0x00007E1C, 0x00007E1D, 0x00007E1E, 0x00007E1F,
+    0x000007E2, 0x00007E21, 0x000207E3, 0x00007E23, 0x00007E24, 0x00007E25, 0x00007E26, 0x00007E27,
+    0x00007E28, 0x00007E29, 0x00007E2A, 0x00007E2B, 0x00007E2C, 0x00007E2D, 0x00007E2E, 0x00007E2F,
+    0x000007E3, 0x00007E31, 0x00007E32, 0x000407E4, 0x00007E34, 0x00007E35, 0x00007E36, 0x00007E37,
+    0x00007E38, 0x00007E39, 0x00007E3A, 0x00007E3B, 0x00007E3C, 0x00007E3D, 0x00007E3E, 0x00007E3F,
+    0x000007E4, 0x00007E41, 0x00007E42, 0x00007E43, 0x000807E5, 0x00007E45, 0x00007E46, 0x00007E47,
+    0x00007E48, 0x00007E49, 0x00007E4A, 0x00007E4B, 0x00007E4C, 0x00007E4D, 0x00007E4E, 0x00007E4F,
+    0x000007E5, 0x00007E51, 0x00007E52, 0x00007E53, 0x00007E54, 0x001007E6, 0x00007E56, 0x00007E57,
+    0x00007E58, 0x00007E59, 0x00007E5A, 0x00007E5B, 0x00007E5C, 0x00007E5D, 0x00007E5E, 0x00007E5F,
+    0x000007E6, 0x00007E61, 0x00007E62, 0x00007E63, 0x00007E64, 0x00007E65, 0x002007E7, 0x00007E67,
+    0x00007E68, 0x00007E69, 0x00007E6A, 0x00007E6B, 0x00007E6C, 0x00007E6D, 0x00007E6E, 0x00007E6F,
+    0x000007E7, 0x00007E71, 0x00007E72, 0x00007E73, 0x00007E74, 0x00007E75, 0x00007E76, 0x004007E8,
+    0x00007E78, 0x00007E79, 0x00007E7A, 0x00007E7B, 0x00007E7C, 0x00007E7D, 0x00007E7E, 0x00007E7F,
+    0x000007E8, 0x00007E81, 0x00007E82, 0x00007E83, 0x00007E84, 0x00007E85, 0x00007E86, 0x00007E87,
+    0x008007E9, 0x00007E89, 0x00007E8A, 0x00007E8B, 0x00007E8C, 0x00007E8D, 0x00007E8E, 0x00007E8F,
+    0x000007E9, 0x00007E91, 0x00007E92, 0x00007E93, 0x00007E94, 0x00007E95, 0x00007E96, 0x00007E97,
+    0x00007E98, 0x010007EA, 0x00007E9A, 0x00007E9B, 0x00007E9C, 0x00007E9D, 0x00007E9E, 0x00007E9F,
+    0x000007EA, 0x00007EA1, 0x00007EA2, 0x00007EA3, 0x00007EA4, 0x00007EA5, 0x00007EA6, 0x00007EA7,
+    0x00007EA8, 0x00007EA9, 0x820007EB, 0x00007EAB, 0x00007EAC, 0x00007EAD, 0x00007EAE, 0x00007EAF,
+    0x000007EB, 0x00007EB1, 0x00007EB2, 0x00007EB3, 0x00007EB4, 0x00007EB5, 0x00007EB6, 0x00007EB7,
+    0x00007EB8, 0x00007EB9, 0x00007EBA, 0x040007EC, 0x00007EBC, 0x00007EBD, 0x00007EBE, 0x00007EBF,
+    0x000007EC, 0x00007EC1, 0x00007EC2, 0x00007EC3, 0x00007EC4, 0x00007EC5, 0x00007EC6, 0x00007EC7,
+    0x00007EC8, 0x00007EC9, 0x00007ECA, 0x00007ECB, 0x080007ED, 0x00007ECD, 0x00007ECE, 0x00007ECF,
+    0x000007ED, 0x00007ED1, 0x00007ED2, 0x00007ED3, 0x00007ED4, 0x00007ED5, 0x00007ED6, 0x00007ED7,
+    0x00007ED8, 0x00007ED9, 0x00007EDA, 0x00007EDB, 0x00007EDC, 0x100007EE, 0x00007EDE, 0x00007EDF,
+    0x2000007F, 0x200007F1, 0x200007F2, 0x200007F3, 0x200007F4, 0x200007F5, 0x200007F6, 0x200007F7,
+    0x200007F8, 0x200007F9, 0x200007FA, 0x200007FB, 0x200007FC, 0x200007FD, 0x200007EF, 0x200007FF,
+    0x000007EF, 0x00007EF1, 0x00007EF2, 0x00007EF3, 0x00007EF4, 0x00007EF5, 0x00007EF6, 0x00007EF7,
+    0x00007EF8, 0x00007EF9, 0x00007EFA, 0x00007EFB, 0x00007EFC, 0x00007EFD, 0x00007EFE, 0x00007EFF,
+    0x0000007F, 0x000007F1, 0x000007F2, 0x000007F3, 0x000007F4, 0x000007F5, 0x000007F6, 0x000007F7,
+    0x000007F8, 0x000007F9, 0x000007FA, 0x000007FB, 0x000007FC, 0x000007FD, 0x000007FE, 0x000007FF,
+    0x000007F1, 0x000107F2, 0x00007F12, 0x00007F13, 0x00007F14, 0x00007F15, 0x00007F16, 0x00007F17,
+    0x00007F18, 0x00007F19, 0x00007F1A, 0x00007F1B, 0x00007F1C, 0x00007F1D, 0x00007F1E, 0x00007F1F,
+    0x000007F2, 0x00007F21, 0x000207F3, 0x00007F23, 0x00007F24, 0x00007F25, 0x00007F26, 0x00007F27,
+    0x00007F28, 0x00007F29, 0x00007F2A, 0x00007F2B, 0x00007F2C, 0x00007F2D, 0x00007F2E, 0x00007F2F,
+    0x000007F3, 0x00007F31, 0x00007F32, 0x000407F4, 0x00007F34, 0x00007F35, 0x00007F36, 0x00007F37,
+    0x00007F38, 0x00007F39, 0x00007F3A, 0x00007F3B, 0x00007F3C, 0x00007F3D, 0x00007F3E, 0x00007F3F,
+    0x000007F4, 0x00007F41, 0x00007F42, 0x00007F43, 0x000807F5, 0x00007F45, 0x00007F46, 0x00007F47,
+    0x00007F48, 0x00007F49, 0x00007F4A, 0x00007F4B, 0x00007F4C, 0x00007F4D, 0x00007F4E, 0x00007F4F,
+    0x000007F5, 0x00007F51, 0x00007F52, 0x00007F53, 0x00007F54, 0x001007F6, 0x00007F56, 0x00007F57,
+    0x00007F58, 0x00007F59, 0x00007F5A, 0x00007F5B, 0x00007F5C, 0x00007F5D, 0x00007F5E, 0x00007F5F,
+    0x000007F6, 0x00007F61, 0x00007F62, 0x00007F63, 0x00007F64, 0x00007F65, 0x002007F7, 0x00007F67,
+    0x00007F68, 0x00007F69, 0x00007F6A, 0x00007F6B, 0x00007F6C, 0x00007F6D, 0x00007F6E, 0x00007F6F,
+    0x000007F7, 0x00007F71, 0x00007F72, 0x00007F73, 0x00007F74, 0x00007F75, 0x00007F76, 0x004007F8,
+    0x00007F78, 0x00007F79, 0x00007F7A, 0x00007F7B, 0x00007F7C, 0x00007F7D, 0x00007F7E, 0x00007F7F,
+    0x000007F8, 0x00007F81, 0x00007F82, 0x00007F83, 0x00007F84, 0x00007F85, 0x00007F86, 0x00007F87,
+    0x008007F9, 0x00007F89, 0x00007F8A, 0x00007F8B, 0x00007F8C, 0x00007F8D, 0x00007F8E, 0x00007F8F,
+    0x000007F9, 0x00007F91, 0x00007F92, 0x00007F93, 0x00007F94, 0x00007F95, 0x00007F96, 0x00007F97,
+    0x00007F98, 0x010007FA, 0x00007F9A, 0x00007F9B, 0x00007F9C, 0x00007F9D, 0x00007F9E, 0x00007F9F,
+    0x000007FA, 0x00007FA1, 0x00007FA2, 0x00007FA3, 0x00007FA4, 0x00007FA5, 0x00007FA6, 0x00007FA7,
+    0x00007FA8, 0x00007FA9, 0x820007FB, 0x00007FAB, 0x00007FAC, 0x00007FAD, 0x00007FAE, 0x00007FAF,
+    0x000007FB, 0x00007FB1, 0x00007FB2, 0x00007FB3, 0x00007FB4, 0x00007FB5, 0x00007FB6, 0x00007FB7,
+    0x00007FB8, 0x00007FB9, 0x00007FBA, 0x040007FC, 0x00007FBC, 0x00007FBD, 0x00007FBE, 0x00007FBF,
+    0x000007FC, 0x00007FC1, 0x00007FC2, 0x00007FC3, 0x00007FC4, 0x00007FC5, 0x00007FC6, 0x00007FC7,
+    0x00007FC8, 0x00007FC9, 0x00007FCA, 0x00007FCB, 0x080007FD, 0x00007FCD, 0x00007FCE, 0x00007FCF,
+    0x000007FD, 0x00007FD1, 0x00007FD2, 0x00007FD3, 0x00007FD4, 0x00007FD5, 0x00007FD6, 0x00007FD7,
+    0x00007FD8, 0x00007FD9, 0x00007FDA, 0x00007FDB, 0x00007FDC, 0x100007FE, 0x00007FDE, 0x00007FDF,
+    0x000007FE, 0x00007FE1, 0x00007FE2, 0x00007FE3, 0x00007FE4, 0x00007FE5, 0x00007FE6, 0x00007FE7,
+    0x00007FE8, 0x00007FE9, 0x00007FEA, 0x00007FEB, 0x00007FEC, 0x00007FED, 0x200007FF, 0x00007FEF,
+    0x000007FF, 0x00007FF1, 0x00007FF2, 0x00007FF3, 0x00007FF4, 0x00007FF5, 0x00007FF6, 0x00007FF7,
+    0x00007FF8, 0x00007FF9, 0x00007FFA, 0x00007FFB, 0x00007FFC, 0x00007FFD, 0x00007FFE, 0x00007FFF,
+    0x00000008, 0x00000081, 0x00000082, 0x00000083, 0x00000084, 0x00000085, 0x00000086, 0x00000087,
+    0x00800009, 0x00000089, 0x0000008A, 0x0000008B, 0x0000008C, 0x0000008D, 0x0000008E, 0x0000008F,
+    0x00000081, 0x00010082, 0x00000812, 0x00000813, 0x00000814, 0x00000815, 0x00000816, 0x00000817,
+    0x00000818, 0x00000819, 0x0000081A, 0x0000081B, 0x0000081C, 0x0000081D, 0x0000081E, 0x0000081F,
+    0x00000082, 0x00000821, 0x00020083, 0x00000823, 0x00000824, 0x00000825, 0x00000826, 0x00000827,
+    0x00000828, 0x00000829, 0x0000082A, 0x0000082B, 0x0000082C, 0x0000082D, 0x0000082E, 0x0000082F,
+    0x00000083, 0x00000831, 0x00000832, 0x00040084, 0x00000834, 0x00000835, 0x00000836, 0x00000837,
+    0x00000838, 0x00000839, 0x0000083A, 0x0000083B, 0x0000083C, 0x0000083D, 0x0000083E, 0x0000083F,
+    0x00000084, 0x00000841, 0x00000842, 0x00000843, 0x00080085, 0x00000845, 0x00000846, 0x00000847,
+    0x00000848, 0x00000849, 0x0000084A, 0x0000084B, 0x0000084C, 0x0000084D, 0x0000084E, 0x0000084F,
+    0x00000085, 0x00000851, 0x00000852, 0x00000853, 0x00000854, 0x00100086, 0x00000856, 0x00000857,
+    0x00000858, 0x00000859, 0x0000085A, 0x0000085B, 0x0000085C, 0x0000085D, 0x0000085E, 0x0000085F,
+    0x00000086, 0x00000861, 0x00000862, 0x00000863, 0x00000864, 0x00000865, 0x00200087, 0x00000867,
+    0x00000868, 0x00000869, 0x0000086A, 0x0000086B, 0x0000086C, 0x0000086D, 0x0000086E, 0x0000086F,
+    0x00000087, 0x00000871, 0x00000872, 0x00000873, 0x00000874, 0x00000875, 0x00000876, 0x00400088,
+    0x00000878, 0x00000879, 0x0000087A, 0x0000087B, 0x0000087C, 0x0000087D, 0x0000087E, 0x0000087F,
+    0x00800009, 0x00800091, 0x00800092, 0x00800093, 0x00800094, 0x00800095, 0x00800096, 0x00800097,
+    0x00800089, 0x00800099, 0x0080009A, 0x0080009B, 0x0080009C, 0x0080009D, 0x0080009E, 0x0080009F,
+    0x00000089, 0x00000891, 0x00000892, 0x00000893, 0x00000894, 0x00000895, 0x00000896, 0x00000897,
+    0x00000898, 0x0100008A, 0x0000089A, 0x0000089B, 0x0000089C, 0x0000089D, 0x0000089E, 0x0000089F,
+    0x0000008A, 0x000008A1, 0x000008A2, 0x000008A3, 0x000008A4, 0x000008A5, 0x000008A6, 0x000008A7,
+    0x000008A8, 0x000008A9, 0x8200008B, 0x000008AB, 0x000008AC, 0x000008AD, 0x000008AE, 0x000008AF,
+    0x0000008B, 0x000008B1, 0x000008B2, 0x000008B3, 0x000008B4, 0x000008B5, 0x000008B6, 0x000008B7,
+    0x000008B8, 0x000008B9, 0x000008BA, 0x0400008C, 0x000008BC, 0x000008BD, 0x000008BE, 0x000008BF,
+    0x0000008C, 0x000008C1, 0x000008C2, 0x000008C3, 0x000008C4, 0x000008C5, 0x000008C6, 0x000008C7,
+    0x000008C8, 0x000008C9, 0x000008CA, 0x000008CB, 0x0800008D, 0x000008CD, 0x000008CE, 0x000008CF,
+    0x0000008D, 0x000008D1, 0x000008D2, 0x000008D3, 0x000008D4, 0x000008D5, 0x000008D6, 0x000008D7,
+    0x000008D8, 0x000008D9, 0x000008DA, 0x000008DB, 0x000008DC, 0x1000008E, 0x000008DE, 0x000008DF,
+    0x0000008E, 0x000008E1, 0x000008E2, 0x000008E3, 0x000008E4, 0x000008E5, 0x000008E6, 0x000008E7,
+    0x000008E8, 0x000008E9, 0x000008EA, 0x000008EB, 0x000008EC, 0x000008ED, 0x2000008F, 0x000008EF,
+    0x0000008F, 0x000008F1, 0x000008F2, 0x000008F3, 0x000008F4, 0x000008F5, 0x000008F6, 0x000008F7,
+    0x000008F8, 0x000008F9, 0x000008FA, 0x000008FB, 0x000008FC, 0x000008FD, 0x000008FE, 0x000008FF,
+    0x00000081, 0x00010082, 0x00000812, 0x00000813, 0x00000814, 0x00000815, 0x00000816, 0x00000817,
+    0x00000818, 0x00000819, 0x0000081A, 0x0000081B, 0x0000081C, 0x0000081D, 0x0000081E, 0x0000081F,
+    0x00010082, 0x00010812, 0x00010822, 0x00010823, 0x00010824, 0x00010825, 0x00010826, 0x00010827,
+    0x00010828, 0x00010829, 0x0001082A, 0x0001082B, 0x0001082C, 0x0001082D, 0x0001082E, 0x0001082F,
+    0x00000812, 0x00008121, 0x00020813, 0x00008123, 0x00008124, 0x00008125, 0x00008126, 0x00008127,
+    0x00008128, 0x00008129, 0x0000812A, 0x0000812B, 0x0000812C, 0x0000812D, 0x0000812E, 0x0000812F,
+    0x00000813, 0x00008131, 0x00008132, 0x00040814, 0x00008134, 0x00008135, 0x00008136, 0x00008137,
+    0x00008138, 0x00008139, 0x0000813A, 0x0000813B, 0x0000813C, 0x0000813D, 0x0000813E, 0x0000813F,
+    0x00000814, 0x00008141, 0x00008142, 0x00008143, 0x00080815, 0x00008145, 0x00008146, 0x00008147,
+    0x00008148, 0x00008149, 0x0000814A, 0x0000814B, 0x0000814C, 0x0000814D, 0x0000814E, 0x0000814F,
+    0x00000815, 0x00008151, 0x00008152, 0x00008153, 0x00008154, 0x00100816, 0x00008156, 0x00008157,
+    0x00008158, 0x00008159, 0x0000815A, 0x0000815B, 0x0000815C, 0x0000815D, 0x0000815E, 0x0000815F,
+    0x00000816, 0x00008161, 0x00008162, 0x00008163, 0x00008164, 0x00008165, 0x00200817, 0x00008167,
+    0x00008168, 0x00008169, 0x0000816A, 0x0000816B, 0x0000816C, 0x0000816D, 0x0000816E, 0x0000816F,
+    0x00000817, 0x00008171, 0x00008172, 0x00008173, 0x00008174, 0x00008175, 0x00008176, 0x00400818,
+    0x00008178, 0x00008179, 0x0000817A, 0x0000817B, 0x0000817C, 0x0000817D, 0x0000817E, 0x0000817F,
+    0x00000818, 0x00008181, 0x00008182, 0x00008183, 0x00008184, 0x00008185, 0x00008186, 0x00008187,
+    0x00800819, 0x00008189, 0x0000818A, 0x0000818B, 0x0000818C, 0x0000818D, 0x0000818E, 0x0000818F,
+    0x00000819, 0x00008191, 0x00008192, 0x00008193, 0x00008194, 0x00008195, 0x00008196, 0x00008197,
+    0x00008198, 0x0100081A, 0x0000819A, 0x0000819B, 0x0000819C, 0x0000819D, 0x0000819E, 0x0000819F,
+    0x0000081A, 0x000081A1, 0x000081A2, 0x000081A3, 0x000081A4, 0x000081A5, 0x000081A6, 0x000081A7,
+    0x000081A8, 0x000081A9, 0x8200081B, 0x000081AB, 0x000081AC, 0x000081AD, 0x000081AE, 0x000081AF,
+    0x0000081B, 0x000081B1, 0x000081B2, 0x000081B3, 0x000081B4, 0x000081B5, 0x000081B6, 0x000081B7,
+    0x000081B8, 0x000081B9, 0x000081BA, 0x0400081C, 0x000081BC, 0x000081BD, 0x000081BE, 0x000081BF,
+    0x0000081C, 0x000081C1, 0x000081C2, 0x000081C3, 0x000081C4, 0x000081C5, 0x000081C6, 0x000081C7,
+    0x000081C8, 0x000081C9, 0x000081CA, 0x000081CB, 0x0800081D, 0x000081CD, 0x000081CE, 0x000081CF,
+    0x0000081D, 0x000081D1, 0x000081D2, 0x000081D3, 0x000081D4, 0x000081D5, 0x000081D6, 0x000081D7,
+    0x000081D8, 0x000081D9, 0x000081DA, 0x000081DB, 0x000081DC, 0x1000081E, 0x000081DE, 0x000081DF,
+    0x0000081E, 0x000081E1, 0x000081E2, 0x000081E3, 0x000081E4, 0x000081E5, 0x000081E6, 0x000081E7,
+    0x000081E8, 0x000081E9, 0x000081EA, 0x000081EB, 0x000081EC, 0x000081ED, 0x2000081F, 0x000081EF,
+    0x0000081F, 0x000081F1, 0x000081F2, 0x000081F3, 0x000081F4, 0x000081F5, 0x000081F6, 0x000081F7,
+    0x000081F8, 0x000081F9, 0x000081FA, 0x000081FB, 0x000081FC, 0x000081FD, 0x000081FE, 0x000081FF,
+    0x00000082, 0x00000821, 0x00020083, 0x00000823, 0x00000824, 0x00000825, 0x00000826, 0x00000827,
+    0x00000828, 0x00000829, 0x0000082A, 0x0000082B, 0x0000082C, 0x0000082D, 0x0000082E, 0x0000082F,
+    0x00000821, 0x00010822, 0x00008212, 0x00008213, 0x00008214, 0x00008215, 0x00008216, 0x00008217,
+    0x00008218, 0x00008219, 0x0000821A, 0x0000821B, 0x0000821C, 0x0000821D, 0x0000821E, 0x0000821F,
+    0x00020083, 0x00020831, 0x00020823, 0x00020833, 0x00020834, 0x00020835, 0x00020836, 0x00020837,
+    0x00020838, 0x00020839, 0x0002083A, 0x0002083B, 0x0002083C, 0x0002083D, 0x0002083E, 0x0002083F,
+    0x00000823, 0x00008231, 0x00008232, 0x00040824, 0x00008234, 0x00008235, 0x00008236, 0x00008237,
+    0x00008238, 0x00008239, 0x0000823A, 0x0000823B, 0x0000823C, 0x0000823D, 0x0000823E, 0x0000823F,
+    0x00000824, 0x00008241, 0x00008242, 0x00008243, 0x00080825, 0x00008245, 0x00008246, 0x00008247,
+    0x00008248, 0x00008249, 0x0000824A, 0x0000824B, 0x0000824C, 0x0000824D, 0x0000824E, 0x0000824F,
+    0x00000825, 0x00008251, 0x00008252, 0x00008253, 0x00008254, 0x00100826, 0x00008256, 0x00008257,
+    0x00008258, 0x00008259, 0x0000825A, 0x0000825B, 0x0000825C, 0x0000825D, 0x0000825E, 0x0000825F,
+    0x00000826, 0x00008261, 0x00008262, 0x00008263, 0x00008264, 0x00008265, 0x00200827, 0x00008267,
+    0x00008268, 0x00008269, 0x0000826A, 0x0000826B, 0x0000826C, 0x0000826D, 0x0000826E, 0x0000826F,
+    0x00000827, 0x00008271, 0x00008272, 0x00008273, 0x00008274, 0x00008275, 0x00008276, 0x00400828,
+    0x00008278, 0x00008279, 0x0000827A, 0x0000827B, 0x0000827C, 0x0000827D, 0x0000827E, 0x0000827F,
+    0x00000828, 0x00008281, 0x00008282, 0x00008283, 0x00008284, 0x00008285, 0x00008286, 0x00008287,
+    0x00800829, 0x00008289, 0x0000828A, 0x0000828B, 0x0000828C, 0x0000828D, 0x0000828E, 0x0000828F,
+    0x00000829, 0x00008291, 0x00008292, 0x00008293, 0x00008294, 0x00008295, 0x00008296, 0x00008297,
+    0x00008298, 0x0100082A, 0x0000829A, 0x0000829B, 0x0000829C, 0x0000829D, 0x0000829E, 0x0000829F,
+    0x0000082A, 0x000082A1, 0x000082A2, 0x000082A3, 0x000082A4, 0x000082A5, 0x000082A6, 0x000082A7,
+    0x000082A8, 0x000082A9, 0x8200082B, 0x000082AB, 0x000082AC, 0x000082AD, 0x000082AE, 0x000082AF,
+    0x0000082B, 0x000082B1, 0x000082B2, 0x000082B3, 0x000082B4, 0x000082B5, 0x000082B6, 0x000082B7,
+    0x000082B8, 0x000082B9, 0x000082BA, 0x0400082C, 0x000082BC, 0x000082BD, 0x000082BE, 0x000082BF,
+    0x0000082C, 0x000082C1, 0x000082C2, 0x000082C3, 0x000082C4, 0x000082C5, 0x000082C6, 0x000082C7,
+    0x000082C8, 0x000082C9, 0x000082CA, 0x000082CB, 0x0800082D, 0x000082CD, 0x000082CE, 0x000082CF,
+    0x0000082D, 0x000082D1, 0x000082D2, 0x000082D3, 0x000082D4, 0x000082D5, 0x000082D6, 0x000082D7,
+    0x000082D8, 0x000082D9, 0x000082DA, 0x000082DB, 0x000082DC, 0x1000082E, 0x000082DE, 0x000082DF,
+    0x0000082E, 0x000082E1, 0x000082E2, 0x000082E3, 0x000082E4, 0x000082E5, 0x000082E6, 0x000082E7,
+    0x000082E8, 0x000082E9, 0x000082EA, 0x000082EB, 0x000082EC, 0x000082ED, 0x2000082F, 0x000082EF,
+    0x0000082F, 0x000082F1, 0x000082F2, 0x000082F3, 0x000082F4, 0x000082F5, 0x000082F6, 0x000082F7,
+    0x000082F8, 0x000082F9, 0x000082FA, 0x000082FB, 0x000082FC, 0x000082FD, 0x000082FE, 0x000082FF,
+    0x00000083, 0x00000831, 0x00000832, 0x00040084, 0x00000834, 0x00000835, 0x00000836, 0x00000837,
+    0x00000838, 0x00000839, 0x0000083A, 0x0000083B, 0x0000083C, 0x0000083D, 0x0000083E, 0x0000083F,
+    0x00000831, 0x00010832, 0x00008312, 0x00008313, 0x00008314, 0x00008315, 0x00008316, 0x00008317,
+    0x00008318, 0x00008319, 0x0000831A, 0x0000831B, 0x0000831C, 0x0000831D, 0x0000831E, 0x0000831F,
+    0x00000832, 0x00008321, 0x00020833, 0x00008323, 0x00008324, 0x00008325, 0x00008326, 0x00008327,
+    0x00008328, 0x00008329, 0x0000832A, 0x0000832B, 0x0000832C, 0x0000832D, 0x0000832E, 0x0000832F,
+    0x00040084, 0x00040841, 0x00040842, 0x00040834, 0x00040844, 0x00040845, 0x00040846, 0x00040847,
+    0x00040848, 0x00040849, 0x0004084A, 0x0004084B, 0x0004084C, 0x0004084D, 0x0004084E, 0x0004084F,
+    0x00000834, 0x00008341, 0x00008342, 0x00008343, 0x00080835, 0x00008345, 0x00008346, 0x00008347,
+    0x00008348, 0x00008349, 0x0000834A, 0x0000834B, 0x0000834C, 0x0000834D, 0x0000834E, 0x0000834F,
+    0x00000835, 0x00008351, 0x00008352, 0x00008353, 0x00008354, 0x00100836, 0x00008356, 0x00008357,
+    0x00008358, 0x00008359, 0x0000835A, 0x0000835B, 0x0000835C, 0x0000835D, 0x0000835E, 0x0000835F,
+    0x00000836, 0x00008361, 0x00008362, 0x00008363, 0x00008364, 0x00008365, 0x00200837, 0x00008367,
+    0x00008368, 0x00008369, 0x0000836A, 0x0000836B, 0x0000836C, 0x0000836D, 0x0000836E, 0x0000836F,
+    0x00000837, 0x00008371, 0x00008372, 0x00008373, 0x00008374, 0x00008375, 0x00008376, 0x00400838,
+    0x00008378, 0x00008379, 0x0000837A, 0x0000837B, 0x0000837C, 0x0000837D, 0x0000837E, 0x0000837F,
+    0x00000838, 0x00008381, 0x00008382, 0x00008383, 0x00008384, 0x00008385, 0x00008386, 0x00008387,
+    0x00800839, 0x00008389, 0x0000838A, 0x0000838B, 0x0000838C, 0x0000838D, 0x0000838E, 0x0000838F,
+    0x00000839, 0x00008391, 0x00008392, 0x00008393, 0x00008394, 0x00008395, 0x00008396, 0x00008397,
+    0x00008398, 0x0100083A, 0x0000839A, 0x0000839B, 0x0000839C, 0x0000839D, 0x0000839E, 0x0000839F,
+    0x0000083A, 0x000083A1, 0x000083A2, 0x000083A3, 0x000083A4, 0x000083A5, 0x000083A6, 0x000083A7,
+    0x000083A8, 0x000083A9, 0x8200083B, 0x000083AB, 0x000083AC, 0x000083AD, 0x000083AE, 0x000083AF,
+    0x0000083B, 0x000083B1, 0x000083B2, 0x000083B3, 0x000083B4, 0x000083B5, 0x000083B6, 0x000083B7,
+    0x000083B8, 0x000083B9, 0x000083BA, 0x0400083C, 0x000083BC, 0x000083BD, 0x000083BE, 0x000083BF,
+    0x0000083C, 0x000083C1, 0x000083C2, 0x000083C3, 0x000083C4, 0x000083C5, 0x000083C6, 0x000083C7,
+    0x000083C8, 0x000083C9, 0x000083CA, 0x000083CB, 0x0800083D, 0x000083CD, 0x000083CE, 0x000083CF,
+    0x0000083D, 0x000083D1, 0x000083D2, 0x000083D3, 0x000083D4, 0x000083D5, 0x000083D6, 0x000083D7,
+    0x000083D8, 0x000083D9, 0x000083DA, 0x000083DB, 0x000083DC, 0x1000083E, 0x000083DE, 0x000083DF,
+    0x0000083E, 0x000083E1, 0x000083E2, 0x000083E3, 0x000083E4, 0x000083E5, 0x000083E6, 0x000083E7,
+    0x000083E8, 0x000083E9, 0x000083EA, 0x000083EB, 0x000083EC, 0x000083ED, 0x2000083F, 0x000083EF,
+    0x0000083F, 0x000083F1, 0x000083F2, 0x000083F3, 0x000083F4, 0x000083F5, 0x000083F6, 0x000083F7,
+    0x000083F8, 0x000083F9, 0x000083FA, 0x000083FB, 0x000083FC, 0x000083FD, 0x000083FE, 0x000083FF,
+    0x00000084, 0x00000841, 0x00000842, 0x00000843, 0x00080085, 0x00000845, 0x00000846, 0x00000847,
+    0x00000848, 0x00000849, 0x0000084A, 0x0000084B, 0x0000084C, 0x0000084D, 0x0000084E, 0x0000084F,
+    0x00000841, 0x00010842, 0x00008412, 0x00008413, 0x00008414, 0x00008415, 0x00008416, 0x00008417,
+    0x00008418, 0x00008419, 0x0000841A, 0x0000841B, 0x0000841C, 0x0000841D, 0x0000841E, 0x0000841F,
+    0x00000842, 0x00008421, 0x00020843, 0x00008423, 0x00008424, 0x00008425, 0x00008426, 0x00008427,
+    0x00008428, 0x00008429, 0x0000842A, 0x0000842B, 0x0000842C, 0x0000842D, 0x0000842E, 0x0000842F,
+    0x00000843, 0x00008431, 0x00008432, 0x00040844, 0x00008434, 0x00008435, 0x00008436, 0x00008437,
+    0x00008438, 0x00008439, 0x0000843A, 0x0000843B, 0x0000843C, 0x0000843D, 0x0000843E, 0x0000843F,
+    0x00080085, 0x00080851, 0x00080852, 0x00080853, 0x00080845, 0x00080855, 0x00080856, 0x00080857,
+    0x00080858, 0x00080859, 0x0008085A, 0x0008085B, 0x0008085C, 0x0008085D, 0x0008085E, 0x0008085F,
+    0x00000845, 0x00008451, 0x00008452, 0x00008453, 0x00008454, 0x00100846, 0x00008456, 0x00008457,
+    0x00008458, 0x00008459, 0x0000845A, 0x0000845B, 0x0000845C, 0x0000845D, 0x0000845E, 0x0000845F,
+    0x00000846, 0x00008461, 0x00008462, 0x00008463, 0x00008464, 0x00008465, 0x00200847, 0x00008467,
+    0x00008468, 0x00008469, 0x0000846A, 0x0000846B, 0x0000846C, 0x0000846D, 0x0000846E, 0x0000846F,
+    0x00000847, 0x00008471, 0x00008472, 0x00008473, 0x00008474, 0x00008475, 0x00008476, 0x00400848,
+    0x00008478, 0x00008479, 0x0000847A, 0x0000847B, 0x0000847C, 0x0000847D, 0x0000847E, 0x0000847F,
+    0x00000848, 0x00008481, 0x00008482, 0x00008483, 0x00008484, 0x00008485, 0x00008486, 0x00008487,
+    0x00800849, 0x00008489, 0x0000848A, 0x0000848B, 0x0000848C, 0x0000848D, 0x0000848E, 0x0000848F,
+    0x00000849, 0x00008491, 0x00008492, 0x00008493, 0x00008494, 0x00008495, 0x00008496, 0x00008497,
+    0x00008498, 0x0100084A, 0x0000849A, 0x0000849B, 0x0000849C, 0x0000849D, 0x0000849E, 0x0000849F,
+    0x0000084A, 0x000084A1, 0x000084A2, 0x000084A3, 0x000084A4, 0x000084A5, 0x000084A6, 0x000084A7,
+    0x000084A8, 0x000084A9, 0x8200084B, 0x000084AB, 0x000084AC, 0x000084AD, 0x000084AE, 0x000084AF,
+    0x0000084B, 0x000084B1, 0x000084B2, 0x000084B3, 0x000084B4, 0x000084B5, 0x000084B6, 0x000084B7,
+    0x000084B8, 0x000084B9, 0x000084BA, 0x0400084C, 0x000084BC, 0x000084BD, 0x000084BE, 0x000084BF,
+    0x0000084C, 0x000084C1, 0x000084C2, 0x000084C3, 0x000084C4, 0x000084C5, 0x000084C6, 0x000084C7,
+    0x000084C8, 0x000084C9, 0x000084CA, 0x000084CB, 0x0800084D, 0x000084CD, 0x000084CE, 0x000084CF,
+    0x0000084D, 0x000084D1, 0x000084D2, 0x000084D3, 0x000084D4, 0x000084D5, 0x000084D6, 0x000084D7,
+    0x000084D8, 0x000084D9, 0x000084DA, 0x000084DB, 0x000084DC, 0x1000084E, 0x000084DE, 0x000084DF,
+    0x0000084E, 0x000084E1, 0x000084E2, 0x000084E3, 0x000084E4, 0x000084E5, 0x000084E6, 0x000084E7,
+    0x000084E8, 0x000084E9, 0x000084EA, 0x000084EB, 0x000084EC, 0x000084ED, 0x2000084F, 0x000084EF,
+    0x0000084F, 0x000084F1, 0x000084F2, 0x000084F3, 0x000084F4, 0x000084F5, 0x000084F6, 0x000084F7,
+    0x000084F8, 0x000084F9, 0x000084FA, 0x000084FB, 0x000084FC, 0x000084FD, 0x000084FE, 0x000084FF,
+    0x00000085, 0x00000851, 0x00000852, 0x00000853, 0x00000854, 0x00100086, 0x00000856, 0x00000857,
+    0x00000858, 0x00000859, 0x0000085A, 0x0000085B, 0x0000085C, 0x0000085D, 0x0000085E, 0x0000085F,
+    0x00000851, 0x00010852, 0x00008512, 0x00008513, 0x00008514, 0x00008515, 0x00008516, 0x00008517,
+    0x00008518, 0x00008519, 0x0000851A, 0x0000851B, 0x0000851C, 0x0000851D, 0x0000851E, 0x0000851F,
+    0x00000852, 0x00008521, 0x00020853, 0x00008523, 0x00008524, 0x00008525, 0x00008526, 0x00008527,
+    0x00008528, 0x00008529, 0x0000852A, 0x0000852B, 0x0000852C, 0x0000852D, 0x0000852E, 0x0000852F,
+    0x00000853, 0x00008531, 0x00008532, 0x00040854, 0x00008534, 0x00008535, 0x00008536, 0x00008537,
+    0x00008538, 0x00008539, 0x0000853A, 0x0000853B, 0x0000853C, 0x0000853D, 0x0000853E, 0x0000853F,
+    0x00000854, 0x00008541, 0x00008542, 0x00008543, 0x00080855, 0x00008545, 0x00008546, 0x00008547,
+    0x00008548, 0x00008549, 0x0000854A, 0x0000854B, 0x0000854C, 0x0000854D, 0x0000854E, 0x0000854F,
+    0x00100086, 0x00100861, 0x00100862, 0x00100863, 0x00100864, 0x00100856, 0x00100866, 0x00100867,
+    0x00100868, 0x00100869, 0x0010086A, 0x0010086B, 0x0010086C, 0x0010086D, 0x0010086E, 0x0010086F,
+    0x00000856, 0x00008561, 0x00008562, 0x00008563, 0x00008564, 0x00008565, 0x00200857, 0x00008567,
+    0x00008568, 0x00008569, 0x0000856A, 0x0000856B, 0x0000856C, 0x0000856D, 0x0000856E, 0x0000856F,
+    0x00000857, 0x00008571, 0x00008572, 0x00008573, 0x00008574, 0x00008575, 0x00008576, 0x00400858,
+    0x00008578, 0x00008579, 0x0000857A, 0x0000857B, 0x0000857C, 0x0000857D, 0x0000857E, 0x0000857F,
+    0x00000858, 0x00008581, 0x00008582, 0x00008583, 0x00008584, 0x00008585, 0x00008586, 0x00008587,
+    0x00800859, 0x00008589, 0x0000858A, 0x0000858B, 0x0000858C, 0x0000858D, 0x0000858E, 0x0000858F,
+    0x00000859, 0x00008591, 0x00008592, 0x00008593, 0x00008594, 0x00008595, 0x00008596, 0x00008597,
+    0x00008598, 0x0100085A, 0x0000859A, 0x0000859B, 0x0000859C, 0x0000859D, 0x0000859E, 0x0000859F,
+    0x0000085A, 0x000085A1, 0x000085A2, 0x000085A3, 0x000085A4, 0x000085A5, 0x000085A6, 0x000085A7,
+    0x000085A8, 0x000085A9, 0x8200085B, 0x000085AB, 0x000085AC, 0x000085AD, 0x000085AE, 0x000085AF,
+    0x0000085B, 0x000085B1, 0x000085B2, 0x000085B3, 0x000085B4, 0x000085B5, 0x000085B6, 0x000085B7,
+    0x000085B8, 0x000085B9, 0x000085BA, 0x0400085C, 0x000085BC, 0x000085BD, 0x000085BE, 0x000085BF,
+    0x0000085C, 0x000085C1, 0x000085C2, 0x000085C3, 0x000085C4, 0x000085C5, 0x000085C6, 0x000085C7,
+    0x000085C8, 0x000085C9, 0x000085CA, 0x000085CB, 0x0800085D, 0x000085CD, 0x000085CE, 0x000085CF,
+    0x0000085D, 0x000085D1, 0x000085D2, 0x000085D3, 0x000085D4, 0x000085D5, 0x000085D6, 0x000085D7,
+    0x000085D8, 0x000085D9, 0x000085DA, 0x000085DB, 0x000085DC, 0x1000085E, 0x000085DE, 0x000085DF,
+    0x0000085E, 0x000085E1, 0x000085E2, 0x000085E3, 0x000085E4, 0x000085E5, 0x000085E6, 0x000085E7,
+    0x000085E8, 0x000085E9, 0x000085EA, 0x000085EB, 0x000085EC, 0x000085ED, 0x2000085F, 0x000085EF,
+    0x0000085F, 0x000085F1, 0x000085F2, 0x000085F3, 0x000085F4, 0x000085F5, 0x000085F6, 0x000085F7,
+    0x000085F8, 0x000085F9, 0x000085FA, 0x000085FB, 0x000085FC, 0x000085FD, 0x000085FE, 0x000085FF,
+    0x00000086, 0x00000861, 0x00000862, 0x00000863, 0x00000864, 0x00000865, 0x00200087, 0x00000867,
+    0x00000868, 0x00000869, 0x0000086A, 0x0000086B, 0x0000086C, 0x0000086D, 0x0000086E, 0x0000086F,
+    0x00000861, 0x00010862, 0x00008612, 0x00008613, 0x00008614, 0x00008615, 0x00008616, 0x00008617,
+    0x00008618, 0x00008619, 0x0000861A, 0x0000861B, 0x0000861C, 0x0000861D, 0x0000861E, 0x0000861F,
+    0x00000862, 0x00008621, 0x00020863, 0x00008623, 0x00008624, 0x00008625, 0x00008626, 0x00008627,
+    0x00008628, 0x00008629, 0x0000862A, 0x0000862B, 0x0000862C, 0x0000862D, 0x0000862E, 0x0000862F,
+    0x00000863, 0x00008631, 0x00008632, 0x00040864, 0x00008634, 0x00008635, 0x00008636, 0x00008637,
+    0x00008638, 0x00008639, 0x0000863A, 0x0000863B, 0x0000863C, 0x0000863D, 0x0000863E, 0x0000863F,
+    0x00000864, 0x00008641, 0x00008642, 0x00008643, 0x00080865, 0x00008645, 0x00008646, 0x00008647,
+    0x00008648, 0x00008649, 0x0000864A, 0x0000864B, 0x0000864C, 0x0000864D, 0x0000864E, 0x0000864F,
+    0x00000865, 0x00008651, 0x00008652, 0x00008653, 0x00008654, 0x00100866, 0x00008656, 0x00008657,
+    0x00008658, 0x00008659, 0x0000865A, 0x0000865B, 0x0000865C, 0x0000865D, 0x0000865E, 0x0000865F,
+    0x00200087, 0x00200871, 0x00200872, 0x00200873, 0x00200874, 0x00200875, 0x00200867, 0x00200877,
+    0x00200878, 0x00200879, 0x0020087A, 0x0020087B, 0x0020087C, 0x0020087D, 0x0020087E, 0x0020087F,
+    0x00000867, 0x00008671, 0x00008672, 0x00008673, 0x00008674, 0x00008675, 0x00008676, 0x00400868,
+    0x00008678, 0x00008679, 0x0000867A, 0x0000867B, 0x0000867C, 0x0000867D, 0x0000867E, 0x0000867F,
+    0x00000868, 0x00008681, 0x00008682, 0x00008683, 0x00008684, 0x00008685, 0x00008686, 0x00008687,
+    0x00800869, 0x00008689, 0x0000868A, 0x0000868B, 0x0000868C, 0x0000868D, 0x0000868E, 0x0000868F,
+    0x00000869, 0x00008691, 0x00008692, 0x00008693, 0x00008694, 0x00008695, 0x00008696, 0x00008697,
+    0x00008698, 0x0100086A, 0x0000869A, 0x0000869B, 0x0000869C, 0x0000869D, 0x0000869E, 0x0000869F,
+    0x0000086A, 0x000086A1, 0x000086A2, 0x000086A3, 0x000086A4, 0x000086A5, 0x000086A6, 0x000086A7,
+    0x000086A8, 0x000086A9, 0x8200086B, 0x000086AB, 0x000086AC, 0x000086AD, 0x000086AE, 0x000086AF,
+    0x0000086B, 0x000086B1, 0x000086B2, 0x000086B3, 0x000086B4, 0x000086B5, 0x000086B6, 0x000086B7,
+    0x000086B8, 0x000086B9, 0x000086BA, 0x0400086C, 0x000086BC, 0x000086BD, 0x000086BE, 0x000086BF,
+    0x0000086C, 0x000086C1, 0x000086C2, 0x000086C3, 0x000086C4, 0x000086C5, 0x000086C6, 0x000086C7,
+    0x000086C8, 0x000086C9, 0x000086CA, 0x000086CB, 0x0800086D, 0x000086CD, 0x000086CE, 0x000086CF,
+    0x0000086D, 0x000086D1, 0x000086D2, 0x000086D3, 0x000086D4, 0x000086D5, 0x000086D6, 0x000086D7,
+    0x000086D8, 0x000086D9, 0x000086DA, 0x000086DB, 0x000086DC, 0x1000086E, 0x000086DE, 0x000086DF,
+    0x0000086E, 0x000086E1, 0x000086E2, 0x000086E3, 0x000086E4, 0x000086E5, 0x000086E6, 0x000086E7,
+    0x000086E8, 0x000086E9, 0x000086EA, 0x000086EB, 0x000086EC, 0x000086ED, 0x2000086F, 0x000086EF,
+    0x0000086F, 0x000086F1, 0x000086F2, 0x000086F3, 0x000086F4, 0x000086F5, 0x000086F6, 0x000086F7,
+    0x000086F8, 0x000086F9, 0x000086FA, 0x000086FB, 0x000086FC, 0x000086FD, 0x000086FE, 0x000086FF,
+    0x00000087, 0x00000871, 0x00000872, 0x00000873, 0x00000874, 0x00000875, 0x00000876, 0x00400088,
+    0x00000878, 0x00000879, 0x0000087A, 0x0000087B, 0x0000087C, 0x0000087D, 0x0000087E, 0x0000087F,
+    0x00000871, 0x00010872, 0x00008712, 0x00008713, 0x00008714, 0x00008715, 0x00008716, 0x00008717,
+    0x00008718, 0x00008719, 0x0000871A, 0x0000871B, 0x0000871C, 0x0000871D, 0x0000871E, 0x0000871F,
+    0x00000872, 0x00008721, 0x00020873, 0x00008723, 0x00008724, 0x00008725, 0x00008726, 0x00008727,
+    0x00008728, 0x00008729, 0x0000872A, 0x0000872B, 0x0000872C, 0x0000872D, 0x0000872E, 0x0000872F,
+    0x00000873, 0x00008731, 0x00008732, 0x00040874, 0x00008734, 0x00008735, 0x00008736, 0x00008737,
+    0x00008738, 0x00008739, 0x0000873A, 0x0000873B, 0x0000873C, 0x0000873D, 0x0000873E, 0x0000873F,
+    0x00000874, 0x00008741, 0x00008742, 0x00008743, 0x00080875, 0x00008745, 0x00008746, 0x00008747,
+    0x00008748, 0x00008749, 0x0000874A, 0x0000874B, 0x0000874C, 0x0000874D, 0x0000874E, 0x0000874F,
+    0x00000875, 0x00008751, 0x00008752, 0x00008753, 0x00008754, 0x00100876, 0x00008756, 0x00008757,
+    0x00008758, 0x00008759, 0x0000875A, 0x0000875B, 0x0000875C, 0x0000875D, 0x0000875E, 0x0000875F,
+    0x00000876, 0x00008761, 0x00008762, 0x00008763, 0x00008764, 0x00008765, 0x00200877, 0x00008767,
+    0x00008768, 0x00008769, 0x0000876A, 0x0000876B, 0x0000876C, 0x0000876D, 0x0000876E, 0x0000876F,
+    0x00400088, 0x00400881, 0x00400882, 0x00400883, 0x00400884, 0x00400885, 0x00400886, 0x00400878,
+    0x00400888, 0x00400889, 0x0040088A, 0x0040088B, 0x0040088C, 0x0040088D, 0x0040088E, 0x0040088F,
+    0x00000878, 0x00008781, 0x00008782, 0x00008783, 0x00008784, 0x00008785, 0x00008786, 0x00008787,
+    0x00800879, 0x00008789, 0x0000878A, 0x0000878B, 0x0000878C, 0x0000878D, 0x0000878E, 0x0000878F,
+    0x00000879, 0x00008791, 0x00008792, 0x00008793, 0x00008794, 0x00008795, 0x00008796, 0x00008797,
+    0x00008798, 0x0100087A, 0x0000879A, 0x0000879B, 0x0000879C, 0x0000879D, 0x0000879E, 0x0000879F,
+    0x0000087A, 0x000087A1, 0x000087A2, 0x000087A3, 0x000087A4, 0x000087A5, 0x000087A6, 0x000087A7,
+    0x000087A8, 0x000087A9, 0x8200087B, 0x000087AB, 0x000087AC, 0x000087AD, 0x000087AE, 0x000087AF,
+    0x0000087B, 0x000087B1, 0x000087B2, 0x000087B3, 0x000087B4, 0x000087B5, 0x000087B6, 0x000087B7,
+    0x000087B8, 0x000087B9, 0x000087BA, 0x0400087C, 0x000087BC, 0x000087BD, 0x000087BE, 0x000087BF,
+    0x0000087C, 0x000087C1, 0x000087C2, 0x000087C3, 0x000087C4, 0x000087C5, 0x000087C6, 0x000087C7,
+    0x000087C8, 0x000087C9, 0x000087CA, 0x000087CB, 0x0800087D, 0x000087CD, 0x000087CE, 0x000087CF,
+    0x0000087D, 0x000087D1, 0x000087D2, 0x000087D3, 0x000087D4, 0x000087D5, 0x000087D6, 0x000087D7,
+    0x000087D8, 0x000087D9, 0x000087DA, 0x000087DB, 0x000087DC, 0x1000087E, 0x000087DE, 0x000087DF,
+    0x0000087E, 0x000087E1, 0x000087E2, 0x000087E3, 0x000087E4, 0x000087E5, 0x000087E6, 0x000087E7,
+    0x000087E8, 0x000087E9, 0x000087EA, 0x000087EB, 0x000087EC, 0x000087ED, 0x2000087F, 0x000087EF,
+    0x0000087F, 0x000087F1, 0x000087F2, 0x000087F3, 0x000087F4, 0x000087F5, 0x000087F6, 0x000087F7,
+    0x000087F8, 0x000087F9, 0x000087FA, 0x000087FB, 0x000087FC, 0x000087FD, 0x000087FE, 0x000087FF,
+    0x00800009, 0x00800091, 0x00800092, 0x00800093, 0x00800094, 0x00800095, 0x00800096, 0x00800097,
+    0x00800089, 0x00800099, 0x0080009A, 0x0080009B, 0x0080009C, 0x0080009D, 0x0080009E, 0x0080009F,
+    0x00800091, 0x00810092, 0x00800912, 0x00800913, 0x00800914, 0x00800915, 0x00800916, 0x00800917,
+    0x00800918, 0x00800919, 0x0080091A, 0x0080091B, 0x0080091C, 0x0080091D, 0x0080091E, 0x0080091F,
+    0x00800092, 0x00800921, 0x00820093, 0x00800923, 0x00800924, 0x00800925, 0x00800926, 0x00800927,
+    0x00800928, 0x00800929, 0x0080092A, 0x0080092B, 0x0080092C, 0x0080092D, 0x0080092E, 0x0080092F,
+    0x00800093, 0x00800931, 0x00800932, 0x00840094, 0x00800934, 0x00800935, 0x00800936, 0x00800937,
+    0x00800938, 0x00800939, 0x0080093A, 0x0080093B, 0x0080093C, 0x0080093D, 0x0080093E, 0x0080093F,
+    0x00800094, 0x00800941, 0x00800942, 0x00800943, 0x00880095, 0x00800945, 0x00800946, 0x00800947,
+    0x00800948, 0x00800949, 0x0080094A, 0x0080094B, 0x0080094C, 0x0080094D, 0x0080094E, 0x0080094F,
+    0x00800095, 0x00800951, 0x00800952, 0x00800953, 0x00800954, 0x00900096, 0x00800956, 0x00800957,
+    0x00800958, 0x00800959, 0x0080095A, 0x0080095B, 0x0080095C, 0x0080095D, 0x0080095E, 0x0080095F,
+    0x00800096, 0x00800961, 0x00800962, 0x00800963, 0x00800964, 0x00800965, 0x00A00097, 0x00800967,
+    0x00800968, 0x00800969, 0x0080096A, 0x0080096B, 0x0080096C, 0x0080096D, 0x0080096E, 0x0080096F,
+    0x00800097, 0x00800971, 0x00800972, 0x00800973, 0x00800974, 0x00800975, 0x00800976, 0x00C00098,
+    0x00800978, 0x00800979, 0x0080097A, 0x0080097B, 0x0080097C, 0x0080097D, 0x0080097E, 0x0080097F,
+    0x00800089, 0x00800891, 0x00800892, 0x00800893, 0x00800894, 0x00800895, 0x00800896, 0x00800897,
+    0x01000099, 0x00800899, 0x0080089A, 0x0080089B, 0x0080089C, 0x0080089D, 0x0080089E, 0x0080089F,
+    0x00800099, 0x00800991, 0x00800992, 0x00800993, 0x00800994, 0x00800995, 0x00800996, 0x00800997,
+    0x00800998, 0x0180009A, 0x0080099A, 0x0080099B, 0x0080099C, 0x0080099D, 0x0080099E, 0x0080099F,
+    0x0080009A, 0x008009A1, 0x008009A2, 0x008009A3, 0x008009A4, 0x008009A5, 0x008009A6, 0x008009A7,
+    0x008009A8, 0x008009A9, 0x8280009B, 0x008009AB, 0x008009AC, 0x008009AD, 0x008009AE, 0x008009AF,
+    0x0080009B, 0x008009B1, 0x008009B2, 0x008009B3, 0x008009B4, 0x008009B5, 0x008009B6, 0x008009B7,
+    0x008009B8, 0x008009B9, 0x008009BA, 0x0480009C, 0x008009BC, 0x008009BD, 0x008009BE, 0x008009BF,
+    0x0080009C, 0x008009C1, 0x008009C2, 0x008009C3, 0x008009C4, 0x008009C5, 0x008009C6, 0x008009C7,
+    0x008009C8, 0x008009C9, 0x008009CA, 0x008009CB, 0x0880009D, 0x008009CD, 0x008009CE, 0x008009CF,
+    0x0080009D, 0x008009D1, 0x008009D2, 0x008009D3, 0x008009D4, 0x008009D5, 0x008009D6, 0x008009D7,
+    0x008009D8, 0x008009D9, 0x008009DA, 0x008009DB, 0x008009DC, 0x1080009E, 0x008009DE, 0x008009DF,
+    0x0080009E, 0x008009E1, 0x008009E2, 0x008009E3, 0x008009E4, 0x008009E5, 0x008009E6, 0x008009E7,
+    0x008009E8, 0x008009E9, 0x008009EA, 0x008009EB, 0x008009EC, 0x008009ED, 0x2080009F, 0x008009EF,
+    0x0080009F, 0x008009F1, 0x008009F2, 0x008009F3, 0x008009F4, 0x008009F5, 0x008009F6, 0x008009F7,
+    0x008009F8, 0x008009F9, 0x008009FA, 0x008009FB, 0x008009FC, 0x008009FD, 0x008009FE, 0x008009FF,
+    0x00000089, 0x00000891, 0x00000892, 0x00000893, 0x00000894, 0x00000895, 0x00000896, 0x00000897,
+    0x00000898, 0x0100008A, 0x0000089A, 0x0000089B, 0x0000089C, 0x0000089D, 0x0000089E, 0x0000089F,
+    0x00000891, 0x00010892, 0x00008912, 0x00008913, 0x00008914, 0x00008915, 0x00008916, 0x00008917,
+    0x00008918, 0x00008919, 0x0000891A, 0x0000891B, 0x0000891C, 0x0000891D, 0x0000891E, 0x0000891F,
+    0x00000892, 0x00008921, 0x00020893, 0x00008923, 0x00008924, 0x00008925, 0x00008926, 0x00008927,
+    0x00008928, 0x00008929, 0x0000892A, 0x0000892B, 0x0000892C, 0x0000892D, 0x0000892E, 0x0000892F,
+    0x00000893, 0x00008931, 0x00008932, 0x00040894, 0x00008934, 0x00008935, 0x00008936, 0x00008937,
+    0x00008938, 0x00008939, 0x0000893A, 0x0000893B, 0x0000893C, 0x0000893D, 0x0000893E, 0x0000893F,
+    0x00000894, 0x00008941, 0x00008942, 0x00008943, 0x00080895, 0x00008945, 0x00008946, 0x00008947,
+    0x00008948, 0x00008949, 0x0000894A, 0x0000894B, 0x0000894C, 0x0000894D, 0x0000894E, 0x0000894F,
+    0x00000895, 0x00008951, 0x00008952, 0x00008953, 0x00008954, 0x00100896, 0x00008956, 0x00008957,
+    0x00008958, 0x00008959, 0x0000895A, 0x0000895B, 0x0000895C, 0x0000895D, 0x0000895E, 0x0000895F,
+    0x00000896, 0x00008961, 0x00008962, 0x00008963, 0x00008964, 0x00008965, 0x00200897, 0x00008967,
+    0x00008968, 0x00008969, 0x0000896A, 0x0000896B, 0x0000896C, 0x0000896D, 0x0000896E, 0x0000896F,
+    0x00000897, 0x00008971, 0x00008972, 0x00008973, 0x00008974, 0x00008975, 0x00008976, 0x00400898,
+    0x00008978, 0x00008979, 0x0000897A, 0x0000897B, 0x0000897C, 0x0000897D, 0x0000897E, 0x0000897F,
+    0x00000898, 0x00008981, 0x00008982, 0x00008983, 0x00008984, 0x00008985, 0x00008986, 0x00008987,
+    0x00800899, 0x00008989, 0x0000898A, 0x0000898B, 0x0000898C, 0x0000898D, 0x0000898E, 0x0000898F,
+    0x0100008A, 0x010008A1, 0x010008A2, 0x010008A3, 0x010008A4, 0x010008A5, 0x010008A6, 0x010008A7,
+    0x010008A8, 0x0100089A, 0x010008AA, 0x010008AB, 0x010008AC, 0x010008AD, 0x010008AE, 0x010008AF,
+    0x0000089A, 0x000089A1, 0x000089A2, 0x000089A3, 0x000089A4, 0x000089A5, 0x000089A6, 0x000089A7,
+    0x000089A8, 0x000089A9, 0x8200089B, 0x000089AB, 0x000089AC, 0x000089AD, 0x000089AE, 0x000089AF,
+    0x0000089B, 0x000089B1, 0x000089B2, 0x000089B3, 0x000089B4, 0x000089B5, 0x000089B6, 0x000089B7,
+    0x000089B8, 0x000089B9, 0x000089BA, 0x0400089C, 0x000089BC, 0x000089BD, 0x000089BE, 0x000089BF,
+    0x0000089C, 0x000089C1, 0x000089C2, 0x000089C3, 0x000089C4, 0x000089C5, 0x000089C6, 0x000089C7,
+    0x000089C8, 0x000089C9, 0x000089CA, 0x000089CB, 0x0800089D, 0x000089CD, 0x000089CE, 0x000089CF,
+    0x0000089D, 0x000089D1, 0x000089D2, 0x000089D3, 0x000089D4, 0x000089D5, 0x000089D6, 0x000089D7,
+    0x000089D8, 0x000089D9, 0x000089DA, 0x000089DB, 0x000089DC, 0x1000089E, 0x000089DE, 0x000089DF,
+    0x0000089E, 0x000089E1, 0x000089E2, 0x000089E3, 0x000089E4, 0x000089E5, 0x000089E6, 0x000089E7,
+    0x000089E8, 0x000089E9, 0x000089EA, 0x000089EB, 0x000089EC, 0x000089ED, 0x2000089F, 0x000089EF,
+    0x0000089F, 0x000089F1, 0x000089F2, 0x000089F3, 0x000089F4, 0x000089F5, 0x000089F6, 0x000089F7,
+    0x000089F8, 0x000089F9, 0x000089FA, 0x000089FB, 0x000089FC, 0x000089FD, 0x000089FE, 0x000089FF,
+    0x0000008A, 0x000008A1, 0x000008A2, 0x000008A3, 0x000008A4, 0x000008A5, 0x000008A6, 0x000008A7,
+    0x000008A8, 0x000008A9, 0x8200008B, 0x000008AB, 0x000008AC, 0x000008AD, 0x000008AE, 0x000008AF,
+    0x000008A1, 0x000108A2, 0x00008A12, 0x00008A13, 0x00008A14, 0x00008A15, 0x00008A16, 0x00008A17,
+    0x00008A18, 0x00008A19, 0x00008A1A, 0x00008A1B, 0x00008A1C, 0x00008A1D, 0x00008A1E, 0x00008A1F,
+    0x000008A2, 0x00008A21, 0x000208A3, 0x00008A23, 0x00008A24, 0x00008A25, 0x00008A26, 0x00008A27,
+    0x00008A28, 0x00008A29, 0x00008A2A, 0x00008A2B, 0x00008A2C, 0x00008A2D, 0x00008A2E, 0x00008A2F,
+    0x000008A3, 0x00008A31, 0x00008A32, 0x000408A4, 0x00008A34, 0x00008A35, 0x00008A36, 0x00008A37,
+    0x00008A38, 0x00008A39, 0x00008A3A, 0x00008A3B, 0x00008A3C, 0x00008A3D, 0x00008A3E, 0x00008A3F,
+    0x000008A4, 0x00008A41, 0x00008A42, 0x00008A43, 0x000808A5, 0x00008A45, 0x00008A46, 0x00008A47,
+    0x00008A48, 0x00008A49, 0x00008A4A, 0x00008A4B, 0x00008A4C, 0x00008A4D, 0x00008A4E, 0x00008A4F,
+    0x000008A5, 0x00008A51, 0x00008A52, 0x00008A53, 0x00008A54, 0x001008A6, 0x00008A56, 0x00008A57,
+    0x00008A58, 0x00008A59, 0x00008A5A, 0x00008A5B, 0x00008A5C, 0x00008A5D, 0x00008A5E, 0x00008A5F,
+    0x000008A6, 0x00008A61, 0x00008A62, 0x00008A63, 0x00008A64, 0x00008A65, 0x002008A7, 0x00008A67,
+    0x00008A68, 0x00008A69, 0x00008A6A, 0x00008A6B, 0x00008A6C, 0x00008A6D, 0x00008A6E, 0x00008A6F,
+    0x000008A7, 0x00008A71, 0x00008A72, 0x00008A73, 0x00008A74, 0x00008A75, 0x00008A76, 0x004008A8,
+    0x00008A78, 0x00008A79, 0x00008A7A, 0x00008A7B, 0x00008A7C, 0x00008A7D, 0x00008A7E, 0x00008A7F,
+    0x000008A8, 0x00008A81, 0x00008A82, 0x00008A83, 0x00008A84, 0x00008A85, 0x00008A86, 0x00008A87,
+    0x008008A9, 0x00008A89, 0x00008A8A, 0x00008A8B, 0x00008A8C, 0x00008A8D, 0x00008A8E, 0x00008A8F,
+    0x000008A9, 0x00008A91, 0x00008A92, 0x00008A93, 0x00008A94, 0x00008A95, 0x00008A96, 0x00008A97,
+    0x00008A98, 0x010008AA, 0x00008A9A, 0x00008A9B, 0x00008A9C, 0x00008A9D, 0x00008A9E, 0x00008A9F,
+    0x8200008B, 0x820008B1, 0x820008B2, 0x820008B3, 0x820008B4, 0x820008B5, 0x820008B6, 0x820008B7,
+    0x820008B8, 0x820008B9, 0x820008AB, 0x820008BB, 0x820008BC, 0x820008BD, 0x820008BE, 0x820008BF,
+    0x000008AB, 0x00008AB1, 0x00008AB2, 0x00008AB3, 0x00008AB4, 0x00008AB5, 0x00008AB6, 0x00008AB7,
+    0x00008AB8, 0x00008AB9, 0x00008ABA, 0x040008AC, 0x00008ABC, 0x00008ABD, 0x00008ABE, 0x00008ABF,
+    0x000008AC, 0x00008AC1, 0x00008AC2, 0x00008AC3, 0x00008AC4, 0x00008AC5, 0x00008AC6, 0x00008AC7,
+    0x00008AC8, 0x00008AC9, 0x00008ACA, 0x00008ACB, 0x080008AD, 0x00008ACD, 0x00008ACE, 0x00008ACF,
+    0x000008AD, 0x00008AD1, 0x00008AD2, 0x00008AD3, 0x00008AD4, 0x00008AD5, 0x00008AD6, 0x00008AD7,
+    0x00008AD8, 0x00008AD9, 0x00008ADA, 0x00008ADB, 0x00008ADC, 0x100008AE, 0x00008ADE, 0x00008ADF,
+    0x000008AE, 0x00008AE1, 0x00008AE2, 0x00008AE3, 0x00008AE4, 0x00008AE5, 0x00008AE6, 0x00008AE7,
+    0x00008AE8, 0x00008AE9, 0x00008AEA, 0x00008AEB, 0x00008AEC, 0x00008AED, 0x200008AF, 0x00008AEF,
+    0x000008AF, 0x00008AF1, 0x00008AF2, 0x00008AF3, 0x00008AF4, 0x00008AF5, 0x00008AF6, 0x00008AF7,
+    0x00008AF8, 0x00008AF9, 0x00008AFA, 0x00008AFB, 0x00008AFC, 0x00008AFD, 0x00008AFE, 0x00008AFF,
+    0x0000008B, 0x000008B1, 0x000008B2, 0x000008B3, 0x000008B4, 0x000008B5, 0x000008B6, 0x000008B7,
+    0x000008B8, 0x000008B9, 0x000008BA, 0x0400008C, 0x000008BC, 0x000008BD, 0x000008BE, 0x000008BF,
+    0x000008B1, 0x000108B2, 0x00008B12, 0x00008B13, 0x00008B14, 0x00008B15, 0x00008B16, 0x00008B17,
+    0x00008B18, 0x00008B19, 0x00008B1A, 0x00008B1B, 0x00008B1C, 0x00008B1D, 0x00008B1E, 0x00008B1F,
+    0x000008B2, 0x00008B21, 0x000208B3, 0x00008B23, 0x00008B24, 0x00008B25, 0x00008B26, 0x00008B27,
+    0x00008B28, 0x00008B29, 0x00008B2A, 0x00008B2B, 0x00008B2C, 0x00008B2D, 0x00008B2E, 0x00008B2F,
+    0x000008B3, 0x00008B31, 0x00008B32, 0x000408B4, 0x00008B34, 0x00008B35, 0x00008B36, 0x00008B37,
+    0x00008B38, 0x00008B39, 0x00008B3A, 0x00008B3B, 0x00008B3C, 0x00008B3D, 0x00008B3E, 0x00008B3F,
+    0x000008B4, 0x00008B41, 0x00008B42, 0x00008B43, 0x000808B5, 0x00008B45, 0x00008B46, 0x00008B47,
+    0x00008B48, 0x00008B49, 0x00008B4A, 0x00008B4B, 0x00008B4C, 0x00008B4D, 0x00008B4E, 0x00008B4F,
+    0x000008B5, 0x00008B51, 0x00008B52, 0x00008B53, 0x00008B54, 0x001008B6, 0x00008B56, 0x00008B57,
+    0x00008B58, 0x00008B59, 0x00008B5A, 0x00008B5B, 0x00008B5C, 0x00008B5D, 0x00008B5E, 0x00008B5F,
+    0x000008B6, 0x00008B61, 0x00008B62, 0x00008B63, 0x00008B64, 0x00008B65, 0x002008B7, 0x00008B67,
+    0x00008B68, 0x00008B69, 0x00008B6A, 0x00008B6B, 0x00008B6C, 0x00008B6D, 0x00008B6E, 0x00008B6F,
+    0x000008B7, 0x00008B71, 0x00008B72, 0x00008B73, 0x00008B74, 0x00008B75, 0x00008B76, 0x004008B8,
+    0x00008B78, 0x00008B79, 0x00008B7A, 0x00008B7B, 0x00008B7C, 0x00008B7D, 0x00008B7E, 0x00008B7F,
+    0x000008B8, 0x00008B81, 0x00008B82, 0x00008B83, 0x00008B84, 0x00008B85, 0x00008B86, 0x00008B87,
+    0x008008B9, 0x00008B89, 0x00008B8A, 0x00008B8B, 0x00008B8C, 0x00008B8D, 0x00008B8E, 0x00008B8F,
+    0x000008B9, 0x00008B91, 0x00008B92, 0x00008B93, 0x00008B94, 0x00008B95, 0x00008B96, 0x00008B97,
+    0x00008B98, 0x010008BA, 0x00008B9A, 0x00008B9B, 0x00008B9C, 0x00008B9D, 0x00008B9E, 0x00008B9F,
+    0x000008BA, 0x00008BA1, 0x00008BA2, 0x00008BA3, 0x00008BA4, 0x00008BA5, 0x00008BA6, 0x00008BA7,
+    0x00008BA8, 0x00008BA9, 0x820008BB, 0x00008BAB, 0x00008BAC, 0x00008BAD, 0x00008BAE, 0x00008BAF,
+    0x0400008C, 0x040008C1, 0x040008C2, 0x040008C3, 0x040008C4, 0x040008C5, 0x040008C6, 0x040008C7,
+    0x040008C8, 0x040008C9, 0x040008CA, 0x040008BC, 0x040008CC, 0x040008CD, 0x040008CE, 0x040008CF,
+    0x000008BC, 0x00008BC1, 0x00008BC2, 0x00008BC3, 0x00008BC4, 0x00008BC5, 0x00008BC6, 0x00008BC7,
+    0x00008BC8, 0x00008BC9, 0x00008BCA, 0x00008BCB, 0x080008BD, 0x00008BCD, 0x00008BCE, 0x00008BCF,
+    0x000008BD, 0x00008BD1, 0x00008BD2, 0x00008BD3, 0x00008BD4, 0x00008BD5, 0x00008BD6, 0x00008BD7,
+    0x00008BD8, 0x00008BD9, 0x00008BDA, 0x00008BDB, 0x00008BDC, 0x100008BE, 0x00008BDE, 0x00008BDF,
+    0x000008BE, 0x00008BE1, 0x00008BE2, 0x00008BE3, 0x00008BE4, 0x00008BE5, 0x00008BE6, 0x00008BE7,
+    0x00008BE8, 0x00008BE9, 0x00008BEA, 0x00008BEB, 0x00008BEC, 0x00008BED, 0x200008BF, 0x00008BEF,
+    0x000008BF, 0x00008BF1, 0x00008BF2, 0x00008BF3, 0x00008BF4, 0x00008BF5, 0x00008BF6, 0x00008BF7,
+    0x00008BF8, 0x00008BF9, 0x00008BFA, 0x00008BFB, 0x00008BFC, 0x00008BFD, 0x00008BFE, 0x00008BFF,
+    0x0000008C, 0x000008C1, 0x000008C2, 0x000008C3, 0x000008C4, 0x000008C5, 0x000008C6, 0x000008C7,
+    0x000008C8, 0x000008C9, 0x000008CA, 0x000008CB, 0x0800008D, 0x000008CD, 0x000008CE, 0x000008CF,
+    0x000008C1, 0x000108C2, 0x00008C12, 0x00008C13, 0x00008C14, 0x00008C15, 0x00008C16, 0x00008C17,
+    0x00008C18, 0x00008C19, 0x00008C1A, 0x00008C1B, 0x00008C1C, 0x00008C1D, 0x00008C1E, 0x00008C1F,
+    0x000008C2, 0x00008C21, 0x000208C3, 0x00008C23, 0x00008C24, 0x00008C25, 0x00008C26, 0x00008C27,
+    0x00008C28, 0x00008C29, 0x00008C2A, 0x00008C2B, 0x00008C2C, 0x00008C2D, 0x00008C2E, 0x00008C2F,
+    0x000008C3, 0x00008C31, 0x00008C32, 0x000408C4, 0x00008C34, 0x00008C35, 0x00008C36, 0x00008C37,
+    0x00008C38, 0x00008C39, 0x00008C3A, 0x00008C3B, 0x00008C3C, 0x00008C3D, 0x00008C3E, 0x00008C3F,
+    0x000008C4, 0x00008C41, 0x00008C42, 0x00008C43, 0x000808C5, 0x00008C45, 0x00008C46, 0x00008C47,
+    0x00008C48, 0x00008C49, 0x00008C4A, 0x00008C4B, 0x00008C4C, 0x00008C4D, 0x00008C4E, 0x00008C4F,
+    0x000008C5, 0x00008C51, 0x00008C52, 0x00008C53, 0x00008C54, 0x001008C6, 0x00008C56, 0x00008C57,
+    0x00008C58, 0x00008C59, 0x00008C5A, 0x00008C5B, 0x00008C5C, 0x00008C5D, 0x00008C5E, 0x00008C5F,
+    0x000008C6, 0x00008C61, 0x00008C62, 0x00008C63, 0x00008C64, 0x00008C65, 0x002008C7, 0x00008C67,
+    0x00008C68, 0x00008C69, 0x00008C6A, 0x00008C6B, 0x00008C6C, 0x00008C6D, 0x00008C6E, 0x00008C6F,
+    0x000008C7, 0x00008C71, 0x00008C72, 0x00008C73, 0x00008C74, 0x00008C75, 0x00008C76, 0x004008C8,
+    0x00008C78, 0x00008C79, 0x00008C7A, 0x00008C7B, 0x00008C7C, 0x00008C7D, 0x00008C7E, 0x00008C7F,
+    0x000008C8, 0x00008C81, 0x00008C82, 0x00008C83, 0x00008C84, 0x00008C85, 0x00008C86, 0x00008C87,
+    0x008008C9, 0x00008C89, 0x00008C8A, 0x00008C8B, 0x00008C8C, 0x00008C8D, 0x00008C8E, 0x00008C8F,
+    0x000008C9, 0x00008C91, 0x00008C92, 0x00008C93, 0x00008C94, 0x00008C95, 0x00008C96, 0x00008C97,
+    0x00008C98, 0x010008CA, 0x00008C9A, 0x00008C9B, 0x00008C9C, 0x00008C9D, 0x00008C9E, 0x00008C9F,
+    0x000008CA, 0x00008CA1, 0x00008CA2, 0x00008CA3, 0x00008CA4, 0x00008CA5, 0x00008CA6, 0x00008CA7,
+    0x00008CA8, 0x00008CA9, 0x820008CB, 0x00008CAB, 0x00008CAC, 0x00008CAD, 0x00008CAE, 0x00008CAF,
+    0x000008CB, 0x00008CB1, 0x00008CB2, 0x00008CB3, 0x00008CB4, 0x00008CB5, 0x00008CB6, 0x00008CB7,
+    0x00008CB8, 0x00008CB9, 0x00008CBA, 0x040008CC, 0x00008CBC, 0x00008CBD, 0x00008CBE, 0x00008CBF,
+    0x0800008D, 0x080008D1, 0x080008D2, 0x080008D3, 0x080008D4, 0x080008D5, 0x080008D6, 0x080008D7,
+    0x080008D8, 0x080008D9, 0x080008DA, 0x080008DB, 0x080008CD, 0x080008DD, 0x080008DE, 0x080008DF,
+    0x000008CD, 0x00008CD1, 0x00008CD2, 0x00008CD3, 0x00008CD4, 0x00008CD5, 0x00008CD6, 0x00008CD7,
+    0x00008CD8, 0x00008CD9, 0x00008CDA, 0x00008CDB, 0x00008CDC, 0x100008CE, 0x00008CDE, 0x00008CDF,
+    0x000008CE, 0x00008CE1, 0x00008CE2, 0x00008CE3, 0x00008CE4, 0x00008CE5, 0x00008CE6, 0x00008CE7,
+    0x00008CE8, 0x00008CE9, 0x00008CEA, 0x00008CEB, 0x00008CEC, 0x00008CED, 0x200008CF, 0x00008CEF,
+    0x000008CF, 0x00008CF1, 0x00008CF2, 0x00008CF3, 0x00008CF4, 0x00008CF5, 0x00008CF6, 0x00008CF7,
+    0x00008CF8, 0x00008CF9, 0x00008CFA, 0x00008CFB, 0x00008CFC, 0x00008CFD, 0x00008CFE, 0x00008CFF,
+    0x0000008D, 0x000008D1, 0x000008D2, 0x000008D3, 0x000008D4, 0x000008D5, 0x000008D6, 0x000008D7,
+    0x000008D8, 0x000008D9, 0x000008DA, 0x000008DB, 0x000008DC, 0x1000008E, 0x000008DE, 0x000008DF,
+    0x000008D1, 0x000108D2, 0x00008D12, 0x00008D13, 0x00008D14, 0x00008D15, 0x00008D16, 0x00008D17,
+    0x00008D18, 0x00008D19, 0x00008D1A, 0x00008D1B, 0x00008D1C, 0x00008D1D, 0x00008D1E, 0x00008D1F,
+    0x000008D2, 0x00008D21, 0x000208D3, 0x00008D23, 0x00008D24, 0x00008D25, 0x00008D26, 0x00008D27,
+    0x00008D28, 0x00008D29, 0x00008D2A, 0x00008D2B, 0x00008D2C, 0x00008D2D, 0x00008D2E, 0x00008D2F,
+    0x000008D3, 0x00008D31, 0x00008D32, 0x000408D4, 0x00008D34, 0x00008D35, 0x00008D36, 0x00008D37,
+    0x00008D38, 0x00008D39, 0x00008D3A, 0x00008D3B, 0x00008D3C, 0x00008D3D, 0x00008D3E, 0x00008D3F,
+    0x000008D4, 0x00008D41, 0x00008D42, 0x00008D43, 0x000808D5, 0x00008D45, 0x00008D46, 0x00008D47,
+    0x00008D48, 0x00008D49, 0x00008D4A, 0x00008D4B, 0x00008D4C, 0x00008D4D, 0x00008D4E, 0x00008D4F,
+    0x000008D5, 0x00008D51, 0x00008D52, 0x00008D53, 0x00008D54, 0x001008D6, 0x00008D56, 0x00008D57,
+    0x00008D58, 0x00008D59, 0x00008D5A, 0x00008D5B, 0x00008D5C, 0x00008D5D, 0x00008D5E, 0x00008D5F,
+    0x000008D6, 0x00008D61, 0x00008D62, 0x00008D63, 0x00008D64, 0x00008D65, 0x002008D7, 0x00008D67,
+    0x00008D68, 0x00008D69, 0x00008D6A, 0x00008D6B, 0x00008D6C, 0x00008D6D, 0x00008D6E, 0x00008D6F,
+    0x000008D7, 0x00008D71, 0x00008D72, 0x00008D73, 0x00008D74, 0x00008D75, 0x00008D76, 0x004008D8,
+    0x00008D78, 0x00008D79, 0x00008D7A, 0x00008D7B, 0x00008D7C, 0x00008D7D, 0x00008D7E, 0x00008D7F,
+    0x000008D8, 0x00008D81, 0x00008D82, 0x00008D83, 0x00008D84, 0x00008D85, 0x00008D86, 0x00008D87,
+    0x008008D9, 0x00008D89, 0x00008D8A, 0x00008D8B, 0x00008D8C, 0x00008D8D, 0x00008D8E, 0x00008D8F,
+    0x000008D9, 0x00008D91, 0x00008D92, 0x00008D93, 0x00008D94, 0x00008D95, 0x00008D96, 0x00008D97,
+    0x00008D98, 0x010008DA, 0x00008D9A, 0x00008D9B, 0x00008D9C, 0x00008D9D, 0x00008D9E, 0x00008D9F,
+    0x000008DA, 0x00008DA1, 0x00008DA2, 0x00008DA3, 0x00008DA4, 0x00008DA5, 0x00008DA6, 0x00008DA7,
+    0x00008DA8, 0x00008DA9, 0x820008DB, 0x00008DAB, 0x00008DAC, 0x00008DAD, 0x00008DAE, 0x00008DAF,
+    0x000008DB, 0x00008DB1, 0x00008DB2, 0x00008DB3, 0x00008DB4, 0x00008DB5, 0x00008DB6, 0x00008DB7,
+    0x00008DB8, 0x00008DB9, 0x00008DBA, 0x040008DC, 0x00008DBC, 0x00008DBD, 0x00008DBE, 0x00008DBF,
+    0x000008DC, 0x00008DC1, 0x00008DC2, 0x00008DC3, 0x00008DC4, 0x00008DC5, 0x00008DC6, 0x00008DC7,
+    0x00008DC8, 0x00008DC9, 0x00008DCA, 0x00008DCB, 0x080008DD, 0x00008DCD, 0x00008DCE, 0x00008DCF,
+    0x1000008E, 0x100008E1, 0x100008E2, 0x100008E3, 0x100008E4, 0x100008E5, 0x100008E6, 0x100008E7,
+    0x100008E8, 0x100008E9, 0x100008EA, 0x100008EB, 0x100008EC, 0x100008DE, 0x100008EE, 0x100008EF,
+    0x000008DE, 0x00008DE1, 0x00008DE2, 0x00008DE3, 0x00008DE4, 0x00008DE5, 0x00008DE6, 0x00008DE7,
+    0x00008DE8, 0x00008DE9, 0x00008DEA, 0x00008DEB, 0x00008DEC, 0x00008DED, 0x200008DF, 0x00008DEF,
+    0x000008DF, 0x00008DF1, 0x00008DF2, 0x00008DF3, 0x00008DF4, 0x00008DF5, 0x00008DF6, 0x00008DF7,
+    0x00008DF8, 0x00008DF9, 0x00008DFA, 0x00008DFB, 0x00008DFC, 0x00008DFD, 0x00008DFE, 0x00008DFF,
+    0x0000008E, 0x000008E1, 0x000008E2, 0x000008E3, 0x000008E4, 0x000008E5, 0x000008E6, 0x000008E7,
+    0x000008E8, 0x000008E9, 0x000008EA, 0x000008EB, 0x000008EC, 0x000008ED, 0x2000008F, 0x000008EF,
+    0x000008E1, 0x000108E2, 0x00008E12, 0x00008E13, 0x00008E14, 0x00008E15, 0x00008E16, 0x00008E17,
+    0x00008E18, 0x00008E19, 0x00008E1A, 0x00008E1B, 0x00008E1C, 0x00008E1D, 0x00008E1E, 0x00008E1F,
+    0x000008E2, 0x00008E21, 0x000208E3, 0x00008E23, 0x00008E24, 0x00008E25, 0x00008E26, 0x00008E27,
+    0x00008E28, 0x00008E29, 0x00008E2A, 0x00008E2B, 0x00008E2C, 0x00008E2D, 0x00008E2E, 0x00008E2F,
+    0x000008E3, 0x00008E31, 0x00008E32, 0x000408E4, 0x00008E34, 0x00008E35, 0x00008E36, 0x00008E37,
+    0x00008E38, 0x00008E39, 0x00008E3A, 0x00008E3B, 0x00008E3C, 0x00008E3D, 0x00008E3E, 0x00008E3F,
+    0x000008E4, 0x00008E41, 0x00008E42, 0x00008E43, 0x000808E5, 0x00008E45, 0x00008E46, 0x00008E47,
+    0x00008E48, 0x00008E49, 0x00008E4A, 0x00008E4B, 0x00008E4C, 0x00008E4D, 0x00008E4E, 0x00008E4F,
+    0x000008E5, 0x00008E51, 0x00008E52, 0x00008E53, 0x00008E54, 0x001008E6, 0x00008E56, 0x00008E57,
+    0x00008E58, 0x00008E59, 0x00008E5A, 0x00008E5B, 0x00008E5C, 0x00008E5D, 0x00008E5E, 0x00008E5F,
+    0x000008E6, 0x00008E61, 0x00008E62, 0x00008E63, 0x00008E64, 0x00008E65, 0x002008E7, 0x00008E67,
+    0x00008E68, 0x00008E69, 0x00008E6A, 0x00008E6B, 0x00008E6C, 0x00008E6D, 0x00008E6E, 0x00008E6F,
+    0x000008E7, 0x00008E71, 0x00008E72, 0x00008E73, 0x00008E74, 0x00008E75, 0x00008E76, 0x004008E8,
+    0x00008E78, 0x00008E79, 0x00008E7A, 0x00008E7B, 0x00008E7C, 0x00008E7D, 0x00008E7E, 0x00008E7F,
+    0x000008E8, 0x00008E81, 0x00008E82, 0x00008E83, 0x00008E84, 0x00008E85, 0x00008E86, 0x00008E87,
+    0x008008E9, 0x00008E89, 0x00008E8A, 0x00008E8B, 0x00008E8C, 0x00008E8D, 0x00008E8E, 0x00008E8F,
+    0x000008E9, 0x00008E91, 0x00008E92, 0x00008E93, 0x00008E94, 0x00008E95, 0x00008E96, 0x00008E97,
+    0x00008E98, 0x010008EA, 0x00008E9A, 0x00008E9B, 0x00008E9C, 0x00008E9D, 0x00008E9E, 0x00008E9F,
+    0x000008EA, 0x00008EA1, 0x00008EA2, 0x00008EA3, 0x00008EA4, 0x00008EA5, 0x00008EA6, 0x00008EA7,
+    0x00008EA8, 0x00008EA9, 0x820008EB, 0x00008EAB, 0x00008EAC, 0x00008EAD, 0x00008EAE, 0x00008EAF,
+    0x000008EB, 0x00008EB1, 0x00008EB2, 0x00008EB3, 0x00008EB4, 0x00008EB5, 0x00008EB6, 0x00008EB7,
+    0x00008EB8, 0x00008EB9, 0x00008EBA, 0x040008EC, 0x00008EBC, 0x00008EBD, 0x00008EBE, 0x00008EBF,
+    0x000008EC, 0x00008EC1, 0x00008EC2, 0x00008EC3, 0x00008EC4, 0x00008EC5, 0x00008EC6, 0x00008EC7,
+    0x00008EC8, 0x00008EC9, 0x00008ECA, 0x00008ECB, 0x080008ED, 0x00008ECD, 0x00008ECE, 0x00008ECF,
+    0x000008ED, 0x00008ED1, 0x00008ED2, 0x00008ED3, 0x00008ED4, 0x00008ED5, 0x00008ED6, 0x00008ED7,
+    0x00008ED8, 0x00008ED9, 0x00008EDA, 0x00008EDB, 0x00008EDC, 0x100008EE, 0x00008EDE, 0x00008EDF,
+    0x2000008F, 0x200008F1, 0x200008F2, 0x200008F3, 0x200008F4, 0x200008F5, 0x200008F6, 0x200008F7,
+    0x200008F8, 0x200008F9, 0x200008FA, 0x200008FB, 0x200008FC, 0x200008FD, 0x200008EF, 0x200008FF,
+    0x000008EF, 0x00008EF1, 0x00008EF2, 0x00008EF3, 0x00008EF4, 0x00008EF5, 0x00008EF6, 0x00008EF7,
+    0x00008EF8, 0x00008EF9, 0x00008EFA, 0x00008EFB, 0x00008EFC, 0x00008EFD, 0x00008EFE, 0x00008EFF,
+    0x0000008F, 0x000008F1, 0x000008F2, 0x000008F3, 0x000008F4, 0x000008F5, 0x000008F6, 0x000008F7,
+    0x000008F8, 0x000008F9, 0x000008FA, 0x000008FB, 0x000008FC, 0x000008FD, 0x000008FE, 0x000008FF,
+    0x000008F1, 0x000108F2, 0x00008F12, 0x00008F13, 0x00008F14, 0x00008F15, 0x00008F16, 0x00008F17,
+    0x00008F18, 0x00008F19, 0x00008F1A, 0x00008F1B, 0x00008F1C, 0x00008F1D, 0x00008F1E, 0x00008F1F,
+    0x000008F2, 0x00008F21, 0x000208F3, 0x00008F23, 0x00008F24, 0x00008F25, 0x00008F26, 0x00008F27,
+    0x00008F28, 0x00008F29, 0x00008F2A, 0x00008F2B, 0x00008F2C, 0x00008F2D, 0x00008F2E, 0x00008F2F,
+    0x000008F3, 0x00008F31, 0x00008F32, 0x000408F4, 0x00008F34, 0x00008F35, 0x00008F36, 0x00008F37,
+    0x00008F38, 0x00008F39, 0x00008F3A, 0x00008F3B, 0x00008F3C, 0x00008F3D, 0x00008F3E, 0x00008F3F,
+    0x000008F4, 0x00008F41, 0x00008F42, 0x00008F43, 0x000808F5, 0x00008F45, 0x00008F46, 0x00008F47,
+    0x00008F48, 0x00008F49, 0x00008F4A, 0x00008F4B, 0x00008F4C, 0x00008F4D, 0x00008F4E, 0x00008F4F,
+    0x000008F5, 0x00008F51, 0x00008F52, 0x00008F53, 0x00008F54, 0x001008F6, 0x00008F56, 0x00008F57,
+    0x00008F58, 0x00008F59, 0x00008F5A, 0x00008F5B, 0x00008F5C, 0x00008F5D, 0x00008F5E, 0x00008F5F,
+    0x000008F6, 0x00008F61, 0x00008F62, 0x00008F63, 0x00008F64, 0x00008F65, 0x002008F7, 0x00008F67,
+    0x00008F68, 0x00008F69, 0x00008F6A, 0x00008F6B, 0x00008F6C, 0x00008F6D, 0x00008F6E, 0x00008F6F,
+    0x000008F7, 0x00008F71, 0x00008F72, 0x00008F73, 0x00008F74, 0x00008F75, 0x00008F76, 0x004008F8,
+    0x00008F78, 0x00008F79, 0x00008F7A, 0x00008F7B, 0x00008F7C, 0x00008F7D, 0x00008F7E, 0x00008F7F,
+    0x000008F8, 0x00008F81, 0x00008F82, 0x00008F83, 0x00008F84, 0x00008F85, 0x00008F86, 0x00008F87,
+    0x008008F9, 0x00008F89, 0x00008F8A, 0x00008F8B, 0x00008F8C, 0x00008F8D, 0x00008F8E, 0x00008F8F,
+    0x000008F9, 0x00008F91, 0x00008F92, 0x00008F93, 0x00008F94, 0x00008F95, 0x00008F96, 0x00008F97,
+    0x00008F98, 0x010008FA, 0x00008F9A, 0x00008F9B, 0x00008F9C, 0x00008F9D, 0x00008F9E, 0x00008F9F,
+    0x000008FA, 0x00008FA1, 0x00008FA2, 0x00008FA3, 0x00008FA4, 0x00008FA5, 0x00008FA6, 0x00008FA7,
+    0x00008FA8, 0x00008FA9, 0x820008FB, 0x00008FAB, 0x00008FAC, 0x00008FAD, 0x00008FAE, 0x00008FAF,
+    0x000008FB, 0x00008FB1, 0x00008FB2, 0x00008FB3, 0x00008FB4, 0x00008FB5, 0x00008FB6, 0x00008FB7,
+    0x00008FB8, 0x00008FB9, 0x00008FBA, 0x040008FC, 0x00008FBC, 0x00008FBD, 0x00008FBE, 0x00008FBF,
+    0x000008FC, 0x00008FC1, 0x00008FC2, 0x00008FC3, 0x00008FC4, 0x00008FC5, 0x00008FC6, 0x00008FC7,
+    0x00008FC8, 0x00008FC9, 0x00008FCA, 0x00008FCB, 0x080008FD, 0x00008FCD, 0x00008FCE, 0x00008FCF,
+    0x000008FD, 0x00008FD1, 0x00008FD2, 0x00008FD3, 0x00008FD4, 0x00008FD5, 0x00008FD6, 0x00008FD7,
+    0x00008FD8, 0x00008FD9, 0x00008FDA, 0x00008FDB, 0x00008FDC, 0x100008FE, 0x00008FDE, 0x00008FDF,
+    0x000008FE, 0x00008FE1, 0x00008FE2, 0x00008FE3, 0x00008FE4, 0x00008FE5, 0x00008FE6, 0x00008FE7,
+    0x00008FE8, 0x00008FE9, 0x00008FEA, 0x00008FEB, 0x00008FEC, 0x00008FED, 0x200008FF, 0x00008FEF,
+    0x000008FF, 0x00008FF1, 0x00008FF2, 0x00008FF3, 0x00008FF4, 0x00008FF5, 0x00008FF6, 0x00008FF7,
+    0x00008FF8, 0x00008FF9, 0x00008FFA, 0x00008FFB, 0x00008FFC, 0x00008FFD, 0x00008FFE, 0x00008FFF,
+    0x00000009, 0x00000091, 0x00000092, 0x00000093, 0x00000094, 0x00000095, 0x00000096, 0x00000097,
+    0x00000098, 0x0100000A, 0x0000009A, 0x0000009B, 0x0000009C, 0x0000009D, 0x0000009E, 0x0000009F,
+    0x00000091, 0x00010092, 0x00000912, 0x00000913, 0x00000914, 0x00000915, 0x00000916, 0x00000917,
+    0x00000918, 0x00000919, 0x0000091A, 0x0000091B, 0x0000091C, 0x0000091D, 0x0000091E, 0x0000091F,
+    0x00000092, 0x00000921, 0x00020093, 0x00000923, 0x00000924, 0x00000925, 0x00000926, 0x00000927,
+    0x00000928, 0x00000929, 0x0000092A, 0x0000092B, 0x0000092C, 0x0000092D, 0x0000092E, 0x0000092F,
+    0x00000093, 0x00000931, 0x00000932, 0x00040094, 0x00000934, 0x00000935, 0x00000936, 0x00000937,
+    0x00000938, 0x00000939, 0x0000093A, 0x0000093B, 0x0000093C, 0x0000093D, 0x0000093E, 0x0000093F,
+    0x00000094, 0x00000941, 0x00000942, 0x00000943, 0x00080095, 0x00000945, 0x00000946, 0x00000947,
+    0x00000948, 0x00000949, 0x0000094A, 0x0000094B, 0x0000094C, 0x0000094D, 0x0000094E, 0x0000094F,
+    0x00000095, 0x00000951, 0x00000952, 0x00000953, 0x00000954, 0x00100096, 0x00000956, 0x00000957,
+    0x00000958, 0x00000959, 0x0000095A, 0x0000095B, 0x0000095C, 0x0000095D, 0x0000095E, 0x0000095F,
+    0x00000096, 0x00000961, 0x00000962, 0x00000963, 0x00000964, 0x00000965, 0x00200097, 0x00000967,
+    0x00000968, 0x00000969, 0x0000096A, 0x0000096B, 0x0000096C, 0x0000096D, 0x0000096E, 0x0000096F,
+    0x00000097, 0x00000971, 0x00000972, 0x00000973, 0x00000974, 0x00000975, 0x00000976, 0x00400098,
+    0x00000978, 0x00000979, 0x0000097A, 0x0000097B, 0x0000097C, 0x0000097D, 0x0000097E, 0x0000097F,
+    0x00000098, 0x00000981, 0x00000982, 0x00000983, 0x00000984, 0x00000985, 0x00000986, 0x00000987,
+    0x00800099, 0x00000989, 0x0000098A, 0x0000098B, 0x0000098C, 0x0000098D, 0x0000098E, 0x0000098F,
+    0x0100000A, 0x010000A1, 0x010000A2, 0x010000A3, 0x010000A4, 0x010000A5, 0x010000A6, 0x010000A7,
+    0x010000A8, 0x0100009A, 0x010000AA, 0x010000AB, 0x010000AC, 0x010000AD, 0x010000AE, 0x010000AF,
+    0x0000009A, 0x000009A1, 0x000009A2, 0x000009A3, 0x000009A4, 0x000009A5, 0x000009A6, 0x000009A7,
+    0x000009A8, 0x000009A9, 0x8200009B, 0x000009AB, 0x000009AC, 0x000009AD, 0x000009AE, 0x000009AF,
+    0x0000009B, 0x000009B1, 0x000009B2, 0x000009B3, 0x000009B4, 0x000009B5, 0x000009B6, 0x000009B7,
+    0x000009B8, 0x000009B9, 0x000009BA, 0x0400009C, 0x000009BC, 0x000009BD, 0x000009BE, 0x000009BF,
+    0x0000009C, 0x000009C1, 0x000009C2, 0x000009C3, 0x000009C4, 0x000009C5, 0x000009C6, 0x000009C7,
+    0x000009C8, 0x000009C9, 0x000009CA, 0x000009CB, 0x0800009D, 0x000009CD, 0x000009CE, 0x000009CF,
+    0x0000009D, 0x000009D1, 0x000009D2, 0x000009D3, 0x000009D4, 0x000009D5, 0x000009D6, 0x000009D7,
+    0x000009D8, 0x000009D9, 0x000009DA, 0x000009DB, 0x000009DC, 0x1000009E, 0x000009DE, 0x000009DF,
+    0x0000009E, 0x000009E1, 0x000009E2, 0x000009E3, 0x000009E4, 0x000009E5, 0x000009E6, 0x000009E7,
+    0x000009E8, 0x000009E9, 0x000009EA, 0x000009EB, 0x000009EC, 0x000009ED, 0x2000009F, 0x000009EF,
+    0x0000009F, 0x000009F1, 0x000009F2, 0x000009F3, 0x000009F4, 0x000009F5, 0x000009F6, 0x000009F7,
+    0x000009F8, 0x000009F9, 0x000009FA, 0x000009FB, 0x000009FC, 0x000009FD, 0x000009FE, 0x000009FF,
+    0x00000091, 0x00010092, 0x00000912, 0x00000913, 0x00000914, 0x00000915, 0x00000916, 0x00000917,
+    0x00000918, 0x00000919, 0x0000091A, 0x0000091B, 0x0000091C, 0x0000091D, 0x0000091E, 0x0000091F,
+    0x00010092, 0x00010912, 0x00010922, 0x00010923, 0x00010924, 0x00010925, 0x00010926, 0x00010927,
+    0x00010928, 0x00010929, 0x0001092A, 0x0001092B, 0x0001092C, 0x0001092D, 0x0001092E, 0x0001092F,
+    0x00000912, 0x00009121, 0x00020913, 0x00009123, 0x00009124, 0x00009125, 0x00009126, 0x00009127,
+    0x00009128, 0x00009129, 0x0000912A, 0x0000912B, 0x0000912C, 0x0000912D, 0x0000912E, 0x0000912F,
+    0x00000913, 0x00009131, 0x00009132, 0x00040914, 0x00009134, 0x00009135, 0x00009136, 0x00009137,
+    0x00009138, 0x00009139, 0x0000913A, 0x0000913B, 0x0000913C, 0x0000913D, 0x0000913E, 0x0000913F,
+    0x00000914, 0x00009141, 0x00009142, 0x00009143, 0x00080915, 0x00009145, 0x00009146, 0x00009147,
+    0x00009148, 0x00009149, 0x0000914A, 0x0000914B, 0x0000914C, 0x0000914D, 0x0000914E, 0x0000914F,
+    0x00000915, 0x00009151, 0x00009152, 0x00009153, 0x00009154, 0x00100916, 0x00009156, 0x00009157,
+    0x00009158, 0x00009159, 0x0000915A, 0x0000915B, 0x0000915C, 0x0000915D, 0x0000915E, 0x0000915F,
+    0x00000916, 0x00009161, 0x00009162, 0x00009163, 0x00009164, 0x00009165, 0x00200917, 0x00009167,
+    0x00009168, 0x00009169, 0x0000916A, 0x0000916B, 0x0000916C, 0x0000916D, 0x0000916E, 0x0000916F,
+    0x00000917, 0x00009171, 0x00009172, 0x00009173, 0x00009174, 0x00009175, 0x00009176, 0x00400918,
+    0x00009178, 0x00009179, 0x0000917A, 0x0000917B, 0x0000917C, 0x0000917D, 0x0000917E, 0x0000917F,
+    0x00000918, 0x00009181, 0x00009182, 0x00009183, 0x00009184, 0x00009185, 0x00009186, 0x00009187,
+    0x00800919, 0x00009189, 0x0000918A, 0x0000918B, 0x0000918C, 0x0000918D, 0x0000918E, 0x0000918F,
+    0x00000919, 0x00009191, 0x00009192, 0x00009193, 0x00009194, 0x00009195, 0x00009196, 0x00009197,
+    0x00009198, 0x0100091A, 0x0000919A, 0x0000919B, 0x0000919C, 0x0000919D, 0x0000919E, 0x0000919F,
+    0x0000091A, 0x000091A1, 0x000091A2, 0x000091A3, 0x000091A4, 0x000091A5, 0x000091A6, 0x000091A7,
+    0x000091A8, 0x000091A9, 0x8200091B, 0x000091AB, 0x000091AC, 0x000091AD, 0x000091AE, 0x000091AF,
+    0x0000091B, 0x000091B1, 0x000091B2, 0x000091B3, 0x000091B4, 0x000091B5, 0x000091B6, 0x000091B7,
+    0x000091B8, 0x000091B9, 0x000091BA, 0x0400091C, 0x000091BC, 0x000091BD, 0x000091BE, 0x000091BF,
+    0x0000091C, 0x000091C1, 0x000091C2, 0x000091C3, 0x000091C4, 0x000091C5, 0x000091C6, 0x000091C7,
+    0x000091C8, 0x000091C9, 0x000091CA, 0x000091CB, 0x0800091D, 0x000091CD, 0x000091CE, 0x000091CF,
+    0x0000091D, 0x000091D1, 0x000091D2, 0x000091D3, 0x000091D4, 0x000091D5, 0x000091D6, 0x000091D7,
+    0x000091D8, 0x000091D9, 0x000091DA, 0x000091DB, 0x000091DC, 0x1000091E, 0x000091DE, 0x000091DF,
+    0x0000091E, 0x000091E1, 0x000091E2, 0x000091E3, 0x000091E4, 0x000091E5, 0x000091E6, 0x000091E7,
+    0x000091E8, 0x000091E9, 0x000091EA, 0x000091EB, 0x000091EC, 0x000091ED, 0x2000091F, 0x000091EF,
+    0x0000091F, 0x000091F1, 0x000091F2, 0x000091F3, 0x000091F4, 0x000091F5, 0x000091F6, 0x000091F7,
+    0x000091F8, 0x000091F9, 0x000091FA, 0x000091FB, 0x000091FC, 0x000091FD, 0x000091FE, 0x000091FF,
+    0x00000092, 0x00000921, 0x00020093, 0x00000923, 0x00000924, 0x00000925, 0x00000926, 0x00000927,
+    0x00000928, 0x00000929, 0x0000092A, 0x0000092B, 0x0000092C, 0x0000092D, 0x0000092E, 0x0000092F,
+    0x00000921, 0x00010922, 0x00009212, 0x00009213, 0x00009214, 0x00009215, 0x00009216, 0x00009217,
+    0x00009218, 0x00009219, 0x0000921A, 0x0000921B, 0x0000921C, 0x0000921D, 0x0000921E, 0x0000921F,
+    0x00020093, 0x00020931, 0x00020923, 0x00020933, 0x00020934, 0x00020935, 0x00020936, 0x00020937,
+    0x00020938, 0x00020939, 0x0002093A, 0x0002093B, 0x0002093C, 0x0002093D, 0x0002093E, 0x0002093F,
+    0x00000923, 0x00009231, 0x00009232, 0x00040924, 0x00009234, 0x00009235, 0x00009236, 0x00009237,
+    0x00009238, 0x00009239, 0x0000923A, 0x0000923B, 0x0000923C, 0x0000923D, 0x0000923E, 0x0000923F,
+    0x00000924, 0x00009241, 0x00009242, 0x00009243, 0x00080925, 0x00009245, 0x00009246, 0x00009247,
+    0x00009248, 0x00009249, 0x0000924A, 0x0000924B, 0x0000924C, 0x0000924D, 0x0000924E, 0x0000924F,
+    0x00000925, 0x00009251, 0x00009252, 0x00009253, 0x00009254, 0x00100926, 0x00009256, 0x00009257,
+    0x00009258, 0x00009259, 0x0000925A, 0x0000925B, 0x0000925C, 0x0000925D, 0x0000925E, 0x0000925F,
+    0x00000926, 0x00009261, 0x00009262, 0x00009263, 0x00009264, 0x00009265, 0x00200927, 0x00009267,
+    0x00009268, 0x00009269, 0x0000926A, 0x0000926B, 0x0000926C, 0x0000926D, 0x0000926E, 0x0000926F,
+    0x00000927, 0x00009271, 0x00009272, 0x00009273, 0x00009274, 0x00009275, 0x00009276, 0x00400928,
+    0x00009278, 0x00009279, 0x0000927A, 0x0000927B, 0x0000927C, 0x0000927D, 0x0000927E, 0x0000927F,
+    0x00000928, 0x00009281, 0x00009282, 0x00009283, 0x00009284, 0x00009285, 0x00009286, 0x00009287,
+    0x00800929, 0x00009289, 0x0000928A, 0x0000928B, 0x0000928C, 0x0000928D, 0x0000928E, 0x0000928F,
+    0x00000929, 0x00009291, 0x00009292, 0x00009293, 0x00009294, 0x00009295, 0x00009296, 0x00009297,
+    0x00009298, 0x0100092A, 0x0000929A, 0x0000929B, 0x0000929C, 0x0000929D, 0x0000929E, 0x0000929F,
+    0x0000092A, 0x000092A1, 0x000092A2, 0x000092A3, 0x000092A4, 0x000092A5, 0x000092A6, 0x000092A7,
+    0x000092A8, 0x000092A9, 0x8200092B, 0x000092AB, 0x000092AC, 0x000092AD, 0x000092AE, 0x000092AF,
+    0x0000092B, 0x000092B1, 0x000092B2, 0x000092B3, 0x000092B4, 0x000092B5, 0x000092B6, 0x000092B7,
+    0x000092B8, 0x000092B9, 0x000092BA, 0x0400092C, 0x000092BC, 0x000092BD, 0x000092BE, 0x000092BF,
+    0x0000092C, 0x000092C1, 0x000092C2, 0x000092C3, 0x000092C4, 0x000092C5, 0x000092C6, 0x000092C7,
+    0x000092C8, 0x000092C9, 0x000092CA, 0x000092CB, 0x0800092D, 0x000092CD, 0x000092CE, 0x000092CF,
+    0x0000092D, 0x000092D1, 0x000092D2, 0x000092D3, 0x000092D4, 0x000092D5, 0x000092D6, 0x000092D7,
+    0x000092D8, 0x000092D9, 0x000092DA, 0x000092DB, 0x000092DC, 0x1000092E, 0x000092DE, 0x000092DF,
+    0x0000092E, 0x000092E1, 0x000092E2, 0x000092E3, 0x000092E4, 0x000092E5, 0x000092E6, 0x000092E7,
+    0x000092E8, 0x000092E9, 0x000092EA, 0x000092EB, 0x000092EC, 0x000092ED, 0x2000092F, 0x000092EF,
+    0x0000092F, 0x000092F1, 0x000092F2, 0x000092F3, 0x000092F4, 0x000092F5, 0x000092F6, 0x000092F7,
+    0x000092F8, 0x000092F9, 0x000092FA, 0x000092FB, 0x000092FC, 0x000092FD, 0x000092FE, 0x000092FF,
+    0x00000093, 0x00000931, 0x00000932, 0x00040094, 0x00000934, 0x00000935, 0x00000936, 0x00000937,
+    0x00000938, 0x00000939, 0x0000093A, 0x0000093B, 0x0000093C, 0x0000093D, 0x0000093E, 0x0000093F,
+    0x00000931, 0x00010932, 0x00009312, 0x00009313, 0x00009314, 0x00009315, 0x00009316, 0x00009317,
+    0x00009318, 0x00009319, 0x0000931A, 0x0000931B, 0x0000931C, 0x0000931D, 0x0000931E, 0x0000931F,
+    0x00000932, 0x00009321, 0x00020933, 0x00009323, 0x00009324, 0x00009325, 0x00009326, 0x00009327,
+    0x00009328, 0x00009329, 0x0000932A, 0x0000932B, 0x0000932C, 0x0000932D, 0x0000932E, 0x0000932F,
+    0x00040094, 0x00040941, 0x00040942, 0x00040934, 0x00040944, 0x00040945, 0x00040946, 0x00040947,
+    0x00040948, 0x00040949, 0x0004094A, 0x0004094B, 0x0004094C, 0x0004094D, 0x0004094E, 0x0004094F,
+    0x00000934, 0x00009341, 0x00009342, 0x00009343, 0x00080935, 0x00009345, 0x00009346, 0x00009347,
+    0x00009348, 0x00009349, 0x0000934A, 0x0000934B, 0x0000934C, 0x0000934D, 0x0000934E, 0x0000934F,
+    0x00000935, 0x00009351, 0x00009352, 0x00009353, 0x00009354, 0x00100936, 0x00009356, 0x00009357,
+    0x00009358, 0x00009359, 0x0000935A, 0x0000935B, 0x0000935C, 0x0000935D, 0x0000935E, 0x0000935F,
+    0x00000936, 0x00009361, 0x00009362, 0x00009363, 0x00009364, 0x00009365, 0x00200937, 0x00009367,
+    0x00009368, 0x00009369, 0x0000936A, 0x0000936B, 0x0000936C, 0x0000936D, 0x0000936E, 0x0000936F,
+    0x00000937, 0x00009371, 0x00009372, 0x00009373, 0x00009374, 0x00009375, 0x00009376, 0x00400938,
+    0x00009378, 0x00009379, 0x0000937A, 0x0000937B, 0x0000937C, 0x0000937D, 0x0000937E, 0x0000937F,
+    0x00000938, 0x00009381, 0x00009382, 0x00009383, 0x00009384, 0x00009385, 0x00009386, 0x00009387,
+    0x00800939, 0x00009389, 0x0000938A, 0x0000938B, 0x0000938C, 0x0000938D, 0x0000938E, 0x0000938F,
+    0x00000939, 0x00009391, 0x00009392, 0x00009393, 0x00009394, 0x00009395, 0x00009396, 0x00009397,
+    0x00009398, 0x0100093A, 0x0000939A, 0x0000939B, 0x0000939C, 0x0000939D, 0x0000939E, 0x0000939F,
+    0x0000093A, 0x000093A1, 0x000093A2, 0x000093A3, 0x000093A4, 0x000093A5, 0x000093A6, 0x000093A7,
+    0x000093A8, 0x000093A9, 0x8200093B, 0x000093AB, 0x000093AC, 0x000093AD, 0x000093AE, 0x000093AF,
+    0x0000093B, 0x000093B1, 0x000093B2, 0x000093B3, 0x000093B4, 0x000093B5, 0x000093B6, 0x000093B7,
+    0x000093B8, 0x000093B9, 0x000093BA, 0x0400093C, 0x000093BC, 0x000093BD, 0x000093BE, 0x000093BF,
+    0x0000093C, 0x000093C1, 0x000093C2, 0x000093C3, 0x000093C4, 0x000093C5, 0x000093C6, 0x000093C7,
+    0x000093C8, 0x000093C9, 0x000093CA, 0x000093CB, 0x0800093D, 0x000093CD, 0x000093CE, 0x000093CF,
+    0x0000093D, 0x000093D1, 0x000093D2, 0x000093D3, 0x000093D4, 0x000093D5, 0x000093D6, 0x000093D7,
+    0x000093D8, 0x000093D9, 0x000093DA, 0x000093DB, 0x000093DC, 0x1000093E, 0x000093DE, 0x000093DF,
+    0x0000093E, 0x000093E1, 0x000093E2, 0x000093E3, 0x000093E4, 0x000093E5, 0x000093E6, 0x000093E7,
+    0x000093E8, 0x000093E9, 0x000093EA, 0x000093EB, 0x000093EC, 0x000093ED, 0x2000093F, 0x000093EF,
+    0x0000093F, 0x000093F1, 0x000093F2, 0x000093F3, 0x000093F4, 0x000093F5, 0x000093F6, 0x000093F7,
+    0x000093F8, 0x000093F9, 0x000093FA, 0x000093FB, 0x000093FC, 0x000093FD, 0x000093FE, 0x000093FF,
+    0x00000094, 0x00000941, 0x00000942, 0x00000943, 0x00080095, 0x00000945, 0x00000946, 0x00000947,
+    0x00000948, 0x00000949, 0x0000094A, 0x0000094B, 0x0000094C, 0x0000094D, 0x0000094E, 0x0000094F,
+    0x00000941, 0x00010942, 0x00009412, 0x00009413, 0x00009414, 0x00009415, 0x00009416, 0x00009417,
+    0x00009418, 0x00009419, 0x0000941A, 0x0000941B, 0x0000941C, 0x0000941D, 0x0000941E, 0x0000941F,
+    0x00000942, 0x00009421, 0x00020943, 0x00009423, 0x00009424, 0x00009425, 0x00009426, 0x00009427,
+    0x00009428, 0x00009429, 0x0000942A, 0x0000942B, 0x0000942C, 0x0000942D, 0x0000942E, 0x0000942F,
+    0x00000943, 0x00009431, 0x00009432, 0x00040944, 0x00009434, 0x00009435, 0x00009436, 0x00009437,
+    0x00009438, 0x00009439, 0x0000943A, 0x0000943B, 0x0000943C, 0x0000943D, 0x0000943E, 0x0000943F,
+    0x00080095, 0x00080951, 0x00080952, 0x00080953, 0x00080945, 0x00080955, 0x00080956, 0x00080957,
+    0x00080958, 0x00080959, 0x0008095A, 0x0008095B, 0x0008095C, 0x0008095D, 0x0008095E, 0x0008095F,
+    0x00000945, 0x00009451, 0x00009452, 0x00009453, 0x00009454, 0x00100946, 0x00009456, 0x00009457,
+    0x00009458, 0x00009459, 0x0000945A, 0x0000945B, 0x0000945C, 0x0000945D, 0x0000945E, 0x0000945F,
+    0x00000946, 0x00009461, 0x00009462, 0x00009463, 0x00009464, 0x00009465, 0x00200947, 0x00009467,
+    0x00009468, 0x00009469, 0x0000946A, 0x0000946B, 0x0000946C, 0x0000946D, 0x0000946E, 0x0000946F,
+    0x00000947, 0x00009471, 0x00009472, 0x00009473, 0x00009474, 0x00009475, 0x00009476, 0x00400948,
+    0x00009478, 0x00009479, 0x0000947A, 0x0000947B, 0x0000947C, 0x0000947D, 0x0000947E, 0x0000947F,
+    0x00000948, 0x00009481, 0x00009482, 0x00009483, 0x00009484, 0x00009485, 0x00009486, 0x00009487,
+    0x00800949, 0x00009489, 0x0000948A, 0x0000948B, 0x0000948C, 0x0000948D, 0x0000948E, 0x0000948F,
+    0x00000949, 0x00009491, 0x00009492, 0x00009493, 0x00009494, 0x00009495, 0x00009496, 0x00009497,
+    0x00009498, 0x0100094A, 0x0000949A, 0x0000949B, 0x0000949C, 0x0000949D, 0x0000949E, 0x0000949F,
+    0x0000094A, 0x000094A1, 0x000094A2, 0x000094A3, 0x000094A4, 0x000094A5, 0x000094A6, 0x000094A7,
+    0x000094A8, 0x000094A9, 0x8200094B, 0x000094AB, 0x000094AC, 0x000094AD, 0x000094AE, 0x000094AF,
+    0x0000094B, 0x000094B1, 0x000094B2, 0x000094B3, 0x000094B4, 0x000094B5, 0x000094B6, 0x000094B7,
+    0x000094B8, 0x000094B9, 0x000094BA, 0x0400094C, 0x000094BC, 0x000094BD, 0x000094BE, 0x000094BF,
+    0x0000094C, 0x000094C1, 0x000094C2, 0x000094C3, 0x000094C4, 0x000094C5, 0x000094C6, 0x000094C7,
+    0x000094C8, 0x000094C9, 0x000094CA, 0x000094CB, 0x0800094D, 0x000094CD, 0x000094CE, 0x000094CF,
+    0x0000094D, 0x000094D1, 0x000094D2, 0x000094D3, 0x000094D4, 0x000094D5, 0x000094D6, 0x000094D7,
+    0x000094D8, 0x000094D9, 0x000094DA, 0x000094DB, 0x000094DC, 0x1000094E, 0x000094DE, 0x000094DF,
+    0x0000094E, 0x000094E1, 0x000094E2, 0x000094E3, 0x000094E4, 0x000094E5, 0x000094E6, 0x000094E7,
+    0x000094E8, 0x000094E9, 0x000094EA, 0x000094EB, 0x000094EC, 0x000094ED, 0x2000094F, 0x000094EF,
+    0x0000094F, 0x000094F1, 0x000094F2, 0x000094F3, 0x000094F4, 0x000094F5, 0x000094F6, 0x000094F7,
+    0x000094F8, 0x000094F9, 0x000094FA, 0x000094FB, 0x000094FC, 0x000094FD, 0x000094FE, 0x000094FF,
+    0x00000095, 0x00000951, 0x00000952, 0x00000953, 0x00000954, 0x00100096, 0x00000956, 0x00000957,
+    0x00000958, 0x00000959, 0x0000095A, 0x0000095B, 0x0000095C, 0x0000095D, 0x0000095E, 0x0000095F,
+    0x00000951, 0x00010952, 0x00009512, 0x00009513, 0x00009514, 0x00009515, 0x00009516, 0x00009517,
+    0x00009518, 0x00009519, 0x0000951A, 0x0000951B, 0x0000951C, 0x0000951D, 0x0000951E, 0x0000951F,
+    0x00000952, 0x00009521, 0x00020953, 0x00009523, 0x00009524, 0x00009525, 0x00009526, 0x00009527,
+    0x00009528, 0x00009529, 0x0000952A, 0x0000952B, 0x0000952C, 0x0000952D, 0x0000952E, 0x0000952F,
+    0x00000953, 0x00009531, 0x00009532, 0x00040954, 0x00009534, 0x00009535, 0x00009536, 0x00009537,
+    0x00009538, 0x00009539, 0x0000953A, 0x0000953B, 0x0000953C, 0x0000953D, 0x0000953E, 0x0000953F,
+    0x00000954, 0x00009541, 0x00009542, 0x00009543, 0x00080955, 0x00009545, 0x00009546, 0x00009547,
+    0x00009548, 0x00009549, 0x0000954A, 0x0000954B, 0x0000954C, 0x0000954D, 0x0000954E, 0x0000954F,
+    0x00100096, 0x00100961, 0x00100962, 0x00100963, 0x00100964, 0x00100956, 0x00100966, 0x00100967,
+    0x00100968, 0x00100969, 0x0010096A, 0x0010096B, 0x0010096C, 0x0010096D, 0x0010096E, 0x0010096F,
+    0x00000956, 0x00009561, 0x00009562, 0x00009563, 0x00009564, 0x00009565, 0x00200957, 0x00009567,
+    0x00009568, 0x00009569, 0x0000956A, 0x0000956B, 0x0000956C, 0x0000956D, 0x0000956E, 0x0000956F,
+    0x00000957, 0x00009571, 0x00009572, 0x00009573, 0x00009574, 0x00009575, 0x00009576, 0x00400958,
+    0x00009578, 0x00009579, 0x0000957A, 0x0000957B, 0x0000957C, 0x0000957D, 0x0000957E, 0x0000957F,
+    0x00000958, 0x00009581, 0x00009582, 0x00009583, 0x00009584, 0x00009585, 0x00009586, 0x00009587,
+    0x00800959, 0x00009589, 0x0000958A, 0x0000958B, 0x0000958C, 0x0000958D, 0x0000958E, 0x0000958F,
+    0x00000959, 0x00009591, 0x00009592, 0x00009593, 0x00009594, 0x00009595, 0x00009596, 0x00009597,
+    0x00009598, 0x0100095A, 0x0000959A, 0x0000959B, 0x0000959C, 0x0000959D, 0x0000959E, 0x0000959F,
+    0x0000095A, 0x000095A1, 0x000095A2, 0x000095A3, 0x000095A4, 0x000095A5, 0x000095A6, 0x000095A7,
+    0x000095A8, 0x000095A9, 0x8200095B, 0x000095AB, 0x000095AC, 0x000095AD, 0x000095AE, 0x000095AF,
+    0x0000095B, 0x000095B1, 0x000095B2, 0x000095B3, 0x000095B4, 0x000095B5, 0x000095B6, 0x000095B7,
+    0x000095B8, 0x000095B9, 0x000095BA, 0x0400095C, 0x000095BC, 0x000095BD, 0x000095BE, 0x000095BF,
+    0x0000095C, 0x000095C1, 0x000095C2, 0x000095C3, 0x000095C4, 0x000095C5, 0x000095C6, 0x000095C7,
+    0x000095C8, 0x000095C9, 0x000095CA, 0x000095CB, 0x0800095D, 0x000095CD, 0x000095CE, 0x000095CF,
+    0x0000095D, 0x000095D1, 0x000095D2, 0x000095D3, 0x000095D4, 0x000095D5, 0x000095D6, 0x000095D7,
+    0x000095D8, 0x000095D9, 0x000095DA, 0x000095DB, 0x000095DC, 0x1000095E, 0x000095DE, 0x000095DF,
+    0x0000095E, 0x000095E1, 0x000095E2, 0x000095E3, 0x000095E4, 0x000095E5, 0x000095E6, 0x000095E7,
+    0x000095E8, 0x000095E9, 0x000095EA, 0x000095EB, 0x000095EC, 0x000095ED, 0x2000095F, 0x000095EF,
+    0x0000095F, 0x000095F1, 0x000095F2, 0x000095F3, 0x000095F4, 0x000095F5, 0x000095F6, 0x000095F7,
+    0x000095F8, 0x000095F9, 0x000095FA, 0x000095FB, 0x000095FC, 0x000095FD, 0x000095FE, 0x000095FF,
+    0x00000096, 0x00000961, 0x00000962, 0x00000963, 0x00000964, 0x00000965, 0x00200097, 0x00000967,
+    0x00000968, 0x00000969, 0x0000096A, 0x0000096B, 0x0000096C, 0x0000096D, 0x0000096E, 0x0000096F,
+    0x00000961, 0x00010962, 0x00009612, 0x00009613, 0x00009614, 0x00009615, 0x00009616, 0x00009617,
+    0x00009618, 0x00009619, 0x0000961A, 0x0000961B, 0x0000961C, 0x0000961D, 0x0000961E, 0x0000961F,
+    0x00000962, 0x00009621, 0x00020963, 0x00009623, 0x00009624, 0x00009625, 0x00009626, 0x00009627,
+    0x00009628, 0x00009629, 0x0000962A, 0x0000962B, 0x0000962C, 0x0000962D, 0x0000962E, 0x0000962F,
+    0x00000963, 0x00009631, 0x00009632, 0x00040964, 0x00009634, 0x00009635, 0x00009636, 0x00009637,
+    0x00009638, 0x00009639, 0x0000963A, 0x0000963B, 0x0000963C, 0x0000963D, 0x0000963E, 0x0000963F,
+    0x00000964, 0x00009641, 0x00009642, 0x00009643, 0x00080965, 0x00009645, 0x00009646, 0x00009647,
+    0x00009648, 0x00009649, 0x0000964A, 0x0000964B, 0x0000964C, 0x0000964D, 0x0000964E, 0x0000964F,
+    0x00000965, 0x00009651, 0x00009652, 0x00009653, 0x00009654, 0x00100966, 0x00009656, 0x00009657,
+    0x00009658, 0x00009659, 0x0000965A, 0x0000965B, 0x0000965C, 0x0000965D, 0x0000965E, 0x0000965F,
+    0x00200097, 0x00200971, 0x00200972, 0x00200973, 0x00200974, 0x00200975, 0x00200967, 0x00200977,
+    0x00200978, 0x00200979, 0x0020097A, 0x0020097B, 0x0020097C, 0x0020097D, 0x0020097E, 0x0020097F,
+    0x00000967, 0x00009671, 0x00009672, 0x00009673, 0x00009674, 0x00009675, 0x00009676, 0x00400968,
+    0x00009678, 0x00009679, 0x0000967A, 0x0000967B, 0x0000967C, 0x0000967D, 0x0000967E, 0x0000967F,
+    0x00000968, 0x00009681, 0x00009682, 0x00009683, 0x00009684, 0x00009685, 0x00009686, 0x00009687,
+    0x00800969, 0x00009689, 0x0000968A, 0x0000968B, 0x0000968C, 0x0000968D, 0x0000968E, 0x0000968F,
+    0x00000969, 0x00009691, 0x00009692, 0x00009693, 0x00009694, 0x00009695, 0x00009696, 0x00009697,
+    0x00009698, 0x0100096A, 0x0000969A, 0x0000969B, 0x0000969C, 0x0000969D, 0x0000969E, 0x0000969F,
+    0x0000096A, 0x000096A1, 0x000096A2, 0x000096A3, 0x000096A4, 0x000096A5, 0x000096A6, 0x000096A7,
+    0x000096A8, 0x000096A9, 0x8200096B, 0x000096AB, 0x000096AC, 0x000096AD, 0x000096AE, 0x000096AF,
+    0x0000096B, 0x000096B1, 0x000096B2, 0x000096B3, 0x000096B4, 0x000096B5, 0x000096B6, 0x000096B7,
+    0x000096B8, 0x000096B9, 0x000096BA, 0x0400096C, 0x000096BC, 0x000096BD, 0x000096BE, 0x000096BF,
+    0x0000096C, 0x000096C1, 0x000096C2, 0x000096C3, 0x000096C4, 0x000096C5, 0x000096C6, 0x000096C7,
+    0x000096C8, 0x000096C9, 0x000096CA, 0x000096CB, 0x0800096D, 0x000096CD, 0x000096CE, 0x000096CF,
+    0x0000096D, 0x000096D1, 0x000096D2, 0x000096D3, 0x000096D4, 0x000096D5, 0x000096D6, 0x000096D7,
+    0x000096D8, 0x000096D9, 0x000096DA, 0x000096DB, 0x000096DC, 0x1000096E, 0x000096DE, 0x000096DF,
+    0x0000096E, 0x000096E1, 0x000096E2, 0x000096E3, 0x000096E4, 0x000096E5, 0x000096E6, 0x000096E7,
+    0x000096E8, 0x000096E9, 0x000096EA, 0x000096EB, 0x000096EC, 0x000096ED, 0x2000096F, 0x000096EF,
+    0x0000096F, 0x000096F1, 0x000096F2, 0x000096F3, 0x000096F4, 0x000096F5, 0x000096F6, 0x000096F7,
+    0x000096F8, 0x000096F9, 0x000096FA, 0x000096FB, 0x000096FC, 0x000096FD, 0x000096FE, 0x000096FF,
+    0x00000097, 0x00000971, 0x00000972, 0x00000973, 0x00000974, 0x00000975, 0x00000976, 0x00400098,
+    0x00000978, 0x00000979, 0x0000097A, 0x0000097B, 0x0000097C, 0x0000097D, 0x0000097E, 0x0000097F,
+    0x00000971, 0x00010972, 0x00009712, 0x00009713, 0x00009714, 0x00009715, 0x00009716, 0x00009717,
+    0x00009718, 0x00009719, 0x0000971A, 0x0000971B, 0x0000971C, 0x0000971D, 0x0000971E, 0x0000971F,
+    0x00000972, 0x00009721, 0x00020973, 0x00009723, 0x00009724, 0x00009725, 0x00009726, 0x00009727,
+    0x00009728, 0x00009729, 0x0000972A, 0x0000972B, 0x0000972C, 0x0000972D, 0x0000972E, 0x0000972F,
+    0x00000973, 0x00009731, 0x00009732, 0x00040974, 0x00009734, 0x00009735, 0x00009736, 0x00009737,
+    0x00009738, 0x00009739, 0x0000973A, 0x0000973B, 0x0000973C, 0x0000973D, 0x0000973E, 0x0000973F,
+    0x00000974, 0x00009741, 0x00009742, 0x00009743, 0x00080975, 0x00009745, 0x00009746, 0x00009747,
+    0x00009748, 0x00009749, 0x0000974A, 0x0000974B, 0x0000974C, 0x0000974D, 0x0000974E, 0x0000974F,
+    0x00000975, 0x00009751, 0x00009752, 0x00009753, 0x00009754, 0x00100976, 0x00009756, 0x00009757,
+    0x00009758, 0x00009759, 0x0000975A, 0x0000975B, 0x0000975C, 0x0000975D, 0x0000975E, 0x0000975F,
+    0x00000976, 0x00009761, 0x00009762, 0x00009763, 0x00009764, 0x00009765, 0x00200977, 0x00009767,
+    0x00009768, 0x00009769, 0x0000976A, 0x0000976B, 0x0000976C, 0x0000976D, 0x0000976E, 0x0000976F,
+    0x00400098, 0x00400981, 0x00400982, 0x00400983, 0x00400984, 0x00400985, 0x00400986, 0x00400978,
+    0x00400988, 0x00400989, 0x0040098A, 0x0040098B, 0x0040098C, 0x0040098D, 0x0040098E, 0x0040098F,
+    0x00000978, 0x00009781, 0x00009782, 0x00009783, 0x00009784, 0x00009785, 0x00009786, 0x00009787,
+    0x00800979, 0x00009789, 0x0000978A, 0x0000978B, 0x0000978C, 0x0000978D, 0x0000978E, 0x0000978F,
+    0x00000979, 0x00009791, 0x00009792, 0x00009793, 0x00009794, 0x00009795, 0x00009796, 0x00009797,
+    0x00009798, 0x0100097A, 0x0000979A, 0x0000979B, 0x0000979C, 0x0000979D, 0x0000979E, 0x0000979F,
+    0x0000097A, 0x000097A1, 0x000097A2, 0x000097A3, 0x000097A4, 0x000097A5, 0x000097A6, 0x000097A7,
+    0x000097A8, 0x000097A9, 0x8200097B, 0x000097AB, 0x000097AC, 0x000097AD, 0x000097AE, 0x000097AF,
+    0x0000097B, 0x000097B1, 0x000097B2, 0x000097B3, 0x000097B4, 0x000097B5, 0x000097B6, 0x000097B7,
+    0x000097B8, 0x000097B9, 0x000097BA, 0x0400097C, 0x000097BC, 0x000097BD, 0x000097BE, 0x000097BF,
+    0x0000097C, 0x000097C1, 0x000097C2, 0x000097C3, 0x000097C4, 0x000097C5, 0x000097C6, 0x000097C7,
+    0x000097C8, 0x000097C9, 0x000097CA, 0x000097CB, 0x0800097D, 0x000097CD, 0x000097CE, 0x000097CF,
+    0x0000097D, 0x000097D1, 0x000097D2, 0x000097D3, 0x000097D4, 0x000097D5, 0x000097D6, 0x000097D7,
+    0x000097D8, 0x000097D9, 0x000097DA, 0x000097DB, 0x000097DC, 0x1000097E, 0x000097DE, 0x000097DF,
+    0x0000097E, 0x000097E1, 0x000097E2, 0x000097E3, 0x000097E4, 0x000097E5, 0x000097E6, 0x000097E7,
+    0x000097E8, 0x000097E9, 0x000097EA, 0x000097EB, 0x000097EC, 0x000097ED, 0x2000097F, 0x000097EF,
+    0x0000097F, 0x000097F1, 0x000097F2, 0x000097F3, 0x000097F4, 0x000097F5, 0x000097F6, 0x000097F7,
+    0x000097F8, 0x000097F9, 0x000097FA, 0x000097FB, 0x000097FC, 0x000097FD, 0x000097FE, 0x000097FF,
+    0x00000098, 0x00000981, 0x00000982, 0x00000983, 0x00000984, 0x00000985, 0x00000986, 0x00000987,
+    0x00800099, 0x00000989, 0x0000098A, 0x0000098B, 0x0000098C, 0x0000098D, 0x0000098E, 0x0000098F,
+    0x00000981, 0x00010982, 0x00009812, 0x00009813, 0x00009814, 0x00009815, 0x00009816, 0x00009817,
+    0x00009818, 0x00009819, 0x0000981A, 0x0000981B, 0x0000981C, 0x0000981D, 0x0000981E, 0x0000981F,
+    0x00000982, 0x00009821, 0x00020983, 0x00009823, 0x00009824, 0x00009825, 0x00009826, 0x00009827,
+    0x00009828, 0x00009829, 0x0000982A, 0x0000982B, 0x0000982C, 0x0000982D, 0x0000982E, 0x0000982F,
+    0x00000983, 0x00009831, 0x00009832, 0x00040984, 0x00009834, 0x00009835, 0x00009836, 0x00009837,
+    0x00009838, 0x00009839, 0x0000983A, 0x0000983B, 0x0000983C, 0x0000983D, 0x0000983E, 0x0000983F,
+    0x00000984, 0x00009841, 0x00009842, 0x00009843, 0x00080985, 0x00009845, 0x00009846, 0x00009847,
+    0x00009848, 0x00009849, 0x0000984A, 0x0000984B, 0x0000984C, 0x0000984D, 0x0000984E, 0x0000984F,
+    0x00000985, 0x00009851, 0x00009852, 0x00009853, 0x00009854, 0x00100986, 0x00009856, 0x00009857,
+    0x00009858, 0x00009859, 0x0000985A, 0x0000985B, 0x0000985C, 0x0000985D, 0x0000985E, 0x0000985F,
+    0x00000986, 0x00009861, 0x00009862, 0x00009863, 0x00009864, 0x00009865, 0x00200987, 0x00009867,
+    0x00009868, 0x00009869, 0x0000986A, 0x0000986B, 0x0000986C, 0x0000986D, 0x0000986E, 0x0000986F,
+    0x00000987, 0x00009871, 0x00009872, 0x00009873, 0x00009874, 0x00009875, 0x00009876, 0x00400988,
+    0x00009878, 0x00009879, 0x0000987A, 0x0000987B, 0x0000987C, 0x0000987D, 0x0000987E, 0x0000987F,
+    0x00800099, 0x00800991, 0x00800992, 0x00800993, 0x00800994, 0x00800995, 0x00800996, 0x00800997,
+    0x00800989, 0x00800999, 0x0080099A, 0x0080099B, 0x0080099C, 0x0080099D, 0x0080099E, 0x0080099F,
+    0x00000989, 0x00009891, 0x00009892, 0x00009893, 0x00009894, 0x00009895, 0x00009896, 0x00009897,
+    0x00009898, 0x0100098A, 0x0000989A, 0x0000989B, 0x0000989C, 0x0000989D, 0x0000989E, 0x0000989F,
+    0x0000098A, 0x000098A1, 0x000098A2, 0x000098A3, 0x000098A4, 0x000098A5, 0x000098A6, 0x000098A7,
+    0x000098A8, 0x000098A9, 0x8200098B, 0x000098AB, 0x000098AC, 0x000098AD, 0x000098AE, 0x000098AF,
+    0x0000098B, 0x000098B1, 0x000098B2, 0x000098B3, 0x000098B4, 0x000098B5, 0x000098B6, 0x000098B7,
+    0x000098B8, 0x000098B9, 0x000098BA, 0x0400098C, 0x000098BC, 0x000098BD, 0x000098BE, 0x000098BF,
+    0x0000098C, 0x000098C1, 0x000098C2, 0x000098C3, 0x000098C4, 0x000098C5, 0x000098C6, 0x000098C7,
+    0x000098C8, 0x000098C9, 0x000098CA, 0x000098CB, 0x0800098D, 0x000098CD, 0x000098CE, 0x000098CF,
+    0x0000098D, 0x000098D1, 0x000098D2, 0x000098D3, 0x000098D4, 0x000098D5, 0x000098D6, 0x000098D7,
+    0x000098D8, 0x000098D9, 0x000098DA, 0x000098DB, 0x000098DC, 0x1000098E, 0x000098DE, 0x000098DF,
+    0x0000098E, 0x000098E1, 0x000098E2, 0x000098E3, 0x000098E4, 0x000098E5, 0x000098E6, 0x000098E7,
+    0x000098E8, 0x000098E9, 0x000098EA, 0x000098EB, 0x000098EC, 0x000098ED, 0x2000098F, 0x000098EF,
+    0x0000098F, 0x000098F1, 0x000098F2, 0x000098F3, 0x000098F4, 0x000098F5, 0x000098F6, 0x000098F7,
+    0x000098F8, 0x000098F9, 0x000098FA, 0x000098FB, 0x000098FC, 0x000098FD, 0x000098FE, 0x000098FF,
+    0x0100000A, 0x010000A1, 0x010000A2, 0x010000A3, 0x010000A4, 0x010000A5, 0x010000A6, 0x010000A7,
+    0x010000A8, 0x0100009A, 0x010000AA, 0x010000AB, 0x010000AC, 0x010000AD, 0x010000AE, 0x010000AF,
+    0x010000A1, 0x010100A2, 0x01000A12, 0x01000A13, 0x01000A14, 0x01000A15, 0x01000A16, 0x01000A17,
+    0x01000A18, 0x01000A19, 0x01000A1A, 0x01000A1B, 0x01000A1C, 0x01000A1D, 0x01000A1E, 0x01000A1F,
+    0x010000A2, 0x01000A21, 0x010200A3, 0x01000A23, 0x01000A24, 0x01000A25, 0x01000A26, 0x01000A27,
+    0x01000A28, 0x01000A29, 0x01000A2A, 0x01000A2B, 0x01000A2C, 0x01000A2D, 0x01000A2E, 0x01000A2F,
+    0x010000A3, 0x01000A31, 0x01000A32, 0x010400A4, 0x01000A34, 0x01000A35, 0x01000A36, 0x01000A37,
+    0x01000A38, 0x01000A39, 0x01000A3A, 0x01000A3B, 0x01000A3C, 0x01000A3D, 0x01000A3E, 0x01000A3F,
+    0x010000A4, 0x01000A41, 0x01000A42, 0x01000A43, 0x010800A5, 0x01000A45, 0x01000A46, 0x01000A47,
+    0x01000A48, 0x01000A49, 0x01000A4A, 0x01000A4B, 0x01000A4C, 0x01000A4D, 0x01000A4E, 0x01000A4F,
+    0x010000A5, 0x01000A51, 0x01000A52, 0x01000A53, 0x01000A54, 0x011000A6, 0x01000A56, 0x01000A57,
+    0x01000A58, 0x01000A59, 0x01000A5A, 0x01000A5B, 0x01000A5C, 0x01000A5D, 0x01000A5E, 0x01000A5F,
+    0x010000A6, 0x01000A61, 0x01000A62, 0x01000A63, 0x01000A64, 0x01000A65, 0x012000A7, 0x01000A67,
+    0x01000A68, 0x01000A69, 0x01000A6A, 0x01000A6B, 0x01000A6C, 0x01000A6D, 0x01000A6E, 0x01000A6F,
+    0x010000A7, 0x01000A71, 0x01000A72, 0x01000A73, 0x01000A74, 0x01000A75, 0x01000A76, 0x014000A8,
+    0x01000A78, 0x01000A79, 0x01000A7A, 0x01000A7B, 0x01000A7C, 0x01000A7D, 0x01000A7E, 0x01000A7F,
+    0x010000A8, 0x01000A81, 0x01000A82, 0x01000A83, 0x01000A84, 0x01000A85, 0x01000A86, 0x01000A87,
+    0x018000A9, 0x01000A89, 0x01000A8A, 0x01000A8B, 0x01000A8C, 0x01000A8D, 0x01000A8E, 0x01000A8F,
+    0x0100009A, 0x010009A1, 0x010009A2, 0x010009A3, 0x010009A4, 0x010009A5, 0x010009A6, 0x010009A7,
+    0x010009A8, 0x020000AA, 0x010009AA, 0x010009AB, 0x010009AC, 0x010009AD, 0x010009AE, 0x010009AF,
+    0x010000AA, 0x01000AA1, 0x01000AA2, 0x01000AA3, 0x01000AA4, 0x01000AA5, 0x01000AA6, 0x01000AA7,
+    0x01000AA8, 0x01000AA9, 0x830000AB, 0x01000AAB, 0x01000AAC, 0x01000AAD, 0x01000AAE, 0x01000AAF,
+    0x010000AB, 0x01000AB1, 0x01000AB2, 0x01000AB3, 0x01000AB4, 0x01000AB5, 0x01000AB6, 0x01000AB7,
+    0x01000AB8, 0x01000AB9, 0x01000ABA, 0x050000AC, 0x01000ABC, 0x01000ABD, 0x01000ABE, 0x01000ABF,
+    0x010000AC, 0x01000AC1, 0x01000AC2, 0x01000AC3, 0x01000AC4, 0x01000AC5, 0x01000AC6, 0x01000AC7,
+    0x01000AC8, 0x01000AC9, 0x01000ACA, 0x01000ACB, 0x090000AD, 0x01000ACD, 0x01000ACE, 0x01000ACF,
+    0x010000AD, 0x01000AD1, 0x01000AD2, 0x01000AD3, 0x01000AD4, 0x01000AD5, 0x01000AD6, 0x01000AD7,
+    0x01000AD8, 0x01000AD9, 0x01000ADA, 0x01000ADB, 0x01000ADC, 0x110000AE, 0x01000ADE, 0x01000ADF,
+    0x010000AE, 0x01000AE1, 0x01000AE2, 0x01000AE3, 0x01000AE4, 0x01000AE5, 0x01000AE6, 0x01000AE7,
+    0x01000AE8, 0x01000AE9, 0x01000AEA, 0x01000AEB, 0x01000AEC, 0x01000AED, 0x210000AF, 0x01000AEF,
+    0x010000AF, 0x01000AF1, 0x01000AF2, 0x01000AF3, 0x01000AF4, 0x01000AF5, 0x01000AF6, 0x01000AF7,
+    0x01000AF8, 0x01000AF9, 0x01000AFA, 0x01000AFB, 0x01000AFC, 0x01000AFD, 0x01000AFE, 0x01000AFF,
+    0x0000009A, 0x000009A1, 0x000009A2, 0x000009A3, 0x000009A4, 0x000009A5, 0x000009A6, 0x000009A7,
+    0x000009A8, 0x000009A9, 0x8200009B, 0x000009AB, 0x000009AC, 0x000009AD, 0x000009AE, 0x000009AF,
+    0x000009A1, 0x000109A2, 0x00009A12, 0x00009A13, 0x00009A14, 0x00009A15, 0x00009A16, 0x00009A17,
+    0x00009A18, 0x00009A19, 0x00009A1A, 0x00009A1B, 0x00009A1C, 0x00009A1D, 0x00009A1E, 0x00009A1F,
+    0x000009A2, 0x00009A21, 0x000209A3, 0x00009A23, 0x00009A24, 0x00009A25, 0x00009A26, 0x00009A27,
+    0x00009A28, 0x00009A29, 0x00009A2A, 0x00009A2B, 0x00009A2C, 0x00009A2D, 0x00009A2E, 0x00009A2F,
+    0x000009A3, 0x00009A31, 0x00009A32, 0x000409A4, 0x00009A34, 0x00009A35, 0x00009A36, 0x00009A37,
+    0x00009A38, 0x00009A39, 0x00009A3A, 0x00009A3B, 0x00009A3C, 0x00009A3D, 0x00009A3E, 0x00009A3F,
+    0x000009A4, 0x00009A41, 0x00009A42, 0x00009A43, 0x000809A5, 0x00009A45, 0x00009A46, 0x00009A47,
+    0x00009A48, 0x00009A49, 0x00009A4A, 0x00009A4B, 0x00009A4C, 0x00009A4D, 0x00009A4E, 0x00009A4F,
+    0x000009A5, 0x00009A51, 0x00009A52, 0x00009A53, 0x00009A54, 0x001009A6, 0x00009A56, 0x00009A57,
+    0x00009A58, 0x00009A59, 0x00009A5A, 0x00009A5B, 0x00009A5C, 0x00009A5D, 0x00009A5E, 0x00009A5F,
+    0x000009A6, 0x00009A61, 0x00009A62, 0x00009A63, 0x00009A64, 0x00009A65, 0x002009A7, 0x00009A67,
+    0x00009A68, 0x00009A69, 0x00009A6A, 0x00009A6B, 0x00009A6C, 0x00009A6D, 0x00009A6E, 0x00009A6F,
+    0x000009A7, 0x00009A71, 0x00009A72, 0x00009A73, 0x00009A74, 0x00009A75, 0x00009A76, 0x004009A8,
+    0x00009A78, 0x00009A79, 0x00009A7A, 0x00009A7B, 0x00009A7C, 0x00009A7D, 0x00009A7E, 0x00009A7F,
+    0x000009A8, 0x00009A81, 0x00009A82, 0x00009A83, 0x00009A84, 0x00009A85, 0x00009A86, 0x00009A87,
+    0x008009A9, 0x00009A89, 0x00009A8A, 0x00009A8B, 0x00009A8C, 0x00009A8D, 0x00009A8E, 0x00009A8F,
+    0x000009A9, 0x00009A91, 0x00009A92, 0x00009A93, 0x00009A94, 0x00009A95, 0x00009A96, 0x00009A97,
+    0x00009A98, 0x010009AA, 0x00009A9A, 0x00009A9B, 0x00009A9C, 0x00009A9D, 0x00009A9E, 0x00009A9F,
+    0x8200009B, 0x820009B1, 0x820009B2, 0x820009B3, 0x820009B4, 0x820009B5, 0x820009B6, 0x820009B7,
+    0x820009B8, 0x820009B9, 0x820009AB, 0x820009BB, 0x820009BC, 0x820009BD, 0x820009BE, 0x820009BF,
+    0x000009AB, 0x00009AB1, 0x00009AB2, 0x00009AB3, 0x00009AB4, 0x00009AB5, 0x00009AB6, 0x00009AB7,
+    0x00009AB8, 0x00009AB9, 0x00009ABA, 0x040009AC, 0x00009ABC, 0x00009ABD, 0x00009ABE, 0x00009ABF,
+    0x000009AC, 0x00009AC1, 0x00009AC2, 0x00009AC3, 0x00009AC4, 0x00009AC5, 0x00009AC6, 0x00009AC7,
+    0x00009AC8, 0x00009AC9, 0x00009ACA, 0x00009ACB, 0x080009AD, 0x00009ACD, 0x00009ACE, 0x00009ACF,
+    0x000009AD, 0x00009AD1, 0x00009AD2, 0x00009AD3, 0x00009AD4, 0x00009AD5, 0x00009AD6, 0x00009AD7,
+    0x00009AD8, 0x00009AD9, 0x00009ADA, 0x00009ADB, 0x00009ADC, 0x100009AE, 0x00009ADE, 0x00009ADF,
+    0x000009AE, 0x00009AE1, 0x00009AE2, 0x00009AE3, 0x00009AE4, 0x00009AE5, 0x00009AE6, 0x00009AE7,
+    0x00009AE8, 0x00009AE9, 0x00009AEA, 0x00009AEB, 0x00009AEC, 0x00009AED, 0x200009AF, 0x00009AEF,
+    0x000009AF, 0x00009AF1, 0x00009AF2, 0x00009AF3, 0x00009AF4, 0x00009AF5, 0x00009AF6, 0x00009AF7,
+    0x00009AF8, 0x00009AF9, 0x00009AFA, 0x00009AFB, 0x00009AFC, 0x00009AFD, 0x00009AFE, 0x00009AFF,
+    0x0000009B, 0x000009B1, 0x000009B2, 0x000009B3, 0x000009B4, 0x000009B5, 0x000009B6, 0x000009B7,
+    0x000009B8, 0x000009B9, 0x000009BA, 0x0400009C, 0x000009BC, 0x000009BD, 0x000009BE, 0x000009BF,
+    0x000009B1, 0x000109B2, 0x00009B12, 0x00009B13, 0x00009B14, 0x00009B15, 0x00009B16, 0x00009B17,
+    0x00009B18, 0x00009B19, 0x00009B1A, 0x00009B1B, 0x00009B1C, 0x00009B1D, 0x00009B1E, 0x00009B1F,
+    0x000009B2, 0x00009B21, 0x000209B3, 0x00009B23, 0x00009B24, 0x00009B25, 0x00009B26, 0x00009B27,
+    0x00009B28, 0x00009B29, 0x00009B2A, 0x00009B2B, 0x00009B2C, 0x00009B2D, 0x00009B2E, 0x00009B2F,
+    0x000009B3, 0x00009B31, 0x00009B32, 0x000409B4, 0x00009B34, 0x00009B35, 0x00009B36, 0x00009B37,
+    0x00009B38, 0x00009B39, 0x00009B3A, 0x00009B3B, 0x00009B3C, 0x00009B3D, 0x00009B3E, 0x00009B3F,
+    0x000009B4, 0x00009B41, 0x00009B42, 0x00009B43, 0x000809B5, 0x00009B45, 0x00009B46, 0x00009B47,
+    0x00009B48, 0x00009B49, 0x00009B4A, 0x00009B4B, 0x00009B4C, 0x00009B4D, 0x00009B4E, 0x00009B4F,
+    0x000009B5, 0x00009B51, 0x00009B52, 0x00009B53, 0x00009B54, 0x001009B6, 0x00009B56, 0x00009B57,
+    0x00009B58, 0x00009B59, 0x00009B5A, 0x00009B5B, 0x00009B5C, 0x00009B5D, 0x00009B5E, 0x00009B5F,
+    0x000009B6, 0x00009B61, 0x00009B62, 0x00009B63, 0x00009B64, 0x00009B65, 0x002009B7, 0x00009B67,
+    0x00009B68, 0x00009B69, 0x00009B6A, 0x00009B6B, 0x00009B6C, 0x00009B6D, 0x00009B6E, 0x00009B6F,
+    0x000009B7, 0x00009B71, 0x00009B72, 0x00009B73, 0x00009B74, 0x00009B75, 0x00009B76, 0x004009B8,
+    0x00009B78, 0x00009B79, 0x00009B7A, 0x00009B7B, 0x00009B7C, 0x00009B7D, 0x00009B7E, 0x00009B7F,
+    0x000009B8, 0x00009B81, 0x00009B82, 0x00009B83, 0x00009B84, 0x00009B85, 0x00009B86, 0x00009B87,
+    0x008009B9, 0x00009B89, 0x00009B8A, 0x00009B8B, 0x00009B8C, 0x00009B8D, 0x00009B8E, 0x00009B8F,
+    0x000009B9, 0x00009B91, 0x00009B92, 0x00009B93, 0x00009B94, 0x00009B95, 0x00009B96, 0x00009B97,
+    0x00009B98, 0x010009BA, 0x00009B9A, 0x00009B9B, 0x00009B9C, 0x00009B9D, 0x00009B9E, 0x00009B9F,
+    0x000009BA, 0x00009BA1, 0x00009BA2, 0x00009BA3, 0x00009BA4, 0x00009BA5, 0x00009BA6, 0x00009BA7,
+    0x00009BA8, 0x00009BA9, 0x820009BB, 0x00009BAB, 0x00009BAC, 0x00009BAD, 0x00009BAE, 0x00009BAF,
+    0x0400009C, 0x040009C1, 0x040009C2, 0x040009C3, 0x040009C4, 0x040009C5, 0x040009C6, 0x040009C7,
+    0x040009C8, 0x040009C9, 0x040009CA, 0x040009BC, 0x040009CC, 0x040009CD, 0x040009CE, 0x040009CF,
+    0x000009BC, 0x00009BC1, 0x00009BC2, 0x00009BC3, 0x00009BC4, 0x00009BC5, 0x00009BC6, 0x00009BC7,
+    0x00009BC8, 0x00009BC9, 0x00009BCA, 0x00009BCB, 0x080009BD, 0x00009BCD, 0x00009BCE, 0x00009BCF,
+    0x000009BD, 0x00009BD1, 0x00009BD2, 0x00009BD3, 0x00009BD4, 0x00009BD5, 0x00009BD6, 0x00009BD7,
+    0x00009BD8, 0x00009BD9, 0x00009BDA, 0x00009BDB, 0x00009BDC, 0x100009BE, 0x00009BDE, 0x00009BDF,
+    0x000009BE, 0x00009BE1, 0x00009BE2, 0x00009BE3, 0x00009BE4, 0x00009BE5, 0x00009BE6, 0x00009BE7,
+    0x00009BE8, 0x00009BE9, 0x00009BEA, 0x00009BEB, 0x00009BEC, 0x00009BED, 0x200009BF, 0x00009BEF,
+    0x000009BF, 0x00009BF1, 0x00009BF2, 0x00009BF3, 0x00009BF4, 0x00009BF5, 0x00009BF6, 0x00009BF7,
+    0x00009BF8, 0x00009BF9, 0x00009BFA, 0x00009BFB, 0x00009BFC, 0x00009BFD, 0x00009BFE, 0x00009BFF,
+    0x0000009C, 0x000009C1, 0x000009C2, 0x000009C3, 0x000009C4, 0x000009C5, 0x000009C6, 0x000009C7,
+    0x000009C8, 0x000009C9, 0x000009CA, 0x000009CB, 0x0800009D, 0x000009CD, 0x000009CE, 0x000009CF,
+    0x000009C1, 0x000109C2, 0x00009C12, 0x00009C13, 0x00009C14, 0x00009C15, 0x00009C16, 0x00009C17,
+    0x00009C18, 0x00009C19, 0x00009C1A, 0x00009C1B, 0x00009C1C, 0x00009C1D, 0x00009C1E, 0x00009C1F,
+    0x000009C2, 0x00009C21, 0x000209C3, 0x00009C23, 0x00009C24, 0x00009C25, 0x00009C26, 0x00009C27,
+    0x00009C28, 0x00009C29, 0x00009C2A, 0x00009C2B, 0x00009C2C, 0x00009C2D, 0x00009C2E, 0x00009C2F,
+    0x000009C3, 0x00009C31, 0x00009C32, 0x000409C4, 0x00009C34, 0x00009C35, 0x00009C36, 0x00009C37,
+    0x00009C38, 0x00009C39, 0x00009C3A, 0x00009C3B, 0x00009C3C, 0x00009C3D, 0x00009C3E, 0x00009C3F,
+    0x000009C4, 0x00009C41, 0x00009C42, 0x00009C43, 0x000809C5, 0x00009C45, 0x00009C46, 0x00009C47,
+    0x00009C48, 0x00009C49, 0x00009C4A, 0x00009C4B, 0x00009C4C, 0x00009C4D, 0x00009C4E, 0x00009C4F,
+    0x000009C5, 0x00009C51, 0x00009C52, 0x00009C53, 0x00009C54, 0x001009C6, 0x00009C56, 0x00009C57,
+    0x00009C58, 0x00009C59, 0x00009C5A, 0x00009C5B, 0x00009C5C, 0x00009C5D, 0x00009C5E, 0x00009C5F,
+    0x000009C6, 0x00009C61, 0x00009C62, 0x00009C63, 0x00009C64, 0x00009C65, 0x002009C7, 0x00009C67,
+    0x00009C68, 0x00009C69, 0x00009C6A, 0x00009C6B, 0x00009C6C, 0x00009C6D, 0x00009C6E, 0x00009C6F,
+    0x000009C7, 0x00009C71, 0x00009C72, 0x00009C73, 0x00009C74, 0x00009C75, 0x00009C76, 0x004009C8,
+    0x00009C78, 0x00009C79, 0x00009C7A, 0x00009C7B, 0x00009C7C, 0x00009C7D, 0x00009C7E, 0x00009C7F,
+    0x000009C8, 0x00009C81, 0x00009C82, 0x00009C83, 0x00009C84, 0x00009C85, 0x00009C86, 0x00009C87,
+    0x008009C9, 0x00009C89, 0x00009C8A, 0x00009C8B, 0x00009C8C, 0x00009C8D, 0x00009C8E, 0x00009C8F,
+    0x000009C9, 0x00009C91, 0x00009C92, 0x00009C93, 0x00009C94, 0x00009C95, 0x00009C96, 0x00009C97,
+    0x00009C98, 0x010009CA, 0x00009C9A, 0x00009C9B, 0x00009C9C, 0x00009C9D, 0x00009C9E, 0x00009C9F,
+    0x000009CA, 0x00009CA1, 0x00009CA2, 0x00009CA3, 0x00009CA4, 0x00009CA5, 0x00009CA6, 0x00009CA7,
+    0x00009CA8, 0x00009CA9, 0x820009CB, 0x00009CAB, 0x00009CAC, 0x00009CAD, 0x00009CAE, 0x00009CAF,
+    0x000009CB, 0x00009CB1, 0x00009CB2, 0x00009CB3, 0x00009CB4, 0x00009CB5, 0x00009CB6, 0x00009CB7,
+    0x00009CB8, 0x00009CB9, 0x00009CBA, 0x040009CC, 0x00009CBC, 0x00009CBD, 0x00009CBE, 0x00009CBF,
+    0x0800009D, 0x080009D1, 0x080009D2, 0x080009D3, 0x080009D4, 0x080009D5, 0x080009D6, 0x080009D7,
+    0x080009D8, 0x080009D9, 0x080009DA, 0x080009DB, 0x080009CD, 0x080009DD, 0x080009DE, 0x080009DF,
+    0x000009CD, 0x00009CD1, 0x00009CD2, 0x00009CD3, 0x00009CD4, 0x00009CD5, 0x00009CD6, 0x00009CD7,
+    0x00009CD8, 0x00009CD9, 0x00009CDA, 0x00009CDB, 0x00009CDC, 0x100009CE, 0x00009CDE, 0x00009CDF,
+    0x000009CE, 0x00009CE1, 0x00009CE2, 0x00009CE3, 0x00009CE4, 0x00009CE5, 0x00009CE6, 0x00009CE7,
+    0x00009CE8, 0x00009CE9, 0x00009CEA, 0x00009CEB, 0x00009CEC, 0x00009CED, 0x200009CF, 0x00009CEF,
+    0x000009CF, 0x00009CF1, 0x00009CF2, 0x00009CF3, 0x00009CF4, 0x00009CF5, 0x00009CF6, 0x00009CF7,
+    0x00009CF8, 0x00009CF9, 0x00009CFA, 0x00009CFB, 0x00009CFC, 0x00009CFD, 0x00009CFE, 0x00009CFF,
+    0x0000009D, 0x000009D1, 0x000009D2, 0x000009D3, 0x000009D4, 0x000009D5, 0x000009D6, 0x000009D7,
+    0x000009D8, 0x000009D9, 0x000009DA, 0x000009DB, 0x000009DC, 0x1000009E, 0x000009DE, 0x000009DF,
+    0x000009D1, 0x000109D2, 0x00009D12, 0x00009D13, 0x00009D14, 0x00009D15, 0x00009D16, 0x00009D17,
+    0x00009D18, 0x00009D19, 0x00009D1A, 0x00009D1B, 0x00009D1C, 0x00009D1D, 0x00009D1E, 0x00009D1F,
+    0x000009D2, 0x00009D21, 0x000209D3, 0x00009D23, 0x00009D24, 0x00009D25, 0x00009D26, 0x00009D27,
+    0x00009D28, 0x00009D29, 0x00009D2A, 0x00009D2B, 0x00009D2C, 0x00009D2D, 0x00009D2E, 0x00009D2F,
+    0x000009D3, 0x00009D31, 0x00009D32, 0x000409D4, 0x00009D34, 0x00009D35, 0x00009D36, 0x00009D37,
+    0x00009D38, 0x00009D39, 0x00009D3A, 0x00009D3B, 0x00009D3C, 0x00009D3D, 0x00009D3E, 0x00009D3F,
+    0x000009D4, 0x00009D41, 0x00009D42, 0x00009D43, 0x000809D5, 0x00009D45, 0x00009D46, 0x00009D47,
+    0x00009D48, 0x00009D49, 0x00009D4A, 0x00009D4B, 0x00009D4C, 0x00009D4D, 0x00009D4E, 0x00009D4F,
+    0x000009D5, 0x00009D51, 0x00009D52, 0x00009D53, 0x00009D54, 0x001009D6, 0x00009D56, 0x00009D57,
+    0x00009D58, 0x00009D59, 0x00009D5A, 0x00009D5B, 0x00009D5C, 0x00009D5D, 0x00009D5E, 0x00009D5F,
+    0x000009D6, 0x00009D61, 0x00009D62, 0x00009D63, 0x00009D64, 0x00009D65, 0x002009D7, 0x00009D67,
+    0x00009D68, 0x00009D69, 0x00009D6A, 0x00009D6B, 0x00009D6C, 0x00009D6D, 0x00009D6E, 0x00009D6F,
+    0x000009D7, 0x00009D71, 0x00009D72, 0x00009D73, 0x00009D74, 0x00009D75, 0x00009D76, 0x004009D8,
+    0x00009D78, 0x00009D79, 0x00009D7A, 0x00009D7B, 0x00009D7C, 0x00009D7D, 0x00009D7E, 0x00009D7F,
+    0x000009D8, 0x00009D81, 0x00009D82, 0x00009D83, 0x00009D84, 0x00009D85, 0x00009D86, 0x00009D87,
+    0x008009D9, 0x00009D89, 0x00009D8A, 0x00009D8B, 0x00009D8C, 0x00009D8D, 0x00009D8E, 0x00009D8F,
+    0x000009D9, 0x00009D91, 0x00009D92, 0x00009D93, 0x00009D94, 0x00009D95, 0x00009D96, 0x00009D97,
+    0x00009D98, 0x010009DA, 0x00009D9A, 0x00009D9B, 0x00009D9C, 0x00009D9D, 0x00009D9E, 0x00009D9F,
+    0x000009DA, 0x00009DA1, 0x00009DA2, 0x00009DA3, 0x00009DA4, 0x00009DA5, 0x00009DA6, 0x00009DA7,
+    0x00009DA8, 0x00009DA9, 0x820009DB, 0x00009DAB, 0x00009DAC, 0x00009DAD, 0x00009DAE, 0x00009DAF,
+    0x000009DB, 0x00009DB1, 0x00009DB2, 0x00009DB3, 0x00009DB4, 0x00009DB5, 0x00009DB6, 0x00009DB7,
+    0x00009DB8, 0x00009DB9, 0x00009DBA, 0x040009DC, 0x00009DBC, 0x00009DBD, 0x00009DBE, 0x00009DBF,
+    0x000009DC, 0x00009DC1, 0x00009DC2, 0x00009DC3, 0x00009DC4, 0x00009DC5, 0x00009DC6, 0x00009DC7,
+    0x00009DC8, 0x00009DC9, 0x00009DCA, 0x00009DCB, 0x080009DD, 0x00009DCD, 0x00009DCE, 0x00009DCF,
+    0x1000009E, 0x100009E1, 0x100009E2, 0x100009E3, 0x100009E4, 0x100009E5, 0x100009E6, 0x100009E7,
+    0x100009E8, 0x100009E9, 0x100009EA, 0x100009EB, 0x100009EC, 0x100009DE, 0x100009EE, 0x100009EF,
+    0x000009DE, 0x00009DE1, 0x00009DE2, 0x00009DE3, 0x00009DE4, 0x00009DE5, 0x00009DE6, 0x00009DE7,
+    0x00009DE8, 0x00009DE9, 0x00009DEA, 0x00009DEB, 0x00009DEC, 0x00009DED, 0x200009DF, 0x00009DEF,
+    0x000009DF, 0x00009DF1, 0x00009DF2, 0x00009DF3, 0x00009DF4, 0x00009DF5, 0x00009DF6, 0x00009DF7,
+    0x00009DF8, 0x00009DF9, 0x00009DFA, 0x00009DFB, 0x00009DFC, 0x00009DFD, 0x00009DFE, 0x00009DFF,
+    0x0000009E, 0x000009E1, 0x000009E2, 0x000009E3, 0x000009E4, 0x000009E5, 0x000009E6, 0x000009E7,
+    0x000009E8, 0x000009E9, 0x000009EA, 0x000009EB, 0x000009EC, 0x000009ED, 0x2000009F, 0x000009EF,
+    0x000009E1, 0x000109E2, 0x00009E12, 0x00009E13, 0x00009E14, 0x00009E15, 0x00009E16, 0x00009E17,
+    0x00009E18, 0x00009E19, 0x00009E1A, 0x00009E1B, 0x00009E1C, 0x00009E1D, 0x00009E1E, 0x00009E1F,
+    0x000009E2, 0x00009E21, 0x000209E3, 0x00009E23, 0x00009E24, 0x00009E25, 0x00009E26, 0x00009E27,
+    0x00009E28, 0x00009E29, 0x00009E2A, 0x00009E2B, 0x00009E2C, 0x00009E2D, 0x00009E2E, 0x00009E2F,
+    0x000009E3, 0x00009E31, 0x00009E32, 0x000409E4, 0x00009E34, 0x00009E35, 0x00009E36, 0x00009E37,
+    0x00009E38, 0x00009E39, 0x00009E3A, 0x00009E3B, 0x00009E3C, 0x00009E3D, 0x00009E3E, 0x00009E3F,
+    0x000009E4, 0x00009E41, 0x00009E42, 0x00009E43, 0x000809E5, 0x00009E45, 0x00009E46, 0x00009E47,
+    0x00009E48, 0x00009E49, 0x00009E4A, 0x00009E4B, 0x00009E4C, 0x00009E4D, 0x00009E4E, 0x00009E4F,
+    0x000009E5, 0x00009E51, 0x00009E52, 0x00009E53, 0x00009E54, 0x001009E6, 0x00009E56, 0x00009E57,
+    0x00009E58, 0x00009E59, 0x00009E5A, 0x00009E5B, 0x00009E5C, 0x00009E5D, 0x00009E5E, 0x00009E5F,
+    0x000009E6, 0x00009E61, 0x00009E62, 0x00009E63, 0x00009E64, 0x00009E65, 0x002009E7, 0x00009E67,
+    0x00009E68, 0x00009E69, 0x00009E6A, 0x00009E6B, 0x00009E6C, 0x00009E6D, 0x00009E6E, 0x00009E6F,
+    0x000009E7, 0x00009E71, 0x00009E72, 0x00009E73, 0x00009E74, 0x00009E75, 0x00009E76, 0x004009E8,
+    0x00009E78, 0x00009E79, 0x00009E7A, 0x00009E7B, 0x00009E7C, 0x00009E7D, 0x00009E7E, 0x00009E7F,
+    0x000009E8, 0x00009E81, 0x00009E82, 0x00009E83, 0x00009E84, 0x00009E85, 0x00009E86, 0x00009E87,
+    0x008009E9, 0x00009E89, 0x00009E8A, 0x00009E8B, 0x00009E8C, 0x00009E8D, 0x00009E8E, 0x00009E8F,
+    0x000009E9, 0x00009E91, 0x00009E92, 0x00009E93, 0x00009E94, 0x00009E95, 0x00009E96, 0x00009E97,
+    0x00009E98, 0x010009EA, 0x00009E9A, 0x00009E9B, 0x00009E9C, 0x00009E9D, 0x00009E9E, 0x00009E9F,
+    0x000009EA, 0x00009EA1, 0x00009EA2, 0x00009EA3, 0x00009EA4, 0x00009EA5, 0x00009EA6, 0x00009EA7,
+    0x00009EA8, 0x00009EA9, 0x820009EB, 0x00009EAB, 0x00009EAC, 0x00009EAD, 0x00009EAE, 0x00009EAF,
+    0x000009EB, 0x00009EB1, 0x00009EB2, 0x00009EB3, 0x00009EB4, 0x00009EB5, 0x00009EB6, 0x00009EB7,
+    0x00009EB8, 0x00009EB9, 0x00009EBA, 0x040009EC, 0x00009EBC, 0x00009EBD, 0x00009EBE, 0x00009EBF,
+    0x000009EC, 0x00009EC1, 0x00009EC2, 0x00009EC3, 0x00009EC4, 0x00009EC5, 0x00009EC6, 0x00009EC7,
+    0x00009EC8, 0x00009EC9, 0x00009ECA, 0x00009ECB, 0x080009ED, 0x00009ECD, 0x00009ECE, 0x00009ECF,
+    0x000009ED, 0x00009ED1, 0x00009ED2, 0x00009ED3, 0x00009ED4, 0x00009ED5, 0x00009ED6, 0x00009ED7,
+    0x00009ED8, 0x00009ED9, 0x00009EDA, 0x00009EDB, 0x00009EDC, 0x100009EE, 0x00009EDE, 0x00009EDF,
+    0x2000009F, 0x200009F1, 0x200009F2, 0x200009F3, 0x200009F4, 0x200009F5, 0x200009F6, 0x200009F7,
+    0x200009F8, 0x200009F9, 0x200009FA, 0x200009FB, 0x200009FC, 0x200009FD, 0x200009EF, 0x200009FF,
+    0x000009EF, 0x00009EF1, 0x00009EF2, 0x00009EF3, 0x00009EF4, 0x00009EF5, 0x00009EF6, 0x00009EF7,
+    0x00009EF8, 0x00009EF9, 0x00009EFA, 0x00009EFB, 0x00009EFC, 0x00009EFD, 0x00009EFE, 0x00009EFF,
+    0x0000009F, 0x000009F1, 0x000009F2, 0x000009F3, 0x000009F4, 0x000009F5, 0x000009F6, 0x000009F7,
+    0x000009F8, 0x000009F9, 0x000009FA, 0x000009FB, 0x000009FC, 0x000009FD, 0x000009FE, 0x000009FF,
+    0x000009F1, 0x000109F2, 0x00009F12, 0x00009F13, 0x00009F14, 0x00009F15, 0x00009F16, 0x00009F17,
+    0x00009F18, 0x00009F19, 0x00009F1A, 0x00009F1B, 0x00009F1C, 0x00009F1D, 0x00009F1E, 0x00009F1F,
+    0x000009F2, 0x00009F21, 0x000209F3, 0x00009F23, 0x00009F24, 0x00009F25, 0x00009F26, 0x00009F27,
+    0x00009F28, 0x00009F29, 0x00009F2A, 0x00009F2B, 0x00009F2C, 0x00009F2D, 0x00009F2E, 0x00009F2F,
+    0x000009F3, 0x00009F31, 0x00009F32, 0x000409F4, 0x00009F34, 0x00009F35, 0x00009F36, 0x00009F37,
+    0x00009F38, 0x00009F39, 0x00009F3A, 0x00009F3B, 0x00009F3C, 0x00009F3D, 0x00009F3E, 0x00009F3F,
+    0x000009F4, 0x00009F41, 0x00009F42, 0x00009F43, 0x000809F5, 0x00009F45, 0x00009F46, 0x00009F47,
+    0x00009F48, 0x00009F49, 0x00009F4A, 0x00009F4B, 0x00009F4C, 0x00009F4D, 0x00009F4E, 0x00009F4F,
+    0x000009F5, 0x00009F51, 0x00009F52, 0x00009F53, 0x00009F54, 0x001009F6, 0x00009F56, 0x00009F57,
+    0x00009F58, 0x00009F59, 0x00009F5A, 0x00009F5B, 0x00009F5C, 0x00009F5D, 0x00009F5E, 0x00009F5F,
+    0x000009F6, 0x00009F61, 0x00009F62, 0x00009F63, 0x00009F64, 0x00009F65, 0x002009F7, 0x00009F67,
+    0x00009F68, 0x00009F69, 0x00009F6A, 0x00009F6B, 0x00009F6C, 0x00009F6D, 0x00009F6E, 0x00009F6F,
+    0x000009F7, 0x00009F71, 0x00009F72, 0x00009F73, 0x00009F74, 0x00009F75, 0x00009F76, 0x004009F8,
+    0x00009F78, 0x00009F79, 0x00009F7A, 0x00009F7B, 0x00009F7C, 0x00009F7D, 0x00009F7E, 0x00009F7F,
+    0x000009F8, 0x00009F81, 0x00009F82, 0x00009F83, 0x00009F84, 0x00009F85, 0x00009F86, 0x00009F87,
+    0x008009F9, 0x00009F89, 0x00009F8A, 0x00009F8B, 0x00009F8C, 0x00009F8D, 0x00009F8E, 0x00009F8F,
+    0x000009F9, 0x00009F91, 0x00009F92, 0x00009F93, 0x00009F94, 0x00009F95, 0x00009F96, 0x00009F97,
+    0x00009F98, 0x010009FA, 0x00009F9A, 0x00009F9B, 0x00009F9C, 0x00009F9D, 0x00009F9E, 0x00009F9F,
+    0x000009FA, 0x00009FA1, 0x00009FA2, 0x00009FA3, 0x00009FA4, 0x00009FA5, 0x00009FA6, 0x00009FA7,
+    0x00009FA8, 0x00009FA9, 0x820009FB, 0x00009FAB, 0x00009FAC, 0x00009FAD, 0x00009FAE, 0x00009FAF,
+    0x000009FB, 0x00009FB1, 0x00009FB2, 0x00009FB3, 0x00009FB4, 0x00009FB5, 0x00009FB6, 0x00009FB7,
+    0x00009FB8, 0x00009FB9, 0x00009FBA, 0x040009FC, 0x00009FBC, 0x00009FBD, 0x00009FBE, 0x00009FBF,
+    0x000009FC, 0x00009FC1, 0x00009FC2, 0x00009FC3, 0x00009FC4, 0x00009FC5, 0x00009FC6, 0x00009FC7,
+    0x00009FC8, 0x00009FC9, 0x00009FCA, 0x00009FCB, 0x080009FD, 0x00009FCD, 0x00009FCE, 0x00009FCF,
+    0x000009FD, 0x00009FD1, 0x00009FD2, 0x00009FD3, 0x00009FD4, 0x00009FD5, 0x00009FD6, 0x00009FD7,
+    0x00009FD8, 0x00009FD9, 0x00009FDA, 0x00009FDB, 0x00009FDC, 0x100009FE, 0x00009FDE, 0x00009FDF,
+    0x000009FE, 0x00009FE1, 0x00009FE2, 0x00009FE3, 0x00009FE4, 0x00009FE5, 0x00009FE6, 0x00009FE7,
+    0x00009FE8, 0x00009FE9, 0x00009FEA, 0x00009FEB, 0x00009FEC, 0x00009FED, 0x200009FF, 0x00009FEF,
+    0x000009FF, 0x00009FF1, 0x00009FF2, 0x00009FF3, 0x00009FF4, 0x00009FF5, 0x00009FF6, 0x00009FF7,
+    0x00009FF8, 0x00009FF9, 0x00009FFA, 0x00009FFB, 0x00009FFC, 0x00009FFD, 0x00009FFE, 0x00009FFF,
+    0x0000000A, 0x000000A1, 0x000000A2, 0x000000A3, 0x000000A4, 0x000000A5, 0x000000A6, 0x000000A7,
+    0x000000A8, 0x000000A9, 0x8200000B, 0x000000AB, 0x000000AC, 0x000000AD, 0x000000AE, 0x000000AF,
+    0x000000A1, 0x000100A2, 0x00000A12, 0x00000A13, 0x00000A14, 0x00000A15, 0x00000A16, 0x00000A17,
+    0x00000A18, 0x00000A19, 0x00000A1A, 0x00000A1B, 0x00000A1C, 0x00000A1D, 0x00000A1E, 0x00000A1F,
+    0x000000A2, 0x00000A21, 0x000200A3, 0x00000A23, 0x00000A24, 0x00000A25, 0x00000A26, 0x00000A27,
+    0x00000A28, 0x00000A29, 0x00000A2A, 0x00000A2B, 0x00000A2C, 0x00000A2D, 0x00000A2E, 0x00000A2F,
+    0x000000A3, 0x00000A31, 0x00000A32, 0x000400A4, 0x00000A34, 0x00000A35, 0x00000A36, 0x00000A37,
+    0x00000A38, 0x00000A39, 0x00000A3A, 0x00000A3B, 0x00000A3C, 0x00000A3D, 0x00000A3E, 0x00000A3F,
+    0x000000A4, 0x00000A41, 0x00000A42, 0x00000A43, 0x000800A5, 0x00000A45, 0x00000A46, 0x00000A47,
+    0x00000A48, 0x00000A49, 0x00000A4A, 0x00000A4B, 0x00000A4C, 0x00000A4D, 0x00000A4E, 0x00000A4F,
+    0x000000A5, 0x00000A51, 0x00000A52, 0x00000A53, 0x00000A54, 0x001000A6, 0x00000A56, 0x00000A57,
+    0x00000A58, 0x00000A59, 0x00000A5A, 0x00000A5B, 0x00000A5C, 0x00000A5D, 0x00000A5E, 0x00000A5F,
+    0x000000A6, 0x00000A61, 0x00000A62, 0x00000A63, 0x00000A64, 0x00000A65, 0x002000A7, 0x00000A67,
+    0x00000A68, 0x00000A69, 0x00000A6A, 0x00000A6B, 0x00000A6C, 0x00000A6D, 0x00000A6E, 0x00000A6F,
+    0x000000A7, 0x00000A71, 0x00000A72, 0x00000A73, 0x00000A74, 0x00000A75, 0x00000A76, 0x004000A8,
+    0x00000A78, 0x00000A79, 0x00000A7A, 0x00000A7B, 0x00000A7C, 0x00000A7D, 0x00000A7E, 0x00000A7F,
+    0x000000A8, 0x00000A81, 0x00000A82, 0x00000A83, 0x00000A84, 0x00000A85, 0x00000A86, 0x00000A87,
+    0x008000A9, 0x00000A89, 0x00000A8A, 0x00000A8B, 0x00000A8C, 0x00000A8D, 0x00000A8E, 0x00000A8F,
+    0x000000A9, 0x00000A91, 0x00000A92, 0x00000A93, 0x00000A94, 0x00000A95, 0x00000A96, 0x00000A97,
+    0x00000A98, 0x010000AA, 0x00000A9A, 0x00000A9B, 0x00000A9C, 0x00000A9D, 0x00000A9E, 0x00000A9F,
+    0x8200000B, 0x820000B1, 0x820000B2, 0x820000B3, 0x820000B4, 0x820000B5, 0x820000B6, 0x820000B7,
+    0x820000B8, 0x820000B9, 0x820000AB, 0x820000BB, 0x820000BC, 0x820000BD, 0x820000BE, 0x820000BF,
+    0x000000AB, 0x00000AB1, 0x00000AB2, 0x00000AB3, 0x00000AB4, 0x00000AB5, 0x00000AB6, 0x00000AB7,
+    0x00000AB8, 0x00000AB9, 0x00000ABA, 0x040000AC, 0x00000ABC, 0x00000ABD, 0x00000ABE, 0x00000ABF,
+    0x000000AC, 0x00000AC1, 0x00000AC2, 0x00000AC3, 0x00000AC4, 0x00000AC5, 0x00000AC6, 0x00000AC7,
+    0x00000AC8, 0x00000AC9, 0x00000ACA, 0x00000ACB, 0x080000AD, 0x00000ACD, 0x00000ACE, 0x00000ACF,
+    0x000000AD, 0x00000AD1, 0x00000AD2, 0x00000AD3, 0x00000AD4, 0x00000AD5, 0x00000AD6, 0x00000AD7,
+    0x00000AD8, 0x00000AD9, 0x00000ADA, 0x00000ADB, 0x00000ADC, 0x100000AE, 0x00000ADE, 0x00000ADF,
+    0x000000AE, 0x00000AE1, 0x00000AE2, 0x00000AE3, 0x00000AE4, 0x00000AE5, 0x00000AE6, 0x00000AE7,
+    0x00000AE8, 0x00000AE9, 0x00000AEA, 0x00000AEB, 0x00000AEC, 0x00000AED, 0x200000AF, 0x00000AEF,
+    0x000000AF, 0x00000AF1, 0x00000AF2, 0x00000AF3, 0x00000AF4, 0x00000AF5, 0x00000AF6, 0x00000AF7,
+    0x00000AF8, 0x00000AF9, 0x00000AFA, 0x00000AFB, 0x00000AFC, 0x00000AFD, 0x00000AFE, 0x00000AFF,
+    0x000000A1, 0x000100A2, 0x00000A12, 0x00000A13, 0x00000A14, 0x00000A15, 0x00000A16, 0x00000A17,
+    0x00000A18, 0x00000A19, 0x00000A1A, 0x00000A1B, 0x00000A1C, 0x00000A1D, 0x00000A1E, 0x00000A1F,
+    0x000100A2, 0x00010A12, 0x00010A22, 0x00010A23, 0x00010A24, 0x00010A25, 0x00010A26, 0x00010A27,
+    0x00010A28, 0x00010A29, 0x00010A2A, 0x00010A2B, 0x00010A2C, 0x00010A2D, 0x00010A2E, 0x00010A2F,
+    0x00000A12, 0x0000A121, 0x00020A13, 0x0000A123, 0x0000A124, 0x0000A125, 0x0000A126, 0x0000A127,
+    0x0000A128, 0x0000A129, 0x0000A12A, 0x0000A12B, 0x0000A12C, 0x0000A12D, 0x0000A12E, 0x0000A12F,
+    0x00000A13, 0x0000A131, 0x0000A132, 0x00040A14, 0x0000A134, 0x0000A135, 0x0000A136, 0x0000A137,
+    0x0000A138, 0x0000A139, 0x0000A13A, 0x0000A13B, 0x0000A13C, 0x0000A13D, 0x0000A13E, 0x0000A13F,
+    0x00000A14, 0x0000A141, 0x0000A142, 0x0000A143, 0x00080A15, 0x0000A145, 0x0000A146, 0x0000A147,
+    0x0000A148, 0x0000A149, 0x0000A14A, 0x0000A14B, 0x0000A14C, 0x0000A14D, 0x0000A14E, 0x0000A14F,
+    0x00000A15, 0x0000A151, 0x0000A152, 0x0000A153, 0x0000A154, 0x00100A16, 0x0000A156, 0x0000A157,
+    0x0000A158, 0x0000A159, 0x0000A15A, 0x0000A15B, 0x0000A15C, 0x0000A15D, 0x0000A15E, 0x0000A15F,
+    0x00000A16, 0x0000A161, 0x0000A162, 0x0000A163, 0x0000A164, 0x0000A165, 0x00200A17, 0x0000A167,
+    0x0000A168, 0x0000A169, 0x0000A16A, 0x0000A16B, 0x0000A16C, 0x0000A16D, 0x0000A16E, 0x0000A16F,
+    0x00000A17, 0x0000A171, 0x0000A172, 0x0000A173, 0x0000A174, 0x0000A175, 0x0000A176, 0x00400A18,
+    0x0000A178, 0x0000A179, 0x0000A17A, 0x0000A17B, 0x0000A17C, 0x0000A17D, 0x0000A17E, 0x0000A17F,
+    0x00000A18, 0x0000A181, 0x0000A182, 0x0000A183, 0x0000A184, 0x0000A185, 0x0000A186, 0x0000A187,
+    0x00800A19, 0x0000A189, 0x0000A18A, 0x0000A18B, 0x0000A18C, 0x0000A18D, 0x0000A18E, 0x0000A18F,
+    0x00000A19, 0x0000A191, 0x0000A192, 0x0000A193, 0x0000A194, 0x0000A195, 0x0000A196, 0x0000A197,
+    0x0000A198, 0x01000A1A, 0x0000A19A, 0x0000A19B, 0x0000A19C, 0x0000A19D, 0x0000A19E, 0x0000A19F,
+    0x00000A1A, 0x0000A1A1, 0x0000A1A2, 0x0000A1A3, 0x0000A1A4, 0x0000A1A5, 0x0000A1A6, 0x0000A1A7,
+    0x0000A1A8, 0x0000A1A9, 0x82000A1B, 0x0000A1AB, 0x0000A1AC, 0x0000A1AD, 0x0000A1AE, 0x0000A1AF,
+    0x00000A1B, 0x0000A1B1, 0x0000A1B2, 0x0000A1B3, 0x0000A1B4, 0x0000A1B5, 0x0000A1B6, 0x0000A1B7,
+    0x0000A1B8, 0x0000A1B9, 0x0000A1BA, 0x04000A1C, 0x0000A1BC, 0x0000A1BD, 0x0000A1BE, 0x0000A1BF,
+    0x00000A1C, 0x0000A1C1, 0x0000A1C2, 0x0000A1C3, 0x0000A1C4, 0x0000A1C5, 0x0000A1C6, 0x0000A1C7,
+    0x0000A1C8, 0x0000A1C9, 0x0000A1CA, 0x0000A1CB, 0x08000A1D, 0x0000A1CD, 0x0000A1CE, 0x0000A1CF,
+    0x00000A1D, 0x0000A1D1, 0x0000A1D2, 0x0000A1D3, 0x0000A1D4, 0x0000A1D5, 0x0000A1D6, 0x0000A1D7,
+    0x0000A1D8, 0x0000A1D9, 0x0000A1DA, 0x0000A1DB, 0x0000A1DC, 0x10000A1E, 0x0000A1DE, 0x0000A1DF,
+    0x00000A1E, 0x0000A1E1, 0x0000A1E2, 0x0000A1E3, 0x0000A1E4, 0x0000A1E5, 0x0000A1E6, 0x0000A1E7,
+    0x0000A1E8, 0x0000A1E9, 0x0000A1EA, 0x0000A1EB, 0x0000A1EC, 0x0000A1ED, 0x20000A1F, 0x0000A1EF,
+    0x00000A1F, 0x0000A1F1, 0x0000A1F2, 0x0000A1F3, 0x0000A1F4, 0x0000A1F5, 0x0000A1F6, 0x0000A1F7,
+    0x0000A1F8, 0x0000A1F9, 0x0000A1FA, 0x0000A1FB, 0x0000A1FC, 0x0000A1FD, 0x0000A1FE, 0x0000A1FF,
+    0x000000A2, 0x00000A21, 0x000200A3, 0x00000A23, 0x00000A24, 0x00000A25, 0x00000A26, 0x00000A27,
+    0x00000A28, 0x00000A29, 0x00000A2A, 0x00000A2B, 0x00000A2C, 0x00000A2D, 0x00000A2E, 0x00000A2F,
+    0x00000A21, 0x00010A22, 0x0000A212, 0x0000A213, 0x0000A214, 0x0000A215, 0x0000A216, 0x0000A217,
+    0x0000A218, 0x0000A219, 0x0000A21A, 0x0000A21B, 0x0000A21C, 0x0000A21D, 0x0000A21E, 0x0000A21F,
+    0x000200A3, 0x00020A31, 0x00020A23, 0x00020A33, 0x00020A34, 0x00020A35, 0x00020A36, 0x00020A37,
+    0x00020A38, 0x00020A39, 0x00020A3A, 0x00020A3B, 0x00020A3C, 0x00020A3D, 0x00020A3E, 0x00020A3F,
+    0x00000A23, 0x0000A231, 0x0000A232, 0x00040A24, 0x0000A234, 0x0000A235, 0x0000A236, 0x0000A237,
+    0x0000A238, 0x0000A239, 0x0000A23A, 0x0000A23B, 0x0000A23C, 0x0000A23D, 0x0000A23E, 0x0000A23F,
+    0x00000A24, 0x0000A241, 0x0000A242, 0x0000A243, 0x00080A25, 0x0000A245, 0x0000A246, 0x0000A247,
+    0x0000A248, 0x0000A249, 0x0000A24A, 0x0000A24B, 0x0000A24C, 0x0000A24D, 0x0000A24E, 0x0000A24F,
+    0x00000A25, 0x0000A251, 0x0000A252, 0x0000A253, 0x0000A254, 0x00100A26, 0x0000A256, 0x0000A257,
+    0x0000A258, 0x0000A259, 0x0000A25A, 0x0000A25B, 0x0000A25C, 0x0000A25D, 0x0000A25E, 0x0000A25F,
+    0x00000A26, 0x0000A261, 0x0000A262, 0x0000A263, 0x0000A264, 0x0000A265, 0x00200A27, 0x0000A267,
+    0x0000A268, 0x0000A269, 0x0000A26A, 0x0000A26B, 0x0000A26C, 0x0000A26D, 0x0000A26E, 0x0000A26F,
+    0x00000A27, 0x0000A271, 0x0000A272, 0x0000A273, 0x0000A274, 0x0000A275, 0x0000A276, 0x00400A28,
+    0x0000A278, 0x0000A279, 0x0000A27A, 0x0000A27B, 0x0000A27C, 0x0000A27D, 0x0000A27E, 0x0000A27F,
+    0x00000A28, 0x0000A281, 0x0000A282, 0x0000A283, 0x0000A284, 0x0000A285, 0x0000A286, 0x0000A287,
+    0x00800A29, 0x0000A289, 0x0000A28A, 0x0000A28B, 0x0000A28C, 0x0000A28D, 0x0000A28E, 0x0000A28F,
+    0x00000A29, 0x0000A291, 0x0000A292, 0x0000A293, 0x0000A294, 0x0000A295, 0x0000A296, 0x0000A297,
+    0x0000A298, 0x01000A2A, 0x0000A29A, 0x0000A29B, 0x0000A29C, 0x0000A29D, 0x0000A29E, 0x0000A29F,
+    0x00000A2A, 0x0000A2A1, 0x0000A2A2, 0x0000A2A3, 0x0000A2A4, 0x0000A2A5, 0x0000A2A6, 0x0000A2A7,
+    0x0000A2A8, 0x0000A2A9, 0x82000A2B, 0x0000A2AB, 0x0000A2AC, 0x0000A2AD, 0x0000A2AE, 0x0000A2AF,
+    0x00000A2B, 0x0000A2B1, 0x0000A2B2, 0x0000A2B3, 0x0000A2B4, 0x0000A2B5, 0x0000A2B6, 0x0000A2B7,
+    0x0000A2B8, 0x0000A2B9, 0x0000A2BA, 0x04000A2C, 0x0000A2BC, 0x0000A2BD, 0x0000A2BE, 0x0000A2BF,
+    0x00000A2C, 0x0000A2C1, 0x0000A2C2, 0x0000A2C3, 0x0000A2C4, 0x0000A2C5, 0x0000A2C6, 0x0000A2C7,
+    0x0000A2C8, 0x0000A2C9, 0x0000A2CA, 0x0000A2CB, 0x08000A2D, 0x0000A2CD, 0x0000A2CE, 0x0000A2CF,
+    0x00000A2D, 0x0000A2D1, 0x0000A2D2, 0x0000A2D3, 0x0000A2D4, 0x0000A2D5, 0x0000A2D6, 0x0000A2D7,
+    0x0000A2D8, 0x0000A2D9, 0x0000A2DA, 0x0000A2DB, 0x0000A2DC, 0x10000A2E, 0x0000A2DE, 0x0000A2DF,
+    0x00000A2E, 0x0000A2E1, 0x0000A2E2, 0x0000A2E3, 0x0000A2E4, 0x0000A2E5, 0x0000A2E6, 0x0000A2E7,
+    0x0000A2E8, 0x0000A2E9, 0x0000A2EA, 0x0000A2EB, 0x0000A2EC, 0x0000A2ED, 0x20000A2F, 0x0000A2EF,
+    0x00000A2F, 0x0000A2F1, 0x0000A2F2, 0x0000A2F3, 0x0000A2F4, 0x0000A2F5, 0x0000A2F6, 0x0000A2F7,
+    0x0000A2F8, 0x0000A2F9, 0x0000A2FA, 0x0000A2FB, 0x0000A2FC, 0x0000A2FD, 0x0000A2FE, 0x0000A2FF,
+    0x000000A3, 0x00000A31, 0x00000A32, 0x000400A4, 0x00000A34, 0x00000A35, 0x00000A36, 0x00000A37,
+    0x00000A38, 0x00000A39, 0x00000A3A, 0x00000A3B, 0x00000A3C, 0x00000A3D, 0x00000A3E, 0x00000A3F,
+    0x00000A31, 0x00010A32, 0x0000A312, 0x0000A313, 0x0000A314, 0x0000A315, 0x0000A316, 0x0000A317,
+    0x0000A318, 0x0000A319, 0x0000A31A, 0x0000A31B, 0x0000A31C, 0x0000A31D, 0x0000A31E, 0x0000A31F,
+    0x00000A32, 0x0000A321, 0x00020A33, 0x0000A323, 0x0000A324, 0x0000A325, 0x0000A326, 0x0000A327,
+    0x0000A328, 0x0000A329, 0x0000A32A, 0x0000A32B, 0x0000A32C, 0x0000A32D, 0x0000A32E, 0x0000A32F,
+    0x000400A4, 0x00040A41, 0x00040A42, 0x00040A34, 0x00040A44, 0x00040A45, 0x00040A46, 0x00040A47,
+    0x00040A48, 0x00040A49, 0x00040A4A, 0x00040A4B, 0x00040A4C, 0x00040A4D, 0x00040A4E, 0x00040A4F,
+    0x00000A34, 0x0000A341, 0x0000A342, 0x0000A343, 0x00080A35, 0x0000A345, 0x0000A346, 0x0000A347,
+    0x0000A348, 0x0000A349, 0x0000A34A, 0x0000A34B, 0x0000A34C, 0x0000A34D, 0x0000A34E, 0x0000A34F,
+    0x00000A35, 0x0000A351, 0x0000A352, 0x0000A353, 0x0000A354, 0x00100A36, 0x0000A356, 0x0000A357,
+    0x0000A358, 0x0000A359, 0x0000A35A, 0x0000A35B, 0x0000A35C, 0x0000A35D, 0x0000A35E, 0x0000A35F,
+    0x00000A36, 0x0000A361, 0x0000A362, 0x0000A363, 0x0000A364, 0x0000A365, 0x00200A37, 0x0000A367,
+    0x0000A368, 0x0000A369, 0x0000A36A, 0x0000A36B, 0x0000A36C, 0x0000A36D, 0x0000A36E, 0x0000A36F,
+    0x00000A37, 0x0000A371, 0x0000A372, 0x0000A373, 0x0000A374, 0x0000A375, 0x0000A376, 0x00400A38,
+    0x0000A378, 0x0000A379, 0x0000A37A, 0x0000A37B, 0x0000A37C, 0x0000A37D, 0x0000A37E, 0x0000A37F,
+    0x00000A38, 0x0000A381, 0x0000A382, 0x0000A383, 0x0000A384, 0x0000A385, 0x0000A386, 0x0000A387,
+    0x00800A39, 0x0000A389, 0x0000A38A, 0x0000A38B, 0x0000A38C, 0x0000A38D, 0x0000A38E, 0x0000A38F,
+    0x00000A39, 0x0000A391, 0x0000A392, 0x0000A393, 0x0000A394, 0x0000A395, 0x0000A396, 0x0000A397,
+    0x0000A398, 0x01000A3A, 0x0000A39A, 0x0000A39B, 0x0000A39C, 0x0000A39D, 0x0000A39E, 0x0000A39F,
+    0x00000A3A, 0x0000A3A1, 0x0000A3A2, 0x0000A3A3, 0x0000A3A4, 0x0000A3A5, 0x0000A3A6, 0x0000A3A7,
+    0x0000A3A8, 0x0000A3A9, 0x82000A3B, 0x0000A3AB, 0x0000A3AC, 0x0000A3AD, 0x0000A3AE, 0x0000A3AF,
+    0x00000A3B, 0x0000A3B1, 0x0000A3B2, 0x0000A3B3, 0x0000A3B4, 0x0000A3B5, 0x0000A3B6, 0x0000A3B7,
+    0x0000A3B8, 0x0000A3B9, 0x0000A3BA, 0x04000A3C, 0x0000A3BC, 0x0000A3BD, 0x0000A3BE, 0x0000A3BF,
+    0x00000A3C, 0x0000A3C1, 0x0000A3C2, 0x0000A3C3, 0x0000A3C4, 0x0000A3C5, 0x0000A3C6, 0x0000A3C7,
+    0x0000A3C8, 0x0000A3C9, 0x0000A3CA, 0x0000A3CB, 0x08000A3D, 0x0000A3CD, 0x0000A3CE, 0x0000A3CF,
+    0x00000A3D, 0x0000A3D1, 0x0000A3D2, 0x0000A3D3, 0x0000A3D4, 0x0000A3D5, 0x0000A3D6, 0x0000A3D7,
+    0x0000A3D8, 0x0000A3D9, 0x0000A3DA, 0x0000A3DB, 0x0000A3DC, 0x10000A3E, 0x0000A3DE, 0x0000A3DF,
+    0x00000A3E, 0x0000A3E1, 0x0000A3E2, 0x0000A3E3, 0x0000A3E4, 0x0000A3E5, 0x0000A3E6, 0x0000A3E7,
+    0x0000A3E8, 0x0000A3E9, 0x0000A3EA, 0x0000A3EB, 0x0000A3EC, 0x0000A3ED, 0x20000A3F, 0x0000A3EF,
+    0x00000A3F, 0x0000A3F1, 0x0000A3F2, 0x0000A3F3, 0x0000A3F4, 0x0000A3F5, 0x0000A3F6, 0x0000A3F7,
+    0x0000A3F8, 0x0000A3F9, 0x0000A3FA, 0x0000A3FB, 0x0000A3FC, 0x0000A3FD, 0x0000A3FE, 0x0000A3FF,
+    0x000000A4, 0x00000A41, 0x00000A42, 0x00000A43, 0x000800A5, 0x00000A45, 0x00000A46, 0x00000A47,
+    0x00000A48, 0x00000A49, 0x00000A4A, 0x00000A4B, 0x00000A4C, 0x00000A4D, 0x00000A4E, 0x00000A4F,
+    0x00000A41, 0x00010A42, 0x0000A412, 0x0000A413, 0x0000A414, 0x0000A415, 0x0000A416, 0x0000A417,
+    0x0000A418, 0x0000A419, 0x0000A41A, 0x0000A41B, 0x0000A41C, 0x0000A41D, 0x0000A41E, 0x0000A41F,
+    0x00000A42, 0x0000A421, 0x00020A43, 0x0000A423, 0x0000A424, 0x0000A425, 0x0000A426, 0x0000A427,
+    0x0000A428, 0x0000A429, 0x0000A42A, 0x0000A42B, 0x0000A42C, 0x0000A42D, 0x0000A42E, 0x0000A42F,
+    0x00000A43, 0x0000A431, 0x0000A432, 0x00040A44, 0x0000A434, 0x0000A435, 0x0000A436, 0x0000A437,
+    0x0000A438, 0x0000A439, 0x0000A43A, 0x0000A43B, 0x0000A43C, 0x0000A43D, 0x0000A43E, 0x0000A43F,
+    0x000800A5, 0x00080A51, 0x00080A52, 0x00080A53, 0x00080A45, 0x00080A55, 0x00080A56, 0x00080A57,
+    0x00080A58, 0x00080A59, 0x00080A5A, 0x00080A5B, 0x00080A5C, 0x00080A5D, 0x00080A5E, 0x00080A5F,
+    0x00000A45, 0x0000A451, 0x0000A452, 0x0000A453, 0x0000A454, 0x00100A46, 0x0000A456, 0x0000A457,
+    0x0000A458, 0x0000A459, 0x0000A45A, 0x0000A45B, 0x0000A45C, 0x0000A45D, 0x0000A45E, 0x0000A45F,
+    0x00000A46, 0x0000A461, 0x0000A462, 0x0000A463, 0x0000A464, 0x0000A465, 0x00200A47, 0x0000A467,
+    0x0000A468, 0x0000A469, 0x0000A46A, 0x0000A46B, 0x0000A46C, 0x0000A46D, 0x0000A46E, 0x0000A46F,
+    0x00000A47, 0x0000A471, 0x0000A472, 0x0000A473, 0x0000A474, 0x0000A475, 0x0000A476, 0x00400A48,
+    0x0000A478, 0x0000A479, 0x0000A47A, 0x0000A47B, 0x0000A47C, 0x0000A47D, 0x0000A47E, 0x0000A47F,
+    0x00000A48, 0x0000A481, 0x0000A482, 0x0000A483, 0x0000A484, 0x0000A485, 0x0000A486, 0x0000A487,
+    0x00800A49, 0x0000A489, 0x0000A48A, 0x0000A48B, 0x0000A48C, 0x0000A48D, 0x0000A48E, 0x0000A48F,
+    0x00000A49, 0x0000A491, 0x0000A492, 0x0000A493, 0x0000A494, 0x0000A495, 0x0000A496, 0x0000A497,
+    0x0000A498, 0x01000A4A, 0x0000A49A, 0x0000A49B, 0x0000A49C, 0x0000A49D, 0x0000A49E, 0x0000A49F,
+    0x00000A4A, 0x0000A4A1, 0x0000A4A2, 0x0000A4A3, 0x0000A4A4, 0x0000A4A5, 0x0000A4A6, 0x0000A4A7,
+    0x0000A4A8, 0x0000A4A9, 0x82000A4B, 0x0000A4AB, 0x0000A4AC, 0x0000A4AD, 0x0000A4AE, 0x0000A4AF,
+    0x00000A4B, 0x0000A4B1, 0x0000A4B2, 0x0000A4B3, 0x0000A4B4, 0x0000A4B5, 0x0000A4B6, 0x0000A4B7,
+    0x0000A4B8, 0x0000A4B9, 0x0000A4BA, 0x04000A4C, 0x0000A4BC, 0x0000A4BD, 0x0000A4BE, 0x0000A4BF,
+    0x00000A4C, 0x0000A4C1, 0x0000A4C2, 0x0000A4C3, 0x0000A4C4, 0x0000A4C5, 0x0000A4C6, 0x0000A4C7,
+    0x0000A4C8, 0x0000A4C9, 0x0000A4CA, 0x0000A4CB, 0x08000A4D, 0x0000A4CD, 0x0000A4CE, 0x0000A4CF,
+    0x00000A4D, 0x0000A4D1, 0x0000A4D2, 0x0000A4D3, 0x0000A4D4, 0x0000A4D5, 0x0000A4D6, 0x0000A4D7,
+    0x0000A4D8, 0x0000A4D9, 0x0000A4DA, 0x0000A4DB, 0x0000A4DC, 0x10000A4E, 0x0000A4DE, 0x0000A4DF,
+    0x00000A4E, 0x0000A4E1, 0x0000A4E2, 0x0000A4E3, 0x0000A4E4, 0x0000A4E5, 0x0000A4E6, 0x0000A4E7,
+    0x0000A4E8, 0x0000A4E9, 0x0000A4EA, 0x0000A4EB, 0x0000A4EC, 0x0000A4ED, 0x20000A4F, 0x0000A4EF,
+    0x00000A4F, 0x0000A4F1, 0x0000A4F2, 0x0000A4F3, 0x0000A4F4, 0x0000A4F5, 0x0000A4F6, 0x0000A4F7,
+    0x0000A4F8, 0x0000A4F9, 0x0000A4FA, 0x0000A4FB, 0x0000A4FC, 0x0000A4FD, 0x0000A4FE, 0x0000A4FF,
+    0x000000A5, 0x00000A51, 0x00000A52, 0x00000A53, 0x00000A54, 0x001000A6, 0x00000A56, 0x00000A57,
+    0x00000A58, 0x00000A59, 0x00000A5A, 0x00000A5B, 0x00000A5C, 0x00000A5D, 0x00000A5E, 0x00000A5F,
+    0x00000A51, 0x00010A52, 0x0000A512, 0x0000A513, 0x0000A514, 0x0000A515, 0x0000A516, 0x0000A517,
+    0x0000A518, 0x0000A519, 0x0000A51A, 0x0000A51B, 0x0000A51C, 0x0000A51D, 0x0000A51E, 0x0000A51F,
+    0x00000A52, 0x0000A521, 0x00020A53, 0x0000A523, 0x0000A524, 0x0000A525, 0x0000A526, 0x0000A527,
+    0x0000A528, 0x0000A529, 0x0000A52A, 0x0000A52B, 0x0000A52C, 0x0000A52D, 0x0000A52E, 0x0000A52F,
+    0x00000A53, 0x0000A531, 0x0000A532, 0x00040A54, 0x0000A534, 0x0000A535, 0x0000A536, 0x0000A537,
+    0x0000A538, 0x0000A539, 0x0000A53A, 0x0000A53B, 0x0000A53C, 0x0000A53D, 0x0000A53E, 0x0000A53F,
+    0x00000A54, 0x0000A541, 0x0000A542, 0x0000A543, 0x00080A55, 0x0000A545, 0x0000A546, 0x0000A547,
+    0x0000A548, 0x0000A549, 0x0000A54A, 0x0000A54B, 0x0000A54C, 0x0000A54D, 0x0000A54E, 0x0000A54F,
+    0x001000A6, 0x00100A61, 0x00100A62, 0x00100A63, 0x00100A64, 0x00100A56, 0x00100A66, 0x00100A67,
+    0x00100A68, 0x00100A69, 0x00100A6A, 0x00100A6B, 0x00100A6C, 0x00100A6D, 0x00100A6E, 0x00100A6F,
+    0x00000A56, 0x0000A561, 0x0000A562, 0x0000A563, 0x0000A564, 0x0000A565, 0x00200A57, 0x0000A567,
+    0x0000A568, 0x0000A569, 0x0000A56A, 0x0000A56B, 0x0000A56C, 0x0000A56D, 0x0000A56E, 0x0000A56F,
+    0x00000A57, 0x0000A571, 0x0000A572, 0x0000A573, 0x0000A574, 0x0000A575, 0x0000A576, 0x00400A58,
+    0x0000A578, 0x0000A579, 0x0000A57A, 0x0000A57B, 0x0000A57C, 0x0000A57D, 0x0000A57E, 0x0000A57F,
+    0x00000A58, 0x0000A581, 0x0000A582, 0x0000A583, 0x0000A584, 0x0000A585, 0x0000A586, 0x0000A587,
+    0x00800A59, 0x0000A589, 0x0000A58A, 0x0000A58B, 0x0000A58C, 0x0000A58D, 0x0000A58E, 0x0000A58F,
+    0x00000A59, 0x0000A591, 0x0000A592, 0x0000A593, 0x0000A594, 0x0000A595, 0x0000A596, 0x0000A597,
+    0x0000A598, 0x01000A5A, 0x0000A59A, 0x0000A59B, 0x0000A59C, 0x0000A59D, 0x0000A59E, 0x0000A59F,
+    0x00000A5A, 0x0000A5A1, 0x0000A5A2, 0x0000A5A3, 0x0000A5A4, 0x0000A5A5, 0x0000A5A6, 0x0000A5A7,
+    0x0000A5A8, 0x0000A5A9, 0x82000A5B, 0x0000A5AB, 0x0000A5AC, 0x0000A5AD, 0x0000A5AE, 0x0000A5AF,
+    0x00000A5B, 0x0000A5B1, 0x0000A5B2, 0x0000A5B3, 0x0000A5B4, 0x0000A5B5, 0x0000A5B6, 0x0000A5B7,
+    0x0000A5B8, 0x0000A5B9, 0x0000A5BA, 0x04000A5C, 0x0000A5BC, 0x0000A5BD, 0x0000A5BE, 0x0000A5BF,
+    0x00000A5C, 0x0000A5C1, 0x0000A5C2, 0x0000A5C3, 0x0000A5C4, 0x0000A5C5, 0x0000A5C6, 0x0000A5C7,
+    0x0000A5C8, 0x0000A5C9, 0x0000A5CA, 0x0000A5CB, 0x08000A5D, 0x0000A5CD, 0x0000A5CE, 0x0000A5CF,
+    0x00000A5D, 0x0000A5D1, 0x0000A5D2, 0x0000A5D3, 0x0000A5D4, 0x0000A5D5, 0x0000A5D6, 0x0000A5D7,
+    0x0000A5D8, 0x0000A5D9, 0x0000A5DA, 0x0000A5DB, 0x0000A5DC, 0x10000A5E, 0x0000A5DE, 0x0000A5DF,
+    0x00000A5E, 0x0000A5E1, 0x0000A5E2, 0x0000A5E3, 0x0000A5E4, 0x0000A5E5, 0x0000A5E6, 0x0000A5E7,
+    0x0000A5E8, 0x0000A5E9, 0x0000A5EA, 0x0000A5EB, 0x0000A5EC, 0x0000A5ED, 0x20000A5F, 0x0000A5EF,
+    0x00000A5F, 0x0000A5F1, 0x0000A5F2, 0x0000A5F3, 0x0000A5F4, 0x0000A5F5, 0x0000A5F6, 0x0000A5F7,
+    0x0000A5F8, 0x0000A5F9, 0x0000A5FA, 0x0000A5FB, 0x0000A5FC, 0x0000A5FD, 0x0000A5FE, 0x0000A5FF,
+    0x000000A6, 0x00000A61, 0x00000A62, 0x00000A63, 0x00000A64, 0x00000A65, 0x002000A7, 0x00000A67,
+    0x00000A68, 0x00000A69, 0x00000A6A, 0x00000A6B, 0x00000A6C, 0x00000A6D, 0x00000A6E, 0x00000A6F,
+    0x00000A61, 0x00010A62, 0x0000A612, 0x0000A613, 0x0000A614, 0x0000A615, 0x0000A616, 0x0000A617,
+    0x0000A618, 0x0000A619, 0x0000A61A, 0x0000A61B, 0x0000A61C, 0x0000A61D, 0x0000A61E, 0x0000A61F,
+    0x00000A62, 0x0000A621, 0x00020A63, 0x0000A623, 0x0000A624, 0x0000A625, 0x0000A626, 0x0000A627,
+    0x0000A628, 0x0000A629, 0x0000A62A, 0x0000A62B, 0x0000A62C, 0x0000A62D, 0x0000A62E, 0x0000A62F,
+    0x00000A63, 0x0000A631, 0x0000A632, 0x00040A64, 0x0000A634, 0x0000A635, 0x0000A636, 0x0000A637,
+    0x0000A638, 0x0000A639, 0x0000A63A, 0x0000A63B, 0x0000A63C, 0x0000A63D, 0x0000A63E, 0x0000A63F,
+    0x00000A64, 0x0000A641, 0x0000A642, 0x0000A643, 0x00080A65, 0x0000A645, 0x0000A646, 0x0000A647,
+    0x0000A648, 0x0000A649, 0x0000A64A, 0x0000A64B, 0x0000A64C, 0x0000A64D, 0x0000A64E, 0x0000A64F,
+    0x00000A65, 0x0000A651, 0x0000A652, 0x0000A653, 0x0000A654, 0x00100A66, 0x0000A656, 0x0000A657,
+    0x0000A658, 0x0000A659, 0x0000A65A, 0x0000A65B, 0x0000A65C, 0x0000A65D, 0x0000A65E, 0x0000A65F,
+    0x002000A7, 0x00200A71, 0x00200A72, 0x00200A73, 0x00200A74, 0x00200A75, 0x00200A67, 0x00200A77,
+    0x00200A78, 0x00200A79, 0x00200A7A, 0x00200A7B, 0x00200A7C, 0x00200A7D, 0x00200A7E, 0x00200A7F,
+    0x00000A67, 0x0000A671, 0x0000A672, 0x0000A673, 0x0000A674, 0x0000A675, 0x0000A676, 0x00400A68,
+    0x0000A678, 0x0000A679, 0x0000A67A, 0x0000A67B, 0x0000A67C, 0x0000A67D, 0x0000A67E, 0x0000A67F,
+    0x00000A68, 0x0000A681, 0x0000A682, 0x0000A683, 0x0000A684, 0x0000A685, 0x0000A686, 0x0000A687,
+    0x00800A69, 0x0000A689, 0x0000A68A, 0x0000A68B, 0x0000A68C, 0x0000A68D, 0x0000A68E, 0x0000A68F,
+    0x00000A69, 0x0000A691, 0x0000A692, 0x0000A693, 0x0000A694, 0x0000A695, 0x0000A696, 0x0000A697,
+    0x0000A698, 0x01000A6A, 0x0000A69A, 0x0000A69B, 0x0000A69C, 0x0000A69D, 0x0000A69E, 0x0000A69F,
+    0x00000A6A, 0x0000A6A1, 0x0000A6A2, 0x0000A6A3, 0x0000A6A4, 0x0000A6A5, 0x0000A6A6, 0x0000A6A7,
+    0x0000A6A8, 0x0000A6A9, 0x82000A6B, 0x0000A6AB, 0x0000A6AC, 0x0000A6AD, 0x0000A6AE, 0x0000A6AF,
+    0x00000A6B, 0x0000A6B1, 0x0000A6B2, 0x0000A6B3, 0x0000A6B4, 0x0000A6B5, 0x0000A6B6, 0x0000A6B7,
+    0x0000A6B8, 0x0000A6B9, 0x0000A6BA, 0x04000A6C, 0x0000A6BC, 0x0000A6BD, 0x0000A6BE, 0x0000A6BF,
+    0x00000A6C, 0x0000A6C1, 0x0000A6C2, 0x0000A6C3, 0x0000A6C4, 0x0000A6C5, 0x0000A6C6, 0x0000A6C7,
+    0x0000A6C8, 0x0000A6C9, 0x0000A6CA, 0x0000A6CB, 0x08000A6D, 0x0000A6CD, 0x0000A6CE, 0x0000A6CF,
+    0x00000A6D, 0x0000A6D1, 0x0000A6D2, 0x0000A6D3, 0x0000A6D4, 0x0000A6D5, 0x0000A6D6, 0x0000A6D7,
+    0x0000A6D8, 0x0000A6D9, 0x0000A6DA, 0x0000A6DB, 0x0000A6DC, 0x10000A6E, 0x0000A6DE, 0x0000A6DF,
+    0x00000A6E, 0x0000A6E1, 0x0000A6E2, 0x0000A6E3, 0x0000A6E4, 0x0000A6E5, 0x0000A6E6, 0x0000A6E7,
+    0x0000A6E8, 0x0000A6E9, 0x0000A6EA, 0x0000A6EB, 0x0000A6EC, 0x0000A6ED, 0x20000A6F, 0x0000A6EF,
+    0x00000A6F, 0x0000A6F1, 0x0000A6F2, 0x0000A6F3, 0x0000A6F4, 0x0000A6F5, 0x0000A6F6, 0x0000A6F7,
+    0x0000A6F8, 0x0000A6F9, 0x0000A6FA, 0x0000A6FB, 0x0000A6FC, 0x0000A6FD, 0x0000A6FE, 0x0000A6FF,
+    0x000000A7, 0x00000A71, 0x00000A72, 0x00000A73, 0x00000A74, 0x00000A75, 0x00000A76, 0x004000A8,
+    0x00000A78, 0x00000A79, 0x00000A7A, 0x00000A7B, 0x00000A7C, 0x00000A7D, 0x00000A7E, 0x00000A7F,
+    0x00000A71, 0x00010A72, 0x0000A712, 0x0000A713, 0x0000A714, 0x0000A715, 0x0000A716, 0x0000A717,
+    0x0000A718, 0x0000A719, 0x0000A71A, 0x0000A71B, 0x0000A71C, 0x0000A71D, 0x0000A71E, 0x0000A71F,
+    0x00000A72, 0x0000A721, 0x00020A73, 0x0000A723, 0x0000A724, 0x0000A725, 0x0000A726, 0x0000A727,
+    0x0000A728, 0x0000A729, 0x0000A72A, 0x0000A72B, 0x0000A72C, 0x0000A72D, 0x0000A72E, 0x0000A72F,
+    0x00000A73, 0x0000A731, 0x0000A732, 0x00040A74, 0x0000A734, 0x0000A735, 0x0000A736, 0x0000A737,
+    0x0000A738, 0x0000A739, 0x0000A73A, 0x0000A73B, 0x0000A73C, 0x0000A73D, 0x0000A73E, 0x0000A73F,
+    0x00000A74, 0x0000A741, 0x0000A742, 0x0000A743, 0x00080A75, 0x0000A745, 0x0000A746, 0x0000A747,
+    0x0000A748, 0x0000A749, 0x0000A74A, 0x0000A74B, 0x0000A74C, 0x0000A74D, 0x0000A74E, 0x0000A74F,
+    0x00000A75, 0x0000A751, 0x0000A752, 0x0000A753, 0x0000A754, 0x00100A76, 0x0000A756, 0x0000A757,
+    0x0000A758, 0x0000A759, 0x0000A75A, 0x0000A75B, 0x0000A75C, 0x0000A75D, 0x0000A75E, 0x0000A75F,
+    0x00000A76, 0x0000A761, 0x0000A762, 0x0000A763, 0x0000A764, 0x0000A765, 0x00200A77, 0x0000A767,
+    0x0000A768, 0x0000A769, 0x0000A76A, 0x0000A76B, 0x0000A76C, 0x0000A76D, 0x0000A76E, 0x0000A76F,
+    0x004000A8, 0x00400A81, 0x00400A82, 0x00400A83, 0x00400A84, 0x00400A85, 0x00400A86, 0x00400A78,
+    0x00400A88, 0x00400A89, 0x00400A8A, 0x00400A8B, 0x00400A8C, 0x00400A8D, 0x00400A8E, 0x00400A8F,
+    0x00000A78, 0x0000A781, 0x0000A782, 0x0000A783, 0x0000A784, 0x0000A785, 0x0000A786, 0x0000A787,
+    0x00800A79, 0x0000A789, 0x0000A78A, 0x0000A78B, 0x0000A78C, 0x0000A78D, 0x0000A78E, 0x0000A78F,
+    0x00000A79, 0x0000A791, 0x0000A792, 0x0000A793, 0x0000A794, 0x0000A795, 0x0000A796, 0x0000A797,
+    0x0000A798, 0x01000A7A, 0x0000A79A, 0x0000A79B, 0x0000A79C, 0x0000A79D, 0x0000A79E, 0x0000A79F,
+    0x00000A7A, 0x0000A7A1, 0x0000A7A2, 0x0000A7A3, 0x0000A7A4, 0x0000A7A5, 0x0000A7A6, 0x0000A7A7,
+    0x0000A7A8, 0x0000A7A9, 0x82000A7B, 0x0000A7AB, 0x0000A7AC, 0x0000A7AD, 0x0000A7AE, 0x0000A7AF,
+    0x00000A7B, 0x0000A7B1, 0x0000A7B2, 0x0000A7B3, 0x0000A7B4, 0x0000A7B5, 0x0000A7B6, 0x0000A7B7,
+    0x0000A7B8, 0x0000A7B9, 0x0000A7BA, 0x04000A7C, 0x0000A7BC, 0x0000A7BD, 0x0000A7BE, 0x0000A7BF,
+    0x00000A7C, 0x0000A7C1, 0x0000A7C2, 0x0000A7C3, 0x0000A7C4, 0x0000A7C5, 0x0000A7C6, 0x0000A7C7,
+    0x0000A7C8, 0x0000A7C9, 0x0000A7CA, 0x0000A7CB, 0x08000A7D, 0x0000A7CD, 0x0000A7CE, 0x0000A7CF,
+    0x00000A7D, 0x0000A7D1, 0x0000A7D2, 0x0000A7D3, 0x0000A7D4, 0x0000A7D5, 0x0000A7D6, 0x0000A7D7,
+    0x0000A7D8, 0x0000A7D9, 0x0000A7DA, 0x0000A7DB, 0x0000A7DC, 0x10000A7E, 0x0000A7DE, 0x0000A7DF,
+    0x00000A7E, 0x0000A7E1, 0x0000A7E2, 0x0000A7E3, 0x0000A7E4, 0x0000A7E5, 0x0000A7E6, 0x0000A7E7,
+    0x0000A7E8, 0x0000A7E9, 0x0000A7EA, 0x0000A7EB, 0x0000A7EC, 0x0000A7ED, 0x20000A7F, 0x0000A7EF,
+    0x00000A7F, 0x0000A7F1, 0x0000A7F2, 0x0000A7F3, 0x0000A7F4, 0x0000A7F5, 0x0000A7F6, 0x0000A7F7,
+    0x0000A7F8, 0x0000A7F9, 0x0000A7FA, 0x0000A7FB, 0x0000A7FC, 0x0000A7FD, 0x0000A7FE, 0x0000A7FF,
+    0x000000A8, 0x00000A81, 0x00000A82, 0x00000A83, 0x00000A84, 0x00000A85, 0x00000A86, 0x00000A87,
+    0x008000A9, 0x00000A89, 0x00000A8A, 0x00000A8B, 0x00000A8C, 0x00000A8D, 0x00000A8E, 0x00000A8F,
+    0x00000A81, 0x00010A82, 0x0000A812, 0x0000A813, 0x0000A814, 0x0000A815, 0x0000A816, 0x0000A817,
+    0x0000A818, 0x0000A819, 0x0000A81A, 0x0000A81B, 0x0000A81C, 0x0000A81D, 0x0000A81E, 0x0000A81F,
+    0x00000A82, 0x0000A821, 0x00020A83, 0x0000A823, 0x0000A824, 0x0000A825, 0x0000A826, 0x0000A827,
+    0x0000A828, 0x0000A829, 0x0000A82A, 0x0000A82B, 0x0000A82C, 0x0000A82D, 0x0000A82E, 0x0000A82F,
+    0x00000A83, 0x0000A831, 0x0000A832, 0x00040A84, 0x0000A834, 0x0000A835, 0x0000A836, 0x0000A837,
+    0x0000A838, 0x0000A839, 0x0000A83A, 0x0000A83B, 0x0000A83C, 0x0000A83D, 0x0000A83E, 0x0000A83F,
+    0x00000A84, 0x0000A841, 0x0000A842, 0x0000A843, 0x00080A85, 0x0000A845, 0x0000A846, 0x0000A847,
+    0x0000A848, 0x0000A849, 0x0000A84A, 0x0000A84B, 0x0000A84C, 0x0000A84D, 0x0000A84E, 0x0000A84F,
+    0x00000A85, 0x0000A851, 0x0000A852, 0x0000A853, 0x0000A854, 0x00100A86, 0x0000A856, 0x0000A857,
+    0x0000A858, 0x0000A859, 0x0000A85A, 0x0000A85B, 0x0000A85C, 0x0000A85D, 0x0000A85E, 0x0000A85F,
+    0x00000A86, 0x0000A861, 0x0000A862, 0x0000A863, 0x0000A864, 0x0000A865, 0x00200A87, 0x0000A867,
+    0x0000A868, 0x0000A869, 0x0000A86A, 0x0000A86B, 0x0000A86C, 0x0000A86D, 0x0000A86E, 0x0000A86F,
+    0x00000A87, 0x0000A871, 0x0000A872, 0x0000A873, 0x0000A874, 0x0000A875, 0x0000A876, 0x00400A88,
+    0x0000A878, 0x0000A879, 0x0000A87A, 0x0000A87B, 0x0000A87C, 0x0000A87D, 0x0000A87E, 0x0000A87F,
+    0x008000A9, 0x00800A91, 0x00800A92, 0x00800A93, 0x00800A94, 0x00800A95, 0x00800A96, 0x00800A97,
+    0x00800A89, 0x00800A99, 0x00800A9A, 0x00800A9B, 0x00800A9C, 0x00800A9D, 0x00800A9E, 0x00800A9F,
+    0x00000A89, 0x0000A891, 0x0000A892, 0x0000A893, 0x0000A894, 0x0000A895, 0x0000A896, 0x0000A897,
+    0x0000A898, 0x01000A8A, 0x0000A89A, 0x0000A89B, 0x0000A89C, 0x0000A89D, 0x0000A89E, 0x0000A89F,
+    0x00000A8A, 0x0000A8A1, 0x0000A8A2, 0x0000A8A3, 0x0000A8A4, 0x0000A8A5, 0x0000A8A6, 0x0000A8A7,
+    0x0000A8A8, 0x0000A8A9, 0x82000A8B, 0x0000A8AB, 0x0000A8AC, 0x0000A8AD, 0x0000A8AE, 0x0000A8AF,
+    0x00000A8B, 0x0000A8B1, 0x0000A8B2, 0x0000A8B3, 0x0000A8B4, 0x0000A8B5, 0x0000A8B6, 0x0000A8B7,
+    0x0000A8B8, 0x0000A8B9, 0x0000A8BA, 0x04000A8C, 0x0000A8BC, 0x0000A8BD, 0x0000A8BE, 0x0000A8BF,
+    0x00000A8C, 0x0000A8C1, 0x0000A8C2, 0x0000A8C3, 0x0000A8C4, 0x0000A8C5, 0x0000A8C6, 0x0000A8C7,
+    0x0000A8C8, 0x0000A8C9, 0x0000A8CA, 0x0000A8CB, 0x08000A8D, 0x0000A8CD, 0x0000A8CE, 0x0000A8CF,
+    0x00000A8D, 0x0000A8D1, 0x0000A8D2, 0x0000A8D3, 0x0000A8D4, 0x0000A8D5, 0x0000A8D6, 0x0000A8D7,
+    0x0000A8D8, 0x0000A8D9, 0x0000A8DA, 0x0000A8DB, 0x0000A8DC, 0x10000A8E, 0x0000A8DE, 0x0000A8DF,
+    0x00000A8E, 0x0000A8E1, 0x0000A8E2, 0x0000A8E3, 0x0000A8E4, 0x0000A8E5, 0x0000A8E6, 0x0000A8E7,
+    0x0000A8E8, 0x0000A8E9, 0x0000A8EA, 0x0000A8EB, 0x0000A8EC, 0x0000A8ED, 0x20000A8F, 0x0000A8EF,
+    0x00000A8F, 0x0000A8F1, 0x0000A8F2, 0x0000A8F3, 0x0000A8F4, 0x0000A8F5, 0x0000A8F6, 0x0000A8F7,
+    0x0000A8F8, 0x0000A8F9, 0x0000A8FA, 0x0000A8FB, 0x0000A8FC, 0x0000A8FD, 0x0000A8FE, 0x0000A8FF,
+    0x000000A9, 0x00000A91, 0x00000A92, 0x00000A93, 0x00000A94, 0x00000A95, 0x00000A96, 0x00000A97,
+    0x00000A98, 0x010000AA, 0x00000A9A, 0x00000A9B, 0x00000A9C, 0x00000A9D, 0x00000A9E, 0x00000A9F,
+    0x00000A91, 0x00010A92, 0x0000A912, 0x0000A913, 0x0000A914, 0x0000A915, 0x0000A916, 0x0000A917,
+    0x0000A918, 0x0000A919, 0x0000A91A, 0x0000A91B, 0x0000A91C, 0x0000A91D, 0x0000A91E, 0x0000A91F,
+    0x00000A92, 0x0000A921, 0x00020A93, 0x0000A923, 0x0000A924, 0x0000A925, 0x0000A926, 0x0000A927,
+    0x0000A928, 0x0000A929, 0x0000A92A, 0x0000A92B, 0x0000A92C, 0x0000A92D, 0x0000A92E, 0x0000A92F,
+    0x00000A93, 0x0000A931, 0x0000A932, 0x00040A94, 0x0000A934, 0x0000A935, 0x0000A936, 0x0000A937,
+    0x0000A938, 0x0000A939, 0x0000A93A, 0x0000A93B, 0x0000A93C, 0x0000A93D, 0x0000A93E, 0x0000A93F,
+    0x00000A94, 0x0000A941, 0x0000A942, 0x0000A943, 0x00080A95, 0x0000A945, 0x0000A946, 0x0000A947,
+    0x0000A948, 0x0000A949, 0x0000A94A, 0x0000A94B, 0x0000A94C, 0x0000A94D, 0x0000A94E, 0x0000A94F,
+    0x00000A95, 0x0000A951, 0x0000A952, 0x0000A953, 0x0000A954, 0x00100A96, 0x0000A956, 0x0000A957,
+    0x0000A958, 0x0000A959, 0x0000A95A, 0x0000A95B, 0x0000A95C, 0x0000A95D, 0x0000A95E, 0x0000A95F,
+    0x00000A96, 0x0000A961, 0x0000A962, 0x0000A963, 0x0000A964, 0x0000A965, 0x00200A97, 0x0000A967,
+    0x0000A968, 0x0000A969, 0x0000A96A, 0x0000A96B, 0x0000A96C, 0x0000A96D, 0x0000A96E, 0x0000A96F,
+    0x00000A97, 0x0000A971, 0x0000A972, 0x0000A973, 0x0000A974, 0x0000A975, 0x0000A976, 0x00400A98,
+    0x0000A978, 0x0000A979, 0x0000A97A, 0x0000A97B, 0x0000A97C, 0x0000A97D, 0x0000A97E, 0x0000A97F,
+    0x00000A98, 0x0000A981, 0x0000A982, 0x0000A983, 0x0000A984, 0x0000A985, 0x0000A986, 0x0000A987,
+    0x00800A99, 0x0000A989, 0x0000A98A, 0x0000A98B, 0x0000A98C, 0x0000A98D, 0x0000A98E, 0x0000A98F,
+    0x010000AA, 0x01000AA1, 0x01000AA2, 0x01000AA3, 0x01000AA4, 0x01000AA5, 0x01000AA6, 0x01000AA7,
+    0x01000AA8, 0x01000A9A, 0x01000AAA, 0x01000AAB, 0x01000AAC, 0x01000AAD, 0x01000AAE, 0x01000AAF,
+    0x00000A9A, 0x0000A9A1, 0x0000A9A2, 0x0000A9A3, 0x0000A9A4, 0x0000A9A5, 0x0000A9A6, 0x0000A9A7,
+    0x0000A9A8, 0x0000A9A9, 0x82000A9B, 0x0000A9AB, 0x0000A9AC, 0x0000A9AD, 0x0000A9AE, 0x0000A9AF,
+    0x00000A9B, 0x0000A9B1, 0x0000A9B2, 0x0000A9B3, 0x0000A9B4, 0x0000A9B5, 0x0000A9B6, 0x0000A9B7,
+    0x0000A9B8, 0x0000A9B9, 0x0000A9BA, 0x04000A9C, 0x0000A9BC, 0x0000A9BD, 0x0000A9BE, 0x0000A9BF,
+    0x00000A9C, 0x0000A9C1, 0x0000A9C2, 0x0000A9C3, 0x0000A9C4, 0x0000A9C5, 0x0000A9C6, 0x0000A9C7,
+    0x0000A9C8, 0x0000A9C9, 0x0000A9CA, 0x0000A9CB, 0x08000A9D, 0x0000A9CD, 0x0000A9CE, 0x0000A9CF,
+    0x00000A9D, 0x0000A9D1, 0x0000A9D2, 0x0000A9D3, 0x0000A9D4, 0x0000A9D5, 0x0000A9D6, 0x0000A9D7,
+    0x0000A9D8, 0x0000A9D9, 0x0000A9DA, 0x0000A9DB, 0x0000A9DC, 0x10000A9E, 0x0000A9DE, 0x0000A9DF,
+    0x00000A9E, 0x0000A9E1, 0x0000A9E2, 0x0000A9E3, 0x0000A9E4, 0x0000A9E5, 0x0000A9E6, 0x0000A9E7,
+    0x0000A9E8, 0x0000A9E9, 0x0000A9EA, 0x0000A9EB, 0x0000A9EC, 0x0000A9ED, 0x20000A9F, 0x0000A9EF,
+    0x00000A9F, 0x0000A9F1, 0x0000A9F2, 0x0000A9F3, 0x0000A9F4, 0x0000A9F5, 0x0000A9F6, 0x0000A9F7,
+    0x0000A9F8, 0x0000A9F9, 0x0000A9FA, 0x0000A9FB, 0x0000A9FC, 0x0000A9FD, 0x0000A9FE, 0x0000A9FF,
+    0x8200000B, 0x820000B1, 0x820000B2, 0x820000B3, 0x820000B4, 0x820000B5, 0x820000B6, 0x820000B7,
+    0x820000B8, 0x820000B9, 0x820000AB, 0x820000BB, 0x820000BC, 0x820000BD, 0x820000BE, 0x820000BF,
+    0x820000B1, 0x820100B2, 0x82000B12, 0x82000B13, 0x82000B14, 0x82000B15, 0x82000B16, 0x82000B17,
+    0x82000B18, 0x82000B19, 0x82000B1A, 0x82000B1B, 0x82000B1C, 0x82000B1D, 0x82000B1E, 0x82000B1F,
+    0x820000B2, 0x82000B21, 0x820200B3, 0x82000B23, 0x82000B24, 0x82000B25, 0x82000B26, 0x82000B27,
+    0x82000B28, 0x82000B29, 0x82000B2A, 0x82000B2B, 0x82000B2C, 0x82000B2D, 0x82000B2E, 0x82000B2F,
+    0x820000B3, 0x82000B31, 0x82000B32, 0x820400B4, 0x82000B34, 0x82000B35, 0x82000B36, 0x82000B37,
+    0x82000B38, 0x82000B39, 0x82000B3A, 0x82000B3B, 0x82000B3C, 0x82000B3D, 0x82000B3E, 0x82000B3F,
+    0x820000B4, 0x82000B41, 0x82000B42, 0x82000B43, 0x820800B5, 0x82000B45, 0x82000B46, 0x82000B47,
+    0x82000B48, 0x82000B49, 0x82000B4A, 0x82000B4B, 0x82000B4C, 0x82000B4D, 0x82000B4E, 0x82000B4F,
+    0x820000B5, 0x82000B51, 0x82000B52, 0x82000B53, 0x82000B54, 0x821000B6, 0x82000B56, 0x82000B57,
+    0x82000B58, 0x82000B59, 0x82000B5A, 0x82000B5B, 0x82000B5C, 0x82000B5D, 0x82000B5E, 0x82000B5F,
+    0x820000B6, 0x82000B61, 0x82000B62, 0x82000B63, 0x82000B64, 0x82000B65, 0x822000B7, 0x82000B67,
+    0x82000B68, 0x82000B69, 0x82000B6A, 0x82000B6B, 0x82000B6C, 0x82000B6D, 0x82000B6E, 0x82000B6F,
+    0x820000B7, 0x82000B71, 0x82000B72, 0x82000B73, 0x82000B74, 0x82000B75, 0x82000B76, 0x824000B8,
+    0x82000B78, 0x82000B79, 0x82000B7A, 0x82000B7B, 0x82000B7C, 0x82000B7D, 0x82000B7E, 0x82000B7F,
+    0x820000B8, 0x82000B81, 0x82000B82, 0x82000B83, 0x82000B84, 0x82000B85, 0x82000B86, 0x82000B87,
+    0x828000B9, 0x82000B89, 0x82000B8A, 0x82000B8B, 0x82000B8C, 0x82000B8D, 0x82000B8E, 0x82000B8F,
+    0x820000B9, 0x82000B91, 0x82000B92, 0x82000B93, 0x82000B94, 0x82000B95, 0x82000B96, 0x82000B97,
+    0x82000B98, 0x830000BA, 0x82000B9A, 0x82000B9B, 0x82000B9C, 0x82000B9D, 0x82000B9E, 0x82000B9F,
+    0x820000AB, 0x82000AB1, 0x82000AB2, 0x82000AB3, 0x82000AB4, 0x82000AB5, 0x82000AB6, 0x82000AB7,
+    0x82000AB8, 0x82000AB9, 0x840000BB, 0x82000ABB, 0x82000ABC, 0x82000ABD, 0x82000ABE, 0x82000ABF,
+    0x820000BB, 0x82000BB1, 0x82000BB2, 0x82000BB3, 0x82000BB4, 0x82000BB5, 0x82000BB6, 0x82000BB7,
+    0x82000BB8, 0x82000BB9, 0x82000BBA, 0x860000BC, 0x82000BBC, 0x82000BBD, 0x82000BBE, 0x82000BBF,
+    0x820000BC, 0x82000BC1, 0x82000BC2, 0x82000BC3, 0x82000BC4, 0x82000BC5, 0x82000BC6, 0x82000BC7,
+    0x82000BC8, 0x82000BC9, 0x82000BCA, 0x82000BCB, 0x8A0000BD, 0x82000BCD, 0x82000BCE, 0x82000BCF,
+    0x820000BD, 0x82000BD1, 0x82000BD2, 0x82000BD3, 0x82000BD4, 0x82000BD5, 0x82000BD6, 0x82000BD7,
+    0x82000BD8, 0x82000BD9, 0x82000BDA, 0x82000BDB, 0x82000BDC, 0x920000BE, 0x82000BDE, 0x82000BDF,
+    0x820000BE, 0x82000BE1, 0x82000BE2, 0x82000BE3, 0x82000BE4, 0x82000BE5, 0x82000BE6, 0x82000BE7,
+    0x82000BE8, 0x82000BE9, 0x82000BEA, 0x82000BEB, 0x82000BEC, 0x82000BED, 0xA20000BF, 0x82000BEF,
+    0x820000BF, 0x82000BF1, 0x82000BF2, 0x82000BF3, 0x82000BF4, 0x82000BF5, 0x82000BF6, 0x82000BF7,
+    0x82000BF8, 0x82000BF9, 0x82000BFA, 0x82000BFB, 0x82000BFC, 0x82000BFD, 0x82000BFE, 0x82000BFF,
+    0x000000AB, 0x00000AB1, 0x00000AB2, 0x00000AB3, 0x00000AB4, 0x00000AB5, 0x00000AB6, 0x00000AB7,
+    0x00000AB8, 0x00000AB9, 0x00000ABA, 0x040000AC, 0x00000ABC, 0x00000ABD, 0x00000ABE, 0x00000ABF,
+    0x00000AB1, 0x00010AB2, 0x0000AB12, 0x0000AB13, 0x0000AB14, 0x0000AB15, 0x0000AB16, 0x0000AB17,
+    0x0000AB18, 0x0000AB19, 0x0000AB1A, 0x0000AB1B, 0x0000AB1C, 0x0000AB1D, 0x0000AB1E, 0x0000AB1F,
+    0x00000AB2, 0x0000AB21, 0x00020AB3, 0x0000AB23, 0x0000AB24, 0x0000AB25, 0x0000AB26, 0x0000AB27,
+    0x0000AB28, 0x0000AB29, 0x0000AB2A, 0x0000AB2B, 0x0000AB2C, 0x0000AB2D, 0x0000AB2E, 0x0000AB2F,
+    0x00000AB3, 0x0000AB31, 0x0000AB32, 0x00040AB4, 0x0000AB34, 0x0000AB35, 0x0000AB36, 0x0000AB37,
+    0x0000AB38, 0x0000AB39, 0x0000AB3A, 0x0000AB3B, 0x0000AB3C, 0x0000AB3D, 0x0000AB3E, 0x0000AB3F,
+    0x00000AB4, 0x0000AB41, 0x0000AB42, 0x0000AB43, 0x00080AB5, 0x0000AB45, 0x0000AB46, 0x0000AB47,
+    0x0000AB48, 0x0000AB49, 0x0000AB4A, 0x0000AB4B, 0x0000AB4C, 0x0000AB4D, 0x0000AB4E, 0x0000AB4F,
+    0x00000AB5, 0x0000AB51, 0x0000AB52, 0x0000AB53, 0x0000AB54, 0x00100AB6, 0x0000AB56, 0x0000AB57,
+    0x0000AB58, 0x0000AB59, 0x0000AB5A, 0x0000AB5B, 0x0000AB5C, 0x0000AB5D, 0x0000AB5E, 0x0000AB5F,
+    0x00000AB6, 0x0000AB61, 0x0000AB62, 0x0000AB63, 0x0000AB64, 0x0000AB65, 0x00200AB7, 0x0000AB67,
+    0x0000AB68, 0x0000AB69, 0x0000AB6A, 0x0000AB6B, 0x0000AB6C, 0x0000AB6D, 0x0000AB6E, 0x0000AB6F,
+    0x00000AB7, 0x0000AB71, 0x0000AB72, 0x0000AB73, 0x0000AB74, 0x0000AB75, 0x0000AB76, 0x00400AB8,
+    0x0000AB78, 0x0000AB79, 0x0000AB7A, 0x0000AB7B, 0x0000AB7C, 0x0000AB7D, 0x0000AB7E, 0x0000AB7F,
+    0x00000AB8, 0x0000AB81, 0x0000AB82, 0x0000AB83, 0x0000AB84, 0x0000AB85, 0x0000AB86, 0x0000AB87,
+    0x00800AB9, 0x0000AB89, 0x0000AB8A, 0x0000AB8B, 0x0000AB8C, 0x0000AB8D, 0x0000AB8E, 0x0000AB8F,
+    0x00000AB9, 0x0000AB91, 0x0000AB92, 0x0000AB93, 0x0000AB94, 0x0000AB95, 0x0000AB96, 0x0000AB97,
+    0x0000AB98, 0x01000ABA, 0x0000AB9A, 0x0000AB9B, 0x0000AB9C, 0x0000AB9D, 0x0000AB9E, 0x0000AB9F,
+    0x00000ABA, 0x0000ABA1, 0x0000ABA2, 0x0000ABA3, 0x0000ABA4, 0x0000ABA5, 0x0000ABA6, 0x0000ABA7,
+    0x0000ABA8, 0x0000ABA9, 0x82000ABB, 0x0000ABAB, 0x0000ABAC, 0x0000ABAD, 0x0000ABAE, 0x0000ABAF,
+    0x040000AC, 0x04000AC1, 0x04000AC2, 0x04000AC3, 0x04000AC4, 0x04000AC5, 0x04000AC6, 0x04000AC7,
+    0x04000AC8, 0x04000AC9, 0x04000ACA, 0x04000ABC, 0x04000ACC, 0x04000ACD, 0x04000ACE, 0x04000ACF,
+    0x00000ABC, 0x0000ABC1, 0x0000ABC2, 0x0000ABC3, 0x0000ABC4, 0x0000ABC5, 0x0000ABC6, 0x0000ABC7,
+    0x0000ABC8, 0x0000ABC9, 0x0000ABCA, 0x0000ABCB, 0x08000ABD, 0x0000ABCD, 0x0000ABCE, 0x0000ABCF,
+    0x00000ABD, 0x0000ABD1, 0x0000ABD2, 0x0000ABD3, 0x0000ABD4, 0x0000ABD5, 0x0000ABD6, 0x0000ABD7,
+    0x0000ABD8, 0x0000ABD9, 0x0000ABDA, 0x0000ABDB, 0x0000ABDC, 0x10000ABE, 0x0000ABDE, 0x0000ABDF,
+    0x00000ABE, 0x0000ABE1, 0x0000ABE2, 0x0000ABE3, 0x0000ABE4, 0x0000ABE5, 0x0000ABE6, 0x0000ABE7,
+    0x0000ABE8, 0x0000ABE9, 0x0000ABEA, 0x0000ABEB, 0x0000ABEC, 0x0000ABED, 0x20000ABF, 0x0000ABEF,
+    0x00000ABF, 0x0000ABF1, 0x0000ABF2, 0x0000ABF3, 0x0000ABF4, 0x0000ABF5, 0x0000ABF6, 0x0000ABF7,
+    0x0000ABF8, 0x0000ABF9, 0x0000ABFA, 0x0000ABFB, 0x0000ABFC, 0x0000ABFD, 0x0000ABFE, 0x0000ABFF,
+    0x000000AC, 0x00000AC1, 0x00000AC2, 0x00000AC3, 0x00000AC4, 0x00000AC5, 0x00000AC6, 0x00000AC7,
+    0x00000AC8, 0x00000AC9, 0x00000ACA, 0x00000ACB, 0x080000AD, 0x00000ACD, 0x00000ACE, 0x00000ACF,
+    0x00000AC1, 0x00010AC2, 0x0000AC12, 0x0000AC13, 0x0000AC14, 0x0000AC15, 0x0000AC16, 0x0000AC17,
+    0x0000AC18, 0x0000AC19, 0x0000AC1A, 0x0000AC1B, 0x0000AC1C, 0x0000AC1D, 0x0000AC1E, 0x0000AC1F,
+    0x00000AC2, 0x0000AC21, 0x00020AC3, 0x0000AC23, 0x0000AC24, 0x0000AC25, 0x0000AC26, 0x0000AC27,
+    0x0000AC28, 0x0000AC29, 0x0000AC2A, 0x0000AC2B, 0x0000AC2C, 0x0000AC2D, 0x0000AC2E, 0x0000AC2F,
+    0x00000AC3, 0x0000AC31, 0x0000AC32, 0x00040AC4, 0x0000AC34, 0x0000AC35, 0x0000AC36, 0x0000AC37,
+    0x0000AC38, 0x0000AC39, 0x0000AC3A, 0x0000AC3B, 0x0000AC3C, 0x0000AC3D, 0x0000AC3E, 0x0000AC3F,
+    0x00000AC4, 0x0000AC41, 0x0000AC42, 0x0000AC43, 0x00080AC5, 0x0000AC45, 0x0000AC46, 0x0000AC47,
+    0x0000AC48, 0x0000AC49, 0x0000AC4A, 0x0000AC4B, 0x0000AC4C, 0x0000AC4D, 0x0000AC4E, 0x0000AC4F,
+    0x00000AC5, 0x0000AC51, 0x0000AC52, 0x0000AC53, 0x0000AC54, 0x00100AC6, 0x0000AC56, 0x0000AC57,
+    0x0000AC58, 0x0000AC59, 0x0000AC5A, 0x0000AC5B, 0x0000AC5C, 0x0000AC5D, 0x0000AC5E, 0x0000AC5F,
+    0x00000AC6, 0x0000AC61, 0x0000AC62, 0x0000AC63, 0x0000AC64, 0x0000AC65, 0x00200AC7, 0x0000AC67,
+    0x0000AC68, 0x0000AC69, 0x0000AC6A, 0x0000AC6B, 0x0000AC6C, 0x0000AC6D, 0x0000AC6E, 0x0000AC6F,
+    0x00000AC7, 0x0000AC71, 0x0000AC72, 0x0000AC73, 0x0000AC74, 0x0000AC75, 0x0000AC76, 0x00400AC8,
+    0x0000AC78, 0x0000AC79, 0x0000AC7A, 0x0000AC7B, 0x0000AC7C, 0x0000AC7D, 0x0000AC7E, 0x0000AC7F,
+    0x00000AC8, 0x0000AC81, 0x0000AC82, 0x0000AC83, 0x0000AC84, 0x0000AC85, 0x0000AC86, 0x0000AC87,
+    0x00800AC9, 0x0000AC89, 0x0000AC8A, 0x0000AC8B, 0x0000AC8C, 0x0000AC8D, 0x0000AC8E, 0x0000AC8F,
+    0x00000AC9, 0x0000AC91, 0x0000AC92, 0x0000AC93, 0x0000AC94, 0x0000AC95, 0x0000AC96, 0x0000AC97,
+    0x0000AC98, 0x01000ACA, 0x0000AC9A, 0x0000AC9B, 0x0000AC9C, 0x0000AC9D, 0x0000AC9E, 0x0000AC9F,
+    0x00000ACA, 0x0000ACA1, 0x0000ACA2, 0x0000ACA3, 0x0000ACA4, 0x0000ACA5, 0x0000ACA6, 0x0000ACA7,
+    0x0000ACA8, 0x0000ACA9, 0x82000ACB, 0x0000ACAB, 0x0000ACAC, 0x0000ACAD, 0x0000ACAE, 0x0000ACAF,
+    0x00000ACB, 0x0000ACB1, 0x0000ACB2, 0x0000ACB3, 0x0000ACB4, 0x0000ACB5, 0x0000ACB6, 0x0000ACB7,
+    0x0000ACB8, 0x0000ACB9, 0x0000ACBA, 0x04000ACC, 0x0000ACBC, 0x0000ACBD, 0x0000ACBE, 0x0000ACBF,
+    0x080000AD, 0x08000AD1, 0x08000AD2, 0x08000AD3, 0x08000AD4, 0x08000AD5, 0x08000AD6, 0x08000AD7,
+    0x08000AD8, 0x08000AD9, 0x08000ADA, 0x08000ADB, 0x08000ACD, 0x08000ADD, 0x08000ADE, 0x08000ADF,
+    0x00000ACD, 0x0000ACD1, 0x0000ACD2, 0x0000ACD3, 0x0000ACD4, 0x0000ACD5, 0x0000ACD6, 0x0000ACD7,
+    0x0000ACD8, 0x0000ACD9, 0x0000ACDA, 0x0000ACDB, 0x0000ACDC, 0x10000ACE, 0x0000ACDE, 0x0000ACDF,
+    0x00000ACE, 0x0000ACE1, 0x0000ACE2, 0x0000ACE3, 0x0000ACE4, 0x0000ACE5, 0x0000ACE6, 0x0000ACE7,
+    0x0000ACE8, 0x0000ACE9, 0x0000ACEA, 0x0000ACEB, 0x0000ACEC, 0x0000ACED, 0x20000ACF, 0x0000ACEF,
+    0x00000ACF, 0x0000ACF1, 0x0000ACF2, 0x0000ACF3, 0x0000ACF4, 0x0000ACF5, 0x0000ACF6, 0x0000ACF7,
+    0x0000ACF8, 0x0000ACF9, 0x0000ACFA, 0x0000ACFB, 0x0000ACFC, 0x0000ACFD, 0x0000ACFE, 0x0000ACFF,
+    0x000000AD, 0x00000AD1, 0x00000AD2, 0x00000AD3, 0x00000AD4, 0x00000AD5, 0x00000AD6, 0x00000AD7,
+    0x00000AD8, 0x00000AD9, 0x00000ADA, 0x00000ADB, 0x00000ADC, 0x100000AE, 0x00000ADE, 0x00000ADF,
+    0x00000AD1, 0x00010AD2, 0x0000AD12, 0x0000AD13, 0x0000AD14, 0x0000AD15, 0x0000AD16, 0x0000AD17,
+    0x0000AD18, 0x0000AD19, 0x0000AD1A, 0x0000AD1B, 0x0000AD1C, 0x0000AD1D, 0x0000AD1E, 0x0000AD1F,
+    0x00000AD2, 0x0000AD21, 0x00020AD3, 0x0000AD23, 0x0000AD24, 0x0000AD25, 0x0000AD26, 0x0000AD27,
+    0x0000AD28, 0x0000AD29, 0x0000AD2A, 0x0000AD2B, 0x0000AD2C, 0x0000AD2D, 0x0000AD2E, 0x0000AD2F,
+    0x00000AD3, 0x0000AD31, 0x0000AD32, 0x00040AD4, 0x0000AD34, 0x0000AD35, 0x0000AD36, 0x0000AD37,
+    0x0000AD38, 0x0000AD39, 0x0000AD3A, 0x0000AD3B, 0x0000AD3C, 0x0000AD3D, 0x0000AD3E, 0x0000AD3F,
+    0x00000AD4, 0x0000AD41, 0x0000AD42, 0x0000AD43, 0x00080AD5, 0x0000AD45, 0x0000AD46, 0x0000AD47,
+    0x0000AD48, 0x0000AD49, 0x0000AD4A, 0x0000AD4B, 0x0000AD4C, 0x0000AD4D, 0x0000AD4E, 0x0000AD4F,
+    0x00000AD5, 0x0000AD51, 0x0000AD52, 0x0000AD53, 0x0000AD54, 0x00100AD6, 0x0000AD56, 0x0000AD57,
+    0x0000AD58, 0x0000AD59, 0x0000AD5A, 0x0000AD5B, 0x0000AD5C, 0x0000AD5D, 0x0000AD5E, 0x0000AD5F,
+    0x00000AD6, 0x0000AD61, 0x0000AD62, 0x0000AD63, 0x0000AD64, 0x0000AD65, 0x00200AD7, 0x0000AD67,
+    0x0000AD68, 0x0000AD69, 0x0000AD6A, 0x0000AD6B, 0x0000AD6C, 0x0000AD6D, 0x0000AD6E, 0x0000AD6F,
+    0x00000AD7, 0x0000AD71, 0x0000AD72, 0x0000AD73, 0x0000AD74, 0x0000AD75, 0x0000AD76, 0x00400AD8,
+    0x0000AD78, 0x0000AD79, 0x0000AD7A, 0x0000AD7B, 0x0000AD7C, 0x0000AD7D, 0x0000AD7E, 0x0000AD7F,
+    0x00000AD8, 0x0000AD81, 0x0000AD82, 0x0000AD83, 0x0000AD84, 0x0000AD85, 0x0000AD86, 0x0000AD87,
+    0x00800AD9, 0x0000AD89, 0x0000AD8A, 0x0000AD8B, 0x0000AD8C, 0x0000AD8D, 0x0000AD8E, 0x0000AD8F,
+    0x00000AD9, 0x0000AD91, 0x0000AD92, 0x0000AD93, 0x0000AD94, 0x0000AD95, 0x0000AD96, 0x0000AD97,
+    0x0000AD98, 0x01000ADA, 0x0000AD9A, 0x0000AD9B, 0x0000AD9C, 0x0000AD9D, 0x0000AD9E, 0x0000AD9F,
+    0x00000ADA, 0x0000ADA1, 0x0000ADA2, 0x0000ADA3, 0x0000ADA4, 0x0000ADA5, 0x0000ADA6, 0x0000ADA7,
+    0x0000ADA8, 0x0000ADA9, 0x82000ADB, 0x0000ADAB, 0x0000ADAC, 0x0000ADAD, 0x0000ADAE, 0x0000ADAF,
+    0x00000ADB, 0x0000ADB1, 0x0000ADB2, 0x0000ADB3, 0x0000ADB4, 0x0000ADB5, 0x0000ADB6, 0x0000ADB7,
+    0x0000ADB8, 0x0000ADB9, 0x0000ADBA, 0x04000ADC, 0x0000ADBC, 0x0000ADBD, 0x0000ADBE, 0x0000ADBF,
+    0x00000ADC, 0x0000ADC1, 0x0000ADC2, 0x0000ADC3, 0x0000ADC4, 0x0000ADC5, 0x0000ADC6, 0x0000ADC7,
+    0x0000ADC8, 0x0000ADC9, 0x0000ADCA, 0x0000ADCB, 0x08000ADD, 0x0000ADCD, 0x0000ADCE, 0x0000ADCF,
+    0x100000AE, 0x10000AE1, 0x10000AE2, 0x10000AE3, 0x10000AE4, 0x10000AE5, 0x10000AE6, 0x10000AE7,
+    0x10000AE8, 0x10000AE9, 0x10000AEA, 0x10000AEB, 0x10000AEC, 0x10000ADE, 0x10000AEE, 0x10000AEF,
+    0x00000ADE, 0x0000ADE1, 0x0000ADE2, 0x0000ADE3, 0x0000ADE4, 0x0000ADE5, 0x0000ADE6, 0x0000ADE7,
+    0x0000ADE8, 0x0000ADE9, 0x0000ADEA, 0x0000ADEB, 0x0000ADEC, 0x0000ADED, 0x20000ADF, 0x0000ADEF,
+    0x00000ADF, 0x0000ADF1, 0x0000ADF2, 0x0000ADF3, 0x0000ADF4, 0x0000ADF5, 0x0000ADF6, 0x0000ADF7,
+    0x0000ADF8, 0x0000ADF9, 0x0000ADFA, 0x0000ADFB, 0x0000ADFC, 0x0000ADFD, 0x0000ADFE, 0x0000ADFF,
+    0x000000AE, 0x00000AE1, 0x00000AE2, 0x00000AE3, 0x00000AE4, 0x00000AE5, 0x00000AE6, 0x00000AE7,
+    0x00000AE8, 0x00000AE9, 0x00000AEA, 0x00000AEB, 0x00000AEC, 0x00000AED, 0x200000AF, 0x00000AEF,
+    0x00000AE1, 0x00010AE2, 0x0000AE12, 0x0000AE13, 0x0000AE14, 0x0000AE15, 0x0000AE16, 0x0000AE17,
+    0x0000AE18, 0x0000AE19, 0x0000AE1A, 0x0000AE1B, 0x0000AE1C, 0x0000AE1D, 0x0000AE1E, 0x0000AE1F,
+    0x00000AE2, 0x0000AE21, 0x00020AE3, 0x0000AE23, 0x0000AE24, 0x0000AE25, 0x0000AE26, 0x0000AE27,
+    0x0000AE28, 0x0000AE29, 0x0000AE2A, 0x0000AE2B, 0x0000AE2C, 0x0000AE2D, 0x0000AE2E, 0x0000AE2F,
+    0x00000AE3, 0x0000AE31, 0x0000AE32, 0x00040AE4, 0x0000AE34, 0x0000AE35, 0x0000AE36, 0x0000AE37,
+    0x0000AE38, 0x0000AE39, 0x0000AE3A, 0x0000AE3B, 0x0000AE3C, 0x0000AE3D, 0x0000AE3E, 0x0000AE3F,
+    0x00000AE4, 0x0000AE41, 0x0000AE42, 0x0000AE43, 0x00080AE5, 0x0000AE45, 0x0000AE46, 0x0000AE47,
+    0x0000AE48, 0x0000AE49, 0x0000AE4A, 0x0000AE4B, 0x0000AE4C, 0x0000AE4D, 0x0000AE4E, 0x0000AE4F,
+    0x00000AE5, 0x0000AE51, 0x0000AE52, 0x0000AE53, 0x0000AE54, 0x00100AE6, 0x0000AE56, 0x0000AE57,
+    0x0000AE58, 0x0000AE59, 0x0000AE5A, 0x0000AE5B, 0x0000AE5C, 0x0000AE5D, 0x0000AE5E, 0x0000AE5F,
+    0x00000AE6, 0x0000AE61, 0x0000AE62, 0x0000AE63, 0x0000AE64, 0x0000AE65, 0x00200AE7, 0x0000AE67,
+    0x0000AE68, 0x0000AE69, 0x0000AE6A, 0x0000AE6B, 0x0000AE6C, 0x0000AE6D, 0x0000AE6E, 0x0000AE6F,
+    0x00000AE7, 0x0000AE71, 0x0000AE72, 0x0000AE73, 0x0000AE74, 0x0000AE75, 0x0000AE76, 0x00400AE8,
+    0x0000AE78, 0x0000AE79, 0x0000AE7A, 0x0000AE7B, 0x0000AE7C, 0x0000AE7D, 0x0000AE7E, 0x0000AE7F,
+    0x00000AE8, 0x0000AE81, 0x0000AE82, 0x0000AE83, 0x0000AE84, 0x0000AE85, 0x0000AE86, 0x0000AE87,
+    0x00800AE9, 0x0000AE89, 0x0000AE8A, 0x0000AE8B, 0x0000AE8C, 0x0000AE8D, 0x0000AE8E, 0x0000AE8F,
+    0x00000AE9, 0x0000AE91, 0x0000AE92, 0x0000AE93, 0x0000AE94, 0x0000AE95, 0x0000AE96, 0x0000AE97,
+    0x0000AE98, 0x01000AEA, 0x0000AE9A, 0x0000AE9B, 0x0000AE9C, 0x0000AE9D, 0x0000AE9E, 0x0000AE9F,
+    0x00000AEA, 0x0000AEA1, 0x0000AEA2, 0x0000AEA3, 0x0000AEA4, 0x0000AEA5, 0x0000AEA6, 0x0000AEA7,
+    0x0000AEA8, 0x0000AEA9, 0x82000AEB, 0x0000AEAB, 0x0000AEAC, 0x0000AEAD, 0x0000AEAE, 0x0000AEAF,
+    0x00000AEB, 0x0000AEB1, 0x0000AEB2, 0x0000AEB3, 0x0000AEB4, 0x0000AEB5, 0x0000AEB6, 0x0000AEB7,
+    0x0000AEB8, 0x0000AEB9, 0x0000AEBA, 0x04000AEC, 0x0000AEBC, 0x0000AEBD, 0x0000AEBE, 0x0000AEBF,
+    0x00000AEC, 0x0000AEC1, 0x0000AEC2, 0x0000AEC3, 0x0000AEC4, 0x0000AEC5, 0x0000AEC6, 0x0000AEC7,
+    0x0000AEC8, 0x0000AEC9, 0x0000AECA, 0x0000AECB, 0x08000AED, 0x0000AECD, 0x0000AECE, 0x0000AECF,
+    0x00000AED, 0x0000AED1, 0x0000AED2, 0x0000AED3, 0x0000AED4, 0x0000AED5, 0x0000AED6, 0x0000AED7,
+    0x0000AED8, 0x0000AED9, 0x0000AEDA, 0x0000AEDB, 0x0000AEDC, 0x10000AEE, 0x0000AEDE, 0x0000AEDF,
+    0x200000AF, 0x20000AF1, 0x20000AF2, 0x20000AF3, 0x20000AF4, 0x20000AF5, 0x20000AF6, 0x20000AF7,
+    0x20000AF8, 0x20000AF9, 0x20000AFA, 0x20000AFB, 0x20000AFC, 0x20000AFD, 0x20000AEF, 0x20000AFF,
+    0x00000AEF, 0x0000AEF1, 0x0000AEF2, 0x0000AEF3, 0x0000AEF4, 0x0000AEF5, 0x0000AEF6, 0x0000AEF7,
+    0x0000AEF8, 0x0000AEF9, 0x0000AEFA, 0x0000AEFB, 0x0000AEFC, 0x0000AEFD, 0x0000AEFE, 0x0000AEFF,
+    0x000000AF, 0x00000AF1, 0x00000AF2, 0x00000AF3, 0x00000AF4, 0x00000AF5, 0x00000AF6, 0x00000AF7,
+    0x00000AF8, 0x00000AF9, 0x00000AFA, 0x00000AFB, 0x00000AFC, 0x00000AFD, 0x00000AFE, 0x00000AFF,
+    0x00000AF1, 0x00010AF2, 0x0000AF12, 0x0000AF13, 0x0000AF14, 0x0000AF15, 0x0000AF16, 0x0000AF17,
+    0x0000AF18, 0x0000AF19, 0x0000AF1A, 0x0000AF1B, 0x0000AF1C, 0x0000AF1D, 0x0000AF1E, 0x0000AF1F,
+    0x00000AF2, 0x0000AF21, 0x00020AF3, 0x0000AF23, 0x0000AF24, 0x0000AF25, 0x0000AF26, 0x0000AF27,
+    0x0000AF28, 0x0000AF29, 0x0000AF2A, 0x0000AF2B, 0x0000AF2C, 0x0000AF2D, 0x0000AF2E, 0x0000AF2F,
+    0x00000AF3, 0x0000AF31, 0x0000AF32, 0x00040AF4, 0x0000AF34, 0x0000AF35, 0x0000AF36, 0x0000AF37,
+    0x0000AF38, 0x0000AF39, 0x0000AF3A, 0x0000AF3B, 0x0000AF3C, 0x0000AF3D, 0x0000AF3E, 0x0000AF3F,
+    0x00000AF4, 0x0000AF41, 0x0000AF42, 0x0000AF43, 0x00080AF5, 0x0000AF45, 0x0000AF46, 0x0000AF47,
+    0x0000AF48, 0x0000AF49, 0x0000AF4A, 0x0000AF4B, 0x0000AF4C, 0x0000AF4D, 0x0000AF4E, 0x0000AF4F,
+    0x00000AF5, 0x0000AF51, 0x0000AF52, 0x0000AF53, 0x0000AF54, 0x00100AF6, 0x0000AF56, 0x0000AF57,
+    0x0000AF58, 0x0000AF59, 0x0000AF5A, 0x0000AF5B, 0x0000AF5C, 0x0000AF5D, 0x0000AF5E, 0x0000AF5F,
+    0x00000AF6, 0x0000AF61, 0x0000AF62, 0x0000AF63, 0x0000AF64, 0x0000AF65, 0x00200AF7, 0x0000AF67,
+    0x0000AF68, 0x0000AF69, 0x0000AF6A, 0x0000AF6B, 0x0000AF6C, 0x0000AF6D, 0x0000AF6E, 0x0000AF6F,
+    0x00000AF7, 0x0000AF71, 0x0000AF72, 0x0000AF73, 0x0000AF74, 0x0000AF75, 0x0000AF76, 0x00400AF8,
+    0x0000AF78, 0x0000AF79, 0x0000AF7A, 0x0000AF7B, 0x0000AF7C, 0x0000AF7D, 0x0000AF7E, 0x0000AF7F,
+    0x00000AF8, 0x0000AF81, 0x0000AF82, 0x0000AF83, 0x0000AF84, 0x0000AF85, 0x0000AF86, 0x0000AF87,
+    0x00800AF9, 0x0000AF89, 0x0000AF8A, 0x0000AF8B, 0x0000AF8C, 0x0000AF8D, 0x0000AF8E, 0x0000AF8F,
+    0x00000AF9, 0x0000AF91, 0x0000AF92, 0x0000AF93, 0x0000AF94, 0x0000AF95, 0x0000AF96, 0x0000AF97,
+    0x0000AF98, 0x01000AFA, 0x0000AF9A, 0x0000AF9B, 0x0000AF9C, 0x0000AF9D, 0x0000AF9E, 0x0000AF9F,
+    0x00000AFA, 0x0000AFA1, 0x0000AFA2, 0x0000AFA3, 0x0000AFA4, 0x0000AFA5, 0x0000AFA6, 0x0000AFA7,
+    0x0000AFA8, 0x0000AFA9, 0x82000AFB, 0x0000AFAB, 0x0000AFAC, 0x0000AFAD, 0x0000AFAE, 0x0000AFAF,
+    0x00000AFB, 0x0000AFB1, 0x0000AFB2, 0x0000AFB3, 0x0000AFB4, 0x0000AFB5, 0x0000AFB6, 0x0000AFB7,
+    0x0000AFB8, 0x0000AFB9, 0x0000AFBA, 0x04000AFC, 0x0000AFBC, 0x0000AFBD, 0x0000AFBE, 0x0000AFBF,
+    0x00000AFC, 0x0000AFC1, 0x0000AFC2, 0x0000AFC3, 0x0000AFC4, 0x0000AFC5, 0x0000AFC6, 0x0000AFC7,
+    0x0000AFC8, 0x0000AFC9, 0x0000AFCA, 0x0000AFCB, 0x08000AFD, 0x0000AFCD, 0x0000AFCE, 0x0000AFCF,
+    0x00000AFD, 0x0000AFD1, 0x0000AFD2, 0x0000AFD3, 0x0000AFD4, 0x0000AFD5, 0x0000AFD6, 0x0000AFD7,
+    0x0000AFD8, 0x0000AFD9, 0x0000AFDA, 0x0000AFDB, 0x0000AFDC, 0x10000AFE, 0x0000AFDE, 0x0000AFDF,
+    0x00000AFE, 0x0000AFE1, 0x0000AFE2, 0x0000AFE3, 0x0000AFE4, 0x0000AFE5, 0x0000AFE6, 0x0000AFE7,
+    0x0000AFE8, 0x0000AFE9, 0x0000AFEA, 0x0000AFEB, 0x0000AFEC, 0x0000AFED, 0x20000AFF, 0x0000AFEF,
+    0x00000AFF, 0x0000AFF1, 0x0000AFF2, 0x0000AFF3, 0x0000AFF4, 0x0000AFF5, 0x0000AFF6, 0x0000AFF7,
+    0x0000AFF8, 0x0000AFF9, 0x0000AFFA, 0x0000AFFB, 0x0000AFFC, 0x0000AFFD, 0x0000AFFE, 0x0000AFFF,
+    0x0000000B, 0x000000B1, 0x000000B2, 0x000000B3, 0x000000B4, 0x000000B5, 0x000000B6, 0x000000B7,
+    0x000000B8, 0x000000B9, 0x000000BA, 0x0400000C, 0x000000BC, 0x000000BD, 0x000000BE, 0x000000BF,
+    0x000000B1, 0x000100B2, 0x00000B12, 0x00000B13, 0x00000B14, 0x00000B15, 0x00000B16, 0x00000B17,
+    0x00000B18, 0x00000B19, 0x00000B1A, 0x00000B1B, 0x00000B1C, 0x00000B1D, 0x00000B1E, 0x00000B1F,
+    0x000000B2, 0x00000B21, 0x000200B3, 0x00000B23, 0x00000B24, 0x00000B25, 0x00000B26, 0x00000B27,
+    0x00000B28, 0x00000B29, 0x00000B2A, 0x00000B2B, 0x00000B2C, 0x00000B2D, 0x00000B2E, 0x00000B2F,
+    0x000000B3, 0x00000B31, 0x00000B32, 0x000400B4, 0x00000B34, 0x00000B35, 0x00000B36, 0x00000B37,
+    0x00000B38, 0x00000B39, 0x00000B3A, 0x00000B3B, 0x00000B3C, 0x00000B3D, 0x00000B3E, 0x00000B3F,
+    0x000000B4, 0x00000B41, 0x00000B42, 0x00000B43, 0x000800B5, 0x00000B45, 0x00000B46, 0x00000B47,
+    0x00000B48, 0x00000B49, 0x00000B4A, 0x00000B4B, 0x00000B4C, 0x00000B4D, 0x00000B4E, 0x00000B4F,
+    0x000000B5, 0x00000B51, 0x00000B52, 0x00000B53, 0x00000B54, 0x001000B6, 0x00000B56, 0x00000B57,
+    0x00000B58, 0x00000B59, 0x00000B5A, 0x00000B5B, 0x00000B5C, 0x00000B5D, 0x00000B5E, 0x00000B5F,
+    0x000000B6, 0x00000B61, 0x00000B62, 0x00000B63, 0x00000B64, 0x00000B65, 0x002000B7, 0x00000B67,
+    0x00000B68, 0x00000B69, 0x00000B6A, 0x00000B6B, 0x00000B6C, 0x00000B6D, 0x00000B6E, 0x00000B6F,
+    0x000000B7, 0x00000B71, 0x00000B72, 0x00000B73, 0x00000B74, 0x00000B75, 0x00000B76, 0x004000B8,
+    0x00000B78, 0x00000B79, 0x00000B7A, 0x00000B7B, 0x00000B7C, 0x00000B7D, 0x00000B7E, 0x00000B7F,
+    0x000000B8, 0x00000B81, 0x00000B82, 0x00000B83, 0x00000B84, 0x00000B85, 0x00000B86, 0x00000B87,
+    0x008000B9, 0x00000B89, 0x00000B8A, 0x00000B8B, 0x00000B8C, 0x00000B8D, 0x00000B8E, 0x00000B8F,
+    0x000000B9, 0x00000B91, 0x00000B92, 0x00000B93, 0x00000B94, 0x00000B95, 0x00000B96, 0x00000B97,
+    0x00000B98, 0x010000BA, 0x00000B9A, 0x00000B9B, 0x00000B9C, 0x00000B9D, 0x00000B9E, 0x00000B9F,
+    0x000000BA, 0x00000BA1, 0x00000BA2, 0x00000BA3, 0x00000BA4, 0x00000BA5, 0x00000BA6, 0x00000BA7,
+    0x00000BA8, 0x00000BA9, 0x820000BB, 0x00000BAB, 0x00000BAC, 0x00000BAD, 0x00000BAE, 0x00000BAF,
+    0x0400000C, 0x040000C1, 0x040000C2, 0x040000C3, 0x040000C4, 0x040000C5, 0x040000C6, 0x040000C7,
+    0x040000C8, 0x040000C9, 0x040000CA, 0x040000BC, 0x040000CC, 0x040000CD, 0x040000CE, 0x040000CF,
+    0x000000BC, 0x00000BC1, 0x00000BC2, 0x00000BC3, 0x00000BC4, 0x00000BC5, 0x00000BC6, 0x00000BC7,
+    0x00000BC8, 0x00000BC9, 0x00000BCA, 0x00000BCB, 0x080000BD, 0x00000BCD, 0x00000BCE, 0x00000BCF,
+    0x000000BD, 0x00000BD1, 0x00000BD2, 0x00000BD3, 0x00000BD4, 0x00000BD5, 0x00000BD6, 0x00000BD7,
+    0x00000BD8, 0x00000BD9, 0x00000BDA, 0x00000BDB, 0x00000BDC, 0x100000BE, 0x00000BDE, 0x00000BDF,
+    0x000000BE, 0x00000BE1, 0x00000BE2, 0x00000BE3, 0x00000BE4, 0x00000BE5, 0x00000BE6, 0x00000BE7,
+    0x00000BE8, 0x00000BE9, 0x00000BEA, 0x00000BEB, 0x00000BEC, 0x00000BED, 0x200000BF, 0x00000BEF,
+    0x000000BF, 0x00000BF1, 0x00000BF2, 0x00000BF3, 0x00000BF4, 0x00000BF5, 0x00000BF6, 0x00000BF7,
+    0x00000BF8, 0x00000BF9, 0x00000BFA, 0x00000BFB, 0x00000BFC, 0x00000BFD, 0x00000BFE, 0x00000BFF,
+    0x000000B1, 0x000100B2, 0x00000B12, 0x00000B13, 0x00000B14, 0x00000B15, 0x00000B16, 0x00000B17,
+    0x00000B18, 0x00000B19, 0x00000B1A, 0x00000B1B, 0x00000B1C, 0x00000B1D, 0x00000B1E, 0x00000B1F,
+    0x000100B2, 0x00010B12, 0x00010B22, 0x00010B23, 0x00010B24, 0x00010B25, 0x00010B26, 0x00010B27,
+    0x00010B28, 0x00010B29, 0x00010B2A, 0x00010B2B, 0x00010B2C, 0x00010B2D, 0x00010B2E, 0x00010B2F,
+    0x00000B12, 0x0000B121, 0x00020B13, 0x0000B123, 0x0000B124, 0x0000B125, 0x0000B126, 0x0000B127,
+    0x0000B128, 0x0000B129, 0x0000B12A, 0x0000B12B, 0x0000B12C, 0x0000B12D, 0x0000B12E, 0x0000B12F,
+    0x00000B13, 0x0000B131, 0x0000B132, 0x00040B14, 0x0000B134, 0x0000B135, 0x0000B136, 0x0000B137,
+    0x0000B138, 0x0000B139, 0x0000B13A, 0x0000B13B, 0x0000B13C, 0x0000B13D, 0x0000B13E, 0x0000B13F,
+    0x00000B14, 0x0000B141, 0x0000B142, 0x0000B143, 0x00080B15, 0x0000B145, 0x0000B146, 0x0000B147,
+    0x0000B148, 0x0000B149, 0x0000B14A, 0x0000B14B, 0x0000B14C, 0x0000B14D, 0x0000B14E, 0x0000B14F,
+    0x00000B15, 0x0000B151, 0x0000B152, 0x0000B153, 0x0000B154, 0x00100B16, 0x0000B156, 0x0000B157,
+    0x0000B158, 0x0000B159, 0x0000B15A, 0x0000B15B, 0x0000B15C, 0x0000B15D, 0x0000B15E, 0x0000B15F,
+    0x00000B16, 0x0000B161, 0x0000B162, 0x0000B163, 0x0000B164, 0x0000B165, 0x00200B17, 0x0000B167,
+    0x0000B168, 0x0000B169, 0x0000B16A, 0x0000B16B, 0x0000B16C, 0x0000B16D, 0x0000B16E, 0x0000B16F,
+    0x00000B17, 0x0000B171, 0x0000B172, 0x0000B173, 0x0000B174, 0x0000B175, 0x0000B176, 0x00400B18,
+    0x0000B178, 0x0000B179, 0x0000B17A, 0x0000B17B, 0x0000B17C, 0x0000B17D, 0x0000B17E, 0x0000B17F,
+    0x00000B18, 0x0000B181, 0x0000B182, 0x0000B183, 0x0000B184, 0x0000B185, 0x0000B186, 0x0000B187,
+    0x00800B19, 0x0000B189, 0x0000B18A, 0x0000B18B, 0x0000B18C, 0x0000B18D, 0x0000B18E, 0x0000B18F,
+    0x00000B19, 0x0000B191, 0x0000B192, 0x0000B193, 0x0000B194, 0x0000B195, 0x0000B196, 0x0000B197,
+    0x0000B198, 0x01000B1A, 0x0000B19A, 0x0000B19B, 0x0000B19C, 0x0000B19D, 0x0000B19E, 0x0000B19F,
+    0x00000B1A, 0x0000B1A1, 0x0000B1A2, 0x0000B1A3, 0x0000B1A4, 0x0000B1A5, 0x0000B1A6, 0x0000B1A7,
+    0x0000B1A8, 0x0000B1A9, 0x82000B1B, 0x0000B1AB, 0x0000B1AC, 0x0000B1AD, 0x0000B1AE, 0x0000B1AF,
+    0x00000B1B, 0x0000B1B1, 0x0000B1B2, 0x0000B1B3, 0x0000B1B4, 0x0000B1B5, 0x0000B1B6, 0x0000B1B7,
+    0x0000B1B8, 0x0000B1B9, 0x0000B1BA, 0x04000B1C, 0x0000B1BC, 0x0000B1BD, 0x0000B1BE, 0x0000B1BF,
+    0x00000B1C, 0x0000B1C1, 0x0000B1C2, 0x0000B1C3, 0x0000B1C4, 0x0000B1C5, 0x0000B1C6, 0x0000B1C7,
+    0x0000B1C8, 0x0000B1C9, 0x0000B1CA, 0x0000B1CB, 0x08000B1D, 0x0000B1CD, 0x0000B1CE, 0x0000B1CF,
+    0x00000B1D, 0x0000B1D1, 0x0000B1D2, 0x0000B1D3, 0x0000B1D4, 0x0000B1D5, 0x0000B1D6, 0x0000B1D7,
+    0x0000B1D8, 0x0000B1D9, 0x0000B1DA, 0x0000B1DB, 0x0000B1DC, 0x10000B1E, 0x0000B1DE, 0x0000B1DF,
+    0x00000B1E, 0x0000B1E1, 0x0000B1E2, 0x0000B1E3, 0x0000B1E4, 0x0000B1E5, 0x0000B1E6, 0x0000B1E7,
+    0x0000B1E8, 0x0000B1E9, 0x0000B1EA, 0x0000B1EB, 0x0000B1EC, 0x0000B1ED, 0x20000B1F, 0x0000B1EF,
+    0x00000B1F, 0x0000B1F1, 0x0000B1F2, 0x0000B1F3, 0x0000B1F4, 0x0000B1F5, 0x0000B1F6, 0x0000B1F7,
+    0x0000B1F8, 0x0000B1F9, 0x0000B1FA, 0x0000B1FB, 0x0000B1FC, 0x0000B1FD, 0x0000B1FE, 0x0000B1FF,
+    0x000000B2, 0x00000B21, 0x000200B3, 0x00000B23, 0x00000B24, 0x00000B25, 0x00000B26, 0x00000B27,
+    0x00000B28, 0x00000B29, 0x00000B2A, 0x00000B2B, 0x00000B2C, 0x00000B2D, 0x00000B2E, 0x00000B2F,
+    0x00000B21, 0x00010B22, 0x0000B212, 0x0000B213, 0x0000B214, 0x0000B215, 0x0000B216, 0x0000B217,
+    0x0000B218, 0x0000B219, 0x0000B21A, 0x0000B21B, 0x0000B21C, 0x0000B21D, 0x0000B21E, 0x0000B21F,
+    0x000200B3, 0x00020B31, 0x00020B23, 0x00020B33, 0x00020B34, 0x00020B35, 0x00020B36, 0x00020B37,
+    0x00020B38, 0x00020B39, 0x00020B3A, 0x00020B3B, 0x00020B3C, 0x00020B3D, 0x00020B3E, 0x00020B3F,
+    0x00000B23, 0x0000B231, 0x0000B232, 0x00040B24, 0x0000B234, 0x0000B235, 0x0000B236, 0x0000B237,
+    0x0000B238, 0x0000B239, 0x0000B23A, 0x0000B23B, 0x0000B23C, 0x0000B23D, 0x0000B23E, 0x0000B23F,
+    0x00000B24, 0x0000B241, 0x0000B242, 0x0000B243, 0x00080B25, 0x0000B245, 0x0000B246, 0x0000B247,
+    0x0000B248, 0x0000B249, 0x0000B24A, 0x0000B24B, 0x0000B24C, 0x0000B24D, 0x0000B24E, 0x0000B24F,
+    0x00000B25, 0x0000B251, 0x0000B252, 0x0000B253, 0x0000B254, 0x00100B26, 0x0000B256, 0x0000B257,
+    0x0000B258, 0x0000B259, 0x0000B25A, 0x0000B25B, 0x0000B25C, 0x0000B25D, 0x0000B25E, 0x0000B25F,
+    0x00000B26, 0x0000B261, 0x0000B262, 0x0000B263, 0x0000B264, 0x0000B265, 0x00200B27, 0x0000B267,
+    0x0000B268, 0x0000B269, 0x0000B26A, 0x0000B26B, 0x0000B26C, 0x0000B26D, 0x0000B26E, 0x0000B26F,
+    0x00000B27, 0x0000B271, 0x0000B272, 0x0000B273, 0x0000B274, 0x0000B275, 0x0000B276, 0x00400B28,
+    0x0000B278, 0x0000B279, 0x0000B27A, 0x0000B27B, 0x0000B27C, 0x0000B27D, 0x0000B27E, 0x0000B27F,
+    0x00000B28, 0x0000B281, 0x0000B282, 0x0000B283, 0x0000B284, 0x0000B285, 0x0000B286, 0x0000B287,
+    0x00800B29, 0x0000B289, 0x0000B28A, 0x0000B28B, 0x0000B28C, 0x0000B28D, 0x0000B28E, 0x0000B28F,
+    0x00000B29, 0x0000B291, 0x0000B292, 0x0000B293, 0x0000B294, 0x0000B295, 0x0000B296, 0x0000B297,
+    0x0000B298, 0x01000B2A, 0x0000B29A, 0x0000B29B, 0x0000B29C, 0x0000B29D, 0x0000B29E, 0x0000B29F,
+    0x00000B2A, 0x0000B2A1, 0x0000B2A2, 0x0000B2A3, 0x0000B2A4, 0x0000B2A5, 0x0000B2A6, 0x0000B2A7,
+    0x0000B2A8, 0x0000B2A9, 0x82000B2B, 0x0000B2AB, 0x0000B2AC, 0x0000B2AD, 0x0000B2AE, 0x0000B2AF,
+    0x00000B2B, 0x0000B2B1, 0x0000B2B2, 0x0000B2B3, 0x0000B2B4, 0x0000B2B5, 0x0000B2B6, 0x0000B2B7,
+    0x0000B2B8, 0x0000B2B9, 0x0000B2BA, 0x04000B2C, 0x0000B2BC, 0x0000B2BD, 0x0000B2BE, 0x0000B2BF,
+    0x00000B2C, 0x0000B2C1, 0x0000B2C2, 0x0000B2C3, 0x0000B2C4, 0x0000B2C5, 0x0000B2C6, 0x0000B2C7,
+    0x0000B2C8, 0x0000B2C9, 0x0000B2CA, 0x0000B2CB, 0x08000B2D, 0x0000B2CD, 0x0000B2CE, 0x0000B2CF,
+    0x00000B2D, 0x0000B2D1, 0x0000B2D2, 0x0000B2D3, 0x0000B2D4, 0x0000B2D5, 0x0000B2D6, 0x0000B2D7,
+    0x0000B2D8, 0x0000B2D9, 0x0000B2DA, 0x0000B2DB, 0x0000B2DC, 0x10000B2E, 0x0000B2DE, 0x0000B2DF,
+    0x00000B2E, 0x0000B2E1, 0x0000B2E2, 0x0000B2E3, 0x0000B2E4, 0x0000B2E5, 0x0000B2E6, 0x0000B2E7,
+    0x0000B2E8, 0x0000B2E9, 0x0000B2EA, 0x0000B2EB, 0x0000B2EC, 0x0000B2ED, 0x20000B2F, 0x0000B2EF,
+    0x00000B2F, 0x0000B2F1, 0x0000B2F2, 0x0000B2F3, 0x0000B2F4, 0x0000B2F5, 0x0000B2F6, 0x0000B2F7,
+    0x0000B2F8, 0x0000B2F9, 0x0000B2FA, 0x0000B2FB, 0x0000B2FC, 0x0000B2FD, 0x0000B2FE, 0x0000B2FF,
+    0x000000B3, 0x00000B31, 0x00000B32, 0x000400B4, 0x00000B34, 0x00000B35, 0x00000B36, 0x00000B37,
+    0x00000B38, 0x00000B39, 0x00000B3A, 0x00000B3B, 0x00000B3C, 0x00000B3D, 0x00000B3E, 0x00000B3F,
+    0x00000B31, 0x00010B32, 0x0000B312, 0x0000B313, 0x0000B314, 0x0000B315, 0x0000B316, 0x0000B317,
+    0x0000B318, 0x0000B319, 0x0000B31A, 0x0000B31B, 0x0000B31C, 0x0000B31D, 0x0000B31E, 0x0000B31F,
+    0x00000B32, 0x0000B321, 0x00020B33, 0x0000B323, 0x0000B324, 0x0000B325, 0x0000B326, 0x0000B327,
+    0x0000B328, 0x0000B329, 0x0000B32A, 0x0000B32B, 0x0000B32C, 0x0000B32D, 0x0000B32E, 0x0000B32F,
+    0x000400B4, 0x00040B41, 0x00040B42, 0x00040B34, 0x00040B44, 0x00040B45, 0x00040B46, 0x00040B47,
+    0x00040B48, 0x00040B49, 0x00040B4A, 0x00040B4B, 0x00040B4C, 0x00040B4D, 0x00040B4E, 0x00040B4F,
+    0x00000B34, 0x0000B341, 0x0000B342, 0x0000B343, 0x00080B35, 0x0000B345, 0x0000B346, 0x0000B347,
+    0x0000B348, 0x0000B349, 0x0000B34A, 0x0000B34B, 0x0000B34C, 0x0000B34D, 0x0000B34E, 0x0000B34F,
+    0x00000B35, 0x0000B351, 0x0000B352, 0x0000B353, 0x0000B354, 0x00100B36, 0x0000B356, 0x0000B357,
+    0x0000B358, 0x0000B359, 0x0000B35A, 0x0000B35B, 0x0000B35C, 0x0000B35D, 0x0000B35E, 0x0000B35F,
+    0x00000B36, 0x0000B361, 0x0000B362, 0x0000B363, 0x0000B364, 0x0000B365, 0x00200B37, 0x0000B367,
+    0x0000B368, 0x0000B369, 0x0000B36A, 0x0000B36B, 0x0000B36C, 0x0000B36D, 0x0000B36E, 0x0000B36F,
+    0x00000B37, 0x0000B371, 0x0000B372, 0x0000B373, 0x0000B374, 0x0000B375, 0x0000B376, 0x00400B38,
+    0x0000B378, 0x0000B379, 0x0000B37A, 0x0000B37B, 0x0000B37C, 0x0000B37D, 0x0000B37E, 0x0000B37F,
+    0x00000B38, 0x0000B381, 0x0000B382, 0x0000B383, 0x0000B384, 0x0000B385, 0x0000B386, 0x0000B387,
+    0x00800B39, 0x0000B389, 0x0000B38A, 0x0000B38B, 0x0000B38C, 0x0000B38D, 0x0000B38E, 0x0000B38F,
+    0x00000B39, 0x0000B391, 0x0000B392, 0x0000B393, 0x0000B394, 0x0000B395, 0x0000B396, 0x0000B397,
+    0x0000B398, 0x01000B3A, 0x0000B39A, 0x0000B39B, 0x0000B39C, 0x0000B39D, 0x0000B39E, 0x0000B39F,
+    0x00000B3A, 0x0000B3A1, 0x0000B3A2, 0x0000B3A3, 0x0000B3A4, 0x0000B3A5, 0x0000B3A6, 0x0000B3A7,
+    0x0000B3A8, 0x0000B3A9, 0x82000B3B, 0x0000B3AB, 0x0000B3AC, 0x0000B3AD, 0x0000B3AE, 0x0000B3AF,
+    0x00000B3B, 0x0000B3B1, 0x0000B3B2, 0x0000B3B3, 0x0000B3B4, 0x0000B3B5, 0x0000B3B6, 0x0000B3B7,
+    0x0000B3B8, 0x0000B3B9, 0x0000B3BA, 0x04000B3C, 0x0000B3BC, 0x0000B3BD, 0x0000B3BE, 0x0000B3BF,
+    0x00000B3C, 0x0000B3C1, 0x0000B3C2, 0x0000B3C3, 0x0000B3C4, 0x0000B3C5, 0x0000B3C6, 0x0000B3C7,
+    0x0000B3C8, 0x0000B3C9, 0x0000B3CA, 0x0000B3CB, 0x08000B3D, 0x0000B3CD, 0x0000B3CE, 0x0000B3CF,
+    0x00000B3D, 0x0000B3D1, 0x0000B3D2, 0x0000B3D3, 0x0000B3D4, 0x0000B3D5, 0x0000B3D6, 0x0000B3D7,
+    0x0000B3D8, 0x0000B3D9, 0x0000B3DA, 0x0000B3DB, 0x0000B3DC, 0x10000B3E, 0x0000B3DE, 0x0000B3DF,
+    0x00000B3E, 0x0000B3E1, 0x0000B3E2, 0x0000B3E3, 0x0000B3E4, 0x0000B3E5, 0x0000B3E6, 0x0000B3E7,
+    0x0000B3E8, 0x0000B3E9, 0x0000B3EA, 0x0000B3EB, 0x0000B3EC, 0x0000B3ED, 0x20000B3F, 0x0000B3EF,
+    0x00000B3F, 0x0000B3F1, 0x0000B3F2, 0x0000B3F3, 0x0000B3F4, 0x0000B3F5, 0x0000B3F6, 0x0000B3F7,
+    0x0000B3F8, 0x0000B3F9, 0x0000B3FA, 0x0000B3FB, 0x0000B3FC, 0x0000B3FD, 0x0000B3FE, 0x0000B3FF,
+    0x000000B4, 0x00000B41, 0x00000B42, 0x00000B43, 0x000800B5, 0x00000B45, 0x00000B46, 0x00000B47,
+    0x00000B48, 0x00000B49, 0x00000B4A, 0x00000B4B, 0x00000B4C, 0x00000B4D, 0x00000B4E, 0x00000B4F,
+    0x00000B41, 0x00010B42, 0x0000B412, 0x0000B413, 0x0000B414, 0x0000B415, 0x0000B416, 0x0000B417,
+    0x0000B418, 0x0000B419, 0x0000B41A, 0x0000B41B, 0x0000B41C, 0x0000B41D, 0x0000B41E, 0x0000B41F,
+    0x00000B42, 0x0000B421, 0x00020B43, 0x0000B423, 0x0000B424, 0x0000B425, 0x0000B426, 0x0000B427,
+    0x0000B428, 0x0000B429, 0x0000B42A, 0x0000B42B, 0x0000B42C, 0x0000B42D, 0x0000B42E, 0x0000B42F,
+    0x00000B43, 0x0000B431, 0x0000B432, 0x00040B44, 0x0000B434, 0x0000B435, 0x0000B436, 0x0000B437,
+    0x0000B438, 0x0000B439, 0x0000B43A, 0x0000B43B, 0x0000B43C, 0x0000B43D, 0x0000B43E, 0x0000B43F,
+    0x000800B5, 0x00080B51, 0x00080B52, 0x00080B53, 0x00080B45, 0x00080B55, 0x00080B56, 0x00080B57,
+    0x00080B58, 0x00080B59, 0x00080B5A, 0x00080B5B, 0x00080B5C, 0x00080B5D, 0x00080B5E, 0x00080B5F,
+    0x00000B45, 0x0000B451, 0x0000B452, 0x0000B453, 0x0000B454, 0x00100B46, 0x0000B456, 0x0000B457,
+    0x0000B458, 0x0000B459, 0x0000B45A, 0x0000B45B, 0x0000B45C, 0x0000B45D, 0x0000B45E, 0x0000B45F,
+    0x00000B46, 0x0000B461, 0x0000B462, 0x0000B463, 0x0000B464, 0x0000B465, 0x00200B47, 0x0000B467,
+    0x0000B468, 0x0000B469, 0x0000B46A, 0x0000B46B, 0x0000B46C, 0x0000B46D, 0x0000B46E, 0x0000B46F,
+    0x00000B47, 0x0000B471, 0x0000B472, 0x0000B473, 0x0000B474, 0x0000B475, 0x0000B476, 0x00400B48,
+    0x0000B478, 0x0000B479, 0x0000B47A, 0x0000B47B, 0x0000B47C, 0x0000B47D, 0x0000B47E, 0x0000B47F,
+    0x00000B48, 0x0000B481, 0x0000B482, 0x0000B483, 0x0000B484, 0x0000B485, 0x0000B486, 0x0000B487,
+    0x00800B49, 0x0000B489, 0x0000B48A, 0x0000B48B, 0x0000B48C, 0x0000B48D, 0x0000B48E, 0x0000B48F,
+    0x00000B49, 0x0000B491, 0x0000B492, 0x0000B493, 0x0000B494, 0x0000B495, 0x0000B496, 0x0000B497,
+    0x0000B498, 0x01000B4A, 0x0000B49A, 0x0000B49B, 0x0000B49C, 0x0000B49D, 0x0000B49E, 0x0000B49F,
+    0x00000B4A, 0x0000B4A1, 0x0000B4A2, 0x0000B4A3, 0x0000B4A4, 0x0000B4A5, 0x0000B4A6, 0x0000B4A7,
+    0x0000B4A8, 0x0000B4A9, 0x82000B4B, 0x0000B4AB, 0x0000B4AC, 0x0000B4AD, 0x0000B4AE, 0x0000B4AF,
+    0x00000B4B, 0x0000B4B1, 0x0000B4B2, 0x0000B4B3, 0x0000B4B4, 0x0000B4B5, 0x0000B4B6, 0x0000B4B7,
+    0x0000B4B8, 0x0000B4B9, 0x0000B4BA, 0x04000B4C, 0x0000B4BC, 0x0000B4BD, 0x0000B4BE, 0x0000B4BF,
+    0x00000B4C, 0x0000B4C1, 0x0000B4C2, 0x0000B4C3, 0x0000B4C4, 0x0000B4C5, 0x0000B4C6, 0x0000B4C7,
+    0x0000B4C8, 0x0000B4C9, 0x0000B4CA, 0x0000B4CB, 0x08000B4D, 0x0000B4CD, 0x0000B4CE, 0x0000B4CF,
+    0x00000B4D, 0x0000B4D1, 0x0000B4D2, 0x0000B4D3, 0x0000B4D4, 0x0000B4D5, 0x0000B4D6, 0x0000B4D7,
+    0x0000B4D8, 0x0000B4D9, 0x0000B4DA, 0x0000B4DB, 0x0000B4DC, 0x10000B4E, 0x0000B4DE, 0x0000B4DF,
+    0x00000B4E, 0x0000B4E1, 0x0000B4E2, 0x0000B4E3, 0x0000B4E4, 0x0000B4E5, 0x0000B4E6, 0x0000B4E7,
+    0x0000B4E8, 0x0000B4E9, 0x0000B4EA, 0x0000B4EB, 0x0000B4EC, 0x0000B4ED, 0x20000B4F, 0x0000B4EF,
+    0x00000B4F, 0x0000B4F1, 0x0000B4F2, 0x0000B4F3, 0x0000B4F4, 0x0000B4F5, 0x0000B4F6, 0x0000B4F7,
+    0x0000B4F8, 0x0000B4F9, 0x0000B4FA, 0x0000B4FB, 0x0000B4FC, 0x0000B4FD, 0x0000B4FE, 0x0000B4FF,
+    0x000000B5, 0x00000B51, 0x00000B52, 0x00000B53, 0x00000B54, 0x001000B6, 0x00000B56, 0x00000B57,
+    0x00000B58, 0x00000B59, 0x00000B5A, 0x00000B5B, 0x00000B5C, 0x00000B5D, 0x00000B5E, 0x00000B5F,
+    0x00000B51, 0x00010B52, 0x0000B512, 0x0000B513, 0x0000B514, 0x0000B515, 0x0000B516, 0x0000B517,
+    0x0000B518, 0x0000B519, 0x0000B51A, 0x0000B51B, 0x0000B51C, 0x0000B51D, 0x0000B51E, 0x0000B51F,
+    0x00000B52, 0x0000B521, 0x00020B53, 0x0000B523, 0x0000B524, 0x0000B525, 0x0000B526, 0x0000B527,
+    0x0000B528, 0x0000B529, 0x0000B52A, 0x0000B52B, 0x0000B52C, 0x0000B52D, 0x0000B52E, 0x0000B52F,
+    0x00000B53, 0x0000B531, 0x0000B532, 0x00040B54, 0x0000B534, 0x0000B535, 0x0000B536, 0x0000B537,
+    0x0000B538, 0x0000B539, 0x0000B53A, 0x0000B53B, 0x0000B53C, 0x0000B53D, 0x0000B53E, 0x0000B53F,
+    0x00000B54, 0x0000B541, 0x0000B542, 0x0000B543, 0x00080B55, 0x0000B545, 0x0000B546, 0x0000B547,
+    0x0000B548, 0x0000B549, 0x0000B54A, 0x0000B54B, 0x0000B54C, 0x0000B54D, 0x0000B54E, 0x0000B54F,
+    0x001000B6, 0x00100B61, 0x00100B62, 0x00100B63, 0x00100B64, 0x00100B56, 0x00100B66, 0x00100B67,
+    0x00100B68, 0x00100B69, 0x00100B6A, 0x00100B6B, 0x00100B6C, 0x00100B6D, 0x00100B6E, 0x00100B6F,
+    0x00000B56, 0x0000B561, 0x0000B562, 0x0000B563, 0x0000B564, 0x0000B565, 0x00200B57, 0x0000B567,
+    0x0000B568, 0x0000B569, 0x0000B56A, 0x0000B56B, 0x0000B56C, 0x0000B56D, 0x0000B56E, 0x0000B56F,
+    0x00000B57, 0x0000B571, 0x0000B572, 0x0000B573, 0x0000B574, 0x0000B575, 0x0000B576, 0x00400B58,
+    0x0000B578, 0x0000B579, 0x0000B57A, 0x0000B57B, 0x0000B57C, 0x0000B57D, 0x0000B57E, 0x0000B57F,
+    0x00000B58, 0x0000B581, 0x0000B582, 0x0000B583, 0x0000B584, 0x0000B585, 0x0000B586, 0x0000B587,
+    0x00800B59, 0x0000B589, 0x0000B58A, 0x0000B58B, 0x0000B58C, 0x0000B58D, 0x0000B58E, 0x0000B58F,
+    0x00000B59, 0x0000B591, 0x0000B592, 0x0000B593, 0x0000B594, 0x0000B595, 0x0000B596, 0x0000B597,
+    0x0000B598, 0x01000B5A, 0x0000B59A, 0x0000B59B, 0x0000B59C, 0x0000B59D, 0x0000B59E, 0x0000B59F,
+    0x00000B5A, 0x0000B5A1, 0x0000B5A2, 0x0000B5A3, 0x0000B5A4, 0x0000B5A5, 0x0000B5A6, 0x0000B5A7,
+    0x0000B5A8, 0x0000B5A9, 0x82000B5B, 0x0000B5AB, 0x0000B5AC, 0x0000B5AD, 0x0000B5AE, 0x0000B5AF,
+    0x00000B5B, 0x0000B5B1, 0x0000B5B2, 0x0000B5B3, 0x0000B5B4, 0x0000B5B5, 0x0000B5B6, 0x0000B5B7,
+    0x0000B5B8, 0x0000B5B9, 0x0000B5BA, 0x04000B5C, 0x0000B5BC, 0x0000B5BD, 0x0000B5BE, 0x0000B5BF,
+    0x00000B5C, 0x0000B5C1, 0x0000B5C2, 0x0000B5C3, 0x0000B5C4, 0x0000B5C5, 0x0000B5C6, 0x0000B5C7,
+    0x0000B5C8, 0x0000B5C9, 0x0000B5CA, 0x0000B5CB, 0x08000B5D, 0x0000B5CD, 0x0000B5CE, 0x0000B5CF,
+    0x00000B5D, 0x0000B5D1, 0x0000B5D2, 0x0000B5D3, 0x0000B5D4, 0x0000B5D5, 0x0000B5D6, 0x0000B5D7,
+    0x0000B5D8, 0x0000B5D9, 0x0000B5DA, 0x0000B5DB, 0x0000B5DC, 0x10000B5E, 0x0000B5DE, 0x0000B5DF,
+    0x00000B5E, 0x0000B5E1, 0x0000B5E2, 0x0000B5E3, 0x0000B5E4, 0x0000B5E5, 0x0000B5E6, 0x0000B5E7,
+    0x0000B5E8, 0x0000B5E9, 0x0000B5EA, 0x0000B5EB, 0x0000B5EC, 0x0000B5ED, 0x20000B5F, 0x0000B5EF,
+    0x00000B5F, 0x0000B5F1, 0x0000B5F2, 0x0000B5F3, 0x0000B5F4, 0x0000B5F5, 0x0000B5F6, 0x0000B5F7,
+    0x0000B5F8, 0x0000B5F9, 0x0000B5FA, 0x0000B5FB, 0x0000B5FC, 0x0000B5FD, 0x0000B5FE, 0x0000B5FF,
+    0x000000B6, 0x00000B61, 0x00000B62, 0x00000B63, 0x00000B64, 0x00000B65, 0x002000B7, 0x00000B67,
+    0x00000B68, 0x00000B69, 0x00000B6A, 0x00000B6B, 0x00000B6C, 0x00000B6D, 0x00000B6E, 0x00000B6F,
+    0x00000B61, 0x00010B62, 0x0000B612, 0x0000B613, 0x0000B614, 0x0000B615, 0x0000B616, 0x0000B617,
+    0x0000B618, 0x0000B619, 0x0000B61A, 0x0000B61B, 0x0000B61C, 0x0000B61D, 0x0000B61E, 0x0000B61F,
+    0x00000B62, 0x0000B621, 0x00020B63, 0x0000B623, 0x0000B624, 0x0000B625, 0x0000B626, 0x0000B627,
+    0x0000B628, 0x0000B629, 0x0000B62A, 0x0000B62B, 0x0000B62C, 0x0000B62D, 0x0000B62E, 0x0000B62F,
+    0x00000B63, 0x0000B631, 0x0000B632, 0x00040B64, 0x0000B634, 0x0000B635, 0x0000B636, 0x0000B637,
+    0x0000B638, 0x0000B639, 0x0000B63A, 0x0000B63B, 0x0000B63C, 0x0000B63D, 0x0000B63E, 0x0000B63F,
+    0x00000B64, 0x0000B641, 0x0000B642, 0x0000B643, 0x00080B65, 0x0000B645, 0x0000B646, 0x0000B647,
+    0x0000B648, 0x0000B649, 0x0000B64A, 0x0000B64B, 0x0000B64C, 0x0000B64D, 0x0000B64E, 0x0000B64F,
+    0x00000B65, 0x0000B651, 0x0000B652, 0x0000B653, 0x0000B654, 0x00100B66, 0x0000B656, 0x0000B657,
+    0x0000B658, 0x0000B659, 0x0000B65A, 0x0000B65B, 0x0000B65C, 0x0000B65D, 0x0000B65E, 0x0000B65F,
+    0x002000B7, 0x00200B71, 0x00200B72, 0x00200B73, 0x00200B74, 0x00200B75, 0x00200B67, 0x00200B77,
+    0x00200B78, 0x00200B79, 0x00200B7A, 0x00200B7B, 0x00200B7C, 0x00200B7D, 0x00200B7E, 0x00200B7F,
+    0x00000B67, 0x0000B671, 0x0000B672, 0x0000B673, 0x0000B674, 0x0000B675, 0x0000B676, 0x00400B68,
+    0x0000B678, 0x0000B679, 0x0000B67A, 0x0000B67B, 0x0000B67C, 0x0000B67D, 0x0000B67E, 0x0000B67F,
+    0x00000B68, 0x0000B681, 0x0000B682, 0x0000B683, 0x0000B684, 0x0000B685, 0x0000B686, 0x0000B687,
+    0x00800B69, 0x0000B689, 0x0000B68A, 0x0000B68B, 0x0000B68C, 0x0000B68D, 0x0000B68E, 0x0000B68F,
+    0x00000B69, 0x0000B691, 0x0000B692, 0x0000B693, 0x0000B694, 0x0000B695, 0x0000B696, 0x0000B697,
+    0x0000B698, 0x01000B6A, 0x0000B69A, 0x0000B69B, 0x0000B69C, 0x0000B69D, 0x0000B69E, 0x0000B69F,
+    0x00000B6A, 0x0000B6A1, 0x0000B6A2, 0x0000B6A3, 0x0000B6A4, 0x0000B6A5, 0x0000B6A6, 0x0000B6A7,
+    0x0000B6A8, 0x0000B6A9, 0x82000B6B, 0x0000B6AB, 0x0000B6AC, 0x0000B6AD, 0x0000B6AE, 0x0000B6AF,
+    0x00000B6B, 0x0000B6B1, 0x0000B6B2, 0x0000B6B3, 0x0000B6B4, 0x0000B6B5, 0x0000B6B6, 0x0000B6B7,
+    0x0000B6B8, 0x0000B6B9, 0x0000B6BA, 0x04000B6C, 0x0000B6BC, 0x0000B6BD, 0x0000B6BE, 0x0000B6BF,
+    0x00000B6C, 0x0000B6C1, 0x0000B6C2, 0x0000B6C3, 0x0000B6C4, 0x0000B6C5, 0x0000B6C6, 0x0000B6C7,
+    0x0000B6C8, 0x0000B6C9, 0x0000B6CA, 0x0000B6CB, 0x08000B6D, 0x0000B6CD, 0x0000B6CE, 0x0000B6CF,
+    0x00000B6D, 0x0000B6D1, 0x0000B6D2, 0x0000B6D3, 0x0000B6D4, 0x0000B6D5, 0x0000B6D6, 0x0000B6D7,
+    0x0000B6D8, 0x0000B6D9, 0x0000B6DA, 0x0000B6DB, 0x0000B6DC, 0x10000B6E, 0x0000B6DE, 0x0000B6DF,
+    0x00000B6E, 0x0000B6E1, 0x0000B6E2, 0x0000B6E3, 0x0000B6E4, 0x0000B6E5, 0x0000B6E6, 0x0000B6E7,
+    0x0000B6E8, 0x0000B6E9, 0x0000B6EA, 0x0000B6EB, 0x0000B6EC, 0x0000B6ED, 0x20000B6F, 0x0000B6EF,
+    0x00000B6F, 0x0000B6F1, 0x0000B6F2, 0x0000B6F3, 0x0000B6F4, 0x0000B6F5, 0x0000B6F6, 0x0000B6F7,
+    0x0000B6F8, 0x0000B6F9, 0x0000B6FA, 0x0000B6FB, 0x0000B6FC, 0x0000B6FD, 0x0000B6FE, 0x0000B6FF,
+    0x000000B7, 0x00000B71, 0x00000B72, 0x00000B73, 0x00000B74, 0x00000B75, 0x00000B76, 0x004000B8,
+    0x00000B78, 0x00000B79, 0x00000B7A, 0x00000B7B, 0x00000B7C, 0x00000B7D, 0x00000B7E, 0x00000B7F,
+    0x00000B71, 0x00010B72, 0x0000B712, 0x0000B713, 0x0000B714, 0x0000B715, 0x0000B716, 0x0000B717,
+    0x0000B718, 0x0000B719, 0x0000B71A, 0x0000B71B, 0x0000B71C, 0x0000B71D, 0x0000B71E, 0x0000B71F,
+    0x00000B72, 0x0000B721, 0x00020B73, 0x0000B723, 0x0000B724, 0x0000B725, 0x0000B726, 0x0000B727,
+    0x0000B728, 0x0000B729, 0x0000B72A, 0x0000B72B, 0x0000B72C, 0x0000B72D, 0x0000B72E, 0x0000B72F,
+    0x00000B73, 0x0000B731, 0x0000B732, 0x00040B74, 0x0000B734, 0x0000B735, 0x0000B736, 0x0000B737,
+    0x0000B738, 0x0000B739, 0x0000B73A, 0x0000B73B, 0x0000B73C, 0x0000B73D, 0x0000B73E, 0x0000B73F,
+    0x00000B74, 0x0000B741, 0x0000B742, 0x0000B743, 0x00080B75, 0x0000B745, 0x0000B746, 0x0000B747,
+    0x0000B748, 0x0000B749, 0x0000B74A, 0x0000B74B, 0x0000B74C, 0x0000B74D, 0x0000B74E, 0x0000B74F,
+    0x00000B75, 0x0000B751, 0x0000B752, 0x0000B753, 0x0000B754, 0x00100B76, 0x0000B756, 0x0000B757,
+    0x0000B758, 0x0000B759, 0x0000B75A, 0x0000B75B, 0x0000B75C, 0x0000B75D, 0x0000B75E, 0x0000B75F,
+    0x00000B76, 0x0000B761, 0x0000B762, 0x0000B763, 0x0000B764, 0x0000B765, 0x00200B77, 0x0000B767,
+    0x0000B768, 0x0000B769, 0x0000B76A, 0x0000B76B, 0x0000B76C, 0x0000B76D, 0x0000B76E, 0x0000B76F,
+    0x004000B8, 0x00400B81, 0x00400B82, 0x00400B83, 0x00400B84, 0x00400B85, 0x00400B86, 0x00400B78,
+    0x00400B88, 0x00400B89, 0x00400B8A, 0x00400B8B, 0x00400B8C, 0x00400B8D, 0x00400B8E, 0x00400B8F,
+    0x00000B78, 0x0000B781, 0x0000B782, 0x0000B783, 0x0000B784, 0x0000B785, 0x0000B786, 0x0000B787,
+    0x00800B79, 0x0000B789, 0x0000B78A, 0x0000B78B, 0x0000B78C, 0x0000B78D, 0x0000B78E, 0x0000B78F,
+    0x00000B79, 0x0000B791, 0x0000B792, 0x0000B793, 0x0000B794, 0x0000B795, 0x0000B796, 0x0000B797,
+    0x0000B798, 0x01000B7A, 0x0000B79A, 0x0000B79B, 0x0000B79C, 0x0000B79D, 0x0000B79E, 0x0000B79F,
+    0x00000B7A, 0x0000B7A1, 0x0000B7A2, 0x0000B7A3, 0x0000B7A4, 0x0000B7A5, 0x0000B7A6, 0x0000B7A7,
+    0x0000B7A8, 0x0000B7A9, 0x82000B7B, 0x0000B7AB, 0x0000B7AC, 0x0000B7AD, 0x0000B7AE, 0x0000B7AF,
+    0x00000B7B, 0x0000B7B1, 0x0000B7B2, 0x0000B7B3, 0x0000B7B4, 0x0000B7B5, 0x0000B7B6, 0x0000B7B7,
+    0x0000B7B8, 0x0000B7B9, 0x0000B7BA, 0x04000B7C, 0x0000B7BC, 0x0000B7BD, 0x0000B7BE, 0x0000B7BF,
+    0x00000B7C, 0x0000B7C1, 0x0000B7C2, 0x0000B7C3, 0x0000B7C4, 0x0000B7C5, 0x0000B7C6, 0x0000B7C7,
+    0x0000B7C8, 0x0000B7C9, 0x0000B7CA, 0x0000B7CB, 0x08000B7D, 0x0000B7CD, 0x0000B7CE, 0x0000B7CF,
+    0x00000B7D, 0x0000B7D1, 0x0000B7D2, 0x0000B7D3, 0x0000B7D4, 0x0000B7D5, 0x0000B7D6, 0x0000B7D7,
+    0x0000B7D8, 0x0000B7D9, 0x0000B7DA, 0x0000B7DB, 0x0000B7DC, 0x10000B7E, 0x0000B7DE, 0x0000B7DF,
+    0x00000B7E, 0x0000B7E1, 0x0000B7E2, 0x0000B7E3, 0x0000B7E4, 0x0000B7E5, 0x0000B7E6, 0x0000B7E7,
+    0x0000B7E8, 0x0000B7E9, 0x0000B7EA, 0x0000B7EB, 0x0000B7EC, 0x0000B7ED, 0x20000B7F, 0x0000B7EF,
+    0x00000B7F, 0x0000B7F1, 0x0000B7F2, 0x0000B7F3, 0x0000B7F4, 0x0000B7F5, 0x0000B7F6, 0x0000B7F7,
+    0x0000B7F8, 0x0000B7F9, 0x0000B7FA, 0x0000B7FB, 0x0000B7FC, 0x0000B7FD, 0x0000B7FE, 0x0000B7FF,
+    0x000000B8, 0x00000B81, 0x00000B82, 0x00000B83, 0x00000B84, 0x00000B85, 0x00000B86, 0x00000B87,
+    0x008000B9, 0x00000B89, 0x00000B8A, 0x00000B8B, 0x00000B8C, 0x00000B8D, 0x00000B8E, 0x00000B8F,
+    0x00000B81, 0x00010B82, 0x0000B812, 0x0000B813, 0x0000B814, 0x0000B815, 0x0000B816, 0x0000B817,
+    0x0000B818, 0x0000B819, 0x0000B81A, 0x0000B81B, 0x0000B81C, 0x0000B81D, 0x0000B81E, 0x0000B81F,
+    0x00000B82, 0x0000B821, 0x00020B83, 0x0000B823, 0x0000B824, 0x0000B825, 0x0000B826, 0x0000B827,
+    0x0000B828, 0x0000B829, 0x0000B82A, 0x0000B82B, 0x0000B82C, 0x0000B82D, 0x0000B82E, 0x0000B82F,
+    0x00000B83, 0x0000B831, 0x0000B832, 0x00040B84, 0x0000B834, 0x0000B835, 0x0000B836, 0x0000B837,
+    0x0000B838, 0x0000B839, 0x0000B83A, 0x0000B83B, 0x0000B83C, 0x0000B83D, 0x0000B83E, 0x0000B83F,
+    0x00000B84, 0x0000B841, 0x0000B842, 0x0000B843, 0x00080B85, 0x0000B845, 0x0000B846, 0x0000B847,
+    0x0000B848, 0x0000B849, 0x0000B84A, 0x0000B84B, 0x0000B84C, 0x0000B84D, 0x0000B84E, 0x0000B84F,
+    0x00000B85, 0x0000B851, 0x0000B852, 0x0000B853, 0x0000B854, 0x00100B86, 0x0000B856, 0x0000B857,
+    0x0000B858, 0x0000B859, 0x0000B85A, 0x0000B85B, 0x0000B85C, 0x0000B85D, 0x0000B85E, 0x0000B85F,
+    0x00000B86, 0x0000B861, 0x0000B862, 0x0000B863, 0x0000B864, 0x0000B865, 0x00200B87, 0x0000B867,
+    0x0000B868, 0x0000B869, 0x0000B86A, 0x0000B86B, 0x0000B86C, 0x0000B86D, 0x0000B86E, 0x0000B86F,
+    0x00000B87, 0x0000B871, 0x0000B872, 0x0000B873, 0x0000B874, 0x0000B875, 0x0000B876, 0x00400B88,
+    0x0000B878, 0x0000B879, 0x0000B87A, 0x0000B87B, 0x0000B87C, 0x0000B87D, 0x0000B87E, 0x0000B87F,
+    0x008000B9, 0x00800B91, 0x00800B92, 0x00800B93, 0x00800B94, 0x00800B95, 0x00800B96, 0x00800B97,
+    0x00800B89, 0x00800B99, 0x00800B9A, 0x00800B9B, 0x00800B9C, 0x00800B9D, 0x00800B9E, 0x00800B9F,
+    0x00000B89, 0x0000B891, 0x0000B892, 0x0000B893, 0x0000B894, 0x0000B895, 0x0000B896, 0x0000B897,
+    0x0000B898, 0x01000B8A, 0x0000B89A, 0x0000B89B, 0x0000B89C, 0x0000B89D, 0x0000B89E, 0x0000B89F,
+    0x00000B8A, 0x0000B8A1, 0x0000B8A2, 0x0000B8A3, 0x0000B8A4, 0x0000B8A5, 0x0000B8A6, 0x0000B8A7,
+    0x0000B8A8, 0x0000B8A9, 0x82000B8B, 0x0000B8AB, 0x0000B8AC, 0x0000B8AD, 0x0000B8AE, 0x0000B8AF,
+    0x00000B8B, 0x0000B8B1, 0x0000B8B2, 0x0000B8B3, 0x0000B8B4, 0x0000B8B5, 0x0000B8B6, 0x0000B8B7,
+    0x0000B8B8, 0x0000B8B9, 0x0000B8BA, 0x04000B8C, 0x0000B8BC, 0x0000B8BD, 0x0000B8BE, 0x0000B8BF,
+    0x00000B8C, 0x0000B8C1, 0x0000B8C2, 0x0000B8C3, 0x0000B8C4, 0x0000B8C5, 0x0000B8C6, 0x0000B8C7,
+    0x0000B8C8, 0x0000B8C9, 0x0000B8CA, 0x0000B8CB, 0x08000B8D, 0x0000B8CD, 0x0000B8CE, 0x0000B8CF,
+    0x00000B8D, 0x0000B8D1, 0x0000B8D2, 0x0000B8D3, 0x0000B8D4, 0x0000B8D5, 0x0000B8D6, 0x0000B8D7,
+    0x0000B8D8, 0x0000B8D9, 0x0000B8DA, 0x0000B8DB, 0x0000B8DC, 0x10000B8E, 0x0000B8DE, 0x0000B8DF,
+    0x00000B8E, 0x0000B8E1, 0x0000B8E2, 0x0000B8E3, 0x0000B8E4, 0x0000B8E5, 0x0000B8E6, 0x0000B8E7,
+    0x0000B8E8, 0x0000B8E9, 0x0000B8EA, 0x0000B8EB, 0x0000B8EC, 0x0000B8ED, 0x20000B8F, 0x0000B8EF,
+    0x00000B8F, 0x0000B8F1, 0x0000B8F2, 0x0000B8F3, 0x0000B8F4, 0x0000B8F5, 0x0000B8F6, 0x0000B8F7,
+    0x0000B8F8, 0x0000B8F9, 0x0000B8FA, 0x0000B8FB, 0x0000B8FC, 0x0000B8FD, 0x0000B8FE, 0x0000B8FF,
+    0x000000B9, 0x00000B91, 0x00000B92, 0x00000B93, 0x00000B94, 0x00000B95, 0x00000B96, 0x00000B97,
+    0x00000B98, 0x010000BA, 0x00000B9A, 0x00000B9B, 0x00000B9C, 0x00000B9D, 0x00000B9E, 0x00000B9F,
+    0x00000B91, 0x00010B92, 0x0000B912, 0x0000B913, 0x0000B914, 0x0000B915, 0x0000B916, 0x0000B917,
+    0x0000B918, 0x0000B919, 0x0000B91A, 0x0000B91B, 0x0000B91C, 0x0000B91D, 0x0000B91E, 0x0000B91F,
+    0x00000B92, 0x0000B921, 0x00020B93, 0x0000B923, 0x0000B924, 0x0000B925, 0x0000B926, 0x0000B927,
+    0x0000B928, 0x0000B929, 0x0000B92A, 0x0000B92B, 0x0000B92C, 0x0000B92D, 0x0000B92E, 0x0000B92F,
+    0x00000B93, 0x0000B931, 0x0000B932, 0x00040B94, 0x0000B934, 0x0000B935, 0x0000B936, 0x0000B937,
+    0x0000B938, 0x0000B939, 0x0000B93A, 0x0000B93B, 0x0000B93C, 0x0000B93D, 0x0000B93E, 0x0000B93F,
+    0x00000B94, 0x0000B941, 0x0000B942, 0x0000B943, 0x00080B95, 0x0000B945, 0x0000B946, 0x0000B947,
+    0x0000B948, 0x0000B949, 0x0000B94A, 0x0000B94B, 0x0000B94C, 0x0000B94D, 0x0000B94E, 0x0000B94F,
+    0x00000B95, 0x0000B951, 0x0000B952, 0x0000B953, 0x0000B954, 0x00100B96, 0x0000B956, 0x0000B957,
+    0x0000B958, 0x0000B959, 0x0000B95A, 0x0000B95B, 0x0000B95C, 0x0000B95D, 0x0000B95E, 0x0000B95F,
+    0x00000B96, 0x0000B961, 0x0000B962, 0x0000B963, 0x0000B964, 0x0000B965, 0x00200B97, 0x0000B967,
+    0x0000B968, 0x0000B969, 0x0000B96A, 0x0000B96B, 0x0000B96C, 0x0000B96D, 0x0000B96E, 0x0000B96F,
+    0x00000B97, 0x0000B971, 0x0000B972, 0x0000B973, 0x0000B974, 0x0000B975, 0x0000B976, 0x00400B98,
+    0x0000B978, 0x0000B979, 0x0000B97A, 0x0000B97B, 0x0000B97C, 0x0000B97D, 0x0000B97E, 0x0000B97F,
+    0x00000B98, 0x0000B981, 0x0000B982, 0x0000B983, 0x0000B984, 0x0000B985, 0x0000B986, 0x0000B987,
+    0x00800B99, 0x0000B989, 0x0000B98A, 0x0000B98B, 0x0000B98C, 0x0000B98D, 0x0000B98E, 0x0000B98F,
+    0x010000BA, 0x01000BA1, 0x01000BA2, 0x01000BA3, 0x01000BA4, 0x01000BA5, 0x01000BA6, 0x01000BA7,
+    0x01000BA8, 0x01000B9A, 0x01000BAA, 0x01000BAB, 0x01000BAC, 0x01000BAD, 0x01000BAE, 0x01000BAF,
+    0x00000B9A, 0x0000B9A1, 0x0000B9A2, 0x0000B9A3, 0x0000B9A4, 0x0000B9A5, 0x0000B9A6, 0x0000B9A7,
+    0x0000B9A8, 0x0000B9A9, 0x82000B9B, 0x0000B9AB, 0x0000B9AC, 0x0000B9AD, 0x0000B9AE, 0x0000B9AF,
+    0x00000B9B, 0x0000B9B1, 0x0000B9B2, 0x0000B9B3, 0x0000B9B4, 0x0000B9B5, 0x0000B9B6, 0x0000B9B7,
+    0x0000B9B8, 0x0000B9B9, 0x0000B9BA, 0x04000B9C, 0x0000B9BC, 0x0000B9BD, 0x0000B9BE, 0x0000B9BF,
+    0x00000B9C, 0x0000B9C1, 0x0000B9C2, 0x0000B9C3, 0x0000B9C4, 0x0000B9C5, 0x0000B9C6, 0x0000B9C7,
+    0x0000B9C8, 0x0000B9C9, 0x0000B9CA, 0x0000B9CB, 0x08000B9D, 0x0000B9CD, 0x0000B9CE, 0x0000B9CF,
+    0x00000B9D, 0x0000B9D1, 0x0000B9D2, 0x0000B9D3, 0x0000B9D4, 0x0000B9D5, 0x0000B9D6, 0x0000B9D7,
+    0x0000B9D8, 0x0000B9D9, 0x0000B9DA, 0x0000B9DB, 0x0000B9DC, 0x10000B9E, 0x0000B9DE, 0x0000B9DF,
+    0x00000B9E, 0x0000B9E1, 0x0000B9E2, 0x0000B9E3, 0x0000B9E4, 0x0000B9E5, 0x0000B9E6, 0x0000B9E7,
+    0x0000B9E8, 0x0000B9E9, 0x0000B9EA, 0x0000B9EB, 0x0000B9EC, 0x0000B9ED, 0x20000B9F, 0x0000B9EF,
+    0x00000B9F, 0x0000B9F1, 0x0000B9F2, 0x0000B9F3, 0x0000B9F4, 0x0000B9F5, 0x0000B9F6, 0x0000B9F7,
+    0x0000B9F8, 0x0000B9F9, 0x0000B9FA, 0x0000B9FB, 0x0000B9FC, 0x0000B9FD, 0x0000B9FE, 0x0000B9FF,
+    0x000000BA, 0x00000BA1, 0x00000BA2, 0x00000BA3, 0x00000BA4, 0x00000BA5, 0x00000BA6, 0x00000BA7,
+    0x00000BA8, 0x00000BA9, 0x820000BB, 0x00000BAB, 0x00000BAC, 0x00000BAD, 0x00000BAE, 0x00000BAF,
+    0x00000BA1, 0x00010BA2, 0x0000BA12, 0x0000BA13, 0x0000BA14, 0x0000BA15, 0x0000BA16, 0x0000BA17,
+    0x0000BA18, 0x0000BA19, 0x0000BA1A, 0x0000BA1B, 0x0000BA1C, 0x0000BA1D, 0x0000BA1E, 0x0000BA1F,
+    0x00000BA2, 0x0000BA21, 0x00020BA3, 0x0000BA23, 0x0000BA24, 0x0000BA25, 0x0000BA26, 0x0000BA27,
+    0x0000BA28, 0x0000BA29, 0x0000BA2A, 0x0000BA2B, 0x0000BA2C, 0x0000BA2D, 0x0000BA2E, 0x0000BA2F,
+    0x00000BA3, 0x0000BA31, 0x0000BA32, 0x00040BA4, 0x0000BA34, 0x0000BA35, 0x0000BA36, 0x0000BA37,
+    0x0000BA38, 0x0000BA39, 0x0000BA3A, 0x0000BA3B, 0x0000BA3C, 0x0000BA3D, 0x0000BA3E, 0x0000BA3F,
+    0x00000BA4, 0x0000BA41, 0x0000BA42, 0x0000BA43, 0x00080BA5, 0x0000BA45, 0x0000BA46, 0x0000BA47,
+    0x0000BA48, 0x0000BA49, 0x0000BA4A, 0x0000BA4B, 0x0000BA4C, 0x0000BA4D, 0x0000BA4E, 0x0000BA4F,
+    0x00000BA5, 0x0000BA51, 0x0000BA52, 0x0000BA53, 0x0000BA54, 0x00100BA6, 0x0000BA56, 0x0000BA57,
+    0x0000BA58, 0x0000BA59, 0x0000BA5A, 0x0000BA5B, 0x0000BA5C, 0x0000BA5D, 0x0000BA5E, 0x0000BA5F,
+    0x00000BA6, 0x0000BA61, 0x0000BA62, 0x0000BA63, 0x0000BA64, 0x0000BA65, 0x00200BA7, 0x0000BA67,
+    0x0000BA68, 0x0000BA69, 0x0000BA6A, 0x0000BA6B, 0x0000BA6C, 0x0000BA6D, 0x0000BA6E, 0x0000BA6F,
+    0x00000BA7, 0x0000BA71, 0x0000BA72, 0x0000BA73, 0x0000BA74, 0x0000BA75, 0x0000BA76, 0x00400BA8,
+    0x0000BA78, 0x0000BA79, 0x0000BA7A, 0x0000BA7B, 0x0000BA7C, 0x0000BA7D, 0x0000BA7E, 0x0000BA7F,
+    0x00000BA8, 0x0000BA81, 0x0000BA82, 0x0000BA83, 0x0000BA84, 0x0000BA85, 0x0000BA86, 0x0000BA87,
+    0x00800BA9, 0x0000BA89, 0x0000BA8A, 0x0000BA8B, 0x0000BA8C, 0x0000BA8D, 0x0000BA8E, 0x0000BA8F,
+    0x00000BA9, 0x0000BA91, 0x0000BA92, 0x0000BA93, 0x0000BA94, 0x0000BA95, 0x0000BA96, 0x0000BA97,
+    0x0000BA98, 0x01000BAA, 0x0000BA9A, 0x0000BA9B, 0x0000BA9C, 0x0000BA9D, 0x0000BA9E, 0x0000BA9F,
+    0x820000BB, 0x82000BB1, 0x82000BB2, 0x82000BB3, 0x82000BB4, 0x82000BB5, 0x82000BB6, 0x82000BB7,
+    0x82000BB8, 0x82000BB9, 0x82000BAB, 0x82000BBB, 0x82000BBC, 0x82000BBD, 0x82000BBE, 0x82000BBF,
+    0x00000BAB, 0x0000BAB1, 0x0000BAB2, 0x0000BAB3, 0x0000BAB4, 0x0000BAB5, 0x0000BAB6, 0x0000BAB7,
+    0x0000BAB8, 0x0000BAB9, 0x0000BABA, 0x04000BAC, 0x0000BABC, 0x0000BABD, 0x0000BABE, 0x0000BABF,
+    0x00000BAC, 0x0000BAC1, 0x0000BAC2, 0x0000BAC3, 0x0000BAC4, 0x0000BAC5, 0x0000BAC6, 0x0000BAC7,
+    0x0000BAC8, 0x0000BAC9, 0x0000BACA, 0x0000BACB, 0x08000BAD, 0x0000BACD, 0x0000BACE, 0x0000BACF,
+    0x00000BAD, 0x0000BAD1, 0x0000BAD2, 0x0000BAD3, 0x0000BAD4, 0x0000BAD5, 0x0000BAD6, 0x0000BAD7,
+    0x0000BAD8, 0x0000BAD9, 0x0000BADA, 0x0000BADB, 0x0000BADC, 0x10000BAE, 0x0000BADE, 0x0000BADF,
+    0x00000BAE, 0x0000BAE1, 0x0000BAE2, 0x0000BAE3, 0x0000BAE4, 0x0000BAE5, 0x0000BAE6, 0x0000BAE7,
+    0x0000BAE8, 0x0000BAE9, 0x0000BAEA, 0x0000BAEB, 0x0000BAEC, 0x0000BAED, 0x20000BAF, 0x0000BAEF,
+    0x00000BAF, 0x0000BAF1, 0x0000BAF2, 0x0000BAF3, 0x0000BAF4, 0x0000BAF5, 0x0000BAF6, 0x0000BAF7,
+    0x0000BAF8, 0x0000BAF9, 0x0000BAFA, 0x0000BAFB, 0x0000BAFC, 0x0000BAFD, 0x0000BAFE, 0x0000BAFF,
+    0x0400000C, 0x040000C1, 0x040000C2, 0x040000C3, 0x040000C4, 0x040000C5, 0x040000C6, 0x040000C7,
+    0x040000C8, 0x040000C9, 0x040000CA, 0x040000BC, 0x040000CC, 0x040000CD, 0x040000CE, 0x040000CF,
+    0x040000C1, 0x040100C2, 0x04000C12, 0x04000C13, 0x04000C14, 0x04000C15, 0x04000C16, 0x04000C17,
+    0x04000C18, 0x04000C19, 0x04000C1A, 0x04000C1B, 0x04000C1C, 0x04000C1D, 0x04000C1E, 0x04000C1F,
+    0x040000C2, 0x04000C21, 0x040200C3, 0x04000C23, 0x04000C24, 0x04000C25, 0x04000C26, 0x04000C27,
+    0x04000C28, 0x04000C29, 0x04000C2A, 0x04000C2B, 0x04000C2C, 0x04000C2D, 0x04000C2E, 0x04000C2F,
+    0x040000C3, 0x04000C31, 0x04000C32, 0x040400C4, 0x04000C34, 0x04000C35, 0x04000C36, 0x04000C37,
+    0x04000C38, 0x04000C39, 0x04000C3A, 0x04000C3B, 0x04000C3C, 0x04000C3D, 0x04000C3E, 0x04000C3F,
+    0x040000C4, 0x04000C41, 0x04000C42, 0x04000C43, 0x040800C5, 0x04000C45, 0x04000C46, 0x04000C47,
+    0x04000C48, 0x04000C49, 0x04000C4A, 0x04000C4B, 0x04000C4C, 0x04000C4D, 0x04000C4E, 0x04000C4F,
+    0x040000C5, 0x04000C51, 0x04000C52, 0x04000C53, 0x04000C54, 0x041000C6, 0x04000C56, 0x04000C57,
+    0x04000C58, 0x04000C59, 0x04000C5A, 0x04000C5B, 0x04000C5C, 0x04000C5D, 0x04000C5E, 0x04000C5F,
+    0x040000C6, 0x04000C61, 0x04000C62, 0x04000C63, 0x04000C64, 0x04000C65, 0x042000C7, 0x04000C67,
+    0x04000C68, 0x04000C69, 0x04000C6A, 0x04000C6B, 0x04000C6C, 0x04000C6D, 0x04000C6E, 0x04000C6F,
+    0x040000C7, 0x04000C71, 0x04000C72, 0x04000C73, 0x04000C74, 0x04000C75, 0x04000C76, 0x044000C8,
+    0x04000C78, 0x04000C79, 0x04000C7A, 0x04000C7B, 0x04000C7C, 0x04000C7D, 0x04000C7E, 0x04000C7F,
+    0x040000C8, 0x04000C81, 0x04000C82, 0x04000C83, 0x04000C84, 0x04000C85, 0x04000C86, 0x04000C87,
+    0x048000C9, 0x04000C89, 0x04000C8A, 0x04000C8B, 0x04000C8C, 0x04000C8D, 0x04000C8E, 0x04000C8F,
+    0x040000C9, 0x04000C91, 0x04000C92, 0x04000C93, 0x04000C94, 0x04000C95, 0x04000C96, 0x04000C97,
+    0x04000C98, 0x050000CA, 0x04000C9A, 0x04000C9B, 0x04000C9C, 0x04000C9D, 0x04000C9E, 0x04000C9F,
+    0x040000CA, 0x04000CA1, 0x04000CA2, 0x04000CA3, 0x04000CA4, 0x04000CA5, 0x04000CA6, 0x04000CA7,
+    0x04000CA8, 0x04000CA9, 0x860000CB, 0x04000CAB, 0x04000CAC, 0x04000CAD, 0x04000CAE, 0x04000CAF,
+    0x040000BC, 0x04000BC1, 0x04000BC2, 0x04000BC3, 0x04000BC4, 0x04000BC5, 0x04000BC6, 0x04000BC7,
+    0x04000BC8, 0x04000BC9, 0x04000BCA, 0x080000CC, 0x04000BCC, 0x04000BCD, 0x04000BCE, 0x04000BCF,
+    0x040000CC, 0x04000CC1, 0x04000CC2, 0x04000CC3, 0x04000CC4, 0x04000CC5, 0x04000CC6, 0x04000CC7,
+    0x04000CC8, 0x04000CC9, 0x04000CCA, 0x04000CCB, 0x0C0000CD, 0x04000CCD, 0x04000CCE, 0x04000CCF,
+    0x040000CD, 0x04000CD1, 0x04000CD2, 0x04000CD3, 0x04000CD4, 0x04000CD5, 0x04000CD6, 0x04000CD7,
+    0x04000CD8, 0x04000CD9, 0x04000CDA, 0x04000CDB, 0x04000CDC, 0x140000CE, 0x04000CDE, 0x04000CDF,
+    0x040000CE, 0x04000CE1, 0x04000CE2, 0x04000CE3, 0x04000CE4, 0x04000CE5, 0x04000CE6, 0x04000CE7,
+    0x04000CE8, 0x04000CE9, 0x04000CEA, 0x04000CEB, 0x04000CEC, 0x04000CED, 0x240000CF, 0x04000CEF,
+    0x040000CF, 0x04000CF1, 0x04000CF2, 0x04000CF3, 0x04000CF4, 0x04000CF5, 0x04000CF6, 0x04000CF7,
+    0x04000CF8, 0x04000CF9, 0x04000CFA, 0x04000CFB, 0x04000CFC, 0x04000CFD, 0x04000CFE, 0x04000CFF,
+    0x000000BC, 0x00000BC1, 0x00000BC2, 0x00000BC3, 0x00000BC4, 0x00000BC5, 0x00000BC6, 0x00000BC7,
+    0x00000BC8, 0x00000BC9, 0x00000BCA, 0x00000BCB, 0x080000BD, 0x00000BCD, 0x00000BCE, 0x00000BCF,
+    0x00000BC1, 0x00010BC2, 0x0000BC12, 0x0000BC13, 0x0000BC14, 0x0000BC15, 0x0000BC16, 0x0000BC17,
+    0x0000BC18, 0x0000BC19, 0x0000BC1A, 0x0000BC1B, 0x0000BC1C, 0x0000BC1D, 0x0000BC1E, 0x0000BC1F,
+    0x00000BC2, 0x0000BC21, 0x00020BC3, 0x0000BC23, 0x0000BC24, 0x0000BC25, 0x0000BC26, 0x0000BC27,
+    0x0000BC28, 0x0000BC29, 0x0000BC2A, 0x0000BC2B, 0x0000BC2C, 0x0000BC2D, 0x0000BC2E, 0x0000BC2F,
+    0x00000BC3, 0x0000BC31, 0x0000BC32, 0x00040BC4, 0x0000BC34, 0x0000BC35, 0x0000BC36, 0x0000BC37,
+    0x0000BC38, 0x0000BC39, 0x0000BC3A, 0x0000BC3B, 0x0000BC3C, 0x0000BC3D, 0x0000BC3E, 0x0000BC3F,
+    0x00000BC4, 0x0000BC41, 0x0000BC42, 0x0000BC43, 0x00080BC5, 0x0000BC45, 0x0000BC46, 0x0000BC47,
+    0x0000BC48, 0x0000BC49, 0x0000BC4A, 0x0000BC4B, 0x0000BC4C, 0x0000BC4D, 0x0000BC4E, 0x0000BC4F,
+    0x00000BC5, 0x0000BC51, 0x0000BC52, 0x0000BC53, 0x0000BC54, 0x00100BC6, 0x0000BC56, 0x0000BC57,
+    0x0000BC58, 0x0000BC59, 0x0000BC5A, 0x0000BC5B, 0x0000BC5C, 0x0000BC5D, 0x0000BC5E, 0x0000BC5F,
+    0x00000BC6, 0x0000BC61, 0x0000BC62, 0x0000BC63, 0x0000BC64, 0x0000BC65, 0x00200BC7, 0x0000BC67,
+    0x0000BC68, 0x0000BC69, 0x0000BC6A, 0x0000BC6B, 0x0000BC6C, 0x0000BC6D, 0x0000BC6E, 0x0000BC6F,
+    0x00000BC7, 0x0000BC71, 0x0000BC72, 0x0000BC73, 0x0000BC74, 0x0000BC75, 0x0000BC76, 0x00400BC8,
+    0x0000BC78, 0x0000BC79, 0x0000BC7A, 0x0000BC7B, 0x0000BC7C, 0x0000BC7D, 0x0000BC7E, 0x0000BC7F,
+    0x00000BC8, 0x0000BC81, 0x0000BC82, 0x0000BC83, 0x0000BC84, 0x0000BC85, 0x0000BC86, 0x0000BC87,
+    0x00800BC9, 0x0000BC89, 0x0000BC8A, 0x0000BC8B, 0x0000BC8C, 0x0000BC8D, 0x0000BC8E, 0x0000BC8F,
+    0x00000BC9, 0x0000BC91, 0x0000BC92, 0x0000BC93, 0x0000BC94, 0x0000BC95, 0x0000BC96, 0x0000BC97,
+    0x0000BC98, 0x01000BCA, 0x0000BC9A, 0x0000BC9B, 0x0000BC9C, 0x0000BC9D, 0x0000BC9E, 0x0000BC9F,
+    0x00000BCA, 0x0000BCA1, 0x0000BCA2, 0x0000BCA3, 0x0000BCA4, 0x0000BCA5, 0x0000BCA6, 0x0000BCA7,
+    0x0000BCA8, 0x0000BCA9, 0x82000BCB, 0x0000BCAB, 0x0000BCAC, 0x0000BCAD, 0x0000BCAE, 0x0000BCAF,
+    0x00000BCB, 0x0000BCB1, 0x0000BCB2, 0x0000BCB3, 0x0000BCB4, 0x0000BCB5, 0x0000BCB6, 0x0000BCB7,
+    0x0000BCB8, 0x0000BCB9, 0x0000BCBA, 0x04000BCC, 0x0000BCBC, 0x0000BCBD, 0x0000BCBE, 0x0000BCBF,
+    0x080000BD, 0x08000BD1, 0x08000BD2, 0x08000BD3, 0x08000BD4, 0x08000BD5, 0x08000BD6, 0x08000BD7,
+    0x08000BD8, 0x08000BD9, 0x08000BDA, 0x08000BDB, 0x08000BCD, 0x08000BDD, 0x08000BDE, 0x08000BDF,
+    0x00000BCD, 0x0000BCD1, 0x0000BCD2, 0x0000BCD3, 0x0000BCD4, 0x0000BCD5, 0x0000BCD6, 0x0000BCD7,
+    0x0000BCD8, 0x0000BCD9, 0x0000BCDA, 0x0000BCDB, 0x0000BCDC, 0x10000BCE, 0x0000BCDE, 0x0000BCDF,
+    0x00000BCE, 0x0000BCE1, 0x0000BCE2, 0x0000BCE3, 0x0000BCE4, 0x0000BCE5, 0x0000BCE6, 0x0000BCE7,
+    0x0000BCE8, 0x0000BCE9, 0x0000BCEA, 0x0000BCEB, 0x0000BCEC, 0x0000BCED, 0x20000BCF, 0x0000BCEF,
+    0x00000BCF, 0x0000BCF1, 0x0000BCF2, 0x0000BCF3, 0x0000BCF4, 0x0000BCF5, 0x0000BCF6, 0x0000BCF7,
+    0x0000BCF8, 0x0000BCF9, 0x0000BCFA, 0x0000BCFB, 0x0000BCFC, 0x0000BCFD, 0x0000BCFE, 0x0000BCFF,
+    0x000000BD, 0x00000BD1, 0x00000BD2, 0x00000BD3, 0x00000BD4, 0x00000BD5, 0x00000BD6, 0x00000BD7,
+    0x00000BD8, 0x00000BD9, 0x00000BDA, 0x00000BDB, 0x00000BDC, 0x100000BE, 0x00000BDE, 0x00000BDF,
+    0x00000BD1, 0x00010BD2, 0x0000BD12, 0x0000BD13, 0x0000BD14, 0x0000BD15, 0x0000BD16, 0x0000BD17,
+    0x0000BD18, 0x0000BD19, 0x0000BD1A, 0x0000BD1B, 0x0000BD1C, 0x0000BD1D, 0x0000BD1E, 0x0000BD1F,
+    0x00000BD2, 0x0000BD21, 0x00020BD3, 0x0000BD23, 0x0000BD24, 0x0000BD25, 0x0000BD26, 0x0000BD27,
+    0x0000BD28, 0x0000BD29, 0x0000BD2A, 0x0000BD2B, 0x0000BD2C, 0x0000BD2D, 0x0000BD2E, 0x0000BD2F,
+    0x00000BD3, 0x0000BD31, 0x0000BD32, 0x00040BD4, 0x0000BD34, 0x0000BD35, 0x0000BD36, 0x0000BD37,
+    0x0000BD38, 0x0000BD39, 0x0000BD3A, 0x0000BD3B, 0x0000BD3C, 0x0000BD3D, 0x0000BD3E, 0x0000BD3F,
+    0x00000BD4, 0x0000BD41, 0x0000BD42, 0x0000BD43, 0x00080BD5, 0x0000BD45, 0x0000BD46, 0x0000BD47,
+    0x0000BD48, 0x0000BD49, 0x0000BD4A, 0x0000BD4B, 0x0000BD4C, 0x0000BD4D, 0x0000BD4E, 0x0000BD4F,
+    0x00000BD5, 0x0000BD51, 0x0000BD52, 0x0000BD53, 0x0000BD54, 0x00100BD6, 0x0000BD56, 0x0000BD57,
+    0x0000BD58, 0x0000BD59, 0x0000BD5A, 0x0000BD5B, 0x0000BD5C, 0x0000BD5D, 0x0000BD5E, 0x0000BD5F,
+    0x00000BD6, 0x0000BD61, 0x0000BD62, 0x0000BD63, 0x0000BD64, 0x0000BD65, 0x00200BD7, 0x0000BD67,
+    0x0000BD68, 0x0000BD69, 0x0000BD6A, 0x0000BD6B, 0x0000BD6C, 0x0000BD6D, 0x0000BD6E, 0x0000BD6F,
+    0x00000BD7, 0x0000BD71, 0x0000BD72, 0x0000BD73, 0x0000BD74, 0x0000BD75, 0x0000BD76, 0x00400BD8,
+    0x0000BD78, 0x0000BD79, 0x0000BD7A, 0x0000BD7B, 0x0000BD7C, 0x0000BD7D, 0x0000BD7E, 0x0000BD7F,
+    0x00000BD8, 0x0000BD81, 0x0000BD82, 0x0000BD83, 0x0000BD84, 0x0000BD85, 0x0000BD86, 0x0000BD87,
+    0x00800BD9, 0x0000BD89, 0x0000BD8A, 0x0000BD8B, 0x0000BD8C, 0x0000BD8D, 0x0000BD8E, 0x0000BD8F,
+    0x00000BD9, 0x0000BD91, 0x0000BD92, 0x0000BD93, 0x0000BD94, 0x0000BD95, 0x0000BD96, 0x0000BD97,
+    0x0000BD98, 0x01000BDA, 0x0000BD9A, 0x0000BD9B, 0x0000BD9C, 0x0000BD9D, 0x0000BD9E, 0x0000BD9F,
+    0x00000BDA, 0x0000BDA1, 0x0000BDA2, 0x0000BDA3, 0x0000BDA4, 0x0000BDA5, 0x0000BDA6, 0x0000BDA7,
+    0x0000BDA8, 0x0000BDA9, 0x82000BDB, 0x0000BDAB, 0x0000BDAC, 0x0000BDAD, 0x0000BDAE, 0x0000BDAF,
+    0x00000BDB, 0x0000BDB1, 0x0000BDB2, 0x0000BDB3, 0x0000BDB4, 0x0000BDB5, 0x0000BDB6, 0x0000BDB7,
+    0x0000BDB8, 0x0000BDB9, 0x0000BDBA, 0x04000BDC, 0x0000BDBC, 0x0000BDBD, 0x0000BDBE, 0x0000BDBF,
+    0x00000BDC, 0x0000BDC1, 0x0000BDC2, 0x0000BDC3, 0x0000BDC4, 0x0000BDC5, 0x0000BDC6, 0x0000BDC7,
+    0x0000BDC8, 0x0000BDC9, 0x0000BDCA, 0x0000BDCB, 0x08000BDD, 0x0000BDCD, 0x0000BDCE, 0x0000BDCF,
+    0x100000BE, 0x10000BE1, 0x10000BE2, 0x10000BE3, 0x10000BE4, 0x10000BE5, 0x10000BE6, 0x10000BE7,
+    0x10000BE8, 0x10000BE9, 0x10000BEA, 0x10000BEB, 0x10000BEC, 0x10000BDE, 0x10000BEE, 0x10000BEF,
+    0x00000BDE, 0x0000BDE1, 0x0000BDE2, 0x0000BDE3, 0x0000BDE4, 0x0000BDE5, 0x0000BDE6, 0x0000BDE7,
+    0x0000BDE8, 0x0000BDE9, 0x0000BDEA, 0x0000BDEB, 0x0000BDEC, 0x0000BDED, 0x20000BDF, 0x0000BDEF,
+    0x00000BDF, 0x0000BDF1, 0x0000BDF2, 0x0000BDF3, 0x0000BDF4, 0x0000BDF5, 0x0000BDF6, 0x0000BDF7,
+    0x0000BDF8, 0x0000BDF9, 0x0000BDFA, 0x0000BDFB, 0x0000BDFC, 0x0000BDFD, 0x0000BDFE, 0x0000BDFF,
+    0x000000BE, 0x00000BE1, 0x00000BE2, 0x00000BE3, 0x00000BE4, 0x00000BE5, 0x00000BE6, 0x00000BE7,
+    0x00000BE8, 0x00000BE9, 0x00000BEA, 0x00000BEB, 0x00000BEC, 0x00000BED, 0x200000BF, 0x00000BEF,
+    0x00000BE1, 0x00010BE2, 0x0000BE12, 0x0000BE13, 0x0000BE14, 0x0000BE15, 0x0000BE16, 0x0000BE17,
+    0x0000BE18, 0x0000BE19, 0x0000BE1A, 0x0000BE1B, 0x0000BE1C, 0x0000BE1D, 0x0000BE1E, 0x0000BE1F,
+    0x00000BE2, 0x0000BE21, 0x00020BE3, 0x0000BE23, 0x0000BE24, 0x0000BE25, 0x0000BE26, 0x0000BE27,
+    0x0000BE28, 0x0000BE29, 0x0000BE2A, 0x0000BE2B, 0x0000BE2C, 0x0000BE2D, 0x0000BE2E, 0x0000BE2F,
+    0x00000BE3, 0x0000BE31, 0x0000BE32, 0x00040BE4, 0x0000BE34, 0x0000BE35, 0x0000BE36, 0x0000BE37,
+    0x0000BE38, 0x0000BE39, 0x0000BE3A, 0x0000BE3B, 0x0000BE3C, 0x0000BE3D, 0x0000BE3E, 0x0000BE3F,
+    0x00000BE4, 0x0000BE41, 0x0000BE42, 0x0000BE43, 0x00080BE5, 0x0000BE45, 0x0000BE46, 0x0000BE47,
+    0x0000BE48, 0x0000BE49, 0x0000BE4A, 0x0000BE4B, 0x0000BE4C, 0x0000BE4D, 0x0000BE4E, 0x0000BE4F,
+    0x00000BE5, 0x0000BE51, 0x0000BE52, 0x0000BE53, 0x0000BE54, 0x00100BE6, 0x0000BE56, 0x0000BE57,
+    0x0000BE58, 0x0000BE59, 0x0000BE5A, 0x0000BE5B, 0x0000BE5C, 0x0000BE5D, 0x0000BE5E, 0x0000BE5F,
+    0x00000BE6, 0x0000BE61, 0x0000BE62, 0x0000BE63, 0x0000BE64, 0x0000BE65, 0x00200BE7, 0x0000BE67,
+    0x0000BE68, 0x0000BE69, 0x0000BE6A, 0x0000BE6B, 0x0000BE6C, 0x0000BE6D, 0x0000BE6E, 0x0000BE6F,
+    0x00000BE7, 0x0000BE71, 0x0000BE72, 0x0000BE73, 0x0000BE74, 0x0000BE75, 0x0000BE76, 0x00400BE8,
+    0x0000BE78, 0x0000BE79, 0x0000BE7A, 0x0000BE7B, 0x0000BE7C, 0x0000BE7D, 0x0000BE7E, 0x0000BE7F,
+    0x00000BE8, 0x0000BE81, 0x0000BE82, 0x0000BE83, 0x0000BE84, 0x0000BE85, 0x0000BE86, 0x0000BE87,
+    0x00800BE9, 0x0000BE89, 0x0000BE8A, 0x0000BE8B, 0x0000BE8C, 0x0000BE8D, 0x0000BE8E, 0x0000BE8F,
+    0x00000BE9, 0x0000BE91, 0x0000BE92, 0x0000BE93, 0x0000BE94, 0x0000BE95, 0x0000BE96, 0x0000BE97,
+    0x0000BE98, 0x01000BEA, 0x0000BE9A, 0x0000BE9B, 0x0000BE9C, 0x0000BE9D, 0x0000BE9E, 0x0000BE9F,
+    0x00000BEA, 0x0000BEA1, 0x0000BEA2, 0x0000BEA3, 0x0000BEA4, 0x0000BEA5, 0x0000BEA6, 0x0000BEA7,
+    0x0000BEA8, 0x0000BEA9, 0x82000BEB, 0x0000BEAB, 0x0000BEAC, 0x0000BEAD, 0x0000BEAE, 0x0000BEAF,
+    0x00000BEB, 0x0000BEB1, 0x0000BEB2, 0x0000BEB3, 0x0000BEB4, 0x0000BEB5, 0x0000BEB6, 0x0000BEB7,
+    0x0000BEB8, 0x0000BEB9, 0x0000BEBA, 0x04000BEC, 0x0000BEBC, 0x0000BEBD, 0x0000BEBE, 0x0000BEBF,
+    0x00000BEC, 0x0000BEC1, 0x0000BEC2, 0x0000BEC3, 0x0000BEC4, 0x0000BEC5, 0x0000BEC6, 0x0000BEC7,
+    0x0000BEC8, 0x0000BEC9, 0x0000BECA, 0x0000BECB, 0x08000BED, 0x0000BECD, 0x0000BECE, 0x0000BECF,
+    0x00000BED, 0x0000BED1, 0x0000BED2, 0x0000BED3, 0x0000BED4, 0x0000BED5, 0x0000BED6, 0x0000BED7,
+    0x0000BED8, 0x0000BED9, 0x0000BEDA, 0x0000BEDB, 0x0000BEDC, 0x10000BEE, 0x0000BEDE, 0x0000BEDF,
+    0x200000BF, 0x20000BF1, 0x20000BF2, 0x20000BF3, 0x20000BF4, 0x20000BF5, 0x20000BF6, 0x20000BF7,
+    0x20000BF8, 0x20000BF9, 0x20000BFA, 0x20000BFB, 0x20000BFC, 0x20000BFD, 0x20000BEF, 0x20000BFF,
+    0x00000BEF, 0x0000BEF1, 0x0000BEF2, 0x0000BEF3, 0x0000BEF4, 0x0000BEF5, 0x0000BEF6, 0x0000BEF7,
+    0x0000BEF8, 0x0000BEF9, 0x0000BEFA, 0x0000BEFB, 0x0000BEFC, 0x0000BEFD, 0x0000BEFE, 0x0000BEFF,
+    0x000000BF, 0x00000BF1, 0x00000BF2, 0x00000BF3, 0x00000BF4, 0x00000BF5, 0x00000BF6, 0x00000BF7,
+    0x00000BF8, 0x00000BF9, 0x00000BFA, 0x00000BFB, 0x00000BFC, 0x00000BFD, 0x00000BFE, 0x00000BFF,
+    0x00000BF1, 0x00010BF2, 0x0000BF12, 0x0000BF13, 0x0000BF14, 0x0000BF15, 0x0000BF16, 0x0000BF17,
+    0x0000BF18, 0x0000BF19, 0x0000BF1A, 0x0000BF1B, 0x0000BF1C, 0x0000BF1D, 0x0000BF1E, 0x0000BF1F,
+    0x00000BF2, 0x0000BF21, 0x00020BF3, 0x0000BF23, 0x0000BF24, 0x0000BF25, 0x0000BF26, 0x0000BF27,
+    0x0000BF28, 0x0000BF29, 0x0000BF2A, 0x0000BF2B, 0x0000BF2C, 0x0000BF2D, 0x0000BF2E, 0x0000BF2F,
+    0x00000BF3, 0x0000BF31, 0x0000BF32, 0x00040BF4, 0x0000BF34, 0x0000BF35, 0x0000BF36, 0x0000BF37,
+    0x0000BF38, 0x0000BF39, 0x0000BF3A, 0x0000BF3B, 0x0000BF3C, 0x0000BF3D, 0x0000BF3E, 0x0000BF3F,
+    0x00000BF4, 0x0000BF41, 0x0000BF42, 0x0000BF43, 0x00080BF5, 0x0000BF45, 0x0000BF46, 0x0000BF47,
+    0x0000BF48, 0x0000BF49, 0x0000BF4A, 0x0000BF4B, 0x0000BF4C, 0x0000BF4D, 0x0000BF4E, 0x0000BF4F,
+    0x00000BF5, 0x0000BF51, 0x0000BF52, 0x0000BF53, 0x0000BF54, 0x00100BF6, 0x0000BF56, 0x0000BF57,
+    0x0000BF58, 0x0000BF59, 0x0000BF5A, 0x0000BF5B, 0x0000BF5C, 0x0000BF5D, 0x0000BF5E, 0x0000BF5F,
+    0x00000BF6, 0x0000BF61, 0x0000BF62, 0x0000BF63, 0x0000BF64, 0x0000BF65, 0x00200BF7, 0x0000BF67,
+    0x0000BF68, 0x0000BF69, 0x0000BF6A, 0x0000BF6B, 0x0000BF6C, 0x0000BF6D, 0x0000BF6E, 0x0000BF6F,
+    0x00000BF7, 0x0000BF71, 0x0000BF72, 0x0000BF73, 0x0000BF74, 0x0000BF75, 0x0000BF76, 0x00400BF8,
+    0x0000BF78, 0x0000BF79, 0x0000BF7A, 0x0000BF7B, 0x0000BF7C, 0x0000BF7D, 0x0000BF7E, 0x0000BF7F,
+    0x00000BF8, 0x0000BF81, 0x0000BF82, 0x0000BF83, 0x0000BF84, 0x0000BF85, 0x0000BF86, 0x0000BF87,
+    0x00800BF9, 0x0000BF89, 0x0000BF8A, 0x0000BF8B, 0x0000BF8C, 0x0000BF8D, 0x0000BF8E, 0x0000BF8F,
+    0x00000BF9, 0x0000BF91, 0x0000BF92, 0x0000BF93, 0x0000BF94, 0x0000BF95, 0x0000BF96, 0x0000BF97,
+    0x0000BF98, 0x01000BFA, 0x0000BF9A, 0x0000BF9B, 0x0000BF9C, 0x0000BF9D, 0x0000BF9E, 0x0000BF9F,
+    0x00000BFA, 0x0000BFA1, 0x0000BFA2, 0x0000BFA3, 0x0000BFA4, 0x0000BFA5, 0x0000BFA6, 0x0000BFA7,
+    0x0000BFA8, 0x0000BFA9, 0x82000BFB, 0x0000BFAB, 0x0000BFAC, 0x0000BFAD, 0x0000BFAE, 0x0000BFAF,
+    0x00000BFB, 0x0000BFB1, 0x0000BFB2, 0x0000BFB3, 0x0000BFB4, 0x0000BFB5, 0x0000BFB6, 0x0000BFB7,
+    0x0000BFB8, 0x0000BFB9, 0x0000BFBA, 0x04000BFC, 0x0000BFBC, 0x0000BFBD, 0x0000BFBE, 0x0000BFBF,
+    0x00000BFC, 0x0000BFC1, 0x0000BFC2, 0x0000BFC3, 0x0000BFC4, 0x0000BFC5, 0x0000BFC6, 0x0000BFC7,
+    0x0000BFC8, 0x0000BFC9, 0x0000BFCA, 0x0000BFCB, 0x08000BFD, 0x0000BFCD, 0x0000BFCE, 0x0000BFCF,
+    0x00000BFD, 0x0000BFD1, 0x0000BFD2, 0x0000BFD3, 0x0000BFD4, 0x0000BFD5, 0x0000BFD6, 0x0000BFD7,
+    0x0000BFD8, 0x0000BFD9, 0x0000BFDA, 0x0000BFDB, 0x0000BFDC, 0x10000BFE, 0x0000BFDE, 0x0000BFDF,
+    0x00000BFE, 0x0000BFE1, 0x0000BFE2, 0x0000BFE3, 0x0000BFE4, 0x0000BFE5, 0x0000BFE6, 0x0000BFE7,
+    0x0000BFE8, 0x0000BFE9, 0x0000BFEA, 0x0000BFEB, 0x0000BFEC, 0x0000BFED, 0x20000BFF, 0x0000BFEF,
+    0x00000BFF, 0x0000BFF1, 0x0000BFF2, 0x0000BFF3, 0x0000BFF4, 0x0000BFF5, 0x0000BFF6, 0x0000BFF7,
+    0x0000BFF8, 0x0000BFF9, 0x0000BFFA, 0x0000BFFB, 0x0000BFFC, 0x0000BFFD, 0x0000BFFE, 0x0000BFFF,
+    0x0000000C, 0x000000C1, 0x000000C2, 0x000000C3, 0x000000C4, 0x000000C5, 0x000000C6, 0x000000C7,
+    0x000000C8, 0x000000C9, 0x000000CA, 0x000000CB, 0x0800000D, 0x000000CD, 0x000000CE, 0x000000CF,
+    0x000000C1, 0x000100C2, 0x00000C12, 0x00000C13, 0x00000C14, 0x00000C15, 0x00000C16, 0x00000C17,
+    0x00000C18, 0x00000C19, 0x00000C1A, 0x00000C1B, 0x00000C1C, 0x00000C1D, 0x00000C1E, 0x00000C1F,
+    0x000000C2, 0x00000C21, 0x000200C3, 0x00000C23, 0x00000C24, 0x00000C25, 0x00000C26, 0x00000C27,
+    0x00000C28, 0x00000C29, 0x00000C2A, 0x00000C2B, 0x00000C2C, 0x00000C2D, 0x00000C2E, 0x00000C2F,
+    0x000000C3, 0x00000C31, 0x00000C32, 0x000400C4, 0x00000C34, 0x00000C35, 0x00000C36, 0x00000C37,
+    0x00000C38, 0x00000C39, 0x00000C3A, 0x00000C3B, 0x00000C3C, 0x00000C3D, 0x00000C3E, 0x00000C3F,
+    0x000000C4, 0x00000C41, 0x00000C42, 0x00000C43, 0x000800C5, 0x00000C45, 0x00000C46, 0x00000C47,
+    0x00000C48, 0x00000C49, 0x00000C4A, 0x00000C4B, 0x00000C4C, 0x00000C4D, 0x00000C4E, 0x00000C4F,
+    0x000000C5, 0x00000C51, 0x00000C52, 0x00000C53, 0x00000C54, 0x001000C6, 0x00000C56, 0x00000C57,
+    0x00000C58, 0x00000C59, 0x00000C5A, 0x00000C5B, 0x00000C5C, 0x00000C5D, 0x00000C5E, 0x00000C5F,
+    0x000000C6, 0x00000C61, 0x00000C62, 0x00000C63, 0x00000C64, 0x00000C65, 0x002000C7, 0x00000C67,
+    0x00000C68, 0x00000C69, 0x00000C6A, 0x00000C6B, 0x00000C6C, 0x00000C6D, 0x00000C6E, 0x00000C6F,
+    0x000000C7, 0x00000C71, 0x00000C72, 0x00000C73, 0x00000C74, 0x00000C75, 0x00000C76, 0x004000C8,
+    0x00000C78, 0x00000C79, 0x00000C7A, 0x00000C7B, 0x00000C7C, 0x00000C7D, 0x00000C7E, 0x00000C7F,
+    0x000000C8, 0x00000C81, 0x00000C82, 0x00000C83, 0x00000C84, 0x00000C85, 0x00000C86, 0x00000C87,
+    0x008000C9, 0x00000C89, 0x00000C8A, 0x00000C8B, 0x00000C8C, 0x00000C8D, 0x00000C8E, 0x00000C8F,
+    0x000000C9, 0x00000C91, 0x00000C92, 0x00000C93, 0x00000C94, 0x00000C95, 0x00000C96, 0x00000C97,
+    0x00000C98, 0x010000CA, 0x00000C9A, 0x00000C9B, 0x00000C9C, 0x00000C9D, 0x00000C9E, 0x00000C9F,
+    0x000000CA, 0x00000CA1, 0x00000CA2, 0x00000CA3, 0x00000CA4, 0x00000CA5, 0x00000CA6, 0x00000CA7,
+    0x00000CA8, 0x00000CA9, 0x820000CB, 0x00000CAB, 0x00000CAC, 0x00000CAD, 0x00000CAE, 0x00000CAF,
+    0x000000CB, 0x00000CB1, 0x00000CB2, 0x00000CB3, 0x00000CB4, 0x00000CB5, 0x00000CB6, 0x00000CB7,
+    0x00000CB8, 0x00000CB9, 0x00000CBA, 0x040000CC, 0x00000CBC, 0x00000CBD, 0x00000CBE, 0x00000CBF,
+    0x0800000D, 0x080000D1, 0x080000D2, 0x080000D3, 0x080000D4, 0x080000D5, 0x080000D6, 0x080000D7,
+    0x080000D8, 0x080000D9, 0x080000DA, 0x080000DB, 0x080000CD, 0x080000DD, 0x080000DE, 0x080000DF,
+    0x000000CD, 0x00000CD1, 0x00000CD2, 0x00000CD3, 0x00000CD4, 0x00000CD5, 0x00000CD6, 0x00000CD7,
+    0x00000CD8, 0x00000CD9, 0x00000CDA, 0x00000CDB, 0x00000CDC, 0x100000CE, 0x00000CDE, 0x00000CDF,
+    0x000000CE, 0x00000CE1, 0x00000CE2, 0x00000CE3, 0x00000CE4, 0x00000CE5, 0x00000CE6, 0x00000CE7,
+    0x00000CE8, 0x00000CE9, 0x00000CEA, 0x00000CEB, 0x00000CEC, 0x00000CED, 0x200000CF, 0x00000CEF,
+    0x000000CF, 0x00000CF1, 0x00000CF2, 0x00000CF3, 0x00000CF4, 0x00000CF5, 0x00000CF6, 0x00000CF7,
+    0x00000CF8, 0x00000CF9, 0x00000CFA, 0x00000CFB, 0x00000CFC, 0x00000CFD, 0x00000CFE, 0x00000CFF,
+    0x000000C1, 0x000100C2, 0x00000C12, 0x00000C13, 0x00000C14, 0x00000C15, 0x00000C16, 0x00000C17,
+    0x00000C18, 0x00000C19, 0x00000C1A, 0x00000C1B, 0x00000C1C, 0x00000C1D, 0x00000C1E, 0x00000C1F,
+    0x000100C2, 0x00010C12, 0x00010C22, 0x00010C23, 0x00010C24, 0x00010C25, 0x00010C26, 0x00010C27,
+    0x00010C28, 0x00010C29, 0x00010C2A, 0x00010C2B, 0x00010C2C, 0x00010C2D, 0x00010C2E, 0x00010C2F,
+    0x00000C12, 0x0000C121, 0x00020C13, 0x0000C123, 0x0000C124, 0x0000C125, 0x0000C126, 0x0000C127,
+    0x0000C128, 0x0000C129, 0x0000C12A, 0x0000C12B, 0x0000C12C, 0x0000C12D, 0x0000C12E, 0x0000C12F,
+    0x00000C13, 0x0000C131, 0x0000C132, 0x00040C14, 0x0000C134, 0x0000C135, 0x0000C136, 0x0000C137,
+    0x0000C138, 0x0000C139, 0x0000C13A, 0x0000C13B, 0x0000C13C, 0x0000C13D, 0x0000C13E, 0x0000C13F,
+    0x00000C14, 0x0000C141, 0x0000C142, 0x0000C143, 0x00080C15, 0x0000C145, 0x0000C146, 0x0000C147,
+    0x0000C148, 0x0000C149, 0x0000C14A, 0x0000C14B, 0x0000C14C, 0x0000C14D, 0x0000C14E, 0x0000C14F,
+    0x00000C15, 0x0000C151, 0x0000C152, 0x0000C153, 0x0000C154, 0x00100C16, 0x0000C156, 0x0000C157,
+    0x0000C158, 0x0000C159, 0x0000C15A, 0x0000C15B, 0x0000C15C, 0x0000C15D, 0x0000C15E, 0x0000C15F,
+    0x00000C16, 0x0000C161, 0x0000C162, 0x0000C163, 0x0000C164, 0x0000C165, 0x00200C17, 0x0000C167,
+    0x0000C168, 0x0000C169, 0x0000C16A, 0x0000C16B, 0x0000C16C, 0x0000C16D, 0x0000C16E, 0x0000C16F,
+    0x00000C17, 0x0000C171, 0x0000C172, 0x0000C173, 0x0000C174, 0x0000C175, 0x0000C176, 0x00400C18,
+    0x0000C178, 0x0000C179, 0x0000C17A, 0x0000C17B, 0x0000C17C, 0x0000C17D, 0x0000C17E, 0x0000C17F,
+    0x00000C18, 0x0000C181, 0x0000C182, 0x0000C183, 0x0000C184, 0x0000C185, 0x0000C186, 0x0000C187,
+    0x00800C19, 0x0000C189, 0x0000C18A, 0x0000C18B, 0x0000C18C, 0x0000C18D, 0x0000C18E, 0x0000C18F,
+    0x00000C19, 0x0000C191, 0x0000C192, 0x0000C193, 0x0000C194, 0x0000C195, 0x0000C196, 0x0000C197,
+    0x0000C198, 0x01000C1A, 0x0000C19A, 0x0000C19B, 0x0000C19C, 0x0000C19D, 0x0000C19E, 0x0000C19F,
+    0x00000C1A, 0x0000C1A1, 0x0000C1A2, 0x0000C1A3, 0x0000C1A4, 0x0000C1A5, 0x0000C1A6, 0x0000C1A7,
+    0x0000C1A8, 0x0000C1A9, 0x82000C1B, 0x0000C1AB, 0x0000C1AC, 0x0000C1AD, 0x0000C1AE, 0x0000C1AF,
+    0x00000C1B, 0x0000C1B1, 0x0000C1B2, 0x0000C1B3, 0x0000C1B4, 0x0000C1B5, 0x0000C1B6, 0x0000C1B7,
+    0x0000C1B8, 0x0000C1B9, 0x0000C1BA, 0x04000C1C, 0x0000C1BC, 0x0000C1BD, 0x0000C1BE, 0x0000C1BF,
+    0x00000C1C, 0x0000C1C1, 0x0000C1C2, 0x0000C1C3, 0x0000C1C4, 0x0000C1C5, 0x0000C1C6, 0x0000C1C7,
+    0x0000C1C8, 0x0000C1C9, 0x0000C1CA, 0x0000C1CB, 0x08000C1D, 0x0000C1CD, 0x0000C1CE, 0x0000C1CF,
+    0x00000C1D, 0x0000C1D1, 0x0000C1D2, 0x0000C1D3, 0x0000C1D4, 0x0000C1D5, 0x0000C1D6, 0x0000C1D7,
+    0x0000C1D8, 0x0000C1D9, 0x0000C1DA, 0x0000C1DB, 0x0000C1DC, 0x10000C1E, 0x0000C1DE, 0x0000C1DF,
+    0x00000C1E, 0x0000C1E1, 0x0000C1E2, 0x0000C1E3, 0x0000C1E4, 0x0000C1E5, 0x0000C1E6, 0x0000C1E7,
+    0x0000C1E8, 0x0000C1E9, 0x0000C1EA, 0x0000C1EB, 0x0000C1EC, 0x0000C1ED, 0x20000C1F, 0x0000C1EF,
+    0x00000C1F, 0x0000C1F1, 0x0000C1F2, 0x0000C1F3, 0x0000C1F4, 0x0000C1F5, 0x0000C1F6, 0x0000C1F7,
+    0x0000C1F8, 0x0000C1F9, 0x0000C1FA, 0x0000C1FB, 0x0000C1FC, 0x0000C1FD, 0x0000C1FE, 0x0000C1FF,
+    0x000000C2, 0x00000C21, 0x000200C3, 0x00000C23, 0x00000C24, 0x00000C25, 0x00000C26, 0x00000C27,
+    0x00000C28, 0x00000C29, 0x00000C2A, 0x00000C2B, 0x00000C2C, 0x00000C2D, 0x00000C2E, 0x00000C2F,
+    0x00000C21, 0x00010C22, 0x0000C212, 0x0000C213, 0x0000C214, 0x0000C215, 0x0000C216, 0x0000C217,
+    0x0000C218, 0x0000C219, 0x0000C21A, 0x0000C21B, 0x0000C21C, 0x0000C21D, 0x0000C21E, 0x0000C21F,
+    0x000200C3, 0x00020C31, 0x00020C23, 0x00020C33, 0x00020C34, 0x00020C35, 0x00020C36, 0x00020C37,
+    0x00020C38, 0x00020C39, 0x00020C3A, 0x00020C3B, 0x00020C3C, 0x00020C3D, 0x00020C3E, 0x00020C3F,
+    0x00000C23, 0x0000C231, 0x0000C232, 0x00040C24, 0x0000C234, 0x0000C235, 0x0000C236, 0x0000C237,
+    0x0000C238, 0x0000C239, 0x0000C23A, 0x0000C23B, 0x0000C23C, 0x0000C23D, 0x0000C23E, 0x0000C23F,
+    0x00000C24, 0x0000C241, 0x0000C242, 0x0000C243, 0x00080C25, 0x0000C245, 0x0000C246, 0x0000C247,
+    0x0000C248, 0x0000C249, 0x0000C24A, 0x0000C24B, 0x0000C24C, 0x0000C24D, 0x0000C24E, 0x0000C24F,
+    0x00000C25, 0x0000C251, 0x0000C252, 0x0000C253, 0x0000C254, 0x00100C26, 0x0000C256, 0x0000C257,
+    0x0000C258, 0x0000C259, 0x0000C25A, 0x0000C25B, 0x0000C25C, 0x0000C25D, 0x0000C25E, 0x0000C25F,
+    0x00000C26, 0x0000C261, 0x0000C262, 0x0000C263, 0x0000C264, 0x0000C265, 0x00200C27, 0x0000C267,
+    0x0000C268, 0x0000C269, 0x0000C26A, 0x0000C26B, 0x0000C26C, 0x0000C26D, 0x0000C26E, 0x0000C26F,
+    0x00000C27, 0x0000C271, 0x0000C272, 0x0000C273, 0x0000C274, 0x0000C275, 0x0000C276, 0x00400C28,
+    0x0000C278, 0x0000C279, 0x0000C27A, 0x0000C27B, 0x0000C27C, 0x0000C27D, 0x0000C27E, 0x0000C27F,
+    0x00000C28, 0x0000C281, 0x0000C282, 0x0000C283, 0x0000C284, 0x0000C285, 0x0000C286, 0x0000C287,
+    0x00800C29, 0x0000C289, 0x0000C28A, 0x0000C28B, 0x0000C28C, 0x0000C28D, 0x0000C28E, 0x0000C28F,
+    0x00000C29, 0x0000C291, 0x0000C292, 0x0000C293, 0x0000C294, 0x0000C295, 0x0000C296, 0x0000C297,
+    0x0000C298, 0x01000C2A, 0x0000C29A, 0x0000C29B, 0x0000C29C, 0x0000C29D, 0x0000C29E, 0x0000C29F,
+    0x00000C2A, 0x0000C2A1, 0x0000C2A2, 0x0000C2A3, 0x0000C2A4, 0x0000C2A5, 0x0000C2A6, 0x0000C2A7,
+    0x0000C2A8, 0x0000C2A9, 0x82000C2B, 0x0000C2AB, 0x0000C2AC, 0x0000C2AD, 0x0000C2AE, 0x0000C2AF,
+    0x00000C2B, 0x0000C2B1, 0x0000C2B2, 0x0000C2B3, 0x0000C2B4, 0x0000C2B5, 0x0000C2B6, 0x0000C2B7,
+    0x0000C2B8, 0x0000C2B9, 0x0000C2BA, 0x04000C2C, 0x0000C2BC, 0x0000C2BD, 0x0000C2BE, 0x0000C2BF,
+    0x00000C2C, 0x0000C2C1, 0x0000C2C2, 0x0000C2C3, 0x0000C2C4, 0x0000C2C5, 0x0000C2C6, 0x0000C2C7,
+    0x0000C2C8, 0x0000C2C9, 0x0000C2CA, 0x0000C2CB, 0x08000C2D, 0x0000C2CD, 0x0000C2CE, 0x0000C2CF,
+    0x00000C2D, 0x0000C2D1, 0x0000C2D2, 0x0000C2D3, 0x0000C2D4, 0x0000C2D5, 0x0000C2D6, 0x0000C2D7,
+    0x0000C2D8, 0x0000C2D9, 0x0000C2DA, 0x0000C2DB, 0x0000C2DC, 0x10000C2E, 0x0000C2DE, 0x0000C2DF,
+    0x00000C2E, 0x0000C2E1, 0x0000C2E2, 0x0000C2E3, 0x0000C2E4, 0x0000C2E5, 0x0000C2E6, 0x0000C2E7,
+    0x0000C2E8, 0x0000C2E9, 0x0000C2EA, 0x0000C2EB, 0x0000C2EC, 0x0000C2ED, 0x20000C2F, 0x0000C2EF,
+    0x00000C2F, 0x0000C2F1, 0x0000C2F2, 0x0000C2F3, 0x0000C2F4, 0x0000C2F5, 0x0000C2F6, 0x0000C2F7,
+    0x0000C2F8, 0x0000C2F9, 0x0000C2FA, 0x0000C2FB, 0x0000C2FC, 0x0000C2FD, 0x0000C2FE, 0x0000C2FF,
+    0x000000C3, 0x00000C31, 0x00000C32, 0x000400C4, 0x00000C34, 0x00000C35, 0x00000C36, 0x00000C37,
+    0x00000C38, 0x00000C39, 0x00000C3A, 0x00000C3B, 0x00000C3C, 0x00000C3D, 0x00000C3E, 0x00000C3F,
+    0x00000C31, 0x00010C32, 0x0000C312, 0x0000C313, 0x0000C314, 0x0000C315, 0x0000C316, 0x0000C317,
+    0x0000C318, 0x0000C319, 0x0000C31A, 0x0000C31B, 0x0000C31C, 0x0000C31D, 0x0000C31E, 0x0000C31F,
+    0x00000C32, 0x0000C321, 0x00020C33, 0x0000C323, 0x0000C324, 0x0000C325, 0x0000C326, 0x0000C327,
+    0x0000C328, 0x0000C329, 0x0000C32A, 0x0000C32B, 0x0000C32C, 0x0000C32D, 0x0000C32E, 0x0000C32F,
+    0x000400C4, 0x00040C41, 0x00040C42, 0x00040C34, 0x00040C44, 0x00040C45, 0x00040C46, 0x00040C47,
+    0x00040C48, 0x00040C49, 0x00040C4A, 0x00040C4B, 0x00040C4C, 0x00040C4D, 0x00040C4E, 0x00040C4F,
+    0x00000C34, 0x0000C341, 0x0000C342, 0x0000C343, 0x00080C35, 0x0000C345, 0x0000C346, 0x0000C347,
+    0x0000C348, 0x0000C349, 0x0000C34A, 0x0000C34B, 0x0000C34C, 0x0000C34D, 0x0000C34E, 0x0000C34F,
+    0x00000C35, 0x0000C351, 0x0000C352, 0x0000C353, 0x0000C354, 0x00100C36, 0x0000C356, 0x0000C357,
+    0x0000C358, 0x0000C359, 0x0000C35A, 0x0000C35B, 0x0000C35C, 0x0000C35D, 0x0000C35E, 0x0000C35F,
+    0x00000C36, 0x0000C361, 0x0000C362, 0x0000C363, 0x0000C364, 0x0000C365, 0x00200C37, 0x0000C367,
+    0x0000C368, 0x0000C369, 0x0000C36A, 0x0000C36B, 0x0000C36C, 0x0000C36D, 0x0000C36E, 0x0000C36F,
+    0x00000C37, 0x0000C371, 0x0000C372, 0x0000C373, 0x0000C374, 0x0000C375, 0x0000C376, 0x00400C38,
+    0x0000C378, 0x0000C379, 0x0000C37A, 0x0000C37B, 0x0000C37C, 0x0000C37D, 0x0000C37E, 0x0000C37F,
+    0x00000C38, 0x0000C381, 0x0000C382, 0x0000C383, 0x0000C384, 0x0000C385, 0x0000C386, 0x0000C387,
+    0x00800C39, 0x0000C389, 0x0000C38A, 0x0000C38B, 0x0000C38C, 0x0000C38D, 0x0000C38E, 0x0000C38F,
+    0x00000C39, 0x0000C391, 0x0000C392, 0x0000C393, 0x0000C394, 0x0000C395, 0x0000C396, 0x0000C397,
+    0x0000C398, 0x01000C3A, 0x0000C39A, 0x0000C39B, 0x0000C39C, 0x0000C39D, 0x0000C39E, 0x0000C39F,
+    0x00000C3A, 0x0000C3A1, 0x0000C3A2, 0x0000C3A3, 0x0000C3A4, 0x0000C3A5, 0x0000C3A6, 0x0000C3A7,
+    0x0000C3A8, 0x0000C3A9, 0x82000C3B, 0x0000C3AB, 0x0000C3AC, 0x0000C3AD, 0x0000C3AE, 0x0000C3AF,
+    0x00000C3B, 0x0000C3B1, 0x0000C3B2, 0x0000C3B3, 0x0000C3B4, 0x0000C3B5, 0x0000C3B6, 0x0000C3B7,
+    0x0000C3B8, 0x0000C3B9, 0x0000C3BA, 0x04000C3C, 0x0000C3BC, 0x0000C3BD, 0x0000C3BE, 0x0000C3BF,
+    0x00000C3C, 0x0000C3C1, 0x0000C3C2, 0x0000C3C3, 0x0000C3C4, 0x0000C3C5, 0x0000C3C6, 0x0000C3C7,
+    0x0000C3C8, 0x0000C3C9, 0x0000C3CA, 0x0000C3CB, 0x08000C3D, 0x0000C3CD, 0x0000C3CE, 0x0000C3CF,
+    0x00000C3D, 0x0000C3D1, 0x0000C3D2, 0x0000C3D3, 0x0000C3D4, 0x0000C3D5, 0x0000C3D6, 0x0000C3D7,
+    0x0000C3D8, 0x0000C3D9, 0x0000C3DA, 0x0000C3DB, 0x0000C3DC, 0x10000C3E, 0x0000C3DE, 0x0000C3DF,
+    0x00000C3E, 0x0000C3E1, 0x0000C3E2, 0x0000C3E3, 0x0000C3E4, 0x0000C3E5, 0x0000C3E6, 0x0000C3E7,
+    0x0000C3E8, 0x0000C3E9, 0x0000C3EA, 0x0000C3EB, 0x0000C3EC, 0x0000C3ED, 0x20000C3F, 0x0000C3EF,
+    0x00000C3F, 0x0000C3F1, 0x0000C3F2, 0x0000C3F3, 0x0000C3F4, 0x0000C3F5, 0x0000C3F6, 0x0000C3F7,
+    0x0000C3F8, 0x0000C3F9, 0x0000C3FA, 0x0000C3FB, 0x0000C3FC, 0x0000C3FD, 0x0000C3FE, 0x0000C3FF,
+    0x000000C4, 0x00000C41, 0x00000C42, 0x00000C43, 0x000800C5, 0x00000C45, 0x00000C46, 0x00000C47,
+    0x00000C48, 0x00000C49, 0x00000C4A, 0x00000C4B, 0x00000C4C, 0x00000C4D, 0x00000C4E, 0x00000C4F,
+    0x00000C41, 0x00010C42, 0x0000C412, 0x0000C413, 0x0000C414, 0x0000C415, 0x0000C416, 0x0000C417,
+    0x0000C418, 0x0000C419, 0x0000C41A, 0x0000C41B, 0x0000C41C, 0x0000C41D, 0x0000C41E, 0x0000C41F,
+    0x00000C42, 0x0000C421, 0x00020C43, 0x0000C423, 0x0000C424, 0x0000C425, 0x0000C426, 0x0000C427,
+    0x0000C428, 0x0000C429, 0x0000C42A, 0x0000C42B, 0x0000C42C, 0x0000C42D, 0x0000C42E, 0x0000C42F,
+    0x00000C43, 0x0000C431, 0x0000C432, 0x00040C44, 0x0000C434, 0x0000C435, 0x0000C436, 0x0000C437,
+    0x0000C438, 0x0000C439, 0x0000C43A, 0x0000C43B, 0x0000C43C, 0x0000C43D, 0x0000C43E, 0x0000C43F,
+    0x000800C5, 0x00080C51, 0x00080C52, 0x00080C53, 0x00080C45, 0x00080C55, 0x00080C56, 0x00080C57,
+    0x00080C58, 0x00080C59, 0x00080C5A, 0x00080C5B, 0x00080C5C, 0x00080C5D, 0x00080C5E, 0x00080C5F,
+    0x00000C45, 0x0000C451, 0x0000C452, 0x0000C453, 0x0000C454, 0x00100C46, 0x0000C456, 0x0000C457,
+    0x0000C458, 0x0000C459, 0x0000C45A, 0x0000C45B, 0x0000C45C, 0x0000C45D, 0x0000C45E, 0x0000C45F,
+    0x00000C46, 0x0000C461, 0x0000C462, 0x0000C463, 0x0000C464, 0x0000C465, 0x00200C47, 0x0000C467,
+    0x0000C468, 0x0000C469, 0x0000C46A, 0x0000C46B, 0x0000C46C, 0x0000C46D, 0x0000C46E, 0x0000C46F,
+    0x00000C47, 0x0000C471, 0x0000C472, 0x0000C473, 0x0000C474, 0x0000C475, 0x0000C476, 0x00400C48,
+    0x0000C478, 0x0000C479, 0x0000C47A, 0x0000C47B, 0x0000C47C, 0x0000C47D, 0x0000C47E, 0x0000C47F,
+    0x00000C48, 0x0000C481, 0x0000C482, 0x0000C483, 0x0000C484, 0x0000C485, 0x0000C486, 0x0000C487,
+    0x00800C49, 0x0000C489, 0x0000C48A, 0x0000C48B, 0x0000C48C, 0x0000C48D, 0x0000C48E, 0x0000C48F,
+    0x00000C49, 0x0000C491, 0x0000C492, 0x0000C493, 0x0000C494, 0x0000C495, 0x0000C496, 0x0000C497,
+    0x0000C498, 0x01000C4A, 0x0000C49A, 0x0000C49B, 0x0000C49C, 0x0000C49D, 0x0000C49E, 0x0000C49F,
+    0x00000C4A, 0x0000C4A1, 0x0000C4A2, 0x0000C4A3, 0x0000C4A4, 0x0000C4A5, 0x0000C4A6, 0x0000C4A7,
+    0x0000C4A8, 0x0000C4A9, 0x82000C4B, 0x0000C4AB, 0x0000C4AC, 0x0000C4AD, 0x0000C4AE, 0x0000C4AF,
+    0x00000C4B, 0x0000C4B1, 0x0000C4B2, 0x0000C4B3, 0x0000C4B4, 0x0000C4B5, 0x0000C4B6, 0x0000C4B7,
+    0x0000C4B8, 0x0000C4B9, 0x0000C4BA, 0x04000C4C, 0x0000C4BC, 0x0000C4BD, 0x0000C4BE, 0x0000C4BF,
+    0x00000C4C, 0x0000C4C1, 0x0000C4C2, 0x0000C4C3, 0x0000C4C4, 0x0000C4C5, 0x0000C4C6, 0x0000C4C7,
+    0x0000C4C8, 0x0000C4C9, 0x0000C4CA, 0x0000C4CB, 0x08000C4D, 0x0000C4CD, 0x0000C4CE, 0x0000C4CF,
+    0x00000C4D, 0x0000C4D1, 0x0000C4D2, 0x0000C4D3, 0x0000C4D4, 0x0000C4D5, 0x0000C4D6, 0x0000C4D7,
+    0x0000C4D8, 0x0000C4D9, 0x0000C4DA, 0x0000C4DB, 0x0000C4DC, 0x10000C4E, 0x0000C4DE, 0x0000C4DF,
+    0x00000C4E, 0x0000C4E1, 0x0000C4E2, 0x0000C4E3, 0x0000C4E4, 0x0000C4E5, 0x0000C4E6, 0x0000C4E7,
+    0x0000C4E8, 0x0000C4E9, 0x0000C4EA, 0x0000C4EB, 0x0000C4EC, 0x0000C4ED, 0x20000C4F, 0x0000C4EF,
+    0x00000C4F, 0x0000C4F1, 0x0000C4F2, 0x0000C4F3, 0x0000C4F4, 0x0000C4F5, 0x0000C4F6, 0x0000C4F7,
+    0x0000C4F8, 0x0000C4F9, 0x0000C4FA, 0x0000C4FB, 0x0000C4FC, 0x0000C4FD, 0x0000C4FE, 0x0000C4FF,
+    0x000000C5, 0x00000C51, 0x00000C52, 0x00000C53, 0x00000C54, 0x001000C6, 0x00000C56, 0x00000C57,
+    0x00000C58, 0x00000C59, 0x00000C5A, 0x00000C5B, 0x00000C5C, 0x00000C5D, 0x00000C5E, 0x00000C5F,
+    0x00000C51, 0x00010C52, 0x0000C512, 0x0000C513, 0x0000C514, 0x0000C515, 0x0000C516, 0x0000C517,
+    0x0000C518, 0x0000C519, 0x0000C51A, 0x0000C51B, 0x0000C51C, 0x0000C51D, 0x0000C51E, 0x0000C51F,
+    0x00000C52, 0x0000C521, 0x00020C53, 0x0000C523, 0x0000C524, 0x0000C525, 0x0000C526, 0x0000C527,
+    0x0000C528, 0x0000C529, 0x0000C52A, 0x0000C52B, 0x0000C52C, 0x0000C52D, 0x0000C52E, 0x0000C52F,
+    0x00000C53, 0x0000C531, 0x0000C532, 0x00040C54, 0x0000C534, 0x0000C535, 0x0000C536, 0x0000C537,
+    0x0000C538, 0x0000C539, 0x0000C53A, 0x0000C53B, 0x0000C53C, 0x0000C53D, 0x0000C53E, 0x0000C53F,
+    0x00000C54, 0x0000C541, 0x0000C542, 0x0000C543, 0x00080C55, 0x0000C545, 0x0000C546, 0x0000C547,
+    0x0000C548, 0x0000C549, 0x0000C54A, 0x0000C54B, 0x0000C54C, 0x0000C54D, 0x0000C54E, 0x0000C54F,
+    0x001000C6, 0x00100C61, 0x00100C62, 0x00100C63, 0x00100C64, 0x00100C56, 0x00100C66, 0x00100C67,
+    0x00100C68, 0x00100C69, 0x00100C6A, 0x00100C6B, 0x00100C6C, 0x00100C6D, 0x00100C6E, 0x00100C6F,
+    0x00000C56, 0x0000C561, 0x0000C562, 0x0000C563, 0x0000C564, 0x0000C565, 0x00200C57, 0x0000C567,
+    0x0000C568, 0x0000C569, 0x0000C56A, 0x0000C56B, 0x0000C56C, 0x0000C56D, 0x0000C56E, 0x0000C56F,
+    0x00000C57, 0x0000C571, 0x0000C572, 0x0000C573, 0x0000C574, 0x0000C575, 0x0000C576, 0x00400C58,
+    0x0000C578, 0x0000C579, 0x0000C57A, 0x0000C57B, 0x0000C57C, 0x0000C57D, 0x0000C57E, 0x0000C57F,
+    0x00000C58, 0x0000C581, 0x0000C582, 0x0000C583, 0x0000C584, 0x0000C585, 0x0000C586, 0x0000C587,
+    0x00800C59, 0x0000C589, 0x0000C58A, 0x0000C58B, 0x0000C58C, 0x0000C58D, 0x0000C58E, 0x0000C58F,
+    0x00000C59, 0x0000C591, 0x0000C592, 0x0000C593, 0x0000C594, 0x0000C595, 0x0000C596, 0x0000C597,
+    0x0000C598, 0x01000C5A, 0x0000C59A, 0x0000C59B, 0x0000C59C, 0x0000C59D, 0x0000C59E, 0x0000C59F,
+    0x00000C5A, 0x0000C5A1, 0x0000C5A2, 0x0000C5A3, 0x0000C5A4, 0x0000C5A5, 0x0000C5A6, 0x0000C5A7,
+    0x0000C5A8, 0x0000C5A9, 0x82000C5B, 0x0000C5AB, 0x0000C5AC, 0x0000C5AD, 0x0000C5AE, 0x0000C5AF,
+    0x00000C5B, 0x0000C5B1, 0x0000C5B2, 0x0000C5B3, 0x0000C5B4, 0x0000C5B5, 0x0000C5B6, 0x0000C5B7,
+    0x0000C5B8, 0x0000C5B9, 0x0000C5BA, 0x04000C5C, 0x0000C5BC, 0x0000C5BD, 0x0000C5BE, 0x0000C5BF,
+    0x00000C5C, 0x0000C5C1, 0x0000C5C2, 0x0000C5C3, 0x0000C5C4, 0x0000C5C5, 0x0000C5C6, 0x0000C5C7,
+    0x0000C5C8, 0x0000C5C9, 0x0000C5CA, 0x0000C5CB, 0x08000C5D, 0x0000C5CD, 0x0000C5CE, 0x0000C5CF,
+    0x00000C5D, 0x0000C5D1, 0x0000C5D2, 0x0000C5D3, 0x0000C5D4, 0x0000C5D5, 0x0000C5D6, 0x0000C5D7,
+    0x0000C5D8, 0x0000C5D9, 0x0000C5DA, 0x0000C5DB, 0x0000C5DC, 0x10000C5E, 0x0000C5DE, 0x0000C5DF,
+    0x00000C5E, 0x0000C5E1, 0x0000C5E2, 0x0000C5E3, 0x0000C5E4, 0x0000C5E5, 0x0000C5E6, 0x0000C5E7,
+    0x0000C5E8, 0x0000C5E9, 0x0000C5EA, 0x0000C5EB, 0x0000C5EC, 0x0000C5ED, 0x20000C5F, 0x0000C5EF,
+    0x00000C5F, 0x0000C5F1, 0x0000C5F2, 0x0000C5F3, 0x0000C5F4, 0x0000C5F5, 0x0000C5F6, 0x0000C5F7,
+    0x0000C5F8, 0x0000C5F9, 0x0000C5FA, 0x0000C5FB, 0x0000C5FC, 0x0000C5FD, 0x0000C5FE, 0x0000C5FF,
+    0x000000C6, 0x00000C61, 0x00000C62, 0x00000C63, 0x00000C64, 0x00000C65, 0x002000C7, 0x00000C67,
+    0x00000C68, 0x00000C69, 0x00000C6A, 0x00000C6B, 0x00000C6C, 0x00000C6D, 0x00000C6E, 0x00000C6F,
+    0x00000C61, 0x00010C62, 0x0000C612, 0x0000C613, 0x0000C614, 0x0000C615, 0x0000C616, 0x0000C617,
+    0x0000C618, 0x0000C619, 0x0000C61A, 0x0000C61B, 0x0000C61C, 0x0000C61D, 0x0000C61E, 0x0000C61F,
+    0x00000C62, 0x0000C621, 0x00020C63, 0x0000C623, 0x0000C624, 0x0000C625, 0x0000C626, 0x0000C627,
+    0x0000C628, 0x0000C629, 0x0000C62A, 0x0000C62B, 0x0000C62C, 0x0000C62D, 0x0000C62E, 0x0000C62F,
+    0x00000C63, 0x0000C631, 0x0000C632, 0x00040C64, 0x0000C634, 0x0000C635, 0x0000C636, 0x0000C637,
+    0x0000C638, 0x0000C639, 0x0000C63A, 0x0000C63B, 0x0000C63C, 0x0000C63D, 0x0000C63E, 0x0000C63F,
+    0x00000C64, 0x0000C641, 0x0000C642, 0x0000C643, 0x00080C65, 0x0000C645, 0x0000C646, 0x0000C647,
+    0x0000C648, 0x0000C649, 0x0000C64A, 0x0000C64B, 0x0000C64C, 0x0000C64D, 0x0000C64E, 0x0000C64F,
+    0x00000C65, 0x0000C651, 0x0000C652, 0x0000C653, 0x0000C654, 0x00100C66, 0x0000C656, 0x0000C657,
+    0x0000C658, 0x0000C659, 0x0000C65A, 0x0000C65B, 0x0000C65C, 0x0000C65D, 0x0000C65E, 0x0000C65F,
+    0x002000C7, 0x00200C71, 0x00200C72, 0x00200C73, 0x00200C74, 0x00200C75, 0x00200C67, 0x00200C77,
+    0x00200C78, 0x00200C79, 0x00200C7A, 0x00200C7B, 0x00200C7C, 0x00200C7D, 0x00200C7E, 0x00200C7F,
+    0x00000C67, 0x0000C671, 0x0000C672, 0x0000C673, 0x0000C674, 0x0000C675, 0x0000C676, 0x00400C68,
+    0x0000C678, 0x0000C679, 0x0000C67A, 0x0000C67B, 0x0000C67C, 0x0000C67D, 0x0000C67E, 0x0000C67F,
+    0x00000C68, 0x0000C681, 0x0000C682, 0x0000C683, 0x0000C684, 0x0000C685, 0x0000C686, 0x0000C687,
+    0x00800C69, 0x0000C689, 0x0000C68A, 0x0000C68B, 0x0000C68C, 0x0000C68D, 0x0000C68E, 0x0000C68F,
+    0x00000C69, 0x0000C691, 0x0000C692, 0x0000C693, 0x0000C694, 0x0000C695, 0x0000C696, 0x0000C697,
+    0x0000C698, 0x01000C6A, 0x0000C69A, 0x0000C69B, 0x0000C69C, 0x0000C69D, 0x0000C69E, 0x0000C69F,
+    0x00000C6A, 0x0000C6A1, 0x0000C6A2, 0x0000C6A3, 0x0000C6A4, 0x0000C6A5, 0x0000C6A6, 0x0000C6A7,
+    0x0000C6A8, 0x0000C6A9, 0x82000C6B, 0x0000C6AB, 0x0000C6AC, 0x0000C6AD, 0x0000C6AE, 0x0000C6AF,
+    0x00000C6B, 0x0000C6B1, 0x0000C6B2, 0x0000C6B3, 0x0000C6B4, 0x0000C6B5, 0x0000C6B6, 0x0000C6B7,
+    0x0000C6B8, 0x0000C6B9, 0x0000C6BA, 0x04000C6C, 0x0000C6BC, 0x0000C6BD, 0x0000C6BE, 0x0000C6BF,
+    0x00000C6C, 0x0000C6C1, 0x0000C6C2, 0x0000C6C3, 0x0000C6C4, 0x0000C6C5, 0x0000C6C6, 0x0000C6C7,
+    0x0000C6C8, 0x0000C6C9, 0x0000C6CA, 0x0000C6CB, 0x08000C6D, 0x0000C6CD, 0x0000C6CE, 0x0000C6CF,
+    0x00000C6D, 0x0000C6D1, 0x0000C6D2, 0x0000C6D3, 0x0000C6D4, 0x0000C6D5, 0x0000C6D6, 0x0000C6D7,
+    0x0000C6D8, 0x0000C6D9, 0x0000C6DA, 0x0000C6DB, 0x0000C6DC, 0x10000C6E, 0x0000C6DE, 0x0000C6DF,
+    0x00000C6E, 0x0000C6E1, 0x0000C6E2, 0x0000C6E3, 0x0000C6E4, 0x0000C6E5, 0x0000C6E6, 0x0000C6E7,
+    0x0000C6E8, 0x0000C6E9, 0x0000C6EA, 0x0000C6EB, 0x0000C6EC, 0x0000C6ED, 0x20000C6F, 0x0000C6EF,
+    0x00000C6F, 0x0000C6F1, 0x0000C6F2, 0x0000C6F3, 0x0000C6F4, 0x0000C6F5, 0x0000C6F6, 0x0000C6F7,
+    0x0000C6F8, 0x0000C6F9, 0x0000C6FA, 0x0000C6FB, 0x0000C6FC, 0x0000C6FD, 0x0000C6FE, 0x0000C6FF,
+    0x000000C7, 0x00000C71, 0x00000C72, 0x00000C73, 0x00000C74, 0x00000C75, 0x00000C76, 0x004000C8,
+    0x00000C78, 0x00000C79, 0x00000C7A, 0x00000C7B, 0x00000C7C, 0x00000C7D, 0x00000C7E, 0x00000C7F,
+    0x00000C71, 0x00010C72, 0x0000C712, 0x0000C713, 0x0000C714, 0x0000C715, 0x0000C716, 0x0000C717,
+    0x0000C718, 0x0000C719, 0x0000C71A, 0x0000C71B, 0x0000C71C, 0x0000C71D, 0x0000C71E, 0x0000C71F,
+    0x00000C72, 0x0000C721, 0x00020C73, 0x0000C723, 0x0000C724, 0x0000C725, 0x0000C726, 0x0000C727,
+    0x0000C728, 0x0000C729, 0x0000C72A, 0x0000C72B, 0x0000C72C, 0x0000C72D, 0x0000C72E, 0x0000C72F,
+    0x00000C73, 0x0000C731, 0x0000C732, 0x00040C74, 0x0000C734, 0x0000C735, 0x0000C736, 0x0000C737,
+    0x0000C738, 0x0000C739, 0x0000C73A, 0x0000C73B, 0x0000C73C, 0x0000C73D, 0x0000C73E, 0x0000C73F,
+    0x00000C74, 0x0000C741, 0x0000C742, 0x0000C743, 0x00080C75, 0x0000C745, 0x0000C746, 0x0000C747,
+    0x0000C748, 0x0000C749, 0x0000C74A, 0x0000C74B, 0x0000C74C, 0x0000C74D, 0x0000C74E, 0x0000C74F,
+    0x00000C75, 0x0000C751, 0x0000C752, 0x0000C753, 0x0000C754, 0x00100C76, 0x0000C756, 0x0000C757,
+    0x0000C758, 0x0000C759, 0x0000C75A, 0x0000C75B, 0x0000C75C, 0x0000C75D, 0x0000C75E, 0x0000C75F,
+    0x00000C76, 0x0000C761, 0x0000C762, 0x0000C763, 0x0000C764, 0x0000C765, 0x00200C77, 0x0000C767,
+    0x0000C768, 0x0000C769, 0x0000C76A, 0x0000C76B, 0x0000C76C, 0x0000C76D, 0x0000C76E, 0x0000C76F,
+    0x004000C8, 0x00400C81, 0x00400C82, 0x00400C83, 0x00400C84, 0x00400C85, 0x00400C86, 0x00400C78,
+    0x00400C88, 0x00400C89, 0x00400C8A, 0x00400C8B, 0x00400C8C, 0x00400C8D, 0x00400C8E, 0x00400C8F,
+    0x00000C78, 0x0000C781, 0x0000C782, 0x0000C783, 0x0000C784, 0x0000C785, 0x0000C786, 0x0000C787,
+    0x00800C79, 0x0000C789, 0x0000C78A, 0x0000C78B, 0x0000C78C, 0x0000C78D, 0x0000C78E, 0x0000C78F,
+    0x00000C79, 0x0000C791, 0x0000C792, 0x0000C793, 0x0000C794, 0x0000C795, 0x0000C796, 0x0000C797,
+    0x0000C798, 0x01000C7A, 0x0000C79A, 0x0000C79B, 0x0000C79C, 0x0000C79D, 0x0000C79E, 0x0000C79F,
+    0x00000C7A, 0x0000C7A1, 0x0000C7A2, 0x0000C7A3, 0x0000C7A4, 0x0000C7A5, 0x0000C7A6, 0x0000C7A7,
+    0x0000C7A8, 0x0000C7A9, 0x82000C7B, 0x0000C7AB, 0x0000C7AC, 0x0000C7AD, 0x0000C7AE, 0x0000C7AF,
+    0x00000C7B, 0x0000C7B1, 0x0000C7B2, 0x0000C7B3, 0x0000C7B4, 0x0000C7B5, 0x0000C7B6, 0x0000C7B7,
+    0x0000C7B8, 0x0000C7B9, 0x0000C7BA, 0x04000C7C, 0x0000C7BC, 0x0000C7BD, 0x0000C7BE, 0x0000C7BF,
+    0x00000C7C, 0x0000C7C1, 0x0000C7C2, 0x0000C7C3, 0x0000C7C4, 0x0000C7C5, 0x0000C7C6, 0x0000C7C7,
+    0x0000C7C8, 0x0000C7C9, 0x0000C7CA, 0x0000C7CB, 0x08000C7D, 0x0000C7CD, 0x0000C7CE, 0x0000C7CF,
+    0x00000C7D, 0x0000C7D1, 0x0000C7D2, 0x0000C7D3, 0x0000C7D4, 0x0000C7D5, 0x0000C7D6, 0x0000C7D7,
+    0x0000C7D8, 0x0000C7D9, 0x0000C7DA, 0x0000C7DB, 0x0000C7DC, 0x10000C7E, 0x0000C7DE, 0x0000C7DF,
+    0x00000C7E, 0x0000C7E1, 0x0000C7E2, 0x0000C7E3, 0x0000C7E4, 0x0000C7E5, 0x0000C7E6, 0x0000C7E7,
+    0x0000C7E8, 0x0000C7E9, 0x0000C7EA, 0x0000C7EB, 0x0000C7EC, 0x0000C7ED, 0x20000C7F, 0x0000C7EF,
+    0x00000C7F, 0x0000C7F1, 0x0000C7F2, 0x0000C7F3, 0x0000C7F4, 0x0000C7F5, 0x0000C7F6, 0x0000C7F7,
+    0x0000C7F8, 0x0000C7F9, 0x0000C7FA, 0x0000C7FB, 0x0000C7FC, 0x0000C7FD, 0x0000C7FE, 0x0000C7FF,
+    0x000000C8, 0x00000C81, 0x00000C82, 0x00000C83, 0x00000C84, 0x00000C85, 0x00000C86, 0x00000C87,
+    0x008000C9, 0x00000C89, 0x00000C8A, 0x00000C8B, 0x00000C8C, 0x00000C8D, 0x00000C8E, 0x00000C8F,
+    0x00000C81, 0x00010C82, 0x0000C812, 0x0000C813, 0x0000C814, 0x0000C815, 0x0000C816, 0x0000C817,
+    0x0000C818, 0x0000C819, 0x0000C81A, 0x0000C81B, 0x0000C81C, 0x0000C81D, 0x0000C81E, 0x0000C81F,
+    0x00000C82, 0x0000C821, 0x00020C83, 0x0000C823, 0x0000C824, 0x0000C825, 0x0000C826, 0x0000C827,
+    0x0000C828, 0x0000C829, 0x0000C82A, 0x0000C82B, 0x0000C82C, 0x0000C82D, 0x0000C82E, 0x0000C82F,
+    0x00000C83, 0x0000C831, 0x0000C832, 0x00040C84, 0x0000C834, 0x0000C835, 0x0000C836, 0x0000C837,
+    0x0000C838, 0x0000C839, 0x0000C83A, 0x0000C83B, 0x0000C83C, 0x0000C83D, 0x0000C83E, 0x0000C83F,
+    0x00000C84, 0x0000C841, 0x0000C842, 0x0000C843, 0x00080C85, 0x0000C845, 0x0000C846, 0x0000C847,
+    0x0000C848, 0x0000C849, 0x0000C84A, 0x0000C84B, 0x0000C84C, 0x0000C84D, 0x0000C84E, 0x0000C84F,
+    0x00000C85, 0x0000C851, 0x0000C852, 0x0000C853, 0x0000C854, 0x00100C86, 0x0000C856, 0x0000C857,
+    0x0000C858, 0x0000C859, 0x0000C85A, 0x0000C85B, 0x0000C85C, 0x0000C85D, 0x0000C85E, 0x0000C85F,
+    0x00000C86, 0x0000C861, 0x0000C862, 0x0000C863, 0x0000C864, 0x0000C865, 0x00200C87, 0x0000C867,
+    0x0000C868, 0x0000C869, 0x0000C86A, 0x0000C86B, 0x0000C86C, 0x0000C86D, 0x0000C86E, 0x0000C86F,
+    0x00000C87, 0x0000C871, 0x0000C872, 0x0000C873, 0x0000C874, 0x0000C875, 0x0000C876, 0x00400C88,
+    0x0000C878, 0x0000C879, 0x0000C87A, 0x0000C87B, 0x0000C87C, 0x0000C87D, 0x0000C87E, 0x0000C87F,
+    0x008000C9, 0x00800C91, 0x00800C92, 0x00800C93, 0x00800C94, 0x00800C95, 0x00800C96, 0x00800C97,
+    0x00800C89, 0x00800C99, 0x00800C9A, 0x00800C9B, 0x00800C9C, 0x00800C9D, 0x00800C9E, 0x00800C9F,
+    0x00000C89, 0x0000C891, 0x0000C892, 0x0000C893, 0x0000C894, 0x0000C895, 0x0000C896, 0x0000C897,
+    0x0000C898, 0x01000C8A, 0x0000C89A, 0x0000C89B, 0x0000C89C, 0x0000C89D, 0x0000C89E, 0x0000C89F,
+    0x00000C8A, 0x0000C8A1, 0x0000C8A2, 0x0000C8A3, 0x0000C8A4, 0x0000C8A5, 0x0000C8A6, 0x0000C8A7,
+    0x0000C8A8, 0x0000C8A9, 0x82000C8B, 0x0000C8AB, 0x0000C8AC, 0x0000C8AD, 0x0000C8AE, 0x0000C8AF,
+    0x00000C8B, 0x0000C8B1, 0x0000C8B2, 0x0000C8B3, 0x0000C8B4, 0x0000C8B5, 0x0000C8B6, 0x0000C8B7,
+    0x0000C8B8, 0x0000C8B9, 0x0000C8BA, 0x04000C8C, 0x0000C8BC, 0x0000C8BD, 0x0000C8BE, 0x0000C8BF,
+    0x00000C8C, 0x0000C8C1, 0x0000C8C2, 0x0000C8C3, 0x0000C8C4, 0x0000C8C5, 0x0000C8C6, 0x0000C8C7,
+    0x0000C8C8, 0x0000C8C9, 0x0000C8CA, 0x0000C8CB, 0x08000C8D, 0x0000C8CD, 0x0000C8CE, 0x0000C8CF,
+    0x00000C8D, 0x0000C8D1, 0x0000C8D2, 0x0000C8D3, 0x0000C8D4, 0x0000C8D5, 0x0000C8D6, 0x0000C8D7,
+    0x0000C8D8, 0x0000C8D9, 0x0000C8DA, 0x0000C8DB, 0x0000C8DC, 0x10000C8E, 0x0000C8DE, 0x0000C8DF,
+    0x00000C8E, 0x0000C8E1, 0x0000C8E2, 0x0000C8E3, 0x0000C8E4, 0x0000C8E5, 0x0000C8E6, 0x0000C8E7,
+    0x0000C8E8, 0x0000C8E9, 0x0000C8EA, 0x0000C8EB, 0x0000C8EC, 0x0000C8ED, 0x20000C8F, 0x0000C8EF,
+    0x00000C8F, 0x0000C8F1, 0x0000C8F2, 0x0000C8F3, 0x0000C8F4, 0x0000C8F5, 0x0000C8F6, 0x0000C8F7,
+    0x0000C8F8, 0x0000C8F9, 0x0000C8FA, 0x0000C8FB, 0x0000C8FC, 0x0000C8FD, 0x0000C8FE, 0x0000C8FF,
+    0x000000C9, 0x00000C91, 0x00000C92, 0x00000C93, 0x00000C94, 0x00000C95, 0x00000C96, 0x00000C97,
+    0x00000C98, 0x010000CA, 0x00000C9A, 0x00000C9B, 0x00000C9C, 0x00000C9D, 0x00000C9E, 0x00000C9F,
+    0x00000C91, 0x00010C92, 0x0000C912, 0x0000C913, 0x0000C914, 0x0000C915, 0x0000C916, 0x0000C917,
+    0x0000C918, 0x0000C919, 0x0000C91A, 0x0000C91B, 0x0000C91C, 0x0000C91D, 0x0000C91E, 0x0000C91F,
+    0x00000C92, 0x0000C921, 0x00020C93, 0x0000C923, 0x0000C924, 0x0000C925, 0x0000C926, 0x0000C927,
+    0x0000C928, 0x0000C929, 0x0000C92A, 0x0000C92B, 0x0000C92C, 0x0000C92D, 0x0000C92E, 0x0000C92F,
+    0x00000C93, 0x0000C931, 0x0000C932, 0x00040C94, 0x0000C934, 0x0000C935, 0x0000C936, 0x0000C937,
+    0x0000C938, 0x0000C939, 0x0000C93A, 0x0000C93B, 0x0000C93C, 0x0000C93D, 0x0000C93E, 0x0000C93F,
+    0x00000C94, 0x0000C941, 0x0000C942, 0x0000C943, 0x00080C95, 0x0000C945, 0x0000C946, 0x0000C947,
+    0x0000C948, 0x0000C949, 0x0000C94A, 0x0000C94B, 0x0000C94C, 0x0000C94D, 0x0000C94E, 0x0000C94F,
+    0x00000C95, 0x0000C951, 0x0000C952, 0x0000C953, 0x0000C954, 0x00100C96, 0x0000C956, 0x0000C957,
+    0x0000C958, 0x0000C959, 0x0000C95A, 0x0000C95B, 0x0000C95C, 0x0000C95D, 0x0000C95E, 0x0000C95F,
+    0x00000C96, 0x0000C961, 0x0000C962, 0x0000C963, 0x0000C964, 0x0000C965, 0x00200C97, 0x0000C967,
+    0x0000C968, 0x0000C969, 0x0000C96A, 0x0000C96B, 0x0000C96C, 0x0000C96D, 0x0000C96E, 0x0000C96F,
+    0x00000C97, 0x0000C971, 0x0000C972, 0x0000C973, 0x0000C974, 0x0000C975, 0x0000C976, 0x00400C98,
+    0x0000C978, 0x0000C979, 0x0000C97A, 0x0000C97B, 0x0000C97C, 0x0000C97D, 0x0000C97E, 0x0000C97F,
+    0x00000C98, 0x0000C981, 0x0000C982, 0x0000C983, 0x0000C984, 0x0000C985, 0x0000C986, 0x0000C987,
+    0x00800C99, 0x0000C989, 0x0000C98A, 0x0000C98B, 0x0000C98C, 0x0000C98D, 0x0000C98E, 0x0000C98F,
+    0x010000CA, 0x01000CA1, 0x01000CA2, 0x01000CA3, 0x01000CA4, 0x01000CA5, 0x01000CA6, 0x01000CA7,
+    0x01000CA8, 0x01000C9A, 0x01000CAA, 0x01000CAB, 0x01000CAC, 0x01000CAD, 0x01000CAE, 0x01000CAF,
+    0x00000C9A, 0x0000C9A1, 0x0000C9A2, 0x0000C9A3, 0x0000C9A4, 0x0000C9A5, 0x0000C9A6, 0x0000C9A7,
+    0x0000C9A8, 0x0000C9A9, 0x82000C9B, 0x0000C9AB, 0x0000C9AC, 0x0000C9AD, 0x0000C9AE, 0x0000C9AF,
+    0x00000C9B, 0x0000C9B1, 0x0000C9B2, 0x0000C9B3, 0x0000C9B4, 0x0000C9B5, 0x0000C9B6, 0x0000C9B7,
+    0x0000C9B8, 0x0000C9B9, 0x0000C9BA, 0x04000C9C, 0x0000C9BC, 0x0000C9BD, 0x0000C9BE, 0x0000C9BF,
+    0x00000C9C, 0x0000C9C1, 0x0000C9C2, 0x0000C9C3, 0x0000C9C4, 0x0000C9C5, 0x0000C9C6, 0x0000C9C7,
+    0x0000C9C8, 0x0000C9C9, 0x0000C9CA, 0x0000C9CB, 0x08000C9D, 0x0000C9CD, 0x0000C9CE, 0x0000C9CF,
+    0x00000C9D, 0x0000C9D1, 0x0000C9D2, 0x0000C9D3, 0x0000C9D4, 0x0000C9D5, 0x0000C9D6, 0x0000C9D7,
+    0x0000C9D8, 0x0000C9D9, 0x0000C9DA, 0x0000C9DB, 0x0000C9DC, 0x10000C9E, 0x0000C9DE, 0x0000C9DF,
+    0x00000C9E, 0x0000C9E1, 0x0000C9E2, 0x0000C9E3, 0x0000C9E4, 0x0000C9E5, 0x0000C9E6, 0x0000C9E7,
+    0x0000C9E8, 0x0000C9E9, 0x0000C9EA, 0x0000C9EB, 0x0000C9EC, 0x0000C9ED, 0x20000C9F, 0x0000C9EF,
+    0x00000C9F, 0x0000C9F1, 0x0000C9F2, 0x0000C9F3, 0x0000C9F4, 0x0000C9F5, 0x0000C9F6, 0x0000C9F7,
+    0x0000C9F8, 0x0000C9F9, 0x0000C9FA, 0x0000C9FB, 0x0000C9FC, 0x0000C9FD, 0x0000C9FE, 0x0000C9FF,
+    0x000000CA, 0x00000CA1, 0x00000CA2, 0x00000CA3, 0x00000CA4, 0x00000CA5, 0x00000CA6, 0x00000CA7,
+    0x00000CA8, 0x00000CA9, 0x820000CB, 0x00000CAB, 0x00000CAC, 0x00000CAD, 0x00000CAE, 0x00000CAF,
+    0x00000CA1, 0x00010CA2, 0x0000CA12, 0x0000CA13, 0x0000CA14, 0x0000CA15, 0x0000CA16, 0x0000CA17,
+    0x0000CA18, 0x0000CA19, 0x0000CA1A, 0x0000CA1B, 0x0000CA1C, 0x0000CA1D, 0x0000CA1E, 0x0000CA1F,
+    0x00000CA2, 0x0000CA21, 0x00020CA3, 0x0000CA23, 0x0000CA24, 0x0000CA25, 0x0000CA26, 0x0000CA27,
+    0x0000CA28, 0x0000CA29, 0x0000CA2A, 0x0000CA2B, 0x0000CA2C, 0x0000CA2D, 0x0000CA2E, 0x0000CA2F,
+    0x00000CA3, 0x0000CA31, 0x0000CA32, 0x00040CA4, 0x0000CA34, 0x0000CA35, 0x0000CA36, 0x0000CA37,
+    0x0000CA38, 0x0000CA39, 0x0000CA3A, 0x0000CA3B, 0x0000CA3C, 0x0000CA3D, 0x0000CA3E, 0x0000CA3F,
+    0x00000CA4, 0x0000CA41, 0x0000CA42, 0x0000CA43, 0x00080CA5, 0x0000CA45, 0x0000CA46, 0x0000CA47,
+    0x0000CA48, 0x0000CA49, 0x0000CA4A, 0x0000CA4B, 0x0000CA4C, 0x0000CA4D, 0x0000CA4E, 0x0000CA4F,
+    0x00000CA5, 0x0000CA51, 0x0000CA52, 0x0000CA53, 0x0000CA54, 0x00100CA6, 0x0000CA56, 0x0000CA57,
+    0x0000CA58, 0x0000CA59, 0x0000CA5A, 0x0000CA5B, 0x0000CA5C, 0x0000CA5D, 0x0000CA5E, 0x0000CA5F,
+    0x00000CA6, 0x0000CA61, 0x0000CA62, 0x0000CA63, 0x0000CA64, 0x0000CA65, 0x00200CA7, 0x0000CA67,
+    0x0000CA68, 0x0000CA69, 0x0000CA6A, 0x0000CA6B, 0x0000CA6C, 0x0000CA6D, 0x0000CA6E, 0x0000CA6F,
+    0x00000CA7, 0x0000CA71, 0x0000CA72, 0x0000CA73, 0x0000CA74, 0x0000CA75, 0x0000CA76, 0x00400CA8,
+    0x0000CA78, 0x0000CA79, 0x0000CA7A, 0x0000CA7B, 0x0000CA7C, 0x0000CA7D, 0x0000CA7E, 0x0000CA7F,
+    0x00000CA8, 0x0000CA81, 0x0000CA82, 0x0000CA83, 0x0000CA84, 0x0000CA85, 0x0000CA86, 0x0000CA87,
+    0x00800CA9, 0x0000CA89, 0x0000CA8A, 0x0000CA8B, 0x0000CA8C, 0x0000CA8D, 0x0000CA8E, 0x0000CA8F,
+    0x00000CA9, 0x0000CA91, 0x0000CA92, 0x0000CA93, 0x0000CA94, 0x0000CA95, 0x0000CA96, 0x0000CA97,
+    0x0000CA98, 0x01000CAA, 0x0000CA9A, 0x0000CA9B, 0x0000CA9C, 0x0000CA9D, 0x0000CA9E, 0x0000CA9F,
+    0x820000CB, 0x82000CB1, 0x82000CB2, 0x82000CB3, 0x82000CB4, 0x82000CB5, 0x82000CB6, 0x82000CB7,
+    0x82000CB8, 0x82000CB9, 0x82000CAB, 0x82000CBB, 0x82000CBC, 0x82000CBD, 0x82000CBE, 0x82000CBF,
+    0x00000CAB, 0x0000CAB1, 0x0000CAB2, 0x0000CAB3, 0x0000CAB4, 0x0000CAB5, 0x0000CAB6, 0x0000CAB7,
+    0x0000CAB8, 0x0000CAB9, 0x0000CABA, 0x04000CAC, 0x0000CABC, 0x0000CABD, 0x0000CABE, 0x0000CABF,
+    0x00000CAC, 0x0000CAC1, 0x0000CAC2, 0x0000CAC3, 0x0000CAC4, 0x0000CAC5, 0x0000CAC6, 0x0000CAC7,
+    0x0000CAC8, 0x0000CAC9, 0x0000CACA, 0x0000CACB, 0x08000CAD, 0x0000CACD, 0x0000CACE, 0x0000CACF,
+    0x00000CAD, 0x0000CAD1, 0x0000CAD2, 0x0000CAD3, 0x0000CAD4, 0x0000CAD5, 0x0000CAD6, 0x0000CAD7,
+    0x0000CAD8, 0x0000CAD9, 0x0000CADA, 0x0000CADB, 0x0000CADC, 0x10000CAE, 0x0000CADE, 0x0000CADF,
+    0x00000CAE, 0x0000CAE1, 0x0000CAE2, 0x0000CAE3, 0x0000CAE4, 0x0000CAE5, 0x0000CAE6, 0x0000CAE7,
+    0x0000CAE8, 0x0000CAE9, 0x0000CAEA, 0x0000CAEB, 0x0000CAEC, 0x0000CAED, 0x20000CAF, 0x0000CAEF,
+    0x00000CAF, 0x0000CAF1, 0x0000CAF2, 0x0000CAF3, 0x0000CAF4, 0x0000CAF5, 0x0000CAF6, 0x0000CAF7,
+    0x0000CAF8, 0x0000CAF9, 0x0000CAFA, 0x0000CAFB, 0x0000CAFC, 0x0000CAFD, 0x0000CAFE, 0x0000CAFF,
+    0x000000CB, 0x00000CB1, 0x00000CB2, 0x00000CB3, 0x00000CB4, 0x00000CB5, 0x00000CB6, 0x00000CB7,
+    0x00000CB8, 0x00000CB9, 0x00000CBA, 0x040000CC, 0x00000CBC, 0x00000CBD, 0x00000CBE, 0x00000CBF,
+    0x00000CB1, 0x00010CB2, 0x0000CB12, 0x0000CB13, 0x0000CB14, 0x0000CB15, 0x0000CB16, 0x0000CB17,
+    0x0000CB18, 0x0000CB19, 0x0000CB1A, 0x0000CB1B, 0x0000CB1C, 0x0000CB1D, 0x0000CB1E, 0x0000CB1F,
+    0x00000CB2, 0x0000CB21, 0x00020CB3, 0x0000CB23, 0x0000CB24, 0x0000CB25, 0x0000CB26, 0x0000CB27,
+    0x0000CB28, 0x0000CB29, 0x0000CB2A, 0x0000CB2B, 0x0000CB2C, 0x0000CB2D, 0x0000CB2E, 0x0000CB2F,
+    0x00000CB3, 0x0000CB31, 0x0000CB32, 0x00040CB4, 0x0000CB34, 0x0000CB35, 0x0000CB36, 0x0000CB37,
+    0x0000CB38, 0x0000CB39, 0x0000CB3A, 0x0000CB3B, 0x0000CB3C, 0x0000CB3D, 0x0000CB3E, 0x0000CB3F,
+    0x00000CB4, 0x0000CB41, 0x0000CB42, 0x0000CB43, 0x00080CB5, 0x0000CB45, 0x0000CB46, 0x0000CB47,
+    0x0000CB48, 0x0000CB49, 0x0000CB4A, 0x0000CB4B, 0x0000CB4C, 0x0000CB4D, 0x0000CB4E, 0x0000CB4F,
+    0x00000CB5, 0x0000CB51, 0x0000CB52, 0x0000CB53, 0x0000CB54, 0x00100CB6, 0x0000CB56, 0x0000CB57,
+    0x0000CB58, 0x0000CB59, 0x0000CB5A, 0x0000CB5B, 0x0000CB5C, 0x0000CB5D, 0x0000CB5E, 0x0000CB5F,
+    0x00000CB6, 0x0000CB61, 0x0000CB62, 0x0000CB63, 0x0000CB64, 0x0000CB65, 0x00200CB7, 0x0000CB67,
+    0x0000CB68, 0x0000CB69, 0x0000CB6A, 0x0000CB6B, 0x0000CB6C, 0x0000CB6D, 0x0000CB6E, 0x0000CB6F,
+    0x00000CB7, 0x0000CB71, 0x0000CB72, 0x0000CB73, 0x0000CB74, 0x0000CB75, 0x0000CB76, 0x00400CB8,
+    0x0000CB78, 0x0000CB79, 0x0000CB7A, 0x0000CB7B, 0x0000CB7C, 0x0000CB7D, 0x0000CB7E, 0x0000CB7F,
+    0x00000CB8, 0x0000CB81, 0x0000CB82, 0x0000CB83, 0x0000CB84, 0x0000CB85, 0x0000CB86, 0x0000CB87,
+    0x00800CB9, 0x0000CB89, 0x0000CB8A, 0x0000CB8B, 0x0000CB8C, 0x0000CB8D, 0x0000CB8E, 0x0000CB8F,
+    0x00000CB9, 0x0000CB91, 0x0000CB92, 0x0000CB93, 0x0000CB94, 0x0000CB95, 0x0000CB96, 0x0000CB97,
+    0x0000CB98, 0x01000CBA, 0x0000CB9A, 0x0000CB9B, 0x0000CB9C, 0x0000CB9D, 0x0000CB9E, 0x0000CB9F,
+    0x00000CBA, 0x0000CBA1, 0x0000CBA2, 0x0000CBA3, 0x0000CBA4, 0x0000CBA5, 0x0000CBA6, 0x0000CBA7,
+    0x0000CBA8, 0x0000CBA9, 0x82000CBB, 0x0000CBAB, 0x0000CBAC, 0x0000CBAD, 0x0000CBAE, 0x0000CBAF,
+    0x040000CC, 0x04000CC1, 0x04000CC2, 0x04000CC3, 0x04000CC4, 0x04000CC5, 0x04000CC6, 0x04000CC7,
+    0x04000CC8, 0x04000CC9, 0x04000CCA, 0x04000CBC, 0x04000CCC, 0x04000CCD, 0x04000CCE, 0x04000CCF,
+    0x00000CBC, 0x0000CBC1, 0x0000CBC2, 0x0000CBC3, 0x0000CBC4, 0x0000CBC5, 0x0000CBC6, 0x0000CBC7,
+    0x0000CBC8, 0x0000CBC9, 0x0000CBCA, 0x0000CBCB, 0x08000CBD, 0x0000CBCD, 0x0000CBCE, 0x0000CBCF,
+    0x00000CBD, 0x0000CBD1, 0x0000CBD2, 0x0000CBD3, 0x0000CBD4, 0x0000CBD5, 0x0000CBD6, 0x0000CBD7,
+    0x0000CBD8, 0x0000CBD9, 0x0000CBDA, 0x0000CBDB, 0x0000CBDC, 0x10000CBE, 0x0000CBDE, 0x0000CBDF,
+    0x00000CBE, 0x0000CBE1, 0x0000CBE2, 0x0000CBE3, 0x0000CBE4, 0x0000CBE5, 0x0000CBE6, 0x0000CBE7,
+    0x0000CBE8, 0x0000CBE9, 0x0000CBEA, 0x0000CBEB, 0x0000CBEC, 0x0000CBED, 0x20000CBF, 0x0000CBEF,
+    0x00000CBF, 0x0000CBF1, 0x0000CBF2, 0x0000CBF3, 0x0000CBF4, 0x0000CBF5, 0x0000CBF6, 0x0000CBF7,
+    0x0000CBF8, 0x0000CBF9, 0x0000CBFA, 0x0000CBFB, 0x0000CBFC, 0x0000CBFD, 0x0000CBFE, 0x0000CBFF,
+    0x0800000D, 0x080000D1, 0x080000D2, 0x080000D3, 0x080000D4, 0x080000D5, 0x080000D6, 0x080000D7,
+    0x080000D8, 0x080000D9, 0x080000DA, 0x080000DB, 0x080000CD, 0x080000DD, 0x080000DE, 0x080000DF,
+    0x080000D1, 0x080100D2, 0x08000D12, 0x08000D13, 0x08000D14, 0x08000D15, 0x08000D16, 0x08000D17,
+    0x08000D18, 0x08000D19, 0x08000D1A, 0x08000D1B, 0x08000D1C, 0x08000D1D, 0x08000D1E, 0x08000D1F,
+    0x080000D2, 0x08000D21, 0x080200D3, 0x08000D23, 0x08000D24, 0x08000D25, 0x08000D26, 0x08000D27,
+    0x08000D28, 0x08000D29, 0x08000D2A, 0x08000D2B, 0x08000D2C, 0x08000D2D, 0x08000D2E, 0x08000D2F,
+    0x080000D3, 0x08000D31, 0x08000D32, 0x080400D4, 0x08000D34, 0x08000D35, 0x08000D36, 0x08000D37,
+    0x08000D38, 0x08000D39, 0x08000D3A, 0x08000D3B, 0x08000D3C, 0x08000D3D, 0x08000D3E, 0x08000D3F,
+    0x080000D4, 0x08000D41, 0x08000D42, 0x08000D43, 0x080800D5, 0x08000D45, 0x08000D46, 0x08000D47,
+    0x08000D48, 0x08000D49, 0x08000D4A, 0x08000D4B, 0x08000D4C, 0x08000D4D, 0x08000D4E, 0x08000D4F,
+    0x080000D5, 0x08000D51, 0x08000D52, 0x08000D53, 0x08000D54, 0x081000D6, 0x08000D56, 0x08000D57,
+    0x08000D58, 0x08000D59, 0x08000D5A, 0x08000D5B, 0x08000D5C, 0x08000D5D, 0x08000D5E, 0x08000D5F,
+    0x080000D6, 0x08000D61, 0x08000D62, 0x08000D63, 0x08000D64, 0x08000D65, 0x082000D7, 0x08000D67,
+    0x08000D68, 0x08000D69, 0x08000D6A, 0x08000D6B, 0x08000D6C, 0x08000D6D, 0x08000D6E, 0x08000D6F,
+    0x080000D7, 0x08000D71, 0x08000D72, 0x08000D73, 0x08000D74, 0x08000D75, 0x08000D76, 0x084000D8,
+    0x08000D78, 0x08000D79, 0x08000D7A, 0x08000D7B, 0x08000D7C, 0x08000D7D, 0x08000D7E, 0x08000D7F,
+    0x080000D8, 0x08000D81, 0x08000D82, 0x08000D83, 0x08000D84, 0x08000D85, 0x08000D86, 0x08000D87,
+    0x088000D9, 0x08000D89, 0x08000D8A, 0x08000D8B, 0x08000D8C, 0x08000D8D, 0x08000D8E, 0x08000D8F,
+    0x080000D9, 0x08000D91, 0x08000D92, 0x08000D93, 0x08000D94, 0x08000D95, 0x08000D96, 0x08000D97,
+    0x08000D98, 0x090000DA, 0x08000D9A, 0x08000D9B, 0x08000D9C, 0x08000D9D, 0x08000D9E, 0x08000D9F,
+    0x080000DA, 0x08000DA1, 0x08000DA2, 0x08000DA3, 0x08000DA4, 0x08000DA5, 0x08000DA6, 0x08000DA7,
+    0x08000DA8, 0x08000DA9, 0x8A0000DB, 0x08000DAB, 0x08000DAC, 0x08000DAD, 0x08000DAE, 0x08000DAF,
+    0x080000DB, 0x08000DB1, 0x08000DB2, 0x08000DB3, 0x08000DB4, 0x08000DB5, 0x08000DB6, 0x08000DB7,
+    0x08000DB8, 0x08000DB9, 0x08000DBA, 0x0C0000DC, 0x08000DBC, 0x08000DBD, 0x08000DBE, 0x08000DBF,
+    0x080000CD, 0x08000CD1, 0x08000CD2, 0x08000CD3, 0x08000CD4, 0x08000CD5, 0x08000CD6, 0x08000CD7,
+    0x08000CD8, 0x08000CD9, 0x08000CDA, 0x08000CDB, 0x100000DD, 0x08000CDD, 0x08000CDE, 0x08000CDF,
+    0x080000DD, 0x08000DD1, 0x08000DD2, 0x08000DD3, 0x08000DD4, 0x08000DD5, 0x08000DD6, 0x08000DD7,
+    0x08000DD8, 0x08000DD9, 0x08000DDA, 0x08000DDB, 0x08000DDC, 0x180000DE, 0x08000DDE, 0x08000DDF,
+    0x080000DE, 0x08000DE1, 0x08000DE2, 0x08000DE3, 0x08000DE4, 0x08000DE5, 0x08000DE6, 0x08000DE7,
+    0x08000DE8, 0x08000DE9, 0x08000DEA, 0x08000DEB, 0x08000DEC, 0x08000DED, 0x280000DF, 0x08000DEF,
+    0x080000DF, 0x08000DF1, 0x08000DF2, 0x08000DF3, 0x08000DF4, 0x08000DF5, 0x08000DF6, 0x08000DF7,
+    0x08000DF8, 0x08000DF9, 0x08000DFA, 0x08000DFB, 0x08000DFC, 0x08000DFD, 0x08000DFE, 0x08000DFF,
+    0x000000CD, 0x00000CD1, 0x00000CD2, 0x00000CD3, 0x00000CD4, 0x00000CD5, 0x00000CD6, 0x00000CD7,
+    0x00000CD8, 0x00000CD9, 0x00000CDA, 0x00000CDB, 0x00000CDC, 0x100000CE, 0x00000CDE, 0x00000CDF,
+    0x00000CD1, 0x00010CD2, 0x0000CD12, 0x0000CD13, 0x0000CD14, 0x0000CD15, 0x0000CD16, 0x0000CD17,
+    0x0000CD18, 0x0000CD19, 0x0000CD1A, 0x0000CD1B, 0x0000CD1C, 0x0000CD1D, 0x0000CD1E, 0x0000CD1F,
+    0x00000CD2, 0x0000CD21, 0x00020CD3, 0x0000CD23, 0x0000CD24, 0x0000CD25, 0x0000CD26, 0x0000CD27,
+    0x0000CD28, 0x0000CD29, 0x0000CD2A, 0x0000CD2B, 0x0000CD2C, 0x0000CD2D, 0x0000CD2E, 0x0000CD2F,
+    0x00000CD3, 0x0000CD31, 0x0000CD32, 0x00040CD4, 0x0000CD34, 0x0000CD35, 0x0000CD36, 0x0000CD37,
+    0x0000CD38, 0x0000CD39, 0x0000CD3A, 0x0000CD3B, 0x0000CD3C, 0x0000CD3D, 0x0000CD3E, 0x0000CD3F,
+    0x00000CD4, 0x0000CD41, 0x0000CD42, 0x0000CD43, 0x00080CD5, 0x0000CD45, 0x0000CD46, 0x0000CD47,
+    0x0000CD48, 0x0000CD49, 0x0000CD4A, 0x0000CD4B, 0x0000CD4C, 0x0000CD4D, 0x0000CD4E, 0x0000CD4F,
+    0x00000CD5, 0x0000CD51, 0x0000CD52, 0x0000CD53, 0x0000CD54, 0x00100CD6, 0x0000CD56, 0x0000CD57,
+    0x0000CD58, 0x0000CD59, 0x0000CD5A, 0x0000CD5B, 0x0000CD5C, 0x0000CD5D, 0x0000CD5E, 0x0000CD5F,
+    0x00000CD6, 0x0000CD61, 0x0000CD62, 0x0000CD63, 0x0000CD64, 0x0000CD65, 0x00200CD7, 0x0000CD67,
+    0x0000CD68, 0x0000CD69, 0x0000CD6A, 0x0000CD6B, 0x0000CD6C, 0x0000CD6D, 0x0000CD6E, 0x0000CD6F,
+    0x00000CD7, 0x0000CD71, 0x0000CD72, 0x0000CD73, 0x0000CD74, 0x0000CD75, 0x0000CD76, 0x00400CD8,
+    0x0000CD78, 0x0000CD79, 0x0000CD7A, 0x0000CD7B, 0x0000CD7C, 0x0000CD7D, 0x0000CD7E, 0x0000CD7F,
+    0x00000CD8, 0x0000CD81, 0x0000CD82, 0x0000CD83, 0x0000CD84, 0x0000CD85, 0x0000CD86, 0x0000CD87,
+    0x00800CD9, 0x0000CD89, 0x0000CD8A, 0x0000CD8B, 0x0000CD8C, 0x0000CD8D, 0x0000CD8E, 0x0000CD8F,
+    0x00000CD9, 0x0000CD91, 0x0000CD92, 0x0000CD93, 0x0000CD94, 0x0000CD95, 0x0000CD96, 0x0000CD97,
+    0x0000CD98, 0x01000CDA, 0x0000CD9A, 0x0000CD9B, 0x0000CD9C, 0x0000CD9D, 0x0000CD9E, 0x0000CD9F,
+    0x00000CDA, 0x0000CDA1, 0x0000CDA2, 0x0000CDA3, 0x0000CDA4, 0x0000CDA5, 0x0000CDA6, 0x0000CDA7,
+    0x0000CDA8, 0x0000CDA9, 0x82000CDB, 0x0000CDAB, 0x0000CDAC, 0x0000CDAD, 0x0000CDAE, 0x0000CDAF,
+    0x00000CDB, 0x0000CDB1, 0x0000CDB2, 0x0000CDB3, 0x0000CDB4, 0x0000CDB5, 0x0000CDB6, 0x0000CDB7,
+    0x0000CDB8, 0x0000CDB9, 0x0000CDBA, 0x04000CDC, 0x0000CDBC, 0x0000CDBD, 0x0000CDBE, 0x0000CDBF,
+    0x00000CDC, 0x0000CDC1, 0x0000CDC2, 0x0000CDC3, 0x0000CDC4, 0x0000CDC5, 0x0000CDC6, 0x0000CDC7,
+    0x0000CDC8, 0x0000CDC9, 0x0000CDCA, 0x0000CDCB, 0x08000CDD, 0x0000CDCD, 0x0000CDCE, 0x0000CDCF,
+    0x100000CE, 0x10000CE1, 0x10000CE2, 0x10000CE3, 0x10000CE4, 0x10000CE5, 0x10000CE6, 0x10000CE7,
+    0x10000CE8, 0x10000CE9, 0x10000CEA, 0x10000CEB, 0x10000CEC, 0x10000CDE, 0x10000CEE, 0x10000CEF,
+    0x00000CDE, 0x0000CDE1, 0x0000CDE2, 0x0000CDE3, 0x0000CDE4, 0x0000CDE5, 0x0000CDE6, 0x0000CDE7,
+    0x0000CDE8, 0x0000CDE9, 0x0000CDEA, 0x0000CDEB, 0x0000CDEC, 0x0000CDED, 0x20000CDF, 0x0000CDEF,
+    0x00000CDF, 0x0000CDF1, 0x0000CDF2, 0x0000CDF3, 0x0000CDF4, 0x0000CDF5, 0x0000CDF6, 0x0000CDF7,
+    0x0000CDF8, 0x0000CDF9, 0x0000CDFA, 0x0000CDFB, 0x0000CDFC, 0x0000CDFD, 0x0000CDFE, 0x0000CDFF,
+    0x000000CE, 0x00000CE1, 0x00000CE2, 0x00000CE3, 0x00000CE4, 0x00000CE5, 0x00000CE6, 0x00000CE7,
+    0x00000CE8, 0x00000CE9, 0x00000CEA, 0x00000CEB, 0x00000CEC, 0x00000CED, 0x200000CF, 0x00000CEF,
+    0x00000CE1, 0x00010CE2, 0x0000CE12, 0x0000CE13, 0x0000CE14, 0x0000CE15, 0x0000CE16, 0x0000CE17,
+    0x0000CE18, 0x0000CE19, 0x0000CE1A, 0x0000CE1B, 0x0000CE1C, 0x0000CE1D, 0x0000CE1E, 0x0000CE1F,
+    0x00000CE2, 0x0000CE21, 0x00020CE3, 0x0000CE23, 0x0000CE24, 0x0000CE25, 0x0000CE26, 0x0000CE27,
+    0x0000CE28, 0x0000CE29, 0x0000CE2A, 0x0000CE2B, 0x0000CE2C, 0x0000CE2D, 0x0000CE2E, 0x0000CE2F,
+    0x00000CE3, 0x0000CE31, 0x0000CE32, 0x00040CE4, 0x0000CE34, 0x0000CE35, 0x0000CE36, 0x0000CE37,
+    0x0000CE38, 0x0000CE39, 0x0000CE3A, 0x0000CE3B, 0x0000CE3C, 0x0000CE3D, 0x0000CE3E, 0x0000CE3F,
+    0x00000CE4, 0x0000CE41, 0x0000CE42, 0x0000CE43, 0x00080CE5, 0x0000CE45, 0x0000CE46, 0x0000CE47,
+    0x0000CE48, 0x0000CE49, 0x0000CE4A, 0x0000CE4B, 0x0000CE4C, 0x0000CE4D, 0x0000CE4E, 0x0000CE4F,
+    0x00000CE5, 0x0000CE51, 0x0000CE52, 0x0000CE53, 0x0000CE54, 0x00100CE6, 0x0000CE56, 0x0000CE57,
+    0x0000CE58, 0x0000CE59, 0x0000CE5A, 0x0000CE5B, 0x0000CE5C, 0x0000CE5D, 0x0000CE5E, 0x0000CE5F,
+    0x00000CE6, 0x0000CE61, 0x0000CE62, 0x0000CE63, 0x0000CE64, 0x0000CE65, 0x00200CE7, 0x0000CE67,
+    0x0000CE68, 0x0000CE69, 0x0000CE6A, 0x0000CE6B, 0x0000CE6C, 0x0000CE6D, 0x0000CE6E, 0x0000CE6F,
+    0x00000CE7, 0x0000CE71, 0x0000CE72, 0x0000CE73, 0x0000CE74, 0x0000CE75, 0x0000CE76, 0x00400CE8,
+    0x0000CE78, 0x0000CE79, 0x0000CE7A, 0x0000CE7B, 0x0000CE7C, 0x0000CE7D, 0x0000CE7E, 0x0000CE7F,
+    0x00000CE8, 0x0000CE81, 0x0000CE82, 0x0000CE83, 0x0000CE84, 0x0000CE85, 0x0000CE86, 0x0000CE87,
+    0x00800CE9, 0x0000CE89, 0x0000CE8A, 0x0000CE8B, 0x0000CE8C, 0x0000CE8D, 0x0000CE8E, 0x0000CE8F,
+    0x00000CE9, 0x0000CE91, 0x0000CE92, 0x0000CE93, 0x0000CE94, 0x0000CE95, 0x0000CE96, 0x0000CE97,
+    0x0000CE98, 0x01000CEA, 0x0000CE9A, 0x0000CE9B, 0x0000CE9C, 0x0000CE9D, 0x0000CE9E, 0x0000CE9F,
+    0x00000CEA, 0x0000CEA1, 0x0000CEA2, 0x0000CEA3, 0x0000CEA4, 0x0000CEA5, 0x0000CEA6, 0x0000CEA7,
+    0x0000CEA8, 0x0000CEA9, 0x82000CEB, 0x0000CEAB, 0x0000CEAC, 0x0000CEAD, 0x0000CEAE, 0x0000CEAF,
+    0x00000CEB, 0x0000CEB1, 0x0000CEB2, 0x0000CEB3, 0x0000CEB4, 0x0000CEB5, 0x0000CEB6, 0x0000CEB7,
+    0x0000CEB8, 0x0000CEB9, 0x0000CEBA, 0x04000CEC, 0x0000CEBC, 0x0000CEBD, 0x0000CEBE, 0x0000CEBF,
+    0x00000CEC, 0x0000CEC1, 0x0000CEC2, 0x0000CEC3, 0x0000CEC4, 0x0000CEC5, 0x0000CEC6, 0x0000CEC7,
+    0x0000CEC8, 0x0000CEC9, 0x0000CECA, 0x0000CECB, 0x08000CED, 0x0000CECD, 0x0000CECE, 0x0000CECF,
+    0x00000CED, 0x0000CED1, 0x0000CED2, 0x0000CED3, 0x0000CED4, 0x0000CED5, 0x0000CED6, 0x0000CED7,
+    0x0000CED8, 0x0000CED9, 0x0000CEDA, 0x0000CEDB, 0x0000CEDC, 0x10000CEE, 0x0000CEDE, 0x0000CEDF,
+    0x200000CF, 0x20000CF1, 0x20000CF2, 0x20000CF3, 0x20000CF4, 0x20000CF5, 0x20000CF6, 0x20000CF7,
+    0x20000CF8, 0x20000CF9, 0x20000CFA, 0x20000CFB, 0x20000CFC, 0x20000CFD, 0x20000CEF, 0x20000CFF,
+    0x00000CEF, 0x0000CEF1, 0x0000CEF2, 0x0000CEF3, 0x0000CEF4, 0x0000CEF5, 0x0000CEF6, 0x0000CEF7,
+    0x0000CEF8, 0x0000CEF9, 0x0000CEFA, 0x0000CEFB, 0x0000CEFC, 0x0000CEFD, 0x0000CEFE, 0x0000CEFF,
+    0x000000CF, 0x00000CF1, 0x00000CF2, 0x00000CF3, 0x00000CF4, 0x00000CF5, 0x00000CF6, 0x00000CF7,
+    0x00000CF8, 0x00000CF9, 0x00000CFA, 0x00000CFB, 0x00000CFC, 0x00000CFD, 0x00000CFE, 0x00000CFF,
+    0x00000CF1, 0x00010CF2, 0x0000CF12, 0x0000CF13, 0x0000CF14, 0x0000CF15, 0x0000CF16, 0x0000CF17,
+    0x0000CF18, 0x0000CF19, 0x0000CF1A, 0x0000CF1B, 0x0000CF1C, 0x0000CF1D, 0x0000CF1E, 0x0000CF1F,
+    0x00000CF2, 0x0000CF21, 0x00020CF3, 0x0000CF23, 0x0000CF24, 0x0000CF25, 0x0000CF26, 0x0000CF27,
+    0x0000CF28, 0x0000CF29, 0x0000CF2A, 0x0000CF2B, 0x0000CF2C, 0x0000CF2D, 0x0000CF2E, 0x0000CF2F,
+    0x00000CF3, 0x0000CF31, 0x0000CF32, 0x00040CF4, 0x0000CF34, 0x0000CF35, 0x0000CF36, 0x0000CF37,
+    0x0000CF38, 0x0000CF39, 0x0000CF3A, 0x0000CF3B, 0x0000CF3C, 0x0000CF3D, 0x0000CF3E, 0x0000CF3F,
+    0x00000CF4, 0x0000CF41, 0x0000CF42, 0x0000CF43, 0x00080CF5, 0x0000CF45, 0x0000CF46, 0x0000CF47,
+    0x0000CF48, 0x0000CF49, 0x0000CF4A, 0x0000CF4B, 0x0000CF4C, 0x0000CF4D, 0x0000CF4E, 0x0000CF4F,
+    0x00000CF5, 0x0000CF51, 0x0000CF52, 0x0000CF53, 0x0000CF54, 0x00100CF6, 0x0000CF56, 0x0000CF57,
+    0x0000CF58, 0x0000CF59, 0x0000CF5A, 0x0000CF5B, 0x0000CF5C, 0x0000CF5D, 0x0000CF5E, 0x0000CF5F,
+    0x00000CF6, 0x0000CF61, 0x0000CF62, 0x0000CF63, 0x0000CF64, 0x0000CF65, 0x00200CF7, 0x0000CF67,
+    0x0000CF68, 0x0000CF69, 0x0000CF6A, 0x0000CF6B, 0x0000CF6C, 0x0000CF6D, 0x0000CF6E, 0x0000CF6F,
+    0x00000CF7, 0x0000CF71, 0x0000CF72, 0x0000CF73, 0x0000CF74, 0x0000CF75, 0x0000CF76, 0x00400CF8,
+    0x0000CF78, 0x0000CF79, 0x0000CF7A, 0x0000CF7B, 0x0000CF7C, 0x0000CF7D, 0x0000CF7E, 0x0000CF7F,
+    0x00000CF8, 0x0000CF81, 0x0000CF82, 0x0000CF83, 0x0000CF84, 0x0000CF85, 0x0000CF86, 0x0000CF87,
+    0x00800CF9, 0x0000CF89, 0x0000CF8A, 0x0000CF8B, 0x0000CF8C, 0x0000CF8D, 0x0000CF8E, 0x0000CF8F,
+    0x00000CF9, 0x0000CF91, 0x0000CF92, 0x0000CF93, 0x0000CF94, 0x0000CF95, 0x0000CF96, 0x0000CF97,
+    0x0000CF98, 0x01000CFA, 0x0000CF9A, 0x0000CF9B, 0x0000CF9C, 0x0000CF9D, 0x0000CF9E, 0x0000CF9F,
+    0x00000CFA, 0x0000CFA1, 0x0000CFA2, 0x0000CFA3, 0x0000CFA4, 0x0000CFA5, 0x0000CFA6, 0x0000CFA7,
+    0x0000CFA8, 0x0000CFA9, 0x82000CFB, 0x0000CFAB, 0x0000CFAC, 0x0000CFAD, 0x0000CFAE, 0x0000CFAF,
+    0x00000CFB, 0x0000CFB1, 0x0000CFB2, 0x0000CFB3, 0x0000CFB4, 0x0000CFB5, 0x0000CFB6, 0x0000CFB7,
+    0x0000CFB8, 0x0000CFB9, 0x0000CFBA, 0x04000CFC, 0x0000CFBC, 0x0000CFBD, 0x0000CFBE, 0x0000CFBF,
+    0x00000CFC, 0x0000CFC1, 0x0000CFC2, 0x0000CFC3, 0x0000CFC4, 0x0000CFC5, 0x0000CFC6, 0x0000CFC7,
+    0x0000CFC8, 0x0000CFC9, 0x0000CFCA, 0x0000CFCB, 0x08000CFD, 0x0000CFCD, 0x0000CFCE, 0x0000CFCF,
+    0x00000CFD, 0x0000CFD1, 0x0000CFD2, 0x0000CFD3, 0x0000CFD4, 0x0000CFD5, 0x0000CFD6, 0x0000CFD7,
+    0x0000CFD8, 0x0000CFD9, 0x0000CFDA, 0x0000CFDB, 0x0000CFDC, 0x10000CFE, 0x0000CFDE, 0x0000CFDF,
+    0x00000CFE, 0x0000CFE1, 0x0000CFE2, 0x0000CFE3, 0x0000CFE4, 0x0000CFE5, 0x0000CFE6, 0x0000CFE7,
+    0x0000CFE8, 0x0000CFE9, 0x0000CFEA, 0x0000CFEB, 0x0000CFEC, 0x0000CFED, 0x20000CFF, 0x0000CFEF,
+    0x00000CFF, 0x0000CFF1, 0x0000CFF2, 0x0000CFF3, 0x0000CFF4, 0x0000CFF5, 0x0000CFF6, 0x0000CFF7,
+    0x0000CFF8, 0x0000CFF9, 0x0000CFFA, 0x0000CFFB, 0x0000CFFC, 0x0000CFFD, 0x0000CFFE, 0x0000CFFF,
+    0x0000000D, 0x000000D1, 0x000000D2, 0x000000D3, 0x000000D4, 0x000000D5, 0x000000D6, 0x000000D7,
+    0x000000D8, 0x000000D9, 0x000000DA, 0x000000DB, 0x000000DC, 0x1000000E, 0x000000DE, 0x000000DF,
+    0x000000D1, 0x000100D2, 0x00000D12, 0x00000D13, 0x00000D14, 0x00000D15, 0x00000D16, 0x00000D17,
+    0x00000D18, 0x00000D19, 0x00000D1A, 0x00000D1B, 0x00000D1C, 0x00000D1D, 0x00000D1E, 0x00000D1F,
+    0x000000D2, 0x00000D21, 0x000200D3, 0x00000D23, 0x00000D24, 0x00000D25, 0x00000D26, 0x00000D27,
+    0x00000D28, 0x00000D29, 0x00000D2A, 0x00000D2B, 0x00000D2C, 0x00000D2D, 0x00000D2E, 0x00000D2F,
+    0x000000D3, 0x00000D31, 0x00000D32, 0x000400D4, 0x00000D34, 0x00000D35, 0x00000D36, 0x00000D37,
+    0x00000D38, 0x00000D39, 0x00000D3A, 0x00000D3B, 0x00000D3C, 0x00000D3D, 0x00000D3E, 0x00000D3F,
+    0x000000D4, 0x00000D41, 0x00000D42, 0x00000D43, 0x000800D5, 0x00000D45, 0x00000D46, 0x00000D47,
+    0x00000D48, 0x00000D49, 0x00000D4A, 0x00000D4B, 0x00000D4C, 0x00000D4D, 0x00000D4E, 0x00000D4F,
+    0x000000D5, 0x00000D51, 0x00000D52, 0x00000D53, 0x00000D54, 0x001000D6, 0x00000D56, 0x00000D57,
+    0x00000D58, 0x00000D59, 0x00000D5A, 0x00000D5B, 0x00000D5C, 0x00000D5D, 0x00000D5E, 0x00000D5F,
+    0x000000D6, 0x00000D61, 0x00000D62, 0x00000D63, 0x00000D64, 0x00000D65, 0x002000D7, 0x00000D67,
+    0x00000D68, 0x00000D69, 0x00000D6A, 0x00000D6B, 0x00000D6C, 0x00000D6D, 0x00000D6E, 0x00000D6F,
+    0x000000D7, 0x00000D71, 0x00000D72, 0x00000D73, 0x00000D74, 0x00000D75, 0x00000D76, 0x004000D8,
+    0x00000D78, 0x00000D79, 0x00000D7A, 0x00000D7B, 0x00000D7C, 0x00000D7D, 0x00000D7E, 0x00000D7F,
+    0x000000D8, 0x00000D81, 0x00000D82, 0x00000D83, 0x00000D84, 0x00000D85, 0x00000D86, 0x00000D87,
+    0x008000D9, 0x00000D89, 0x00000D8A, 0x00000D8B, 0x00000D8C, 0x00000D8D, 0x00000D8E, 0x00000D8F,
+    0x000000D9, 0x00000D91, 0x00000D92, 0x00000D93, 0x00000D94, 0x00000D95, 0x00000D96, 0x00000D97,
+    0x00000D98, 0x010000DA, 0x00000D9A, 0x00000D9B, 0x00000D9C, 0x00000D9D, 0x00000D9E, 0x00000D9F,
+    0x000000DA, 0x00000DA1, 0x00000DA2, 0x00000DA3, 0x00000DA4, 0x00000DA5, 0x00000DA6, 0x00000DA7,
+    0x00000DA8, 0x00000DA9, 0x820000DB, 0x00000DAB, 0x00000DAC, 0x00000DAD, 0x00000DAE, 0x00000DAF,
+    0x000000DB, 0x00000DB1, 0x00000DB2, 0x00000DB3, 0x00000DB4, 0x00000DB5, 0x00000DB6, 0x00000DB7,
+    0x00000DB8, 0x00000DB9, 0x00000DBA, 0x040000DC, 0x00000DBC, 0x00000DBD, 0x00000DBE, 0x00000DBF,
+    0x000000DC, 0x00000DC1, 0x00000DC2, 0x00000DC3, 0x00000DC4, 0x00000DC5, 0x00000DC6, 0x00000DC7,
+    0x00000DC8, 0x00000DC9, 0x00000DCA, 0x00000DCB, 0x080000DD, 0x00000DCD, 0x00000DCE, 0x00000DCF,
+    0x1000000E, 0x100000E1, 0x100000E2, 0x100000E3, 0x100000E4, 0x100000E5, 0x100000E6, 0x100000E7,
+    0x100000E8, 0x100000E9, 0x100000EA, 0x100000EB, 0x100000EC, 0x100000DE, 0x100000EE, 0x100000EF,
+    0x000000DE, 0x00000DE1, 0x00000DE2, 0x00000DE3, 0x00000DE4, 0x00000DE5, 0x00000DE6, 0x00000DE7,
+    0x00000DE8, 0x00000DE9, 0x00000DEA, 0x00000DEB, 0x00000DEC, 0x00000DED, 0x200000DF, 0x00000DEF,
+    0x000000DF, 0x00000DF1, 0x00000DF2, 0x00000DF3, 0x00000DF4, 0x00000DF5, 0x00000DF6, 0x00000DF7,
+    0x00000DF8, 0x00000DF9, 0x00000DFA, 0x00000DFB, 0x00000DFC, 0x00000DFD, 0x00000DFE, 0x00000DFF,
+    0x000000D1, 0x000100D2, 0x00000D12, 0x00000D13, 0x00000D14, 0x00000D15, 0x00000D16, 0x00000D17,
+    0x00000D18, 0x00000D19, 0x00000D1A, 0x00000D1B, 0x00000D1C, 0x00000D1D, 0x00000D1E, 0x00000D1F,
+    0x000100D2, 0x00010D12, 0x00010D22, 0x00010D23, 0x00010D24, 0x00010D25, 0x00010D26, 0x00010D27,
+    0x00010D28, 0x00010D29, 0x00010D2A, 0x00010D2B, 0x00010D2C, 0x00010D2D, 0x00010D2E, 0x00010D2F,
+    0x00000D12, 0x0000D121, 0x00020D13, 0x0000D123, 0x0000D124, 0x0000D125, 0x0000D126, 0x0000D127,
+    0x0000D128, 0x0000D129, 0x0000D12A, 0x0000D12B, 0x0000D12C, 0x0000D12D, 0x0000D12E, 0x0000D12F,
+    0x00000D13, 0x0000D131, 0x0000D132, 0x00040D14, 0x0000D134, 0x0000D135, 0x0000D136, 0x0000D137,
+    0x0000D138, 0x0000D139, 0x0000D13A, 0x0000D13B, 0x0000D13C, 0x0000D13D, 0x0000D13E, 0x0000D13F,
+    0x00000D14, 0x0000D141, 0x0000D142, 0x0000D143, 0x00080D15, 0x0000D145, 0x0000D146, 0x0000D147,
+    0x0000D148, 0x0000D149, 0x0000D14A, 0x0000D14B, 0x0000D14C, 0x0000D14D, 0x0000D14E, 0x0000D14F,
+    0x00000D15, 0x0000D151, 0x0000D152, 0x0000D153, 0x0000D154, 0x00100D16, 0x0000D156, 0x0000D157,
+    0x0000D158, 0x0000D159, 0x0000D15A, 0x0000D15B, 0x0000D15C, 0x0000D15D, 0x0000D15E, 0x0000D15F,
+    0x00000D16, 0x0000D161, 0x0000D162, 0x0000D163, 0x0000D164, 0x0000D165, 0x00200D17, 0x0000D167,
+    0x0000D168, 0x0000D169, 0x0000D16A, 0x0000D16B, 0x0000D16C, 0x0000D16D, 0x0000D16E, 0x0000D16F,
+    0x00000D17, 0x0000D171, 0x0000D172, 0x0000D173, 0x0000D174, 0x0000D175, 0x0000D176, 0x00400D18,
+    0x0000D178, 0x0000D179, 0x0000D17A, 0x0000D17B, 0x0000D17C, 0x0000D17D, 0x0000D17E, 0x0000D17F,
+    0x00000D18, 0x0000D181, 0x0000D182, 0x0000D183, 0x0000D184, 0x0000D185, 0x0000D186, 0x0000D187,
+    0x00800D19, 0x0000D189, 0x0000D18A, 0x0000D18B, 0x0000D18C, 0x0000D18D, 0x0000D18E, 0x0000D18F,
+    0x00000D19, 0x0000D191, 0x0000D192, 0x0000D193, 0x0000D194, 0x0000D195, 0x0000D196, 0x0000D197,
+    0x0000D198, 0x01000D1A, 0x0000D19A, 0x0000D19B, 0x0000D19C, 0x0000D19D, 0x0000D19E, 0x0000D19F,
+    0x00000D1A, 0x0000D1A1, 0x0000D1A2, 0x0000D1A3, 0x0000D1A4, 0x0000D1A5, 0x0000D1A6, 0x0000D1A7,
+    0x0000D1A8, 0x0000D1A9, 0x82000D1B, 0x0000D1AB, 0x0000D1AC, 0x0000D1AD, 0x0000D1AE, 0x0000D1AF,
+    0x00000D1B, 0x0000D1B1, 0x0000D1B2, 0x0000D1B3, 0x0000D1B4, 0x0000D1B5, 0x0000D1B6, 0x0000D1B7,
+    0x0000D1B8, 0x0000D1B9, 0x0000D1BA, 0x04000D1C, 0x0000D1BC, 0x0000D1BD, 0x0000D1BE, 0x0000D1BF,
+    0x00000D1C, 0x0000D1C1, 0x0000D1C2, 0x0000D1C3, 0x0000D1C4, 0x0000D1C5, 0x0000D1C6, 0x0000D1C7,
+    0x0000D1C8, 0x0000D1C9, 0x0000D1CA, 0x0000D1CB, 0x08000D1D, 0x0000D1CD, 0x0000D1CE, 0x0000D1CF,
+    0x00000D1D, 0x0000D1D1, 0x0000D1D2, 0x0000D1D3, 0x0000D1D4, 0x0000D1D5, 0x0000D1D6, 0x0000D1D7,
+    0x0000D1D8, 0x0000D1D9, 0x0000D1DA, 0x0000D1DB, 0x0000D1DC, 0x10000D1E, 0x0000D1DE, 0x0000D1DF,
+    0x00000D1E, 0x0000D1E1, 0x0000D1E2, 0x0000D1E3, 0x0000D1E4, 0x0000D1E5, 0x0000D1E6, 0x0000D1E7,
+    0x0000D1E8, 0x0000D1E9, 0x0000D1EA, 0x0000D1EB, 0x0000D1EC, 0x0000D1ED, 0x20000D1F, 0x0000D1EF,
+    0x00000D1F, 0x0000D1F1, 0x0000D1F2, 0x0000D1F3, 0x0000D1F4, 0x0000D1F5, 0x0000D1F6, 0x0000D1F7,
+    0x0000D1F8, 0x0000D1F9, 0x0000D1FA, 0x0000D1FB, 0x0000D1FC, 0x0000D1FD, 0x0000D1FE, 0x0000D1FF,
+    0x000000D2, 0x00000D21, 0x000200D3, 0x00000D23, 0x00000D24, 0x00000D25, 0x00000D26, 0x00000D27,
+    0x00000D28, 0x00000D29, 0x00000D2A, 0x00000D2B, 0x00000D2C, 0x00000D2D, 0x00000D2E, 0x00000D2F,
+    0x00000D21, 0x00010D22, 0x0000D212, 0x0000D213, 0x0000D214, 0x0000D215, 0x0000D216, 0x0000D217,
+    0x0000D218, 0x0000D219, 0x0000D21A, 0x0000D21B, 0x0000D21C, 0x0000D21D, 0x0000D21E, 0x0000D21F,
+    0x000200D3, 0x00020D31, 0x00020D23, 0x00020D33, 0x00020D34, 0x00020D35, 0x00020D36, 0x00020D37,
+    0x00020D38, 0x00020D39, 0x00020D3A, 0x00020D3B, 0x00020D3C, 0x00020D3D, 0x00020D3E, 0x00020D3F,
+    0x00000D23, 0x0000D231, 0x0000D232, 0x00040D24, 0x0000D234, 0x0000D235, 0x0000D236, 0x0000D237,
+    0x0000D238, 0x0000D239, 0x0000D23A, 0x0000D23B, 0x0000D23C, 0x0000D23D, 0x0000D23E, 0x0000D23F,
+    0x00000D24, 0x0000D241, 0x0000D242, 0x0000D243, 0x00080D25, 0x0000D245, 0x0000D246, 0x0000D247,
+    0x0000D248, 0x0000D249, 0x0000D24A, 0x0000D24B, 0x0000D24C, 0x0000D24D, 0x0000D24E, 0x0000D24F,
+    0x00000D25, 0x0000D251, 0x0000D252, 0x0000D253, 0x0000D254, 0x00100D26, 0x0000D256, 0x0000D257,
+    0x0000D258, 0x0000D259, 0x0000D25A, 0x0000D25B, 0x0000D25C, 0x0000D25D, 0x0000D25E, 0x0000D25F,
+    0x00000D26, 0x0000D261, 0x0000D262, 0x0000D263, 0x0000D264, 0x0000D265, 0x00200D27, 0x0000D267,
+    0x0000D268, 0x0000D269, 0x0000D26A, 0x0000D26B, 0x0000D26C, 0x0000D26D, 0x0000D26E, 0x0000D26F,
+    0x00000D27, 0x0000D271, 0x0000D272, 0x0000D273, 0x0000D274, 0x0000D275, 0x0000D276, 0x00400D28,
+    0x0000D278, 0x0000D279, 0x0000D27A, 0x0000D27B, 0x0000D27C, 0x0000D27D, 0x0000D27E, 0x0000D27F,
+    0x00000D28, 0x0000D281, 0x0000D282, 0x0000D283, 0x0000D284, 0x0000D285, 0x0000D286, 0x0000D287,
+    0x00800D29, 0x0000D289, 0x0000D28A, 0x0000D28B, 0x0000D28C, 0x0000D28D, 0x0000D28E, 0x0000D28F,
+    0x00000D29, 0x0000D291, 0x0000D292, 0x0000D293, 0x0000D294, 0x0000D295, 0x0000D296, 0x0000D297,
+    0x0000D298, 0x01000D2A, 0x0000D29A, 0x0000D29B, 0x0000D29C, 0x0000D29D, 0x0000D29E, 0x0000D29F,
+    0x00000D2A, 0x0000D2A1, 0x0000D2A2, 0x0000D2A3, 0x0000D2A4, 0x0000D2A5, 0x0000D2A6, 0x0000D2A7,
+    0x0000D2A8, 0x0000D2A9, 0x82000D2B, 0x0000D2AB, 0x0000D2AC, 0x0000D2AD, 0x0000D2AE, 0x0000D2AF,
+    0x00000D2B, 0x0000D2B1, 0x0000D2B2, 0x0000D2B3, 0x0000D2B4, 0x0000D2B5, 0x0000D2B6, 0x0000D2B7,
+    0x0000D2B8, 0x0000D2B9, 0x0000D2BA, 0x04000D2C, 0x0000D2BC, 0x0000D2BD, 0x0000D2BE, 0x0000D2BF,
+    0x00000D2C, 0x0000D2C1, 0x0000D2C2, 0x0000D2C3, 0x0000D2C4, 0x0000D2C5, 0x0000D2C6, 0x0000D2C7,
+    0x0000D2C8, 0x0000D2C9, 0x0000D2CA, 0x0000D2CB, 0x08000D2D, 0x0000D2CD, 0x0000D2CE, 0x0000D2CF,
+    0x00000D2D, 0x0000D2D1, 0x0000D2D2, 0x0000D2D3, 0x0000D2D4, 0x0000D2D5, 0x0000D2D6, 0x0000D2D7,
+    0x0000D2D8, 0x0000D2D9, 0x0000D2DA, 0x0000D2DB, 0x0000D2DC, 0x10000D2E, 0x0000D2DE, 0x0000D2DF,
+    0x00000D2E, 0x0000D2E1, 0x0000D2E2, 0x0000D2E3, 0x0000D2E4, 0x0000D2E5, 0x0000D2E6, 0x0000D2E7,
+    0x0000D2E8, 0x0000D2E9, 0x0000D2EA, 0x0000D2EB, 0x0000D2EC, 0x0000D2ED, 0x20000D2F, 0x0000D2EF,
+    0x00000D2F, 0x0000D2F1, 0x0000D2F2, 0x0000D2F3, 0x0000D2F4, 0x0000D2F5, 0x0000D2F6, 0x0000D2F7,
+    0x0000D2F8, 0x0000D2F9, 0x0000D2FA, 0x0000D2FB, 0x0000D2FC, 0x0000D2FD, 0x0000D2FE, 0x0000D2FF,
+    0x000000D3, 0x00000D31, 0x00000D32, 0x000400D4, 0x00000D34, 0x00000D35, 0x00000D36, 0x00000D37,
+    0x00000D38, 0x00000D39, 0x00000D3A, 0x00000D3B, 0x00000D3C, 0x00000D3D, 0x00000D3E, 0x00000D3F,
+    0x00000D31, 0x00010D32, 0x0000D312, 0x0000D313, 0x0000D314, 0x0000D315, 0x0000D316, 0x0000D317,
+    0x0000D318, 0x0000D319, 0x0000D31A, 0x0000D31B, 0x0000D31C, 0x0000D31D, 0x0000D31E, 0x0000D31F,
+    0x00000D32, 0x0000D321, 0x00020D33, 0x0000D323, 0x0000D324, 0x0000D325, 0x0000D326, 0x0000D327,
+    0x0000D328, 0x0000D329, 0x0000D32A, 0x0000D32B, 0x0000D32C, 0x0000D32D, 0x0000D32E, 0x0000D32F,
+    0x000400D4, 0x00040D41, 0x00040D42, 0x00040D34, 0x00040D44, 0x00040D45, 0x00040D46, 0x00040D47,
+    0x00040D48, 0x00040D49, 0x00040D4A, 0x00040D4B, 0x00040D4C, 0x00040D4D, 0x00040D4E, 0x00040D4F,
+    0x00000D34, 0x0000D341, 0x0000D342, 0x0000D343, 0x00080D35, 0x0000D345, 0x0000D346, 0x0000D347,
+    0x0000D348, 0x0000D349, 0x0000D34A, 0x0000D34B, 0x0000D34C, 0x0000D34D, 0x0000D34E, 0x0000D34F,
+    0x00000D35, 0x0000D351, 0x0000D352, 0x0000D353, 0x0000D354, 0x00100D36, 0x0000D356, 0x0000D357,
+    0x0000D358, 0x0000D359, 0x0000D35A, 0x0000D35B, 0x0000D35C, 0x0000D35D, 0x0000D35E, 0x0000D35F,
+    0x00000D36, 0x0000D361, 0x0000D362, 0x0000D363, 0x0000D364, 0x0000D365, 0x00200D37, 0x0000D367,
+    0x0000D368, 0x0000D369, 0x0000D36A, 0x0000D36B, 0x0000D36C, 0x0000D36D, 0x0000D36E, 0x0000D36F,
+    0x00000D37, 0x0000D371, 0x0000D372, 0x0000D373, 0x0000D374, 0x0000D375, 0x0000D376, 0x00400D38,
+    0x0000D378, 0x0000D379, 0x0000D37A, 0x0000D37B, 0x0000D37C, 0x0000D37D, 0x0000D37E, 0x0000D37F,
+    0x00000D38, 0x0000D381, 0x0000D382, 0x0000D383, 0x0000D384, 0x0000D385, 0x0000D386, 0x0000D387,
+    0x00800D39, 0x0000D389, 0x0000D38A, 0x0000D38B, 0x0000D38C, 0x0000D38D, 0x0000D38E, 0x0000D38F,
+    0x00000D39, 0x0000D391, 0x0000D392, 0x0000D393, 0x0000D394, 0x0000D395, 0x0000D396, 0x0000D397,
+    0x0000D398, 0x01000D3A, 0x0000D39A, 0x0000D39B, 0x0000D39C, 0x0000D39D, 0x0000D39E, 0x0000D39F,
+    0x00000D3A, 0x0000D3A1, 0x0000D3A2, 0x0000D3A3, 0x0000D3A4, 0x0000D3A5, 0x0000D3A6, 0x0000D3A7,
+    0x0000D3A8, 0x0000D3A9, 0x82000D3B, 0x0000D3AB, 0x0000D3AC, 0x0000D3AD, 0x0000D3AE, 0x0000D3AF,
+    0x00000D3B, 0x0000D3B1, 0x0000D3B2, 0x0000D3B3, 0x0000D3B4, 0x0000D3B5, 0x0000D3B6, 0x0000D3B7,
+    0x0000D3B8, 0x0000D3B9, 0x0000D3BA, 0x04000D3C, 0x0000D3BC, 0x0000D3BD, 0x0000D3BE, 0x0000D3BF,
+    0x00000D3C, 0x0000D3C1, 0x0000D3C2, 0x0000D3C3, 0x0000D3C4, 0x0000D3C5, 0x0000D3C6, 0x0000D3C7,
+    0x0000D3C8, 0x0000D3C9, 0x0000D3CA, 0x0000D3CB, 0x08000D3D, 0x0000D3CD, 0x0000D3CE, 0x0000D3CF,
+    0x00000D3D, 0x0000D3D1, 0x0000D3D2, 0x0000D3D3, 0x0000D3D4, 0x0000D3D5, 0x0000D3D6, 0x0000D3D7,
+    0x0000D3D8, 0x0000D3D9, 0x0000D3DA, 0x0000D3DB, 0x0000D3DC, 0x10000D3E, 0x0000D3DE, 0x0000D3DF,
+    0x00000D3E, 0x0000D3E1, 0x0000D3E2, 0x0000D3E3, 0x0000D3E4, 0x0000D3E5, 0x0000D3E6, 0x0000D3E7,
+    0x0000D3E8, 0x0000D3E9, 0x0000D3EA, 0x0000D3EB, 0x0000D3EC, 0x0000D3ED, 0x20000D3F, 0x0000D3EF,
+    0x00000D3F, 0x0000D3F1, 0x0000D3F2, 0x0000D3F3, 0x0000D3F4, 0x0000D3F5, 0x0000D3F6, 0x0000D3F7,
+    0x0000D3F8, 0x0000D3F9, 0x0000D3FA, 0x0000D3FB, 0x0000D3FC, 0x0000D3FD, 0x0000D3FE, 0x0000D3FF,
+    0x000000D4, 0x00000D41, 0x00000D42, 0x00000D43, 0x000800D5, 0x00000D45, 0x00000D46, 0x00000D47,
+    0x00000D48, 0x00000D49, 0x00000D4A, 0x00000D4B, 0x00000D4C, 0x00000D4D, 0x00000D4E, 0x00000D4F,
+    0x00000D41, 0x00010D42, 0x0000D412, 0x0000D413, 0x0000D414, 0x0000D415, 0x0000D416, 0x0000D417,
+    0x0000D418, 0x0000D419, 0x0000D41A, 0x0000D41B, 0x0000D41C, 0x0000D41D, 0x0000D41E, 0x0000D41F,
+    0x00000D42, 0x0000D421, 0x00020D43, 0x0000D423, 0x0000D424, 0x0000D425, 0x0000D426, 0x0000D427,
+    0x0000D428, 0x0000D429, 0x0000D42A, 0x0000D42B, 0x0000D42C, 0x0000D42D, 0x0000D42E, 0x0000D42F,
+    0x00000D43, 0x0000D431, 0x0000D432, 0x00040D44, 0x0000D434, 0x0000D435, 0x0000D436, 0x0000D437,
+    0x0000D438, 0x0000D439, 0x0000D43A, 0x0000D43B, 0x0000D43C, 0x0000D43D, 0x0000D43E, 0x0000D43F,
+    0x000800D5, 0x00080D51, 0x00080D52, 0x00080D53, 0x00080D45, 0x00080D55, 0x00080D56, 0x00080D57,
+    0x00080D58, 0x00080D59, 0x00080D5A, 0x00080D5B, 0x00080D5C, 0x00080D5D, 0x00080D5E, 0x00080D5F,
+    0x00000D45, 0x0000D451, 0x0000D452, 0x0000D453, 0x0000D454, 0x00100D46, 0x0000D456, 0x0000D457,
+    0x0000D458, 0x0000D459, 0x0000D45A, 0x0000D45B, 0x0000D45C, 0x0000D45D, 0x0000D45E, 0x0000D45F,
+    0x00000D46, 0x0000D461, 0x0000D462, 0x0000D463, 0x0000D464, 0x0000D465, 0x00200D47, 0x0000D467,
+    0x0000D468, 0x0000D469, 0x0000D46A, 0x0000D46B, 0x0000D46C, 0x0000D46D, 0x0000D46E, 0x0000D46F,
+    0x00000D47, 0x0000D471, 0x0000D472, 0x0000D473, 0x0000D474, 0x0000D475, 0x0000D476, 0x00400D48,
+    0x0000D478, 0x0000D479, 0x0000D47A, 0x0000D47B, 0x0000D47C, 0x0000D47D, 0x0000D47E, 0x0000D47F,
+    0x00000D48, 0x0000D481, 0x0000D482, 0x0000D483, 0x0000D484, 0x0000D485, 0x0000D486, 0x0000D487,
+    0x00800D49, 0x0000D489, 0x0000D48A, 0x0000D48B, 0x0000D48C, 0x0000D48D, 0x0000D48E, 0x0000D48F,
+    0x00000D49, 0x0000D491, 0x0000D492, 0x0000D493, 0x0000D494, 0x0000D495, 0x0000D496, 0x0000D497,
+    0x0000D498, 0x01000D4A, 0x0000D49A, 0x0000D49B, 0x0000D49C, 0x0000D49D, 0x0000D49E, 0x0000D49F,
+    0x00000D4A, 0x0000D4A1, 0x0000D4A2, 0x0000D4A3, 0x0000D4A4, 0x0000D4A5, 0x0000D4A6, 0x0000D4A7,
+    0x0000D4A8, 0x0000D4A9, 0x82000D4B, 0x0000D4AB, 0x0000D4AC, 0x0000D4AD, 0x0000D4AE, 0x0000D4AF,
+    0x00000D4B, 0x0000D4B1, 0x0000D4B2, 0x0000D4B3, 0x0000D4B4, 0x0000D4B5, 0x0000D4B6, 0x0000D4B7,
+    0x0000D4B8, 0x0000D4B9, 0x0000D4BA, 0x04000D4C, 0x0000D4BC, 0x0000D4BD, 0x0000D4BE, 0x0000D4BF,
+    0x00000D4C, 0x0000D4C1, 0x0000D4C2, 0x0000D4C3, 0x0000D4C4, 0x0000D4C5, 0x0000D4C6, 0x0000D4C7,
+    0x0000D4C8, 0x0000D4C9, 0x0000D4CA, 0x0000D4CB, 0x08000D4D, 0x0000D4CD, 0x0000D4CE, 0x0000D4CF,
+    0x00000D4D, 0x0000D4D1, 0x0000D4D2, 0x0000D4D3, 0x0000D4D4, 0x0000D4D5, 0x0000D4D6, 0x0000D4D7,
+    0x0000D4D8, 0x0000D4D9, 0x0000D4DA, 0x0000D4DB, 0x0000D4DC, 0x10000D4E, 0x0000D4DE, 0x0000D4DF,
+    0x00000D4E, 0x0000D4E1, 0x0000D4E2, 0x0000D4E3, 0x0000D4E4, 0x0000D4E5, 0x0000D4E6, 0x0000D4E7,
+    0x0000D4E8, 0x0000D4E9, 0x0000D4EA, 0x0000D4EB, 0x0000D4EC, 0x0000D4ED, 0x20000D4F, 0x0000D4EF,
+    0x00000D4F, 0x0000D4F1, 0x0000D4F2, 0x0000D4F3, 0x0000D4F4, 0x0000D4F5, 0x0000D4F6, 0x0000D4F7,
+    0x0000D4F8, 0x0000D4F9, 0x0000D4FA, 0x0000D4FB, 0x0000D4FC, 0x0000D4FD, 0x0000D4FE, 0x0000D4FF,
+    0x000000D5, 0x00000D51, 0x00000D52, 0x00000D53, 0x00000D54, 0x001000D6, 0x00000D56, 0x00000D57,
+    0x00000D58, 0x00000D59, 0x00000D5A, 0x00000D5B, 0x00000D5C, 0x00000D5D, 0x00000D5E, 0x00000D5F,
+    0x00000D51, 0x00010D52, 0x0000D512, 0x0000D513, 0x0000D514, 0x0000D515, 0x0000D516, 0x0000D517,
+    0x0000D518, 0x0000D519, 0x0000D51A, 0x0000D51B, 0x0000D51C, 0x0000D51D, 0x0000D51E, 0x0000D51F,
+    0x00000D52, 0x0000D521, 0x00020D53, 0x0000D523, 0x0000D524, 0x0000D525, 0x0000D526, 0x0000D527,
+    0x0000D528, 0x0000D529, 0x0000D52A, 0x0000D52B, 0x0000D52C, 0x0000D52D, 0x0000D52E, 0x0000D52F,
+    0x00000D53, 0x0000D531, 0x0000D532, 0x00040D54, 0x0000D534, 0x0000D535, 0x0000D536, 0x0000D537,
+    0x0000D538, 0x0000D539, 0x0000D53A, 0x0000D53B, 0x0000D53C, 0x0000D53D, 0x0000D53E, 0x0000D53F,
+    0x00000D54, 0x0000D541, 0x0000D542, 0x0000D543, 0x00080D55, 0x0000D545, 0x0000D546, 0x0000D547,
+    0x0000D548, 0x0000D549, 0x0000D54A, 0x0000D54B, 0x0000D54C, 0x0000D54D, 0x0000D54E, 0x0000D54F,
+    0x001000D6, 0x00100D61, 0x00100D62, 0x00100D63, 0x00100D64, 0x00100D56, 0x00100D66, 0x00100D67,
+    0x00100D68, 0x00100D69, 0x00100D6A, 0x00100D6B, 0x00100D6C, 0x00100D6D, 0x00100D6E, 0x00100D6F,
+    0x00000D56, 0x0000D561, 0x0000D562, 0x0000D563, 0x0000D564, 0x0000D565, 0x00200D57, 0x0000D567,
+    0x0000D568, 0x0000D569, 0x0000D56A, 0x0000D56B, 0x0000D56C, 0x0000D56D, 0x0000D56E, 0x0000D56F,
+    0x00000D57, 0x0000D571, 0x0000D572, 0x0000D573, 0x0000D574, 0x0000D575, 0x0000D576, 0x00400D58,
+    0x0000D578, 0x0000D579, 0x0000D57A, 0x0000D57B, 0x0000D57C, 0x0000D57D, 0x0000D57E, 0x0000D57F,
+    0x00000D58, 0x0000D581, 0x0000D582, 0x0000D583, 0x0000D584, 0x0000D585, 0x0000D586, 0x0000D587,
+    0x00800D59, 0x0000D589, 0x0000D58A, 0x0000D58B, 0x0000D58C, 0x0000D58D, 0x0000D58E, 0x0000D58F,
+    0x00000D59, 0x0000D591, 0x0000D592, 0x0000D593, 0x0000D594, 0x0000D595, 0x0000D596, 0x0000D597,
+    0x0000D598, 0x01000D5A, 0x0000D59A, 0x0000D59B, 0x0000D59C, 0x0000D59D, 0x0000D59E, 0x0000D59F,
+    0x00000D5A, 0x0000D5A1, 0x0000D5A2, 0x0000D5A3, 0x0000D5A4, 0x0000D5A5, 0x0000D5A6, 0x0000D5A7,
+    0x0000D5A8, 0x0000D5A9, 0x82000D5B, 0x0000D5AB, 0x0000D5AC, 0x0000D5AD, 0x0000D5AE, 0x0000D5AF,
+    0x00000D5B, 0x0000D5B1, 0x0000D5B2, 0x0000D5B3, 0x0000D5B4, 0x0000D5B5, 0x0000D5B6, 0x0000D5B7,
+    0x0000D5B8, 0x0000D5B9, 0x0000D5BA, 0x04000D5C, 0x0000D5BC, 0x0000D5BD, 0x0000D5BE, 0x0000D5BF,
+    0x00000D5C, 0x0000D5C1, 0x0000D5C2, 0x0000D5C3, 0x0000D5C4, 0x0000D5C5, 0x0000D5C6, 0x0000D5C7,
+    0x0000D5C8, 0x0000D5C9, 0x0000D5CA, 0x0000D5CB, 0x08000D5D, 0x0000D5CD, 0x0000D5CE, 0x0000D5CF,
+    0x00000D5D, 0x0000D5D1, 0x0000D5D2, 0x0000D5D3, 0x0000D5D4, 0x0000D5D5, 0x0000D5D6, 0x0000D5D7,
+    0x0000D5D8, 0x0000D5D9, 0x0000D5DA, 0x0000D5DB, 0x0000D5DC, 0x10000D5E, 0x0000D5DE, 0x0000D5DF,
+    0x00000D5E, 0x0000D5E1, 0x0000D5E2, 0x0000D5E3, 0x0000D5E4, 0x0000D5E5, 0x0000D5E6, 0x0000D5E7,
+    0x0000D5E8, 0x0000D5E9, 0x0000D5EA, 0x0000D5EB, 0x0000D5EC, 0x0000D5ED, 0x20000D5F, 0x0000D5EF,
+    0x00000D5F, 0x0000D5F1, 0x0000D5F2, 0x0000D5F3, 0x0000D5F4, 0x0000D5F5, 0x0000D5F6, 0x0000D5F7,
+    0x0000D5F8, 0x0000D5F9, 0x0000D5FA, 0x0000D5FB, 0x0000D5FC, 0x0000D5FD, 0x0000D5FE, 0x0000D5FF,
+    0x000000D6, 0x00000D61, 0x00000D62, 0x00000D63, 0x00000D64, 0x00000D65, 0x002000D7, 0x00000D67,
+    0x00000D68, 0x00000D69, 0x00000D6A, 0x00000D6B, 0x00000D6C, 0x00000D6D, 0x00000D6E, 0x00000D6F,
+    0x00000D61, 0x00010D62, 0x0000D612, 0x0000D613, 0x0000D614, 0x0000D615, 0x0000D616, 0x0000D617,
+    0x0000D618, 0x0000D619, 0x0000D61A, 0x0000D61B, 0x0000D61C, 0x0000D61D, 0x0000D61E, 0x0000D61F,
+    0x00000D62, 0x0000D621, 0x00020D63, 0x0000D623, 0x0000D624, 0x0000D625, 0x0000D626, 0x0000D627,
+    0x0000D628, 0x0000D629, 0x0000D62A, 0x0000D62B, 0x0000D62C, 0x0000D62D, 0x0000D62E, 0x0000D62F,
+    0x00000D63, 0x0000D631, 0x0000D632, 0x00040D64, 0x0000D634, 0x0000D635, 0x0000D636, 0x0000D637,
+    0x0000D638, 0x0000D639, 0x0000D63A, 0x0000D63B, 0x0000D63C, 0x0000D63D, 0x0000D63E, 0x0000D63F,
+    0x00000D64, 0x0000D641, 0x0000D642, 0x0000D643, 0x00080D65, 0x0000D645, 0x0000D646, 0x0000D647,
+    0x0000D648, 0x0000D649, 0x0000D64A, 0x0000D64B, 0x0000D64C, 0x0000D64D, 0x0000D64E, 0x0000D64F,
+    0x00000D65, 0x0000D651, 0x0000D652, 0x0000D653, 0x0000D654, 0x00100D66, 0x0000D656, 0x0000D657,
+    0x0000D658, 0x0000D659, 0x0000D65A, 0x0000D65B, 0x0000D65C, 0x0000D65D, 0x0000D65E, 0x0000D65F,
+    0x002000D7, 0x00200D71, 0x00200D72, 0x00200D73, 0x00200D74, 0x00200D75, 0x00200D67, 0x00200D77,
+    0x00200D78, 0x00200D79, 0x00200D7A, 0x00200D7B, 0x00200D7C, 0x00200D7D, 0x00200D7E, 0x00200D7F,
+    0x00000D67, 0x0000D671, 0x0000D672, 0x0000D673, 0x0000D674, 0x0000D675, 0x0000D676, 0x00400D68,
+    0x0000D678, 0x0000D679, 0x0000D67A, 0x0000D67B, 0x0000D67C, 0x0000D67D, 0x0000D67E, 0x0000D67F,
+    0x00000D68, 0x0000D681, 0x0000D682, 0x0000D683, 0x0000D684, 0x0000D685, 0x0000D686, 0x0000D687,
+    0x00800D69, 0x0000D689, 0x0000D68A, 0x0000D68B, 0x0000D68C, 0x0000D68D, 0x0000D68E, 0x0000D68F,
+    0x00000D69, 0x0000D691, 0x0000D692, 0x0000D693, 0x0000D694, 0x0000D695, 0x0000D696, 0x0000D697,
+    0x0000D698, 0x01000D6A, 0x0000D69A, 0x0000D69B, 0x0000D69C, 0x0000D69D, 0x0000D69E, 0x0000D69F,
+    0x00000D6A, 0x0000D6A1, 0x0000D6A2, 0x0000D6A3, 0x0000D6A4, 0x0000D6A5, 0x0000D6A6, 0x0000D6A7,
+    0x0000D6A8, 0x0000D6A9, 0x82000D6B, 0x0000D6AB, 0x0000D6AC, 0x0000D6AD, 0x0000D6AE, 0x0000D6AF,
+    0x00000D6B, 0x0000D6B1, 0x0000D6B2, 0x0000D6B3, 0x0000D6B4, 0x0000D6B5, 0x0000D6B6, 0x0000D6B7,
+    0x0000D6B8, 0x0000D6B9, 0x0000D6BA, 0x04000D6C, 0x0000D6BC, 0x0000D6BD, 0x0000D6BE, 0x0000D6BF,
+    0x00000D6C, 0x0000D6C1, 0x0000D6C2, 0x0000D6C3, 0x0000D6C4, 0x0000D6C5, 0x0000D6C6, 0x0000D6C7,
+    0x0000D6C8, 0x0000D6C9, 0x0000D6CA, 0x0000D6CB, 0x08000D6D, 0x0000D6CD, 0x0000D6CE, 0x0000D6CF,
+    0x00000D6D, 0x0000D6D1, 0x0000D6D2, 0x0000D6D3, 0x0000D6D4, 0x0000D6D5, 0x0000D6D6, 0x0000D6D7,
+    0x0000D6D8, 0x0000D6D9, 0x0000D6DA, 0x0000D6DB, 0x0000D6DC, 0x10000D6E, 0x0000D6DE, 0x0000D6DF,
+    0x00000D6E, 0x0000D6E1, 0x0000D6E2, 0x0000D6E3, 0x0000D6E4, 0x0000D6E5, 0x0000D6E6, 0x0000D6E7,
+    0x0000D6E8, 0x0000D6E9, 0x0000D6EA, 0x0000D6EB, 0x0000D6EC, 0x0000D6ED, 0x20000D6F, 0x0000D6EF,
+    0x00000D6F, 0x0000D6F1, 0x0000D6F2, 0x0000D6F3, 0x0000D6F4, 0x0000D6F5, 0x0000D6F6, 0x0000D6F7,
+    0x0000D6F8, 0x0000D6F9, 0x0000D6FA, 0x0000D6FB, 0x0000D6FC, 0x0000D6FD, 0x0000D6FE, 0x0000D6FF,
+    0x000000D7, 0x00000D71, 0x00000D72, 0x00000D73, 0x00000D74, 0x00000D75, 0x00000D76, 0x004000D8,
+    0x00000D78, 0x00000D79, 0x00000D7A, 0x00000D7B, 0x00000D7C, 0x00000D7D, 0x00000D7E, 0x00000D7F,
+    0x00000D71, 0x00010D72, 0x0000D712, 0x0000D713, 0x0000D714, 0x0000D715, 0x0000D716, 0x0000D717,
+    0x0000D718, 0x0000D719, 0x0000D71A, 0x0000D71B, 0x0000D71C, 0x0000D71D, 0x0000D71E, 0x0000D71F,
+    0x00000D72, 0x0000D721, 0x00020D73, 0x0000D723, 0x0000D724, 0x0000D725, 0x0000D726, 0x0000D727,
+    0x0000D728, 0x0000D729, 0x0000D72A, 0x0000D72B, 0x0000D72C, 0x0000D72D, 0x0000D72E, 0x0000D72F,
+    0x00000D73, 0x0000D731, 0x0000D732, 0x00040D74, 0x0000D734, 0x0000D735, 0x0000D736, 0x0000D737,
+    0x0000D738, 0x0000D739, 0x0000D73A, 0x0000D73B, 0x0000D73C, 0x0000D73D, 0x0000D73E, 0x0000D73F,
+    0x00000D74, 0x0000D741, 0x0000D742, 0x0000D743, 0x00080D75, 0x0000D745, 0x0000D746, 0x0000D747,
+    0x0000D748, 0x0000D749, 0x0000D74A, 0x0000D74B, 0x0000D74C, 0x0000D74D, 0x0000D74E, 0x0000D74F,
+    0x00000D75, 0x0000D751, 0x0000D752, 0x0000D753, 0x0000D754, 0x00100D76, 0x0000D756, 0x0000D757,
+    0x0000D758, 0x0000D759, 0x0000D75A, 0x0000D75B, 0x0000D75C, 0x0000D75D, 0x0000D75E, 0x0000D75F,
+    0x00000D76, 0x0000D761, 0x0000D762, 0x0000D763, 0x0000D764, 0x0000D765, 0x00200D77, 0x0000D767,
+    0x0000D768, 0x0000D769, 0x0000D76A, 0x0000D76B, 0x0000D76C, 0x0000D76D, 0x0000D76E, 0x0000D76F,
+    0x004000D8, 0x00400D81, 0x00400D82, 0x00400D83, 0x00400D84, 0x00400D85, 0x00400D86, 0x00400D78,
+    0x00400D88, 0x00400D89, 0x00400D8A, 0x00400D8B, 0x00400D8C, 0x00400D8D, 0x00400D8E, 0x00400D8F,
+    0x00000D78, 0x0000D781, 0x0000D782, 0x0000D783, 0x0000D784, 0x0000D785, 0x0000D786, 0x0000D787,
+    0x00800D79, 0x0000D789, 0x0000D78A, 0x0000D78B, 0x0000D78C, 0x0000D78D, 0x0000D78E, 0x0000D78F,
+    0x00000D79, 0x0000D791, 0x0000D792, 0x0000D793, 0x0000D794, 0x0000D795, 0x0000D796, 0x0000D797,
+    0x0000D798, 0x01000D7A, 0x0000D79A, 0x0000D79B, 0x0000D79C, 0x0000D79D, 0x0000D79E, 0x0000D79F,
+    0x00000D7A, 0x0000D7A1, 0x0000D7A2, 0x0000D7A3, 0x0000D7A4, 0x0000D7A5, 0x0000D7A6, 0x0000D7A7,
+    0x0000D7A8, 0x0000D7A9, 0x82000D7B, 0x0000D7AB, 0x0000D7AC, 0x0000D7AD, 0x0000D7AE, 0x0000D7AF,
+    0x00000D7B, 0x0000D7B1, 0x0000D7B2, 0x0000D7B3, 0x0000D7B4, 0x0000D7B5, 0x0000D7B6, 0x0000D7B7,
+    0x0000D7B8, 0x0000D7B9, 0x0000D7BA, 0x04000D7C, 0x0000D7BC, 0x0000D7BD, 0x0000D7BE, 0x0000D7BF,
+    0x00000D7C, 0x0000D7C1, 0x0000D7C2, 0x0000D7C3, 0x0000D7C4, 0x0000D7C5, 0x0000D7C6, 0x0000D7C7,
+    0x0000D7C8, 0x0000D7C9, 0x0000D7CA, 0x0000D7CB, 0x08000D7D, 0x0000D7CD, 0x0000D7CE, 0x0000D7CF,
+    0x00000D7D, 0x0000D7D1, 0x0000D7D2, 0x0000D7D3, 0x0000D7D4, 0x0000D7D5, 0x0000D7D6, 0x0000D7D7,
+    0x0000D7D8, 0x0000D7D9, 0x0000D7DA, 0x0000D7DB, 0x0000D7DC, 0x10000D7E, 0x0000D7DE, 0x0000D7DF,
+    0x00000D7E, 0x0000D7E1, 0x0000D7E2, 0x0000D7E3, 0x0000D7E4, 0x0000D7E5, 0x0000D7E6, 0x0000D7E7,
+    0x0000D7E8, 0x0000D7E9, 0x0000D7EA, 0x0000D7EB, 0x0000D7EC, 0x0000D7ED, 0x20000D7F, 0x0000D7EF,
+    0x00000D7F, 0x0000D7F1, 0x0000D7F2, 0x0000D7F3, 0x0000D7F4, 0x0000D7F5, 0x0000D7F6, 0x0000D7F7,
+    0x0000D7F8, 0x0000D7F9, 0x0000D7FA, 0x0000D7FB, 0x0000D7FC, 0x0000D7FD, 0x0000D7FE, 0x0000D7FF,
+    0x000000D8, 0x00000D81, 0x00000D82, 0x00000D83, 0x00000D84, 0x00000D85, 0x00000D86, 0x00000D87,
+    0x008000D9, 0x00000D89, 0x00000D8A, 0x00000D8B, 0x00000D8C, 0x00000D8D, 0x00000D8E, 0x00000D8F,
+    0x00000D81, 0x00010D82, 0x0000D812, 0x0000D813, 0x0000D814, 0x0000D815, 0x0000D816, 0x0000D817,
+    0x0000D818, 0x0000D819, 0x0000D81A, 0x0000D81B, 0x0000D81C, 0x0000D81D, 0x0000D81E, 0x0000D81F,
+    0x00000D82, 0x0000D821, 0x00020D83, 0x0000D823, 0x0000D824, 0x0000D825, 0x0000D826, 0x0000D827,
+    0x0000D828, 0x0000D829, 0x0000D82A, 0x0000D82B, 0x0000D82C, 0x0000D82D, 0x0000D82E, 0x0000D82F,
+    0x00000D83, 0x0000D831, 0x0000D832, 0x00040D84, 0x0000D834, 0x0000D835, 0x0000D836, 0x0000D837,
+    0x0000D838, 0x0000D839, 0x0000D83A, 0x0000D83B, 0x0000D83C, 0x0000D83D, 0x0000D83E, 0x0000D83F,
+    0x00000D84, 0x0000D841, 0x0000D842, 0x0000D843, 0x00080D85, 0x0000D845, 0x0000D846, 0x0000D847,
+    0x0000D848, 0x0000D849, 0x0000D84A, 0x0000D84B, 0x0000D84C, 0x0000D84D, 0x0000D84E, 0x0000D84F,
+    0x00000D85, 0x0000D851, 0x0000D852, 0x0000D853, 0x0000D854, 0x00100D86, 0x0000D856, 0x0000D857,
+    0x0000D858, 0x0000D859, 0x0000D85A, 0x0000D85B, 0x0000D85C, 0x0000D85D, 0x0000D85E, 0x0000D85F,
+    0x00000D86, 0x0000D861, 0x0000D862, 0x0000D863, 0x0000D864, 0x0000D865, 0x00200D87, 0x0000D867,
+    0x0000D868, 0x0000D869, 0x0000D86A, 0x0000D86B, 0x0000D86C, 0x0000D86D, 0x0000D86E, 0x0000D86F,
+    0x00000D87, 0x0000D871, 0x0000D872, 0x0000D873, 0x0000D874, 0x0000D875, 0x0000D876, 0x00400D88,
+    0x0000D878, 0x0000D879, 0x0000D87A, 0x0000D87B, 0x0000D87C, 0x0000D87D, 0x0000D87E, 0x0000D87F,
+    0x008000D9, 0x00800D91, 0x00800D92, 0x00800D93, 0x00800D94, 0x00800D95, 0x00800D96, 0x00800D97,
+    0x00800D89, 0x00800D99, 0x00800D9A, 0x00800D9B, 0x00800D9C, 0x00800D9D, 0x00800D9E, 0x00800D9F,
+    0x00000D89, 0x0000D891, 0x0000D892, 0x0000D893, 0x0000D894, 0x0000D895, 0x0000D896, 0x0000D897,
+    0x0000D898, 0x01000D8A, 0x0000D89A, 0x0000D89B, 0x0000D89C, 0x0000D89D, 0x0000D89E, 0x0000D89F,
+    0x00000D8A, 0x0000D8A1, 0x0000D8A2, 0x0000D8A3, 0x0000D8A4, 0x0000D8A5, 0x0000D8A6, 0x0000D8A7,
+    0x0000D8A8, 0x0000D8A9, 0x82000D8B, 0x0000D8AB, 0x0000D8AC, 0x0000D8AD, 0x0000D8AE, 0x0000D8AF,
+    0x00000D8B, 0x0000D8B1, 0x0000D8B2, 0x0000D8B3, 0x0000D8B4, 0x0000D8B5, 0x0000D8B6, 0x0000D8B7,
+    0x0000D8B8, 0x0000D8B9, 0x0000D8BA, 0x04000D8C, 0x0000D8BC, 0x0000D8BD, 0x0000D8BE, 0x0000D8BF,
+    0x00000D8C, 0x0000D8C1, 0x0000D8C2, 0x0000D8C3, 0x0000D8C4, 0x0000D8C5, 0x0000D8C6, 0x0000D8C7,
+    0x0000D8C8, 0x0000D8C9, 0x0000D8CA, 0x0000D8CB, 0x08000D8D, 0x0000D8CD, 0x0000D8CE, 0x0000D8CF,
+    0x00000D8D, 0x0000D8D1, 0x0000D8D2, 0x0000D8D3, 0x0000D8D4, 0x0000D8D5, 0x0000D8D6, 0x0000D8D7,
+    0x0000D8D8, 0x0000D8D9, 0x0000D8DA, 0x0000D8DB, 0x0000D8DC, 0x10000D8E, 0x0000D8DE, 0x0000D8DF,
+    0x00000D8E, 0x0000D8E1, 0x0000D8E2, 0x0000D8E3, 0x0000D8E4, 0x0000D8E5, 0x0000D8E6, 0x0000D8E7,
+    0x0000D8E8, 0x0000D8E9, 0x0000D8EA, 0x0000D8EB, 0x0000D8EC, 0x0000D8ED, 0x20000D8F, 0x0000D8EF,
+    0x00000D8F, 0x0000D8F1, 0x0000D8F2, 0x0000D8F3, 0x0000D8F4, 0x0000D8F5, 0x0000D8F6, 0x0000D8F7,
+    0x0000D8F8, 0x0000D8F9, 0x0000D8FA, 0x0000D8FB, 0x0000D8FC, 0x0000D8FD, 0x0000D8FE, 0x0000D8FF,
+    0x000000D9, 0x00000D91, 0x00000D92, 0x00000D93, 0x00000D94, 0x00000D95, 0x00000D96, 0x00000D97,
+    0x00000D98, 0x010000DA, 0x00000D9A, 0x00000D9B, 0x00000D9C, 0x00000D9D, 0x00000D9E, 0x00000D9F,
+    0x00000D91, 0x00010D92, 0x0000D912, 0x0000D913, 0x0000D914, 0x0000D915, 0x0000D916, 0x0000D917,
+    0x0000D918, 0x0000D919, 0x0000D91A, 0x0000D91B, 0x0000D91C, 0x0000D91D, 0x0000D91E, 0x0000D91F,
+    0x00000D92, 0x0000D921, 0x00020D93, 0x0000D923, 0x0000D924, 0x0000D925, 0x0000D926, 0x0000D927,
+    0x0000D928, 0x0000D929, 0x0000D92A, 0x0000D92B, 0x0000D92C, 0x0000D92D, 0x0000D92E, 0x0000D92F,
+    0x00000D93, 0x0000D931, 0x0000D932, 0x00040D94, 0x0000D934, 0x0000D935, 0x0000D936, 0x0000D937,
+    0x0000D938, 0x0000D939, 0x0000D93A, 0x0000D93B, 0x0000D93C, 0x0000D93D, 0x0000D93E, 0x0000D93F,
+    0x00000D94, 0x0000D941, 0x0000D942, 0x0000D943, 0x00080D95, 0x0000D945, 0x0000D946, 0x0000D947,
+    0x0000D948, 0x0000D949, 0x0000D94A, 0x0000D94B, 0x0000D94C, 0x0000D94D, 0x0000D94E, 0x0000D94F,
+    0x00000D95, 0x0000D951, 0x0000D952, 0x0000D953, 0x0000D954, 0x00100D96, 0x0000D956, 0x0000D957,
+    0x0000D958, 0x0000D959, 0x0000D95A, 0x0000D95B, 0x0000D95C, 0x0000D95D, 0x0000D95E, 0x0000D95F,
+    0x00000D96, 0x0000D961, 0x0000D962, 0x0000D963, 0x0000D964, 0x0000D965, 0x00200D97, 0x0000D967,
+    0x0000D968, 0x0000D969, 0x0000D96A, 0x0000D96B, 0x0000D96C, 0x0000D96D, 0x0000D96E, 0x0000D96F,
+    0x00000D97, 0x0000D971, 0x0000D972, 0x0000D973, 0x0000D974, 0x0000D975, 0x0000D976, 0x00400D98,
+    0x0000D978, 0x0000D979, 0x0000D97A, 0x0000D97B, 0x0000D97C, 0x0000D97D, 0x0000D97E, 0x0000D97F,
+    0x00000D98, 0x0000D981, 0x0000D982, 0x0000D983, 0x0000D984, 0x0000D985, 0x0000D986, 0x0000D987,
+    0x00800D99, 0x0000D989, 0x0000D98A, 0x0000D98B, 0x0000D98C, 0x0000D98D, 0x0000D98E, 0x0000D98F,
+    0x010000DA, 0x01000DA1, 0x01000DA2, 0x01000DA3, 0x01000DA4, 0x01000DA5, 0x01000DA6, 0x01000DA7,
+    0x01000DA8, 0x01000D9A, 0x01000DAA, 0x01000DAB, 0x01000DAC, 0x01000DAD, 0x01000DAE, 0x01000DAF,
+    0x00000D9A, 0x0000D9A1, 0x0000D9A2, 0x0000D9A3, 0x0000D9A4, 0x0000D9A5, 0x0000D9A6, 0x0000D9A7,
+    0x0000D9A8, 0x0000D9A9, 0x82000D9B, 0x0000D9AB, 0x0000D9AC, 0x0000D9AD, 0x0000D9AE, 0x0000D9AF,
+    0x00000D9B, 0x0000D9B1, 0x0000D9B2, 0x0000D9B3, 0x0000D9B4, 0x0000D9B5, 0x0000D9B6, 0x0000D9B7,
+    0x0000D9B8, 0x0000D9B9, 0x0000D9BA, 0x04000D9C, 0x0000D9BC, 0x0000D9BD, 0x0000D9BE, 0x0000D9BF,
+    0x00000D9C, 0x0000D9C1, 0x0000D9C2, 0x0000D9C3, 0x0000D9C4, 0x0000D9C5, 0x0000D9C6, 0x0000D9C7,
+    0x0000D9C8, 0x0000D9C9, 0x0000D9CA, 0x0000D9CB, 0x08000D9D, 0x0000D9CD, 0x0000D9CE, 0x0000D9CF,
+    0x00000D9D, 0x0000D9D1, 0x0000D9D2, 0x0000D9D3, 0x0000D9D4, 0x0000D9D5, 0x0000D9D6, 0x0000D9D7,
+    0x0000D9D8, 0x0000D9D9, 0x0000D9DA, 0x0000D9DB, 0x0000D9DC, 0x10000D9E, 0x0000D9DE, 0x0000D9DF,
+    0x00000D9E, 0x0000D9E1, 0x0000D9E2, 0x0000D9E3, 0x0000D9E4, 0x0000D9E5, 0x0000D9E6, 0x0000D9E7,
+    0x0000D9E8, 0x0000D9E9, 0x0000D9EA, 0x0000D9EB, 0x0000D9EC, 0x0000D9ED, 0x20000D9F, 0x0000D9EF,
+    0x00000D9F, 0x0000D9F1, 0x0000D9F2, 0x0000D9F3, 0x0000D9F4, 0x0000D9F5, 0x0000D9F6, 0x0000D9F7,
+    0x0000D9F8, 0x0000D9F9, 0x0000D9FA, 0x0000D9FB, 0x0000D9FC, 0x0000D9FD, 0x0000D9FE, 0x0000D9FF,
+    0x000000DA, 0x00000DA1, 0x00000DA2, 0x00000DA3, 0x00000DA4, 0x00000DA5, 0x00000DA6, 0x00000DA7,
+    0x00000DA8, 0x00000DA9, 0x820000DB, 0x00000DAB, 0x00000DAC, 0x00000DAD, 0x00000DAE, 0x00000DAF,
+    0x00000DA1, 0x00010DA2, 0x0000DA12, 0x0000DA13, 0x0000DA14, 0x0000DA15, 0x0000DA16, 0x0000DA17,
+    0x0000DA18, 0x0000DA19, 0x0000DA1A, 0x0000DA1B, 0x0000DA1C, 0x0000DA1D, 0x0000DA1E, 0x0000DA1F,
+    0x00000DA2, 0x0000DA21, 0x00020DA3, 0x0000DA23, 0x0000DA24, 0x0000DA25, 0x0000DA26, 0x0000DA27,
+    0x0000DA28, 0x0000DA29, 0x0000DA2A, 0x0000DA2B, 0x0000DA2C, 0x0000DA2D, 0x0000DA2E, 0x0000DA2F,
+    0x00000DA3, 0x0000DA31, 0x0000DA32, 0x00040DA4, 0x0000DA34, 0x0000DA35, 0x0000DA36, 0x0000DA37,
+    0x0000DA38, 0x0000DA39, 0x0000DA3A, 0x0000DA3B, 0x0000DA3C, 0x0000DA3D, 0x0000DA3E, 0x0000DA3F,
+    0x00000DA4, 0x0000DA41, 0x0000DA42, 0x0000DA43, 0x00080DA5, 0x0000DA45, 0x0000DA46, 0x0000DA47,
+    0x0000DA48, 0x0000DA49, 0x0000DA4A, 0x0000DA4B, 0x0000DA4C, 0x0000DA4D, 0x0000DA4E, 0x0000DA4F,
+    0x00000DA5, 0x0000DA51, 0x0000DA52, 0x0000DA53, 0x0000DA54, 0x00100DA6, 0x0000DA56, 0x0000DA57,
+    0x0000DA58, 0x0000DA59, 0x0000DA5A, 0x0000DA5B, 0x0000DA5C, 0x0000DA5D, 0x0000DA5E, 0x0000DA5F,
+    0x00000DA6, 0x0000DA61, 0x0000DA62, 0x0000DA63, 0x0000DA64, 0x0000DA65, 0x00200DA7, 0x0000DA67,
+    0x0000DA68, 0x0000DA69, 0x0000DA6A, 0x0000DA6B, 0x0000DA6C, 0x0000DA6D, 0x0000DA6E, 0x0000DA6F,
+    0x00000DA7, 0x0000DA71, 0x0000DA72, 0x0000DA73, 0x0000DA74, 0x0000DA75, 0x0000DA76, 0x00400DA8,
+    0x0000DA78, 0x0000DA79, 0x0000DA7A, 0x0000DA7B, 0x0000DA7C, 0x0000DA7D, 0x0000DA7E, 0x0000DA7F,
+    0x00000DA8, 0x0000DA81, 0x0000DA82, 0x0000DA83, 0x0000DA84, 0x0000DA85, 0x0000DA86, 0x0000DA87,
+    0x00800DA9, 0x0000DA89, 0x0000DA8A, 0x0000DA8B, 0x0000DA8C, 0x0000DA8D, 0x0000DA8E, 0x0000DA8F,
+    0x00000DA9, 0x0000DA91, 0x0000DA92, 0x0000DA93, 0x0000DA94, 0x0000DA95, 0x0000DA96, 0x0000DA97,
+    0x0000DA98, 0x01000DAA, 0x0000DA9A, 0x0000DA9B, 0x0000DA9C, 0x0000DA9D, 0x0000DA9E, 0x0000DA9F,
+    0x820000DB, 0x82000DB1, 0x82000DB2, 0x82000DB3, 0x82000DB4, 0x82000DB5, 0x82000DB6, 0x82000DB7,
+    0x82000DB8, 0x82000DB9, 0x82000DAB, 0x82000DBB, 0x82000DBC, 0x82000DBD, 0x82000DBE, 0x82000DBF,
+    0x00000DAB, 0x0000DAB1, 0x0000DAB2, 0x0000DAB3, 0x0000DAB4, 0x0000DAB5, 0x0000DAB6, 0x0000DAB7,
+    0x0000DAB8, 0x0000DAB9, 0x0000DABA, 0x04000DAC, 0x0000DABC, 0x0000DABD, 0x0000DABE, 0x0000DABF,
+    0x00000DAC, 0x0000DAC1, 0x0000DAC2, 0x0000DAC3, 0x0000DAC4, 0x0000DAC5, 0x0000DAC6, 0x0000DAC7,
+    0x0000DAC8, 0x0000DAC9, 0x0000DACA, 0x0000DACB, 0x08000DAD, 0x0000DACD, 0x0000DACE, 0x0000DACF,
+    0x00000DAD, 0x0000DAD1, 0x0000DAD2, 0x0000DAD3, 0x0000DAD4, 0x0000DAD5, 0x0000DAD6, 0x0000DAD7,
+    0x0000DAD8, 0x0000DAD9, 0x0000DADA, 0x0000DADB, 0x0000DADC, 0x10000DAE, 0x0000DADE, 0x0000DADF,
+    0x00000DAE, 0x0000DAE1, 0x0000DAE2, 0x0000DAE3, 0x0000DAE4, 0x0000DAE5, 0x0000DAE6, 0x0000DAE7,
+    0x0000DAE8, 0x0000DAE9, 0x0000DAEA, 0x0000DAEB, 0x0000DAEC, 0x0000DAED, 0x20000DAF, 0x0000DAEF,
+    0x00000DAF, 0x0000DAF1, 0x0000DAF2, 0x0000DAF3, 0x0000DAF4, 0x0000DAF5, 0x0000DAF6, 0x0000DAF7,
+    0x0000DAF8, 0x0000DAF9, 0x0000DAFA, 0x0000DAFB, 0x0000DAFC, 0x0000DAFD, 0x0000DAFE, 0x0000DAFF,
+    0x000000DB, 0x00000DB1, 0x00000DB2, 0x00000DB3, 0x00000DB4, 0x00000DB5, 0x00000DB6, 0x00000DB7,
+    0x00000DB8, 0x00000DB9, 0x00000DBA, 0x040000DC, 0x00000DBC, 0x00000DBD, 0x00000DBE, 0x00000DBF,
+    0x00000DB1, 0x00010DB2, 0x0000DB12, 0x0000DB13, 0x0000DB14, 0x0000DB15, 0x0000DB16, 0x0000DB17,
+    0x0000DB18, 0x0000DB19, 0x0000DB1A, 0x0000DB1B, 0x0000DB1C, 0x0000DB1D, 0x0000DB1E, 0x0000DB1F,
+    0x00000DB2, 0x0000DB21, 0x00020DB3, 0x0000DB23, 0x0000DB24, 0x0000DB25, 0x0000DB26, 0x0000DB27,
+    0x0000DB28, 0x0000DB29, 0x0000DB2A, 0x0000DB2B, 0x0000DB2C, 0x0000DB2D, 0x0000DB2E, 0x0000DB2F,
+    0x00000DB3, 0x0000DB31, 0x0000DB32, 0x00040DB4, 0x0000DB34, 0x0000DB35, 0x0000DB36, 0x0000DB37,
+    0x0000DB38, 0x0000DB39, 0x0000DB3A, 0x0000DB3B, 0x0000DB3C, 0x0000DB3D, 0x0000DB3E, 0x0000DB3F,
+    0x00000DB4, 0x0000DB41, 0x0000DB42, 0x0000DB43, 0x00080DB5, 0x0000DB45, 0x0000DB46, 0x0000DB47,
+    0x0000DB48, 0x0000DB49, 0x0000DB4A, 0x0000DB4B, 0x0000DB4C, 0x0000DB4D, 0x0000DB4E, 0x0000DB4F,
+    0x00000DB5, 0x0000DB51, 0x0000DB52, 0x0000DB53, 0x0000DB54, 0x00100DB6, 0x0000DB56, 0x0000DB57,
+    0x0000DB58, 0x0000DB59, 0x0000DB5A, 0x0000DB5B, 0x0000DB5C, 0x0000DB5D, 0x0000DB5E, 0x0000DB5F,
+    0x00000DB6, 0x0000DB61, 0x0000DB62, 0x0000DB63, 0x0000DB64, 0x0000DB65, 0x00200DB7, 0x0000DB67,
+    0x0000DB68, 0x0000DB69, 0x0000DB6A, 0x0000DB6B, 0x0000DB6C, 0x0000DB6D, 0x0000DB6E, 0x0000DB6F,
+    0x00000DB7, 0x0000DB71, 0x0000DB72, 0x0000DB73, 0x0000DB74, 0x0000DB75, 0x0000DB76, 0x00400DB8,
+    0x0000DB78, 0x0000DB79, 0x0000DB7A, 0x0000DB7B, 0x0000DB7C, 0x0000DB7D, 0x0000DB7E, 0x0000DB7F,
+    0x00000DB8, 0x0000DB81, 0x0000DB82, 0x0000DB83, 0x0000DB84, 0x0000DB85, 0x0000DB86, 0x0000DB87,
+    0x00800DB9, 0x0000DB89, 0x0000DB8A, 0x0000DB8B, 0x0000DB8C, 0x0000DB8D, 0x0000DB8E, 0x0000DB8F,
+    0x00000DB9, 0x0000DB91, 0x0000DB92, 0x0000DB93, 0x0000DB94, 0x0000DB95, 0x0000DB96, 0x0000DB97,
+    0x0000DB98, 0x01000DBA, 0x0000DB9A, 0x0000DB9B, 0x0000DB9C, 0x0000DB9D, 0x0000DB9E, 0x0000DB9F,
+    0x00000DBA, 0x0000DBA1, 0x0000DBA2, 0x0000DBA3, 0x0000DBA4, 0x0000DBA5, 0x0000DBA6, 0x0000DBA7,
+    0x0000DBA8, 0x0000DBA9, 0x82000DBB, 0x0000DBAB, 0x0000DBAC, 0x0000DBAD, 0x0000DBAE, 0x0000DBAF,
+    0x040000DC, 0x04000DC1, 0x04000DC2, 0x04000DC3, 0x04000DC4, 0x04000DC5, 0x04000DC6, 0x04000DC7,
+    0x04000DC8, 0x04000DC9, 0x04000DCA, 0x04000DBC, 0x04000DCC, 0x04000DCD, 0x04000DCE, 0x04000DCF,
+    0x00000DBC, 0x0000DBC1, 0x0000DBC2, 0x0000DBC3, 0x0000DBC4, 0x0000DBC5, 0x0000DBC6, 0x0000DBC7,
+    0x0000DBC8, 0x0000DBC9, 0x0000DBCA, 0x0000DBCB, 0x08000DBD, 0x0000DBCD, 0x0000DBCE, 0x0000DBCF,
+    0x00000DBD, 0x0000DBD1, 0x0000DBD2, 0x0000DBD3, 0x0000DBD4, 0x0000DBD5, 0x0000DBD6, 0x0000DBD7,
+    0x0000DBD8, 0x0000DBD9, 0x0000DBDA, 0x0000DBDB, 0x0000DBDC, 0x10000DBE, 0x0000DBDE, 0x0000DBDF,
+    0x00000DBE, 0x0000DBE1, 0x0000DBE2, 0x0000DBE3, 0x0000DBE4, 0x0000DBE5, 0x0000DBE6, 0x0000DBE7,
+    0x0000DBE8, 0x0000DBE9, 0x0000DBEA, 0x0000DBEB, 0x0000DBEC, 0x0000DBED, 0x20000DBF, 0x0000DBEF,
+    0x00000DBF, 0x0000DBF1, 0x0000DBF2, 0x0000DBF3, 0x0000DBF4, 0x0000DBF5, 0x0000DBF6, 0x0000DBF7,
+    0x0000DBF8, 0x0000DBF9, 0x0000DBFA, 0x0000DBFB, 0x0000DBFC, 0x0000DBFD, 0x0000DBFE, 0x0000DBFF,
+    0x000000DC, 0x00000DC1, 0x00000DC2, 0x00000DC3, 0x00000DC4, 0x00000DC5, 0x00000DC6, 0x00000DC7,
+    0x00000DC8, 0x00000DC9, 0x00000DCA, 0x00000DCB, 0x080000DD, 0x00000DCD, 0x00000DCE, 0x00000DCF,
+    0x00000DC1, 0x00010DC2, 0x0000DC12, 0x0000DC13, 0x0000DC14, 0x0000DC15, 0x0000DC16, 0x0000DC17,
+    0x0000DC18, 0x0000DC19, 0x0000DC1A, 0x0000DC1B, 0x0000DC1C, 0x0000DC1D, 0x0000DC1E, 0x0000DC1F,
+    0x00000DC2, 0x0000DC21, 0x00020DC3, 0x0000DC23, 0x0000DC24, 0x0000DC25, 0x0000DC26, 0x0000DC27,
+    0x0000DC28, 0x0000DC29, 0x0000DC2A, 0x0000DC2B, 0x0000DC2C, 0x0000DC2D, 0x0000DC2E, 0x0000DC2F,
+    0x00000DC3, 0x0000DC31, 0x0000DC32, 0x00040DC4, 0x0000DC34, 0x0000DC35, 0x0000DC36, 0x0000DC37,
+    0x0000DC38, 0x0000DC39, 0x0000DC3A, 0x0000DC3B, 0x0000DC3C, 0x0000DC3D, 0x0000DC3E, 0x0000DC3F,
+    0x00000DC4, 0x0000DC41, 0x0000DC42, 0x0000DC43, 0x00080DC5, 0x0000DC45, 0x0000DC46, 0x0000DC47,
+    0x0000DC48, 0x0000DC49, 0x0000DC4A, 0x0000DC4B, 0x0000DC4C, 0x0000DC4D, 0x0000DC4E, 0x0000DC4F,
+    0x00000DC5, 0x0000DC51, 0x0000DC52, 0x0000DC53, 0x0000DC54, 0x00100DC6, 0x0000DC56, 0x0000DC57,
+    0x0000DC58, 0x0000DC59, 0x0000DC5A, 0x0000DC5B, 0x0000DC5C, 0x0000DC5D, 0x0000DC5E, 0x0000DC5F,
+    0x00000DC6, 0x0000DC61, 0x0000DC62, 0x0000DC63, 0x0000DC64, 0x0000DC65, 0x00200DC7, 0x0000DC67,
+    0x0000DC68, 0x0000DC69, 0x0000DC6A, 0x0000DC6B, 0x0000DC6C, 0x0000DC6D, 0x0000DC6E, 0x0000DC6F,
+    0x00000DC7, 0x0000DC71, 0x0000DC72, 0x0000DC73, 0x0000DC74, 0x0000DC75, 0x0000DC76, 0x00400DC8,
+    0x0000DC78, 0x0000DC79, 0x0000DC7A, 0x0000DC7B, 0x0000DC7C, 0x0000DC7D, 0x0000DC7E, 0x0000DC7F,
+    0x00000DC8, 0x0000DC81, 0x0000DC82, 0x0000DC83, 0x0000DC84, 0x0000DC85, 0x0000DC86, 0x0000DC87,
+    0x00800DC9, 0x0000DC89, 0x0000DC8A, 0x0000DC8B, 0x0000DC8C, 0x0000DC8D, 0x0000DC8E, 0x0000DC8F,
+    0x00000DC9, 0x0000DC91, 0x0000DC92, 0x0000DC93, 0x0000DC94, 0x0000DC95, 0x0000DC96, 0x0000DC97,
+    0x0000DC98, 0x01000DCA, 0x0000DC9A, 0x0000DC9B, 0x0000DC9C, 0x0000DC9D, 0x0000DC9E, 0x0000DC9F,
+    0x00000DCA, 0x0000DCA1, 0x0000DCA2, 0x0000DCA3, 0x0000DCA4, 0x0000DCA5, 0x0000DCA6, 0x0000DCA7,
+    0x0000DCA8, 0x0000DCA9, 0x82000DCB, 0x0000DCAB, 0x0000DCAC, 0x0000DCAD, 0x0000DCAE, 0x0000DCAF,
+    0x00000DCB, 0x0000DCB1, 0x0000DCB2, 0x0000DCB3, 0x0000DCB4, 0x0000DCB5, 0x0000DCB6, 0x0000DCB7,
+    0x0000DCB8, 0x0000DCB9, 0x0000DCBA, 0x04000DCC, 0x0000DCBC, 0x0000DCBD, 0x0000DCBE, 0x0000DCBF,
+    0x080000DD, 0x08000DD1, 0x08000DD2, 0x08000DD3, 0x08000DD4, 0x08000DD5, 0x08000DD6, 0x08000DD7,
+    0x08000DD8, 0x08000DD9, 0x08000DDA, 0x08000DDB, 0x08000DCD, 0x08000DDD, 0x08000DDE, 0x08000DDF,
+    0x00000DCD, 0x0000DCD1, 0x0000DCD2, 0x0000DCD3, 0x0000DCD4, 0x0000DCD5, 0x0000DCD6, 0x0000DCD7,
+    0x0000DCD8, 0x0000DCD9, 0x0000DCDA, 0x0000DCDB, 0x0000DCDC, 0x10000DCE, 0x0000DCDE, 0x0000DCDF,
+    0x00000DCE, 0x0000DCE1, 0x0000DCE2, 0x0000DCE3, 0x0000DCE4, 0x0000DCE5, 0x0000DCE6, 0x0000DCE7,
+    0x0000DCE8, 0x0000DCE9, 0x0000DCEA, 0x0000DCEB, 0x0000DCEC, 0x0000DCED, 0x20000DCF, 0x0000DCEF,
+    0x00000DCF, 0x0000DCF1, 0x0000DCF2, 0x0000DCF3, 0x0000DCF4, 0x0000DCF5, 0x0000DCF6, 0x0000DCF7,
+    0x0000DCF8, 0x0000DCF9, 0x0000DCFA, 0x0000DCFB, 0x0000DCFC, 0x0000DCFD, 0x0000DCFE, 0x0000DCFF,
+    0x1000000E, 0x100000E1, 0x100000E2, 0x100000E3, 0x100000E4, 0x100000E5, 0x100000E6, 0x100000E7,
+    0x100000E8, 0x100000E9, 0x100000EA, 0x100000EB, 0x100000EC, 0x100000DE, 0x100000EE, 0x100000EF,
+    0x100000E1, 0x100100E2, 0x10000E12, 0x10000E13, 0x10000E14, 0x10000E15, 0x10000E16, 0x10000E17,
+    0x10000E18, 0x10000E19, 0x10000E1A, 0x10000E1B, 0x10000E1C, 0x10000E1D, 0x10000E1E, 0x10000E1F,
+    0x100000E2, 0x10000E21, 0x100200E3, 0x10000E23, 0x10000E24, 0x10000E25, 0x10000E26, 0x10000E27,
+    0x10000E28, 0x10000E29, 0x10000E2A, 0x10000E2B, 0x10000E2C, 0x10000E2D, 0x10000E2E, 0x10000E2F,
+    0x100000E3, 0x10000E31, 0x10000E32, 0x100400E4, 0x10000E34, 0x10000E35, 0x10000E36, 0x10000E37,
+    0x10000E38, 0x10000E39, 0x10000E3A, 0x10000E3B, 0x10000E3C, 0x10000E3D, 0x10000E3E, 0x10000E3F,
+    0x100000E4, 0x10000E41, 0x10000E42, 0x10000E43, 0x100800E5, 0x10000E45, 0x10000E46, 0x10000E47,
+    0x10000E48, 0x10000E49, 0x10000E4A, 0x10000E4B, 0x10000E4C, 0x10000E4D, 0x10000E4E, 0x10000E4F,
+    0x100000E5, 0x10000E51, 0x10000E52, 0x10000E53, 0x10000E54, 0x101000E6, 0x10000E56, 0x10000E57,
+    0x10000E58, 0x10000E59, 0x10000E5A, 0x10000E5B, 0x10000E5C, 0x10000E5D, 0x10000E5E, 0x10000E5F,
+    0x100000E6, 0x10000E61, 0x10000E62, 0x10000E63, 0x10000E64, 0x10000E65, 0x102000E7, 0x10000E67,
+    0x10000E68, 0x10000E69, 0x10000E6A, 0x10000E6B, 0x10000E6C, 0x10000E6D, 0x10000E6E, 0x10000E6F,
+    0x100000E7, 0x10000E71, 0x10000E72, 0x10000E73, 0x10000E74, 0x10000E75, 0x10000E76, 0x104000E8,
+    0x10000E78, 0x10000E79, 0x10000E7A, 0x10000E7B, 0x10000E7C, 0x10000E7D, 0x10000E7E, 0x10000E7F,
+    0x100000E8, 0x10000E81, 0x10000E82, 0x10000E83, 0x10000E84, 0x10000E85, 0x10000E86, 0x10000E87,
+    0x108000E9, 0x10000E89, 0x10000E8A, 0x10000E8B, 0x10000E8C, 0x10000E8D, 0x10000E8E, 0x10000E8F,
+    0x100000E9, 0x10000E91, 0x10000E92, 0x10000E93, 0x10000E94, 0x10000E95, 0x10000E96, 0x10000E97,
+    0x10000E98, 0x110000EA, 0x10000E9A, 0x10000E9B, 0x10000E9C, 0x10000E9D, 0x10000E9E, 0x10000E9F,
+    0x100000EA, 0x10000EA1, 0x10000EA2, 0x10000EA3, 0x10000EA4, 0x10000EA5, 0x10000EA6, 0x10000EA7,
+    0x10000EA8, 0x10000EA9, 0x920000EB, 0x10000EAB, 0x10000EAC, 0x10000EAD, 0x10000EAE, 0x10000EAF,
+    0x100000EB, 0x10000EB1, 0x10000EB2, 0x10000EB3, 0x10000EB4, 0x10000EB5, 0x10000EB6, 0x10000EB7,
+    0x10000EB8, 0x10000EB9, 0x10000EBA, 0x140000EC, 0x10000EBC, 0x10000EBD, 0x10000EBE, 0x10000EBF,
+    0x100000EC, 0x10000EC1, 0x10000EC2, 0x10000EC3, 0x10000EC4, 0x10000EC5, 0x10000EC6, 0x10000EC7,
+    0x10000EC8, 0x10000EC9, 0x10000ECA, 0x10000ECB, 0x180000ED, 0x10000ECD, 0x10000ECE, 0x10000ECF,
+    0x100000DE, 0x10000DE1, 0x10000DE2, 0x10000DE3, 0x10000DE4, 0x10000DE5, 0x10000DE6, 0x10000DE7,
+    0x10000DE8, 0x10000DE9, 0x10000DEA, 0x10000DEB, 0x10000DEC, 0x200000EE, 0x10000DEE, 0x10000DEF,
+    0x100000EE, 0x10000EE1, 0x10000EE2, 0x10000EE3, 0x10000EE4, 0x10000EE5, 0x10000EE6, 0x10000EE7,
+    0x10000EE8, 0x10000EE9, 0x10000EEA, 0x10000EEB, 0x10000EEC, 0x10000EED, 0x300000EF, 0x10000EEF,
+    0x100000EF, 0x10000EF1, 0x10000EF2, 0x10000EF3, 0x10000EF4, 0x10000EF5, 0x10000EF6, 0x10000EF7,
+    0x10000EF8, 0x10000EF9, 0x10000EFA, 0x10000EFB, 0x10000EFC, 0x10000EFD, 0x10000EFE, 0x10000EFF,
+    0x000000DE, 0x00000DE1, 0x00000DE2, 0x00000DE3, 0x00000DE4, 0x00000DE5, 0x00000DE6, 0x00000DE7,
+    0x00000DE8, 0x00000DE9, 0x00000DEA, 0x00000DEB, 0x00000DEC, 0x00000DED, 0x200000DF, 0x00000DEF,
+    0x00000DE1, 0x00010DE2, 0x0000DE12, 0x0000DE13, 0x0000DE14, 0x0000DE15, 0x0000DE16, 0x0000DE17,
+    0x0000DE18, 0x0000DE19, 0x0000DE1A, 0x0000DE1B, 0x0000DE1C, 0x0000DE1D, 0x0000DE1E, 0x0000DE1F,
+    0x00000DE2, 0x0000DE21, 0x00020DE3, 0x0000DE23, 0x0000DE24, 0x0000DE25, 0x0000DE26, 0x0000DE27,
+    0x0000DE28, 0x0000DE29, 0x0000DE2A, 0x0000DE2B, 0x0000DE2C, 0x0000DE2D, 0x0000DE2E, 0x0000DE2F,
+    0x00000DE3, 0x0000DE31, 0x0000DE32, 0x00040DE4, 0x0000DE34, 0x0000DE35, 0x0000DE36, 0x0000DE37,
+    0x0000DE38, 0x0000DE39, 0x0000DE3A, 0x0000DE3B, 0x0000DE3C, 0x0000DE3D, 0x0000DE3E, 0x0000DE3F,
+    0x00000DE4, 0x0000DE41, 0x0000DE42, 0x0000DE43, 0x00080DE5, 0x0000DE45, 0x0000DE46, 0x0000DE47,
+    0x0000DE48, 0x0000DE49, 0x0000DE4A, 0x0000DE4B, 0x0000DE4C, 0x0000DE4D, 0x0000DE4E, 0x0000DE4F,
+    0x00000DE5, 0x0000DE51, 0x0000DE52, 0x0000DE53, 0x0000DE54, 0x00100DE6, 0x0000DE56, 0x0000DE57,
+    0x0000DE58, 0x0000DE59, 0x0000DE5A, 0x0000DE5B, 0x0000DE5C, 0x0000DE5D, 0x0000DE5E, 0x0000DE5F,
+    0x00000DE6, 0x0000DE61, 0x0000DE62, 0x0000DE63, 0x0000DE64, 0x0000DE65, 0x00200DE7, 0x0000DE67,
+    0x0000DE68, 0x0000DE69, 0x0000DE6A, 0x0000DE6B, 0x0000DE6C, 0x0000DE6D, 0x0000DE6E, 0x0000DE6F,
+    0x00000DE7, 0x0000DE71, 0x0000DE72, 0x0000DE73, 0x0000DE74, 0x0000DE75, 0x0000DE76, 0x00400DE8,
+    0x0000DE78, 0x0000DE79, 0x0000DE7A, 0x0000DE7B, 0x0000DE7C, 0x0000DE7D, 0x0000DE7E, 0x0000DE7F,
+    0x00000DE8, 0x0000DE81, 0x0000DE82, 0x0000DE83, 0x0000DE84, 0x0000DE85, 0x0000DE86, 0x0000DE87,
+    0x00800DE9, 0x0000DE89, 0x0000DE8A, 0x0000DE8B, 0x0000DE8C, 0x0000DE8D, 0x0000DE8E, 0x0000DE8F,
+    0x00000DE9, 0x0000DE91, 0x0000DE92, 0x0000DE93, 0x0000DE94, 0x0000DE95, 0x0000DE96, 0x0000DE97,
+    0x0000DE98, 0x01000DEA, 0x0000DE9A, 0x0000DE9B, 0x0000DE9C, 0x0000DE9D, 0x0000DE9E, 0x0000DE9F,
+    0x00000DEA, 0x0000DEA1, 0x0000DEA2, 0x0000DEA3, 0x0000DEA4, 0x0000DEA5, 0x0000DEA6, 0x0000DEA7,
+    0x0000DEA8, 0x0000DEA9, 0x82000DEB, 0x0000DEAB, 0x0000DEAC, 0x0000DEAD, 0x0000DEAE, 0x0000DEAF,
+    0x00000DEB, 0x0000DEB1, 0x0000DEB2, 0x0000DEB3, 0x0000DEB4, 0x0000DEB5, 0x0000DEB6, 0x0000DEB7,
+    0x0000DEB8, 0x0000DEB9, 0x0000DEBA, 0x04000DEC, 0x0000DEBC, 0x0000DEBD, 0x0000DEBE, 0x0000DEBF,
+    0x00000DEC, 0x0000DEC1, 0x0000DEC2, 0x0000DEC3, 0x0000DEC4, 0x0000DEC5, 0x0000DEC6, 0x0000DEC7,
+    0x0000DEC8, 0x0000DEC9, 0x0000DECA, 0x0000DECB, 0x08000DED, 0x0000DECD, 0x0000DECE, 0x0000DECF,
+    0x00000DED, 0x0000DED1, 0x0000DED2, 0x0000DED3, 0x0000DED4, 0x0000DED5, 0x0000DED6, 0x0000DED7,
+    0x0000DED8, 0x0000DED9, 0x0000DEDA, 0x0000DEDB, 0x0000DEDC, 0x10000DEE, 0x0000DEDE, 0x0000DEDF,
+    0x200000DF, 0x20000DF1, 0x20000DF2, 0x20000DF3, 0x20000DF4, 0x20000DF5, 0x20000DF6, 0x20000DF7,
+    0x20000DF8, 0x20000DF9, 0x20000DFA, 0x20000DFB, 0x20000DFC, 0x20000DFD, 0x20000DEF, 0x20000DFF,
+    0x00000DEF, 0x0000DEF1, 0x0000DEF2, 0x0000DEF3, 0x0000DEF4, 0x0000DEF5, 0x0000DEF6, 0x0000DEF7,
+    0x0000DEF8, 0x0000DEF9, 0x0000DEFA, 0x0000DEFB, 0x0000DEFC, 0x0000DEFD, 0x0000DEFE, 0x0000DEFF,
+    0x000000DF, 0x00000DF1, 0x00000DF2, 0x00000DF3, 0x00000DF4, 0x00000DF5, 0x00000DF6, 0x00000DF7,
+    0x00000DF8, 0x00000DF9, 0x00000DFA, 0x00000DFB, 0x00000DFC, 0x00000DFD, 0x00000DFE, 0x00000DFF,
+    0x00000DF1, 0x00010DF2, 0x0000DF12, 0x0000DF13, 0x0000DF14, 0x0000DF15, 0x0000DF16, 0x0000DF17,
+    0x0000DF18, 0x0000DF19, 0x0000DF1A, 0x0000DF1B, 0x0000DF1C, 0x0000DF1D, 0x0000DF1E, 0x0000DF1F,
+    0x00000DF2, 0x0000DF21, 0x00020DF3, 0x0000DF23, 0x0000DF24, 0x0000DF25, 0x0000DF26, 0x0000DF27,
+    0x0000DF28, 0x0000DF29, 0x0000DF2A, 0x0000DF2B, 0x0000DF2C, 0x0000DF2D, 0x0000DF2E, 0x0000DF2F,
+    0x00000DF3, 0x0000DF31, 0x0000DF32, 0x00040DF4, 0x0000DF34, 0x0000DF35, 0x0000DF36, 0x0000DF37,
+    0x0000DF38, 0x0000DF39, 0x0000DF3A, 0x0000DF3B, 0x0000DF3C, 0x0000DF3D, 0x0000DF3E, 0x0000DF3F,
+    0x00000DF4, 0x0000DF41, 0x0000DF42, 0x0000DF43, 0x00080DF5, 0x0000DF45, 0x0000DF46, 0x0000DF47,
+    0x0000DF48, 0x0000DF49, 0x0000DF4A, 0x0000DF4B, 0x0000DF4C, 0x0000DF4D, 0x0000DF4E, 0x0000DF4F,
+    0x00000DF5, 0x0000DF51, 0x0000DF52, 0x0000DF53, 0x0000DF54, 0x00100DF6, 0x0000DF56, 0x0000DF57,
+    0x0000DF58, 0x0000DF59, 0x0000DF5A, 0x0000DF5B, 0x0000DF5C, 0x0000DF5D, 0x0000DF5E, 0x0000DF5F,
+    0x00000DF6, 0x0000DF61, 0x0000DF62, 0x0000DF63, 0x0000DF64, 0x0000DF65, 0x00200DF7, 0x0000DF67,
+    0x0000DF68, 0x0000DF69, 0x0000DF6A, 0x0000DF6B, 0x0000DF6C, 0x0000DF6D, 0x0000DF6E, 0x0000DF6F,
+    0x00000DF7, 0x0000DF71, 0x0000DF72, 0x0000DF73, 0x0000DF74, 0x0000DF75, 0x0000DF76, 0x00400DF8,
+    0x0000DF78, 0x0000DF79, 0x0000DF7A, 0x0000DF7B, 0x0000DF7C, 0x0000DF7D, 0x0000DF7E, 0x0000DF7F,
+    0x00000DF8, 0x0000DF81, 0x0000DF82, 0x0000DF83, 0x0000DF84, 0x0000DF85, 0x0000DF86, 0x0000DF87,
+    0x00800DF9, 0x0000DF89, 0x0000DF8A, 0x0000DF8B, 0x0000DF8C, 0x0000DF8D, 0x0000DF8E, 0x0000DF8F,
+    0x00000DF9, 0x0000DF91, 0x0000DF92, 0x0000DF93, 0x0000DF94, 0x0000DF95, 0x0000DF96, 0x0000DF97,
+    0x0000DF98, 0x01000DFA, 0x0000DF9A, 0x0000DF9B, 0x0000DF9C, 0x0000DF9D, 0x0000DF9E, 0x0000DF9F,
+    0x00000DFA, 0x0000DFA1, 0x0000DFA2, 0x0000DFA3, 0x0000DFA4, 0x0000DFA5, 0x0000DFA6, 0x0000DFA7,
+    0x0000DFA8, 0x0000DFA9, 0x82000DFB, 0x0000DFAB, 0x0000DFAC, 0x0000DFAD, 0x0000DFAE, 0x0000DFAF,
+    0x00000DFB, 0x0000DFB1, 0x0000DFB2, 0x0000DFB3, 0x0000DFB4, 0x0000DFB5, 0x0000DFB6, 0x0000DFB7,
+    0x0000DFB8, 0x0000DFB9, 0x0000DFBA, 0x04000DFC, 0x0000DFBC, 0x0000DFBD, 0x0000DFBE, 0x0000DFBF,
+    0x00000DFC, 0x0000DFC1, 0x0000DFC2, 0x0000DFC3, 0x0000DFC4, 0x0000DFC5, 0x0000DFC6, 0x0000DFC7,
+    0x0000DFC8, 0x0000DFC9, 0x0000DFCA, 0x0000DFCB, 0x08000DFD, 0x0000DFCD, 0x0000DFCE, 0x0000DFCF,
+    0x00000DFD, 0x0000DFD1, 0x0000DFD2, 0x0000DFD3, 0x0000DFD4, 0x0000DFD5, 0x0000DFD6, 0x0000DFD7,
+    0x0000DFD8, 0x0000DFD9, 0x0000DFDA, 0x0000DFDB, 0x0000DFDC, 0x10000DFE, 0x0000DFDE, 0x0000DFDF,
+    0x00000DFE, 0x0000DFE1, 0x0000DFE2, 0x0000DFE3, 0x0000DFE4, 0x0000DFE5, 0x0000DFE6, 0x0000DFE7,
+    0x0000DFE8, 0x0000DFE9, 0x0000DFEA, 0x0000DFEB, 0x0000DFEC, 0x0000DFED, 0x20000DFF, 0x0000DFEF,
+    0x00000DFF, 0x0000DFF1, 0x0000DFF2, 0x0000DFF3, 0x0000DFF4, 0x0000DFF5, 0x0000DFF6, 0x0000DFF7,
+    0x0000DFF8, 0x0000DFF9, 0x0000DFFA, 0x0000DFFB, 0x0000DFFC, 0x0000DFFD, 0x0000DFFE, 0x0000DFFF,
+    0x0000000E, 0x000000E1, 0x000000E2, 0x000000E3, 0x000000E4, 0x000000E5, 0x000000E6, 0x000000E7,
+    0x000000E8, 0x000000E9, 0x000000EA, 0x000000EB, 0x000000EC, 0x000000ED, 0x2000000F, 0x000000EF,
+    0x000000E1, 0x000100E2, 0x00000E12, 0x00000E13, 0x00000E14, 0x00000E15, 0x00000E16, 0x00000E17,
+    0x00000E18, 0x00000E19, 0x00000E1A, 0x00000E1B, 0x00000E1C, 0x00000E1D, 0x00000E1E, 0x00000E1F,
+    0x000000E2, 0x00000E21, 0x000200E3, 0x00000E23, 0x00000E24, 0x00000E25, 0x00000E26, 0x00000E27,
+    0x00000E28, 0x00000E29, 0x00000E2A, 0x00000E2B, 0x00000E2C, 0x00000E2D, 0x00000E2E, 0x00000E2F,
+    0x000000E3, 0x00000E31, 0x00000E32, 0x000400E4, 0x00000E34, 0x00000E35, 0x00000E36, 0x00000E37,
+    0x00000E38, 0x00000E39, 0x00000E3A, 0x00000E3B, 0x00000E3C, 0x00000E3D, 0x00000E3E, 0x00000E3F,
+    0x000000E4, 0x00000E41, 0x00000E42, 0x00000E43, 0x000800E5, 0x00000E45, 0x00000E46, 0x00000E47,
+    0x00000E48, 0x00000E49, 0x00000E4A, 0x00000E4B, 0x00000E4C, 0x00000E4D, 0x00000E4E, 0x00000E4F,
+    0x000000E5, 0x00000E51, 0x00000E52, 0x00000E53, 0x00000E54, 0x001000E6, 0x00000E56, 0x00000E57,
+    0x00000E58, 0x00000E59, 0x00000E5A, 0x00000E5B, 0x00000E5C, 0x00000E5D, 0x00000E5E, 0x00000E5F,
+    0x000000E6, 0x00000E61, 0x00000E62, 0x00000E63, 0x00000E64, 0x00000E65, 0x002000E7, 0x00000E67,
+    0x00000E68, 0x00000E69, 0x00000E6A, 0x00000E6B, 0x00000E6C, 0x00000E6D, 0x00000E6E, 0x00000E6F,
+    0x000000E7, 0x00000E71, 0x00000E72, 0x00000E73, 0x00000E74, 0x00000E75, 0x00000E76, 0x004000E8,
+    0x00000E78, 0x00000E79, 0x00000E7A, 0x00000E7B, 0x00000E7C, 0x00000E7D, 0x00000E7E, 0x00000E7F,
+    0x000000E8, 0x00000E81, 0x00000E82, 0x00000E83, 0x00000E84, 0x00000E85, 0x00000E86, 0x00000E87,
+    0x008000E9, 0x00000E89, 0x00000E8A, 0x00000E8B, 0x00000E8C, 0x00000E8D, 0x00000E8E, 0x00000E8F,
+    0x000000E9, 0x00000E91, 0x00000E92, 0x00000E93, 0x00000E94, 0x00000E95, 0x00000E96, 0x00000E97,
+    0x00000E98, 0x010000EA, 0x00000E9A, 0x00000E9B, 0x00000E9C, 0x00000E9D, 0x00000E9E, 0x00000E9F,
+    0x000000EA, 0x00000EA1, 0x00000EA2, 0x00000EA3, 0x00000EA4, 0x00000EA5, 0x00000EA6, 0x00000EA7,
+    0x00000EA8, 0x00000EA9, 0x820000EB, 0x00000EAB, 0x00000EAC, 0x00000EAD, 0x00000EAE, 0x00000EAF,
+    0x000000EB, 0x00000EB1, 0x00000EB2, 0x00000EB3, 0x00000EB4, 0x00000EB5, 0x00000EB6, 0x00000EB7,
+    0x00000EB8, 0x00000EB9, 0x00000EBA, 0x040000EC, 0x00000EBC, 0x00000EBD, 0x00000EBE, 0x00000EBF,
+    0x000000EC, 0x00000EC1, 0x00000EC2, 0x00000EC3, 0x00000EC4, 0x00000EC5, 0x00000EC6, 0x00000EC7,
+    0x00000EC8, 0x00000EC9, 0x00000ECA, 0x00000ECB, 0x080000ED, 0x00000ECD, 0x00000ECE, 0x00000ECF,
+    0x000000ED, 0x00000ED1, 0x00000ED2, 0x00000ED3, 0x00000ED4, 0x00000ED5, 0x00000ED6, 0x00000ED7,
+    0x00000ED8, 0x00000ED9, 0x00000EDA, 0x00000EDB, 0x00000EDC, 0x100000EE, 0x00000EDE, 0x00000EDF,
+    0x2000000F, 0x200000F1, 0x200000F2, 0x200000F3, 0x200000F4, 0x200000F5, 0x200000F6, 0x200000F7,
+    0x200000F8, 0x200000F9, 0x200000FA, 0x200000FB, 0x200000FC, 0x200000FD, 0x200000EF, 0x200000FF,
+    0x000000EF, 0x00000EF1, 0x00000EF2, 0x00000EF3, 0x00000EF4, 0x00000EF5, 0x00000EF6, 0x00000EF7,
+    0x00000EF8, 0x00000EF9, 0x00000EFA, 0x00000EFB, 0x00000EFC, 0x00000EFD, 0x00000EFE, 0x00000EFF,
+    0x000000E1, 0x000100E2, 0x00000E12, 0x00000E13, 0x00000E14, 0x00000E15, 0x00000E16, 0x00000E17,
+    0x00000E18, 0x00000E19, 0x00000E1A, 0x00000E1B, 0x00000E1C, 0x00000E1D, 0x00000E1E, 0x00000E1F,
+    0x000100E2, 0x00010E12, 0x00010E22, 0x00010E23, 0x00010E24, 0x00010E25, 0x00010E26, 0x00010E27,
+    0x00010E28, 0x00010E29, 0x00010E2A, 0x00010E2B, 0x00010E2C, 0x00010E2D, 0x00010E2E, 0x00010E2F,
+    0x00000E12, 0x0000E121, 0x00020E13, 0x0000E123, 0x0000E124, 0x0000E125, 0x0000E126, 0x0000E127,
+    0x0000E128, 0x0000E129, 0x0000E12A, 0x0000E12B, 0x0000E12C, 0x0000E12D, 0x0000E12E, 0x0000E12F,
+    0x00000E13, 0x0000E131, 0x0000E132, 0x00040E14, 0x0000E134, 0x0000E135, 0x0000E136, 0x0000E137,
+    0x0000E138, 0x0000E139, 0x0000E13A, 0x0000E13B, 0x0000E13C, 0x0000E13D, 0x0000E13E, 0x0000E13F,
+    0x00000E14, 0x0000E141, 0x0000E142, 0x0000E143, 0x00080E15, 0x0000E145, 0x0000E146, 0x0000E147,
+    0x0000E148, 0x0000E149, 0x0000E14A, 0x0000E14B, 0x0000E14C, 0x0000E14D, 0x0000E14E, 0x0000E14F,
+    0x00000E15, 0x0000E151, 0x0000E152, 0x0000E153, 0x0000E154, 0x00100E16, 0x0000E156, 0x0000E157,
+    0x0000E158, 0x0000E159, 0x0000E15A, 0x0000E15B, 0x0000E15C, 0x0000E15D, 0x0000E15E, 0x0000E15F,
+    0x00000E16, 0x0000E161, 0x0000E162, 0x0000E163, 0x0000E164, 0x0000E165, 0x00200E17, 0x0000E167,
+    0x0000E168, 0x0000E169, 0x0000E16A, 0x0000E16B, 0x0000E16C, 0x0000E16D, 0x0000E16E, 0x0000E16F,
+    0x00000E17, 0x0000E171, 0x0000E172, 0x0000E173, 0x0000E174, 0x0000E175, 0x0000E176, 0x00400E18,
+    0x0000E178, 0x0000E179, 0x0000E17A, 0x0000E17B, 0x0000E17C, 0x0000E17D, 0x0000E17E, 0x0000E17F,
+    0x00000E18, 0x0000E181, 0x0000E182, 0x0000E183, 0x0000E184, 0x0000E185, 0x0000E186, 0x0000E187,
+    0x00800E19, 0x0000E189, 0x0000E18A, 0x0000E18B, 0x0000E18C, 0x0000E18D, 0x0000E18E, 0x0000E18F,
+    0x00000E19, 0x0000E191, 0x0000E192, 0x0000E193, 0x0000E194, 0x0000E195, 0x0000E196, 0x0000E197,
+    0x0000E198, 0x01000E1A, 0x0000E19A, 0x0000E19B, 0x0000E19C, 0x0000E19D, 0x0000E19E, 0x0000E19F,
+    0x00000E1A, 0x0000E1A1, 0x0000E1A2, 0x0000E1A3, 0x0000E1A4, 0x0000E1A5, 0x0000E1A6, 0x0000E1A7,
+    0x0000E1A8, 0x0000E1A9, 0x82000E1B, 0x0000E1AB, 0x0000E1AC, 0x0000E1AD, 0x0000E1AE, 0x0000E1AF,
+    0x00000E1B, 0x0000E1B1, 0x0000E1B2, 0x0000E1B3, 0x0000E1B4, 0x0000E1B5, 0x0000E1B6, 0x0000E1B7,
+    0x0000E1B8, 0x0000E1B9, 0x0000E1BA, 0x04000E1C, 0x0000E1BC, 0x0000E1BD, 0x0000E1BE, 0x0000E1BF,
+    0x00000E1C, 0x0000E1C1, 0x0000E1C2, 0x0000E1C3, 0x0000E1C4, 0x0000E1C5, 0x0000E1C6, 0x0000E1C7,
+    0x0000E1C8, 0x0000E1C9, 0x0000E1CA, 0x0000E1CB, 0x08000E1D, 0x0000E1CD, 0x0000E1CE, 0x0000E1CF,
+    0x00000E1D, 0x0000E1D1, 0x0000E1D2, 0x0000E1D3, 0x0000E1D4, 0x0000E1D5, 0x0000E1D6, 0x0000E1D7,
+    0x0000E1D8, 0x0000E1D9, 0x0000E1DA, 0x0000E1DB, 0x0000E1DC, 0x10000E1E, 0x0000E1DE, 0x0000E1DF,
+    0x00000E1E, 0x0000E1E1, 0x0000E1E2, 0x0000E1E3, 0x0000E1E4, 0x0000E1E5, 0x0000E1E6, 0x0000E1E7,
+    0x0000E1E8, 0x0000E1E9, 0x0000E1EA, 0x0000E1EB, 0x0000E1EC, 0x0000E1ED, 0x20000E1F, 0x0000E1EF,
+    0x00000E1F, 0x0000E1F1, 0x0000E1F2, 0x0000E1F3, 0x0000E1F4, 0x0000E1F5, 0x0000E1F6, 0x0000E1F7,
+    0x0000E1F8, 0x0000E1F9, 0x0000E1FA, 0x0000E1FB, 0x0000E1FC, 0x0000E1FD, 0x0000E1FE, 0x0000E1FF,
+    0x000000E2, 0x00000E21, 0x000200E3, 0x00000E23, 0x00000E24, 0x00000E25, 0x00000E26, 0x00000E27,
+    0x00000E28, 0x00000E29, 0x00000E2A, 0x00000E2B, 0x00000E2C, 0x00000E2D, 0x00000E2E, 0x00000E2F,
+    0x00000E21, 0x00010E22, 0x0000E212, 0x0000E213, 0x0000E214, 0x0000E215, 0x0000E216, 0x0000E217,
+    0x0000E218, 0x0000E219, 0x0000E21A, 0x0000E21B, 0x0000E21C, 0x0000E21D, 0x0000E21E, 0x0000E21F,
+    0x000200E3, 0x00020E31, 0x00020E23, 0x00020E33, 0x00020E34, 0x00020E35, 0x00020E36, 0x00020E37,
+    0x00020E38, 0x00020E39, 0x00020E3A, 0x00020E3B, 0x00020E3C, 0x00020E3D, 0x00020E3E, 0x00020E3F,
+    0x00000E23, 0x0000E231, 0x0000E232, 0x00040E24, 0x0000E234, 0x0000E235, 0x0000E236, 0x0000E237,
+    0x0000E238, 0x0000E239, 0x0000E23A, 0x0000E23B, 0x0000E23C, 0x0000E23D, 0x0000E23E, 0x0000E23F,
+    0x00000E24, 0x0000E241, 0x0000E242, 0x0000E243, 0x00080E25, 0x0000E245, 0x0000E246, 0x0000E247,
+    0x0000E248, 0x0000E249, 0x0000E24A, 0x0000E24B, 0x0000E24C, 0x0000E24D, 0x0000E24E, 0x0000E24F,
+    0x00000E25, 0x0000E251, 0x0000E252, 0x0000E253, 0x0000E254, 0x00100E26, 0x0000E256, 0x0000E257,
+    0x0000E258, 0x0000E259, 0x0000E25A, 0x0000E25B, 0x0000E25C, 0x0000E25D, 0x0000E25E, 0x0000E25F,
+    0x00000E26, 0x0000E261, 0x0000E262, 0x0000E263, 0x0000E264, 0x0000E265, 0x00200E27, 0x0000E267,
+    0x0000E268, 0x0000E269, 0x0000E26A, 0x0000E26B, 0x0000E26C, 0x0000E26D, 0x0000E26E, 0x0000E26F,
+    0x00000E27, 0x0000E271, 0x0000E272, 0x0000E273, 0x0000E274, 0x0000E275, 0x0000E276, 0x00400E28,
+    0x0000E278, 0x0000E279, 0x0000E27A, 0x0000E27B, 0x0000E27C, 0x0000E27D, 0x0000E27E, 0x0000E27F,
+    0x00000E28, 0x0000E281, 0x0000E282, 0x0000E283, 0x0000E284, 0x0000E285, 0x0000E286, 0x0000E287,
+    0x00800E29, 0x0000E289, 0x0000E28A, 0x0000E28B, 0x0000E28C, 0x0000E28D, 0x0000E28E, 0x0000E28F,
+    0x00000E29, 0x0000E291, 0x0000E292, 0x0000E293, 0x0000E294, 0x0000E295, 0x0000E296, 0x0000E297,
+    0x0000E298, 0x01000E2A, 0x0000E29A, 0x0000E29B, 0x0000E29C, 0x0000E29D, 0x0000E29E, 0x0000E29F,
+    0x00000E2A, 0x0000E2A1, 0x0000E2A2, 0x0000E2A3, 0x0000E2A4, 0x0000E2A5, 0x0000E2A6, 0x0000E2A7,
+    0x0000E2A8, 0x0000E2A9, 0x82000E2B, 0x0000E2AB, 0x0000E2AC, 0x0000E2AD, 0x0000E2AE, 0x0000E2AF,
+    0x00000E2B, 0x0000E2B1, 0x0000E2B2, 0x0000E2B3, 0x0000E2B4, 0x0000E2B5, 0x0000E2B6, 0x0000E2B7,
+    0x0000E2B8, 0x0000E2B9, 0x0000E2BA, 0x04000E2C, 0x0000E2BC, 0x0000E2BD, 0x0000E2BE, 0x0000E2BF,
+    0x00000E2C, 0x0000E2C1, 0x0000E2C2, 0x0000E2C3, 0x0000E2C4, 0x0000E2C5, 0x0000E2C6, 0x0000E2C7,
+    0x0000E2C8, 0x0000E2C9, 0x0000E2CA, 0x0000E2CB, 0x08000E2D, 0x0000E2CD, 0x0000E2CE, 0x0000E2CF,
+    0x00000E2D, 0x0000E2D1, 0x0000E2D2, 0x0000E2D3, 0x0000E2D4, 0x0000E2D5, 0x0000E2D6, 0x0000E2D7,
+    0x0000E2D8, 0x0000E2D9, 0x0000E2DA, 0x0000E2DB, 0x0000E2DC, 0x10000E2E, 0x0000E2DE, 0x0000E2DF,
+    0x00000E2E, 0x0000E2E1, 0x0000E2E2, 0x0000E2E3, 0x0000E2E4, 0x0000E2E5, 0x0000E2E6, 0x0000E2E7,
+    0x0000E2E8, 0x0000E2E9, 0x0000E2EA, 0x0000E2EB, 0x0000E2EC, 0x0000E2ED, 0x20000E2F, 0x0000E2EF,
+    0x00000E2F, 0x0000E2F1, 0x0000E2F2, 0x0000E2F3, 0x0000E2F4, 0x0000E2F5, 0x0000E2F6, 0x0000E2F7,
+    0x0000E2F8, 0x0000E2F9, 0x0000E2FA, 0x0000E2FB, 0x0000E2FC, 0x0000E2FD, 0x0000E2FE, 0x0000E2FF,
+    0x000000E3, 0x00000E31, 0x00000E32, 0x000400E4, 0x00000E34, 0x00000E35, 0x00000E36, 0x00000E37,
+    0x00000E38, 0x00000E39, 0x00000E3A, 0x00000E3B, 0x00000E3C, 0x00000E3D, 0x00000E3E, 0x00000E3F,
+    0x00000E31, 0x00010E32, 0x0000E312, 0x0000E313, 0x0000E314, 0x0000E315, 0x0000E316, 0x0000E317,
+    0x0000E318, 0x0000E319, 0x0000E31A, 0x0000E31B, 0x0000E31C, 0x0000E31D, 0x0000E31E, 0x0000E31F,
+    0x00000E32, 0x0000E321, 0x00020E33, 0x0000E323, 0x0000E324, 0x0000E325, 0x0000E326, 0x0000E327,
+    0x0000E328, 0x0000E329, 0x0000E32A, 0x0000E32B, 0x0000E32C, 0x0000E32D, 0x0000E32E, 0x0000E32F,
+    0x000400E4, 0x00040E41, 0x00040E42, 0x00040E34, 0x00040E44, 0x00040E45, 0x00040E46, 0x00040E47,
+    0x00040E48, 0x00040E49, 0x00040E4A, 0x00040E4B, 0x00040E4C, 0x00040E4D, 0x00040E4E, 0x00040E4F,
+    0x00000E34, 0x0000E341, 0x0000E342, 0x0000E343, 0x00080E35, 0x0000E345, 0x0000E346, 0x0000E347,
+    0x0000E348, 0x0000E349, 0x0000E34A, 0x0000E34B, 0x0000E34C, 0x0000E34D, 0x0000E34E, 0x0000E34F,
+    0x00000E35, 0x0000E351, 0x0000E352, 0x0000E353, 0x0000E354, 0x00100E36, 0x0000E356, 0x0000E357,
+    0x0000E358, 0x0000E359, 0x0000E35A, 0x0000E35B, 0x0000E35C, 0x0000E35D, 0x0000E35E, 0x0000E35F,
+    0x00000E36, 0x0000E361, 0x0000E362, 0x0000E363, 0x0000E364, 0x0000E365, 0x00200E37, 0x0000E367,
+    0x0000E368, 0x0000E369, 0x0000E36A, 0x0000E36B, 0x0000E36C, 0x0000E36D, 0x0000E36E, 0x0000E36F,
+    0x00000E37, 0x0000E371, 0x0000E372, 0x0000E373, 0x0000E374, 0x0000E375, 0x0000E376, 0x00400E38,
+    0x0000E378, 0x0000E379, 0x0000E37A, 0x0000E37B, 0x0000E37C, 0x0000E37D, 0x0000E37E, 0x0000E37F,
+    0x00000E38, 0x0000E381, 0x0000E382, 0x0000E383, 0x0000E384, 0x0000E385, 0x0000E386, 0x0000E387,
+    0x00800E39, 0x0000E389, 0x0000E38A, 0x0000E38B, 0x0000E38C, 0x0000E38D, 0x0000E38E, 0x0000E38F,
+    0x00000E39, 0x0000E391, 0x0000E392, 0x0000E393, 0x0000E394, 0x0000E395, 0x0000E396, 0x0000E397,
+    0x0000E398, 0x01000E3A, 0x0000E39A, 0x0000E39B, 0x0000E39C, 0x0000E39D, 0x0000E39E, 0x0000E39F,
+    0x00000E3A, 0x0000E3A1, 0x0000E3A2, 0x0000E3A3, 0x0000E3A4, 0x0000E3A5, 0x0000E3A6, 0x0000E3A7,
+    0x0000E3A8, 0x0000E3A9, 0x82000E3B, 0x0000E3AB, 0x0000E3AC, 0x0000E3AD, 0x0000E3AE, 0x0000E3AF,
+    0x00000E3B, 0x0000E3B1, 0x0000E3B2, 0x0000E3B3, 0x0000E3B4, 0x0000E3B5, 0x0000E3B6, 0x0000E3B7,
+    0x0000E3B8, 0x0000E3B9, 0x0000E3BA, 0x04000E3C, 0x0000E3BC, 0x0000E3BD, 0x0000E3BE, 0x0000E3BF,
+    0x00000E3C, 0x0000E3C1, 0x0000E3C2, 0x0000E3C3, 0x0000E3C4, 0x0000E3C5, 0x0000E3C6, 0x0000E3C7,
+    0x0000E3C8, 0x0000E3C9, 0x0000E3CA, 0x0000E3CB, 0x08000E3D, 0x0000E3CD, 0x0000E3CE, 0x0000E3CF,
+    0x00000E3D, 0x0000E3D1, 0x0000E3D2, 0x0000E3D3, 0x0000E3D4, 0x0000E3D5, 0x0000E3D6, 0x0000E3D7,
+    0x0000E3D8, 0x0000E3D9, 0x0000E3DA, 0x0000E3DB, 0x0000E3DC, 0x10000E3E, 0x0000E3DE, 0x0000E3DF,
+    0x00000E3E, 0x0000E3E1, 0x0000E3E2, 0x0000E3E3, 0x0000E3E4, 0x0000E3E5, 0x0000E3E6, 0x0000E3E7,
+    0x0000E3E8, 0x0000E3E9, 0x0000E3EA, 0x0000E3EB, 0x0000E3EC, 0x0000E3ED, 0x20000E3F, 0x0000E3EF,
+    0x00000E3F, 0x0000E3F1, 0x0000E3F2, 0x0000E3F3, 0x0000E3F4, 0x0000E3F5, 0x0000E3F6, 0x0000E3F7,
+    0x0000E3F8, 0x0000E3F9, 0x0000E3FA, 0x0000E3FB, 0x0000E3FC, 0x0000E3FD, 0x0000E3FE, 0x0000E3FF,
+    0x000000E4, 0x00000E41, 0x00000E42, 0x00000E43, 0x000800E5, 0x00000E45, 0x00000E46, 0x00000E47,
+    0x00000E48, 0x00000E49, 0x00000E4A, 0x00000E4B, 0x00000E4C, 0x00000E4D, 0x00000E4E, 0x00000E4F,
+    0x00000E41, 0x00010E42, 0x0000E412, 0x0000E413, 0x0000E414, 0x0000E415, 0x0000E416, 0x0000E417,
+    0x0000E418, 0x0000E419, 0x0000E41A, 0x0000E41B, 0x0000E41C, 0x0000E41D, 0x0000E41E, 0x0000E41F,
+    0x00000E42, 0x0000E421, 0x00020E43, 0x0000E423, 0x0000E424, 0x0000E425, 0x0000E426, 0x0000E427,
+    0x0000E428, 0x0000E429, 0x0000E42A, 0x0000E42B, 0x0000E42C, 0x0000E42D, 0x0000E42E, 0x0000E42F,
+    0x00000E43, 0x0000E431, 0x0000E432, 0x00040E44, 0x0000E434, 0x0000E435, 0x0000E436, 0x0000E437,
+    0x0000E438, 0x0000E439, 0x0000E43A, 0x0000E43B, 0x0000E43C, 0x0000E43D, 0x0000E43E, 0x0000E43F,
+    0x000800E5, 0x00080E51, 0x00080E52, 0x00080E53, 0x00080E45, 0x00080E55, 0x00080E56, 0x00080E57,
+    0x00080E58, 0x00080E59, 0x00080E5A, 0x00080E5B, 0x00080E5C, 0x00080E5D, 0x00080E5E, 0x00080E5F,
+    0x00000E45, 0x0000E451, 0x0000E452, 0x0000E453, 0x0000E454, 0x00100E46, 0x0000E456, 0x0000E457,
+    0x0000E458, 0x0000E459, 0x0000E45A, 0x0000E45B, 0x0000E45C, 0x0000E45D, 0x0000E45E, 0x0000E45F,
+    0x00000E46, 0x0000E461, 0x0000E462, 0x0000E463, 0x0000E464, 0x0000E465, 0x00200E47, 0x0000E467,
+    0x0000E468, 0x0000E469, 0x0000E46A, 0x0000E46B, 0x0000E46C, 0x0000E46D, 0x0000E46E, 0x0000E46F,
+    0x00000E47, 0x0000E471, 0x0000E472, 0x0000E473, 0x0000E474, 0x0000E475, 0x0000E476, 0x00400E48,
+    0x0000E478, 0x0000E479, 0x0000E47A, 0x0000E47B, 0x0000E47C, 0x0000E47D, 0x0000E47E, 0x0000E47F,
+    0x00000E48, 0x0000E481, 0x0000E482, 0x0000E483, 0x0000E484, 0x0000E485, 0x0000E486, 0x0000E487,
+    0x00800E49, 0x0000E489, 0x0000E48A, 0x0000E48B, 0x0000E48C, 0x0000E48D, 0x0000E48E, 0x0000E48F,
+    0x00000E49, 0x0000E491, 0x0000E492, 0x0000E493, 0x0000E494, 0x0000E495, 0x0000E496, 0x0000E497,
+    0x0000E498, 0x01000E4A, 0x0000E49A, 0x0000E49B, 0x0000E49C, 0x0000E49D, 0x0000E49E, 0x0000E49F,
+    0x00000E4A, 0x0000E4A1, 0x0000E4A2, 0x0000E4A3, 0x0000E4A4, 0x0000E4A5, 0x0000E4A6, 0x0000E4A7,
+    0x0000E4A8, 0x0000E4A9, 0x82000E4B, 0x0000E4AB, 0x0000E4AC, 0x0000E4AD, 0x0000E4AE, 0x0000E4AF,
+    0x00000E4B, 0x0000E4B1, 0x0000E4B2, 0x0000E4B3, 0x0000E4B4, 0x0000E4B5, 0x0000E4B6, 0x0000E4B7,
+    0x0000E4B8, 0x0000E4B9, 0x0000E4BA, 0x04000E4C, 0x0000E4BC, 0x0000E4BD, 0x0000E4BE, 0x0000E4BF,
+    0x00000E4C, 0x0000E4C1, 0x0000E4C2, 0x0000E4C3, 0x0000E4C4, 0x0000E4C5, 0x0000E4C6, 0x0000E4C7,
+    0x0000E4C8, 0x0000E4C9, 0x0000E4CA, 0x0000E4CB, 0x08000E4D, 0x0000E4CD, 0x0000E4CE, 0x0000E4CF,
+    0x00000E4D, 0x0000E4D1, 0x0000E4D2, 0x0000E4D3, 0x0000E4D4, 0x0000E4D5, 0x0000E4D6, 0x0000E4D7,
+    0x0000E4D8, 0x0000E4D9, 0x0000E4DA, 0x0000E4DB, 0x0000E4DC, 0x10000E4E, 0x0000E4DE, 0x0000E4DF,
+    0x00000E4E, 0x0000E4E1, 0x0000E4E2, 0x0000E4E3, 0x0000E4E4, 0x0000E4E5, 0x0000E4E6, 0x0000E4E7,
+    0x0000E4E8, 0x0000E4E9, 0x0000E4EA, 0x0000E4EB, 0x0000E4EC, 0x0000E4ED, 0x20000E4F, 0x0000E4EF,
+    0x00000E4F, 0x0000E4F1, 0x0000E4F2, 0x0000E4F3, 0x0000E4F4, 0x0000E4F5, 0x0000E4F6, 0x0000E4F7,
+    0x0000E4F8, 0x0000E4F9, 0x0000E4FA, 0x0000E4FB, 0x0000E4FC, 0x0000E4FD, 0x0000E4FE, 0x0000E4FF,
+    0x000000E5, 0x00000E51, 0x00000E52, 0x00000E53, 0x00000E54, 0x001000E6, 0x00000E56, 0x00000E57,
+    0x00000E58, 0x00000E59, 0x00000E5A, 0x00000E5B, 0x00000E5C, 0x00000E5D, 0x00000E5E, 0x00000E5F,
+    0x00000E51, 0x00010E52, 0x0000E512, 0x0000E513, 0x0000E514, 0x0000E515, 0x0000E516, 0x0000E517,
+    0x0000E518, 0x0000E519, 0x0000E51A, 0x0000E51B, 0x0000E51C, 0x0000E51D, 0x0000E51E, 0x0000E51F,
+    0x00000E52, 0x0000E521, 0x00020E53, 0x0000E523, 0x0000E524, 0x0000E525, 0x0000E526, 0x0000E527,
+    0x0000E528, 0x0000E529, 0x0000E52A, 0x0000E52B, 0x0000E52C, 0x0000E52D, 0x0000E52E, 0x0000E52F,
+    0x00000E53, 0x0000E531, 0x0000E532, 0x00040E54, 0x0000E534, 0x0000E535, 0x0000E536, 0x0000E537,
+    0x0000E538, 0x0000E539, 0x0000E53A, 0x0000E53B, 0x0000E53C, 0x0000E53D, 0x0000E53E, 0x0000E53F,
+    0x00000E54, 0x0000E541, 0x0000E542, 0x0000E543, 0x00080E55, 0x0000E545, 0x0000E546, 0x0000E547,
+    0x0000E548, 0x0000E549, 0x0000E54A, 0x0000E54B, 0x0000E54C, 0x0000E54D, 0x0000E54E, 0x0000E54F,
+    0x001000E6, 0x00100E61, 0x00100E62, 0x00100E63, 0x00100E64, 0x00100E56, 0x00100E66, 0x00100E67,
+    0x00100E68, 0x00100E69, 0x00100E6A, 0x00100E6B, 0x00100E6C, 0x00100E6D, 0x00100E6E, 0x00100E6F,
+    0x00000E56, 0x0000E561, 0x0000E562, 0x0000E563, 0x0000E564, 0x0000E565, 0x00200E57, 0x0000E567,
+    0x0000E568, 0x0000E569, 0x0000E56A, 0x0000E56B, 0x0000E56C, 0x0000E56D, 0x0000E56E, 0x0000E56F,
+    0x00000E57, 0x0000E571, 0x0000E572, 0x0000E573, 0x0000E574, 0x0000E575, 0x0000E576, 0x00400E58,
+    0x0000E578, 0x0000E579, 0x0000E57A, 0x0000E57B, 0x0000E57C, 0x0000E57D, 0x0000E57E, 0x0000E57F,
+    0x00000E58, 0x0000E581, 0x0000E582, 0x0000E583, 0x0000E584, 0x0000E585, 0x0000E586, 0x0000E587,
+    0x00800E59, 0x0000E589, 0x0000E58A, 0x0000E58B, 0x0000E58C, 0x0000E58D, 0x0000E58E, 0x0000E58F,
+    0x00000E59, 0x0000E591, 0x0000E592, 0x0000E593, 0x0000E594, 0x0000E595, 0x0000E596, 0x0000E597,
+    0x0000E598, 0x01000E5A, 0x0000E59A, 0x0000E59B, 0x0000E59C, 0x0000E59D, 0x0000E59E, 0x0000E59F,
+    0x00000E5A, 0x0000E5A1, 0x0000E5A2, 0x0000E5A3, 0x0000E5A4, 0x0000E5A5, 0x0000E5A6, 0x0000E5A7,
+    0x0000E5A8, 0x0000E5A9, 0x82000E5B, 0x0000E5AB, 0x0000E5AC, 0x0000E5AD, 0x0000E5AE, 0x0000E5AF,
+    0x00000E5B, 0x0000E5B1, 0x0000E5B2, 0x0000E5B3, 0x0000E5B4, 0x0000E5B5, 0x0000E5B6, 0x0000E5B7,
+    0x0000E5B8, 0x0000E5B9, 0x0000E5BA, 0x04000E5C, 0x0000E5BC, 0x0000E5BD, 0x0000E5BE, 0x0000E5BF,
+    0x00000E5C, 0x0000E5C1, 0x0000E5C2, 0x0000E5C3, 0x0000E5C4, 0x0000E5C5, 0x0000E5C6, 0x0000E5C7,
+    0x0000E5C8, 0x0000E5C9, 0x0000E5CA, 0x0000E5CB, 0x08000E5D, 0x0000E5CD, 0x0000E5CE, 0x0000E5CF,
+    0x00000E5D, 0x0000E5D1, 0x0000E5D2, 0x0000E5D3, 0x0000E5D4, 0x0000E5D5, 0x0000E5D6, 0x0000E5D7,
+    0x0000E5D8, 0x0000E5D9, 0x0000E5DA, 0x0000E5DB, 0x0000E5DC, 0x10000E5E, 0x0000E5DE, 0x0000E5DF,
+    0x00000E5E, 0x0000E5E1, 0x0000E5E2, 0x0000E5E3, 0x0000E5E4, 0x0000E5E5, 0x0000E5E6, 0x0000E5E7,
+    0x0000E5E8, 0x0000E5E9, 0x0000E5EA, 0x0000E5EB, 0x0000E5EC, 0x0000E5ED, 0x20000E5F, 0x0000E5EF,
+    0x00000E5F, 0x0000E5F1, 0x0000E5F2, 0x0000E5F3, 0x0000E5F4, 0x0000E5F5, 0x0000E5F6, 0x0000E5F7,
+    0x0000E5F8, 0x0000E5F9, 0x0000E5FA, 0x0000E5FB, 0x0000E5FC, 0x0000E5FD, 0x0000E5FE, 0x0000E5FF,
+    0x000000E6, 0x00000E61, 0x00000E62, 0x00000E63, 0x00000E64, 0x00000E65, 0x002000E7, 0x00000E67,
+    0x00000E68, 0x00000E69, 0x00000E6A, 0x00000E6B, 0x00000E6C, 0x00000E6D, 0x00000E6E, 0x00000E6F,
+    0x00000E61, 0x00010E62, 0x0000E612, 0x0000E613, 0x0000E614, 0x0000E615, 0x0000E616, 0x0000E617,
+    0x0000E618, 0x0000E619, 0x0000E61A, 0x0000E61B, 0x0000E61C, 0x0000E61D, 0x0000E61E, 0x0000E61F,
+    0x00000E62, 0x0000E621, 0x00020E63, 0x0000E623, 0x0000E624, 0x0000E625, 0x0000E626, 0x0000E627,
+    0x0000E628, 0x0000E629, 0x0000E62A, 0x0000E62B, 0x0000E62C, 0x0000E62D, 0x0000E62E, 0x0000E62F,
+    0x00000E63, 0x0000E631, 0x0000E632, 0x00040E64, 0x0000E634, 0x0000E635, 0x0000E636, 0x0000E637,
+    0x0000E638, 0x0000E639, 0x0000E63A, 0x0000E63B, 0x0000E63C, 0x0000E63D, 0x0000E63E, 0x0000E63F,
+    0x00000E64, 0x0000E641, 0x0000E642, 0x0000E643, 0x00080E65, 0x0000E645, 0x0000E646, 0x0000E647,
+    0x0000E648, 0x0000E649, 0x0000E64A, 0x0000E64B, 0x0000E64C, 0x0000E64D, 0x0000E64E, 0x0000E64F,
+    0x00000E65, 0x0000E651, 0x0000E652, 0x0000E653, 0x0000E654, 0x00100E66, 0x0000E656, 0x0000E657,
+    0x0000E658, 0x0000E659, 0x0000E65A, 0x0000E65B, 0x0000E65C, 0x0000E65D, 0x0000E65E, 0x0000E65F,
+    0x002000E7, 0x00200E71, 0x00200E72, 0x00200E73, 0x00200E74, 0x00200E75, 0x00200E67, 0x00200E77,
+    0x00200E78, 0x00200E79, 0x00200E7A, 0x00200E7B, 0x00200E7C, 0x00200E7D, 0x00200E7E, 0x00200E7F,
+    0x00000E67, 0x0000E671, 0x0000E672, 0x0000E673, 0x0000E674, 0x0000E675, 0x0000E676, 0x00400E68,
+    0x0000E678, 0x0000E679, 0x0000E67A, 0x0000E67B, 0x0000E67C, 0x0000E67D, 0x0000E67E, 0x0000E67F,
+    0x00000E68, 0x0000E681, 0x0000E682, 0x0000E683, 0x0000E684, 0x0000E685, 0x0000E686, 0x0000E687,
+    0x00800E69, 0x0000E689, 0x0000E68A, 0x0000E68B, 0x0000E68C, 0x0000E68D, 0x0000E68E, 0x0000E68F,
+    0x00000E69, 0x0000E691, 0x0000E692, 0x0000E693, 0x0000E694, 0x0000E695, 0x0000E696, 0x0000E697,
+    0x0000E698, 0x01000E6A, 0x0000E69A, 0x0000E69B, 0x0000E69C, 0x0000E69D, 0x0000E69E, 0x0000E69F,
+    0x00000E6A, 0x0000E6A1, 0x0000E6A2, 0x0000E6A3, 0x0000E6A4, 0x0000E6A5, 0x0000E6A6, 0x0000E6A7,
+    0x0000E6A8, 0x0000E6A9, 0x82000E6B, 0x0000E6AB, 0x0000E6AC, 0x0000E6AD, 0x0000E6AE, 0x0000E6AF,
+    0x00000E6B, 0x0000E6B1, 0x0000E6B2, 0x0000E6B3, 0x0000E6B4, 0x0000E6B5, 0x0000E6B6, 0x0000E6B7,
+    0x0000E6B8, 0x0000E6B9, 0x0000E6BA, 0x04000E6C, 0x0000E6BC, 0x0000E6BD, 0x0000E6BE, 0x0000E6BF,
+    0x00000E6C, 0x0000E6C1, 0x0000E6C2, 0x0000E6C3, 0x0000E6C4, 0x0000E6C5, 0x0000E6C6, 0x0000E6C7,
+    0x0000E6C8, 0x0000E6C9, 0x0000E6CA, 0x0000E6CB, 0x08000E6D, 0x0000E6CD, 0x0000E6CE, 0x0000E6CF,
+    0x00000E6D, 0x0000E6D1, 0x0000E6D2, 0x0000E6D3, 0x0000E6D4, 0x0000E6D5, 0x0000E6D6, 0x0000E6D7,
+    0x0000E6D8, 0x0000E6D9, 0x0000E6DA, 0x0000E6DB, 0x0000E6DC, 0x10000E6E, 0x0000E6DE, 0x0000E6DF,
+    0x00000E6E, 0x0000E6E1, 0x0000E6E2, 0x0000E6E3, 0x0000E6E4, 0x0000E6E5, 0x0000E6E6, 0x0000E6E7,
+    0x0000E6E8, 0x0000E6E9, 0x0000E6EA, 0x0000E6EB, 0x0000E6EC, 0x0000E6ED, 0x20000E6F, 0x0000E6EF,
+    0x00000E6F, 0x0000E6F1, 0x0000E6F2, 0x0000E6F3, 0x0000E6F4, 0x0000E6F5, 0x0000E6F6, 0x0000E6F7,
+    0x0000E6F8, 0x0000E6F9, 0x0000E6FA, 0x0000E6FB, 0x0000E6FC, 0x0000E6FD, 0x0000E6FE, 0x0000E6FF,
+    0x000000E7, 0x00000E71, 0x00000E72, 0x00000E73, 0x00000E74, 0x00000E75, 0x00000E76, 0x004000E8,
+    0x00000E78, 0x00000E79, 0x00000E7A, 0x00000E7B, 0x00000E7C, 0x00000E7D, 0x00000E7E, 0x00000E7F,
+    0x00000E71, 0x00010E72, 0x0000E712, 0x0000E713, 0x0000E714, 0x0000E715, 0x0000E716, 0x0000E717,
+    0x0000E718, 0x0000E719, 0x0000E71A, 0x0000E71B, 0x0000E71C, 0x0000E71D, 0x0000E71E, 0x0000E71F,
+    0x00000E72, 0x0000E721, 0x00020E73, 0x0000E723, 0x0000E724, 0x0000E725, 0x0000E726, 0x0000E727,
+    0x0000E728, 0x0000E729, 0x0000E72A, 0x0000E72B, 0x0000E72C, 0x0000E72D, 0x0000E72E, 0x0000E72F,
+    0x00000E73, 0x0000E731, 0x0000E732, 0x00040E74, 0x0000E734, 0x0000E735, 0x0000E736, 0x0000E737,
+    0x0000E738, 0x0000E739, 0x0000E73A, 0x0000E73B, 0x0000E73C, 0x0000E73D, 0x0000E73E, 0x0000E73F,
+    0x00000E74, 0x0000E741, 0x0000E742, 0x0000E743, 0x00080E75, 0x0000E745, 0x0000E746, 0x0000E747,
+    0x0000E748, 0x0000E749, 0x0000E74A, 0x0000E74B, 0x0000E74C, 0x0000E74D, 0x0000E74E, 0x0000E74F,
+    0x00000E75, 0x0000E751, 0x0000E752, 0x0000E753, 0x0000E754, 0x00100E76, 0x0000E756, 0x0000E757,
+    0x0000E758, 0x0000E759, 0x0000E75A, 0x0000E75B, 0x0000E75C, 0x0000E75D, 0x0000E75E, 0x0000E75F,
+    0x00000E76, 0x0000E761, 0x0000E762, 0x0000E763, 0x0000E764, 0x0000E765, 0x00200E77, 0x0000E767,
+    0x0000E768, 0x0000E769, 0x0000E76A, 0x0000E76B, 0x0000E76C, 0x0000E76D, 0x0000E76E, 0x0000E76F,
+    0x004000E8, 0x00400E81, 0x00400E82, 0x00400E83, 0x00400E84, 0x00400E85, 0x00400E86, 0x00400E78,
+    0x00400E88, 0x00400E89, 0x00400E8A, 0x00400E8B, 0x00400E8C, 0x00400E8D, 0x00400E8E, 0x00400E8F,
+    0x00000E78, 0x0000E781, 0x0000E782, 0x0000E783, 0x0000E784, 0x0000E785, 0x0000E786, 0x0000E787,
+    0x00800E79, 0x0000E789, 0x0000E78A, 0x0000E78B, 0x0000E78C, 0x0000E78D, 0x0000E78E, 0x0000E78F,
+    0x00000E79, 0x0000E791, 0x0000E792, 0x0000E793, 0x0000E794, 0x0000E795, 0x0000E796, 0x0000E797,
+    0x0000E798, 0x01000E7A, 0x0000E79A, 0x0000E79B, 0x0000E79C, 0x0000E79D, 0x0000E79E, 0x0000E79F,
+    0x00000E7A, 0x0000E7A1, 0x0000E7A2, 0x0000E7A3, 0x0000E7A4, 0x0000E7A5, 0x0000E7A6, 0x0000E7A7,
+    0x0000E7A8, 0x0000E7A9, 0x82000E7B, 0x0000E7AB, 0x0000E7AC, 0x0000E7AD, 0x0000E7AE, 0x0000E7AF,
+    0x00000E7B, 0x0000E7B1, 0x0000E7B2, 0x0000E7B3, 0x0000E7B4, 0x0000E7B5, 0x0000E7B6, 0x0000E7B7,
+    0x0000E7B8, 0x0000E7B9, 0x0000E7BA, 0x04000E7C, 0x0000E7BC, 0x0000E7BD, 0x0000E7BE, 0x0000E7BF,
+    0x00000E7C, 0x0000E7C1, 0x0000E7C2, 0x0000E7C3, 0x0000E7C4, 0x0000E7C5, 0x0000E7C6, 0x0000E7C7,
+    0x0000E7C8, 0x0000E7C9, 0x0000E7CA, 0x0000E7CB, 0x08000E7D, 0x0000E7CD, 0x0000E7CE, 0x0000E7CF,
+    0x00000E7D, 0x0000E7D1, 0x0000E7D2, 0x0000E7D3, 0x0000E7D4, 0x0000E7D5, 0x0000E7D6, 0x0000E7D7,
+    0x0000E7D8, 0x0000E7D9, 0x0000E7DA, 0x0000E7DB, 0x0000E7DC, 0x10000E7E, 0x0000E7DE, 0x0000E7DF,
+    0x00000E7E, 0x0000E7E1, 0x0000E7E2, 0x0000E7E3, 0x0000E7E4, 0x0000E7E5, 0x0000E7E6, 0x0000E7E7,
+    0x0000E7E8, 0x0000E7E9, 0x0000E7EA, 0x0000E7EB, 0x0000E7EC, 0x0000E7ED, 0x20000E7F, 0x0000E7EF,
+    0x00000E7F, 0x0000E7F1, 0x0000E7F2, 0x0000E7F3, 0x0000E7F4, 0x0000E7F5, 0x0000E7F6, 0x0000E7F7,
+    0x0000E7F8, 0x0000E7F9, 0x0000E7FA, 0x0000E7FB, 0x0000E7FC, 0x0000E7FD, 0x0000E7FE, 0x0000E7FF,
+    0x000000E8, 0x00000E81, 0x00000E82, 0x00000E83, 0x00000E84, 0x00000E85, 0x00000E86, 0x00000E87,
+    0x008000E9, 0x00000E89, 0x00000E8A, 0x00000E8B, 0x00000E8C, 0x00000E8D, 0x00000E8E, 0x00000E8F,
+    0x00000E81, 0x00010E82, 0x0000E812, 0x0000E813, 0x0000E814, 0x0000E815, 0x0000E816, 0x0000E817,
+    0x0000E818, 0x0000E819, 0x0000E81A, 0x0000E81B, 0x0000E81C, 0x0000E81D, 0x0000E81E, 0x0000E81F,
+    0x00000E82, 0x0000E821, 0x00020E83, 0x0000E823, 0x0000E824, 0x0000E825, 0x0000E826, 0x0000E827,
+    0x0000E828, 0x0000E829, 0x0000E82A, 0x0000E82B, 0x0000E82C, 0x0000E82D, 0x0000E82E, 0x0000E82F,
+    0x00000E83, 0x0000E831, 0x0000E832, 0x00040E84, 0x0000E834, 0x0000E835, 0x0000E836, 0x0000E837,
+    0x0000E838, 0x0000E839, 0x0000E83A, 0x0000E83B, 0x0000E83C, 0x0000E83D, 0x0000E83E, 0x0000E83F,
+    0x00000E84, 0x0000E841, 0x0000E842, 0x0000E843, 0x00080E85, 0x0000E845, 0x0000E846, 0x0000E847,
+    0x0000E848, 0x0000E849, 0x0000E84A, 0x0000E84B, 0x0000E84C, 0x0000E84D, 0x0000E84E, 0x0000E84F,
+    0x00000E85, 0x0000E851, 0x0000E852, 0x0000E853, 0x0000E854, 0x00100E86, 0x0000E856, 0x0000E857,
+    0x0000E858, 0x0000E859, 0x0000E85A, 0x0000E85B, 0x0000E85C, 0x0000E85D, 0x0000E85E, 0x0000E85F,
+    0x00000E86, 0x0000E861, 0x0000E862, 0x0000E863, 0x0000E864, 0x0000E865, 0x00200E87, 0x0000E867,
+    0x0000E868, 0x0000E869, 0x0000E86A, 0x0000E86B, 0x0000E86C, 0x0000E86D, 0x0000E86E, 0x0000E86F,
+    0x00000E87, 0x0000E871, 0x0000E872, 0x0000E873, 0x0000E874, 0x0000E875, 0x0000E876, 0x00400E88,
+    0x0000E878, 0x0000E879, 0x0000E87A, 0x0000E87B, 0x0000E87C, 0x0000E87D, 0x0000E87E, 0x0000E87F,
+    0x008000E9, 0x00800E91, 0x00800E92, 0x00800E93, 0x00800E94, 0x00800E95, 0x00800E96, 0x00800E97,
+    0x00800E89, 0x00800E99, 0x00800E9A, 0x00800E9B, 0x00800E9C, 0x00800E9D, 0x00800E9E, 0x00800E9F,
+    0x00000E89, 0x0000E891, 0x0000E892, 0x0000E893, 0x0000E894, 0x0000E895, 0x0000E896, 0x0000E897,
+    0x0000E898, 0x01000E8A, 0x0000E89A, 0x0000E89B, 0x0000E89C, 0x0000E89D, 0x0000E89E, 0x0000E89F,
+    0x00000E8A, 0x0000E8A1, 0x0000E8A2, 0x0000E8A3, 0x0000E8A4, 0x0000E8A5, 0x0000E8A6, 0x0000E8A7,
+    0x0000E8A8, 0x0000E8A9, 0x82000E8B, 0x0000E8AB, 0x0000E8AC, 0x0000E8AD, 0x0000E8AE, 0x0000E8AF,
+    0x00000E8B, 0x0000E8B1, 0x0000E8B2, 0x0000E8B3, 0x0000E8B4, 0x0000E8B5, 0x0000E8B6, 0x0000E8B7,
+    0x0000E8B8, 0x0000E8B9, 0x0000E8BA, 0x04000E8C, 0x0000E8BC, 0x0000E8BD, 0x0000E8BE, 0x0000E8BF,
+    0x00000E8C, 0x0000E8C1, 0x0000E8C2, 0x0000E8C3, 0x0000E8C4, 0x0000E8C5, 0x0000E8C6, 0x0000E8C7,
+    0x0000E8C8, 0x0000E8C9, 0x0000E8CA, 0x0000E8CB, 0x08000E8D, 0x0000E8CD, 0x0000E8CE, 0x0000E8CF,
+    0x00000E8D, 0x0000E8D1, 0x0000E8D2, 0x0000E8D3, 0x0000E8D4, 0x0000E8D5, 0x0000E8D6, 0x0000E8D7,
+    0x0000E8D8, 0x0000E8D9, 0x0000E8DA, 0x0000E8DB, 0x0000E8DC, 0x10000E8E, 0x0000E8DE, 0x0000E8DF,
+    0x00000E8E, 0x0000E8E1, 0x0000E8E2, 0x0000E8E3, 0x0000E8E4, 0x0000E8E5, 0x0000E8E6, 0x0000E8E7,
+    0x0000E8E8, 0x0000E8E9, 0x0000E8EA, 0x0000E8EB, 0x0000E8EC, 0x0000E8ED, 0x20000E8F, 0x0000E8EF,
+    0x00000E8F, 0x0000E8F1, 0x0000E8F2, 0x0000E8F3, 0x0000E8F4, 0x0000E8F5, 0x0000E8F6, 0x0000E8F7,
+    0x0000E8F8, 0x0000E8F9, 0x0000E8FA, 0x0000E8FB, 0x0000E8FC, 0x0000E8FD, 0x0000E8FE, 0x0000E8FF,
+    0x000000E9, 0x00000E91, 0x00000E92, 0x00000E93, 0x00000E94, 0x00000E95, 0x00000E96, 0x00000E97,
+    0x00000E98, 0x010000EA, 0x00000E9A, 0x00000E9B, 0x00000E9C, 0x00000E9D, 0x00000E9E, 0x00000E9F,
+    0x00000E91, 0x00010E92, 0x0000E912, 0x0000E913, 0x0000E914, 0x0000E915, 0x0000E916, 0x0000E917,
+    0x0000E918, 0x0000E919, 0x0000E91A, 0x0000E91B, 0x0000E91C, 0x0000E91D, 0x0000E91E, 0x0000E91F,
+    0x00000E92, 0x0000E921, 0x00020E93, 0x0000E923, 0x0000E924, 0x0000E925, 0x0000E926, 0x0000E927,
+    0x0000E928, 0x0000E929, 0x0000E92A, 0x0000E92B, 0x0000E92C, 0x0000E92D, 0x0000E92E, 0x0000E92F,
+    0x00000E93, 0x0000E931, 0x0000E932, 0x00040E94, 0x0000E934, 0x0000E935, 0x0000E936, 0x0000E937,
+    0x0000E938, 0x0000E939, 0x0000E93A, 0x0000E93B, 0x0000E93C, 0x0000E93D, 0x0000E93E, 0x0000E93F,
+    0x00000E94, 0x0000E941, 0x0000E942, 0x0000E943, 0x00080E95, 0x0000E945, 0x0000E946, 0x0000E947,
+    0x0000E948, 0x0000E949, 0x0000E94A, 0x0000E94B, 0x0000E94C, 0x0000E94D, 0x0000E94E, 0x0000E94F,
+    0x00000E95, 0x0000E951, 0x0000E952, 0x0000E953, 0x0000E954, 0x00100E96, 0x0000E956, 0x0000E957,
+    0x0000E958, 0x0000E959, 0x0000E95A, 0x0000E95B, 0x0000E95C, 0x0000E95D, 0x0000E95E, 0x0000E95F,
+    0x00000E96, 0x0000E961, 0x0000E962, 0x0000E963, 0x0000E964, 0x0000E965, 0x00200E97, 0x0000E967,
+    0x0000E968, 0x0000E969, 0x0000E96A, 0x0000E96B, 0x0000E96C, 0x0000E96D, 0x0000E96E, 0x0000E96F,
+    0x00000E97, 0x0000E971, 0x0000E972, 0x0000E973, 0x0000E974, 0x0000E975, 0x0000E976, 0x00400E98,
+    0x0000E978, 0x0000E979, 0x0000E97A, 0x0000E97B, 0x0000E97C, 0x0000E97D, 0x0000E97E, 0x0000E97F,
+    0x00000E98, 0x0000E981, 0x0000E982, 0x0000E983, 0x0000E984, 0x0000E985, 0x0000E986, 0x0000E987,
+    0x00800E99, 0x0000E989, 0x0000E98A, 0x0000E98B, 0x0000E98C, 0x0000E98D, 0x0000E98E, 0x0000E98F,
+    0x010000EA, 0x01000EA1, 0x01000EA2, 0x01000EA3, 0x01000EA4, 0x01000EA5, 0x01000EA6, 0x01000EA7,
+    0x01000EA8, 0x01000E9A, 0x01000EAA, 0x01000EAB, 0x01000EAC, 0x01000EAD, 0x01000EAE, 0x01000EAF,
+    0x00000E9A, 0x0000E9A1, 0x0000E9A2, 0x0000E9A3, 0x0000E9A4, 0x0000E9A5, 0x0000E9A6, 0x0000E9A7,
+    0x0000E9A8, 0x0000E9A9, 0x82000E9B, 0x0000E9AB, 0x0000E9AC, 0x0000E9AD, 0x0000E9AE, 0x0000E9AF,
+    0x00000E9B, 0x0000E9B1, 0x0000E9B2, 0x0000E9B3, 0x0000E9B4, 0x0000E9B5, 0x0000E9B6, 0x0000E9B7,
+    0x0000E9B8, 0x0000E9B9, 0x0000E9BA, 0x04000E9C, 0x0000E9BC, 0x0000E9BD, 0x0000E9BE, 0x0000E9BF,
+    0x00000E9C, 0x0000E9C1, 0x0000E9C2, 0x0000E9C3, 0x0000E9C4, 0x0000E9C5, 0x0000E9C6, 0x0000E9C7,
+    0x0000E9C8, 0x0000E9C9, 0x0000E9CA, 0x0000E9CB, 0x08000E9D, 0x0000E9CD, 0x0000E9CE, 0x0000E9CF,
+    0x00000E9D, 0x0000E9D1, 0x0000E9D2, 0x0000E9D3, 0x0000E9D4, 0x0000E9D5, 0x0000E9D6, 0x0000E9D7,
+    0x0000E9D8, 0x0000E9D9, 0x0000E9DA, 0x0000E9DB, 0x0000E9DC, 0x10000E9E, 0x0000E9DE, 0x0000E9DF,
+    0x00000E9E, 0x0000E9E1, 0x0000E9E2, 0x0000E9E3, 0x0000E9E4, 0x0000E9E5, 0x0000E9E6, 0x0000E9E7,
+    0x0000E9E8, 0x0000E9E9, 0x0000E9EA, 0x0000E9EB, 0x0000E9EC, 0x0000E9ED, 0x20000E9F, 0x0000E9EF,
+    0x00000E9F, 0x0000E9F1, 0x0000E9F2, 0x0000E9F3, 0x0000E9F4, 0x0000E9F5, 0x0000E9F6, 0x0000E9F7,
+    0x0000E9F8, 0x0000E9F9, 0x0000E9FA, 0x0000E9FB, 0x0000E9FC, 0x0000E9FD, 0x0000E9FE, 0x0000E9FF,
+    0x000000EA, 0x00000EA1, 0x00000EA2, 0x00000EA3, 0x00000EA4, 0x00000EA5, 0x00000EA6, 0x00000EA7,
+    0x00000EA8, 0x00000EA9, 0x820000EB, 0x00000EAB, 0x00000EAC, 0x00000EAD, 0x00000EAE, 0x00000EAF,
+    0x00000EA1, 0x00010EA2, 0x0000EA12, 0x0000EA13, 0x0000EA14, 0x0000EA15, 0x0000EA16, 0x0000EA17,
+    0x0000EA18, 0x0000EA19, 0x0000EA1A, 0x0000EA1B, 0x0000EA1C, 0x0000EA1D, 0x0000EA1E, 0x0000EA1F,
+    0x00000EA2, 0x0000EA21, 0x00020EA3, 0x0000EA23, 0x0000EA24, 0x0000EA25, 0x0000EA26, 0x0000EA27,
+    0x0000EA28, 0x0000EA29, 0x0000EA2A, 0x0000EA2B, 0x0000EA2C, 0x0000EA2D, 0x0000EA2E, 0x0000EA2F,
+    0x00000EA3, 0x0000EA31, 0x0000EA32, 0x00040EA4, 0x0000EA34, 0x0000EA35, 0x0000EA36, 0x0000EA37,
+    0x0000EA38, 0x0000EA39, 0x0000EA3A, 0x0000EA3B, 0x0000EA3C, 0x0000EA3D, 0x0000EA3E, 0x0000EA3F,
+    0x00000EA4, 0x0000EA41, 0x0000EA42, 0x0000EA43, 0x00080EA5, 0x0000EA45, 0x0000EA46, 0x0000EA47,
+    0x0000EA48, 0x0000EA49, 0x0000EA4A, 0x0000EA4B, 0x0000EA4C, 0x0000EA4D, 0x0000EA4E, 0x0000EA4F,
+    0x00000EA5, 0x0000EA51, 0x0000EA52, 0x0000EA53, 0x0000EA54, 0x00100EA6, 0x0000EA56, 0x0000EA57,
+    0x0000EA58, 0x0000EA59, 0x0000EA5A, 0x0000EA5B, 0x0000EA5C, 0x0000EA5D, 0x0000EA5E, 0x0000EA5F,
+    0x00000EA6, 0x0000EA61, 0x0000EA62, 0x0000EA63, 0x0000EA64, 0x0000EA65, 0x00200EA7, 0x0000EA67,
+    0x0000EA68, 0x0000EA69, 0x0000EA6A, 0x0000EA6B, 0x0000EA6C, 0x0000EA6D, 0x0000EA6E, 0x0000EA6F,
+    0x00000EA7, 0x0000EA71, 0x0000EA72, 0x0000EA73, 0x0000EA74, 0x0000EA75, 0x0000EA76, 0x00400EA8,
+    0x0000EA78, 0x0000EA79, 0x0000EA7A, 0x0000EA7B, 0x0000EA7C, 0x0000EA7D, 0x0000EA7E, 0x0000EA7F,
+    0x00000EA8, 0x0000EA81, 0x0000EA82, 0x0000EA83, 0x0000EA84, 0x0000EA85, 0x0000EA86, 0x0000EA87,
+    0x00800EA9, 0x0000EA89, 0x0000EA8A, 0x0000EA8B, 0x0000EA8C, 0x0000EA8D, 0x0000EA8E, 0x0000EA8F,
+    0x00000EA9, 0x0000EA91, 0x0000EA92, 0x0000EA93, 0x0000EA94, 0x0000EA95, 0x0000EA96, 0x0000EA97,
+    0x0000EA98, 0x01000EAA, 0x0000EA9A, 0x0000EA9B, 0x0000EA9C, 0x0000EA9D, 0x0000EA9E, 0x0000EA9F,
+    0x820000EB, 0x82000EB1, 0x82000EB2, 0x82000EB3, 0x82000EB4, 0x82000EB5, 0x82000EB6, 0x82000EB7,
+    0x82000EB8, 0x82000EB9, 0x82000EAB, 0x82000EBB, 0x82000EBC, 0x82000EBD, 0x82000EBE, 0x82000EBF,
+    0x00000EAB, 0x0000EAB1, 0x0000EAB2, 0x0000EAB3, 0x0000EAB4, 0x0000EAB5, 0x0000EAB6, 0x0000EAB7,
+    0x0000EAB8, 0x0000EAB9, 0x0000EABA, 0x04000EAC, 0x0000EABC, 0x0000EABD, 0x0000EABE, 0x0000EABF,
+    0x00000EAC, 0x0000EAC1, 0x0000EAC2, 0x0000EAC3, 0x0000EAC4, 0x0000EAC5, 0x0000EAC6, 0x0000EAC7,
+    0x0000EAC8, 0x0000EAC9, 0x0000EACA, 0x0000EACB, 0x08000EAD, 0x0000EACD, 0x0000EACE, 0x0000EACF,
+    0x00000EAD, 0x0000EAD1, 0x0000EAD2, 0x0000EAD3, 0x0000EAD4, 0x0000EAD5, 0x0000EAD6, 0x0000EAD7,
+    0x0000EAD8, 0x0000EAD9, 0x0000EADA, 0x0000EADB, 0x0000EADC, 0x10000EAE, 0x0000EADE, 0x0000EADF,
+    0x00000EAE, 0x0000EAE1, 0x0000EAE2, 0x0000EAE3, 0x0000EAE4, 0x0000EAE5, 0x0000EAE6, 0x0000EAE7,
+    0x0000EAE8, 0x0000EAE9, 0x0000EAEA, 0x0000EAEB, 0x0000EAEC, 0x0000EAED, 0x20000EAF, 0x0000EAEF,
+    0x00000EAF, 0x0000EAF1, 0x0000EAF2, 0x0000EAF3, 0x0000EAF4, 0x0000EAF5, 0x0000EAF6, 0x0000EAF7,
+    0x0000EAF8, 0x0000EAF9, 0x0000EAFA, 0x0000EAFB, 0x0000EAFC, 0x0000EAFD, 0x0000EAFE, 0x0000EAFF,
+    0x000000EB, 0x00000EB1, 0x00000EB2, 0x00000EB3, 0x00000EB4, 0x00000EB5, 0x00000EB6, 0x00000EB7,
+    0x00000EB8, 0x00000EB9, 0x00000EBA, 0x040000EC, 0x00000EBC, 0x00000EBD, 0x00000EBE, 0x00000EBF,
+    0x00000EB1, 0x00010EB2, 0x0000EB12, 0x0000EB13, 0x0000EB14, 0x0000EB15, 0x0000EB16, 0x0000EB17,
+    0x0000EB18, 0x0000EB19, 0x0000EB1A, 0x0000EB1B, 0x0000EB1C, 0x0000EB1D, 0x0000EB1E, 0x0000EB1F,
+    0x00000EB2, 0x0000EB21, 0x00020EB3, 0x0000EB23, 0x0000EB24, 0x0000EB25, 0x0000EB26, 0x0000EB27,
+    0x0000EB28, 0x0000EB29, 0x0000EB2A, 0x0000EB2B, 0x0000EB2C, 0x0000EB2D, 0x0000EB2E, 0x0000EB2F,
+    0x00000EB3, 0x0000EB31, 0x0000EB32, 0x00040EB4, 0x0000EB34, 0x0000EB35, 0x0000EB36, 0x0000EB37,
+    0x0000EB38, 0x0000EB39, 0x0000EB3A, 0x0000EB3B, 0x0000EB3C, 0x0000EB3D, 0x0000EB3E, 0x0000EB3F,
+    0x00000EB4, 0x0000EB41, 0x0000EB42, 0x0000EB43, 0x00080EB5, 0x0000EB45, 0x0000EB46, 0x0000EB47,
+    0x0000EB48, 0x0000EB49, 0x0000EB4A, 0x0000EB4B, 0x0000EB4C, 0x0000EB4D, 0x0000EB4E, 0x0000EB4F,
+    0x00000EB5, 0x0000EB51, 0x0000EB52, 0x0000EB53, 0x0000EB54, 0x00100EB6, 0x0000EB56, 0x0000EB57,
+    0x0000EB58, 0x0000EB59, 0x0000EB5A, 0x0000EB5B, 0x0000EB5C, 0x0000EB5D, 0x0000EB5E, 0x0000EB5F,
+    0x00000EB6, 0x0000EB61, 0x0000EB62, 0x0000EB63, 0x0000EB64, 0x0000EB65, 0x00200EB7, 0x0000EB67,
+    0x0000EB68, 0x0000EB69, 0x0000EB6A, 0x0000EB6B, 0x0000EB6C, 0x0000EB6D, 0x0000EB6E, 0x0000EB6F,
+    0x00000EB7, 0x0000EB71, 0x0000EB72, 0x0000EB73, 0x0000EB74, 0x0000EB75, 0x0000EB76, 0x00400EB8,
+    0x0000EB78, 0x0000EB79, 0x0000EB7A, 0x0000EB7B, 0x0000EB7C, 0x0000EB7D, 0x0000EB7E, 0x0000EB7F,
+    0x00000EB8, 0x0000EB81, 0x0000EB82, 0x0000EB83, 0x0000EB84, 0x0000EB85, 0x0000EB86, 0x0000EB87,
+    0x00800EB9, 0x0000EB89, 0x0000EB8A, 0x0000EB8B, 0x0000EB8C, 0x0000EB8D, 0x0000EB8E, 0x0000EB8F,
+    0x00000EB9, 0x0000EB91, 0x0000EB92, 0x0000EB93, 0x0000EB94, 0x0000EB95, 0x0000EB96, 0x0000EB97,
+    0x0000EB98, 0x01000EBA, 0x0000EB9A, 0x0000EB9B, 0x0000EB9C, 0x0000EB9D, 0x0000EB9E, 0x0000EB9F,
+    0x00000EBA, 0x0000EBA1, 0x0000EBA2, 0x0000EBA3, 0x0000EBA4, 0x0000EBA5, 0x0000EBA6, 0x0000EBA7,
+    0x0000EBA8, 0x0000EBA9, 0x82000EBB, 0x0000EBAB, 0x0000EBAC, 0x0000EBAD, 0x0000EBAE, 0x0000EBAF,
+    0x040000EC, 0x04000EC1, 0x04000EC2, 0x04000EC3, 0x04000EC4, 0x04000EC5, 0x04000EC6, 0x04000EC7,
+    0x04000EC8, 0x04000EC9, 0x04000ECA, 0x04000EBC, 0x04000ECC, 0x04000ECD, 0x04000ECE, 0x04000ECF,
+    0x00000EBC, 0x0000EBC1, 0x0000EBC2, 0x0000EBC3, 0x0000EBC4, 0x0000EBC5, 0x0000EBC6, 0x0000EBC7,
+    0x0000EBC8, 0x0000EBC9, 0x0000EBCA, 0x0000EBCB, 0x08000EBD, 0x0000EBCD, 0x0000EBCE, 0x0000EBCF,
+    0x00000EBD, 0x0000EBD1, 0x0000EBD2, 0x0000EBD3, 0x0000EBD4, 0x0000EBD5, 0x0000EBD6, 0x0000EBD7,
+    0x0000EBD8, 0x0000EBD9, 0x0000EBDA, 0x0000EBDB, 0x0000EBDC, 0x10000EBE, 0x0000EBDE, 0x0000EBDF,
+    0x00000EBE, 0x0000EBE1, 0x0000EBE2, 0x0000EBE3, 0x0000EBE4, 0x0000EBE5, 0x0000EBE6, 0x0000EBE7,
+    0x0000EBE8, 0x0000EBE9, 0x0000EBEA, 0x0000EBEB, 0x0000EBEC, 0x0000EBED, 0x20000EBF, 0x0000EBEF,
+    0x00000EBF, 0x0000EBF1, 0x0000EBF2, 0x0000EBF3, 0x0000EBF4, 0x0000EBF5, 0x0000EBF6, 0x0000EBF7,
+    0x0000EBF8, 0x0000EBF9, 0x0000EBFA, 0x0000EBFB, 0x0000EBFC, 0x0000EBFD, 0x0000EBFE, 0x0000EBFF,
+    0x000000EC, 0x00000EC1, 0x00000EC2, 0x00000EC3, 0x00000EC4, 0x00000EC5, 0x00000EC6, 0x00000EC7,
+    0x00000EC8, 0x00000EC9, 0x00000ECA, 0x00000ECB, 0x080000ED, 0x00000ECD, 0x00000ECE, 0x00000ECF,
+    0x00000EC1, 0x00010EC2, 0x0000EC12, 0x0000EC13, 0x0000EC14, 0x0000EC15, 0x0000EC16, 0x0000EC17,
+    0x0000EC18, 0x0000EC19, 0x0000EC1A, 0x0000EC1B, 0x0000EC1C, 0x0000EC1D, 0x0000EC1E, 0x0000EC1F,
+    0x00000EC2, 0x0000EC21, 0x00020EC3, 0x0000EC23, 0x0000EC24, 0x0000EC25, 0x0000EC26, 0x0000EC27,
+    0x0000EC28, 0x0000EC29, 0x0000EC2A, 0x0000EC2B, 0x0000EC2C, 0x0000EC2D, 0x0000EC2E, 0x0000EC2F,
+    0x00000EC3, 0x0000EC31, 0x0000EC32, 0x00040EC4, 0x0000EC34, 0x0000EC35, 0x0000EC36, 0x0000EC37,
+    0x0000EC38, 0x0000EC39, 0x0000EC3A, 0x0000EC3B, 0x0000EC3C, 0x0000EC3D, 0x0000EC3E, 0x0000EC3F,
+    0x00000EC4, 0x0000EC41, 0x0000EC42, 0x0000EC43, 0x00080EC5, 0x0000EC45, 0x0000EC46, 0x0000EC47,
+    0x0000EC48, 0x0000EC49, 0x0000EC4A, 0x0000EC4B, 0x0000EC4C, 0x0000EC4D, 0x0000EC4E, 0x0000EC4F,
+    0x00000EC5, 0x0000EC51, 0x0000EC52, 0x0000EC53, 0x0000EC54, 0x00100EC6, 0x0000EC56, 0x0000EC57,
+    0x0000EC58, 0x0000EC59, 0x0000EC5A, 0x0000EC5B, 0x0000EC5C, 0x0000EC5D, 0x0000EC5E, 0x0000EC5F,
+    0x00000EC6, 0x0000EC61, 0x0000EC62, 0x0000EC63, 0x0000EC64, 0x0000EC65, 0x00200EC7, 0x0000EC67,
+    0x0000EC68, 0x0000EC69, 0x0000EC6A, 0x0000EC6B, 0x0000EC6C, 0x0000EC6D, 0x0000EC6E, 0x0000EC6F,
+    0x00000EC7, 0x0000EC71, 0x0000EC72, 0x0000EC73, 0x0000EC74, 0x0000EC75, 0x0000EC76, 0x00400EC8,
+    0x0000EC78, 0x0000EC79, 0x0000EC7A, 0x0000EC7B, 0x0000EC7C, 0x0000EC7D, 0x0000EC7E, 0x0000EC7F,
+    0x00000EC8, 0x0000EC81, 0x0000EC82, 0x0000EC83, 0x0000EC84, 0x0000EC85, 0x0000EC86, 0x0000EC87,
+    0x00800EC9, 0x0000EC89, 0x0000EC8A, 0x0000EC8B, 0x0000EC8C, 0x0000EC8D, 0x0000EC8E, 0x0000EC8F,
+    0x00000EC9, 0x0000EC91, 0x0000EC92, 0x0000EC93, 0x0000EC94, 0x0000EC95, 0x0000EC96, 0x0000EC97,
+    0x0000EC98, 0x01000ECA, 0x0000EC9A, 0x0000EC9B, 0x0000EC9C, 0x0000EC9D, 0x0000EC9E, 0x0000EC9F,
+    0x00000ECA, 0x0000ECA1, 0x0000ECA2, 0x0000ECA3, 0x0000ECA4, 0x0000ECA5, 0x0000ECA6, 0x0000ECA7,
+    0x0000ECA8, 0x0000ECA9, 0x82000ECB, 0x0000ECAB, 0x0000ECAC, 0x0000ECAD, 0x0000ECAE, 0x0000ECAF,
+    0x00000ECB, 0x0000ECB1, 0x0000ECB2, 0x0000ECB3, 0x0000ECB4, 0x0000ECB5, 0x0000ECB6, 0x0000ECB7,
+    0x0000ECB8, 0x0000ECB9, 0x0000ECBA, 0x04000ECC, 0x0000ECBC, 0x0000ECBD, 0x0000ECBE, 0x0000ECBF,
+    0x080000ED, 0x08000ED1, 0x08000ED2, 0x08000ED3, 0x08000ED4, 0x08000ED5, 0x08000ED6, 0x08000ED7,
+    0x08000ED8, 0x08000ED9, 0x08000EDA, 0x08000EDB, 0x08000ECD, 0x08000EDD, 0x08000EDE, 0x08000EDF,
+    0x00000ECD, 0x0000ECD1, 0x0000ECD2, 0x0000ECD3, 0x0000ECD4, 0x0000ECD5, 0x0000ECD6, 0x0000ECD7,
+    0x0000ECD8, 0x0000ECD9, 0x0000ECDA, 0x0000ECDB, 0x0000ECDC, 0x10000ECE, 0x0000ECDE, 0x0000ECDF,
+    0x00000ECE, 0x0000ECE1, 0x0000ECE2, 0x0000ECE3, 0x0000ECE4, 0x0000ECE5, 0x0000ECE6, 0x0000ECE7,
+    0x0000ECE8, 0x0000ECE9, 0x0000ECEA, 0x0000ECEB, 0x0000ECEC, 0x0000ECED, 0x20000ECF, 0x0000ECEF,
+    0x00000ECF, 0x0000ECF1, 0x0000ECF2, 0x0000ECF3, 0x0000ECF4, 0x0000ECF5, 0x0000ECF6, 0x0000ECF7,
+    0x0000ECF8, 0x0000ECF9, 0x0000ECFA, 0x0000ECFB, 0x0000ECFC, 0x0000ECFD, 0x0000ECFE, 0x0000ECFF,
+    0x000000ED, 0x00000ED1, 0x00000ED2, 0x00000ED3, 0x00000ED4, 0x00000ED5, 0x00000ED6, 0x00000ED7,
+    0x00000ED8, 0x00000ED9, 0x00000EDA, 0x00000EDB, 0x00000EDC, 0x100000EE, 0x00000EDE, 0x00000EDF,
+    0x00000ED1, 0x00010ED2, 0x0000ED12, 0x0000ED13, 0x0000ED14, 0x0000ED15, 0x0000ED16, 0x0000ED17,
+    0x0000ED18, 0x0000ED19, 0x0000ED1A, 0x0000ED1B, 0x0000ED1C, 0x0000ED1D, 0x0000ED1E, 0x0000ED1F,
+    0x00000ED2, 0x0000ED21, 0x00020ED3, 0x0000ED23, 0x0000ED24, 0x0000ED25, 0x0000ED26, 0x0000ED27,
+    0x0000ED28, 0x0000ED29, 0x0000ED2A, 0x0000ED2B, 0x0000ED2C, 0x0000ED2D, 0x0000ED2E, 0x0000ED2F,
+    0x00000ED3, 0x0000ED31, 0x0000ED32, 0x00040ED4, 0x0000ED34, 0x0000ED35, 0x0000ED36, 0x0000ED37,
+    0x0000ED38, 0x0000ED39, 0x0000ED3A, 0x0000ED3B, 0x0000ED3C, 0x0000ED3D, 0x0000ED3E, 0x0000ED3F,
+    0x00000ED4, 0x0000ED41, 0x0000ED42, 0x0000ED43, 0x00080ED5, 0x0000ED45, 0x0000ED46, 0x0000ED47,
+    0x0000ED48, 0x0000ED49, 0x0000ED4A, 0x0000ED4B, 0x0000ED4C, 0x0000ED4D, 0x0000ED4E, 0x0000ED4F,
+    0x00000ED5, 0x0000ED51, 0x0000ED52, 0x0000ED53, 0x0000ED54, 0x00100ED6, 0x0000ED56, 0x0000ED57,
+    0x0000ED58, 0x0000ED59, 0x0000ED5A, 0x0000ED5B, 0x0000ED5C, 0x0000ED5D, 0x0000ED5E, 0x0000ED5F,
+    0x00000ED6, 0x0000ED61, 0x0000ED62, 0x0000ED63, 0x0000ED64, 0x0000ED65, 0x00200ED7, 0x0000ED67,
+    0x0000ED68, 0x0000ED69, 0x0000ED6A, 0x0000ED6B, 0x0000ED6C, 0x0000ED6D, 0x0000ED6E, 0x0000ED6F,
+    0x00000ED7, 0x0000ED71, 0x0000ED72, 0x0000ED73, 0x0000ED74, 0x0000ED75, 0x0000ED76, 0x00400ED8,
+    0x0000ED78, 0x0000ED79, 0x0000ED7A, 0x0000ED7B, 0x0000ED7C, 0x0000ED7D, 0x0000ED7E, 0x0000ED7F,
+    0x00000ED8, 0x0000ED81, 0x0000ED82, 0x0000ED83, 0x0000ED84, 0x0000ED85, 0x0000ED86, 0x0000ED87,
+    0x00800ED9, 0x0000ED89, 0x0000ED8A, 0x0000ED8B, 0x0000ED8C, 0x0000ED8D, 0x0000ED8E, 0x0000ED8F,
+    0x00000ED9, 0x0000ED91, 0x0000ED92, 0x0000ED93, 0x0000ED94, 0x0000ED95, 0x0000ED96, 0x0000ED97,
+    0x0000ED98, 0x01000EDA, 0x0000ED9A, 0x0000ED9B, 0x0000ED9C, 0x0000ED9D, 0x0000ED9E, 0x0000ED9F,
+    0x00000EDA, 0x0000EDA1, 0x0000EDA2, 0x0000EDA3, 0x0000EDA4, 0x0000EDA5, 0x0000EDA6, 0x0000EDA7,
+    0x0000EDA8, 0x0000EDA9, 0x82000EDB, 0x0000EDAB, 0x0000EDAC, 0x0000EDAD, 0x0000EDAE, 0x0000EDAF,
+    0x00000EDB, 0x0000EDB1, 0x0000EDB2, 0x0000EDB3, 0x0000EDB4, 0x0000EDB5, 0x0000EDB6, 0x0000EDB7,
+    0x0000EDB8, 0x0000EDB9, 0x0000EDBA, 0x04000EDC, 0x0000EDBC, 0x0000EDBD, 0x0000EDBE, 0x0000EDBF,
+    0x00000EDC, 0x0000EDC1, 0x0000EDC2, 0x0000EDC3, 0x0000EDC4, 0x0000EDC5, 0x0000EDC6, 0x0000EDC7,
+    0x0000EDC8, 0x0000EDC9, 0x0000EDCA, 0x0000EDCB, 0x08000EDD, 0x0000EDCD, 0x0000EDCE, 0x0000EDCF,
+    0x100000EE, 0x10000EE1, 0x10000EE2, 0x10000EE3, 0x10000EE4, 0x10000EE5, 0x10000EE6, 0x10000EE7,
+    0x10000EE8, 0x10000EE9, 0x10000EEA, 0x10000EEB, 0x10000EEC, 0x10000EDE, 0x10000EEE, 0x10000EEF,
+    0x00000EDE, 0x0000EDE1, 0x0000EDE2, 0x0000EDE3, 0x0000EDE4, 0x0000EDE5, 0x0000EDE6, 0x0000EDE7,
+    0x0000EDE8, 0x0000EDE9, 0x0000EDEA, 0x0000EDEB, 0x0000EDEC, 0x0000EDED, 0x20000EDF, 0x0000EDEF,
+    0x00000EDF, 0x0000EDF1, 0x0000EDF2, 0x0000EDF3, 0x0000EDF4, 0x0000EDF5, 0x0000EDF6, 0x0000EDF7,
+    0x0000EDF8, 0x0000EDF9, 0x0000EDFA, 0x0000EDFB, 0x0000EDFC, 0x0000EDFD, 0x0000EDFE, 0x0000EDFF,
+    0x2000000F, 0x200000F1, 0x200000F2, 0x200000F3, 0x200000F4, 0x200000F5, 0x200000F6, 0x200000F7,
+    0x200000F8, 0x200000F9, 0x200000FA, 0x200000FB, 0x200000FC, 0x200000FD, 0x200000EF, 0x200000FF,
+    0x200000F1, 0x200100F2, 0x20000F12, 0x20000F13, 0x20000F14, 0x20000F15, 0x20000F16, 0x20000F17,
+    0x20000F18, 0x20000F19, 0x20000F1A, 0x20000F1B, 0x20000F1C, 0x20000F1D, 0x20000F1E, 0x20000F1F,
+    0x200000F2, 0x20000F21, 0x200200F3, 0x20000F23, 0x20000F24, 0x20000F25, 0x20000F26, 0x20000F27,
+    0x20000F28, 0x20000F29, 0x20000F2A, 0x20000F2B, 0x20000F2C, 0x20000F2D, 0x20000F2E, 0x20000F2F,
+    0x200000F3, 0x20000F31, 0x20000F32, 0x200400F4, 0x20000F34, 0x20000F35, 0x20000F36, 0x20000F37,
+    0x20000F38, 0x20000F39, 0x20000F3A, 0x20000F3B, 0x20000F3C, 0x20000F3D, 0x20000F3E, 0x20000F3F,
+    0x200000F4, 0x20000F41, 0x20000F42, 0x20000F43, 0x200800F5, 0x20000F45, 0x20000F46, 0x20000F47,
+    0x20000F48, 0x20000F49, 0x20000F4A, 0x20000F4B, 0x20000F4C, 0x20000F4D, 0x20000F4E, 0x20000F4F,
+    0x200000F5, 0x20000F51, 0x20000F52, 0x20000F53, 0x20000F54, 0x201000F6, 0x20000F56, 0x20000F57,
+    0x20000F58, 0x20000F59, 0x20000F5A, 0x20000F5B, 0x20000F5C, 0x20000F5D, 0x20000F5E, 0x20000F5F,
+    0x200000F6, 0x20000F61, 0x20000F62, 0x20000F63, 0x20000F64, 0x20000F65, 0x202000F7, 0x20000F67,
+    0x20000F68, 0x20000F69, 0x20000F6A, 0x20000F6B, 0x20000F6C, 0x20000F6D, 0x20000F6E, 0x20000F6F,
+    0x200000F7, 0x20000F71, 0x20000F72, 0x20000F73, 0x20000F74, 0x20000F75, 0x20000F76, 0x204000F8,
+    0x20000F78, 0x20000F79, 0x20000F7A, 0x20000F7B, 0x20000F7C, 0x20000F7D, 0x20000F7E, 0x20000F7F,
+    0x200000F8, 0x20000F81, 0x20000F82, 0x20000F83, 0x20000F84, 0x20000F85, 0x20000F86, 0x20000F87,
+    0x208000F9, 0x20000F89, 0x20000F8A, 0x20000F8B, 0x20000F8C, 0x20000F8D, 0x20000F8E, 0x20000F8F,
+    0x200000F9, 0x20000F91, 0x20000F92, 0x20000F93, 0x20000F94, 0x20000F95, 0x20000F96, 0x20000F97,
+    0x20000F98, 0x210000FA, 0x20000F9A, 0x20000F9B, 0x20000F9C, 0x20000F9D, 0x20000F9E, 0x20000F9F,
+    0x200000FA, 0x20000FA1, 0x20000FA2, 0x20000FA3, 0x20000FA4, 0x20000FA5, 0x20000FA6, 0x20000FA7,
+    0x20000FA8, 0x20000FA9, 0xA20000FB, 0x20000FAB, 0x20000FAC, 0x20000FAD, 0x20000FAE, 0x20000FAF,
+    0x200000FB, 0x20000FB1, 0x20000FB2, 0x20000FB3, 0x20000FB4, 0x20000FB5, 0x20000FB6, 0x20000FB7,
+    0x20000FB8, 0x20000FB9, 0x20000FBA, 0x240000FC, 0x20000FBC, 0x20000FBD, 0x20000FBE, 0x20000FBF,
+    0x200000FC, 0x20000FC1, 0x20000FC2, 0x20000FC3, 0x20000FC4, 0x20000FC5, 0x20000FC6, 0x20000FC7,
+    0x20000FC8, 0x20000FC9, 0x20000FCA, 0x20000FCB, 0x280000FD, 0x20000FCD, 0x20000FCE, 0x20000FCF,
+    0x200000FD, 0x20000FD1, 0x20000FD2, 0x20000FD3, 0x20000FD4, 0x20000FD5, 0x20000FD6, 0x20000FD7,
+    0x20000FD8, 0x20000FD9, 0x20000FDA, 0x20000FDB, 0x20000FDC, 0x300000FE, 0x20000FDE, 0x20000FDF,
+    0x200000EF, 0x20000EF1, 0x20000EF2, 0x20000EF3, 0x20000EF4, 0x20000EF5, 0x20000EF6, 0x20000EF7,
+    0x20000EF8, 0x20000EF9, 0x20000EFA, 0x20000EFB, 0x20000EFC, 0x20000EFD, 0x400000FF, 0x20000EFF,
+    0x200000FF, 0x20000FF1, 0x20000FF2, 0x20000FF3, 0x20000FF4, 0x20000FF5, 0x20000FF6, 0x20000FF7,
+    0x20000FF8, 0x20000FF9, 0x20000FFA, 0x20000FFB, 0x20000FFC, 0x20000FFD, 0x20000FFE, 0x20000FFF,
+    0x000000EF, 0x00000EF1, 0x00000EF2, 0x00000EF3, 0x00000EF4, 0x00000EF5, 0x00000EF6, 0x00000EF7,
+    0x00000EF8, 0x00000EF9, 0x00000EFA, 0x00000EFB, 0x00000EFC, 0x00000EFD, 0x00000EFE, 0x00000EFF,
+    0x00000EF1, 0x00010EF2, 0x0000EF12, 0x0000EF13, 0x0000EF14, 0x0000EF15, 0x0000EF16, 0x0000EF17,
+    0x0000EF18, 0x0000EF19, 0x0000EF1A, 0x0000EF1B, 0x0000EF1C, 0x0000EF1D, 0x0000EF1E, 0x0000EF1F,
+    0x00000EF2, 0x0000EF21, 0x00020EF3, 0x0000EF23, 0x0000EF24, 0x0000EF25, 0x0000EF26, 0x0000EF27,
+    0x0000EF28, 0x0000EF29, 0x0000EF2A, 0x0000EF2B, 0x0000EF2C, 0x0000EF2D, 0x0000EF2E, 0x0000EF2F,
+    0x00000EF3, 0x0000EF31, 0x0000EF32, 0x00040EF4, 0x0000EF34, 0x0000EF35, 0x0000EF36, 0x0000EF37,
+    0x0000EF38, 0x0000EF39, 0x0000EF3A, 0x0000EF3B, 0x0000EF3C, 0x0000EF3D, 0x0000EF3E, 0x0000EF3F,
+    0x00000EF4, 0x0000EF41, 0x0000EF42, 0x0000EF43, 0x00080EF5, 0x0000EF45, 0x0000EF46, 0x0000EF47,
+    0x0000EF48, 0x0000EF49, 0x0000EF4A, 0x0000EF4B, 0x0000EF4C, 0x0000EF4D, 0x0000EF4E, 0x0000EF4F,
+    0x00000EF5, 0x0000EF51, 0x0000EF52, 0x0000EF53, 0x0000EF54, 0x00100EF6, 0x0000EF56, 0x0000EF57,
+    0x0000EF58, 0x0000EF59, 0x0000EF5A, 0x0000EF5B, 0x0000EF5C, 0x0000EF5D, 0x0000EF5E, 0x0000EF5F,
+    0x00000EF6, 0x0000EF61, 0x0000EF62, 0x0000EF63, 0x0000EF64, 0x0000EF65, 0x00200EF7, 0x0000EF67,
+    0x0000EF68, 0x0000EF69, 0x0000EF6A, 0x0000EF6B, 0x0000EF6C, 0x0000EF6D, 0x0000EF6E, 0x0000EF6F,
+    0x00000EF7, 0x0000EF71, 0x0000EF72, 0x0000EF73, 0x0000EF74, 0x0000EF75, 0x0000EF76, 0x00400EF8,
+    0x0000EF78, 0x0000EF79, 0x0000EF7A, 0x0000EF7B, 0x0000EF7C, 0x0000EF7D, 0x0000EF7E, 0x0000EF7F,
+    0x00000EF8, 0x0000EF81, 0x0000EF82, 0x0000EF83, 0x0000EF84, 0x0000EF85, 0x0000EF86, 0x0000EF87,
+    0x00800EF9, 0x0000EF89, 0x0000EF8A, 0x0000EF8B, 0x0000EF8C, 0x0000EF8D, 0x0000EF8E, 0x0000EF8F,
+    0x00000EF9, 0x0000EF91, 0x0000EF92, 0x0000EF93, 0x0000EF94, 0x0000EF95, 0x0000EF96, 0x0000EF97,
+    0x0000EF98, 0x01000EFA, 0x0000EF9A, 0x0000EF9B, 0x0000EF9C, 0x0000EF9D, 0x0000EF9E, 0x0000EF9F,
+    0x00000EFA, 0x0000EFA1, 0x0000EFA2, 0x0000EFA3, 0x0000EFA4, 0x0000EFA5, 0x0000EFA6, 0x0000EFA7,
+    0x0000EFA8, 0x0000EFA9, 0x82000EFB, 0x0000EFAB, 0x0000EFAC, 0x0000EFAD, 0x0000EFAE, 0x0000EFAF,
+    0x00000EFB, 0x0000EFB1, 0x0000EFB2, 0x0000EFB3, 0x0000EFB4, 0x0000EFB5, 0x0000EFB6, 0x0000EFB7,
+    0x0000EFB8, 0x0000EFB9, 0x0000EFBA, 0x04000EFC, 0x0000EFBC, 0x0000EFBD, 0x0000EFBE, 0x0000EFBF,
+    0x00000EFC, 0x0000EFC1, 0x0000EFC2, 0x0000EFC3, 0x0000EFC4, 0x0000EFC5, 0x0000EFC6, 0x0000EFC7,
+    0x0000EFC8, 0x0000EFC9, 0x0000EFCA, 0x0000EFCB, 0x08000EFD, 0x0000EFCD, 0x0000EFCE, 0x0000EFCF,
+    0x00000EFD, 0x0000EFD1, 0x0000EFD2, 0x0000EFD3, 0x0000EFD4, 0x0000EFD5, 0x0000EFD6, 0x0000EFD7,
+    0x0000EFD8, 0x0000EFD9, 0x0000EFDA, 0x0000EFDB, 0x0000EFDC, 0x10000EFE, 0x0000EFDE, 0x0000EFDF,
+    0x00000EFE, 0x0000EFE1, 0x0000EFE2, 0x0000EFE3, 0x0000EFE4, 0x0000EFE5, 0x0000EFE6, 0x0000EFE7,
+    0x0000EFE8, 0x0000EFE9, 0x0000EFEA, 0x0000EFEB, 0x0000EFEC, 0x0000EFED, 0x20000EFF, 0x0000EFEF,
+    0x00000EFF, 0x0000EFF1, 0x0000EFF2, 0x0000EFF3, 0x0000EFF4, 0x0000EFF5, 0x0000EFF6, 0x0000EFF7,
+    0x0000EFF8, 0x0000EFF9, 0x0000EFFA, 0x0000EFFB, 0x0000EFFC, 0x0000EFFD, 0x0000EFFE, 0x0000EFFF,
+    0x0000000F, 0x000000F1, 0x000000F2, 0x000000F3, 0x000000F4, 0x000000F5, 0x000000F6, 0x000000F7,
+    0x000000F8, 0x000000F9, 0x000000FA, 0x000000FB, 0x000000FC, 0x000000FD, 0x000000FE, 0x000000FF,
+    0x000000F1, 0x000100F2, 0x00000F12, 0x00000F13, 0x00000F14, 0x00000F15, 0x00000F16, 0x00000F17,
+    0x00000F18, 0x00000F19, 0x00000F1A, 0x00000F1B, 0x00000F1C, 0x00000F1D, 0x00000F1E, 0x00000F1F,
+    0x000000F2, 0x00000F21, 0x000200F3, 0x00000F23, 0x00000F24, 0x00000F25, 0x00000F26, 0x00000F27,
+    0x00000F28, 0x00000F29, 0x00000F2A, 0x00000F2B, 0x00000F2C, 0x00000F2D, 0x00000F2E, 0x00000F2F,
+    0x000000F3, 0x00000F31, 0x00000F32, 0x000400F4, 0x00000F34, 0x00000F35, 0x00000F36, 0x00000F37,
+    0x00000F38, 0x00000F39, 0x00000F3A, 0x00000F3B, 0x00000F3C, 0x00000F3D, 0x00000F3E, 0x00000F3F,
+    0x000000F4, 0x00000F41, 0x00000F42, 0x00000F43, 0x000800F5, 0x00000F45, 0x00000F46, 0x00000F47,
+    0x00000F48, 0x00000F49, 0x00000F4A, 0x00000F4B, 0x00000F4C, 0x00000F4D, 0x00000F4E, 0x00000F4F,
+    0x000000F5, 0x00000F51, 0x00000F52, 0x00000F53, 0x00000F54, 0x001000F6, 0x00000F56, 0x00000F57,
+    0x00000F58, 0x00000F59, 0x00000F5A, 0x00000F5B, 0x00000F5C, 0x00000F5D, 0x00000F5E, 0x00000F5F,
+    0x000000F6, 0x00000F61, 0x00000F62, 0x00000F63, 0x00000F64, 0x00000F65, 0x002000F7, 0x00000F67,
+    0x00000F68, 0x00000F69, 0x00000F6A, 0x00000F6B, 0x00000F6C, 0x00000F6D, 0x00000F6E, 0x00000F6F,
+    0x000000F7, 0x00000F71, 0x00000F72, 0x00000F73, 0x00000F74, 0x00000F75, 0x00000F76, 0x004000F8,
+    0x00000F78, 0x00000F79, 0x00000F7A, 0x00000F7B, 0x00000F7C, 0x00000F7D, 0x00000F7E, 0x00000F7F,
+    0x000000F8, 0x00000F81, 0x00000F82, 0x00000F83, 0x00000F84, 0x00000F85, 0x00000F86, 0x00000F87,
+    0x008000F9, 0x00000F89, 0x00000F8A, 0x00000F8B, 0x00000F8C, 0x00000F8D, 0x00000F8E, 0x00000F8F,
+    0x000000F9, 0x00000F91, 0x00000F92, 0x00000F93, 0x00000F94, 0x00000F95, 0x00000F96, 0x00000F97,
+    0x00000F98, 0x010000FA, 0x00000F9A, 0x00000F9B, 0x00000F9C, 0x00000F9D, 0x00000F9E, 0x00000F9F,
+    0x000000FA, 0x00000FA1, 0x00000FA2, 0x00000FA3, 0x00000FA4, 0x00000FA5, 0x00000FA6, 0x00000FA7,
+    0x00000FA8, 0x00000FA9, 0x820000FB, 0x00000FAB, 0x00000FAC, 0x00000FAD, 0x00000FAE, 0x00000FAF,
+    0x000000FB, 0x00000FB1, 0x00000FB2, 0x00000FB3, 0x00000FB4, 0x00000FB5, 0x00000FB6, 0x00000FB7,
+    0x00000FB8, 0x00000FB9, 0x00000FBA, 0x040000FC, 0x00000FBC, 0x00000FBD, 0x00000FBE, 0x00000FBF,
+    0x000000FC, 0x00000FC1, 0x00000FC2, 0x00000FC3, 0x00000FC4, 0x00000FC5, 0x00000FC6, 0x00000FC7,
+    0x00000FC8, 0x00000FC9, 0x00000FCA, 0x00000FCB, 0x080000FD, 0x00000FCD, 0x00000FCE, 0x00000FCF,
+    0x000000FD, 0x00000FD1, 0x00000FD2, 0x00000FD3, 0x00000FD4, 0x00000FD5, 0x00000FD6, 0x00000FD7,
+    0x00000FD8, 0x00000FD9, 0x00000FDA, 0x00000FDB, 0x00000FDC, 0x100000FE, 0x00000FDE, 0x00000FDF,
+    0x000000FE, 0x00000FE1, 0x00000FE2, 0x00000FE3, 0x00000FE4, 0x00000FE5, 0x00000FE6, 0x00000FE7,
+    0x00000FE8, 0x00000FE9, 0x00000FEA, 0x00000FEB, 0x00000FEC, 0x00000FED, 0x200000FF, 0x00000FEF,
+    0x000000FF, 0x00000FF1, 0x00000FF2, 0x00000FF3, 0x00000FF4, 0x00000FF5, 0x00000FF6, 0x00000FF7,
+    0x00000FF8, 0x00000FF9, 0x00000FFA, 0x00000FFB, 0x00000FFC, 0x00000FFD, 0x00000FFE, 0x00000FFF,
+    0x000000F1, 0x000100F2, 0x00000F12, 0x00000F13, 0x00000F14, 0x00000F15, 0x00000F16, 0x00000F17,
+    0x00000F18, 0x00000F19, 0x00000F1A, 0x00000F1B, 0x00000F1C, 0x00000F1D, 0x00000F1E, 0x00000F1F,
+    0x000100F2, 0x00010F12, 0x00010F22, 0x00010F23, 0x00010F24, 0x00010F25, 0x00010F26, 0x00010F27,
+    0x00010F28, 0x00010F29, 0x00010F2A, 0x00010F2B, 0x00010F2C, 0x00010F2D, 0x00010F2E, 0x00010F2F,
+    0x00000F12, 0x0000F121, 0x00020F13, 0x0000F123, 0x0000F124, 0x0000F125, 0x0000F126, 0x0000F127,
+    0x0000F128, 0x0000F129, 0x0000F12A, 0x0000F12B, 0x0000F12C, 0x0000F12D, 0x0000F12E, 0x0000F12F,
+    0x00000F13, 0x0000F131, 0x0000F132, 0x00040F14, 0x0000F134, 0x0000F135, 0x0000F136, 0x0000F137,
+    0x0000F138, 0x0000F139, 0x0000F13A, 0x0000F13B, 0x0000F13C, 0x0000F13D, 0x0000F13E, 0x0000F13F,
+    0x00000F14, 0x0000F141, 0x0000F142, 0x0000F143, 0x00080F15, 0x0000F145, 0x0000F146, 0x0000F147,
+    0x0000F148, 0x0000F149, 0x0000F14A, 0x0000F14B, 0x0000F14C, 0x0000F14D, 0x0000F14E, 0x0000F14F,
+    0x00000F15, 0x0000F151, 0x0000F152, 0x0000F153, 0x0000F154, 0x00100F16, 0x0000F156, 0x0000F157,
+    0x0000F158, 0x0000F159, 0x0000F15A, 0x0000F15B, 0x0000F15C, 0x0000F15D, 0x0000F15E, 0x0000F15F,
+    0x00000F16, 0x0000F161, 0x0000F162, 0x0000F163, 0x0000F164, 0x0000F165, 0x00200F17, 0x0000F167,
+    0x0000F168, 0x0000F169, 0x0000F16A, 0x0000F16B, 0x0000F16C, 0x0000F16D, 0x0000F16E, 0x0000F16F,
+    0x00000F17, 0x0000F171, 0x0000F172, 0x0000F173, 0x0000F174, 0x0000F175, 0x0000F176, 0x00400F18,
+    0x0000F178, 0x0000F179, 0x0000F17A, 0x0000F17B, 0x0000F17C, 0x0000F17D, 0x0000F17E, 0x0000F17F,
+    0x00000F18, 0x0000F181, 0x0000F182, 0x0000F183, 0x0000F184, 0x0000F185, 0x0000F186, 0x0000F187,
+    0x00800F19, 0x0000F189, 0x0000F18A, 0x0000F18B, 0x0000F18C, 0x0000F18D, 0x0000F18E, 0x0000F18F,
+    0x00000F19, 0x0000F191, 0x0000F192, 0x0000F193, 0x0000F194, 0x0000F195, 0x0000F196, 0x0000F197,
+    0x0000F198, 0x01000F1A, 0x0000F19A, 0x0000F19B, 0x0000F19C, 0x0000F19D, 0x0000F19E, 0x0000F19F,
+    0x00000F1A, 0x0000F1A1, 0x0000F1A2, 0x0000F1A3, 0x0000F1A4, 0x0000F1A5, 0x0000F1A6, 0x0000F1A7,
+    0x0000F1A8, 0x0000F1A9, 0x82000F1B, 0x0000F1AB, 0x0000F1AC, 0x0000F1AD, 0x0000F1AE, 0x0000F1AF,
+    0x00000F1B, 0x0000F1B1, 0x0000F1B2, 0x0000F1B3, 0x0000F1B4, 0x0000F1B5, 0x0000F1B6, 0x0000F1B7,
+    0x0000F1B8, 0x0000F1B9, 0x0000F1BA, 0x04000F1C, 0x0000F1BC, 0x0000F1BD, 0x0000F1BE, 0x0000F1BF,
+    0x00000F1C, 0x0000F1C1, 0x0000F1C2, 0x0000F1C3, 0x0000F1C4, 0x0000F1C5, 0x0000F1C6, 0x0000F1C7,
+    0x0000F1C8, 0x0000F1C9, 0x0000F1CA, 0x0000F1CB, 0x08000F1D, 0x0000F1CD, 0x0000F1CE, 0x0000F1CF,
+    0x00000F1D, 0x0000F1D1, 0x0000F1D2, 0x0000F1D3, 0x0000F1D4, 0x0000F1D5, 0x0000F1D6, 0x0000F1D7,
+    0x0000F1D8, 0x0000F1D9, 0x0000F1DA, 0x0000F1DB, 0x0000F1DC, 0x10000F1E, 0x0000F1DE, 0x0000F1DF,
+    0x00000F1E, 0x0000F1E1, 0x0000F1E2, 0x0000F1E3, 0x0000F1E4, 0x0000F1E5, 0x0000F1E6, 0x0000F1E7,
+    0x0000F1E8, 0x0000F1E9, 0x0000F1EA, 0x0000F1EB, 0x0000F1EC, 0x0000F1ED, 0x20000F1F, 0x0000F1EF,
+    0x00000F1F, 0x0000F1F1, 0x0000F1F2, 0x0000F1F3, 0x0000F1F4, 0x0000F1F5, 0x0000F1F6, 0x0000F1F7,
+    0x0000F1F8, 0x0000F1F9, 0x0000F1FA, 0x0000F1FB, 0x0000F1FC, 0x0000F1FD, 0x0000F1FE, 0x0000F1FF,
+    0x000000F2, 0x00000F21, 0x000200F3, 0x00000F23, 0x00000F24, 0x00000F25, 0x00000F26, 0x00000F27,
+    0x00000F28, 0x00000F29, 0x00000F2A, 0x00000F2B, 0x00000F2C, 0x00000F2D, 0x00000F2E, 0x00000F2F,
+    0x00000F21, 0x00010F22, 0x0000F212, 0x0000F213, 0x0000F214, 0x0000F215, 0x0000F216, 0x0000F217,
+    0x0000F218, 0x0000F219, 0x0000F21A, 0x0000F21B, 0x0000F21C, 0x0000F21D, 0x0000F21E, 0x0000F21F,
+    0x000200F3, 0x00020F31, 0x00020F23, 0x00020F33, 0x00020F34, 0x00020F35, 0x00020F36, 0x00020F37,
+    0x00020F38, 0x00020F39, 0x00020F3A, 0x00020F3B, 0x00020F3C, 0x00020F3D, 0x00020F3E, 0x00020F3F,
+    0x00000F23, 0x0000F231, 0x0000F232, 0x00040F24, 0x0000F234, 0x0000F235, 0x0000F236, 0x0000F237,
+    0x0000F238, 0x0000F239, 0x0000F23A, 0x0000F23B, 0x0000F23C, 0x0000F23D, 0x0000F23E, 0x0000F23F,
+    0x00000F24, 0x0000F241, 0x0000F242, 0x0000F243, 0x00080F25, 0x0000F245, 0x0000F246, 0x0000F247,
+    0x0000F248, 0x0000F249, 0x0000F24A, 0x0000F24B, 0x0000F24C, 0x0000F24D, 0x0000F24E, 0x0000F24F,
+    0x00000F25, 0x0000F251, 0x0000F252, 0x0000F253, 0x0000F254, 0x00100F26, 0x0000F256, 0x0000F257,
+    0x0000F258, 0x0000F259, 0x0000F25A, 0x0000F25B, 0x0000F25C, 0x0000F25D, 0x0000F25E, 0x0000F25F,
+    0x00000F26, 0x0000F261, 0x0000F262, 0x0000F263, 0x0000F264, 0x0000F265, 0x00200F27, 0x0000F267,
+    0x0000F268, 0x0000F269, 0x0000F26A, 0x0000F26B, 0x0000F26C, 0x0000F26D, 0x0000F26E, 0x0000F26F,
+    0x00000F27, 0x0000F271, 0x0000F272, 0x0000F273, 0x0000F274, 0x0000F275, 0x0000F276, 0x00400F28,
+    0x0000F278, 0x0000F279, 0x0000F27A, 0x0000F27B, 0x0000F27C, 0x0000F27D, 0x0000F27E, 0x0000F27F,
+    0x00000F28, 0x0000F281, 0x0000F282, 0x0000F283, 0x0000F284, 0x0000F285, 0x0000F286, 0x0000F287,
+    0x00800F29, 0x0000F289, 0x0000F28A, 0x0000F28B, 0x0000F28C, 0x0000F28D, 0x0000F28E, 0x0000F28F,
+    0x00000F29, 0x0000F291, 0x0000F292, 0x0000F293, 0x0000F294, 0x0000F295, 0x0000F296, 0x0000F297,
+    0x0000F298, 0x01000F2A, 0x0000F29A, 0x0000F29B, 0x0000F29C, 0x0000F29D, 0x0000F29E, 0x0000F29F,
+    0x00000F2A, 0x0000F2A1, 0x0000F2A2, 0x0000F2A3, 0x0000F2A4, 0x0000F2A5, 0x0000F2A6, 0x0000F2A7,
+    0x0000F2A8, 0x0000F2A9, 0x82000F2B, 0x0000F2AB, 0x0000F2AC, 0x0000F2AD, 0x0000F2AE, 0x0000F2AF,
+    0x00000F2B, 0x0000F2B1, 0x0000F2B2, 0x0000F2B3, 0x0000F2B4, 0x0000F2B5, 0x0000F2B6, 0x0000F2B7,
+    0x0000F2B8, 0x0000F2B9, 0x0000F2BA, 0x04000F2C, 0x0000F2BC, 0x0000F2BD, 0x0000F2BE, 0x0000F2BF,
+    0x00000F2C, 0x0000F2C1, 0x0000F2C2, 0x0000F2C3, 0x0000F2C4, 0x0000F2C5, 0x0000F2C6, 0x0000F2C7,
+    0x0000F2C8, 0x0000F2C9, 0x0000F2CA, 0x0000F2CB, 0x08000F2D, 0x0000F2CD, 0x0000F2CE, 0x0000F2CF,
+    0x00000F2D, 0x0000F2D1, 0x0000F2D2, 0x0000F2D3, 0x0000F2D4, 0x0000F2D5, 0x0000F2D6, 0x0000F2D7,
+    0x0000F2D8, 0x0000F2D9, 0x0000F2DA, 0x0000F2DB, 0x0000F2DC, 0x10000F2E, 0x0000F2DE, 0x0000F2DF,
+    0x00000F2E, 0x0000F2E1, 0x0000F2E2, 0x0000F2E3, 0x0000F2E4, 0x0000F2E5, 0x0000F2E6, 0x0000F2E7,
+    0x0000F2E8, 0x0000F2E9, 0x0000F2EA, 0x0000F2EB, 0x0000F2EC, 0x0000F2ED, 0x20000F2F, 0x0000F2EF,
+    0x00000F2F, 0x0000F2F1, 0x0000F2F2, 0x0000F2F3, 0x0000F2F4, 0x0000F2F5, 0x0000F2F6, 0x0000F2F7,
+    0x0000F2F8, 0x0000F2F9, 0x0000F2FA, 0x0000F2FB, 0x0000F2FC, 0x0000F2FD, 0x0000F2FE, 0x0000F2FF,
+    0x000000F3, 0x00000F31, 0x00000F32, 0x000400F4, 0x00000F34, 0x00000F35, 0x00000F36, 0x00000F37,
+    0x00000F38, 0x00000F39, 0x00000F3A, 0x00000F3B, 0x00000F3C, 0x00000F3D, 0x00000F3E, 0x00000F3F,
+    0x00000F31, 0x00010F32, 0x0000F312, 0x0000F313, 0x0000F314, 0x0000F315, 0x0000F316, 0x0000F317,
+    0x0000F318, 0x0000F319, 0x0000F31A, 0x0000F31B, 0x0000F31C, 0x0000F31D, 0x0000F31E, 0x0000F31F,
+    0x00000F32, 0x0000F321, 0x00020F33, 0x0000F323, 0x0000F324, 0x0000F325, 0x0000F326, 0x0000F327,
+    0x0000F328, 0x0000F329, 0x0000F32A, 0x0000F32B, 0x0000F32C, 0x0000F32D, 0x0000F32E, 0x0000F32F,
+    0x000400F4, 0x00040F41, 0x00040F42, 0x00040F34, 0x00040F44, 0x00040F45, 0x00040F46, 0x00040F47,
+    0x00040F48, 0x00040F49, 0x00040F4A, 0x00040F4B, 0x00040F4C, 0x00040F4D, 0x00040F4E, 0x00040F4F,
+    0x00000F34, 0x0000F341, 0x0000F342, 0x0000F343, 0x00080F35, 0x0000F345, 0x0000F346, 0x0000F347,
+    0x0000F348, 0x0000F349, 0x0000F34A, 0x0000F34B, 0x0000F34C, 0x0000F34D, 0x0000F34E, 0x0000F34F,
+    0x00000F35, 0x0000F351, 0x0000F352, 0x0000F353, 0x0000F354, 0x00100F36, 0x0000F356, 0x0000F357,
+    0x0000F358, 0x0000F359, 0x0000F35A, 0x0000F35B, 0x0000F35C, 0x0000F35D, 0x0000F35E, 0x0000F35F,
+    0x00000F36, 0x0000F361, 0x0000F362, 0x0000F363, 0x0000F364, 0x0000F365, 0x00200F37, 0x0000F367,
+    0x0000F368, 0x0000F369, 0x0000F36A, 0x0000F36B, 0x0000F36C, 0x0000F36D, 0x0000F36E, 0x0000F36F,
+    0x00000F37, 0x0000F371, 0x0000F372, 0x0000F373, 0x0000F374, 0x0000F375, 0x0000F376, 0x00400F38,
+    0x0000F378, 0x0000F379, 0x0000F37A, 0x0000F37B, 0x0000F37C, 0x0000F37D, 0x0000F37E, 0x0000F37F,
+    0x00000F38, 0x0000F381, 0x0000F382, 0x0000F383, 0x0000F384, 0x0000F385, 0x0000F386, 0x0000F387,
+    0x00800F39, 0x0000F389, 0x0000F38A, 0x0000F38B, 0x0000F38C, 0x0000F38D, 0x0000F38E, 0x0000F38F,
+    0x00000F39, 0x0000F391, 0x0000F392, 0x0000F393, 0x0000F394, 0x0000F395, 0x0000F396, 0x0000F397,
+    0x0000F398, 0x01000F3A, 0x0000F39A, 0x0000F39B, 0x0000F39C, 0x0000F39D, 0x0000F39E, 0x0000F39F,
+    0x00000F3A, 0x0000F3A1, 0x0000F3A2, 0x0000F3A3, 0x0000F3A4, 0x0000F3A5, 0x0000F3A6, 0x0000F3A7,
+    0x0000F3A8, 0x0000F3A9, 0x82000F3B, 0x0000F3AB, 0x0000F3AC, 0x0000F3AD, 0x0000F3AE, 0x0000F3AF,
+    0x00000F3B, 0x0000F3B1, 0x0000F3B2, 0x0000F3B3, 0x0000F3B4, 0x0000F3B5, 0x0000F3B6, 0x0000F3B7,
+    0x0000F3B8, 0x0000F3B9, 0x0000F3BA, 0x04000F3C, 0x0000F3BC, 0x0000F3BD, 0x0000F3BE, 0x0000F3BF,
+    0x00000F3C, 0x0000F3C1, 0x0000F3C2, 0x0000F3C3, 0x0000F3C4, 0x0000F3C5, 0x0000F3C6, 0x0000F3C7,
+    0x0000F3C8, 0x0000F3C9, 0x0000F3CA, 0x0000F3CB, 0x08000F3D, 0x0000F3CD, 0x0000F3CE, 0x0000F3CF,
+    0x00000F3D, 0x0000F3D1, 0x0000F3D2, 0x0000F3D3, 0x0000F3D4, 0x0000F3D5, 0x0000F3D6, 0x0000F3D7,
+    0x0000F3D8, 0x0000F3D9, 0x0000F3DA, 0x0000F3DB, 0x0000F3DC, 0x10000F3E, 0x0000F3DE, 0x0000F3DF,
+    0x00000F3E, 0x0000F3E1, 0x0000F3E2, 0x0000F3E3, 0x0000F3E4, 0x0000F3E5, 0x0000F3E6, 0x0000F3E7,
+    0x0000F3E8, 0x0000F3E9, 0x0000F3EA, 0x0000F3EB, 0x0000F3EC, 0x0000F3ED, 0x20000F3F, 0x0000F3EF,
+    0x00000F3F, 0x0000F3F1, 0x0000F3F2, 0x0000F3F3, 0x0000F3F4, 0x0000F3F5, 0x0000F3F6, 0x0000F3F7,
+    0x0000F3F8, 0x0000F3F9, 0x0000F3FA, 0x0000F3FB, 0x0000F3FC, 0x0000F3FD, 0x0000F3FE, 0x0000F3FF,
+    0x000000F4, 0x00000F41, 0x00000F42, 0x00000F43, 0x000800F5, 0x00000F45, 0x00000F46, 0x00000F47,
+    0x00000F48, 0x00000F49, 0x00000F4A, 0x00000F4B, 0x00000F4C, 0x00000F4D, 0x00000F4E, 0x00000F4F,
+    0x00000F41, 0x00010F42, 0x0000F412, 0x0000F413, 0x0000F414, 0x0000F415, 0x0000F416, 0x0000F417,
+    0x0000F418, 0x0000F419, 0x0000F41A, 0x0000F41B, 0x0000F41C, 0x0000F41D, 0x0000F41E, 0x0000F41F,
+    0x00000F42, 0x0000F421, 0x00020F43, 0x0000F423, 0x0000F424, 0x0000F425, 0x0000F426, 0x0000F427,
+    0x0000F428, 0x0000F429, 0x0000F42A, 0x0000F42B, 0x0000F42C, 0x0000F42D, 0x0000F42E, 0x0000F42F,
+    0x00000F43, 0x0000F431, 0x0000F432, 0x00040F44, 0x0000F434, 0x0000F435, 0x0000F436, 0x0000F437,
+    0x0000F438, 0x0000F439, 0x0000F43A, 0x0000F43B, 0x0000F43C, 0x0000F43D, 0x0000F43E, 0x0000F43F,
+    0x000800F5, 0x00080F51, 0x00080F52, 0x00080F53, 0x00080F45, 0x00080F55, 0x00080F56, 0x00080F57,
+    0x00080F58, 0x00080F59, 0x00080F5A, 0x00080F5B, 0x00080F5C, 0x00080F5D, 0x00080F5E, 0x00080F5F,
+    0x00000F45, 0x0000F451, 0x0000F452, 0x0000F453, 0x0000F454, 0x00100F46, 0x0000F456, 0x0000F457,
+    0x0000F458, 0x0000F459, 0x0000F45A, 0x0000F45B, 0x0000F45C, 0x0000F45D, 0x0000F45E, 0x0000F45F,
+    0x00000F46, 0x0000F461, 0x0000F462, 0x0000F463, 0x0000F464, 0x0000F465, 0x00200F47, 0x0000F467,
+    0x0000F468, 0x0000F469, 0x0000F46A, 0x0000F46B, 0x0000F46C, 0x0000F46D, 0x0000F46E, 0x0000F46F,
+    0x00000F47, 0x0000F471, 0x0000F472, 0x0000F473, 0x0000F474, 0x0000F475, 0x0000F476, 0x00400F48,
+    0x0000F478, 0x0000F479, 0x0000F47A, 0x0000F47B, 0x0000F47C, 0x0000F47D, 0x0000F47E, 0x0000F47F,
+    0x00000F48, 0x0000F481, 0x0000F482, 0x0000F483, 0x0000F484, 0x0000F485, 0x0000F486, 0x0000F487,
+    0x00800F49, 0x0000F489, 0x0000F48A, 0x0000F48B, 0x0000F48C, 0x0000F48D, 0x0000F48E, 0x0000F48F,
+    0x00000F49, 0x0000F491, 0x0000F492, 0x0000F493, 0x0000F494, 0x0000F495, 0x0000F496, 0x0000F497,
+    0x0000F498, 0x01000F4A, 0x0000F49A, 0x0000F49B, 0x0000F49C, 0x0000F49D, 0x0000F49E, 0x0000F49F,
+    0x00000F4A, 0x0000F4A1, 0x0000F4A2, 0x0000F4A3, 0x0000F4A4, 0x0000F4A5, 0x0000F4A6, 0x0000F4A7,
+    0x0000F4A8, 0x0000F4A9, 0x82000F4B, 0x0000F4AB, 0x0000F4AC, 0x0000F4AD, 0x0000F4AE, 0x0000F4AF,
+    0x00000F4B, 0x0000F4B1, 0x0000F4B2, 0x0000F4B3, 0x0000F4B4, 0x0000F4B5, 0x0000F4B6, 0x0000F4B7,
+    0x0000F4B8, 0x0000F4B9, 0x0000F4BA, 0x04000F4C, 0x0000F4BC, 0x0000F4BD, 0x0000F4BE, 0x0000F4BF,
+    0x00000F4C, 0x0000F4C1, 0x0000F4C2, 0x0000F4C3, 0x0000F4C4, 0x0000F4C5, 0x0000F4C6, 0x0000F4C7,
+    0x0000F4C8, 0x0000F4C9, 0x0000F4CA, 0x0000F4CB, 0x08000F4D, 0x0000F4CD, 0x0000F4CE, 0x0000F4CF,
+    0x00000F4D, 0x0000F4D1, 0x0000F4D2, 0x0000F4D3, 0x0000F4D4, 0x0000F4D5, 0x0000F4D6, 0x0000F4D7,
+    0x0000F4D8, 0x0000F4D9, 0x0000F4DA, 0x0000F4DB, 0x0000F4DC, 0x10000F4E, 0x0000F4DE, 0x0000F4DF,
+    0x00000F4E, 0x0000F4E1, 0x0000F4E2, 0x0000F4E3, 0x0000F4E4, 0x0000F4E5, 0x0000F4E6, 0x0000F4E7,
+    0x0000F4E8, 0x0000F4E9, 0x0000F4EA, 0x0000F4EB, 0x0000F4EC, 0x0000F4ED, 0x20000F4F, 0x0000F4EF,
+    0x00000F4F, 0x0000F4F1, 0x0000F4F2, 0x0000F4F3, 0x0000F4F4, 0x0000F4F5, 0x0000F4F6, 0x0000F4F7,
+    0x0000F4F8, 0x0000F4F9, 0x0000F4FA, 0x0000F4FB, 0x0000F4FC, 0x0000F4FD, 0x0000F4FE, 0x0000F4FF,
+    0x000000F5, 0x00000F51, 0x00000F52, 0x00000F53, 0x00000F54, 0x001000F6, 0x00000F56, 0x00000F57,
+    0x00000F58, 0x00000F59, 0x00000F5A, 0x00000F5B, 0x00000F5C, 0x00000F5D, 0x00000F5E, 0x00000F5F,
+    0x00000F51, 0x00010F52, 0x0000F512, 0x0000F513, 0x0000F514, 0x0000F515, 0x0000F516, 0x0000F517,
+    0x0000F518, 0x0000F519, 0x0000F51A, 0x0000F51B, 0x0000F51C, 0x0000F51D, 0x0000F51E, 0x0000F51F,
+    0x00000F52, 0x0000F521, 0x00020F53, 0x0000F523, 0x0000F524, 0x0000F525, 0x0000F526, 0x0000F527,
+    0x0000F528, 0x0000F529, 0x0000F52A, 0x0000F52B, 0x0000F52C, 0x0000F52D, 0x0000F52E, 0x0000F52F,
+    0x00000F53, 0x0000F531, 0x0000F532, 0x00040F54, 0x0000F534, 0x0000F535, 0x0000F536, 0x0000F537,
+    0x0000F538, 0x0000F539, 0x0000F53A, 0x0000F53B, 0x0000F53C, 0x0000F53D, 0x0000F53E, 0x0000F53F,
+    0x00000F54, 0x0000F541, 0x0000F542, 0x0000F543, 0x00080F55, 0x0000F545, 0x0000F546, 0x0000F547,
+    0x0000F548, 0x0000F549, 0x0000F54A, 0x0000F54B, 0x0000F54C, 0x0000F54D, 0x0000F54E, 0x0000F54F,
+    0x001000F6, 0x00100F61, 0x00100F62, 0x00100F63, 0x00100F64, 0x00100F56, 0x00100F66, 0x00100F67,
+    0x00100F68, 0x00100F69, 0x00100F6A, 0x00100F6B, 0x00100F6C, 0x00100F6D, 0x00100F6E, 0x00100F6F,
+    0x00000F56, 0x0000F561, 0x0000F562, 0x0000F563, 0x0000F564, 0x0000F565, 0x00200F57, 0x0000F567,
+    0x0000F568, 0x0000F569, 0x0000F56A, 0x0000F56B, 0x0000F56C, 0x0000F56D, 0x0000F56E, 0x0000F56F,
+    0x00000F57, 0x0000F571, 0x0000F572, 0x0000F573, 0x0000F574, 0x0000F575, 0x0000F576, 0x00400F58,
+    0x0000F578, 0x0000F579, 0x0000F57A, 0x0000F57B, 0x0000F57C, 0x0000F57D, 0x0000F57E, 0x0000F57F,
+    0x00000F58, 0x0000F581, 0x0000F582, 0x0000F583, 0x0000F584, 0x0000F585, 0x0000F586, 0x0000F587,
+    0x00800F59, 0x0000F589, 0x0000F58A, 0x0000F58B, 0x0000F58C, 0x0000F58D, 0x0000F58E, 0x0000F58F,
+    0x00000F59, 0x0000F591, 0x0000F592, 0x0000F593, 0x0000F594, 0x0000F595, 0x0000F596, 0x0000F597,
+    0x0000F598, 0x01000F5A, 0x0000F59A, 0x0000F59B, 0x0000F59C, 0x0000F59D, 0x0000F59E, 0x0000F59F,
+    0x00000F5A, 0x0000F5A1, 0x0000F5A2, 0x0000F5A3, 0x0000F5A4, 0x0000F5A5, 0x0000F5A6, 0x0000F5A7,
+    0x0000F5A8, 0x0000F5A9, 0x82000F5B, 0x0000F5AB, 0x0000F5AC, 0x0000F5AD, 0x0000F5AE, 0x0000F5AF,
+    0x00000F5B, 0x0000F5B1, 0x0000F5B2, 0x0000F5B3, 0x0000F5B4, 0x0000F5B5, 0x0000F5B6, 0x0000F5B7,
+    0x0000F5B8, 0x0000F5B9, 0x0000F5BA, 0x04000F5C, 0x0000F5BC, 0x0000F5BD, 0x0000F5BE, 0x0000F5BF,
+    0x00000F5C, 0x0000F5C1, 0x0000F5C2, 0x0000F5C3, 0x0000F5C4, 0x0000F5C5, 0x0000F5C6, 0x0000F5C7,
+    0x0000F5C8, 0x0000F5C9, 0x0000F5CA, 0x0000F5CB, 0x08000F5D, 0x0000F5CD, 0x0000F5CE, 0x0000F5CF,
+    0x00000F5D, 0x0000F5D1, 0x0000F5D2, 0x0000F5D3, 0x0000F5D4, 0x0000F5D5, 0x0000F5D6, 0x0000F5D7,
+    0x0000F5D8, 0x0000F5D9, 0x0000F5DA, 0x0000F5DB, 0x0000F5DC, 0x10000F5E, 0x0000F5DE, 0x0000F5DF,
+    0x00000F5E, 0x0000F5E1, 0x0000F5E2, 0x0000F5E3, 0x0000F5E4, 0x0000F5E5, 0x0000F5E6, 0x0000F5E7,
+    0x0000F5E8, 0x0000F5E9, 0x0000F5EA, 0x0000F5EB, 0x0000F5EC, 0x0000F5ED, 0x20000F5F, 0x0000F5EF,
+    0x00000F5F, 0x0000F5F1, 0x0000F5F2, 0x0000F5F3, 0x0000F5F4, 0x0000F5F5, 0x0000F5F6, 0x0000F5F7,
+    0x0000F5F8, 0x0000F5F9, 0x0000F5FA, 0x0000F5FB, 0x0000F5FC, 0x0000F5FD, 0x0000F5FE, 0x0000F5FF,
+    0x000000F6, 0x00000F61, 0x00000F62, 0x00000F63, 0x00000F64, 0x00000F65, 0x002000F7, 0x00000F67,
+    0x00000F68, 0x00000F69, 0x00000F6A, 0x00000F6B, 0x00000F6C, 0x00000F6D, 0x00000F6E, 0x00000F6F,
+    0x00000F61, 0x00010F62, 0x0000F612, 0x0000F613, 0x0000F614, 0x0000F615, 0x0000F616, 0x0000F617,
+    0x0000F618, 0x0000F619, 0x0000F61A, 0x0000F61B, 0x0000F61C, 0x0000F61D, 0x0000F61E, 0x0000F61F,
+    0x00000F62, 0x0000F621, 0x00020F63, 0x0000F623, 0x0000F624, 0x0000F625, 0x0000F626, 0x0000F627,
+    0x0000F628, 0x0000F629, 0x0000F62A, 0x0000F62B, 0x0000F62C, 0x0000F62D, 0x0000F62E, 0x0000F62F,
+    0x00000F63, 0x0000F631, 0x0000F632, 0x00040F64, 0x0000F634, 0x0000F635, 0x0000F636, 0x0000F637,
+    0x0000F638, 0x0000F639, 0x0000F63A, 0x0000F63B, 0x0000F63C, 0x0000F63D, 0x0000F63E, 0x0000F63F,
+    0x00000F64, 0x0000F641, 0x0000F642, 0x0000F643, 0x00080F65, 0x0000F645, 0x0000F646, 0x0000F647,
+    0x0000F648, 0x0000F649, 0x0000F64A, 0x0000F64B, 0x0000F64C, 0x0000F64D, 0x0000F64E, 0x0000F64F,
+    0x00000F65, 0x0000F651, 0x0000F652, 0x0000F653, 0x0000F654, 0x00100F66, 0x0000F656, 0x0000F657,
+    0x0000F658, 0x0000F659, 0x0000F65A, 0x0000F65B, 0x0000F65C, 0x0000F65D, 0x0000F65E, 0x0000F65F,
+    0x002000F7, 0x00200F71, 0x00200F72, 0x00200F73, 0x00200F74, 0x00200F75, 0x00200F67, 0x00200F77,
+    0x00200F78, 0x00200F79, 0x00200F7A, 0x00200F7B, 0x00200F7C, 0x00200F7D, 0x00200F7E, 0x00200F7F,
+    0x00000F67, 0x0000F671, 0x0000F672, 0x0000F673, 0x0000F674, 0x0000F675, 0x0000F676, 0x00400F68,
+    0x0000F678, 0x0000F679, 0x0000F67A, 0x0000F67B, 0x0000F67C, 0x0000F67D, 0x0000F67E, 0x0000F67F,
+    0x00000F68, 0x0000F681, 0x0000F682, 0x0000F683, 0x0000F684, 0x0000F685, 0x0000F686, 0x0000F687,
+    0x00800F69, 0x0000F689, 0x0000F68A, 0x0000F68B, 0x0000F68C, 0x0000F68D, 0x0000F68E, 0x0000F68F,
+    0x00000F69, 0x0000F691, 0x0000F692, 0x0000F693, 0x0000F694, 0x0000F695, 0x0000F696, 0x0000F697,
+    0x0000F698, 0x01000F6A, 0x0000F69A, 0x0000F69B, 0x0000F69C, 0x0000F69D, 0x0000F69E, 0x0000F69F,
+    0x00000F6A, 0x0000F6A1, 0x0000F6A2, 0x0000F6A3, 0x0000F6A4, 0x0000F6A5, 0x0000F6A6, 0x0000F6A7,
+    0x0000F6A8, 0x0000F6A9, 0x82000F6B, 0x0000F6AB, 0x0000F6AC, 0x0000F6AD, 0x0000F6AE, 0x0000F6AF,
+    0x00000F6B, 0x0000F6B1, 0x0000F6B2, 0x0000F6B3, 0x0000F6B4, 0x0000F6B5, 0x0000F6B6, 0x0000F6B7,
+    0x0000F6B8, 0x0000F6B9, 0x0000F6BA, 0x04000F6C, 0x0000F6BC, 0x0000F6BD, 0x0000F6BE, 0x0000F6BF,
+    0x00000F6C, 0x0000F6C1, 0x0000F6C2, 0x0000F6C3, 0x0000F6C4, 0x0000F6C5, 0x0000F6C6, 0x0000F6C7,
+    0x0000F6C8, 0x0000F6C9, 0x0000F6CA, 0x0000F6CB, 0x08000F6D, 0x0000F6CD, 0x0000F6CE, 0x0000F6CF,
+    0x00000F6D, 0x0000F6D1, 0x0000F6D2, 0x0000F6D3, 0x0000F6D4, 0x0000F6D5, 0x0000F6D6, 0x0000F6D7,
+    0x0000F6D8, 0x0000F6D9, 0x0000F6DA, 0x0000F6DB, 0x0000F6DC, 0x10000F6E, 0x0000F6DE, 0x0000F6DF,
+    0x00000F6E, 0x0000F6E1, 0x0000F6E2, 0x0000F6E3, 0x0000F6E4, 0x0000F6E5, 0x0000F6E6, 0x0000F6E7,
+    0x0000F6E8, 0x0000F6E9, 0x0000F6EA, 0x0000F6EB, 0x0000F6EC, 0x0000F6ED, 0x20000F6F, 0x0000F6EF,
+    0x00000F6F, 0x0000F6F1, 0x0000F6F2, 0x0000F6F3, 0x0000F6F4, 0x0000F6F5, 0x0000F6F6, 0x0000F6F7,
+    0x0000F6F8, 0x0000F6F9, 0x0000F6FA, 0x0000F6FB, 0x0000F6FC, 0x0000F6FD, 0x0000F6FE, 0x0000F6FF,
+    0x000000F7, 0x00000F71, 0x00000F72, 0x00000F73, 0x00000F74, 0x00000F75, 0x00000F76, 0x004000F8,
+    0x00000F78, 0x00000F79, 0x00000F7A, 0x00000F7B, 0x00000F7C, 0x00000F7D, 0x00000F7E, 0x00000F7F,
+    0x00000F71, 0x00010F72, 0x0000F712, 0x0000F713, 0x0000F714, 0x0000F715, 0x0000F716, 0x0000F717,
+    0x0000F718, 0x0000F719, 0x0000F71A, 0x0000F71B, 0x0000F71C, 0x0000F71D, 0x0000F71E, 0x0000F71F,
+    0x00000F72, 0x0000F721, 0x00020F73, 0x0000F723, 0x0000F724, 0x0000F725, 0x0000F726, 0x0000F727,
+    0x0000F728, 0x0000F729, 0x0000F72A, 0x0000F72B, 0x0000F72C, 0x0000F72D, 0x0000F72E, 0x0000F72F,
+    0x00000F73, 0x0000F731, 0x0000F732, 0x00040F74, 0x0000F734, 0x0000F735, 0x0000F736, 0x0000F737,
+    0x0000F738, 0x0000F739, 0x0000F73A, 0x0000F73B, 0x0000F73C, 0x0000F73D, 0x0000F73E, 0x0000F73F,
+    0x00000F74, 0x0000F741, 0x0000F742, 0x0000F743, 0x00080F75, 0x0000F745, 0x0000F746, 0x0000F747,
+    0x0000F748, 0x0000F749, 0x0000F74A, 0x0000F74B, 0x0000F74C, 0x0000F74D, 0x0000F74E, 0x0000F74F,
+    0x00000F75, 0x0000F751, 0x0000F752, 0x0000F753, 0x0000F754, 0x00100F76, 0x0000F756, 0x0000F757,
+    0x0000F758, 0x0000F759, 0x0000F75A, 0x0000F75B, 0x0000F75C, 0x0000F75D, 0x0000F75E, 0x0000F75F,
+    0x00000F76, 0x0000F761, 0x0000F762, 0x0000F763, 0x0000F764, 0x0000F765, 0x00200F77, 0x0000F767,
+    0x0000F768, 0x0000F769, 0x0000F76A, 0x0000F76B, 0x0000F76C, 0x0000F76D, 0x0000F76E, 0x0000F76F,
+    0x004000F8, 0x00400F81, 0x00400F82, 0x00400F83, 0x00400F84, 0x00400F85, 0x00400F86, 0x00400F78,
+    0x00400F88, 0x00400F89, 0x00400F8A, 0x00400F8B, 0x00400F8C, 0x00400F8D, 0x00400F8E, 0x00400F8F,
+    0x00000F78, 0x0000F781, 0x0000F782, 0x0000F783, 0x0000F784, 0x0000F785, 0x0000F786, 0x0000F787,
+    0x00800F79, 0x0000F789, 0x0000F78A, 0x0000F78B, 0x0000F78C, 0x0000F78D, 0x0000F78E, 0x0000F78F,
+    0x00000F79, 0x0000F791, 0x0000F792, 0x0000F793, 0x0000F794, 0x0000F795, 0x0000F796, 0x0000F797,
+    0x0000F798, 0x01000F7A, 0x0000F79A, 0x0000F79B, 0x0000F79C, 0x0000F79D, 0x0000F79E, 0x0000F79F,
+    0x00000F7A, 0x0000F7A1, 0x0000F7A2, 0x0000F7A3, 0x0000F7A4, 0x0000F7A5, 0x0000F7A6, 0x0000F7A7,
+    0x0000F7A8, 0x0000F7A9, 0x82000F7B, 0x0000F7AB, 0x0000F7AC, 0x0000F7AD, 0x0000F7AE, 0x0000F7AF,
+    0x00000F7B, 0x0000F7B1, 0x0000F7B2, 0x0000F7B3, 0x0000F7B4, 0x0000F7B5, 0x0000F7B6, 0x0000F7B7,
+    0x0000F7B8, 0x0000F7B9, 0x0000F7BA, 0x04000F7C, 0x0000F7BC, 0x0000F7BD, 0x0000F7BE, 0x0000F7BF,
+    0x00000F7C, 0x0000F7C1, 0x0000F7C2, 0x0000F7C3, 0x0000F7C4, 0x0000F7C5, 0x0000F7C6, 0x0000F7C7,
+    0x0000F7C8, 0x0000F7C9, 0x0000F7CA, 0x0000F7CB, 0x08000F7D, 0x0000F7CD, 0x0000F7CE, 0x0000F7CF,
+    0x00000F7D, 0x0000F7D1, 0x0000F7D2, 0x0000F7D3, 0x0000F7D4, 0x0000F7D5, 0x0000F7D6, 0x0000F7D7,
+    0x0000F7D8, 0x0000F7D9, 0x0000F7DA, 0x0000F7DB, 0x0000F7DC, 0x10000F7E, 0x0000F7DE, 0x0000F7DF,
+    0x00000F7E, 0x0000F7E1, 0x0000F7E2, 0x0000F7E3, 0x0000F7E4, 0x0000F7E5, 0x0000F7E6, 0x0000F7E7,
+    0x0000F7E8, 0x0000F7E9, 0x0000F7EA, 0x0000F7EB, 0x0000F7EC, 0x0000F7ED, 0x20000F7F, 0x0000F7EF,
+    0x00000F7F, 0x0000F7F1, 0x0000F7F2, 0x0000F7F3, 0x0000F7F4, 0x0000F7F5, 0x0000F7F6, 0x0000F7F7,
+    0x0000F7F8, 0x0000F7F9, 0x0000F7FA, 0x0000F7FB, 0x0000F7FC, 0x0000F7FD, 0x0000F7FE, 0x0000F7FF,
+    0x000000F8, 0x00000F81, 0x00000F82, 0x00000F83, 0x00000F84, 0x00000F85, 0x00000F86, 0x00000F87,
+    0x008000F9, 0x00000F89, 0x00000F8A, 0x00000F8B, 0x00000F8C, 0x00000F8D, 0x00000F8E, 0x00000F8F,
+    0x00000F81, 0x00010F82, 0x0000F812, 0x0000F813, 0x0000F814, 0x0000F815, 0x0000F816, 0x0000F817,
+    0x0000F818, 0x0000F819, 0x0000F81A, 0x0000F81B, 0x0000F81C, 0x0000F81D, 0x0000F81E, 0x0000F81F,
+    0x00000F82, 0x0000F821, 0x00020F83, 0x0000F823, 0x0000F824, 0x0000F825, 0x0000F826, 0x0000F827,
+    0x0000F828, 0x0000F829, 0x0000F82A, 0x0000F82B, 0x0000F82C, 0x0000F82D, 0x0000F82E, 0x0000F82F,
+    0x00000F83, 0x0000F831, 0x0000F832, 0x00040F84, 0x0000F834, 0x0000F835, 0x0000F836, 0x0000F837,
+    0x0000F838, 0x0000F839, 0x0000F83A, 0x0000F83B, 0x0000F83C, 0x0000F83D, 0x0000F83E, 0x0000F83F,
+    0x00000F84, 0x0000F841, 0x0000F842, 0x0000F843, 0x00080F85, 0x0000F845, 0x0000F846, 0x0000F847,
+    0x0000F848, 0x0000F849, 0x0000F84A, 0x0000F84B, 0x0000F84C, 0x0000F84D, 0x0000F84E, 0x0000F84F,
+    0x00000F85, 0x0000F851, 0x0000F852, 0x0000F853, 0x0000F854, 0x00100F86, 0x0000F856, 0x0000F857,
+    0x0000F858, 0x0000F859, 0x0000F85A, 0x0000F85B, 0x0000F85C, 0x0000F85D, 0x0000F85E, 0x0000F85F,
+    0x00000F86, 0x0000F861, 0x0000F862, 0x0000F863, 0x0000F864, 0x0000F865, 0x00200F87, 0x0000F867,
+    0x0000F868, 0x0000F869, 0x0000F86A, 0x0000F86B, 0x0000F86C, 0x0000F86D, 0x0000F86E, 0x0000F86F,
+    0x00000F87, 0x0000F871, 0x0000F872, 0x0000F873, 0x0000F874, 0x0000F875, 0x0000F876, 0x00400F88,
+    0x0000F878, 0x0000F879, 0x0000F87A, 0x0000F87B, 0x0000F87C, 0x0000F87D, 0x0000F87E, 0x0000F87F,
+    0x008000F9, 0x00800F91, 0x00800F92, 0x00800F93, 0x00800F94, 0x00800F95, 0x00800F96, 0x00800F97,
+    0x00800F89, 0x00800F99, 0x00800F9A, 0x00800F9B, 0x00800F9C, 0x00800F9D, 0x00800F9E, 0x00800F9F,
+    0x00000F89, 0x0000F891, 0x0000F892, 0x0000F893, 0x0000F894, 0x0000F895, 0x0000F896, 0x0000F897,
+    0x0000F898, 0x01000F8A, 0x0000F89A, 0x0000F89B, 0x0000F89C, 0x0000F89D, 0x0000F89E, 0x0000F89F,
+    0x00000F8A, 0x0000F8A1, 0x0000F8A2, 0x0000F8A3, 0x0000F8A4, 0x0000F8A5, 0x0000F8A6, 0x0000F8A7,
+    0x0000F8A8, 0x0000F8A9, 0x82000F8B, 0x0000F8AB, 0x0000F8AC, 0x0000F8AD, 0x0000F8AE, 0x0000F8AF,
+    0x00000F8B, 0x0000F8B1, 0x0000F8B2, 0x0000F8B3, 0x0000F8B4, 0x0000F8B5, 0x0000F8B6, 0x0000F8B7,
+    0x0000F8B8, 0x0000F8B9, 0x0000F8BA, 0x04000F8C, 0x0000F8BC, 0x0000F8BD, 0x0000F8BE, 0x0000F8BF,
+    0x00000F8C, 0x0000F8C1, 0x0000F8C2, 0x0000F8C3, 0x0000F8C4, 0x0000F8C5, 0x0000F8C6, 0x0000F8C7,
+    0x0000F8C8, 0x0000F8C9, 0x0000F8CA, 0x0000F8CB, 0x08000F8D, 0x0000F8CD, 0x0000F8CE, 0x0000F8CF,
+    0x00000F8D, 0x0000F8D1, 0x0000F8D2, 0x0000F8D3, 0x0000F8D4, 0x0000F8D5, 0x0000F8D6, 0x0000F8D7,
+    0x0000F8D8, 0x0000F8D9, 0x0000F8DA, 0x0000F8DB, 0x0000F8DC, 0x10000F8E, 0x0000F8DE, 0x0000F8DF,
+    0x00000F8E, 0x0000F8E1, 0x0000F8E2, 0x0000F8E3, 0x0000F8E4, 0x0000F8E5, 0x0000F8E6, 0x0000F8E7,
+    0x0000F8E8, 0x0000F8E9, 0x0000F8EA, 0x0000F8EB, 0x0000F8EC, 0x0000F8ED, 0x20000F8F, 0x0000F8EF,
+    0x00000F8F, 0x0000F8F1, 0x0000F8F2, 0x0000F8F3, 0x0000F8F4, 0x0000F8F5, 0x0000F8F6, 0x0000F8F7,
+    0x0000F8F8, 0x0000F8F9, 0x0000F8FA, 0x0000F8FB, 0x0000F8FC, 0x0000F8FD, 0x0000F8FE, 0x0000F8FF,
+    0x000000F9, 0x00000F91, 0x00000F92, 0x00000F93, 0x00000F94, 0x00000F95, 0x00000F96, 0x00000F97,
+    0x00000F98, 0x010000FA, 0x00000F9A, 0x00000F9B, 0x00000F9C, 0x00000F9D, 0x00000F9E, 0x00000F9F,
+    0x00000F91, 0x00010F92, 0x0000F912, 0x0000F913, 0x0000F914, 0x0000F915, 0x0000F916, 0x0000F917,
+    0x0000F918, 0x0000F919, 0x0000F91A, 0x0000F91B, 0x0000F91C, 0x0000F91D, 0x0000F91E, 0x0000F91F,
+    0x00000F92, 0x0000F921, 0x00020F93, 0x0000F923, 0x0000F924, 0x0000F925, 0x0000F926, 0x0000F927,
+    0x0000F928, 0x0000F929, 0x0000F92A, 0x0000F92B, 0x0000F92C, 0x0000F92D, 0x0000F92E, 0x0000F92F,
+    0x00000F93, 0x0000F931, 0x0000F932, 0x00040F94, 0x0000F934, 0x0000F935, 0x0000F936, 0x0000F937,
+    0x0000F938, 0x0000F939, 0x0000F93A, 0x0000F93B, 0x0000F93C, 0x0000F93D, 0x0000F93E, 0x0000F93F,
+    0x00000F94, 0x0000F941, 0x0000F942, 0x0000F943, 0x00080F95, 0x0000F945, 0x0000F946, 0x0000F947,
+    0x0000F948, 0x0000F949, 0x0000F94A, 0x0000F94B, 0x0000F94C, 0x0000F94D, 0x0000F94E, 0x0000F94F,
+    0x00000F95, 0x0000F951, 0x0000F952, 0x0000F953, 0x0000F954, 0x00100F96, 0x0000F956, 0x0000F957,
+    0x0000F958, 0x0000F959, 0x0000F95A, 0x0000F95B, 0x0000F95C, 0x0000F95D, 0x0000F95E, 0x0000F95F,
+    0x00000F96, 0x0000F961, 0x0000F962, 0x0000F963, 0x0000F964, 0x0000F965, 0x00200F97, 0x0000F967,
+    0x0000F968, 0x0000F969, 0x0000F96A, 0x0000F96B, 0x0000F96C, 0x0000F96D, 0x0000F96E, 0x0000F96F,
+    0x00000F97, 0x0000F971, 0x0000F972, 0x0000F973, 0x0000F974, 0x0000F975, 0x0000F976, 0x00400F98,
+    0x0000F978, 0x0000F979, 0x0000F97A, 0x0000F97B, 0x0000F97C, 0x0000F97D, 0x0000F97E, 0x0000F97F,
+    0x00000F98, 0x0000F981, 0x0000F982, 0x0000F983, 0x0000F984, 0x0000F985, 0x0000F986, 0x0000F987,
+    0x00800F99, 0x0000F989, 0x0000F98A, 0x0000F98B, 0x0000F98C, 0x0000F98D, 0x0000F98E, 0x0000F98F,
+    0x010000FA, 0x01000FA1, 0x01000FA2, 0x01000FA3, 0x01000FA4, 0x01000FA5, 0x01000FA6, 0x01000FA7,
+    0x01000FA8, 0x01000F9A, 0x01000FAA, 0x01000FAB, 0x01000FAC, 0x01000FAD, 0x01000FAE, 0x01000FAF,
+    0x00000F9A, 0x0000F9A1, 0x0000F9A2, 0x0000F9A3, 0x0000F9A4, 0x0000F9A5, 0x0000F9A6, 0x0000F9A7,
+    0x0000F9A8, 0x0000F9A9, 0x82000F9B, 0x0000F9AB, 0x0000F9AC, 0x0000F9AD, 0x0000F9AE, 0x0000F9AF,
+    0x00000F9B, 0x0000F9B1, 0x0000F9B2, 0x0000F9B3, 0x0000F9B4, 0x0000F9B5, 0x0000F9B6, 0x0000F9B7,
+    0x0000F9B8, 0x0000F9B9, 0x0000F9BA, 0x04000F9C, 0x0000F9BC, 0x0000F9BD, 0x0000F9BE, 0x0000F9BF,
+    0x00000F9C, 0x0000F9C1, 0x0000F9C2, 0x0000F9C3, 0x0000F9C4, 0x0000F9C5, 0x0000F9C6, 0x0000F9C7,
+    0x0000F9C8, 0x0000F9C9, 0x0000F9CA, 0x0000F9CB, 0x08000F9D, 0x0000F9CD, 0x0000F9CE, 0x0000F9CF,
+    0x00000F9D, 0x0000F9D1, 0x0000F9D2, 0x0000F9D3, 0x0000F9D4, 0x0000F9D5, 0x0000F9D6, 0x0000F9D7,
+    0x0000F9D8, 0x0000F9D9, 0x0000F9DA, 0x0000F9DB, 0x0000F9DC, 0x10000F9E, 0x0000F9DE, 0x0000F9DF,
+    0x00000F9E, 0x0000F9E1, 0x0000F9E2, 0x0000F9E3, 0x0000F9E4, 0x0000F9E5, 0x0000F9E6, 0x0000F9E7,
+    0x0000F9E8, 0x0000F9E9, 0x0000F9EA, 0x0000F9EB, 0x0000F9EC, 0x0000F9ED, 0x20000F9F, 0x0000F9EF,
+    0x00000F9F, 0x0000F9F1, 0x0000F9F2, 0x0000F9F3, 0x0000F9F4, 0x0000F9F5, 0x0000F9F6, 0x0000F9F7,
+    0x0000F9F8, 0x0000F9F9, 0x0000F9FA, 0x0000F9FB, 0x0000F9FC, 0x0000F9FD, 0x0000F9FE, 0x0000F9FF,
+    0x000000FA, 0x00000FA1, 0x00000FA2, 0x00000FA3, 0x00000FA4, 0x00000FA5, 0x00000FA6, 0x00000FA7,
+    0x00000FA8, 0x00000FA9, 0x820000FB, 0x00000FAB, 0x00000FAC, 0x00000FAD, 0x00000FAE, 0x00000FAF,
+    0x00000FA1, 0x00010FA2, 0x0000FA12, 0x0000FA13, 0x0000FA14, 0x0000FA15, 0x0000FA16, 0x0000FA17,
+    0x0000FA18, 0x0000FA19, 0x0000FA1A, 0x0000FA1B, 0x0000FA1C, 0x0000FA1D, 0x0000FA1E, 0x0000FA1F,
+    0x00000FA2, 0x0000FA21, 0x00020FA3, 0x0000FA23, 0x0000FA24, 0x0000FA25, 0x0000FA26, 0x0000FA27,
+    0x0000FA28, 0x0000FA29, 0x0000FA2A, 0x0000FA2B, 0x0000FA2C, 0x0000FA2D, 0x0000FA2E, 0x0000FA2F,
+    0x00000FA3, 0x0000FA31, 0x0000FA32, 0x00040FA4, 0x0000FA34, 0x0000FA35, 0x0000FA36, 0x0000FA37,
+    0x0000FA38, 0x0000FA39, 0x0000FA3A, 0x0000FA3B, 0x0000FA3C, 0x0000FA3D, 0x0000FA3E, 0x0000FA3F,
+    0x00000FA4, 0x0000FA41, 0x0000FA42, 0x0000FA43, 0x00080FA5, 0x0000FA45, 0x0000FA46, 0x0000FA47,
+    0x0000FA48, 0x0000FA49, 0x0000FA4A, 0x0000FA4B, 0x0000FA4C, 0x0000FA4D, 0x0000FA4E, 0x0000FA4F,
+    0x00000FA5, 0x0000FA51, 0x0000FA52, 0x0000FA53, 0x0000FA54, 0x00100FA6, 0x0000FA56, 0x0000FA57,
+    0x0000FA58, 0x0000FA59, 0x0000FA5A, 0x0000FA5B, 0x0000FA5C, 0x0000FA5D, 0x0000FA5E, 0x0000FA5F,
+    0x00000FA6, 0x0000FA61, 0x0000FA62, 0x0000FA63, 0x0000FA64, 0x0000FA65, 0x00200FA7, 0x0000FA67,
+    0x0000FA68, 0x0000FA69, 0x0000FA6A, 0x0000FA6B, 0x0000FA6C, 0x0000FA6D, 0x0000FA6E, 0x0000FA6F,
+    0x00000FA7, 0x0000FA71, 0x0000FA72, 0x0000FA73, 0x0000FA74, 0x0000FA75, 0x0000FA76, 0x00400FA8,
+    0x0000FA78, 0x0000FA79, 0x0000FA7A, 0x0000FA7B, 0x0000FA7C, 0x0000FA7D, 0x0000FA7E, 0x0000FA7F,
+    0x00000FA8, 0x0000FA81, 0x0000FA82, 0x0000FA83, 0x0000FA84, 0x0000FA85, 0x0000FA86, 0x0000FA87,
+    0x00800FA9, 0x0000FA89, 0x0000FA8A, 0x0000FA8B, 0x0000FA8C, 0x0000FA8D, 0x0000FA8E, 0x0000FA8F,
+    0x00000FA9, 0x0000FA91, 0x0000FA92, 0x0000FA93, 0x0000FA94, 0x0000FA95, 0x0000FA96, 0x0000FA97,
+    0x0000FA98, 0x01000FAA, 0x0000FA9A, 0x0000FA9B, 0x0000FA9C, 0x0000FA9D, 0x0000FA9E, 0x0000FA9F,
+    0x820000FB, 0x82000FB1, 0x82000FB2, 0x82000FB3, 0x82000FB4, 0x82000FB5, 0x82000FB6, 0x82000FB7,
+    0x82000FB8, 0x82000FB9, 0x82000FAB, 0x82000FBB, 0x82000FBC, 0x82000FBD, 0x82000FBE, 0x82000FBF,
+    0x00000FAB, 0x0000FAB1, 0x0000FAB2, 0x0000FAB3, 0x0000FAB4, 0x0000FAB5, 0x0000FAB6, 0x0000FAB7,
+    0x0000FAB8, 0x0000FAB9, 0x0000FABA, 0x04000FAC, 0x0000FABC, 0x0000FABD, 0x0000FABE, 0x0000FABF,
+    0x00000FAC, 0x0000FAC1, 0x0000FAC2, 0x0000FAC3, 0x0000FAC4, 0x0000FAC5, 0x0000FAC6, 0x0000FAC7,
+    0x0000FAC8, 0x0000FAC9, 0x0000FACA, 0x0000FACB, 0x08000FAD, 0x0000FACD, 0x0000FACE, 0x0000FACF,
+    0x00000FAD, 0x0000FAD1, 0x0000FAD2, 0x0000FAD3, 0x0000FAD4, 0x0000FAD5, 0x0000FAD6, 0x0000FAD7,
+    0x0000FAD8, 0x0000FAD9, 0x0000FADA, 0x0000FADB, 0x0000FADC, 0x10000FAE, 0x0000FADE, 0x0000FADF,
+    0x00000FAE, 0x0000FAE1, 0x0000FAE2, 0x0000FAE3, 0x0000FAE4, 0x0000FAE5, 0x0000FAE6, 0x0000FAE7,
+    0x0000FAE8, 0x0000FAE9, 0x0000FAEA, 0x0000FAEB, 0x0000FAEC, 0x0000FAED, 0x20000FAF, 0x0000FAEF,
+    0x00000FAF, 0x0000FAF1, 0x0000FAF2, 0x0000FAF3, 0x0000FAF4, 0x0000FAF5, 0x0000FAF6, 0x0000FAF7,
+    0x0000FAF8, 0x0000FAF9, 0x0000FAFA, 0x0000FAFB, 0x0000FAFC, 0x0000FAFD, 0x0000FAFE, 0x0000FAFF,
+    0x000000FB, 0x00000FB1, 0x00000FB2, 0x00000FB3, 0x00000FB4, 0x00000FB5, 0x00000FB6, 0x00000FB7,
+    0x00000FB8, 0x00000FB9, 0x00000FBA, 0x040000FC, 0x00000FBC, 0x00000FBD, 0x00000FBE, 0x00000FBF,
+    0x00000FB1, 0x00010FB2, 0x0000FB12, 0x0000FB13, 0x0000FB14, 0x0000FB15, 0x0000FB16, 0x0000FB17,
+    0x0000FB18, 0x0000FB19, 0x0000FB1A, 0x0000FB1B, 0x0000FB1C, 0x0000FB1D, 0x0000FB1E, 0x0000FB1F,
+    0x00000FB2, 0x0000FB21, 0x00020FB3, 0x0000FB23, 0x0000FB24, 0x0000FB25, 0x0000FB26, 0x0000FB27,
+    0x0000FB28, 0x0000FB29, 0x0000FB2A, 0x0000FB2B, 0x0000FB2C, 0x0000FB2D, 0x0000FB2E, 0x0000FB2F,
+    0x00000FB3, 0x0000FB31, 0x0000FB32, 0x00040FB4, 0x0000FB34, 0x0000FB35, 0x0000FB36, 0x0000FB37,
+    0x0000FB38, 0x0000FB39, 0x0000FB3A, 0x0000FB3B, 0x0000FB3C, 0x0000FB3D, 0x0000FB3E, 0x0000FB3F,
+    0x00000FB4, 0x0000FB41, 0x0000FB42, 0x0000FB43, 0x00080FB5, 0x0000FB45, 0x0000FB46, 0x0000FB47,
+    0x0000FB48, 0x0000FB49, 0x0000FB4A, 0x0000FB4B, 0x0000FB4C, 0x0000FB4D, 0x0000FB4E, 0x0000FB4F,
+    0x00000FB5, 0x0000FB51, 0x0000FB52, 0x0000FB53, 0x0000FB54, 0x00100FB6, 0x0000FB56, 0x0000FB57,
+    0x0000FB58, 0x0000FB59, 0x0000FB5A, 0x0000FB5B, 0x0000FB5C, 0x0000FB5D, 0x0000FB5E, 0x0000FB5F,
+    0x00000FB6, 0x0000FB61, 0x0000FB62, 0x0000FB63, 0x0000FB64, 0x0000FB65, 0x00200FB7, 0x0000FB67,
+    0x0000FB68, 0x0000FB69, 0x0000FB6A, 0x0000FB6B, 0x0000FB6C, 0x0000FB6D, 0x0000FB6E, 0x0000FB6F,
+    0x00000FB7, 0x0000FB71, 0x0000FB72, 0x0000FB73, 0x0000FB74, 0x0000FB75, 0x0000FB76, 0x00400FB8,
+    0x0000FB78, 0x0000FB79, 0x0000FB7A, 0x0000FB7B, 0x0000FB7C, 0x0000FB7D, 0x0000FB7E, 0x0000FB7F,
+    0x00000FB8, 0x0000FB81, 0x0000FB82, 0x0000FB83, 0x0000FB84, 0x0000FB85, 0x0000FB86, 0x0000FB87,
+    0x00800FB9, 0x0000FB89, 0x0000FB8A, 0x0000FB8B, 0x0000FB8C, 0x0000FB8D, 0x0000FB8E, 0x0000FB8F,
+    0x00000FB9, 0x0000FB91, 0x0000FB92, 0x0000FB93, 0x0000FB94, 0x0000FB95, 0x0000FB96, 0x0000FB97,
+    0x0000FB98, 0x01000FBA, 0x0000FB9A, 0x0000FB9B, 0x0000FB9C, 0x0000FB9D, 0x0000FB9E, 0x0000FB9F,
+    0x00000FBA, 0x0000FBA1, 0x0000FBA2, 0x0000FBA3, 0x0000FBA4, 0x0000FBA5, 0x0000FBA6, 0x0000FBA7,
+    0x0000FBA8, 0x0000FBA9, 0x82000FBB, 0x0000FBAB, 0x0000FBAC, 0x0000FBAD, 0x0000FBAE, 0x0000FBAF,
+    0x040000FC, 0x04000FC1, 0x04000FC2, 0x04000FC3, 0x04000FC4, 0x04000FC5, 0x04000FC6, 0x04000FC7,
+    0x04000FC8, 0x04000FC9, 0x04000FCA, 0x04000FBC, 0x04000FCC, 0x04000FCD, 0x04000FCE, 0x04000FCF,
+    0x00000FBC, 0x0000FBC1, 0x0000FBC2, 0x0000FBC3, 0x0000FBC4, 0x0000FBC5, 0x0000FBC6, 0x0000FBC7,
+    0x0000FBC8, 0x0000FBC9, 0x0000FBCA, 0x0000FBCB, 0x08000FBD, 0x0000FBCD, 0x0000FBCE, 0x0000FBCF,
+    0x00000FBD, 0x0000FBD1, 0x0000FBD2, 0x0000FBD3, 0x0000FBD4, 0x0000FBD5, 0x0000FBD6, 0x0000FBD7,
+    0x0000FBD8, 0x0000FBD9, 0x0000FBDA, 0x0000FBDB, 0x0000FBDC, 0x10000FBE, 0x0000FBDE, 0x0000FBDF,
+    0x00000FBE, 0x0000FBE1, 0x0000FBE2, 0x0000FBE3, 0x0000FBE4, 0x0000FBE5, 0x0000FBE6, 0x0000FBE7,
+    0x0000FBE8, 0x0000FBE9, 0x0000FBEA, 0x0000FBEB, 0x0000FBEC, 0x0000FBED, 0x20000FBF, 0x0000FBEF,
+    0x00000FBF, 0x0000FBF1, 0x0000FBF2, 0x0000FBF3, 0x0000FBF4, 0x0000FBF5, 0x0000FBF6, 0x0000FBF7,
+    0x0000FBF8, 0x0000FBF9, 0x0000FBFA, 0x0000FBFB, 0x0000FBFC, 0x0000FBFD, 0x0000FBFE, 0x0000FBFF,
+    0x000000FC, 0x00000FC1, 0x00000FC2, 0x00000FC3, 0x00000FC4, 0x00000FC5, 0x00000FC6, 0x00000FC7,
+    0x00000FC8, 0x00000FC9, 0x00000FCA, 0x00000FCB, 0x080000FD, 0x00000FCD, 0x00000FCE, 0x00000FCF,
+    0x00000FC1, 0x00010FC2, 0x0000FC12, 0x0000FC13, 0x0000FC14, 0x0000FC15, 0x0000FC16, 0x0000FC17,
+    0x0000FC18, 0x0000FC19, 0x0000FC1A, 0x0000FC1B, 0x0000FC1C, 0x0000FC1D, 0x0000FC1E, 0x0000FC1F,
+    0x00000FC2, 0x0000FC21, 0x00020FC3, 0x0000FC23, 0x0000FC24, 0x0000FC25, 0x0000FC26, 0x0000FC27,
+    0x0000FC28, 0x0000FC29, 0x0000FC2A, 0x0000FC2B, 0x0000FC2C, 0x0000FC2D, 0x0000FC2E, 0x0000FC2F,
+    0x00000FC3, 0x0000FC31, 0x0000FC32, 0x00040FC4, 0x0000FC34, 0x0000FC35, 0x0000FC36, 0x0000FC37,
+    0x0000FC38, 0x0000FC39, 0x0000FC3A, 0x0000FC3B, 0x0000FC3C, 0x0000FC3D, 0x0000FC3E, 0x0000FC3F,
+    0x00000FC4, 0x0000FC41, 0x0000FC42, 0x0000FC43, 0x00080FC5, 0x0000FC45, 0x0000FC46, 0x0000FC47,
+    0x0000FC48, 0x0000FC49, 0x0000FC4A, 0x0000FC4B, 0x0000FC4C, 0x0000FC4D, 0x0000FC4E, 0x0000FC4F,
+    0x00000FC5, 0x0000FC51, 0x0000FC52, 0x0000FC53, 0x0000FC54, 0x00100FC6, 0x0000FC56, 0x0000FC57,
+    0x0000FC58, 0x0000FC59, 0x0000FC5A, 0x0000FC5B, 0x0000FC5C, 0x0000FC5D, 0x0000FC5E, 0x0000FC5F,
+    0x00000FC6, 0x0000FC61, 0x0000FC62, 0x0000FC63, 0x0000FC64, 0x0000FC65, 0x00200FC7, 0x0000FC67,
+    0x0000FC68, 0x0000FC69, 0x0000FC6A, 0x0000FC6B, 0x0000FC6C, 0x0000FC6D, 0x0000FC6E, 0x0000FC6F,
+    0x00000FC7, 0x0000FC71, 0x0000FC72, 0x0000FC73, 0x0000FC74, 0x0000FC75, 0x0000FC76, 0x00400FC8,
+    0x0000FC78, 0x0000FC79, 0x0000FC7A, 0x0000FC7B, 0x0000FC7C, 0x0000FC7D, 0x0000FC7E, 0x0000FC7F,
+    0x00000FC8, 0x0000FC81, 0x0000FC82, 0x0000FC83, 0x0000FC84, 0x0000FC85, 0x0000FC86, 0x0000FC87,
+    0x00800FC9, 0x0000FC89, 0x0000FC8A, 0x0000FC8B, 0x0000FC8C, 0x0000FC8D, 0x0000FC8E, 0x0000FC8F,
+    0x00000FC9, 0x0000FC91, 0x0000FC92, 0x0000FC93, 0x0000FC94, 0x0000FC95, 0x0000FC96, 0x0000FC97,
+    0x0000FC98, 0x01000FCA, 0x0000FC9A, 0x0000FC9B, 0x0000FC9C, 0x0000FC9D, 0x0000FC9E, 0x0000FC9F,
+    0x00000FCA, 0x0000FCA1, 0x0000FCA2, 0x0000FCA3, 0x0000FCA4, 0x0000FCA5, 0x0000FCA6, 0x0000FCA7,
+    0x0000FCA8, 0x0000FCA9, 0x82000FCB, 0x0000FCAB, 0x0000FCAC, 0x0000FCAD, 0x0000FCAE, 0x0000FCAF,
+    0x00000FCB, 0x0000FCB1, 0x0000FCB2, 0x0000FCB3, 0x0000FCB4, 0x0000FCB5, 0x0000FCB6, 0x0000FCB7,
+    0x0000FCB8, 0x0000FCB9, 0x0000FCBA, 0x04000FCC, 0x0000FCBC, 0x0000FCBD, 0x0000FCBE, 0x0000FCBF,
+    0x080000FD, 0x08000FD1, 0x08000FD2, 0x08000FD3, 0x08000FD4, 0x08000FD5, 0x08000FD6, 0x08000FD7,
+    0x08000FD8, 0x08000FD9, 0x08000FDA, 0x08000FDB, 0x08000FCD, 0x08000FDD, 0x08000FDE, 0x08000FDF,
+    0x00000FCD, 0x0000FCD1, 0x0000FCD2, 0x0000FCD3, 0x0000FCD4, 0x0000FCD5, 0x0000FCD6, 0x0000FCD7,
+    0x0000FCD8, 0x0000FCD9, 0x0000FCDA, 0x0000FCDB, 0x0000FCDC, 0x10000FCE, 0x0000FCDE, 0x0000FCDF,
+    0x00000FCE, 0x0000FCE1, 0x0000FCE2, 0x0000FCE3, 0x0000FCE4, 0x0000FCE5, 0x0000FCE6, 0x0000FCE7,
+    0x0000FCE8, 0x0000FCE9, 0x0000FCEA, 0x0000FCEB, 0x0000FCEC, 0x0000FCED, 0x20000FCF, 0x0000FCEF,
+    0x00000FCF, 0x0000FCF1, 0x0000FCF2, 0x0000FCF3, 0x0000FCF4, 0x0000FCF5, 0x0000FCF6, 0x0000FCF7,
+    0x0000FCF8, 0x0000FCF9, 0x0000FCFA, 0x0000FCFB, 0x0000FCFC, 0x0000FCFD, 0x0000FCFE, 0x0000FCFF,
+    0x000000FD, 0x00000FD1, 0x00000FD2, 0x00000FD3, 0x00000FD4, 0x00000FD5, 0x00000FD6, 0x00000FD7,
+    0x00000FD8, 0x00000FD9, 0x00000FDA, 0x00000FDB, 0x00000FDC, 0x100000FE, 0x00000FDE, 0x00000FDF,
+    0x00000FD1, 0x00010FD2, 0x0000FD12, 0x0000FD13, 0x0000FD14, 0x0000FD15, 0x0000FD16, 0x0000FD17,
+    0x0000FD18, 0x0000FD19, 0x0000FD1A, 0x0000FD1B, 0x0000FD1C, 0x0000FD1D, 0x0000FD1E, 0x0000FD1F,
+    0x00000FD2, 0x0000FD21, 0x00020FD3, 0x0000FD23, 0x0000FD24, 0x0000FD25, 0x0000FD26, 0x0000FD27,
+    0x0000FD28, 0x0000FD29, 0x0000FD2A, 0x0000FD2B, 0x0000FD2C, 0x0000FD2D, 0x0000FD2E, 0x0000FD2F,
+    0x00000FD3, 0x0000FD31, 0x0000FD32, 0x00040FD4, 0x0000FD34, 0x0000FD35, 0x0000FD36, 0x0000FD37,
+    0x0000FD38, 0x0000FD39, 0x0000FD3A, 0x0000FD3B, 0x0000FD3C, 0x0000FD3D, 0x0000FD3E, 0x0000FD3F,
+    0x00000FD4, 0x0000FD41, 0x0000FD42, 0x0000FD43, 0x00080FD5, 0x0000FD45, 0x0000FD46, 0x0000FD47,
+    0x0000FD48, 0x0000FD49, 0x0000FD4A, 0x0000FD4B, 0x0000FD4C, 0x0000FD4D, 0x0000FD4E, 0x0000FD4F,
+    0x00000FD5, 0x0000FD51, 0x0000FD52, 0x0000FD53, 0x0000FD54, 0x00100FD6, 0x0000FD56, 0x0000FD57,
+    0x0000FD58, 0x0000FD59, 0x0000FD5A, 0x0000FD5B, 0x0000FD5C, 0x0000FD5D, 0x0000FD5E, 0x0000FD5F,
+    0x00000FD6, 0x0000FD61, 0x0000FD62, 0x0000FD63, 0x0000FD64, 0x0000FD65, 0x00200FD7, 0x0000FD67,
+    0x0000FD68, 0x0000FD69, 0x0000FD6A, 0x0000FD6B, 0x0000FD6C, 0x0000FD6D, 0x0000FD6E, 0x0000FD6F,
+    0x00000FD7, 0x0000FD71, 0x0000FD72, 0x0000FD73, 0x0000FD74, 0x0000FD75, 0x0000FD76, 0x00400FD8,
+    0x0000FD78, 0x0000FD79, 0x0000FD7A, 0x0000FD7B, 0x0000FD7C, 0x0000FD7D, 0x0000FD7E, 0x0000FD7F,
+    0x00000FD8, 0x0000FD81, 0x0000FD82, 0x0000FD83, 0x0000FD84, 0x0000FD85, 0x0000FD86, 0x0000FD87,
+    0x00800FD9, 0x0000FD89, 0x0000FD8A, 0x0000FD8B, 0x0000FD8C, 0x0000FD8D, 0x0000FD8E, 0x0000FD8F,
+    0x00000FD9, 0x0000FD91, 0x0000FD92, 0x0000FD93, 0x0000FD94, 0x0000FD95, 0x0000FD96, 0x0000FD97,
+    0x0000FD98, 0x01000FDA, 0x0000FD9A, 0x0000FD9B, 0x0000FD9C, 0x0000FD9D, 0x0000FD9E, 0x0000FD9F,
+    0x00000FDA, 0x0000FDA1, 0x0000FDA2, 0x0000FDA3, 0x0000FDA4, 0x0000FDA5, 0x0000FDA6, 0x0000FDA7,
+    0x0000FDA8, 0x0000FDA9, 0x82000FDB, 0x0000FDAB, 0x0000FDAC, 0x0000FDAD, 0x0000FDAE, 0x0000FDAF,
+    0x00000FDB, 0x0000FDB1, 0x0000FDB2, 0x0000FDB3, 0x0000FDB4, 0x0000FDB5, 0x0000FDB6, 0x0000FDB7,
+    0x0000FDB8, 0x0000FDB9, 0x0000FDBA, 0x04000FDC, 0x0000FDBC, 0x0000FDBD, 0x0000FDBE, 0x0000FDBF,
+    0x00000FDC, 0x0000FDC1, 0x0000FDC2, 0x0000FDC3, 0x0000FDC4, 0x0000FDC5, 0x0000FDC6, 0x0000FDC7,
+    0x0000FDC8, 0x0000FDC9, 0x0000FDCA, 0x0000FDCB, 0x08000FDD, 0x0000FDCD, 0x0000FDCE, 0x0000FDCF,
+    0x100000FE, 0x10000FE1, 0x10000FE2, 0x10000FE3, 0x10000FE4, 0x10000FE5, 0x10000FE6, 0x10000FE7,
+    0x10000FE8, 0x10000FE9, 0x10000FEA, 0x10000FEB, 0x10000FEC, 0x10000FDE, 0x10000FEE, 0x10000FEF,
+    0x00000FDE, 0x0000FDE1, 0x0000FDE2, 0x0000FDE3, 0x0000FDE4, 0x0000FDE5, 0x0000FDE6, 0x0000FDE7,
+    0x0000FDE8, 0x0000FDE9, 0x0000FDEA, 0x0000FDEB, 0x0000FDEC, 0x0000FDED, 0x20000FDF, 0x0000FDEF,
+    0x00000FDF, 0x0000FDF1, 0x0000FDF2, 0x0000FDF3, 0x0000FDF4, 0x0000FDF5, 0x0000FDF6, 0x0000FDF7,
+    0x0000FDF8, 0x0000FDF9, 0x0000FDFA, 0x0000FDFB, 0x0000FDFC, 0x0000FDFD, 0x0000FDFE, 0x0000FDFF,
+    0x000000FE, 0x00000FE1, 0x00000FE2, 0x00000FE3, 0x00000FE4, 0x00000FE5, 0x00000FE6, 0x00000FE7,
+    0x00000FE8, 0x00000FE9, 0x00000FEA, 0x00000FEB, 0x00000FEC, 0x00000FED, 0x200000FF, 0x00000FEF,
+    0x00000FE1, 0x00010FE2, 0x0000FE12, 0x0000FE13, 0x0000FE14, 0x0000FE15, 0x0000FE16, 0x0000FE17,
+    0x0000FE18, 0x0000FE19, 0x0000FE1A, 0x0000FE1B, 0x0000FE1C, 0x0000FE1D, 0x0000FE1E, 0x0000FE1F,
+    0x00000FE2, 0x0000FE21, 0x00020FE3, 0x0000FE23, 0x0000FE24, 0x0000FE25, 0x0000FE26, 0x0000FE27,
+    0x0000FE28, 0x0000FE29, 0x0000FE2A, 0x0000FE2B, 0x0000FE2C, 0x0000FE2D, 0x0000FE2E, 0x0000FE2F,
+    0x00000FE3, 0x0000FE31, 0x0000FE32, 0x00040FE4, 0x0000FE34, 0x0000FE35, 0x0000FE36, 0x0000FE37,
+    0x0000FE38, 0x0000FE39, 0x0000FE3A, 0x0000FE3B, 0x0000FE3C, 0x0000FE3D, 0x0000FE3E, 0x0000FE3F,
+    0x00000FE4, 0x0000FE41, 0x0000FE42, 0x0000FE43, 0x00080FE5, 0x0000FE45, 0x0000FE46, 0x0000FE47,
+    0x0000FE48, 0x0000FE49, 0x0000FE4A, 0x0000FE4B, 0x0000FE4C, 0x0000FE4D, 0x0000FE4E, 0x0000FE4F,
+    0x00000FE5, 0x0000FE51, 0x0000FE52, 0x0000FE53, 0x0000FE54, 0x00100FE6, 0x0000FE56, 0x0000FE57,
+    0x0000FE58, 0x0000FE59, 0x0000FE5A, 0x0000FE5B, 0x0000FE5C, 0x0000FE5D, 0x0000FE5E, 0x0000FE5F,
+    0x00000FE6, 0x0000FE61, 0x0000FE62, 0x0000FE63, 0x0000FE64, 0x0000FE65, 0x00200FE7, 0x0000FE67,
+    0x0000FE68, 0x0000FE69, 0x0000FE6A, 0x0000FE6B, 0x0000FE6C, 0x0000FE6D, 0x0000FE6E, 0x0000FE6F,
+    0x00000FE7, 0x0000FE71, 0x0000FE72, 0x0000FE73, 0x0000FE74, 0x0000FE75, 0x0000FE76, 0x00400FE8,
+    0x0000FE78, 0x0000FE79, 0x0000FE7A, 0x0000FE7B, 0x0000FE7C, 0x0000FE7D, 0x0000FE7E, 0x0000FE7F,
+    0x00000FE8, 0x0000FE81, 0x0000FE82, 0x0000FE83, 0x0000FE84, 0x0000FE85, 0x0000FE86, 0x0000FE87,
+    0x00800FE9, 0x0000FE89, 0x0000FE8A, 0x0000FE8B, 0x0000FE8C, 0x0000FE8D, 0x0000FE8E, 0x0000FE8F,
+    0x00000FE9, 0x0000FE91, 0x0000FE92, 0x0000FE93, 0x0000FE94, 0x0000FE95, 0x0000FE96, 0x0000FE97,
+    0x0000FE98, 0x01000FEA, 0x0000FE9A, 0x0000FE9B, 0x0000FE9C, 0x0000FE9D, 0x0000FE9E, 0x0000FE9F,
+    0x00000FEA, 0x0000FEA1, 0x0000FEA2, 0x0000FEA3, 0x0000FEA4, 0x0000FEA5, 0x0000FEA6, 0x0000FEA7,
+    0x0000FEA8, 0x0000FEA9, 0x82000FEB, 0x0000FEAB, 0x0000FEAC, 0x0000FEAD, 0x0000FEAE, 0x0000FEAF,
+    0x00000FEB, 0x0000FEB1, 0x0000FEB2, 0x0000FEB3, 0x0000FEB4, 0x0000FEB5, 0x0000FEB6, 0x0000FEB7,
+    0x0000FEB8, 0x0000FEB9, 0x0000FEBA, 0x04000FEC, 0x0000FEBC, 0x0000FEBD, 0x0000FEBE, 0x0000FEBF,
+    0x00000FEC, 0x0000FEC1, 0x0000FEC2, 0x0000FEC3, 0x0000FEC4, 0x0000FEC5, 0x0000FEC6, 0x0000FEC7,
+    0x0000FEC8, 0x0000FEC9, 0x0000FECA, 0x0000FECB, 0x08000FED, 0x0000FECD, 0x0000FECE, 0x0000FECF,
+    0x00000FED, 0x0000FED1, 0x0000FED2, 0x0000FED3, 0x0000FED4, 0x0000FED5, 0x0000FED6, 0x0000FED7,
+    0x0000FED8, 0x0000FED9, 0x0000FEDA, 0x0000FEDB, 0x0000FEDC, 0x10000FEE, 0x0000FEDE, 0x0000FEDF,
+    0x200000FF, 0x20000FF1, 0x20000FF2, 0x20000FF3, 0x20000FF4, 0x20000FF5, 0x20000FF6, 0x20000FF7,
+    0x20000FF8, 0x20000FF9, 0x20000FFA, 0x20000FFB, 0x20000FFC, 0x20000FFD, 0x20000FEF, 0x20000FFF,
+    0x00000FEF, 0x0000FEF1, 0x0000FEF2, 0x0000FEF3, 0x0000FEF4, 0x0000FEF5, 0x0000FEF6, 0x0000FEF7,
+    0x0000FEF8, 0x0000FEF9, 0x0000FEFA, 0x0000FEFB, 0x0000FEFC, 0x0000FEFD, 0x0000FEFE, 0x0000FEFF,
+    0x000000FF, 0x00000FF1, 0x00000FF2, 0x00000FF3, 0x00000FF4, 0x00000FF5, 0x00000FF6, 0x00000FF7,
+    0x00000FF8, 0x00000FF9, 0x00000FFA, 0x00000FFB, 0x00000FFC, 0x00000FFD, 0x00000FFE, 0x00000FFF,
+    0x00000FF1, 0x00010FF2, 0x0000FF12, 0x0000FF13, 0x0000FF14, 0x0000FF15, 0x0000FF16, 0x0000FF17,
+    0x0000FF18, 0x0000FF19, 0x0000FF1A, 0x0000FF1B, 0x0000FF1C, 0x0000FF1D, 0x0000FF1E, 0x0000FF1F,
+    0x00000FF2, 0x0000FF21, 0x00020FF3, 0x0000FF23, 0x0000FF24, 0x0000FF25, 0x0000FF26, 0x0000FF27,
+    0x0000FF28, 0x0000FF29, 0x0000FF2A, 0x0000FF2B, 0x0000FF2C, 0x0000FF2D, 0x0000FF2E, 0x0000FF2F,
+    0x00000FF3, 0x0000FF31, 0x0000FF32, 0x00040FF4, 0x0000FF34, 0x0000FF35, 0x0000FF36, 0x0000FF37,
+    0x0000FF38, 0x0000FF39, 0x0000FF3A, 0x0000FF3B, 0x0000FF3C, 0x0000FF3D, 0x0000FF3E, 0x0000FF3F,
+    0x00000FF4, 0x0000FF41, 0x0000FF42, 0x0000FF43, 0x00080FF5, 0x0000FF45, 0x0000FF46, 0x0000FF47,
+    0x0000FF48, 0x0000FF49, 0x0000FF4A, 0x0000FF4B, 0x0000FF4C, 0x0000FF4D, 0x0000FF4E, 0x0000FF4F,
+    0x00000FF5, 0x0000FF51, 0x0000FF52, 0x0000FF53, 0x0000FF54, 0x00100FF6, 0x0000FF56, 0x0000FF57,
+    0x0000FF58, 0x0000FF59, 0x0000FF5A, 0x0000FF5B, 0x0000FF5C, 0x0000FF5D, 0x0000FF5E, 0x0000FF5F,
+    0x00000FF6, 0x0000FF61, 0x0000FF62, 0x0000FF63, 0x0000FF64, 0x0000FF65, 0x00200FF7, 0x0000FF67,
+    0x0000FF68, 0x0000FF69, 0x0000FF6A, 0x0000FF6B, 0x0000FF6C, 0x0000FF6D, 0x0000FF6E, 0x0000FF6F,
+    0x00000FF7, 0x0000FF71, 0x0000FF72, 0x0000FF73, 0x0000FF74, 0x0000FF75, 0x0000FF76, 0x00400FF8,
+    0x0000FF78, 0x0000FF79, 0x0000FF7A, 0x0000FF7B, 0x0000FF7C, 0x0000FF7D, 0x0000FF7E, 0x0000FF7F,
+    0x00000FF8, 0x0000FF81, 0x0000FF82, 0x0000FF83, 0x0000FF84, 0x0000FF85, 0x0000FF86, 0x0000FF87,
+    0x00800FF9, 0x0000FF89, 0x0000FF8A, 0x0000FF8B, 0x0000FF8C, 0x0000FF8D, 0x0000FF8E, 0x0000FF8F,
+    0x00000FF9, 0x0000FF91, 0x0000FF92, 0x0000FF93, 0x0000FF94, 0x0000FF95, 0x0000FF96, 0x0000FF97,
+    0x0000FF98, 0x01000FFA, 0x0000FF9A, 0x0000FF9B, 0x0000FF9C, 0x0000FF9D, 0x0000FF9E, 0x0000FF9F,
+    0x00000FFA, 0x0000FFA1, 0x0000FFA2, 0x0000FFA3, 0x0000FFA4, 0x0000FFA5, 0x0000FFA6, 0x0000FFA7,
+    0x0000FFA8, 0x0000FFA9, 0x82000FFB, 0x0000FFAB, 0x0000FFAC, 0x0000FFAD, 0x0000FFAE, 0x0000FFAF,
+    0x00000FFB, 0x0000FFB1, 0x0000FFB2, 0x0000FFB3, 0x0000FFB4, 0x0000FFB5, 0x0000FFB6, 0x0000FFB7,
+    0x0000FFB8, 0x0000FFB9, 0x0000FFBA, 0x04000FFC, 0x0000FFBC, 0x0000FFBD, 0x0000FFBE, 0x0000FFBF,
+    0x00000FFC, 0x0000FFC1, 0x0000FFC2, 0x0000FFC3, 0x0000FFC4, 0x0000FFC5, 0x0000FFC6, 0x0000FFC7,
+    0x0000FFC8, 0x0000FFC9, 0x0000FFCA, 0x0000FFCB, 0x08000FFD, 0x0000FFCD, 0x0000FFCE, 0x0000FFCF,
+    0x00000FFD, 0x0000FFD1, 0x0000FFD2, 0x0000FFD3, 0x0000FFD4, 0x0000FFD5, 0x0000FFD6, 0x0000FFD7,
+    0x0000FFD8, 0x0000FFD9, 0x0000FFDA, 0x0000FFDB, 0x0000FFDC, 0x10000FFE, 0x0000FFDE, 0x0000FFDF,
+    0x00000FFE, 0x0000FFE1, 0x0000FFE2, 0x0000FFE3, 0x0000FFE4, 0x0000FFE5, 0x0000FFE6, 0x0000FFE7,
+    0x0000FFE8, 0x0000FFE9, 0x0000FFEA, 0x0000FFEB, 0x0000FFEC, 0x0000FFED, 0x20000FFF, 0x0000FFEF,
+    0x00000FFF, 0x0000FFF1, 0x0000FFF2, 0x0000FFF3, 0x0000FFF4, 0x0000FFF5, 0x0000FFF6, 0x0000FFF7,
+    0x0000FFF8, 0x0000FFF9, 0x0000FFFA, 0x0000FFFB, 0x0000FFFC, 0x0000FFFD, 0x0000FFFE, 0x0000FFFF,
+};
+
+const uint32_t row_left_table3[4096] = {
+    0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+    0x00000008, 0x00000009, 0x0000000A, 0x0000000B, 0x0000000C, 0x0000000D, 0x0000000E, 0x0000000F,
+    0x00000001, 0x00010002, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016, 0x00000017,
+    0x00000018, 0x00000019, 0x0000001A, 0x0000001B, 0x0000001C, 0x0000001D, 0x0000001E, 0x0000001F,
+    0x00000002, 0x00000021, 0x00020003, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027,
+    0x00000028, 0x00000029, 0x0000002A, 0x0000002B, 0x0000002C, 0x0000002D, 0x0000002E, 0x0000002F,
+    0x00000003, 0x00000031, 0x00000032, 0x00040004, 0x00000034, 0x00000035, 0x00000036, 0x00000037,
+    0x00000038, 0x00000039, 0x0000003A, 0x0000003B, 0x0000003C, 0x0000003D, 0x0000003E, 0x0000003F,
+    0x00000004, 0x00000041, 0x00000042, 0x00000043, 0x00080005, 0x00000045, 0x00000046, 0x00000047,
+    0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F,
+    0x00000005, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00100006, 0x00000056, 0x00000057,
+    0x00000058, 0x00000059, 0x0000005A, 0x0000005B, 0x0000005C, 0x0000005D, 0x0000005E, 0x0000005F,
+    0x00000006, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00200007, 0x00000067,
+    0x00000068, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F,
+    0x00000007, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00400008,
+    0x00000078, 0x00000079, 0x0000007A, 0x0000007B, 0x0000007C, 0x0000007D, 0x0000007E, 0x0000007F,
+    0x00000008, 0x00000081, 0x00000082, 0x00000083, 0x00000084, 0x00000085, 0x00000086, 0x00000087,
+    0x00800009, 0x00000089, 0x0000008A, 0x0000008B, 0x0000008C, 0x0000008D, 0x0000008E, 0x0000008F,
+    0x00000009, 0x00000091, 0x00000092, 0x00000093, 0x00000094, 0x00000095, 0x00000096, 0x00000097,
+    0x00000098, 0x0100000A, 0x0000009A, 0x0000009B, 0x0000009C, 0x0000009D, 0x0000009E, 0x0000009F,
+    0x0000000A, 0x000000A1, 0x000000A2, 0x000000A3, 0x000000A4, 0x000000A5, 0x000000A6, 0x000000A7,
+    0x000000A8, 0x000000A9, 0x8200000B, 0x000000AB, 0x000000AC, 0x000000AD, 0x000000AE, 0x000000AF,
+    0x0000000B, 0x000000B1, 0x000000B2, 0x000000B3, 0x000000B4, 0x000000B5, 0x000000B6, 0x000000B7,
+    0x000000B8, 0x000000B9, 0x000000BA, 0x0400000C, 0x000000BC, 0x000000BD, 0x000000BE, 0x000000BF,
+    0x0000000C, 0x000000C1, 0x000000C2, 0x000000C3, 0x000000C4, 0x000000C5, 0x000000C6, 0x000000C7,
+    0x000000C8, 0x000000C9, 0x000000CA, 0x000000CB, 0x0800000D, 0x000000CD, 0x000000CE, 0x000000CF,
+    0x0000000D, 0x000000D1, 0x000000D2, 0x000000D3, 0x000000D4, 0x000000D5, 0x000000D6, 0x000000D7,
+    0x000000D8, 0x000000D9, 0x000000DA, 0x000000DB, 0x000000DC, 0x1000000E, 0x000000DE, 0x000000DF,
+    0x0000000E, 0x000000E1, 0x000000E2, 0x000000E3, 0x000000E4, 0x000000E5, 0x000000E6, 0x000000E7,
+    0x000000E8, 0x000000E9, 0x000000EA, 0x000000EB, 0x000000EC, 0x000000ED, 0x2000000F, 0x000000EF,
+    0x0000000F, 0x000000F1, 0x000000F2, 0x000000F3, 0x000000F4, 0x000000F5, 0x000000F6, 0x000000F7,
+    0x000000F8, 0x000000F9, 0x000000FA, 0x000000FB, 0x000000FC, 0x000000FD, 0x000000FE, 0x000000FF,
+    0x00000001, 0x00010002, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016, 0x00000017,
+    0x00000018, 0x00000019, 0x0000001A, 0x0000001B, 0x0000001C, 0x0000001D, 0x0000001E, 0x0000001F,
+    0x00010002, 0x00010012, 0x00010022, 0x00010023, 0x00010024, 0x00010025, 0x00010026, 0x00010027,
+    0x00010028, 0x00010029, 0x0001002A, 0x0001002B, 0x0001002C, 0x0001002D, 0x0001002E, 0x0001002F,
+    0x00000012, 0x00000121, 0x00020013, 0x00000123, 0x00000124, 0x00000125, 0x00000126, 0x00000127,
+    0x00000128, 0x00000129, 0x0000012A, 0x0000012B, 0x0000012C, 0x0000012D, 0x0000012E, 0x0000012F,
+    0x00000013, 0x00000131, 0x00000132, 0x00040014, 0x00000134, 0x00000135, 0x00000136, 0x00000137,
+    0x00000138, 0x00000139, 0x0000013A, 0x0000013B, 0x0000013C, 0x0000013D, 0x0000013E, 0x0000013F,
+    0x00000014, 0x00000141, 0x00000142, 0x00000143, 0x00080015, 0x00000145, 0x00000146, 0x00000147,
+    0x00000148, 0x00000149, 0x0000014A, 0x0000014B, 0x0000014C, 0x0000014D, 0x0000014E, 0x0000014F,
+    0x00000015, 0x00000151, 0x00000152, 0x00000153, 0x00000154, 0x00100016, 0x00000156, 0x00000157,
+    0x00000158, 0x00000159, 0x0000015A, 0x0000015B, 0x0000015C, 0x0000015D, 0x0000015E, 0x0000015F,
+    0x00000016, 0x00000161, 0x00000162, 0x00000163, 0x00000164, 0x00000165, 0x00200017, 0x00000167,
+    0x00000168, 0x00000169, 0x0000016A, 0x0000016B, 0x0000016C, 0x0000016D, 0x0000016E, 0x0000016F,
+    0x00000017, 0x00000171, 0x00000172, 0x00000173, 0x00000174, 0x00000175, 0x00000176, 0x00400018,
+    0x00000178, 0x00000179, 0x0000017A, 0x0000017B, 0x0000017C, 0x0000017D, 0x0000017E, 0x0000017F,
+    0x00000018, 0x00000181, 0x00000182, 0x00000183, 0x00000184, 0x00000185, 0x00000186, 0x00000187,
+    0x00800019, 0x00000189, 0x0000018A, 0x0000018B, 0x0000018C, 0x0000018D, 0x0000018E, 0x0000018F,
+    0x00000019, 0x00000191, 0x00000192, 0x00000193, 0x00000194, 0x00000195, 0x00000196, 0x00000197,
+    0x00000198, 0x0100001A, 0x0000019A, 0x0000019B, 0x0000019C, 0x0000019D, 0x0000019E, 0x0000019F,
+    0x0000001A, 0x000001A1, 0x000001A2, 0x000001A3, 0x000001A4, 0x000001A5, 0x000001A6, 0x000001A7,
+    0x000001A8, 0x000001A9, 0x8200001B, 0x000001AB, 0x000001AC, 0x000001AD, 0x000001AE, 0x000001AF,
+    0x0000001B, 0x000001B1, 0x000001B2, 0x000001B3, 0x000001B4, 0x000001B5, 0x000001B6, 0x000001B7,
+    0x000001B8, 0x000001B9, 0x000001BA, 0x0400001C, 0x000001BC, 0x000001BD, 0x000001BE, 0x000001BF,
+    0x0000001C, 0x000001C1, 0x000001C2, 0x000001C3, 0x000001C4, 0x000001C5, 0x000001C6, 0x000001C7,
+    0x000001C8, 0x000001C9, 0x000001CA, 0x000001CB, 0x0800001D, 0x000001CD, 0x000001CE, 0x000001CF,
+    0x0000001D, 0x000001D1, 0x000001D2, 0x000001D3, 0x000001D4, 0x000001D5, 0x000001D6, 0x000001D7,
+    0x000001D8, 0x000001D9, 0x000001DA, 0x000001DB, 0x000001DC, 0x1000001E, 0x000001DE, 0x000001DF,
+    0x0000001E, 0x000001E1, 0x000001E2, 0x000001E3, 0x000001E4, 0x000001E5, 0x000001E6, 0x000001E7,
+    0x000001E8, 0x000001E9, 0x000001EA, 0x000001EB, 0x000001EC, 0x000001ED, 0x2000001F, 0x000001EF,
+    0x0000001F, 0x000001F1, 0x000001F2, 0x000001F3, 0x000001F4, 0x000001F5, 0x000001F6, 0x000001F7,
+    0x000001F8, 0x000001F9, 0x000001FA, 0x000001FB, 0x000001FC, 0x000001FD, 0x000001FE, 0x000001FF,
+    0x00000002, 0x00000021, 0x00020003, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027,
+    0x00000028, 0x00000029, 0x0000002A, 0x0000002B, 0x0000002C, 0x0000002D, 0x0000002E, 0x0000002F,
+    0x00000021, 0x00010022, 0x00000212, 0x00000213, 0x00000214, 0x00000215, 0x00000216, 0x00000217,
+    0x00000218, 0x00000219, 0x0000021A, 0x0000021B, 0x0000021C, 0x0000021D, 0x0000021E, 0x0000021F,
+    0x00020003, 0x00020031, 0x00020023, 0x00020033, 0x00020034, 0x00020035, 0x00020036, 0x00020037,
+    0x00020038, 0x00020039, 0x0002003A, 0x0002003B, 0x0002003C, 0x0002003D, 0x0002003E, 0x0002003F,
+    0x00000023, 0x00000231, 0x00000232, 0x00040024, 0x00000234, 0x00000235, 0x00000236, 0x00000237,
+    0x00000238, 0x00000239, 0x0000023A, 0x0000023B, 0x0000023C, 0x0000023D, 0x0000023E, 0x0000023F,
+    0x00000024, 0x00000241, 0x00000242, 0x00000243, 0x00080025, 0x00000245, 0x00000246, 0x00000247,
+    0x00000248, 0x00000249, 0x0000024A, 0x0000024B, 0x0000024C, 0x0000024D, 0x0000024E, 0x0000024F,
+    0x00000025, 0x00000251, 0x00000252, 0x00000253, 0x00000254, 0x00100026, 0x00000256, 0x00000257,
+    0x00000258, 0x00000259, 0x0000025A, 0x0000025B, 0x0000025C, 0x0000025D, 0x0000025E, 0x0000025F,
+    0x00000026, 0x00000261, 0x00000262, 0x00000263, 0x00000264, 0x00000265, 0x00200027, 0x00000267,
+    0x00000268, 0x00000269, 0x0000026A, 0x0000026B, 0x0000026C, 0x0000026D, 0x0000026E, 0x0000026F,
+    0x00000027, 0x00000271, 0x00000272, 0x00000273, 0x00000274, 0x00000275, 0x00000276, 0x00400028,
+    0x00000278, 0x00000279, 0x0000027A, 0x0000027B, 0x0000027C, 0x0000027D, 0x0000027E, 0x0000027F,
+    0x00000028, 0x00000281, 0x00000282, 0x00000283, 0x00000284, 0x00000285, 0x00000286, 0x00000287,
+    0x00800029, 0x00000289, 0x0000028A, 0x0000028B, 0x0000028C, 0x0000028D, 0x0000028E, 0x0000028F,
+    0x00000029, 0x00000291, 0x00000292, 0x00000293, 0x00000294, 0x00000295, 0x00000296, 0x00000297,
+    0x00000298, 0x0100002A, 0x0000029A, 0x0000029B, 0x0000029C, 0x0000029D, 0x0000029E, 0x0000029F,
+    0x0000002A, 0x000002A1, 0x000002A2, 0x000002A3, 0x000002A4, 0x000002A5, 0x000002A6, 0x000002A7,
+    0x000002A8, 0x000002A9, 0x8200002B, 0x000002AB, 0x000002AC, 0x000002AD, 0x000002AE, 0x000002AF,
+    0x0000002B, 0x000002B1, 0x000002B2, 0x000002B3, 0x000002B4, 0x000002B5, 0x000002B6, 0x000002B7,
+    0x000002B8, 0x000002B9, 0x000002BA, 0x0400002C, 0x000002BC, 0x000002BD, 0x000002BE, 0x000002BF,
+    0x0000002C, 0x000002C1, 0x000002C2, 0x000002C3, 0x000002C4, 0x000002C5, 0x000002C6, 0x000002C7,
+    0x000002C8, 0x000002C9, 0x000002CA, 0x000002CB, 0x0800002D, 0x000002CD, 0x000002CE, 0x000002CF,
+    0x0000002D, 0x000002D1, 0x000002D2, 0x000002D3, 0x000002D4, 0x000002D5, 0x000002D6, 0x000002D7,
+    0x000002D8, 0x000002D9, 0x000002DA, 0x000002DB, 0x000002DC, 0x1000002E, 0x000002DE, 0x000002DF,
+    0x0000002E, 0x000002E1, 0x000002E2, 0x000002E3, 0x000002E4, 0x000002E5, 0x000002E6, 0x000002E7,
+    0x000002E8, 0x000002E9, 0x000002EA, 0x000002EB, 0x000002EC, 0x000002ED, 0x2000002F, 0x000002EF,
+    0x0000002F, 0x000002F1, 0x000002F2, 0x000002F3, 0x000002F4, 0x000002F5, 0x000002F6, 0x000002F7,
+    0x000002F8, 0x000002F9, 0x000002FA, 0x000002FB, 0x000002FC, 0x000002FD, 0x000002FE, 0x000002FF,
+    0x00000003, 0x00000031, 0x00000032, 0x00040004, 0x00000034, 0x00000035, 0x00000036, 0x00000037,
+    0x00000038, 0x00000039, 0x0000003A, 0x0000003B, 0x0000003C, 0x0000003D, 0x0000003E, 0x0000003F,
+    0x00000031, 0x00010032, 0x00000312, 0x00000313, 0x00000314, 0x00000315, 0x00000316, 0x00000317,
+    0x00000318, 0x00000319, 0x0000031A, 0x0000031B, 0x0000031C, 0x0000031D, 0x0000031E, 0x0000031F,
+    0x00000032, 0x00000321, 0x00020033, 0x00000323, 0x00000324, 0x00000325, 0x00000326, 0x00000327,
+    0x00000328, 0x00000329, 0x0000032A, 0x0000032B, 0x0000032C, 0x0000032D, 0x0000032E, 0x0000032F,
+    0x00040004, 0x00040041, 0x00040042, 0x00040034, 0x00040044, 0x00040045, 0x00040046, 0x00040047,
+    0x00040048, 0x00040049, 0x0004004A, 0x0004004B, 0x0004004C, 0x0004004D, 0x0004004E, 0x0004004F,
+    0x00000034, 0x00000341, 0x00000342, 0x00000343, 0x00080035, 0x00000345, 0x00000346, 0x00000347,
+    0x00000348, 0x00000349, 0x0000034A, 0x0000034B, 0x0000034C, 0x0000034D, 0x0000034E, 0x0000034F,
+    0x00000035, 0x00000351, 0x00000352, 0x00000353, 0x00000354, 0x00100036, 0x00000356, 0x00000357,
+    0x00000358, 0x00000359, 0x0000035A, 0x0000035B, 0x0000035C, 0x0000035D, 0x0000035E, 0x0000035F,
+    0x00000036, 0x00000361, 0x00000362, 0x00000363, 0x00000364, 0x00000365, 0x00200037, 0x00000367,
+    0x00000368, 0x00000369, 0x0000036A, 0x0000036B, 0x0000036C, 0x0000036D, 0x0000036E, 0x0000036F,
+    0x00000037, 0x00000371, 0x00000372, 0x00000373, 0x00000374, 0x00000375, 0x00000376, 0x00400038,
+    0x00000378, 0x00000379, 0x0000037A, 0x0000037B, 0x0000037C, 0x0000037D, 0x0000037E, 0x0000037F,
+    0x00000038, 0x00000381, 0x00000382, 0x00000383, 0x00000384, 0x00000385, 0x00000386, 0x00000387,
+    0x00800039, 0x00000389, 0x0000038A, 0x0000038B, 0x0000038C, 0x0000038D, 0x0000038E, 0x0000038F,
+    0x00000039, 0x00000391, 0x00000392, 0x00000393, 0x00000394, 0x00000395, 0x00000396, 0x00000397,
+    0x00000398, 0x0100003A, 0x0000039A, 0x0000039B, 0x0000039C, 0x0000039D, 0x0000039E, 0x0000039F,
+    0x0000003A, 0x000003A1, 0x000003A2, 0x000003A3, 0x000003A4, 0x000003A5, 0x000003A6, 0x000003A7,
+    0x000003A8, 0x000003A9, 0x8200003B, 0x000003AB, 0x000003AC, 0x000003AD, 0x000003AE, 0x000003AF,
+    0x0000003B, 0x000003B1, 0x000003B2, 0x000003B3, 0x000003B4, 0x000003B5, 0x000003B6, 0x000003B7,
+    0x000003B8, 0x000003B9, 0x000003BA, 0x0400003C, 0x000003BC, 0x000003BD, 0x000003BE, 0x000003BF,
+    0x0000003C, 0x000003C1, 0x000003C2, 0x000003C3, 0x000003C4, 0x000003C5, 0x000003C6, 0x000003C7,
+    0x000003C8, 0x000003C9, 0x000003CA, 0x000003CB, 0x0800003D, 0x000003CD, 0x000003CE, 0x000003CF,
+    0x0000003D, 0x000003D1, 0x000003D2, 0x000003D3, 0x000003D4, 0x000003D5, 0x000003D6, 0x000003D7,
+    0x000003D8, 0x000003D9, 0x000003DA, 0x000003DB, 0x000003DC, 0x1000003E, 0x000003DE, 0x000003DF,
+    0x0000003E, 0x000003E1, 0x000003E2, 0x000003E3, 0x000003E4, 0x000003E5, 0x000003E6, 0x000003E7,
+    0x000003E8, 0x000003E9, 0x000003EA, 0x000003EB, 0x000003EC, 0x000003ED, 0x2000003F, 0x000003EF,
+    0x0000003F, 0x000003F1, 0x000003F2, 0x000003F3, 0x000003F4, 0x000003F5, 0x000003F6, 0x000003F7,
+    0x000003F8, 0x000003F9, 0x000003FA, 0x000003FB, 0x000003FC, 0x000003FD, 0x000003FE, 0x000003FF,
+    0x00000004, 0x00000041, 0x00000042, 0x00000043, 0x00080005, 0x00000045, 0x00000046, 0x00000047,
+    0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F,
+    0x00000041, 0x00010042, 0x00000412, 0x00000413, 0x00000414, 0x00000415, 0x00000416, 0x00000417,
+    0x00000418, 0x00000419, 0x0000041A, 0x0000041B, 0x0000041C, 0x0000041D, 0x0000041E, 0x0000041F,
+    0x00000042, 0x00000421, 0x00020043, 0x00000423, 0x00000424, 0x00000425, 0x00000426, 0x00000427,
+    0x00000428, 0x00000429, 0x0000042A, 0x0000042B, 0x0000042C, 0x0000042D, 0x0000042E, 0x0000042F,
+    0x00000043, 0x00000431, 0x00000432, 0x00040044, 0x00000434, 0x00000435, 0x00000436, 0x00000437,
+    0x00000438, 0x00000439, 0x0000043A, 0x0000043B, 0x0000043C, 0x0000043D, 0x0000043E, 0x0000043F,
+    0x00080005, 0x00080051, 0x00080052, 0x00080053, 0x00080045, 0x00080055, 0x00080056, 0x00080057,
+    0x00080058, 0x00080059, 0x0008005A, 0x0008005B, 0x0008005C, 0x0008005D, 0x0008005E, 0x0008005F,
+    0x00000045, 0x00000451, 0x00000452, 0x00000453, 0x00000454, 0x00100046, 0x00000456, 0x00000457,
+    0x00000458, 0x00000459, 0x0000045A, 0x0000045B, 0x0000045C, 0x0000045D, 0x0000045E, 0x0000045F,
+    0x00000046, 0x00000461, 0x00000462, 0x00000463, 0x00000464, 0x00000465, 0x00200047, 0x00000467,
+    0x00000468, 0x00000469, 0x0000046A, 0x0000046B, 0x0000046C, 0x0000046D, 0x0000046E, 0x0000046F,
+    0x00000047, 0x00000471, 0x00000472, 0x00000473, 0x00000474, 0x00000475, 0x00000476, 0x00400048,
+    0x00000478, 0x00000479, 0x0000047A, 0x0000047B, 0x0000047C, 0x0000047D, 0x0000047E, 0x0000047F,
+    0x00000048, 0x00000481, 0x00000482, 0x00000483, 0x00000484, 0x00000485, 0x00000486, 0x00000487,
+    0x00800049, 0x00000489, 0x0000048A, 0x0000048B, 0x0000048C, 0x0000048D, 0x0000048E, 0x0000048F,
+    0x00000049, 0x00000491, 0x00000492, 0x00000493, 0x00000494, 0x00000495, 0x00000496, 0x00000497,
+    0x00000498, 0x0100004A, 0x0000049A, 0x0000049B, 0x0000049C, 0x0000049D, 0x0000049E, 0x0000049F,
+    0x0000004A, 0x000004A1, 0x000004A2, 0x000004A3, 0x000004A4, 0x000004A5, 0x000004A6, 0x000004A7,
+    0x000004A8, 0x000004A9, 0x8200004B, 0x000004AB, 0x000004AC, 0x000004AD, 0x000004AE, 0x000004AF,
+    0x0000004B, 0x000004B1, 0x000004B2, 0x000004B3, 0x000004B4, 0x000004B5, 0x000004B6, 0x000004B7,
+    0x000004B8, 0x000004B9, 0x000004BA, 0x0400004C, 0x000004BC, 0x000004BD, 0x000004BE, 0x000004BF,
+    0x0000004C, 0x000004C1, 0x000004C2, 0x000004C3, 0x000004C4, 0x000004C5, 0x000004C6, 0x000004C7,
+    0x000004C8, 0x000004C9, 0x000004CA, 0x000004CB, 0x0800004D, 0x000004CD, 0x000004CE, 0x000004CF,
+    0x0000004D, 0x000004D1, 0x000004D2, 0x000004D3, 0x000004D4, 0x000004D5, 0x000004D6, 0x000004D7,
+    0x000004D8, 0x000004D9, 0x000004DA, 0x000004DB, 0x000004DC, 0x1000004E, 0x000004DE, 0x000004DF,
+    0x0000004E, 0x000004E1, 0x000004E2, 0x000004E3, 0x000004E4, 0x000004E5, 0x000004E6, 0x000004E7,
+    0x000004E8, 0x000004E9, 0x000004EA, 0x000004EB, 0x000004EC, 0x000004ED, 0x2000004F, 0x000004EF,
+    0x0000004F, 0x000004F1, 0x000004F2, 0x000004F3, 0x000004F4, 0x000004F5, 0x000004F6, 0x000004F7,
+    0x000004F8, 0x000004F9, 0x000004FA, 0x000004FB, 0x000004FC, 0x000004FD, 0x000004FE, 0x000004FF,
+    0x00000005, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00100006, 0x00000056, 0x00000057,
+    0x00000058, 0x00000059, 0x0000005A, 0x0000005B, 0x0000005C, 0x0000005D, 0x0000005E, 0x0000005F,
+    0x00000051, 0x00010052, 0x00000512, 0x00000513, 0x00000514, 0x00000515, 0x00000516, 0x00000517,
+    0x00000518, 0x00000519, 0x0000051A, 0x0000051B, 0x0000051C, 0x0000051D, 0x0000051E, 0x0000051F,
+    0x00000052, 0x00000521, 0x00020053, 0x00000523, 0x00000524, 0x00000525, 0x00000526, 0x00000527,
+    0x00000528, 0x00000529, 0x0000052A, 0x0000052B, 0x0000052C, 0x0000052D, 0x0000052E, 0x0000052F,
+    0x00000053, 0x00000531, 0x00000532, 0x00040054, 0x00000534, 0x00000535, 0x00000536, 0x00000537,
+    0x00000538, 0x00000539, 0x0000053A, 0x0000053B, 0x0000053C, 0x0000053D, 0x0000053E, 0x0000053F,
+    0x00000054, 0x00000541, 0x00000542, 0x00000543, 0x00080055, 0x00000545, 0x00000546, 0x00000547,
+    0x00000548, 0x00000549, 0x0000054A, 0x0000054B, 0x0000054C, 0x0000054D, 0x0000054E, 0x0000054F,
+    0x00100006, 0x00100061, 0x00100062, 0x00100063, 0x00100064, 0x00100056, 0x00100066, 0x00100067,
+    0x00100068, 0x00100069, 0x0010006A, 0x0010006B, 0x0010006C, 0x0010006D, 0x0010006E, 0x0010006F,
+    0x00000056, 0x00000561, 0x00000562, 0x00000563, 0x00000564, 0x00000565, 0x00200057, 0x00000567,
+    0x00000568, 0x00000569, 0x0000056A, 0x0000056B, 0x0000056C, 0x0000056D, 0x0000056E, 0x0000056F,
+    0x00000057, 0x00000571, 0x00000572, 0x00000573, 0x00000574, 0x00000575, 0x00000576, 0x00400058,
+    0x00000578, 0x00000579, 0x0000057A, 0x0000057B, 0x0000057C, 0x0000057D, 0x0000057E, 0x0000057F,
+    0x00000058, 0x00000581, 0x00000582, 0x00000583, 0x00000584, 0x00000585, 0x00000586, 0x00000587,
+    0x00800059, 0x00000589, 0x0000058A, 0x0000058B, 0x0000058C, 0x0000058D, 0x0000058E, 0x0000058F,
+    0x00000059, 0x00000591, 0x00000592, 0x00000593, 0x00000594, 0x00000595, 0x00000596, 0x00000597,
+    0x00000598, 0x0100005A, 0x0000059A, 0x0000059B, 0x0000059C, 0x0000059D, 0x0000059E, 0x0000059F,
+    0x0000005A, 0x000005A1, 0x000005A2, 0x000005A3, 0x000005A4, 0x000005A5, 0x000005A6, 0x000005A7,
+    0x000005A8, 0x000005A9, 0x8200005B, 0x000005AB, 0x000005AC, 0x000005AD, 0x000005AE, 0x000005AF,
+    0x0000005B, 0x000005B1, 0x000005B2, 0x000005B3, 0x000005B4, 0x000005B5, 0x000005B6, 0x000005B7,
+    0x000005B8, 0x000005B9, 0x000005BA, 0x0400005C, 0x000005BC, 0x000005BD, 0x000005BE, 0x000005BF,
+    0x0000005C, 0x000005C1, 0x000005C2, 0x000005C3, 0x000005C4, 0x000005C5, 0x000005C6, 0x000005C7,
+    0x000005C8, 0x000005C9, 0x000005CA, 0x000005CB, 0x0800005D, 0x000005CD, 0x000005CE, 0x000005CF,
+    0x0000005D, 0x000005D1, 0x000005D2, 0x000005D3, 0x000005D4, 0x000005D5, 0x000005D6, 0x000005D7,
+    0x000005D8, 0x000005D9, 0x000005DA, 0x000005DB, 0x000005DC, 0x1000005E, 0x000005DE, 0x000005DF,
+    0x0000005E, 0x000005E1, 0x000005E2, 0x000005E3, 0x000005E4, 0x000005E5, 0x000005E6, 0x000005E7,
+    0x000005E8, 0x000005E9, 0x000005EA, 0x000005EB, 0x000005EC, 0x000005ED, 0x2000005F, 0x000005EF,
+    0x0000005F, 0x000005F1, 0x000005F2, 0x000005F3, 0x000005F4, 0x000005F5, 0x000005F6, 0x000005F7,
+    0x000005F8, 0x000005F9, 0x000005FA, 0x000005FB, 0x000005FC, 0x000005FD, 0x000005FE, 0x000005FF,
+    0x00000006, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00200007, 0x00000067,
+    0x00000068, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F,
+    0x00000061, 0x00010062, 0x00000612, 0x00000613, 0x00000614, 0x00000615, 0x00000616, 0x00000617,
+    0x00000618, 0x00000619, 0x0000061A, 0x0000061B, 0x0000061C, 0x0000061D, 0x0000061E, 0x0000061F,
+    0x00000062, 0x00000621, 0x00020063, 0x00000623, 0x00000624, 0x00000625, 0x00000626, 0x00000627,
+    0x00000628, 0x00000629, 0x0000062A, 0x0000062B, 0x0000062C, 0x0000062D, 0x0000062E, 0x0000062F,
+    0x00000063, 0x00000631, 0x00000632, 0x00040064, 0x00000634, 0x00000635, 0x00000636, 0x00000637,
+    0x00000638, 0x00000639, 0x0000063A, 0x0000063B, 0x0000063C, 0x0000063D, 0x0000063E, 0x0000063F,
+    0x00000064, 0x00000641, 0x00000642, 0x00000643, 0x00080065, 0x00000645, 0x00000646, 0x00000647,
+    0x00000648, 0x00000649, 0x0000064A, 0x0000064B, 0x0000064C, 0x0000064D, 0x0000064E, 0x0000064F,
+    0x00000065, 0x00000651, 0x00000652, 0x00000653, 0x00000654, 0x00100066, 0x00000656, 0x00000657,
+    0x00000658, 0x00000659, 0x0000065A, 0x0000065B, 0x0000065C, 0x0000065D, 0x0000065E, 0x0000065F,
+    0x00200007, 0x00200071, 0x00200072, 0x00200073, 0x00200074, 0x00200075, 0x00200067, 0x00200077,
+    0x00200078, 0x00200079, 0x0020007A, 0x0020007B, 0x0020007C, 0x0020007D, 0x0020007E, 0x0020007F,
+    0x00000067, 0x00000671, 0x00000672, 0x00000673, 0x00000674, 0x00000675, 0x00000676, 0x00400068,
+    0x00000678, 0x00000679, 0x0000067A, 0x0000067B, 0x0000067C, 0x0000067D, 0x0000067E, 0x0000067F,
+    0x00000068, 0x00000681, 0x00000682, 0x00000683, 0x00000684, 0x00000685, 0x00000686, 0x00000687,
+    0x00800069, 0x00000689, 0x0000068A, 0x0000068B, 0x0000068C, 0x0000068D, 0x0000068E, 0x0000068F,
+    0x00000069, 0x00000691, 0x00000692, 0x00000693, 0x00000694, 0x00000695, 0x00000696, 0x00000697,
+    0x00000698, 0x0100006A, 0x0000069A, 0x0000069B, 0x0000069C, 0x0000069D, 0x0000069E, 0x0000069F,
+    0x0000006A, 0x000006A1, 0x000006A2, 0x000006A3, 0x000006A4, 0x000006A5, 0x000006A6, 0x000006A7,
+    0x000006A8, 0x000006A9, 0x8200006B, 0x000006AB, 0x000006AC, 0x000006AD, 0x000006AE, 0x000006AF,
+    0x0000006B, 0x000006B1, 0x000006B2, 0x000006B3, 0x000006B4, 0x000006B5, 0x000006B6, 0x000006B7,
+    0x000006B8, 0x000006B9, 0x000006BA, 0x0400006C, 0x000006BC, 0x000006BD, 0x000006BE, 0x000006BF,
+    0x0000006C, 0x000006C1, 0x000006C2, 0x000006C3, 0x000006C4, 0x000006C5, 0x000006C6, 0x000006C7,
+    0x000006C8, 0x000006C9, 0x000006CA, 0x000006CB, 0x0800006D, 0x000006CD, 0x000006CE, 0x000006CF,
+    0x0000006D, 0x000006D1, 0x000006D2, 0x000006D3, 0x000006D4, 0x000006D5, 0x000006D6, 0x000006D7,
+    0x000006D8, 0x000006D9, 0x000006DA, 0x000006DB, 0x000006DC, 0x1000006E, 0x000006DE, 0x000006DF,
+    0x0000006E, 0x000006E1, 0x000006E2, 0x000006E3, 0x000006E4, 0x000006E5, 0x000006E6, 0x000006E7,
+    0x000006E8, 0x000006E9, 0x000006EA, 0x000006EB, 0x000006EC, 0x000006ED, 0x2000006F, 0x000006EF,
+    0x0000006F, 0x000006F1, 0x000006F2, 0x000006F3, 0x000006F4, 0x000006F5, 0x000006F6, 0x000006F7,
+    0x000006F8, 0x000006F9, 0x000006FA, 0x000006FB, 0x000006FC, 0x000006FD, 0x000006FE, 0x000006FF,
+    0x00000007, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00400008,
+    0x00000078, 0x00000079, 0x0000007A, 0x0000007B, 0x0000007C, 0x0000007D, 0x0000007E, 0x0000007F,
+    0x00000071, 0x00010072, 0x00000712, 0x00000713, 0x00000714, 0x00000715, 0x00000716, 0x00000717,
+    0x00000718, 0x00000719, 0x0000071A, 0x0000071B, 0x0000071C, 0x0000071D, 0x0000071E, 0x0000071F,
+    0x00000072, 0x00000721, 0x00020073, 0x00000723, 0x00000724, 0x00000725, 0x00000726, 0x00000727,
+    0x00000728, 0x00000729, 0x0000072A, 0x0000072B, 0x0000072C, 0x0000072D, 0x0000072E, 0x0000072F,
+    0x00000073, 0x00000731, 0x00000732, 0x00040074, 0x00000734, 0x00000735, 0x00000736, 0x00000737,
+    0x00000738, 0x00000739, 0x0000073A, 0x0000073B, 0x0000073C, 0x0000073D, 0x0000073E, 0x0000073F,
+    0x00000074, 0x00000741, 0x00000742, 0x00000743, 0x00080075, 0x00000745, 0x00000746, 0x00000747,
+    0x00000748, 0x00000749, 0x0000074A, 0x0000074B, 0x0000074C, 0x0000074D, 0x0000074E, 0x0000074F,
+    0x00000075, 0x00000751, 0x00000752, 0x00000753, 0x00000754, 0x00100076, 0x00000756, 0x00000757,
+    0x00000758, 0x00000759, 0x0000075A, 0x0000075B, 0x0000075C, 0x0000075D, 0x0000075E, 0x0000075F,
+    0x00000076, 0x00000761, 0x00000762, 0x00000763, 0x00000764, 0x00000765, 0x00200077, 0x00000767,
+    0x00000768, 0x00000769, 0x0000076A, 0x0000076B, 0x0000076C, 0x0000076D, 0x0000076E, 0x0000076F,
+    0x00400008, 0x00400081, 0x00400082, 0x00400083, 0x00400084, 0x00400085, 0x00400086, 0x00400078,
+    0x00400088, 0x00400089, 0x0040008A, 0x0040008B, 0x0040008C, 0x0040008D, 0x0040008E, 0x0040008F,
+    0x00000078, 0x00000781, 0x00000782, 0x00000783, 0x00000784, 0x00000785, 0x00000786, 0x00000787,
+    0x00800079, 0x00000789, 0x0000078A, 0x0000078B, 0x0000078C, 0x0000078D, 0x0000078E, 0x0000078F,
+    0x00000079, 0x00000791, 0x00000792, 0x00000793, 0x00000794, 0x00000795, 0x00000796, 0x00000797,
+    0x00000798, 0x0100007A, 0x0000079A, 0x0000079B, 0x0000079C, 0x0000079D, 0x0000079E, 0x0000079F,
+    0x0000007A, 0x000007A1, 0x000007A2, 0x000007A3, 0x000007A4, 0x000007A5, 0x000007A6, 0x000007A7,
+    0x000007A8, 0x000007A9, 0x8200007B, 0x000007AB, 0x000007AC, 0x000007AD, 0x000007AE, 0x000007AF,
+    0x0000007B, 0x000007B1, 0x000007B2, 0x000007B3, 0x000007B4, 0x000007B5, 0x000007B6, 0x000007B7,
+    0x000007B8, 0x000007B9, 0x000007BA, 0x0400007C, 0x000007BC, 0x000007BD, 0x000007BE, 0x000007BF,
+    0x0000007C, 0x000007C1, 0x000007C2, 0x000007C3, 0x000007C4, 0x000007C5, 0x000007C6, 0x000007C7,
+    0x000007C8, 0x000007C9, 0x000007CA, 0x000007CB, 0x0800007D, 0x000007CD, 0x000007CE, 0x000007CF,
+    0x0000007D, 0x000007D1, 0x000007D2, 0x000007D3, 0x000007D4, 0x000007D5, 0x000007D6, 0x000007D7,
+    0x000007D8, 0x000007D9, 0x000007DA, 0x000007DB, 0x000007DC, 0x1000007E, 0x000007DE, 0x000007DF,
+    0x0000007E, 0x000007E1, 0x000007E2, 0x000007E3, 0x000007E4, 0x000007E5, 0x000007E6, 0x000007E7,
+    0x000007E8, 0x000007E9, 0x000007EA, 0x000007EB, 0x000007EC, 0x000007ED, 0x2000007F, 0x000007EF,
+    0x0000007F, 0x000007F1, 0x000007F2, 0x000007F3, 0x000007F4, 0x000007F5, 0x000007F6, 0x000007F7,
+    0x000007F8, 0x000007F9, 0x000007FA, 0x000007FB, 0x000007FC, 0x000007FD, 0x000007FE, 0x000007FF,
+    0x00000008, 0x00000081, 0x00000082, 0x00000083, 0x00000084, 0x00000085, 0x00000086, 0x00000087,
+    0x00800009, 0x00000089, 0x0000008A, 0x0000008B, 0x0000008C, 0x0000008D, 0x0000008E, 0x0000008F,
+    0x00000081, 0x00010082, 0x00000812, 0x00000813, 0x00000814, 0x00000815, 0x00000816, 0x00000817,
+    0x00000818, 0x00000819, 0x0000081A, 0x0000081B, 0x0000081C, 0x0000081D, 0x0000081E, 0x0000081F,
+    0x00000082, 0x00000821, 0x00020083, 0x00000823, 0x00000824, 0x00000825, 0x00000826, 0x00000827,
+    0x00000828, 0x00000829, 0x0000082A, 0x0000082B, 0x0000082C, 0x0000082D, 0x0000082E, 0x0000082F,
+    0x00000083, 0x00000831, 0x00000832, 0x00040084, 0x00000834, 0x00000835, 0x00000836, 0x00000837,
+    0x00000838, 0x00000839, 0x0000083A, 0x0000083B, 0x0000083C, 0x0000083D, 0x0000083E, 0x0000083F,
+    0x00000084, 0x00000841, 0x00000842, 0x00000843, 0x00080085, 0x00000845, 0x00000846, 0x00000847,
+    0x00000848, 0x00000849, 0x0000084A, 0x0000084B, 0x0000084C, 0x0000084D, 0x0000084E, 0x0000084F,
+    0x00000085, 0x00000851, 0x00000852, 0x00000853, 0x00000854, 0x00100086, 0x00000856, 0x00000857,
+    0x00000858, 0x00000859, 0x0000085A, 0x0000085B, 0x0000085C, 0x0000085D, 0x0000085E, 0x0000085F,
+    0x00000086, 0x00000861, 0x00000862, 0x00000863, 0x00000864, 0x00000865, 0x00200087, 0x00000867,
+    0x00000868, 0x00000869, 0x0000086A, 0x0000086B, 0x0000086C, 0x0000086D, 0x0000086E, 0x0000086F,
+    0x00000087, 0x00000871, 0x00000872, 0x00000873, 0x00000874, 0x00000875, 0x00000876, 0x00400088,
+    0x00000878, 0x00000879, 0x0000087A, 0x0000087B, 0x0000087C, 0x0000087D, 0x0000087E, 0x0000087F,
+    0x00800009, 0x00800091, 0x00800092, 0x00800093, 0x00800094, 0x00800095, 0x00800096, 0x00800097,
+    0x00800089, 0x00800099, 0x0080009A, 0x0080009B, 0x0080009C, 0x0080009D, 0x0080009E, 0x0080009F,
+    0x00000089, 0x00000891, 0x00000892, 0x00000893, 0x00000894, 0x00000895, 0x00000896, 0x00000897,
+    0x00000898, 0x0100008A, 0x0000089A, 0x0000089B, 0x0000089C, 0x0000089D, 0x0000089E, 0x0000089F,
+    0x0000008A, 0x000008A1, 0x000008A2, 0x000008A3, 0x000008A4, 0x000008A5, 0x000008A6, 0x000008A7,
+    0x000008A8, 0x000008A9, 0x8200008B, 0x000008AB, 0x000008AC, 0x000008AD, 0x000008AE, 0x000008AF,
+    0x0000008B, 0x000008B1, 0x000008B2, 0x000008B3, 0x000008B4, 0x000008B5, 0x000008B6, 0x000008B7,
+    0x000008B8, 0x000008B9, 0x000008BA, 0x0400008C, 0x000008BC, 0x000008BD, 0x000008BE, 0x000008BF,
+    0x0000008C, 0x000008C1, 0x000008C2, 0x000008C3, 0x000008C4, 0x000008C5, 0x000008C6, 0x000008C7,
+    0x000008C8, 0x000008C9, 0x000008CA, 0x000008CB, 0x0800008D, 0x000008CD, 0x000008CE, 0x000008CF,
+    0x0000008D, 0x000008D1, 0x000008D2, 0x000008D3, 0x000008D4, 0x000008D5, 0x000008D6, 0x000008D7,
+    0x000008D8, 0x000008D9, 0x000008DA, 0x000008DB, 0x000008DC, 0x1000008E, 0x000008DE, 0x000008DF,
+    0x0000008E, 0x000008E1, 0x000008E2, 0x000008E3, 0x000008E4, 0x000008E5, 0x000008E6, 0x000008E7,
+    0x000008E8, 0x000008E9, 0x000008EA, 0x000008EB, 0x000008EC, 0x000008ED, 0x2000008F, 0x000008EF,
+    0x0000008F, 0x000008F1, 0x000008F2, 0x000008F3, 0x000008F4, 0x000008F5, 0x000008F6, 0x000008F7,
+    0x000008F8, 0x000008F9, 0x000008FA, 0x000008FB, 0x000008FC, 0x000008FD, 0x000008FE, 0x000008FF,
+    0x00000009, 0x00000091, 0x00000092, 0x00000093, 0x00000094, 0x00000095, 0x00000096, 0x00000097,
+    0x00000098, 0x0100000A, 0x0000009A, 0x0000009B, 0x0000009C, 0x0000009D, 0x0000009E, 0x0000009F,
+    0x00000091, 0x00010092, 0x00000912, 0x00000913, 0x00000914, 0x00000915, 0x00000916, 0x00000917,
+    0x00000918, 0x00000919, 0x0000091A, 0x0000091B, 0x0000091C, 0x0000091D, 0x0000091E, 0x0000091F,
+    0x00000092, 0x00000921, 0x00020093, 0x00000923, 0x00000924, 0x00000925, 0x00000926, 0x00000927,
+    0x00000928, 0x00000929, 0x0000092A, 0x0000092B, 0x0000092C, 0x0000092D, 0x0000092E, 0x0000092F,
+    0x00000093, 0x00000931, 0x00000932, 0x00040094, 0x00000934, 0x00000935, 0x00000936, 0x00000937,
+    0x00000938, 0x00000939, 0x0000093A, 0x0000093B, 0x0000093C, 0x0000093D, 0x0000093E, 0x0000093F,
+    0x00000094, 0x00000941, 0x00000942, 0x00000943, 0x00080095, 0x00000945, 0x00000946, 0x00000947,
+    0x00000948, 0x00000949, 0x0000094A, 0x0000094B, 0x0000094C, 0x0000094D, 0x0000094E, 0x0000094F,
+    0x00000095, 0x00000951, 0x00000952, 0x00000953, 0x00000954, 0x00100096, 0x00000956, 0x00000957,
+    0x00000958, 0x00000959, 0x0000095A, 0x0000095B, 0x0000095C, 0x0000095D, 0x0000095E, 0x0000095F,
+    0x00000096, 0x00000961, 0x00000962, 0x00000963, 0x00000964, 0x00000965, 0x00200097, 0x00000967,
+    0x00000968, 0x00000969, 0x0000096A, 0x0000096B, 0x0000096C, 0x0000096D, 0x0000096E, 0x0000096F,
+    0x00000097, 0x00000971, 0x00000972, 0x00000973, 0x00000974, 0x00000975, 0x00000976, 0x00400098,
+    0x00000978, 0x00000979, 0x0000097A, 0x0000097B, 0x0000097C, 0x0000097D, 0x0000097E, 0x0000097F,
+    0x00000098, 0x00000981, 0x00000982, 0x00000983, 0x00000984, 0x00000985, 0x00000986, 0x00000987,
+    0x00800099, 0x00000989, 0x0000098A, 0x0000098B, 0x0000098C, 0x0000098D, 0x0000098E, 0x0000098F,
+    0x0100000A, 0x010000A1, 0x010000A2, 0x010000A3, 0x010000A4, 0x010000A5, 0x010000A6, 0x010000A7,
+    0x010000A8, 0x0100009A, 0x010000AA, 0x010000AB, 0x010000AC, 0x010000AD, 0x010000AE, 0x010000AF,
+    0x0000009A, 0x000009A1, 0x000009A2, 0x000009A3, 0x000009A4, 0x000009A5, 0x000009A6, 0x000009A7,
+    0x000009A8, 0x000009A9, 0x8200009B, 0x000009AB, 0x000009AC, 0x000009AD, 0x000009AE, 0x000009AF,
+    0x0000009B, 0x000009B1, 0x000009B2, 0x000009B3, 0x000009B4, 0x000009B5, 0x000009B6, 0x000009B7,
+    0x000009B8, 0x000009B9, 0x000009BA, 0x0400009C, 0x000009BC, 0x000009BD, 0x000009BE, 0x000009BF,
+    0x0000009C, 0x000009C1, 0x000009C2, 0x000009C3, 0x000009C4, 0x000009C5, 0x000009C6, 0x000009C7,
+    0x000009C8, 0x000009C9, 0x000009CA, 0x000009CB, 0x0800009D, 0x000009CD, 0x000009CE, 0x000009CF,
+    0x0000009D, 0x000009D1, 0x000009D2, 0x000009D3, 0x000009D4, 0x000009D5, 0x000009D6, 0x000009D7,
+    0x000009D8, 0x000009D9, 0x000009DA, 0x000009DB, 0x000009DC, 0x1000009E, 0x000009DE, 0x000009DF,
+    0x0000009E, 0x000009E1, 0x000009E2, 0x000009E3, 0x000009E4, 0x000009E5, 0x000009E6, 0x000009E7,
+    0x000009E8, 0x000009E9, 0x000009EA, 0x000009EB, 0x000009EC, 0x000009ED, 0x2000009F, 0x000009EF,
+    0x0000009F, 0x000009F1, 0x000009F2, 0x000009F3, 0x000009F4, 0x000009F5, 0x000009F6, 0x000009F7,
+    0x000009F8, 0x000009F9, 0x000009FA, 0x000009FB, 0x000009FC, 0x000009FD, 0x000009FE, 0x000009FF,
+    0x0000000A, 0x000000A1, 0x000000A2, 0x000000A3, 0x000000A4, 0x000000A5, 0x000000A6, 0x000000A7,
+    0x000000A8, 0x000000A9, 0x8200000B, 0x000000AB, 0x000000AC, 0x000000AD, 0x000000AE, 0x000000AF,
+    0x000000A1, 0x000100A2, 0x00000A12, 0x00000A13, 0x00000A14, 0x00000A15, 0x00000A16, 0x00000A17,
+    0x00000A18, 0x00000A19, 0x00000A1A, 0x00000A1B, 0x00000A1C, 0x00000A1D, 0x00000A1E, 0x00000A1F,
+    0x000000A2, 0x00000A21, 0x000200A3, 0x00000A23, 0x00000A24, 0x00000A25, 0x00000A26, 0x00000A27,
+    0x00000A28, 0x00000A29, 0x00000A2A, 0x00000A2B, 0x00000A2C, 0x00000A2D, 0x00000A2E, 0x00000A2F,
+    0x000000A3, 0x00000A31, 0x00000A32, 0x000400A4, 0x00000A34, 0x00000A35, 0x00000A36, 0x00000A37,
+    0x00000A38, 0x00000A39, 0x00000A3A, 0x00000A3B, 0x00000A3C, 0x00000A3D, 0x00000A3E, 0x00000A3F,
+    0x000000A4, 0x00000A41, 0x00000A42, 0x00000A43, 0x000800A5, 0x00000A45, 0x00000A46, 0x00000A47,
+    0x00000A48, 0x00000A49, 0x00000A4A, 0x00000A4B, 0x00000A4C, 0x00000A4D, 0x00000A4E, 0x00000A4F,
+    0x000000A5, 0x00000A51, 0x00000A52, 0x00000A53, 0x00000A54, 0x001000A6, 0x00000A56, 0x00000A57,
+    0x00000A58, 0x00000A59, 0x00000A5A, 0x00000A5B, 0x00000A5C, 0x00000A5D, 0x00000A5E, 0x00000A5F,
+    0x000000A6, 0x00000A61, 0x00000A62, 0x00000A63, 0x00000A64, 0x00000A65, 0x002000A7, 0x00000A67,
+    0x00000A68, 0x00000A69, 0x00000A6A, 0x00000A6B, 0x00000A6C, 0x00000A6D, 0x00000A6E, 0x00000A6F,
+    0x000000A7, 0x00000A71, 0x00000A72, 0x00000A73, 0x00000A74, 0x00000A75, 0x00000A76, 0x004000A8,
+    0x00000A78, 0x00000A79, 0x00000A7A, 0x00000A7B, 0x00000A7C, 0x00000A7D, 0x00000A7E, 0x00000A7F,
+    0x000000A8, 0x00000A81, 0x00000A82, 0x00000A83, 0x00000A84, 0x00000A85, 0x00000A86, 0x00000A87,
+    0x008000A9, 0x00000A89, 0x00000A8A, 0x00000A8B, 0x00000A8C, 0x00000A8D, 0x00000A8E, 0x00000A8F,
+    0x000000A9, 0x00000A91, 0x00000A92, 0x00000A93, 0x00000A94, 0x00000A95, 0x00000A96, 0x00000A97,
+    0x00000A98, 0x010000AA, 0x00000A9A, 0x00000A9B, 0x00000A9C, 0x00000A9D, 0x00000A9E, 0x00000A9F,
+    0x8200000B, 0x820000B1, 0x820000B2, 0x820000B3, 0x820000B4, 0x820000B5, 0x820000B6, 0x820000B7,
+    0x820000B8, 0x820000B9, 0x820000AB, 0x820000BB, 0x820000BC, 0x820000BD, 0x820000BE, 0x820000BF,
+    0x000000AB, 0x00000AB1, 0x00000AB2, 0x00000AB3, 0x00000AB4, 0x00000AB5, 0x00000AB6, 0x00000AB7,
+    0x00000AB8, 0x00000AB9, 0x00000ABA, 0x040000AC, 0x00000ABC, 0x00000ABD, 0x00000ABE, 0x00000ABF,
+    0x000000AC, 0x00000AC1, 0x00000AC2, 0x00000AC3, 0x00000AC4, 0x00000AC5, 0x00000AC6, 0x00000AC7,
+    0x00000AC8, 0x00000AC9, 0x00000ACA, 0x00000ACB, 0x080000AD, 0x00000ACD, 0x00000ACE, 0x00000ACF,
+    0x000000AD, 0x00000AD1, 0x00000AD2, 0x00000AD3, 0x00000AD4, 0x00000AD5, 0x00000AD6, 0x00000AD7,
+    0x00000AD8, 0x00000AD9, 0x00000ADA, 0x00000ADB, 0x00000ADC, 0x100000AE, 0x00000ADE, 0x00000ADF,
+    0x000000AE, 0x00000AE1, 0x00000AE2, 0x00000AE3, 0x00000AE4, 0x00000AE5, 0x00000AE6, 0x00000AE7,
+    0x00000AE8, 0x00000AE9, 0x00000AEA, 0x00000AEB, 0x00000AEC, 0x00000AED, 0x200000AF, 0x00000AEF,
+    0x000000AF, 0x00000AF1, 0x00000AF2, 0x00000AF3, 0x00000AF4, 0x00000AF5, 0x00000AF6, 0x00000AF7,
+    0x00000AF8, 0x00000AF9, 0x00000AFA, 0x00000AFB, 0x00000AFC, 0x00000AFD, 0x00000AFE, 0x00000AFF,
+    0x0000000B, 0x000000B1, 0x000000B2, 0x000000B3, 0x000000B4, 0x000000B5, 0x000000B6, 0x000000B7,
+    0x000000B8, 0x000000B9, 0x000000BA, 0x0400000C, 0x000000BC, 0x000000BD, 0x000000BE, 0x000000BF,
+    0x000000B1, 0x000100B2, 0x00000B12, 0x00000B13, 0x00000B14, 0x00000B15, 0x00000B16, 0x00000B17,
+    0x00000B18, 0x00000B19, 0x00000B1A, 0x00000B1B, 0x00000B1C, 0x00000B1D, 0x00000B1E, 0x00000B1F,
+    0x000000B2, 0x00000B21, 0x000200B3, 0x00000B23, 0x00000B24, 0x00000B25, 0x00000B26, 0x00000B27,
+    0x00000B28, 0x00000B29, 0x00000B2A, 0x00000B2B, 0x00000B2C, 0x00000B2D, 0x00000B2E, 0x00000B2F,
+    0x000000B3, 0x00000B31, 0x00000B32, 0x000400B4, 0x00000B34, 0x00000B35, 0x00000B36, 0x00000B37,
+    0x00000B38, 0x00000B39, 0x00000B3A, 0x00000B3B, 0x00000B3C, 0x00000B3D, 0x00000B3E, 0x00000B3F,
+    0x000000B4, 0x00000B41, 0x00000B42, 0x00000B43, 0x000800B5, 0x00000B45, 0x00000B46, 0x00000B47,
+    0x00000B48, 0x00000B49, 0x00000B4A, 0x00000B4B, 0x00000B4C, 0x00000B4D, 0x00000B4E, 0x00000B4F,
+    0x000000B5, 0x00000B51, 0x00000B52, 0x00000B53, 0x00000B54, 0x001000B6, 0x00000B56, 0x00000B57,
+    0x00000B58, 0x00000B59, 0x00000B5A, 0x00000B5B, 0x00000B5C, 0x00000B5D, 0x00000B5E, 0x00000B5F,
+    0x000000B6, 0x00000B61, 0x00000B62, 0x00000B63, 0x00000B64, 0x00000B65, 0x002000B7, 0x00000B67,
+    0x00000B68, 0x00000B69, 0x00000B6A, 0x00000B6B, 0x00000B6C, 0x00000B6D, 0x00000B6E, 0x00000B6F,
+    0x000000B7, 0x00000B71, 0x00000B72, 0x00000B73, 0x00000B74, 0x00000B75, 0x00000B76, 0x004000B8,
+    0x00000B78, 0x00000B79, 0x00000B7A, 0x00000B7B, 0x00000B7C, 0x00000B7D, 0x00000B7E, 0x00000B7F,
+    0x000000B8, 0x00000B81, 0x00000B82, 0x00000B83, 0x00000B84, 0x00000B85, 0x00000B86, 0x00000B87,
+    0x008000B9, 0x00000B89, 0x00000B8A, 0x00000B8B, 0x00000B8C, 0x00000B8D, 0x00000B8E, 0x00000B8F,
+    0x000000B9, 0x00000B91, 0x00000B92, 0x00000B93, 0x00000B94, 0x00000B95, 0x00000B96, 0x00000B97,
+    0x00000B98, 0x010000BA, 0x00000B9A, 0x00000B9B, 0x00000B9C, 0x00000B9D, 0x00000B9E, 0x00000B9F,
+    0x000000BA, 0x00000BA1, 0x00000BA2, 0x00000BA3, 0x00000BA4, 0x00000BA5, 0x00000BA6, 0x00000BA7,
+    0x00000BA8, 0x00000BA9, 0x820000BB, 0x00000BAB, 0x00000BAC, 0x00000BAD, 0x00000BAE, 0x00000BAF,
+    0x0400000C, 0x040000C1, 0x040000C2, 0x040000C3, 0x040000C4, 0x040000C5, 0x040000C6, 0x040000C7,
+    0x040000C8, 0x040000C9, 0x040000CA, 0x040000BC, 0x040000CC, 0x040000CD, 0x040000CE, 0x040000CF,
+    0x000000BC, 0x00000BC1, 0x00000BC2, 0x00000BC3, 0x00000BC4, 0x00000BC5, 0x00000BC6, 0x00000BC7,
+    0x00000BC8, 0x00000BC9, 0x00000BCA, 0x00000BCB, 0x080000BD, 0x00000BCD, 0x00000BCE, 0x00000BCF,
+    0x000000BD, 0x00000BD1, 0x00000BD2, 0x00000BD3, 0x00000BD4, 0x00000BD5, 0x00000BD6, 0x00000BD7,
+    0x00000BD8, 0x00000BD9, 0x00000BDA, 0x00000BDB, 0x00000BDC, 0x100000BE, 0x00000BDE, 0x00000BDF,
+    0x000000BE, 0x00000BE1, 0x00000BE2, 0x00000BE3, 0x00000BE4, 0x00000BE5, 0x00000BE6, 0x00000BE7,
+    0x00000BE8, 0x00000BE9, 0x00000BEA, 0x00000BEB, 0x00000BEC, 0x00000BED, 0x200000BF, 0x00000BEF,
+    0x000000BF, 0x00000BF1, 0x00000BF2, 0x00000BF3, 0x00000BF4, 0x00000BF5, 0x00000BF6, 0x00000BF7,
+    0x00000BF8, 0x00000BF9, 0x00000BFA, 0x00000BFB, 0x00000BFC, 0x00000BFD, 0x00000BFE, 0x00000BFF,
+    0x0000000C, 0x000000C1, 0x000000C2, 0x000000C3, 0x000000C4, 0x000000C5, 0x000000C6, 0x000000C7,
+    0x000000C8, 0x000000C9, 0x000000CA, 0x000000CB, 0x0800000D, 0x000000CD, 0x000000CE, 0x000000CF,
+    0x000000C1, 0x000100C2, 0x00000C12, 0x00000C13, 0x00000C14, 0x00000C15, 0x00000C16, 0x00000C17,
+    0x00000C18, 0x00000C19, 0x00000C1A, 0x00000C1B, 0x00000C1C, 0x00000C1D, 0x00000C1E, 0x00000C1F,
+    0x000000C2, 0x00000C21, 0x000200C3, 0x00000C23, 0x00000C24, 0x00000C25, 0x00000C26, 0x00000C27,
+    0x00000C28, 0x00000C29, 0x00000C2A, 0x00000C2B, 0x00000C2C, 0x00000C2D, 0x00000C2E, 0x00000C2F,
+    0x000000C3, 0x00000C31, 0x00000C32, 0x000400C4, 0x00000C34, 0x00000C35, 0x00000C36, 0x00000C37,
+    0x00000C38, 0x00000C39, 0x00000C3A, 0x00000C3B, 0x00000C3C, 0x00000C3D, 0x00000C3E, 0x00000C3F,
+    0x000000C4, 0x00000C41, 0x00000C42, 0x00000C43, 0x000800C5, 0x00000C45, 0x00000C46, 0x00000C47,
+    0x00000C48, 0x00000C49, 0x00000C4A, 0x00000C4B, 0x00000C4C, 0x00000C4D, 0x00000C4E, 0x00000C4F,
+    0x000000C5, 0x00000C51, 0x00000C52, 0x00000C53, 0x00000C54, 0x001000C6, 0x00000C56, 0x00000C57,
+    0x00000C58, 0x00000C59, 0x00000C5A, 0x00000C5B, 0x00000C5C, 0x00000C5D, 0x00000C5E, 0x00000C5F,
+    0x000000C6, 0x00000C61, 0x00000C62, 0x00000C63, 0x00000C64, 0x00000C65, 0x002000C7, 0x00000C67,
+    0x00000C68, 0x00000C69, 0x00000C6A, 0x00000C6B, 0x00000C6C, 0x00000C6D, 0x00000C6E, 0x00000C6F,
+    0x000000C7, 0x00000C71, 0x00000C72, 0x00000C73, 0x00000C74, 0x00000C75, 0x00000C76, 0x004000C8,
+    0x00000C78, 0x00000C79, 0x00000C7A, 0x00000C7B, 0x00000C7C, 0x00000C7D, 0x00000C7E, 0x00000C7F,
+    0x000000C8, 0x00000C81, 0x00000C82, 0x00000C83, 0x00000C84, 0x00000C85, 0x00000C86, 0x00000C87,
+    0x008000C9, 0x00000C89, 0x00000C8A, 0x00000C8B, 0x00000C8C, 0x00000C8D, 0x00000C8E, 0x00000C8F,
+    0x000000C9, 0x00000C91, 0x00000C92, 0x00000C93, 0x00000C94, 0x00000C95, 0x00000C96, 0x00000C97,
+    0x00000C98, 0x010000CA, 0x00000C9A, 0x00000C9B, 0x00000C9C, 0x00000C9D, 0x00000C9E, 0x00000C9F,
+    0x000000CA, 0x00000CA1, 0x00000CA2, 0x00000CA3, 0x00000CA4, 0x00000CA5, 0x00000CA6, 0x00000CA7,
+    0x00000CA8, 0x00000CA9, 0x820000CB, 0x00000CAB, 0x00000CAC, 0x00000CAD, 0x00000CAE, 0x00000CAF,
+    0x000000CB, 0x00000CB1, 0x00000CB2, 0x00000CB3, 0x00000CB4, 0x00000CB5, 0x00000CB6, 0x00000CB7,
+    0x00000CB8, 0x00000CB9, 0x00000CBA, 0x040000CC, 0x00000CBC, 0x00000CBD, 0x00000CBE, 0x00000CBF,
+    0x0800000D, 0x080000D1, 0x080000D2, 0x080000D3, 0x080000D4, 0x080000D5, 0x080000D6, 0x080000D7,
+    0x080000D8, 0x080000D9, 0x080000DA, 0x080000DB, 0x080000CD, 0x080000DD, 0x080000DE, 0x080000DF,
+    0x000000CD, 0x00000CD1, 0x00000CD2, 0x00000CD3, 0x00000CD4, 0x00000CD5, 0x00000CD6, 0x00000CD7,
+    0x00000CD8, 0x00000CD9, 0x00000CDA, 0x00000CDB, 0x00000CDC, 0x100000CE, 0x00000CDE, 0x00000CDF,
+    0x000000CE, 0x00000CE1, 0x00000CE2, 0x00000CE3, 0x00000CE4, 0x00000CE5, 0x00000CE6, 0x00000CE7,
+    0x00000CE8, 0x00000CE9, 0x00000CEA, 0x00000CEB, 0x00000CEC, 0x00000CED, 0x200000CF, 0x00000CEF,
+    0x000000CF, 0x00000CF1, 0x00000CF2, 0x00000CF3, 0x00000CF4, 0x00000CF5, 0x00000CF6, 0x00000CF7,
+    0x00000CF8, 0x00000CF9, 0x00000CFA, 0x00000CFB, 0x00000CFC, 0x00000CFD, 0x00000CFE, 0x00000CFF,
+    0x0000000D, 0x000000D1, 0x000000D2, 0x000000D3, 0x000000D4, 0x000000D5, 0x000000D6, 0x000000D7,
+    0x000000D8, 0x000000D9, 0x000000DA, 0x000000DB, 0x000000DC, 0x1000000E, 0x000000DE, 0x000000DF,
+    0x000000D1, 0x000100D2, 0x00000D12, 0x00000D13, 0x00000D14, 0x00000D15, 0x00000D16, 0x00000D17,
+    0x00000D18, 0x00000D19, 0x00000D1A, 0x00000D1B, 0x00000D1C, 0x00000D1D, 0x00000D1E, 0x00000D1F,
+    0x000000D2, 0x00000D21, 0x000200D3, 0x00000D23, 0x00000D24, 0x00000D25, 0x00000D26, 0x00000D27,
+    0x00000D28, 0x00000D29, 0x00000D2A, 0x00000D2B, 0x00000D2C, 0x00000D2D, 0x00000D2E, 0x00000D2F,
+    0x000000D3, 0x00000D31, 0x00000D32, 0x000400D4, 0x00000D34, 0x00000D35, 0x00000D36, 0x00000D37,
+    0x00000D38, 0x00000D39, 0x00000D3A, 0x00000D3B, 0x00000D3C, 0x00000D3D, 0x00000D3E, 0x00000D3F,
+    0x000000D4, 0x00000D41, 0x00000D42, 0x00000D43, 0x000800D5, 0x00000D45, 0x00000D46, 0x00000D47,
+    0x00000D48, 0x00000D49, 0x00000D4A, 0x00000D4B, 0x00000D4C, 0x00000D4D, 0x00000D4E, 0x00000D4F,
+    0x000000D5, 0x00000D51, 0x00000D52, 0x00000D53, 0x00000D54, 0x001000D6, 0x00000D56, 0x00000D57,
+    0x00000D58, 0x00000D59, 0x00000D5A, 0x00000D5B, 0x00000D5C, 0x00000D5D, 0x00000D5E, 0x00000D5F,
+    0x000000D6, 0x00000D61, 0x00000D62, 0x00000D63, 0x00000D64, 0x00000D65, 0x002000D7, 0x00000D67,
+    0x00000D68, 0x00000D69, 0x00000D6A, 0x00000D6B, 0x00000D6C, 0x00000D6D, 0x00000D6E, 0x00000D6F,
+    0x000000D7, 0x00000D71, 0x00000D72, 0x00000D73, 0x00000D74, 0x00000D75, 0x00000D76, 0x004000D8,
+    0x00000D78, 0x00000D79, 0x00000D7A, 0x00000D7B, 0x00000D7C, 0x00000D7D, 0x00000D7E, 0x00000D7F,
+    0x000000D8, 0x00000D81, 0x00000D82, 0x00000D83, 0x00000D84, 0x00000D85, 0x00000D86, 0x00000D87,
+    0x008000D9, 0x00000D89, 0x00000D8A, 0x00000D8B, 0x00000D8C, 0x00000D8D, 0x00000D8E, 0x00000D8F,
+    0x000000D9, 0x00000D91, 0x00000D92, 0x00000D93, 0x00000D94, 0x00000D95, 0x00000D96, 0x00000D97,
+    0x00000D98, 0x010000DA, 0x00000D9A, 0x00000D9B, 0x00000D9C, 0x00000D9D, 0x00000D9E, 0x00000D9F,
+    0x000000DA, 0x00000DA1, 0x00000DA2, 0x00000DA3, 0x00000DA4, 0x00000DA5, 0x00000DA6, 0x00000DA7,
+    0x00000DA8, 0x00000DA9, 0x820000DB, 0x00000DAB, 0x00000DAC, 0x00000DAD, 0x00000DAE, 0x00000DAF,
+    0x000000DB, 0x00000DB1, 0x00000DB2, 0x00000DB3, 0x00000DB4, 0x00000DB5, 0x00000DB6, 0x00000DB7,
+    0x00000DB8, 0x00000DB9, 0x00000DBA, 0x040000DC, 0x00000DBC, 0x00000DBD, 0x00000DBE, 0x00000DBF,
+    0x000000DC, 0x00000DC1, 0x00000DC2, 0x00000DC3, 0x00000DC4, 0x00000DC5, 0x00000DC6, 0x00000DC7,
+    0x00000DC8, 0x00000DC9, 0x00000DCA, 0x00000DCB, 0x080000DD, 0x00000DCD, 0x00000DCE, 0x00000DCF,
+    0x1000000E, 0x100000E1, 0x100000E2, 0x100000E3, 0x100000E4, 0x100000E5, 0x100000E6, 0x100000E7,
+    0x100000E8, 0x100000E9, 0x100000EA, 0x100000EB, 0x100000EC, 0x100000DE, 0x100000EE, 0x100000EF,
+    0x000000DE, 0x00000DE1, 0x00000DE2, 0x00000DE3, 0x00000DE4, 0x00000DE5, 0x00000DE6, 0x00000DE7,
+    0x00000DE8, 0x00000DE9, 0x00000DEA, 0x00000DEB, 0x00000DEC, 0x00000DED, 0x200000DF, 0x00000DEF,
+    0x000000DF, 0x00000DF1, 0x00000DF2, 0x00000DF3, 0x00000DF4, 0x00000DF5, 0x00000DF6, 0x00000DF7,
+    0x00000DF8, 0x00000DF9, 0x00000DFA, 0x00000DFB, 0x00000DFC, 0x00000DFD, 0x00000DFE, 0x00000DFF,
+    0x0000000E, 0x000000E1, 0x000000E2, 0x000000E3, 0x000000E4, 0x000000E5, 0x000000E6, 0x000000E7,
+    0x000000E8, 0x000000E9, 0x000000EA, 0x000000EB, 0x000000EC, 0x000000ED, 0x2000000F, 0x000000EF,
+    0x000000E1, 0x000100E2, 0x00000E12, 0x00000E13, 0x00000E14, 0x00000E15, 0x00000E16, 0x00000E17,
+    0x00000E18, 0x00000E19, 0x00000E1A, 0x00000E1B, 0x00000E1C, 0x00000E1D, 0x00000E1E, 0x00000E1F,
+    0x000000E2, 0x00000E21, 0x000200E3, 0x00000E23, 0x00000E24, 0x00000E25, 0x00000E26, 0x00000E27,
+    0x00000E28, 0x00000E29, 0x00000E2A, 0x00000E2B, 0x00000E2C, 0x00000E2D, 0x00000E2E, 0x00000E2F,
+    0x000000E3, 0x00000E31, 0x00000E32, 0x000400E4, 0x00000E34, 0x00000E35, 0x00000E36, 0x00000E37,
+    0x00000E38, 0x00000E39, 0x00000E3A, 0x00000E3B, 0x00000E3C, 0x00000E3D, 0x00000E3E, 0x00000E3F,
+    0x000000E4, 0x00000E41, 0x00000E42, 0x00000E43, 0x000800E5, 0x00000E45, 0x00000E46, 0x00000E47,
+    0x00000E48, 0x00000E49, 0x00000E4A, 0x00000E4B, 0x00000E4C, 0x00000E4D, 0x00000E4E, 0x00000E4F,
+    0x000000E5, 0x00000E51, 0x00000E52, 0x00000E53, 0x00000E54, 0x001000E6, 0x00000E56, 0x00000E57,
+    0x00000E58, 0x00000E59, 0x00000E5A, 0x00000E5B, 0x00000E5C, 0x00000E5D, 0x00000E5E, 0x00000E5F,
+    0x000000E6, 0x00000E61, 0x00000E62, 0x00000E63, 0x00000E64, 0x00000E65, 0x002000E7, 0x00000E67,
+    0x00000E68, 0x00000E69, 0x00000E6A, 0x00000E6B, 0x00000E6C, 0x00000E6D, 0x00000E6E, 0x00000E6F,
+    0x000000E7, 0x00000E71, 0x00000E72, 0x00000E73, 0x00000E74, 0x00000E75, 0x00000E76, 0x004000E8,
+    0x00000E78, 0x00000E79, 0x00000E7A, 0x00000E7B, 0x00000E7C, 0x00000E7D, 0x00000E7E, 0x00000E7F,
+    0x000000E8, 0x00000E81, 0x00000E82, 0x00000E83, 0x00000E84, 0x00000E85, 0x00000E86, 0x00000E87,
+    0x008000E9, 0x00000E89, 0x00000E8A, 0x00000E8B, 0x00000E8C, 0x00000E8D, 0x00000E8E, 0x00000E8F,
+    0x000000E9, 0x00000E91, 0x00000E92, 0x00000E93, 0x00000E94, 0x00000E95, 0x00000E96, 0x00000E97,
+    0x00000E98, 0x010000EA, 0x00000E9A, 0x00000E9B, 0x00000E9C, 0x00000E9D, 0x00000E9E, 0x00000E9F,
+    0x000000EA, 0x00000EA1, 0x00000EA2, 0x00000EA3, 0x00000EA4, 0x00000EA5, 0x00000EA6, 0x00000EA7,
+    0x00000EA8, 0x00000EA9, 0x820000EB, 0x00000EAB, 0x00000EAC, 0x00000EAD, 0x00000EAE, 0x00000EAF,
+    0x000000EB, 0x00000EB1, 0x00000EB2, 0x00000EB3, 0x00000EB4, 0x00000EB5, 0x00000EB6, 0x00000EB7,
+    0x00000EB8, 0x00000EB9, 0x00000EBA, 0x040000EC, 0x00000EBC, 0x00000EBD, 0x00000EBE, 0x00000EBF,
+    0x000000EC, 0x00000EC1, 0x00000EC2, 0x00000EC3, 0x00000EC4, 0x00000EC5, 0x00000EC6, 0x00000EC7,
+    0x00000EC8, 0x00000EC9, 0x00000ECA, 0x00000ECB, 0x080000ED, 0x00000ECD, 0x00000ECE, 0x00000ECF,
+    0x000000ED, 0x00000ED1, 0x00000ED2, 0x00000ED3, 0x00000ED4, 0x00000ED5, 0x00000ED6, 0x00000ED7,
+    0x00000ED8, 0x00000ED9, 0x00000EDA, 0x00000EDB, 0x00000EDC, 0x100000EE, 0x00000EDE, 0x00000EDF,
+    0x2000000F, 0x200000F1, 0x200000F2, 0x200000F3, 0x200000F4, 0x200000F5, 0x200000F6, 0x200000F7,
+    0x200000F8, 0x200000F9, 0x200000FA, 0x200000FB, 0x200000FC, 0x200000FD, 0x200000EF, 0x200000FF,
+    0x000000EF, 0x00000EF1, 0x00000EF2, 0x00000EF3, 0x00000EF4, 0x00000EF5, 0x00000EF6, 0x00000EF7,
+    0x00000EF8, 0x00000EF9, 0x00000EFA, 0x00000EFB, 0x00000EFC, 0x00000EFD, 0x00000EFE, 0x00000EFF,
+    0x0000000F, 0x000000F1, 0x000000F2, 0x000000F3, 0x000000F4, 0x000000F5, 0x000000F6, 0x000000F7,
+    0x000000F8, 0x000000F9, 0x000000FA, 0x000000FB, 0x000000FC, 0x000000FD, 0x000000FE, 0x000000FF,
+    0x000000F1, 0x000100F2, 0x00000F12, 0x00000F13, 0x00000F14, 0x00000F15, 0x00000F16, 0x00000F17,
+    0x00000F18, 0x00000F19, 0x00000F1A, 0x00000F1B, 0x00000F1C, 0x00000F1D, 0x00000F1E, 0x00000F1F,
+    0x000000F2, 0x00000F21, 0x000200F3, 0x00000F23, 0x00000F24, 0x00000F25, 0x00000F26, 0x00000F27,
+    0x00000F28, 0x00000F29, 0x00000F2A, 0x00000F2B, 0x00000F2C, 0x00000F2D, 0x00000F2E, 0x00000F2F,
+    0x000000F3, 0x00000F31, 0x00000F32, 0x000400F4, 0x00000F34, 0x00000F35, 0x00000F36, 0x00000F37,
+    0x00000F38, 0x00000F39, 0x00000F3A, 0x00000F3B, 0x00000F3C, 0x00000F3D, 0x00000F3E, 0x00000F3F,
+    0x000000F4, 0x00000F41, 0x00000F42, 0x00000F43, 0x000800F5, 0x00000F45, 0x00000F46, 0x00000F47,
+    0x00000F48, 0x00000F49, 0x00000F4A, 0x00000F4B, 0x00000F4C, 0x00000F4D, 0x00000F4E, 0x00000F4F,
+    0x000000F5, 0x00000F51, 0x00000F52, 0x00000F53, 0x00000F54, 0x001000F6, 0x00000F56, 0x00000F57,
+    0x00000F58, 0x00000F59, 0x00000F5A, 0x00000F5B, 0x00000F5C, 0x00000F5D, 0x00000F5E, 0x00000F5F,
+    0x000000F6, 0x00000F61, 0x00000F62, 0x00000F63, 0x00000F64, 0x00000F65, 0x002000F7, 0x00000F67,
+    0x00000F68, 0x00000F69, 0x00000F6A, 0x00000F6B, 0x00000F6C, 0x00000F6D, 0x00000F6E, 0x00000F6F,
+    0x000000F7, 0x00000F71, 0x00000F72, 0x00000F73, 0x00000F74, 0x00000F75, 0x00000F76, 0x004000F8,
+    0x00000F78, 0x00000F79, 0x00000F7A, 0x00000F7B, 0x00000F7C, 0x00000F7D, 0x00000F7E, 0x00000F7F,
+    0x000000F8, 0x00000F81, 0x00000F82, 0x00000F83, 0x00000F84, 0x00000F85, 0x00000F86, 0x00000F87,
+    0x008000F9, 0x00000F89, 0x00000F8A, 0x00000F8B, 0x00000F8C, 0x00000F8D, 0x00000F8E, 0x00000F8F,
+    0x000000F9, 0x00000F91, 0x00000F92, 0x00000F93, 0x00000F94, 0x00000F95, 0x00000F96, 0x00000F97,
+    0x00000F98, 0x010000FA, 0x00000F9A, 0x00000F9B, 0x00000F9C, 0x00000F9D, 0x00000F9E, 0x00000F9F,
+    0x000000FA, 0x00000FA1, 0x00000FA2, 0x00000FA3, 0x00000FA4, 0x00000FA5, 0x00000FA6, 0x00000FA7,
+    0x00000FA8, 0x00000FA9, 0x820000FB, 0x00000FAB, 0x00000FAC, 0x00000FAD, 0x00000FAE, 0x00000FAF,
+    0x000000FB, 0x00000FB1, 0x00000FB2, 0x00000FB3, 0x00000FB4, 0x00000FB5, 0x00000FB6, 0x00000FB7,
+    0x00000FB8, 0x00000FB9, 0x00000FBA, 0x040000FC, 0x00000FBC, 0x00000FBD, 0x00000FBE, 0x00000FBF,
+    0x000000FC, 0x00000FC1, 0x00000FC2, 0x00000FC3, 0x00000FC4, 0x00000FC5, 0x00000FC6, 0x00000FC7,
+    0x00000FC8, 0x00000FC9, 0x00000FCA, 0x00000FCB, 0x080000FD, 0x00000FCD, 0x00000FCE, 0x00000FCF,
+    0x000000FD, 0x00000FD1, 0x00000FD2, 0x00000FD3, 0x00000FD4, 0x00000FD5, 0x00000FD6, 0x00000FD7,
+    0x00000FD8, 0x00000FD9, 0x00000FDA, 0x00000FDB, 0x00000FDC, 0x100000FE, 0x00000FDE, 0x00000FDF,
+    0x000000FE, 0x00000FE1, 0x00000FE2, 0x00000FE3, 0x00000FE4, 0x00000FE5, 0x00000FE6, 0x00000FE7,
+    0x00000FE8, 0x00000FE9, 0x00000FEA, 0x00000FEB, 0x00000FEC, 0x00000FED, 0x200000FF, 0x00000FEF,
+    0x000000FF, 0x00000FF1, 0x00000FF2, 0x00000FF3, 0x00000FF4, 0x00000FF5, 0x00000FF6, 0x00000FF7,
+    0x00000FF8, 0x00000FF9, 0x00000FFA, 0x00000FFB, 0x00000FFC, 0x00000FFD, 0x00000FFE, 0x00000FFF,
+};
+
+const uint32_t slide_pair_table[4096] = {
+    0x00000000, 0x00000400, 0x00000800, 0x00000C00, 0x00001000, 0x00001400, 0x00001800, 0x00001C00,
+    0x00002000, 0x00002400, 0x00002800, 0x00002C00, 0x00003000, 0x00003400, 0x00003800, 0x00003C00,
+    0x00000400, 0x00040102, 0x00000502, 0x00000503, 0x00000504, 0x00000505, 0x00000506, 0x00000507,
+    0x00000508, 0x00000509, 0x0000050A, 0x0000050B, 0x0000050C, 0x0000050D, 0x0000050E, 0x0000050F,
+    0x00000800, 0x00000901, 0x00080103, 0x00000903, 0x00000904, 0x00000905, 0x00000906, 0x00000907,
+    0x00000908, 0x00000909, 0x0000090A, 0x0000090B, 0x0000090C, 0x0000090D, 0x0000090E, 0x0000090F,
+    0x00000C00, 0x00000D01, 0x00000D02, 0x00100104, 0x00000D04, 0x00000D05, 0x00000D06, 0x00000D07,
+    0x00000D08, 0x00000D09, 0x00000D0A, 0x00000D0B, 0x00000D0C, 0x00000D0D, 0x00000D0E, 0x00000D0F,
+    0x00001000, 0x00001101, 0x00001102, 0x00001103, 0x00200105, 0x00001105, 0x00001106, 0x00001107,
+    0x00001108, 0x00001109, 0x0000110A, 0x0000110B, 0x0000110C, 0x0000110D, 0x0000110E, 0x0000110F,
+    0x00001400, 0x00001501, 0x00001502, 0x00001503, 0x00001504, 0x00400106, 0x00001506, 0x00001507,
+    0x00001508, 0x00001509, 0x0000150A, 0x0000150B, 0x0000150C, 0x0000150D, 0x0000150E, 0x0000150F,
+    0x00001800, 0x00001901, 0x00001902, 0x00001903, 0x00001904, 0x00001905, 0x00800107, 0x00001907,
+    0x00001908, 0x00001909, 0x0000190A, 0x0000190B, 0x0000190C, 0x0000190D, 0x0000190E, 0x0000190F,
+    0x00001C00, 0x00001D01, 0x00001D02, 0x00001D03, 0x00001D04, 0x00001D05, 0x00001D06, 0x01000108,
+    0x00001D08, 0x00001D09, 0x00001D0A, 0x00001D0B, 0x00001D0C, 0x00001D0D, 0x00001D0E, 0x00001D0F,
+    0x00002000, 0x00002101, 0x00002102, 0x00002103, 0x00002104, 0x00002105, 0x00002106, 0x00002107,
+    0x02000109, 0x00002109, 0x0000210A, 0x0000210B, 0x0000210C, 0x0000210D, 0x0000210E, 0x0000210F,
+    0x00002400, 0x00002501, 0x00002502, 0x00002503, 0x00002504, 0x00002505, 0x00002506, 0x00002507,
+    0x00002508, 0x0400010A, 0x0000250A, 0x0000250B, 0x0000250C, 0x0000250D, 0x0000250E, 0x0000250F,
+    0x00002800, 0x00002901, 0x00002902, 0x00002903, 0x00002904, 0x00002905, 0x00002906, 0x00002907,
+    0x00002908, 0x00002909, 0x0800410B, 0x0000290B, 0x0000290C, 0x0000290D, 0x0000290E, 0x0000290F,
+    0x00002C00, 0x00002D01, 0x00002D02, 0x00002D03, 0x00002D04, 0x00002D05, 0x00002D06, 0x00002D07,
+    0x00002D08, 0x00002D09, 0x00002D0A, 0x1000010C, 0x00002D0C, 0x00002D0D, 0x00002D0E, 0x00002D0F,
+    0x00003000, 0x00003101, 0x00003102, 0x00003103, 0x00003104, 0x00003105, 0x00003106, 0x00003107,
+    0x00003108, 0x00003109, 0x0000310A, 0x0000310B, 0x2000010D, 0x0000310D, 0x0000310E, 0x0000310F,
+    0x00003400, 0x00003501, 0x00003502, 0x00003503, 0x00003504, 0x00003505, 0x00003506, 0x00003507,
+    0x00003508, 0x00003509, 0x0000350A, 0x0000350B, 0x0000350C, 0x4000010E, 0x0000350E, 0x0000350F,
+    0x00003800, 0x00003901, 0x00003902, 0x00003903, 0x00003904, 0x00003905, 0x00003906, 0x00003907,
+    0x00003908, 0x00003909, 0x0000390A, 0x0000390B, 0x0000390C, 0x0000390D, 0x8000010F, 0x0000390F,
+    0x00003C00, 0x00003D01, 0x00003D02, 0x00003D03, 0x00003D04, 0x00003D05, 0x00003D06, 0x00003D07,
+    0x00003D08, 0x00003D09, 0x00003D0A, 0x00003D0B, 0x00003D0C, 0x00003D0D, 0x00003D0E, 0x00003D0F,
+    0x00000400, 0x00040102, 0x00000901, 0x00000D01, 0x00001101, 0x00001501, 0x00001901, 0x00001D01,
+    0x00002101, 0x00002501, 0x00002901, 0x00002D01, 0x00003101, 0x00003501, 0x00003901, 0x00003D01,
+    0x00040102, 0x00040502, 0x00000621, 0x00000631, 0x00000641, 0x00000651, 0x00000661, 0x00000671,
+    0x00000681, 0x00000691, 0x000006A1, 0x000006B1, 0x000006C1, 0x000006D1, 0x000006E1, 0x000006F1,
+    0x00000901, 0x00040902, 0x00080231, 0x00000A31, 0x00000A41, 0x00000A51, 0x00000A61, 0x00000A71,
+    0x00000A81, 0x00000A91, 0x00000AA1, 0x00000AB1, 0x00000AC1, 0x00000AD1, 0x00000AE1, 0x00000AF1,
+    0x00000D01, 0x00040D02, 0x00000E21, 0x00100241, 0x00000E41, 0x00000E51, 0x00000E61, 0x00000E71,
+    0x00000E81, 0x00000E91, 0x00000EA1, 0x00000EB1, 0x00000EC1, 0x00000ED1, 0x00000EE1, 0x00000EF1,
+    0x00001101, 0x00041102, 0x00001221, 0x00001231, 0x00200251, 0x00001251, 0x00001261, 0x00001271,
+    0x00001281, 0x00001291, 0x000012A1, 0x000012B1, 0x000012C1, 0x000012D1, 0x000012E1, 0x000012F1,
+    0x00001501, 0x00041502, 0x00001621, 0x00001631, 0x00001641, 0x00400261, 0x00001661, 0x00001671,
+    0x00001681, 0x00001691, 0x000016A1, 0x000016B1, 0x000016C1, 0x000016D1, 0x000016E1, 0x000016F1,
+    0x00001901, 0x00041902, 0x00001A21, 0x00001A31, 0x00001A41, 0x00001A51, 0x00800271, 0x00001A71,
+    0x00001A81, 0x00001A91, 0x00001AA1, 0x00001AB1, 0x00001AC1, 0x00001AD1, 0x00001AE1, 0x00001AF1,
+    0x00001D01, 0x00041D02, 0x00001E21, 0x00001E31, 0x00001E41, 0x00001E51, 0x00001E61, 0x01000281,
+    0x00001E81, 0x00001E91, 0x00001EA1, 0x00001EB1, 0x00001EC1, 0x00001ED1, 0x00001EE1, 0x00001EF1,
+    0x00002101, 0x00042102, 0x00002221, 0x00002231, 0x00002241, 0x00002251, 0x00002261, 0x00002271,
+    0x02000291, 0x00002291, 0x000022A1, 0x000022B1, 0x000022C1, 0x000022D1, 0x000022E1, 0x000022F1,
+    0x00002501, 0x00042502, 0x00002621, 0x00002631, 0x00002641, 0x00002651, 0x00002661, 0x00002671,
+    0x00002681, 0x040002A1, 0x000026A1, 0x000026B1, 0x000026C1, 0x000026D1, 0x000026E1, 0x000026F1,
+    0x00002901, 0x00042902, 0x00002A21, 0x00002A31, 0x00002A41, 0x00002A51, 0x00002A61, 0x00002A71,
+    0x00002A81, 0x00002A91, 0x080042B1, 0x00002AB1, 0x00002AC1, 0x00002AD1, 0x00002AE1, 0x00002AF1,
+    0x00002D01, 0x00042D02, 0x00002E21, 0x00002E31, 0x00002E41, 0x00002E51, 0x00002E61, 0x00002E71,
+    0x00002E81, 0x00002E91, 0x00002EA1, 0x100002C1, 0x00002EC1, 0x00002ED1, 0x00002EE1, 0x00002EF1,
+    0x00003101, 0x00043102, 0x00003221, 0x00003231, 0x00003241, 0x00003251, 0x00003261, 0x00003271,
+    0x00003281, 0x00003291, 0x000032A1, 0x000032B1, 0x200002D1, 0x000032D1, 0x000032E1, 0x000032F1,
+    0x00003501, 0x00043502, 0x00003621, 0x00003631, 0x00003641, 0x00003651, 0x00003661, 0x00003671,
+    0x00003681, 0x00003691, 0x000036A1, 0x000036B1, 0x000036C1, 0x400002E1, 0x000036E1, 0x000036F1,
+    0x00003901, 0x00043902, 0x00003A21, 0x00003A31, 0x00003A41, 0x00003A51, 0x00003A61, 0x00003A71,
+    0x00003A81, 0x00003A91, 0x00003AA1, 0x00003AB1, 0x00003AC1, 0x00003AD1, 0x800002F1, 0x00003AF1,
+    0x00003D01, 0x00043D02, 0x00003E21, 0x00003E31, 0x00003E41, 0x00003E51, 0x00003E61, 0x00003E71,
+    0x00003E81, 0x00003E91, 0x00003EA1, 0x00003EB1, 0x00003EC1, 0x00003ED1, 0x00003EE1, 0x00003EF1,
+    0x00000800, 0x00000502, 0x00080103, 0x00000D02, 0x00001102, 0x00001502, 0x00001902, 0x00001D02,
+    0x00002102, 0x00002502, 0x00002902, 0x00002D02, 0x00003102, 0x00003502, 0x00003902, 0x00003D02,
+    0x00000502, 0x00040222, 0x00080503, 0x00000632, 0x00000642, 0x00000652, 0x00000662, 0x00000672,
+    0x00000682, 0x00000692, 0x000006A2, 0x000006B2, 0x000006C2, 0x000006D2, 0x000006E2, 0x000006F2,
+    0x00080103, 0x00000A12, 0x00080903, 0x00000A32, 0x00000A42, 0x00000A52, 0x00000A62, 0x00000A72,
+    0x00000A82, 0x00000A92, 0x00000AA2, 0x00000AB2, 0x00000AC2, 0x00000AD2, 0x00000AE2, 0x00000AF2,
+    0x00000D02, 0x00000E12, 0x00080D03, 0x00100242, 0x00000E42, 0x00000E52, 0x00000E62, 0x00000E72,
+    0x00000E82, 0x00000E92, 0x00000EA2, 0x00000EB2, 0x00000EC2, 0x00000ED2, 0x00000EE2, 0x00000EF2,
+    0x00001102, 0x00001212, 0x00081103, 0x00001232, 0x00200252, 0x00001252, 0x00001262, 0x00001272,
+    0x00001282, 0x00001292, 0x000012A2, 0x000012B2, 0x000012C2, 0x000012D2, 0x000012E2, 0x000012F2,
+    0x00001502, 0x00001612, 0x00081503, 0x00001632, 0x00001642, 0x00400262, 0x00001662, 0x00001672,
+    0x00001682, 0x00001692, 0x000016A2, 0x000016B2, 0x000016C2, 0x000016D2, 0x000016E2, 0x000016F2,
+    0x00001902, 0x00001A12, 0x00081903, 0x00001A32, 0x00001A42, 0x00001A52, 0x00800272, 0x00001A72,
+    0x00001A82, 0x00001A92, 0x00001AA2, 0x00001AB2, 0x00001AC2, 0x00001AD2, 0x00001AE2, 0x00001AF2,
+    0x00001D02, 0x00001E12, 0x00081D03, 0x00001E32, 0x00001E42, 0x00001E52, 0x00001E62, 0x01000282,
+    0x00001E82, 0x00001E92, 0x00001EA2, 0x00001EB2, 0x00001EC2, 0x00001ED2, 0x00001EE2, 0x00001EF2,
+    0x00002102, 0x00002212, 0x00082103, 0x00002232, 0x00002242, 0x00002252, 0x00002262, 0x00002272,
+    0x02000292, 0x00002292, 0x000022A2, 0x000022B2, 0x000022C2, 0x000022D2, 0x000022E2, 0x000022F2,
+    0x00002502, 0x00002612, 0x00082503, 0x00002632, 0x00002642, 0x00002652, 0x00002662, 0x00002672,
+    0x00002682, 0x040002A2, 0x000026A2, 0x000026B2, 0x000026C2, 0x000026D2, 0x000026E2, 0x000026F2,
+    0x00002902, 0x00002A12, 0x00082903, 0x00002A32, 0x00002A42, 0x00002A52, 0x00002A62, 0x00002A72,
+    0x00002A82, 0x00002A92, 0x080042B2, 0x00002AB2, 0x00002AC2, 0x00002AD2, 0x00002AE2, 0x00002AF2,
+    0x00002D02, 0x00002E12, 0x00082D03, 0x00002E32, 0x00002E42, 0x00002E52, 0x00002E62, 0x00002E72,
+    0x00002E82, 0x00002E92, 0x00002EA2, 0x100002C2, 0x00002EC2, 0x00002ED2, 0x00002EE2, 0x00002EF2,
+    0x00003102, 0x00003212, 0x00083103, 0x00003232, 0x00003242, 0x00003252, 0x00003262, 0x00003272,
+    0x00003282, 0x00003292, 0x000032A2, 0x000032B2, 0x200002D2, 0x000032D2, 0x000032E2, 0x000032F2,
+    0x00003502, 0x00003612, 0x00083503, 0x00003632, 0x00003642, 0x00003652, 0x00003662, 0x00003672,
+    0x00003682, 0x00003692, 0x000036A2, 0x000036B2, 0x000036C2, 0x400002E2, 0x000036E2, 0x000036F2,
+    0x00003902, 0x00003A12, 0x00083903, 0x00003A32, 0x00003A42, 0x00003A52, 0x00003A62, 0x00003A72,
+    0x00003A82, 0x00003A92, 0x00003AA2, 0x00003AB2, 0x00003AC2, 0x00003AD2, 0x800002F2, 0x00003AF2,
+    0x00003D02, 0x00003E12, 0x00083D03, 0x00003E32, 0x00003E42, 0x00003E52, 0x00003E62, 0x00003E72,
+    0x00003E82, 0x00003E92, 0x00003EA2, 0x00003EB2, 0x00003EC2, 0x00003ED2, 0x00003EE2, 0x00003EF2,
+    0x00000C00, 0x00000503, 0x00000903, 0x00100104, 0x00001103, 0x00001503, 0x00001903, 0x00001D03,
+    0x00002103, 0x00002503, 0x00002903, 0x00002D03, 0x00003103, 0x00003503, 0x00003903, 0x00003D03,
+    0x00000503, 0x00040223, 0x00000623, 0x00100504, 0x00000643, 0x00000653, 0x00000663, 0x00000673,
+    0x00000683, 0x00000693, 0x000006A3, 0x000006B3, 0x000006C3, 0x000006D3, 0x000006E3, 0x000006F3,
+    0x00000903, 0x00000A13, 0x00080233, 0x00100904, 0x00000A43, 0x00000A53, 0x00000A63, 0x00000A73,
+    0x00000A83, 0x00000A93, 0x00000AA3, 0x00000AB3, 0x00000AC3, 0x00000AD3, 0x00000AE3, 0x00000AF3,
+    0x00100104, 0x00000E13, 0x00000E23, 0x00100D04, 0x00000E43, 0x00000E53, 0x00000E63, 0x00000E73,
+    0x00000E83, 0x00000E93, 0x00000EA3, 0x00000EB3, 0x00000EC3, 0x00000ED3, 0x00000EE3, 0x00000EF3,
+    0x00001103, 0x00001213, 0x00001223, 0x00101104, 0x00200253, 0x00001253, 0x00001263, 0x00001273,
+    0x00001283, 0x00001293, 0x000012A3, 0x000012B3, 0x000012C3, 0x000012D3, 0x000012E3, 0x000012F3,
+    0x00001503, 0x00001613, 0x00001623, 0x00101504, 0x00001643, 0x00400263, 0x00001663, 0x00001673,
+    0x00001683, 0x00001693, 0x000016A3, 0x000016B3, 0x000016C3, 0x000016D3, 0x000016E3, 0x000016F3,
+    0x00001903, 0x00001A13, 0x00001A23, 0x00101904, 0x00001A43, 0x00001A53, 0x00800273, 0x00001A73,
+    0x00001A83, 0x00001A93, 0x00001AA3, 0x00001AB3, 0x00001AC3, 0x00001AD3, 0x00001AE3, 0x00001AF3,
+    0x00001D03, 0x00001E13, 0x00001E23, 0x00101D04, 0x00001E43, 0x00001E53, 0x00001E63, 0x01000283,
+    0x00001E83, 0x00001E93, 0x00001EA3, 0x00001EB3, 0x00001EC3, 0x00001ED3, 0x00001EE3, 0x00001EF3,
+    0x00002103, 0x00002213, 0x00002223, 0x00102104, 0x00002243, 0x00002253, 0x00002263, 0x00002273,
+    0x02000293, 0x00002293, 0x000022A3, 0x000022B3, 0x000022C3, 0x000022D3, 0x000022E3, 0x000022F3,
+    0x00002503, 0x00002613, 0x00002623, 0x00102504, 0x00002643, 0x00002653, 0x00002663, 0x00002673,
+    0x00002683, 0x040002A3, 0x000026A3, 0x000026B3, 0x000026C3, 0x000026D3, 0x000026E3, 0x000026F3,
+    0x00002903, 0x00002A13, 0x00002A23, 0x00102904, 0x00002A43, 0x00002A53, 0x00002A63, 0x00002A73,
+    0x00002A83, 0x00002A93, 0x080042B3, 0x00002AB3, 0x00002AC3, 0x00002AD3, 0x00002AE3, 0x00002AF3,
+    0x00002D03, 0x00002E13, 0x00002E23, 0x00102D04, 0x00002E43, 0x00002E53, 0x00002E63, 0x00002E73,
+    0x00002E83, 0x00002E93, 0x00002EA3, 0x100002C3, 0x00002EC3, 0x00002ED3, 0x00002EE3, 0x00002EF3,
+    0x00003103, 0x00003213, 0x00003223, 0x00103104, 0x00003243, 0x00003253, 0x00003263, 0x00003273,
+    0x00003283, 0x00003293, 0x000032A3, 0x000032B3, 0x200002D3, 0x000032D3, 0x000032E3, 0x000032F3,
+    0x00003503, 0x00003613, 0x00003623, 0x00103504, 0x00003643, 0x00003653, 0x00003663, 0x00003673,
+    0x00003683, 0x00003693, 0x000036A3, 0x000036B3, 0x000036C3, 0x400002E3, 0x000036E3, 0x000036F3,
+    0x00003903, 0x00003A13, 0x00003A23, 0x00103904, 0x00003A43, 0x00003A53, 0x00003A63, 0x00003A73,
+    0x00003A83, 0x00003A93, 0x00003AA3, 0x00003AB3, 0x00003AC3, 0x00003AD3, 0x800002F3, 0x00003AF3,
+    0x00003D03, 0x00003E13, 0x00003E23, 0x00103D04, 0x00003E43, 0x00003E53, 0x00003E63, 0x00003E73,
+    0x00003E83, 0x00003E93, 0x00003EA3, 0x00003EB3, 0x00003EC3, 0x00003ED3, 0x00003EE3, 0x00003EF3,
+    0x00001000, 0x00000504, 0x00000904, 0x00000D04, 0x00200105, 0x00001504, 0x00001904, 0x00001D04,
+    0x00002104, 0x00002504, 0x00002904, 0x00002D04, 0x00003104, 0x00003504, 0x00003904, 0x00003D04,
+    0x00000504, 0x00040224, 0x00000624, 0x00000634, 0x00200505, 0x00000654, 0x00000664, 0x00000674,
+    0x00000684, 0x00000694, 0x000006A4, 0x000006B4, 0x000006C4, 0x000006D4, 0x000006E4, 0x000006F4,
+    0x00000904, 0x00000A14, 0x00080234, 0x00000A34, 0x00200905, 0x00000A54, 0x00000A64, 0x00000A74,
+    0x00000A84, 0x00000A94, 0x00000AA4, 0x00000AB4, 0x00000AC4, 0x00000AD4, 0x00000AE4, 0x00000AF4,
+    0x00000D04, 0x00000E14, 0x00000E24, 0x00100244, 0x00200D05, 0x00000E54, 0x00000E64, 0x00000E74,
+    0x00000E84, 0x00000E94, 0x00000EA4, 0x00000EB4, 0x00000EC4, 0x00000ED4, 0x00000EE4, 0x00000EF4,
+    0x00200105, 0x00001214, 0x00001224, 0x00001234, 0x00201105, 0x00001254, 0x00001264, 0x00001274,
+    0x00001284, 0x00001294, 0x000012A4, 0x000012B4, 0x000012C4, 0x000012D4, 0x000012E4, 0x000012F4,
+    0x00001504, 0x00001614, 0x00001624, 0x00001634, 0x00201505, 0x00400264, 0x00001664, 0x00001674,
+    0x00001684, 0x00001694, 0x000016A4, 0x000016B4, 0x000016C4, 0x000016D4, 0x000016E4, 0x000016F4,
+    0x00001904, 0x00001A14, 0x00001A24, 0x00001A34, 0x00201905, 0x00001A54, 0x00800274, 0x00001A74,
+    0x00001A84, 0x00001A94, 0x00001AA4, 0x00001AB4, 0x00001AC4, 0x00001AD4, 0x00001AE4, 0x00001AF4,
+    0x00001D04, 0x00001E14, 0x00001E24, 0x00001E34, 0x00201D05, 0x00001E54, 0x00001E64, 0x01000284,
+    0x00001E84, 0x00001E94, 0x00001EA4, 0x00001EB4, 0x00001EC4, 0x00001ED4, 0x00001EE4, 0x00001EF4,
+    0x00002104, 0x00002214, 0x00002224, 0x00002234, 0x00202105, 0x00002254, 0x00002264, 0x00002274,
+    0x02000294, 0x00002294, 0x000022A4, 0x000022B4, 0x000022C4, 0x000022D4, 0x000022E4, 0x000022F4,
+    0x00002504, 0x00002614, 0x00002624, 0x00002634, 0x00202505, 0x00002654, 0x00002664, 0x00002674,
+    0x00002684, 0x040002A4, 0x000026A4, 0x000026B4, 0x000026C4, 0x000026D4, 0x000026E4, 0x000026F4,
+    0x00002904, 0x00002A14, 0x00002A24, 0x00002A34, 0x00202905, 0x00002A54, 0x00002A64, 0x00002A74,
+    0x00002A84, 0x00002A94, 0x080042B4, 0x00002AB4, 0x00002AC4, 0x00002AD4, 0x00002AE4, 0x00002AF4,
+    0x00002D04, 0x00002E14, 0x00002E24, 0x00002E34, 0x00202D05, 0x00002E54, 0x00002E64, 0x00002E74,
+    0x00002E84, 0x00002E94, 0x00002EA4, 0x100002C4, 0x00002EC4, 0x00002ED4, 0x00002EE4, 0x00002EF4,
+    0x00003104, 0x00003214, 0x00003224, 0x00003234, 0x00203105, 0x00003254, 0x00003264, 0x00003274,
+    0x00003284, 0x00003294, 0x000032A4, 0x000032B4, 0x200002D4, 0x000032D4, 0x000032E4, 0x000032F4,
+    0x00003504, 0x00003614, 0x00003624, 0x00003634, 0x00203505, 0x00003654, 0x00003664, 0x00003674,
+    0x00003684, 0x00003694, 0x000036A4, 0x000036B4, 0x000036C4, 0x400002E4, 0x000036E4, 0x000036F4,
+    0x00003904, 0x00003A14, 0x00003A24, 0x00003A34, 0x00203905, 0x00003A54, 0x00003A64, 0x00003A74,
+    0x00003A84, 0x00003A94, 0x00003AA4, 0x00003AB4, 0x00003AC4, 0x00003AD4, 0x800002F4, 0x00003AF4,
+    0x00003D04, 0x00003E14, 0x00003E24, 0x00003E34, 0x00203D05, 0x00003E54, 0x00003E64, 0x00003E74,
+    0x00003E84, 0x00003E94, 0x00003EA4, 0x00003EB4, 0x00003EC4, 0x00003ED4, 0x00003EE4, 0x00003EF4,
+    0x00001400, 0x00000505, 0x00000905, 0x00000D05, 0x00001105, 0x00400106, 0x00001905, 0x00001D05,
+    0x00002105, 0x00002505, 0x00002905, 0x00002D05, 0x00003105, 0x00003505, 0x00003905, 0x00003D05,
+    0x00000505, 0x00040225, 0x00000625, 0x00000635, 0x00000645, 0x00400506, 0x00000665, 0x00000675,
+    0x00000685, 0x00000695, 0x000006A5, 0x000006B5, 0x000006C5, 0x000006D5, 0x000006E5, 0x000006F5,
+    0x00000905, 0x00000A15, 0x00080235, 0x00000A35, 0x00000A45, 0x00400906, 0x00000A65, 0x00000A75,
+    0x00000A85, 0x00000A95, 0x00000AA5, 0x00000AB5, 0x00000AC5, 0x00000AD5, 0x00000AE5, 0x00000AF5,
+    0x00000D05, 0x00000E15, 0x00000E25, 0x00100245, 0x00000E45, 0x00400D06, 0x00000E65, 0x00000E75,
+    0x00000E85, 0x00000E95, 0x00000EA5, 0x00000EB5, 0x00000EC5, 0x00000ED5, 0x00000EE5, 0x00000EF5,
+    0x00001105, 0x00001215, 0x00001225, 0x00001235, 0x00200255, 0x00401106, 0x00001265, 0x00001275,
+    0x00001285, 0x00001295, 0x000012A5, 0x000012B5, 0x000012C5, 0x000012D5, 0x000012E5, 0x000012F5,
+    0x00400106, 0x00001615, 0x00001625, 0x00001635, 0x00001645, 0x00401506, 0x00001665, 0x00001675,
+    0x00001685, 0x00001695, 0x000016A5, 0x000016B5, 0x000016C5, 0x000016D5, 0x000016E5, 0x000016F5,
+    0x00001905, 0x00001A15, 0x00001A25, 0x00001A35, 0x00001A45, 0x00401906, 0x00800275, 0x00001A75,
+    0x00001A85, 0x00001A95, 0x00001AA5, 0x00001AB5, 0x00001AC5, 0x00001AD5, 0x00001AE5, 0x00001AF5,
+    0x00001D05, 0x00001E15, 0x00001E25, 0x00001E35, 0x00001E45, 0x00401D06, 0x00001E65, 0x01000285,
+    0x00001E85, 0x00001E95, 0x00001EA5, 0x00001EB5, 0x00001EC5, 0x00001ED5, 0x00001EE5, 0x00001EF5,
+    0x00002105, 0x00002215, 0x00002225, 0x00002235, 0x00002245, 0x00402106, 0x00002265, 0x00002275,
+    0x02000295, 0x00002295, 0x000022A5, 0x000022B5, 0x000022C5, 0x000022D5, 0x000022E5, 0x000022F5,
+    0x00002505, 0x00002615, 0x00002625, 0x00002635, 0x00002645, 0x00402506, 0x00002665, 0x00002675,
+    0x00002685, 0x040002A5, 0x000026A5, 0x000026B5, 0x000026C5, 0x000026D5, 0x000026E5, 0x000026F5,
+    0x00002905, 0x00002A15, 0x00002A25, 0x00002A35, 0x00002A45, 0x00402906, 0x00002A65, 0x00002A75,
+    0x00002A85, 0x00002A95, 0x080042B5, 0x00002AB5, 0x00002AC5, 0x00002AD5, 0x00002AE5, 0x00002AF5,
+    0x00002D05, 0x00002E15, 0x00002E25, 0x00002E35, 0x00002E45, 0x00402D06, 0x00002E65, 0x00002E75,
+    0x00002E85, 0x00002E95, 0x00002EA5, 0x100002C5, 0x00002EC5, 0x00002ED5, 0x00002EE5, 0x00002EF5,
+    0x00003105, 0x00003215, 0x00003225, 0x00003235, 0x00003245, 0x00403106, 0x00003265, 0x00003275,
+    0x00003285, 0x00003295, 0x000032A5, 0x000032B5, 0x200002D5, 0x000032D5, 0x000032E5, 0x000032F5,
+    0x00003505, 0x00003615, 0x00003625, 0x00003635, 0x00003645, 0x00403506, 0x00003665, 0x00003675,
+    0x00003685, 0x00003695, 0x000036A5, 0x000036B5, 0x000036C5, 0x400002E5, 0x000036E5, 0x000036F5,
+    0x00003905, 0x00003A15, 0x00003A25, 0x00003A35, 0x00003A45, 0x00403906, 0x00003A65, 0x00003A75,
+    0x00003A85, 0x00003A95, 0x00003AA5, 0x00003AB5, 0x00003AC5, 0x00003AD5, 0x800002F5, 0x00003AF5,
+    0x00003D05, 0x00003E15, 0x00003E25, 0x00003E35, 0x00003E45, 0x00403D06, 0x00003E65, 0x00003E75,
+    0x00003E85, 0x00003E95, 0x00003EA5, 0x00003EB5, 0x00003EC5, 0x00003ED5, 0x00003EE5, 0x00003EF5,
+    0x00001800, 0x00000506, 0x00000906, 0x00000D06, 0x00001106, 0x00001506, 0x00800107, 0x00001D06,
+    0x00002106, 0x00002506, 0x00002906, 0x00002D06, 0x00003106, 0x00003506, 0x00003906, 0x00003D06,
+    0x00000506, 0x00040226, 0x00000626, 0x00000636, 0x00000646, 0x00000656, 0x00800507, 0x00000676,
+    0x00000686, 0x00000696, 0x000006A6, 0x000006B6, 0x000006C6, 0x000006D6, 0x000006E6, 0x000006F6,
+    0x00000906, 0x00000A16, 0x00080236, 0x00000A36, 0x00000A46, 0x00000A56, 0x00800907, 0x00000A76,
+    0x00000A86, 0x00000A96, 0x00000AA6, 0x00000AB6, 0x00000AC6, 0x00000AD6, 0x00000AE6, 0x00000AF6,
+    0x00000D06, 0x00000E16, 0x00000E26, 0x00100246, 0x00000E46, 0x00000E56, 0x00800D07, 0x00000E76,
+    0x00000E86, 0x00000E96, 0x00000EA6, 0x00000EB6, 0x00000EC6, 0x00000ED6, 0x00000EE6, 0x00000EF6,
+    0x00001106, 0x00001216, 0x00001226, 0x00001236, 0x00200256, 0x00001256, 0x00801107, 0x00001276,
+    0x00001286, 0x00001296, 0x000012A6, 0x000012B6, 0x000012C6, 0x000012D6, 0x000012E6, 0x000012F6,
+    0x00001506, 0x00001616, 0x00001626, 0x00001636, 0x00001646, 0x00400266, 0x00801507, 0x00001676,
+    0x00001686, 0x00001696, 0x000016A6, 0x000016B6, 0x000016C6, 0x000016D6, 0x000016E6, 0x000016F6,
+    0x00800107, 0x00001A16, 0x00001A26, 0x00001A36, 0x00001A46, 0x00001A56, 0x00801907, 0x00001A76,
+    0x00001A86, 0x00001A96, 0x00001AA6, 0x00001AB6, 0x00001AC6, 0x00001AD6, 0x00001AE6, 0x00001AF6,
+    0x00001D06, 0x00001E16, 0x00001E26, 0x00001E36, 0x00001E46, 0x00001E56, 0x00801D07, 0x01000286,
+    0x00001E86, 0x00001E96, 0x00001EA6, 0x00001EB6, 0x00001EC6, 0x00001ED6, 0x00001EE6, 0x00001EF6,
+    0x00002106, 0x00002216, 0x00002226, 0x00002236, 0x00002246, 0x00002256, 0x00802107, 0x00002276,
+    0x02000296, 0x00002296, 0x000022A6, 0x000022B6, 0x000022C6, 0x000022D6, 0x000022E6, 0x000022F6,
+    0x00002506, 0x00002616, 0x00002626, 0x00002636, 0x00002646, 0x00002656, 0x00802507, 0x00002676,
+    0x00002686, 0x040002A6, 0x000026A6, 0x000026B6, 0x000026C6, 0x000026D6, 0x000026E6, 0x000026F6,
+    0x00002906, 0x00002A16, 0x00002A26, 0x00002A36, 0x00002A46, 0x00002A56, 0x00802907, 0x00002A76,
+    0x00002A86, 0x00002A96, 0x080042B6, 0x00002AB6, 0x00002AC6, 0x00002AD6, 0x00002AE6, 0x00002AF6,
+    0x00002D06, 0x00002E16, 0x00002E26, 0x00002E36, 0x00002E46, 0x00002E56, 0x00802D07, 0x00002E76,
+    0x00002E86, 0x00002E96, 0x00002EA6, 0x100002C6, 0x00002EC6, 0x00002ED6, 0x00002EE6, 0x00002EF6,
+    0x00003106, 0x00003216, 0x00003226, 0x00003236, 0x00003246, 0x00003256, 0x00803107, 0x00003276,
+    0x00003286, 0x00003296, 0x000032A6, 0x000032B6, 0x200002D6, 0x000032D6, 0x000032E6, 0x000032F6,
+    0x00003506, 0x00003616, 0x00003626, 0x00003636, 0x00003646, 0x00003656, 0x00803507, 0x00003676,
+    0x00003686, 0x00003696, 0x000036A6, 0x000036B6, 0x000036C6, 0x400002E6, 0x000036E6, 0x000036F6,
+    0x00003906, 0x00003A16, 0x00003A26, 0x00003A36, 0x00003A46, 0x00003A56, 0x00803907, 0x00003A76,
+    0x00003A86, 0x00003A96, 0x00003AA6, 0x00003AB6, 0x00003AC6, 0x00003AD6, 0x800002F6, 0x00003AF6,
+    0x00003D06, 0x00003E16, 0x00003E26, 0x00003E36, 0x00003E46, 0x00003E56, 0x00803D07, 0x00003E76,
+    0x00003E86, 0x00003E96, 0x00003EA6, 0x00003EB6, 0x00003EC6, 0x00003ED6, 0x00003EE6, 0x00003EF6,
+    0x00001C00, 0x00000507, 0x00000907, 0x00000D07, 0x00001107, 0x00001507, 0x00001907, 0x01000108,
+    0x00002107, 0x00002507, 0x00002907, 0x00002D07, 0x00003107, 0x00003507, 0x00003907, 0x00003D07,
+    0x00000507, 0x00040227, 0x00000627, 0x00000637, 0x00000647, 0x00000657, 0x00000667, 0x01000508,
+    0x00000687, 0x00000697, 0x000006A7, 0x000006B7, 0x000006C7, 0x000006D7, 0x000006E7, 0x000006F7,
+    0x00000907, 0x00000A17, 0x00080237, 0x00000A37, 0x00000A47, 0x00000A57, 0x00000A67, 0x01000908,
+    0x00000A87, 0x00000A97, 0x00000AA7, 0x00000AB7, 0x00000AC7, 0x00000AD7, 0x00000AE7, 0x00000AF7,
+    0x00000D07, 0x00000E17, 0x00000E27, 0x00100247, 0x00000E47, 0x00000E57, 0x00000E67, 0x01000D08,
+    0x00000E87, 0x00000E97, 0x00000EA7, 0x00000EB7, 0x00000EC7, 0x00000ED7, 0x00000EE7, 0x00000EF7,
+    0x00001107, 0x00001217, 0x00001227, 0x00001237, 0x00200257, 0x00001257, 0x00001267, 0x01001108,
+    0x00001287, 0x00001297, 0x000012A7, 0x000012B7, 0x000012C7, 0x000012D7, 0x000012E7, 0x000012F7,
+    0x00001507, 0x00001617, 0x00001627, 0x00001637, 0x00001647, 0x00400267, 0x00001667, 0x01001508,
+    0x00001687, 0x00001697, 0x000016A7, 0x000016B7, 0x000016C7, 0x000016D7, 0x000016E7, 0x000016F7,
+    0x00001907, 0x00001A17, 0x00001A27, 0x00001A37, 0x00001A47, 0x00001A57, 0x00800277, 0x01001908,
+    0x00001A87, 0x00001A97, 0x00001AA7, 0x00001AB7, 0x00001AC7, 0x00001AD7, 0x00001AE7, 0x00001AF7,
+    0x01000108, 0x00001E17, 0x00001E27, 0x00001E37, 0x00001E47, 0x00001E57, 0x00001E67, 0x01001D08,
+    0x00001E87, 0x00001E97, 0x00001EA7, 0x00001EB7, 0x00001EC7, 0x00001ED7, 0x00001EE7, 0x00001EF7,
+    0x00002107, 0x00002217, 0x00002227, 0x00002237, 0x00002247, 0x00002257, 0x00002267, 0x01002108,
+    0x02000297, 0x00002297, 0x000022A7, 0x000022B7, 0x000022C7, 0x000022D7, 0x000022E7, 0x000022F7,
+    0x00002507, 0x00002617, 0x00002627, 0x00002637, 0x00002647, 0x00002657, 0x00002667, 0x01002508,
+    0x00002687, 0x040002A7, 0x000026A7, 0x000026B7, 0x000026C7, 0x000026D7, 0x000026E7, 0x000026F7,
+    0x00002907, 0x00002A17, 0x00002A27, 0x00002A37, 0x00002A47, 0x00002A57, 0x00002A67, 0x01002908,
+    0x00002A87, 0x00002A97, 0x080042B7, 0x00002AB7, 0x00002AC7, 0x00002AD7, 0x00002AE7, 0x00002AF7,
+    0x00002D07, 0x00002E17, 0x00002E27, 0x00002E37, 0x00002E47, 0x00002E57, 0x00002E67, 0x01002D08,
+    0x00002E87, 0x00002E97, 0x00002EA7, 0x100002C7, 0x00002EC7, 0x00002ED7, 0x00002EE7, 0x00002EF7,
+    0x00003107, 0x00003217, 0x00003227, 0x00003237, 0x00003247, 0x00003257, 0x00003267, 0x01003108,
+    0x00003287, 0x00003297, 0x000032A7, 0x000032B7, 0x200002D7, 0x000032D7, 0x000032E7, 0x000032F7,
+    0x00003507, 0x00003617, 0x00003627, 0x00003637, 0x00003647, 0x00003657, 0x00003667, 0x01003508,
+    0x00003687, 0x00003697, 0x000036A7, 0x000036B7, 0x000036C7, 0x400002E7, 0x000036E7, 0x000036F7,
+    0x00003907, 0x00003A17, 0x00003A27, 0x00003A37, 0x00003A47, 0x00003A57, 0x00003A67, 0x01003908,
+    0x00003A87, 0x00003A97, 0x00003AA7, 0x00003AB7, 0x00003AC7, 0x00003AD7, 0x800002F7, 0x00003AF7,
+    0x00003D07, 0x00003E17, 0x00003E27, 0x00003E37, 0x00003E47, 0x00003E57, 0x00003E67, 0x01003D08,
+    0x00003E87, 0x00003E97, 0x00003EA7, 0x00003EB7, 0x00003EC7, 0x00003ED7, 0x00003EE7, 0x00003EF7,
+    0x00002000, 0x00000508, 0x00000908, 0x00000D08, 0x00001108, 0x00001508, 0x00001908, 0x00001D08,
+    0x02000109, 0x00002508, 0x00002908, 0x00002D08, 0x00003108, 0x00003508, 0x00003908, 0x00003D08,
+    0x00000508, 0x00040228, 0x00000628, 0x00000638, 0x00000648, 0x00000658, 0x00000668, 0x00000678,
+    0x02000509, 0x00000698, 0x000006A8, 0x000006B8, 0x000006C8, 0x000006D8, 0x000006E8, 0x000006F8,
+    0x00000908, 0x00000A18, 0x00080238, 0x00000A38, 0x00000A48, 0x00000A58, 0x00000A68, 0x00000A78,
+    0x02000909, 0x00000A98, 0x00000AA8, 0x00000AB8, 0x00000AC8, 0x00000AD8, 0x00000AE8, 0x00000AF8,
+    0x00000D08, 0x00000E18, 0x00000E28, 0x00100248, 0x00000E48, 0x00000E58, 0x00000E68, 0x00000E78,
+    0x02000D09, 0x00000E98, 0x00000EA8, 0x00000EB8, 0x00000EC8, 0x00000ED8, 0x00000EE8, 0x00000EF8,
+    0x00001108, 0x00001218, 0x00001228, 0x00001238, 0x00200258, 0x00001258, 0x00001268, 0x00001278,
+    0x02001109, 0x00001298, 0x000012A8, 0x000012B8, 0x000012C8, 0x000012D8, 0x000012E8, 0x000012F8,
+    0x00001508, 0x00001618, 0x00001628, 0x00001638, 0x00001648, 0x00400268, 0x00001668, 0x00001678,
+    0x02001509, 0x00001698, 0x000016A8, 0x000016B8, 0x000016C8, 0x000016D8, 0x000016E8, 0x000016F8,
+    0x00001908, 0x00001A18, 0x00001A28, 0x00001A38, 0x00001A48, 0x00001A58, 0x00800278, 0x00001A78,
+    0x02001909, 0x00001A98, 0x00001AA8, 0x00001AB8, 0x00001AC8, 0x00001AD8, 0x00001AE8, 0x00001AF8,
+    0x00001D08, 0x00001E18, 0x00001E28, 0x00001E38, 0x00001E48, 0x00001E58, 0x00001E68, 0x01000288,
+    0x02001D09, 0x00001E98, 0x00001EA8, 0x00001EB8, 0x00001EC8, 0x00001ED8, 0x00001EE8, 0x00001EF8,
+    0x02000109, 0x00002218, 0x00002228, 0x00002238, 0x00002248, 0x00002258, 0x00002268, 0x00002278,
+    0x02002109, 0x00002298, 0x000022A8, 0x000022B8, 0x000022C8, 0x000022D8, 0x000022E8, 0x000022F8,
+    0x00002508, 0x00002618, 0x00002628, 0x00002638, 0x00002648, 0x00002658, 0x00002668, 0x00002678,
+    0x02002509, 0x040002A8, 0x000026A8, 0x000026B8, 0x000026C8, 0x000026D8, 0x000026E8, 0x000026F8,
+    0x00002908, 0x00002A18, 0x00002A28, 0x00002A38, 0x00002A48, 0x00002A58, 0x00002A68, 0x00002A78,
+    0x02002909, 0x00002A98, 0x080042B8, 0x00002AB8, 0x00002AC8, 0x00002AD8, 0x00002AE8, 0x00002AF8,
+    0x00002D08, 0x00002E18, 0x00002E28, 0x00002E38, 0x00002E48, 0x00002E58, 0x00002E68, 0x00002E78,
+    0x02002D09, 0x00002E98, 0x00002EA8, 0x100002C8, 0x00002EC8, 0x00002ED8, 0x00002EE8, 0x00002EF8,
+    0x00003108, 0x00003218, 0x00003228, 0x00003238, 0x00003248, 0x00003258, 0x00003268, 0x00003278,
+    0x02003109, 0x00003298, 0x000032A8, 0x000032B8, 0x200002D8, 0x000032D8, 0x000032E8, 0x000032F8,
+    0x00003508, 0x00003618, 0x00003628, 0x00003638, 0x00003648, 0x00003658, 0x00003668, 0x00003678,
+    0x02003509, 0x00003698, 0x000036A8, 0x000036B8, 0x000036C8, 0x400002E8, 0x000036E8, 0x000036F8,
+    0x00003908, 0x00003A18, 0x00003A28, 0x00003A38, 0x00003A48, 0x00003A58, 0x00003A68, 0x00003A78,
+    0x02003909, 0x00003A98, 0x00003AA8, 0x00003AB8, 0x00003AC8, 0x00003AD8, 0x800002F8, 0x00003AF8,
+    0x00003D08, 0x00003E18, 0x00003E28, 0x00003E38, 0x00003E48, 0x00003E58, 0x00003E68, 0x00003E78,
+    0x02003D09, 0x00003E98, 0x00003EA8, 0x00003EB8, 0x00003EC8, 0x00003ED8, 0x00003EE8, 0x00003EF8,
+    0x00002400, 0x00000509, 0x00000909, 0x00000D09, 0x00001109, 0x00001509, 0x00001909, 0x00001D09,
+    0x00002109, 0x0400010A, 0x00002909, 0x00002D09, 0x00003109, 0x00003509, 0x00003909, 0x00003D09,
+    0x00000509, 0x00040229, 0x00000629, 0x00000639, 0x00000649, 0x00000659, 0x00000669, 0x00000679,
+    0x00000689, 0x0400050A, 0x000006A9, 0x000006B9, 0x000006C9, 0x000006D9, 0x000006E9, 0x000006F9,
+    0x00000909, 0x00000A19, 0x00080239, 0x00000A39, 0x00000A49, 0x00000A59, 0x00000A69, 0x00000A79,
+    0x00000A89, 0x0400090A, 0x00000AA9, 0x00000AB9, 0x00000AC9, 0x00000AD9, 0x00000AE9, 0x00000AF9,
+    0x00000D09, 0x00000E19, 0x00000E29, 0x00100249, 0x00000E49, 0x00000E59, 0x00000E69, 0x00000E79,
+    0x00000E89, 0x04000D0A, 0x00000EA9, 0x00000EB9, 0x00000EC9, 0x00000ED9, 0x00000EE9, 0x00000EF9,
+    0x00001109, 0x00001219, 0x00001229, 0x00001239, 0x00200259, 0x00001259, 0x00001269, 0x00001279,
+    0x00001289, 0x0400110A, 0x000012A9, 0x000012B9, 0x000012C9, 0x000012D9, 0x000012E9, 0x000012F9,
+    0x00001509, 0x00001619, 0x00001629, 0x00001639, 0x00001649, 0x00400269, 0x00001669, 0x00001679,
+    0x00001689, 0x0400150A, 0x000016A9, 0x000016B9, 0x000016C9, 0x000016D9, 0x000016E9, 0x000016F9,
+    0x00001909, 0x00001A19, 0x00001A29, 0x00001A39, 0x00001A49, 0x00001A59, 0x00800279, 0x00001A79,
+    0x00001A89, 0x0400190A, 0x00001AA9, 0x00001AB9, 0x00001AC9, 0x00001AD9, 0x00001AE9, 0x00001AF9,
+    0x00001D09, 0x00001E19, 0x00001E29, 0x00001E39, 0x00001E49, 0x00001E59, 0x00001E69, 0x01000289,
+    0x00001E89, 0x04001D0A, 0x00001EA9, 0x00001EB9, 0x00001EC9, 0x00001ED9, 0x00001EE9, 0x00001EF9,
+    0x00002109, 0x00002219, 0x00002229, 0x00002239, 0x00002249, 0x00002259, 0x00002269, 0x00002279,
+    0x02000299, 0x0400210A, 0x000022A9, 0x000022B9, 0x000022C9, 0x000022D9, 0x000022E9, 0x000022F9,
+    0x0400010A, 0x00002619, 0x00002629, 0x00002639, 0x00002649, 0x00002659, 0x00002669, 0x00002679,
+    0x00002689, 0x0400250A, 0x000026A9, 0x000026B9, 0x000026C9, 0x000026D9, 0x000026E9, 0x000026F9,
+    0x00002909, 0x00002A19, 0x00002A29, 0x00002A39, 0x00002A49, 0x00002A59, 0x00002A69, 0x00002A79,
+    0x00002A89, 0x0400290A, 0x080042B9, 0x00002AB9, 0x00002AC9, 0x00002AD9, 0x00002AE9, 0x00002AF9,
+    0x00002D09, 0x00002E19, 0x00002E29, 0x00002E39, 0x00002E49, 0x00002E59, 0x00002E69, 0x00002E79,
+    0x00002E89, 0x04002D0A, 0x00002EA9, 0x100002C9, 0x00002EC9, 0x00002ED9, 0x00002EE9, 0x00002EF9,
+    0x00003109, 0x00003219, 0x00003229, 0x00003239, 0x00003249, 0x00003259, 0x00003269, 0x00003279,
+    0x00003289, 0x0400310A, 0x000032A9, 0x000032B9, 0x200002D9, 0x000032D9, 0x000032E9, 0x000032F9,
+    0x00003509, 0x00003619, 0x00003629, 0x00003639, 0x00003649, 0x00003659, 0x00003669, 0x00003679,
+    0x00003689, 0x0400350A, 0x000036A9, 0x000036B9, 0x000036C9, 0x400002E9, 0x000036E9, 0x000036F9,
+    0x00003909, 0x00003A19, 0x00003A29, 0x00003A39, 0x00003A49, 0x00003A59, 0x00003A69, 0x00003A79,
+    0x00003A89, 0x0400390A, 0x00003AA9, 0x00003AB9, 0x00003AC9, 0x00003AD9, 0x800002F9, 0x00003AF9,
+    0x00003D09, 0x00003E19, 0x00003E29, 0x00003E39, 0x00003E49, 0x00003E59, 0x00003E69, 0x00003E79,
+    0x00003E89, 0x04003D0A, 0x00003EA9, 0x00003EB9, 0x00003EC9, 0x00003ED9, 0x00003EE9, 0x00003EF9,
+    0x00002800, 0x0000050A, 0x0000090A, 0x00000D0A, 0x0000110A, 0x0000150A, 0x0000190A, 0x00001D0A,
+    0x0000210A, 0x0000250A, 0x0800410B, 0x00002D0A, 0x0000310A, 0x0000350A, 0x0000390A, 0x00003D0A,
+    0x0000050A, 0x0004022A, 0x0000062A, 0x0000063A, 0x0000064A, 0x0000065A, 0x0000066A, 0x0000067A,
+    0x0000068A, 0x0000069A, 0x0800450B, 0x000006BA, 0x000006CA, 0x000006DA, 0x000006EA, 0x000006FA,
+    0x0000090A, 0x00000A1A, 0x0008023A, 0x00000A3A, 0x00000A4A, 0x00000A5A, 0x00000A6A, 0x00000A7A,
+    0x00000A8A, 0x00000A9A, 0x0800490B, 0x00000ABA, 0x00000ACA, 0x00000ADA, 0x00000AEA, 0x00000AFA,
+    0x00000D0A, 0x00000E1A, 0x00000E2A, 0x0010024A, 0x00000E4A, 0x00000E5A, 0x00000E6A, 0x00000E7A,
+    0x00000E8A, 0x00000E9A, 0x08004D0B, 0x00000EBA, 0x00000ECA, 0x00000EDA, 0x00000EEA, 0x00000EFA,
+    0x0000110A, 0x0000121A, 0x0000122A, 0x0000123A, 0x0020025A, 0x0000125A, 0x0000126A, 0x0000127A,
+    0x0000128A, 0x0000129A, 0x0800510B, 0x000012BA, 0x000012CA, 0x000012DA, 0x000012EA, 0x000012FA,
+    0x0000150A, 0x0000161A, 0x0000162A, 0x0000163A, 0x0000164A, 0x0040026A, 0x0000166A, 0x0000167A,
+    0x0000168A, 0x0000169A, 0x0800550B, 0x000016BA, 0x000016CA, 0x000016DA, 0x000016EA, 0x000016FA,
+    0x0000190A, 0x00001A1A, 0x00001A2A, 0x00001A3A, 0x00001A4A, 0x00001A5A, 0x0080027A, 0x00001A7A,
+    0x00001A8A, 0x00001A9A, 0x0800590B, 0x00001ABA, 0x00001ACA, 0x00001ADA, 0x00001AEA, 0x00001AFA,
+    0x00001D0A, 0x00001E1A, 0x00001E2A, 0x00001E3A, 0x00001E4A, 0x00001E5A, 0x00001E6A, 0x0100028A,
+    0x00001E8A, 0x00001E9A, 0x08005D0B, 0x00001EBA, 0x00001ECA, 0x00001EDA, 0x00001EEA, 0x00001EFA,
+    0x0000210A, 0x0000221A, 0x0000222A, 0x0000223A, 0x0000224A, 0x0000225A, 0x0000226A, 0x0000227A,
+    0x0200029A, 0x0000229A, 0x0800610B, 0x000022BA, 0x000022CA, 0x000022DA, 0x000022EA, 0x000022FA,
+    0x0000250A, 0x0000261A, 0x0000262A, 0x0000263A, 0x0000264A, 0x0000265A, 0x0000266A, 0x0000267A,
+    0x0000268A, 0x040002AA, 0x0800650B, 0x000026BA, 0x000026CA, 0x000026DA, 0x000026EA, 0x000026FA,
+    0x0800410B, 0x00002A1A, 0x00002A2A, 0x00002A3A, 0x00002A4A, 0x00002A5A, 0x00002A6A, 0x00002A7A,
+    0x00002A8A, 0x00002A9A, 0x0800690B, 0x00002ABA, 0x00002ACA, 0x00002ADA, 0x00002AEA, 0x00002AFA,
+    0x00002D0A, 0x00002E1A, 0x00002E2A, 0x00002E3A, 0x00002E4A, 0x00002E5A, 0x00002E6A, 0x00002E7A,
+    0x00002E8A, 0x00002E9A, 0x08006D0B, 0x100002CA, 0x00002ECA, 0x00002EDA, 0x00002EEA, 0x00002EFA,
+    0x0000310A, 0x0000321A, 0x0000322A, 0x0000323A, 0x0000324A, 0x0000325A, 0x0000326A, 0x0000327A,
+    0x0000328A, 0x0000329A, 0x0800710B, 0x000032BA, 0x200002DA, 0x000032DA, 0x000032EA, 0x000032FA,
+    0x0000350A, 0x0000361A, 0x0000362A, 0x0000363A, 0x0000364A, 0x0000365A, 0x0000366A, 0x0000367A,
+    0x0000368A, 0x0000369A, 0x0800750B, 0x000036BA, 0x000036CA, 0x400002EA, 0x000036EA, 0x000036FA,
+    0x0000390A, 0x00003A1A, 0x00003A2A, 0x00003A3A, 0x00003A4A, 0x00003A5A, 0x00003A6A, 0x00003A7A,
+    0x00003A8A, 0x00003A9A, 0x0800790B, 0x00003ABA, 0x00003ACA, 0x00003ADA, 0x800002FA, 0x00003AFA,
+    0x00003D0A, 0x00003E1A, 0x00003E2A, 0x00003E3A, 0x00003E4A, 0x00003E5A, 0x00003E6A, 0x00003E7A,
+    0x00003E8A, 0x00003E9A, 0x08007D0B, 0x00003EBA, 0x00003ECA, 0x00003EDA, 0x00003EEA, 0x00003EFA,
+    0x00002C00, 0x0000050B, 0x0000090B, 0x00000D0B, 0x0000110B, 0x0000150B, 0x0000190B, 0x00001D0B,
+    0x0000210B, 0x0000250B, 0x0000290B, 0x1000010C, 0x0000310B, 0x0000350B, 0x0000390B, 0x00003D0B,
+    0x0000050B, 0x0004022B, 0x0000062B, 0x0000063B, 0x0000064B, 0x0000065B, 0x0000066B, 0x0000067B,
+    0x0000068B, 0x0000069B, 0x000006AB, 0x1000050C, 0x000006CB, 0x000006DB, 0x000006EB, 0x000006FB,
+    0x0000090B, 0x00000A1B, 0x0008023B, 0x00000A3B, 0x00000A4B, 0x00000A5B, 0x00000A6B, 0x00000A7B,
+    0x00000A8B, 0x00000A9B, 0x00000AAB, 0x1000090C, 0x00000ACB, 0x00000ADB, 0x00000AEB, 0x00000AFB,
+    0x00000D0B, 0x00000E1B, 0x00000E2B, 0x0010024B, 0x00000E4B, 0x00000E5B, 0x00000E6B, 0x00000E7B,
+    0x00000E8B, 0x00000E9B, 0x00000EAB, 0x10000D0C, 0x00000ECB, 0x00000EDB, 0x00000EEB, 0x00000EFB,
+    0x0000110B, 0x0000121B, 0x0000122B, 0x0000123B, 0x0020025B, 0x0000125B, 0x0000126B, 0x0000127B,
+    0x0000128B, 0x0000129B, 0x000012AB, 0x1000110C, 0x000012CB, 0x000012DB, 0x000012EB, 0x000012FB,
+    0x0000150B, 0x0000161B, 0x0000162B, 0x0000163B, 0x0000164B, 0x0040026B, 0x0000166B, 0x0000167B,
+    0x0000168B, 0x0000169B, 0x000016AB, 0x1000150C, 0x000016CB, 0x000016DB, 0x000016EB, 0x000016FB,
+    0x0000190B, 0x00001A1B, 0x00001A2B, 0x00001A3B, 0x00001A4B, 0x00001A5B, 0x0080027B, 0x00001A7B,
+    0x00001A8B, 0x00001A9B, 0x00001AAB, 0x1000190C, 0x00001ACB, 0x00001ADB, 0x00001AEB, 0x00001AFB,
+    0x00001D0B, 0x00001E1B, 0x00001E2B, 0x00001E3B, 0x00001E4B, 0x00001E5B, 0x00001E6B, 0x0100028B,
+    0x00001E8B, 0x00001E9B, 0x00001EAB, 0x10001D0C, 0x00001ECB, 0x00001EDB, 0x00001EEB, 0x00001EFB,
+    0x0000210B, 0x0000221B, 0x0000222B, 0x0000223B, 0x0000224B, 0x0000225B, 0x0000226B, 0x0000227B,
+    0x0200029B, 0x0000229B, 0x000022AB, 0x1000210C, 0x000022CB, 0x000022DB, 0x000022EB, 0x000022FB,
+    0x0000250B, 0x0000261B, 0x0000262B, 0x0000263B, 0x0000264B, 0x0000265B, 0x0000266B, 0x0000267B,
+    0x0000268B, 0x040002AB, 0x000026AB, 0x1000250C, 0x000026CB, 0x000026DB, 0x000026EB, 0x000026FB,
+    0x0000290B, 0x00002A1B, 0x00002A2B, 0x00002A3B, 0x00002A4B, 0x00002A5B, 0x00002A6B, 0x00002A7B,
+    0x00002A8B, 0x00002A9B, 0x080042BB, 0x1000290C, 0x00002ACB, 0x00002ADB, 0x00002AEB, 0x00002AFB,
+    0x1000010C, 0x00002E1B, 0x00002E2B, 0x00002E3B, 0x00002E4B, 0x00002E5B, 0x00002E6B, 0x00002E7B,
+    0x00002E8B, 0x00002E9B, 0x00002EAB, 0x10002D0C, 0x00002ECB, 0x00002EDB, 0x00002EEB, 0x00002EFB,
+    0x0000310B, 0x0000321B, 0x0000322B, 0x0000323B, 0x0000324B, 0x0000325B, 0x0000326B, 0x0000327B,
+    0x0000328B, 0x0000329B, 0x000032AB, 0x1000310C, 0x200002DB, 0x000032DB, 0x000032EB, 0x000032FB,
+    0x0000350B, 0x0000361B, 0x0000362B, 0x0000363B, 0x0000364B, 0x0000365B, 0x0000366B, 0x0000367B,
+    0x0000368B, 0x0000369B, 0x000036AB, 0x1000350C, 0x000036CB, 0x400002EB, 0x000036EB, 0x000036FB,
+    0x0000390B, 0x00003A1B, 0x00003A2B, 0x00003A3B, 0x00003A4B, 0x00003A5B, 0x00003A6B, 0x00003A7B,
+    0x00003A8B, 0x00003A9B, 0x00003AAB, 0x1000390C, 0x00003ACB, 0x00003ADB, 0x800002FB, 0x00003AFB,
+    0x00003D0B, 0x00003E1B, 0x00003E2B, 0x00003E3B, 0x00003E4B, 0x00003E5B, 0x00003E6B, 0x00003E7B,
+    0x00003E8B, 0x00003E9B, 0x00003EAB, 0x10003D0C, 0x00003ECB, 0x00003EDB, 0x00003EEB, 0x00003EFB,
+    0x00003000, 0x0000050C, 0x0000090C, 0x00000D0C, 0x0000110C, 0x0000150C, 0x0000190C, 0x00001D0C,
+    0x0000210C, 0x0000250C, 0x0000290C, 0x00002D0C, 0x2000010D, 0x0000350C, 0x0000390C, 0x00003D0C,
+    0x0000050C, 0x0004022C, 0x0000062C, 0x0000063C, 0x0000064C, 0x0000065C, 0x0000066C, 0x0000067C,
+    0x0000068C, 0x0000069C, 0x000006AC, 0x000006BC, 0x2000050D, 0x000006DC, 0x000006EC, 0x000006FC,
+    0x0000090C, 0x00000A1C, 0x0008023C, 0x00000A3C, 0x00000A4C, 0x00000A5C, 0x00000A6C, 0x00000A7C,
+    0x00000A8C, 0x00000A9C, 0x00000AAC, 0x00000ABC, 0x2000090D, 0x00000ADC, 0x00000AEC, 0x00000AFC,
+    0x00000D0C, 0x00000E1C, 0x00000E2C, 0x0010024C, 0x00000E4C, 0x00000E5C, 0x00000E6C, 0x00000E7C,
+    0x00000E8C, 0x00000E9C, 0x00000EAC, 0x00000EBC, 0x20000D0D, 0x00000EDC, 0x00000EEC, 0x00000EFC,
+    0x0000110C, 0x0000121C, 0x0000122C, 0x0000123C, 0x0020025C, 0x0000125C, 0x0000126C, 0x0000127C,
+    0x0000128C, 0x0000129C, 0x000012AC, 0x000012BC, 0x2000110D, 0x000012DC, 0x000012EC, 0x000012FC,
+    0x0000150C, 0x0000161C, 0x0000162C, 0x0000163C, 0x0000164C, 0x0040026C, 0x0000166C, 0x0000167C,
+    0x0000168C, 0x0000169C, 0x000016AC, 0x000016BC, 0x2000150D, 0x000016DC, 0x000016EC, 0x000016FC,
+    0x0000190C, 0x00001A1C, 0x00001A2C, 0x00001A3C, 0x00001A4C, 0x00001A5C, 0x0080027C, 0x00001A7C,
+    0x00001A8C, 0x00001A9C, 0x00001AAC, 0x00001ABC, 0x2000190D, 0x00001ADC, 0x00001AEC, 0x00001AFC,
+    0x00001D0C, 0x00001E1C, 0x00001E2C, 0x00001E3C, 0x00001E4C, 0x00001E5C, 0x00001E6C, 0x0100028C,
+    0x00001E8C, 0x00001E9C, 0x00001EAC, 0x00001EBC, 0x20001D0D, 0x00001EDC, 0x00001EEC, 0x00001EFC,
+    0x0000210C, 0x0000221C, 0x0000222C, 0x0000223C, 0x0000224C, 0x0000225C, 0x0000226C, 0x0000227C,
+    0x0200029C, 0x0000229C, 0x000022AC, 0x000022BC, 0x2000210D, 0x000022DC, 0x000022EC, 0x000022FC,
+    0x0000250C, 0x0000261C, 0x0000262C, 0x0000263C, 0x0000264C, 0x0000265C, 0x0000266C, 0x0000267C,
+    0x0000268C, 0x040002AC, 0x000026AC, 0x000026BC, 0x2000250D, 0x000026DC, 0x000026EC, 0x000026FC,
+    0x0000290C, 0x00002A1C, 0x00002A2C, 0x00002A3C, 0x00002A4C, 0x00002A5C, 0x00002A6C, 0x00002A7C,
+    0x00002A8C, 0x00002A9C, 0x080042BC, 0x00002ABC, 0x2000290D, 0x00002ADC, 0x00002AEC, 0x00002AFC,
+    0x00002D0C, 0x00002E1C, 0x00002E2C, 0x00002E3C, 0x00002E4C, 0x00002E5C, 0x00002E6C, 0x00002E7C,
+    0x00002E8C, 0x00002E9C, 0x00002EAC, 0x100002CC, 0x20002D0D, 0x00002EDC, 0x00002EEC, 0x00002EFC,
+    0x2000010D, 0x0000321C, 0x0000322C, 0x0000323C, 0x0000324C, 0x0000325C, 0x0000326C, 0x0000327C,
+    0x0000328C, 0x0000329C, 0x000032AC, 0x000032BC, 0x2000310D, 0x000032DC, 0x000032EC, 0x000032FC,
+    0x0000350C, 0x0000361C, 0x0000362C, 0x0000363C, 0x0000364C, 0x0000365C, 0x0000366C, 0x0000367C,
+    0x0000368C, 0x0000369C, 0x000036AC, 0x000036BC, 0x2000350D, 0x400002EC, 0x000036EC, 0x000036FC,
+    0x0000390C, 0x00003A1C, 0x00003A2C, 0x00003A3C, 0x00003A4C, 0x00003A5C, 0x00003A6C, 0x00003A7C,
+    0x00003A8C, 0x00003A9C, 0x00003AAC, 0x00003ABC, 0x2000390D, 0x00003ADC, 0x800002FC, 0x00003AFC,
+    0x00003D0C, 0x00003E1C, 0x00003E2C, 0x00003E3C, 0x00003E4C, 0x00003E5C, 0x00003E6C, 0x00003E7C,
+    0x00003E8C, 0x00003E9C, 0x00003EAC, 0x00003EBC, 0x20003D0D, 0x00003EDC, 0x00003EEC, 0x00003EFC,
+    0x00003400, 0x0000050D, 0x0000090D, 0x00000D0D, 0x0000110D, 0x0000150D, 0x0000190D, 0x00001D0D,
+    0x0000210D, 0x0000250D, 0x0000290D, 0x00002D0D, 0x0000310D, 0x4000010E, 0x0000390D, 0x00003D0D,
+    0x0000050D, 0x0004022D, 0x0000062D, 0x0000063D, 0x0000064D, 0x0000065D, 0x0000066D, 0x0000067D,
+    0x0000068D, 0x0000069D, 0x000006AD, 0x000006BD, 0x000006CD, 0x4000050E, 0x000006ED, 0x000006FD,
+    0x0000090D, 0x00000A1D, 0x0008023D, 0x00000A3D, 0x00000A4D, 0x00000A5D, 0x00000A6D, 0x00000A7D,
+    0x00000A8D, 0x00000A9D, 0x00000AAD, 0x00000ABD, 0x00000ACD, 0x4000090E, 0x00000AED, 0x00000AFD,
+    0x00000D0D, 0x00000E1D, 0x00000E2D, 0x0010024D, 0x00000E4D, 0x00000E5D, 0x00000E6D, 0x00000E7D,
+    0x00000E8D, 0x00000E9D, 0x00000EAD, 0x00000EBD, 0x00000ECD, 0x40000D0E, 0x00000EED, 0x00000EFD,
+    0x0000110D, 0x0000121D, 0x0000122D, 0x0000123D, 0x0020025D, 0x0000125D, 0x0000126D, 0x0000127D,
+    0x0000128D, 0x0000129D, 0x000012AD, 0x000012BD, 0x000012CD, 0x4000110E, 0x000012ED, 0x000012FD,
+    0x0000150D, 0x0000161D, 0x0000162D, 0x0000163D, 0x0000164D, 0x0040026D, 0x0000166D, 0x0000167D,
+    0x0000168D, 0x0000169D, 0x000016AD, 0x000016BD, 0x000016CD, 0x4000150E, 0x000016ED, 0x000016FD,
+    0x0000190D, 0x00001A1D, 0x00001A2D, 0x00001A3D, 0x00001A4D, 0x00001A5D, 0x0080027D, 0x00001A7D,
+    0x00001A8D, 0x00001A9D, 0x00001AAD, 0x00001ABD, 0x00001ACD, 0x4000190E, 0x00001AED, 0x00001AFD,
+    0x00001D0D, 0x00001E1D, 0x00001E2D, 0x00001E3D, 0x00001E4D, 0x00001E5D, 0x00001E6D, 0x0100028D,
+    0x00001E8D, 0x00001E9D, 0x00001EAD, 0x00001EBD, 0x00001ECD, 0x40001D0E, 0x00001EED, 0x00001EFD,
+    0x0000210D, 0x0000221D, 0x0000222D, 0x0000223D, 0x0000224D, 0x0000225D, 0x0000226D, 0x0000227D,
+    0x0200029D, 0x0000229D, 0x000022AD, 0x000022BD, 0x000022CD, 0x4000210E, 0x000022ED, 0x000022FD,
+    0x0000250D, 0x0000261D, 0x0000262D, 0x0000263D, 0x0000264D, 0x0000265D, 0x0000266D, 0x0000267D,
+    0x0000268D, 0x040002AD, 0x000026AD, 0x000026BD, 0x000026CD, 0x4000250E, 0x000026ED, 0x000026FD,
+    0x0000290D, 0x00002A1D, 0x00002A2D, 0x00002A3D, 0x00002A4D, 0x00002A5D, 0x00002A6D, 0x00002A7D,
+    0x00002A8D, 0x00002A9D, 0x080042BD, 0x00002ABD, 0x00002ACD, 0x4000290E, 0x00002AED, 0x00002AFD,
+    0x00002D0D, 0x00002E1D, 0x00002E2D, 0x00002E3D, 0x00002E4D, 0x00002E5D, 0x00002E6D, 0x00002E7D,
+    0x00002E8D, 0x00002E9D, 0x00002EAD, 0x100002CD, 0x00002ECD, 0x40002D0E, 0x00002EED, 0x00002EFD,
+    0x0000310D, 0x0000321D, 0x0000322D, 0x0000323D, 0x0000324D, 0x0000325D, 0x0000326D, 0x0000327D,
+    0x0000328D, 0x0000329D, 0x000032AD, 0x000032BD, 0x200002DD, 0x4000310E, 0x000032ED, 0x000032FD,
+    0x4000010E, 0x0000361D, 0x0000362D, 0x0000363D, 0x0000364D, 0x0000365D, 0x0000366D, 0x0000367D,
+    0x0000368D, 0x0000369D, 0x000036AD, 0x000036BD, 0x000036CD, 0x4000350E, 0x000036ED, 0x000036FD,
+    0x0000390D, 0x00003A1D, 0x00003A2D, 0x00003A3D, 0x00003A4D, 0x00003A5D, 0x00003A6D, 0x00003A7D,
+    0x00003A8D, 0x00003A9D, 0x00003AAD, 0x00003ABD, 0x00003ACD, 0x4000390E, 0x800002FD, 0x00003AFD,
+    0x00003D0D, 0x00003E1D, 0x00003E2D, 0x00003E3D, 0x00003E4D, 0x00003E5D, 0x00003E6D, 0x00003E7D,
+    0x00003E8D, 0x00003E9D, 0x00003EAD, 0x00003EBD, 0x00003ECD, 0x40003D0E, 0x00003EED, 0x00003EFD,
+    0x00003800, 0x0000050E, 0x0000090E, 0x00000D0E, 0x0000110E, 0x0000150E, 0x0000190E, 0x00001D0E,
+    0x0000210E, 0x0000250E, 0x0000290E, 0x00002D0E, 0x0000310E, 0x0000350E, 0x8000010F, 0x00003D0E,
+    0x0000050E, 0x0004022E, 0x0000062E, 0x0000063E, 0x0000064E, 0x0000065E, 0x0000066E, 0x0000067E,
+    0x0000068E, 0x0000069E, 0x000006AE, 0x000006BE, 0x000006CE, 0x000006DE, 0x8000050F, 0x000006FE,
+    0x0000090E, 0x00000A1E, 0x0008023E, 0x00000A3E, 0x00000A4E, 0x00000A5E, 0x00000A6E, 0x00000A7E,
+    0x00000A8E, 0x00000A9E, 0x00000AAE, 0x00000ABE, 0x00000ACE, 0x00000ADE, 0x8000090F, 0x00000AFE,
+    0x00000D0E, 0x00000E1E, 0x00000E2E, 0x0010024E, 0x00000E4E, 0x00000E5E, 0x00000E6E, 0x00000E7E,
+    0x00000E8E, 0x00000E9E, 0x00000EAE, 0x00000EBE, 0x00000ECE, 0x00000EDE, 0x80000D0F, 0x00000EFE,
+    0x0000110E, 0x0000121E, 0x0000122E, 0x0000123E, 0x0020025E, 0x0000125E, 0x0000126E, 0x0000127E,
+    0x0000128E, 0x0000129E, 0x000012AE, 0x000012BE, 0x000012CE, 0x000012DE, 0x8000110F, 0x000012FE,
+    0x0000150E, 0x0000161E, 0x0000162E, 0x0000163E, 0x0000164E, 0x0040026E, 0x0000166E, 0x0000167E,
+    0x0000168E, 0x0000169E, 0x000016AE, 0x000016BE, 0x000016CE, 0x000016DE, 0x8000150F, 0x000016FE,
+    0x0000190E, 0x00001A1E, 0x00001A2E, 0x00001A3E, 0x00001A4E, 0x00001A5E, 0x0080027E, 0x00001A7E,
+    0x00001A8E, 0x00001A9E, 0x00001AAE, 0x00001ABE, 0x00001ACE, 0x00001ADE, 0x8000190F, 0x00001AFE,
+    0x00001D0E, 0x00001E1E, 0x00001E2E, 0x00001E3E, 0x00001E4E, 0x00001E5E, 0x00001E6E, 0x0100028E,
+    0x00001E8E, 0x00001E9E, 0x00001EAE, 0x00001EBE, 0x00001ECE, 0x00001EDE, 0x80001D0F, 0x00001EFE,
+    0x0000210E, 0x0000221E, 0x0000222E, 0x0000223E, 0x0000224E, 0x0000225E, 0x0000226E, 0x0000227E,
+    0x0200029E, 0x0000229E, 0x000022AE, 0x000022BE, 0x000022CE, 0x000022DE, 0x8000210F, 0x000022FE,
+    0x0000250E, 0x0000261E, 0x0000262E, 0x0000263E, 0x0000264E, 0x0000265E, 0x0000266E, 0x0000267E,
+    0x0000268E, 0x040002AE, 0x000026AE, 0x000026BE, 0x000026CE, 0x000026DE, 0x8000250F, 0x000026FE,
+    0x0000290E, 0x00002A1E, 0x00002A2E, 0x00002A3E, 0x00002A4E, 0x00002A5E, 0x00002A6E, 0x00002A7E,
+    0x00002A8E, 0x00002A9E, 0x080042BE, 0x00002ABE, 0x00002ACE, 0x00002ADE, 0x8000290F, 0x00002AFE,
+    0x00002D0E, 0x00002E1E, 0x00002E2E, 0x00002E3E, 0x00002E4E, 0x00002E5E, 0x00002E6E, 0x00002E7E,
+    0x00002E8E, 0x00002E9E, 0x00002EAE, 0x100002CE, 0x00002ECE, 0x00002EDE, 0x80002D0F, 0x00002EFE,
+    0x0000310E, 0x0000321E, 0x0000322E, 0x0000323E, 0x0000324E, 0x0000325E, 0x0000326E, 0x0000327E,
+    0x0000328E, 0x0000329E, 0x000032AE, 0x000032BE, 0x200002DE, 0x000032DE, 0x8000310F, 0x000032FE,
+    0x0000350E, 0x0000361E, 0x0000362E, 0x0000363E, 0x0000364E, 0x0000365E, 0x0000366E, 0x0000367E,
+    0x0000368E, 0x0000369E, 0x000036AE, 0x000036BE, 0x000036CE, 0x400002EE, 0x8000350F, 0x000036FE,
+    0x8000010F, 0x00003A1E, 0x00003A2E, 0x00003A3E, 0x00003A4E, 0x00003A5E, 0x00003A6E, 0x00003A7E,
+    0x00003A8E, 0x00003A9E, 0x00003AAE, 0x00003ABE, 0x00003ACE, 0x00003ADE, 0x8000390F, 0x00003AFE,
+    0x00003D0E, 0x00003E1E, 0x00003E2E, 0x00003E3E, 0x00003E4E, 0x00003E5E, 0x00003E6E, 0x00003E7E,
+    0x00003E8E, 0x00003E9E, 0x00003EAE, 0x00003EBE, 0x00003ECE, 0x00003EDE, 0x80003D0F, 0x00003EFE,
+    0x00003C00, 0x0000050F, 0x0000090F, 0x00000D0F, 0x0000110F, 0x0000150F, 0x0000190F, 0x00001D0F,
+    0x0000210F, 0x0000250F, 0x0000290F, 0x00002D0F, 0x0000310F, 0x0000350F, 0x0000390F, 0x00003D0F,
+    0x0000050F, 0x0004022F, 0x0000062F, 0x0000063F, 0x0000064F, 0x0000065F, 0x0000066F, 0x0000067F,
+    0x0000068F, 0x0000069F, 0x000006AF, 0x000006BF, 0x000006CF, 0x000006DF, 0x000006EF, 0x000006FF,
+    0x0000090F, 0x00000A1F, 0x0008023F, 0x00000A3F, 0x00000A4F, 0x00000A5F, 0x00000A6F, 0x00000A7F,
+    0x00000A8F, 0x00000A9F, 0x00000AAF, 0x00000ABF, 0x00000ACF, 0x00000ADF, 0x00000AEF, 0x00000AFF,
+    0x00000D0F, 0x00000E1F, 0x00000E2F, 0x0010024F, 0x00000E4F, 0x00000E5F, 0x00000E6F, 0x00000E7F,
+    0x00000E8F, 0x00000E9F, 0x00000EAF, 0x00000EBF, 0x00000ECF, 0x00000EDF, 0x00000EEF, 0x00000EFF,
+    0x0000110F, 0x0000121F, 0x0000122F, 0x0000123F, 0x0020025F, 0x0000125F, 0x0000126F, 0x0000127F,
+    0x0000128F, 0x0000129F, 0x000012AF, 0x000012BF, 0x000012CF, 0x000012DF, 0x000012EF, 0x000012FF,
+    0x0000150F, 0x0000161F, 0x0000162F, 0x0000163F, 0x0000164F, 0x0040026F, 0x0000166F, 0x0000167F,
+    0x0000168F, 0x0000169F, 0x000016AF, 0x000016BF, 0x000016CF, 0x000016DF, 0x000016EF, 0x000016FF,
+    0x0000190F, 0x00001A1F, 0x00001A2F, 0x00001A3F, 0x00001A4F, 0x00001A5F, 0x0080027F, 0x00001A7F,
+    0x00001A8F, 0x00001A9F, 0x00001AAF, 0x00001ABF, 0x00001ACF, 0x00001ADF, 0x00001AEF, 0x00001AFF,
+    0x00001D0F, 0x00001E1F, 0x00001E2F, 0x00001E3F, 0x00001E4F, 0x00001E5F, 0x00001E6F, 0x0100028F,
+    0x00001E8F, 0x00001E9F, 0x00001EAF, 0x00001EBF, 0x00001ECF, 0x00001EDF, 0x00001EEF, 0x00001EFF,
+    0x0000210F, 0x0000221F, 0x0000222F, 0x0000223F, 0x0000224F, 0x0000225F, 0x0000226F, 0x0000227F,
+    0x0200029F, 0x0000229F, 0x000022AF, 0x000022BF, 0x000022CF, 0x000022DF, 0x000022EF, 0x000022FF,
+    0x0000250F, 0x0000261F, 0x0000262F, 0x0000263F, 0x0000264F, 0x0000265F, 0x0000266F, 0x0000267F,
+    0x0000268F, 0x040002AF, 0x000026AF, 0x000026BF, 0x000026CF, 0x000026DF, 0x000026EF, 0x000026FF,
+    0x0000290F, 0x00002A1F, 0x00002A2F, 0x00002A3F, 0x00002A4F, 0x00002A5F, 0x00002A6F, 0x00002A7F,
+    0x00002A8F, 0x00002A9F, 0x080042BF, 0x00002ABF, 0x00002ACF, 0x00002ADF, 0x00002AEF, 0x00002AFF,
+    0x00002D0F, 0x00002E1F, 0x00002E2F, 0x00002E3F, 0x00002E4F, 0x00002E5F, 0x00002E6F, 0x00002E7F,
+    0x00002E8F, 0x00002E9F, 0x00002EAF, 0x100002CF, 0x00002ECF, 0x00002EDF, 0x00002EEF, 0x00002EFF,
+    0x0000310F, 0x0000321F, 0x0000322F, 0x0000323F, 0x0000324F, 0x0000325F, 0x0000326F, 0x0000327F,
+    0x0000328F, 0x0000329F, 0x000032AF, 0x000032BF, 0x200002DF, 0x000032DF, 0x000032EF, 0x000032FF,
+    0x0000350F, 0x0000361F, 0x0000362F, 0x0000363F, 0x0000364F, 0x0000365F, 0x0000366F, 0x0000367F,
+    0x0000368F, 0x0000369F, 0x000036AF, 0x000036BF, 0x000036CF, 0x400002EF, 0x000036EF, 0x000036FF,
+    0x0000390F, 0x00003A1F, 0x00003A2F, 0x00003A3F, 0x00003A4F, 0x00003A5F, 0x00003A6F, 0x00003A7F,
+    0x00003A8F, 0x00003A9F, 0x00003AAF, 0x00003ABF, 0x00003ACF, 0x00003ADF, 0x800002FF, 0x00003AFF,
+    0x00003D0F, 0x00003E1F, 0x00003E2F, 0x00003E3F, 0x00003E4F, 0x00003E5F, 0x00003E6F, 0x00003E7F,
+    0x00003E8F, 0x00003E9F, 0x00003EAF, 0x00003EBF, 0x00003ECF, 0x00003EDF, 0x00003EEF, 0x00003EFF,
+};
@@ -0,0 +1,38 @@
+/* 2048_tables.h */
+#ifndef G2048_TABLES_H
+#define G2048_TABLES_H
+
+#include <stdint.h>
+
+/************************************************************
+ * 2048 TABLES
+ * Precomputed into flash by tools/gen_2048_tables.py, run by
+ * hand: 2048_tables.c is committed, not built. The uVision
+ * project cannot run the script (MDK ships no Python). After
+ * a change, `gen_2048_tables.py --check 2048_tables.c` and
+ * tools/bench_2048_move.c, which checks every entry, catch a
+ * stale file.
+ *
+ * Row tables: every row of tile exponents (cell 0 in the low
+ * nibble) slid towards cell 0. Four cells: 256 KB, three
+ * cells: 16 KB. Wider rows would need 4 MB and up.
+ *
+ * Pair table (16 KB), for wider rows: two cells slid at a time,
+ * after the tile left open by the cells before them.
+ ************************************************************/
+
+#define ROW_RESULT(e)   ((uint16_t)(e))                 /* Row after the move */
+#define ROW_SCORE(e)    ((((e) >> 16) & 0x7FFFu) * 4u)  /* Score gained */
+#define ROW_WON(e)      ((int)((e) >> 31))              /* Made a 2048 tile */
+
+extern const uint32_t row_left_table[65536];    /* 4 cells */
+#define PAIR_TILES(e)   ((e) & 0xFFu)                   /* Tiles finished */
+#define PAIR_COUNT(e)   (((e) >> 8) & 0x3u)             /* How many */
+#define PAIR_OPEN(e)    (((e) >> 10) & 0xFu)            /* Tile that may still merge */
+#define PAIR_WON(e)     ((int)((e) >> 14) & 1)          /* Made a 2048 tile */
+#define PAIR_SCORE(e)   ((e) >> 16)                     /* Score gained */
+
+extern const uint32_t row_left_table3[4096];    /* 3 cells */
+extern const uint32_t slide_pair_table[4096];   /* [open << 8 | two cells] */
+
+#endif
@@ -54,6 +54,10 @@ Purpose     : Display controller configuration
 #include "GUI.h"
 #include "GUIDRV_FlexColor.h"
 #include "LCD_X.h"
+#ifndef WIN32
+#include "stm32f4xx_hal.h"
+#include "cmsis_os2.h"
+#endif
 
 /*********************************************************************
 *
@@ -106,6 +110,22 @@ Purpose     : Display controller configuration
 #define TOUCH_Y_MIN 0x0F40
 #define TOUCH_Y_MAX 0x00A0
 
+//
+// Bulk pixel transfer (16-bit IF): DMA2 memory-to-memory into the
+// FSMC data address. LCD /CS is NE4, RS is A0 -> data at +2.
+//
+#define LCD_DATA_ADDR      (0x6C000000UL + 2)
+#define LCD_DMA_MIN_WORDS  64           // Shorter runs are cheaper on the CPU
+#define LCD_DMA_MAX_WORDS  0xFFFF       // NDTR limit, longer runs are chained
+#define LCD_DMA_FLAG       0x00000001U  // Event flag: no transfer running
+
+//
+// SPI bursts: pixels are byte-swapped into a chunk and sent with one
+// LCD_X_WriteM() call each, chip select low for the whole run. The
+// SPI driver moves every chunk by DMA when enabled in RTE_Device.h.
+//
+#define LCD_SPI_CHUNK      64           // Pixels per LCD_X_WriteM() call
+
 /*********************************************************************
 *
 *       Configuration checking
@@ -245,9 +265,38 @@ U16 LCD_X_Read1_16(void) {
 *       LCD_X_WriteM1_16
 *
 * Purpose:
-*   Write multiple bytes to controller, with A0 = 1
+*   Write multiple bytes to controller, with A0 = 1.
+*   One start byte, then the pixels in chunks of LCD_SPI_CHUNK.
 */
 void LCD_X_WriteM1_16(U16 * pData, int NumWords) {
+  U8  data[LCD_SPI_CHUNK * 2];
+  int n, i;
+
+  LCD_X_ClrCS();
+  data[0] = 0x72;               // Start + WR Data
+  LCD_X_WriteM(data, 1);
+  while (NumWords) {
+    n = (NumWords > LCD_SPI_CHUNK) ? LCD_SPI_CHUNK : NumWords;
+    for (i = 0; i < n; i++) {
+      data[2 * i]     = (U8)(*pData >> 8);
+      data[2 * i + 1] = (U8)(*pData);
+      pData++;
+    }
+    LCD_X_WriteM(data, n * 2);
+    NumWords -= n;
+  }
+  LCD_X_SetCS();
+}
+
+/*********************************************************************
+*
+*       _WriteM1_16_PerPixel
+*
+* Purpose:
+*   The former bulk write, one 2-byte transfer per pixel. Kept as the
+*   reference for LCD_X_Benchmark().
+*/
+static void _WriteM1_16_PerPixel(U16 * pData, int NumWords) {
   U8 data[2];
 
   LCD_X_ClrCS();
@@ -267,29 +316,214 @@ void LCD_X_WriteM1_16(U16 * pData, int NumWords) {
 *       LCD_X_ReadM1_16
 *
 * Purpose:
-*   Read multiple bytes from controller, with A0 = 1
+*   Read multiple bytes from controller, with A0 = 1.
+*   NumWords is 1 + 3 per pixel: one dummy byte, then 3 bytes for
+*   each pixel, read in one burst. Each pixel gives 3 words.
 */
 void LCD_X_ReadM1_16(U16 * pData, int NumWords) {
-  U8  data[4];
+  U8  data[1 + LCD_SPI_CHUNK * 3];
   U32 v;
+  int NumPixels, n, i;
 
-  if (NumWords != 4) return;
+  if ((NumWords < 4) || ((NumWords - 1) % 3)) return;
+  NumPixels = (NumWords - 1) / 3;
 
   LCD_X_ClrCS();
   data[0] = 0x73;               // Start + RD Data
   LCD_X_WriteM(data, 1);
-  LCD_X_ReadM (data, 4);
-  v = (data[1] << 16) |
-      (data[2] <<  8) |
-       data[3];
-  *pData++ = (v & 0x03F000) >> 10;
-  *pData++ = (v & 0xFC0000) >> 16;
-  *pData++ = (v & 0x000FC0) >>  4;    
+  LCD_X_ReadM (data, 1);        // Dummy
+  while (NumPixels) {
+    n = (NumPixels > LCD_SPI_CHUNK) ? LCD_SPI_CHUNK : NumPixels;
+    LCD_X_ReadM(data, n * 3);
+    for (i = 0; i < n; i++) {
+      v = (data[3 * i]     << 16) |
+          (data[3 * i + 1] <<  8) |
+           data[3 * i + 2];
+      *pData++ = (v & 0x03F000) >> 10;
+      *pData++ = (v & 0xFC0000) >> 16;
+      *pData++ = (v & 0x000FC0) >>  4;
+    }
+    NumPixels -= n;
+  }
   LCD_X_SetCS();
 }
 
 #endif
 
+/*********************************************************************
+*
+*       DMA bulk transfer (16-bit IF)
+*
+**********************************************************************
+*/
+#if !defined(RTE_Graphics_LCD_MCBQVGA_LG_SPI) && !defined(WIN32)
+
+static DMA_HandleTypeDef _hDMA;
+static volatile int      _DMA_Busy;
+static const U16       * _pDMA_Next;      // Rest of a transfer longer than NDTR allows
+static volatile int      _DMA_Left;
+static osEventFlagsId_t  _DMA_Idle;       // LCD_DMA_FLAG, waiters sleep on it
+static void           (* _pfDMA_Done)(void * p);
+static void            * _pDMA_Done;
+
+static void _DMA_StartChunk(void) {
+  int n = (_DMA_Left > LCD_DMA_MAX_WORDS) ? LCD_DMA_MAX_WORDS : _DMA_Left;
+
+  HAL_DMA_Start_IT(&_hDMA, (U32)_pDMA_Next, LCD_DATA_ADDR, (U32)n);
+  _pDMA_Next += n;
+  _DMA_Left  -= n;
+}
+
+static void _DMA_XferCplt(DMA_HandleTypeDef * hdma) {
+  (void)hdma;
+  if (_DMA_Left) {
+    _DMA_StartChunk();
+    return;
+  }
+  _DMA_Busy = 0;
+  if (_pfDMA_Done) {
+    _pfDMA_Done(_pDMA_Done);
+  }
+  if (_DMA_Idle) {
+    osEventFlagsSet(_DMA_Idle, LCD_DMA_FLAG);
+  }
+}
+
+void DMA2_Stream0_IRQHandler(void) {
+  HAL_DMA_IRQHandler(&_hDMA);
+}
+
+static void _DMA_Init(void) {
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  _hDMA.Instance                 = DMA2_Stream0;
+  _hDMA.Init.Channel             = DMA_CHANNEL_0;
+  _hDMA.Init.Direction           = DMA_MEMORY_TO_MEMORY;
+  _hDMA.Init.PeriphInc           = DMA_PINC_ENABLE;          // Source: pixel buffer
+  _hDMA.Init.MemInc              = DMA_MINC_DISABLE;         // Destination: LCD data register
+  _hDMA.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  _hDMA.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
+  _hDMA.Init.Mode                = DMA_NORMAL;
+  _hDMA.Init.Priority            = DMA_PRIORITY_HIGH;
+  _hDMA.Init.FIFOMode            = DMA_FIFOMODE_ENABLE;      // Required for memory-to-memory
+  _hDMA.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+  _hDMA.Init.MemBurst            = DMA_MBURST_SINGLE;
+  _hDMA.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+  HAL_DMA_Init(&_hDMA);
+  _hDMA.XferCpltCallback = _DMA_XferCplt;
+
+  HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+
+  if (_DMA_Idle == NULL) {
+    _DMA_Idle = osEventFlagsNew(NULL);
+  }
+  if (_DMA_Idle) {
+    osEventFlagsSet(_DMA_Idle, LCD_DMA_FLAG);
+  }
+}
+
+/*********************************************************************
+*
+*       LCD_X_WaitM1_16
+*
+* Purpose:
+*   Blocks until a running DMA transfer has finished. Every waiting
+*   thread sleeps on the event flag, whichever thread started the
+*   transfer, and all of them wake when it ends. Before the kernel
+*   runs there is nothing else to run, so it polls.
+*/
+void LCD_X_WaitM1_16(void) {
+  while (_DMA_Busy) {
+    if ((osKernelGetState() == osKernelRunning) && (_DMA_Idle != NULL)) {
+      osEventFlagsWait(_DMA_Idle, LCD_DMA_FLAG, osFlagsWaitAny | osFlagsNoClear, osWaitForever);
+    }
+  }
+}
+
+/*********************************************************************
+*
+*       LCD_X_WriteM1_16_Async
+*
+* Purpose:
+*   Streams NumWords pixels to the controller, with A0 = 1, and returns
+*   at once. pfDone (may be NULL) is called from the DMA interrupt when
+*   the last word is out. The buffer must stay untouched until then and
+*   must not be in CCM RAM (not reachable by DMA).
+*   Returns 0 if the DMA took the transfer, 1 if it was done on the CPU.
+*/
+int LCD_X_WriteM1_16_Async(const U16 * pData, int NumWords, void (* pfDone)(void * p), void * p) {
+  LCD_X_WaitM1_16();
+  if ((NumWords < LCD_DMA_MIN_WORDS) || (((U32)pData & 0xFFFF0000UL) == 0x10000000UL)) {
+    LCD_X_WriteM1_16((U16 *)pData, NumWords);
+    if (pfDone) {
+      pfDone(p);
+    }
+    return 1;
+  }
+  _pfDMA_Done = pfDone;
+  _pDMA_Done  = p;
+  _pDMA_Next  = pData;
+  _DMA_Left   = NumWords;
+  if (_DMA_Idle) {
+    osEventFlagsClear(_DMA_Idle, LCD_DMA_FLAG);
+  }
+  _DMA_Busy   = 1;
+  _DMA_StartChunk();
+  return 0;
+}
+
+/*********************************************************************
+*
+*       Port hooks for emWin
+*
+* The bulk write is synchronous by design: emWin reuses the buffer it
+* passes (memory device lines, bitmap rows) as soon as a port function
+* returns, and keeping a copy for the DMA would cost the CPU as much as
+* writing the pixels to the FSMC itself. So the hook starts the DMA
+* and the caller sleeps until it is done. The CPU goes to other
+* threads meanwhile (the game thread while the display list's render
+* thread draws), never back to the caller. Every other access waits
+* as well, so nothing reaches the bus in the middle of a transfer.
+*/
+static void _Write0_16(U16 c) {
+  LCD_X_WaitM1_16();
+  LCD_X_Write0_16(c);
+}
+
+static void _Write1_16(U16 c) {
+  LCD_X_WaitM1_16();
+  LCD_X_Write1_16(c);
+}
+
+static void _WriteM1_16(U16 * pData, int NumWords) {
+  LCD_X_WriteM1_16_Async(pData, NumWords, NULL, NULL);
+  LCD_X_WaitM1_16();
+}
+
+static void _ReadM1_16(U16 * pData, int NumWords) {
+  LCD_X_WaitM1_16();
+  LCD_X_ReadM1_16(pData, NumWords);
+}
+
+#else
+
+#define _Write0_16   LCD_X_Write0_16
+#define _Write1_16   LCD_X_Write1_16
+#define _WriteM1_16  LCD_X_WriteM1_16
+#define _ReadM1_16   LCD_X_ReadM1_16
+
+#endif
+
+//
+// Reference path for LCD_X_Benchmark(): a plain per-word loop
+//
+#ifdef RTE_Graphics_LCD_MCBQVGA_LG_SPI
+  #define _WriteM1_16_Ref  _WriteM1_16_PerPixel
+#else
+  #define _WriteM1_16_Ref  LCD_X_WriteM1_16
+#endif
+
 /*********************************************************************
 *
 *       Private code
@@ -297,8 +531,8 @@ void LCD_X_ReadM1_16(U16 * pData, int NumWords) {
 **********************************************************************
 */
 static void wr_reg (U16 reg, U16 dat) {
-  LCD_X_Write0_16(reg);
-  LCD_X_Write1_16(dat);
+  _Write0_16(reg);
+  _Write1_16(dat);
 }
 
 /*********************************************************************
@@ -312,6 +546,9 @@ static void _InitController(void) {
 #ifndef WIN32
 
   LCD_X_Init();
+#ifndef RTE_Graphics_LCD_MCBQVGA_LG_SPI
+  _DMA_Init();
+#endif
 
   /* Driving ability settings --------------------------------------*/
   wr_reg(0xEA, 0x00);         /* Power control internal used (1)    */
@@ -406,6 +643,100 @@ static void _InitController(void) {
 *
 **********************************************************************
 */
+/*********************************************************************
+*
+*       LCD_X_SetScrollArea
+*
+* Purpose:
+*   Programs the vertical scroll area (prototypes in lcd_hw.h).
+*   tfa + vsa + bfa must add up to YSIZE_PHYS.
+*/
+void LCD_X_SetScrollArea(int tfa, int vsa, int bfa) {
+  wr_reg(0x0E, (U16)(tfa >> 8));   /* TFA MSB                          */
+  wr_reg(0x0F, (U16)(tfa & 0xFF)); /* TFA LSB                          */
+  wr_reg(0x10, (U16)(vsa >> 8));   /* VSA MSB                          */
+  wr_reg(0x11, (U16)(vsa & 0xFF)); /* VSA LSB                          */
+  wr_reg(0x12, (U16)(bfa >> 8));   /* BFA MSB                          */
+  wr_reg(0x13, (U16)(bfa & 0xFF)); /* BFA LSB                          */
+}
+
+/*********************************************************************
+*
+*       LCD_X_SetScrollStart
+*
+* Purpose:
+*   Selects the GRAM line shown at the top of the scroll area.
+*   Only takes effect while scrolling is enabled.
+*/
+void LCD_X_SetScrollStart(int vsp) {
+  wr_reg(0x14, (U16)(vsp >> 8));   /* VSP MSB                          */
+  wr_reg(0x15, (U16)(vsp & 0xFF)); /* VSP LSB                          */
+}
+
+/*********************************************************************
+*
+*       LCD_X_EnableScroll
+*
+* Purpose:
+*   Switches between normal mode and vertical scroll mode.
+*/
+void LCD_X_EnableScroll(int on) {
+  wr_reg(0x01, on ? 0x08 : 0x00);  /* Display mode: SCROLL bit         */
+}
+
+/*********************************************************************
+*
+*       LCD_X_EnableTE
+*
+* Purpose:
+*   Switches the tearing effect output on: one pulse per frame, at the
+*   end of the panel scan (V-blank only).
+*/
+void LCD_X_EnableTE(int on) {
+  wr_reg(0x60, on ? 0x08 : 0x00);  /* TE control: TEON                 */
+}
+
+/*********************************************************************
+*
+*       LCD_X_Benchmark
+*
+* Purpose:
+*   Pushes one full frame of black pixels through the bulk write hook
+*   and again through the plain per-word loop (FSMC: CPU copy, SPI:
+*   one transfer per pixel). Returns both rates in kB/s. The hook's
+*   rate is bus throughput only: the caller sleeps through each
+*   transfer (see the port hooks), it does not keep running.
+*   Call it while the screen is black, before anything is drawn.
+*/
+void LCD_X_Benchmark(U32 * pHook_kBps, U32 * pRef_kBps) {
+#ifndef WIN32
+  static U16 aLine[XSIZE_PHYS];
+  const  U32 NumBytes = XSIZE_PHYS * YSIZE_PHYS * 2;
+  U32 t0, t;
+  int i, Pass;
+
+  for (Pass = 0; Pass < 2; Pass++) {
+    t0 = osKernelGetSysTimerCount();
+    _Write0_16(0x22);                 /* GRAM write                       */
+    for (i = 0; i < YSIZE_PHYS; i++) {
+      if (Pass == 0) {
+        _WriteM1_16(aLine, XSIZE_PHYS);
+      } else {
+        _WriteM1_16_Ref(aLine, XSIZE_PHYS);
+      }
+    }
+    t = osKernelGetSysTimerCount() - t0;
+    if (t == 0) {
+      t = 1;
+    }
+    *(Pass ? pRef_kBps : pHook_kBps) = (U32)(((uint64_t)NumBytes * osKernelGetSysTimerFreq()) / ((uint64_t)t * 1000));
+  }
+#else
+  *pHook_kBps = 0;
+  *pRef_kBps  = 0;
+#endif
+}
+
 /*********************************************************************
 *
 *       LCD_X_Config
@@ -447,10 +778,10 @@ void LCD_X_Config(void) {
   //
   // Set controller and operation mode
   //
-  PortAPI.pfWrite16_A0  = LCD_X_Write0_16;
-  PortAPI.pfWrite16_A1  = LCD_X_Write1_16;
-  PortAPI.pfWriteM16_A1 = LCD_X_WriteM1_16;
-  PortAPI.pfReadM16_A1  = LCD_X_ReadM1_16;
+  PortAPI.pfWrite16_A0  = _Write0_16;
+  PortAPI.pfWrite16_A1  = _Write1_16;
+  PortAPI.pfWriteM16_A1 = _WriteM1_16;
+  PortAPI.pfReadM16_A1  = _ReadM1_16;
   GUIDRV_FlexColor_SetFunc(pDevice, &PortAPI, GUIDRV_FLEXCOLOR_F66712, GUIDRV_FLEXCOLOR_M16C0B16);
   //
   // Orientation and offset of SEG/COM lines
@@ -3,9 +3,12 @@
 #include "LCD.h"
 #include "cmsis_os2.h"
 #include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h> // For abs()
+#include <stdlib.h> // For rand()
 #include "input.h"
+#include "gfx.h"
+#include "perf.h"
+#include "hud.h"
+#include "brick_physics.h"
 
 /************************************************************
  * BRICK BREAKER  MULTI-LEVEL ENGINE
@@ -27,9 +30,16 @@
 #define MAX_LEVELS      3
 #define GAME_SPEED_MS   25
 
-typedef struct { int x, y, w, h; } rect_t;
-typedef struct { int x, y, vx, vy; } ball_t;
-typedef struct { rect_t rect; int active; } brick_t;
+
+/* HUD text area (top left) */
+#define HUD_X           2
+#define HUD_Y           2
+#define HUD_W           110
+#define HUD_H           13
+
+typedef brick_rect_t  rect_t;
+typedef brick_ball_t  ball_t;    /* px, px per frame */
+typedef brick_block_t brick_t;
 
 /*********** GLOBAL GAME STATE ***********/
 static int screen_w, screen_h;
@@ -43,13 +53,27 @@ static int current_level;
 static int game_active;
 static int game_won; // 0 = playing, 1 = lost, 2 = won game
 
+/*********** RENDER STATE ***********/
+/* What is on the LCD right now; draw_scene() only patches differences */
+static int     full_redraw;
+static rect_t  drawn_paddle;
+static rect_t  drawn_ball;
+static uint8_t brick_shown[BRICK_ROWS][BRICK_COLS];
+static hud_style_t hud_style;
+static hud_field_t hud_level, hud_score;
+
 /*********** INTERNAL PROTOTYPES ***********/
 static void start_new_game(void);
 static void load_level(int level);
 static void draw_scene(void);
+static void compose_scene(void *p);
+static void restore_background(rect_t r);
+static void repaint_part(rect_t shape, GUI_COLOR color, int x0, int y0, int x1, int y1);
+static void draw_hud(int all);
+static int  hud_overlaps(rect_t r);
 static void update_physics(void);
 static void move_paddle(int dir);
-static int  check_collision(rect_t r1, rect_t r2);
+static rect_t ball_box(void);
 static void draw_overlay_message(void);
 
 /************************************************************
@@ -60,6 +84,13 @@ void StartBrickGame(void)
     GUI_Clear();
     screen_w = LCD_GetXSize();
     screen_h = LCD_GetYSize();
+
+    /* "LVL:n  PTS:nnnnn" */
+    Hud_StyleInit(&hud_style, GUI_FONT_13_ASCII, GUI_WHITE, GUI_BLACK);
+    int x = HUD_X + Hud_LabelWidth(&hud_style, "LVL:");
+    Hud_FieldInit(&hud_level, &hud_style, x, HUD_Y, 1);
+    x += Hud_FieldWidth(&hud_level) + Hud_LabelWidth(&hud_style, "  PTS:");
+    Hud_FieldInit(&hud_score, &hud_style, x, HUD_Y, 5);
     
     start_new_game();
 
@@ -126,8 +157,8 @@ static void load_level(int level)
     paddle.y = screen_h - 20;
 
     /* 2. Reset Ball (Increase speed slightly per level) */
-    ball.x = screen_w / 2;
-    ball.y = paddle.y - 12;
+    ball.x = (float)(screen_w / 2);
+    ball.y = (float)(paddle.y - 12);
     
     // Level 1: Speed 3, Level 2: Speed 4, etc.
     int speed_boost = (level - 1); 
@@ -176,63 +207,45 @@ static void load_level(int level)
     }
     
     // Slight pause before level starts
-    GUI_Clear();
+    full_redraw = 1;
     draw_scene();
     GUI_DispStringHCenterAt("LEVEL UP", screen_w/2, screen_h/2);
     osDelay(1000);
+    full_redraw = 1;   // wipe the banner with the first frame
 }
 
 /************************************************************
  * PHYSICS
+ * brick_physics.c moves the ball through the frame; scoring,
+ * levels and losing the ball are handled here.
  ************************************************************/
 static void update_physics(void)
 {
-    /* Move Ball */
-    ball.x += ball.vx;
-    ball.y += ball.vy;
-
-    /* Wall Collisions */
-    if (ball.x <= 0) { ball.x = 0; ball.vx = -ball.vx; }
-    else if (ball.x >= screen_w - BALL_SIZE) { ball.x = screen_w - BALL_SIZE; ball.vx = -ball.vx; }
-
-    if (ball.y <= 0) { ball.y = 0; ball.vy = -ball.vy; }
-    else if (ball.y >= screen_h) {
-        game_active = 0;
-        game_won = 1; // 1 = Loss
+    brick_field_t field = {
+        screen_w, screen_h, BALL_SIZE, paddle,
+        &bricks[0][0], BRICK_ROWS * BRICK_COLS, bricks_remaining
+    };
+    int knocked = BrickPhys_Step(&ball, &field);
+
+    score += 10 * knocked;
+    bricks_remaining = field.remaining;
+
+    /* LEVEL COMPLETE CHECK */
+    if (knocked && bricks_remaining == 0) {
+        if (current_level < MAX_LEVELS) {
+            current_level++;
+            load_level(current_level);
+        } else {
+            game_active = 0;
+            game_won = 2; // 2 = Victory
+        }
         return;
     }
 
-    /* Paddle Collision */
-    rect_t ball_rect = { ball.x, ball.y, BALL_SIZE, BALL_SIZE };
-    if (check_collision(ball_rect, paddle)) {
-        ball.vy = -abs(ball.vy);
-        ball.y = paddle.y - BALL_SIZE - 1;
-    }
-
-    /* Brick Collision */
-    for (int r = 0; r < BRICK_ROWS; r++) {
-        for (int c = 0; c < BRICK_COLS; c++) {
-            if (bricks[r][c].active) {
-                if (check_collision(ball_rect, bricks[r][c].rect)) {
-                    bricks[r][c].active = 0;
-                    ball.vy = -ball.vy;
-                    score += 10;
-                    bricks_remaining--;
-
-                    /* LEVEL COMPLETE CHECK */
-                    if (bricks_remaining == 0) {
-                        if (current_level < MAX_LEVELS) {
-                            current_level++;
-                            load_level(current_level);
-                        } else {
-                            game_active = 0;
-                            game_won = 2; // 2 = Victory
-                        }
-                    }
-                    return;
-                }
-            }
-        }
+    /* Past the paddle and off the bottom */
+    if (ball.y >= screen_h) {
+        game_active = 0;
+        game_won = 1; // 1 = Loss
     }
 }
 
@@ -248,14 +261,132 @@ static void move_paddle(int dir)
     if (paddle.x + paddle.w > screen_w) paddle.x = screen_w - paddle.w;
 }
 
-static int check_collision(rect_t r1, rect_t r2)
+/* Ball on the pixel grid */
+static rect_t ball_box(void)
 {
-    return (r1.x < r2.x + r2.w && r1.x + r1.w > r2.x &&
-            r1.y < r2.y + r2.h && r1.y + r1.h > r2.y);
+    rect_t r = { (int)ball.x, (int)ball.y, BALL_SIZE, BALL_SIZE };
+    return r;
 }
 
+/************************************************************
+ * LAYERED RENDERER
+ * Brick field: drawn once per level, patched when a brick dies.
+ * Ball/paddle: erased by restoring the background under their
+ * old rectangle, then drawn at the new position.
+ * HUD: redrawn only when level or score change (or when
+ * something was drawn over it).
+ ************************************************************/
 static void draw_scene(void)
 {
+    uint32_t pixels = Gfx_GetPixelWrites();
+
+    if (full_redraw) {
+        Gfx_DrawFrame(compose_scene, NULL);
+        full_redraw = 0;
+        Perf_Report(PERF_EVT_BRICK_PIXELS, Gfx_GetPixelWrites() - pixels, 0);
+        return;
+    }
+
+    int hud_dirty = 0;
+
+    /* Bricks knocked out since the last frame */
+    for (int r = 0; r < BRICK_ROWS; r++) {
+        for (int c = 0; c < BRICK_COLS; c++) {
+            if (brick_shown[r][c] && !bricks[r][c].active) {
+                brick_shown[r][c] = 0;
+                restore_background(bricks[r][c].rect);
+            }
+        }
+    }
+
+    rect_t ball_rect = ball_box();
+    int ball_moved = (ball_rect.x != drawn_ball.x || ball_rect.y != drawn_ball.y);
+    int paddle_moved = (paddle.x != drawn_paddle.x);
+
+    /* Erase */
+    if (ball_moved) {
+        restore_background(drawn_ball);
+        hud_dirty |= hud_overlaps(drawn_ball);
+    }
+    if (paddle_moved) restore_background(drawn_paddle);
+
+    /* Paddle & Ball (an erased ball already gave back the paddle under it) */
+    if (paddle_moved) {
+        GUI_SetColor(GUI_BLUE);
+        Gfx_FillRect(paddle.x, paddle.y, paddle.x + paddle.w, paddle.y + paddle.h);
+        drawn_paddle = paddle;
+    }
+    if (ball_moved || paddle_moved) {
+        GUI_SetColor(GUI_RED);
+        Gfx_FillRect(ball_rect.x, ball_rect.y, ball_rect.x + BALL_SIZE, ball_rect.y + BALL_SIZE);
+        drawn_ball = ball_rect;
+        hud_dirty |= hud_overlaps(ball_rect);
+    }
+
+    /* HUD: labels too if the ball went over them, else changed digits */
+    draw_hud(hud_dirty);
+
+    Perf_Report(PERF_EVT_BRICK_PIXELS, Gfx_GetPixelWrites() - pixels, 0);
+}
+
+/* Paint the part of shape inside (x0, y0)..(x1, y1), inclusive */
+static void repaint_part(rect_t shape, GUI_COLOR color, int x0, int y0, int x1, int y1)
+{
+    int sx0 = (shape.x > x0) ? shape.x : x0;
+    int sy0 = (shape.y > y0) ? shape.y : y0;
+    int sx1 = (shape.x + shape.w < x1) ? shape.x + shape.w : x1;
+    int sy1 = (shape.y + shape.h < y1) ? shape.y + shape.h : y1;
+
+    if (sx0 <= sx1 && sy0 <= sy1) {
+        GUI_SetColor(color);
+        Gfx_FillRect(sx0, sy0, sx1, sy1);
+    }
+}
+
+/* Repaint what lies under r: black background plus any live brick
+ * and the paddle. Drawn extents are inclusive of x + w / y + h, one
+ * pixel past the rect_t the physics collides with, so a ball
+ * resting on the paddle shares its top row. */
+static void restore_background(rect_t r)
+{
+    int x0 = r.x, y0 = r.y, x1 = r.x + r.w, y1 = r.y + r.h;
+
+    GUI_SetColor(GUI_BLACK);
+    Gfx_FillRect(x0, y0, x1, y1);
+
+    for (int row = 0; row < BRICK_ROWS; row++) {
+        for (int c = 0; c < BRICK_COLS; c++) {
+            if (bricks[row][c].active)
+                repaint_part(bricks[row][c].rect, (row % 2 == 0) ? GUI_GREEN : GUI_YELLOW,
+                             x0, y0, x1, y1);
+        }
+    }
+    repaint_part(paddle, GUI_BLUE, x0, y0, x1, y1);
+}
+
+static void draw_hud(int all)
+{
+    if (all) {
+        Hud_Label(&hud_style, "LVL:", HUD_X, HUD_Y);
+        Hud_Label(&hud_style, "  PTS:", hud_level.x + Hud_FieldWidth(&hud_level), HUD_Y);
+        Hud_Draw(&hud_level, current_level);
+        Hud_Draw(&hud_score, score);
+    } else {
+        Hud_Update(&hud_level, current_level);
+        Hud_Update(&hud_score, score);
+    }
+}
+
+static int hud_overlaps(rect_t r)
+{
+    return (r.y <= HUD_Y + HUD_H) && (r.x <= HUD_X + HUD_W);
+}
+
+/* Whole frame, composed band by band off-screen */
+static void compose_scene(void *p)
+{
+    (void)p;
+
     GUI_SetBkColor(GUI_BLACK);
     GUI_Clear();
 
@@ -263,7 +394,9 @@ static void draw_scene(void)
     GUI_SetColor(GUI_BLUE);
     GUI_FillRect(paddle.x, paddle.y, paddle.x + paddle.w, paddle.y + paddle.h);
     GUI_SetColor(GUI_RED);
-    GUI_FillRect(ball.x, ball.y, ball.x + BALL_SIZE, ball.y + BALL_SIZE);
+    drawn_ball = ball_box();
+    GUI_FillRect(drawn_ball.x, drawn_ball.y, drawn_ball.x + BALL_SIZE, drawn_ball.y + BALL_SIZE);
+    drawn_paddle = paddle;
 
     /* Bricks */
     for (int r = 0; r < BRICK_ROWS; r++) {
@@ -274,15 +407,12 @@ static void draw_scene(void)
                 rect_t b = bricks[r][c].rect;
                 GUI_FillRect(b.x, b.y, b.x + b.w, b.y + b.h);
             }
+            brick_shown[r][c] = (uint8_t)bricks[r][c].active;
         }
     }
 
     /* HUD */
-    GUI_SetColor(GUI_WHITE);
-    GUI_SetFont(GUI_FONT_13_ASCII);
-    char buf[40];
-    sprintf(buf, "LVL:%d  PTS:%d", current_level, score);
-    GUI_DispStringAt(buf, 2, 2);
+    draw_hud(1);
 }
 
 static void draw_overlay_message(void)
@@ -0,0 +1,124 @@
+/* brick_physics.c */
+#include <stddef.h>
+#include "brick_physics.h"
+
+#define HIT_X   1   /* Vertical face: vx turns */
+#define HIT_Y   2   /* Horizontal face: vy turns */
+
+/* When the ball moving by (dx, dy) first touches r, as a fraction of
+ * the move in [0, 1): *pToi, and which faces meet (HIT_X / HIT_Y,
+ * both on a corner). 0 if it misses, or already overlaps r. */
+static int sweep(const brick_ball_t *pBall, int size, brick_rect_t r, float dx, float dy, float *pToi)
+{
+    float x_in, x_out, y_in, y_out;
+
+    if (dx > 0) {
+        x_in  = (r.x - (pBall->x + size)) / dx;
+        x_out = (r.x + r.w - pBall->x) / dx;
+    } else if (dx < 0) {
+        x_in  = (r.x + r.w - pBall->x) / dx;
+        x_out = (r.x - (pBall->x + size)) / dx;
+    } else if (pBall->x + size > r.x && pBall->x < r.x + r.w) {
+        x_in = -1.0f; x_out = 2.0f;     /* In x range for the whole move */
+    } else {
+        return 0;
+    }
+
+    if (dy > 0) {
+        y_in  = (r.y - (pBall->y + size)) / dy;
+        y_out = (r.y + r.h - pBall->y) / dy;
+    } else if (dy < 0) {
+        y_in  = (r.y + r.h - pBall->y) / dy;
+        y_out = (r.y - (pBall->y + size)) / dy;
+    } else if (pBall->y + size > r.y && pBall->y < r.y + r.h) {
+        y_in = -1.0f; y_out = 2.0f;
+    } else {
+        return 0;
+    }
+
+    float t_in  = (x_in > y_in) ? x_in : y_in;
+    float t_out = (x_out < y_out) ? x_out : y_out;
+
+    /* Entry after exit: passes by. Entry before 0: already inside,
+     * or only leaving, which never counts as a hit */
+    if (t_in >= t_out || t_in < 0.0f || t_in >= 1.0f) return 0;
+
+    *pToi = t_in;
+    if (x_in > y_in) return HIT_X;
+    if (y_in > x_in) return HIT_Y;
+    return HIT_X | HIT_Y;
+}
+
+int BrickPhys_Step(brick_ball_t *pBall, brick_field_t *pField)
+{
+    const int size = pField->ball_size;
+    const brick_rect_t paddle = pField->paddle;
+    int knocked = 0;
+
+    /* Paddle stepped into the ball: lift it out on top */
+    if (pBall->x < paddle.x + paddle.w && pBall->x + size > paddle.x &&
+        pBall->y < paddle.y + paddle.h && pBall->y + size > paddle.y) {
+        pBall->y = (float)(paddle.y - size);
+        if (pBall->vy > 0) pBall->vy = -pBall->vy;
+    }
+
+    const brick_rect_t walls[3] = {
+        { -BRICK_WALL_T, -BRICK_WALL_T, BRICK_WALL_T, pField->h + 2 * BRICK_WALL_T },    /* Left */
+        { pField->w, -BRICK_WALL_T, BRICK_WALL_T, pField->h + 2 * BRICK_WALL_T },        /* Right */
+        { -BRICK_WALL_T, -BRICK_WALL_T, pField->w + 2 * BRICK_WALL_T, BRICK_WALL_T },    /* Top */
+    };
+    float left = 1.0f;  /* Part of the frame not yet moved */
+
+    for (int hits = 0; hits < BRICK_MAX_HITS && left > 0.0f; hits++)
+    {
+        float dx = pBall->vx * left, dy = pBall->vy * left;
+        float toi = 1.0f, t;
+        int axis = 0, side;
+        brick_rect_t hit_rect = paddle;
+        brick_block_t *hit_brick = NULL;
+
+        for (int i = 0; i < 3; i++) {
+            if ((side = sweep(pBall, size, walls[i], dx, dy, &t)) && t < toi) {
+                toi = t; axis = side; hit_rect = walls[i];
+            }
+        }
+        if ((side = sweep(pBall, size, paddle, dx, dy, &t)) && t < toi) {
+            toi = t; axis = side; hit_rect = paddle;
+        }
+        for (int i = 0; i < pField->count; i++) {
+            brick_block_t *b = &pField->pBricks[i];
+            if (!b->active) continue;
+            if ((side = sweep(pBall, size, b->rect, dx, dy, &t)) && t < toi) {
+                toi = t; axis = side; hit_rect = b->rect;
+                hit_brick = b;
+            }
+        }
+
+        /* Free flight to the end of the frame */
+        if (axis == 0) {
+            pBall->x += dx;
+            pBall->y += dy;
+            break;
+        }
+
+        /* To the contact; the face it touches is placed exactly */
+        pBall->x += dx * toi;
+        pBall->y += dy * toi;
+        if (axis & HIT_X) {
+            pBall->x = (float)((dx > 0) ? hit_rect.x - size : hit_rect.x + hit_rect.w);
+            pBall->vx = -pBall->vx;
+        }
+        if (axis & HIT_Y) {
+            pBall->y = (float)((dy > 0) ? hit_rect.y - size : hit_rect.y + hit_rect.h);
+            pBall->vy = -pBall->vy;
+        }
+        left *= 1.0f - toi;
+
+        if (hit_brick) {
+            hit_brick->active = 0;
+            knocked++;
+            if (--pField->remaining == 0) break;
+        }
+    }
+    return knocked;
+}
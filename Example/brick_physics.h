@@ -0,0 +1,38 @@
+/* brick_physics.h */
+#ifndef BRICK_PHYSICS_H
+#define BRICK_PHYSICS_H
+
+/************************************************************
+ * BRICK BREAKER BALL PHYSICS
+ * Swept AABB: the ball's move for the frame is tested against
+ * walls, paddle and bricks for the earliest time of impact,
+ * moved there, reflected off the face it hit and continued for
+ * the rest of the frame. No speed can skip a brick, and a side
+ * hit turns vx, not vy.
+ *
+ * Plain C, no emWin or RTOS calls, so it also builds and runs
+ * on a PC (tools/brick_ccd_test.c).
+ ************************************************************/
+
+#define BRICK_MAX_HITS  4   /* Contacts resolved per frame, the rest waits */
+#define BRICK_WALL_T    64  /* Walls are rects this thick off the field */
+
+typedef struct { int x, y, w, h; } brick_rect_t;
+typedef struct { float x, y, vx, vy; } brick_ball_t;    /* px, px per frame */
+typedef struct { brick_rect_t rect; int active; } brick_block_t;
+
+typedef struct {
+    int w, h;                   /* Walls left, right and top; open below */
+    int ball_size;              /* The ball is ball_size x ball_size */
+    brick_rect_t paddle;
+    brick_block_t *pBricks;     /* Inactive ones are skipped */
+    int count;
+    int remaining;              /* Active bricks */
+} brick_field_t;
+
+/* Moves the ball one frame. Bricks it hits are made inactive and
+ * taken off remaining; at 0 the frame stops there. Returns the
+ * number of bricks hit. A ball at or past h has been lost. */
+int BrickPhys_Step(brick_ball_t *pBall, brick_field_t *pField);
+
+#endif
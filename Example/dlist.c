@@ -0,0 +1,178 @@
+/* dlist.c */
+#include <string.h>
+#include "dlist.h"
+#include "cmsis_os2.h"
+#include "cmsis_compiler.h"
+#include "gfx.h"
+#include "perf.h"
+#include "vsync.h"
+
+#define DL_MASK          (DL_RING_LEN - 1)
+#define DL_FLAG_WORK     0x0001U    /* render thread: new commands */
+#define DL_FLAG_IDLE     0x0002U    /* flushing thread: ring drained */
+
+#define DL_STACK_SZ      (1024U)
+
+/* Single producer / single consumer: the game thread only writes
+ * dl_wr and dl_head, the render thread only writes dl_tail. */
+static dl_cmd_t          dl_ring[DL_RING_LEN];
+static uint32_t          dl_wr;             // next free slot, not yet published
+static volatile uint32_t dl_head;           // published up to here
+static volatile uint32_t dl_tail;           // drawn up to here
+
+static osThreadId_t          dl_thread;
+static osThreadId_t volatile dl_flush_waiter;
+static uint32_t              dl_stalls;
+static vsync_frame_t         dl_frame;          // render thread's frame slot
+
+static uint64_t dl_stack[DL_STACK_SZ / 8];
+static const osThreadAttr_t dl_thread_attr = {
+  .name       = "render",
+  .stack_mem  = &dl_stack[0],
+  .stack_size = sizeof(dl_stack),
+  .priority   = osPriorityAboveNormal
+};
+
+/************************************************************
+ * RENDER THREAD (CONSUMER)
+ ************************************************************/
+static void dl_execute(const dl_cmd_t *c)
+{
+    switch (c->op)
+    {
+        case DL_OP_FILL:
+            GUI_SetColor(c->color);
+            Gfx_FillRect(c->x0, c->y0, c->x1, c->y1);
+            break;
+
+        case DL_OP_BITMAP:
+            GUI_DrawBitmap(c->u.pBitmap, c->x0, c->y0);
+            break;
+
+        case DL_OP_TEXT:
+            GUI_SetColor(c->color);
+            GUI_SetBkColor(c->bk_color);
+            GUI_SetFont(c->u.text.pFont);
+            GUI_DispStringAt(c->u.text.s, c->x0, c->y0);
+            break;
+    }
+}
+
+static __NO_RETURN void dl_render_thread(void *argument)
+{
+    (void)argument;
+
+    while (1)
+    {
+        osThreadFlagsWait(DL_FLAG_WORK, osFlagsWaitAny, osWaitForever);
+
+        /* Start right behind the panel scan */
+        VSync_WaitEdge(&dl_frame);
+
+        uint32_t t0 = Perf_Cycles();
+        uint32_t n = 0;
+
+        while (dl_tail != dl_head)
+        {
+            __DMB();    // command contents before the index that published them
+            dl_execute(&dl_ring[dl_tail & DL_MASK]);
+            dl_tail = dl_tail + 1;
+            n++;
+        }
+
+        VSync_FrameDone(&dl_frame);
+
+        if (n)
+            Perf_Report(PERF_EVT_RENDER, Perf_CyclesToUs(Perf_Cycles() - t0), n);
+
+        osThreadId_t waiter = dl_flush_waiter;
+        if (waiter)
+            osThreadFlagsSet(waiter, DL_FLAG_IDLE);
+    }
+}
+
+void DL_Init(void)
+{
+    if (dl_thread == NULL)
+        dl_thread = osThreadNew(dl_render_thread, NULL, &dl_thread_attr);
+}
+
+/************************************************************
+ * GAME THREAD (PRODUCER)
+ ************************************************************/
+static dl_cmd_t *dl_alloc(void)
+{
+    /* Ring full: hand over what we have and let the renderer catch up */
+    while (dl_wr - dl_tail >= DL_RING_LEN)
+    {
+        dl_stalls++;
+        DL_Submit();
+        osDelay(1);
+    }
+    return &dl_ring[dl_wr & DL_MASK];
+}
+
+void DL_FillRect(int x0, int y0, int x1, int y1, GUI_COLOR color)
+{
+    dl_cmd_t *c = dl_alloc();
+
+    c->op    = DL_OP_FILL;
+    c->x0    = (int16_t)x0;
+    c->y0    = (int16_t)y0;
+    c->x1    = (int16_t)x1;
+    c->y1    = (int16_t)y1;
+    c->color = color;
+    dl_wr++;
+}
+
+void DL_Bitmap(const GUI_BITMAP *pBitmap, int x, int y)
+{
+    dl_cmd_t *c = dl_alloc();
+
+    c->op        = DL_OP_BITMAP;
+    c->x0        = (int16_t)x;
+    c->y0        = (int16_t)y;
+    c->u.pBitmap = pBitmap;
+    dl_wr++;
+}
+
+void DL_Text(const char *s, int x, int y, const GUI_FONT *pFont,
+             GUI_COLOR color, GUI_COLOR bk_color)
+{
+    dl_cmd_t *c = dl_alloc();
+
+    c->op           = DL_OP_TEXT;
+    c->x0           = (int16_t)x;
+    c->y0           = (int16_t)y;
+    c->color        = color;
+    c->bk_color     = bk_color;
+    c->u.text.pFont = pFont;
+    strncpy(c->u.text.s, s, DL_TEXT_LEN - 1);
+    c->u.text.s[DL_TEXT_LEN - 1] = '\0';
+    dl_wr++;
+}
+
+void DL_Submit(void)
+{
+    if (dl_head == dl_wr) return;
+
+    __DMB();    // publish the commands before the index
+    dl_head = dl_wr;
+    osThreadFlagsSet(dl_thread, DL_FLAG_WORK);
+}
+
+void DL_Flush(void)
+{
+    DL_Submit();
+    if (dl_tail == dl_head) return;
+
+    dl_flush_waiter = osThreadGetId();
+    while (dl_tail != dl_head)
+        osThreadFlagsWait(DL_FLAG_IDLE, osFlagsWaitAny, 10);
+    dl_flush_waiter = NULL;
+}
+
+uint32_t DL_GetStalls(void)
+{
+    return dl_stalls;
+}
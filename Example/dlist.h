@@ -0,0 +1,59 @@
+/* dlist.h */
+#ifndef DLIST_H
+#define DLIST_H
+
+#include <stdint.h>
+#include "GUI.h"
+
+/************************************************************
+ * DISPLAY LIST + RENDER THREAD
+ * A game tick queues fixed-size draw commands and submits
+ * them; a separate RTX thread replays them through emWin.
+ * The tick returns at once, so logic for the next frame runs
+ * while this one is still going out to the LCD.
+ *
+ * emWin is not thread-safe: while commands may be pending,
+ * only the render thread may touch the GUI. Call DL_Flush()
+ * before drawing directly (full redraws, menus, overlays).
+ ************************************************************/
+
+#define DL_RING_LEN      64     /* Commands, power of two */
+#define DL_TEXT_LEN      16     /* Text is copied, incl. terminator */
+
+typedef enum {
+    DL_OP_FILL,                 /* Solid rectangle */
+    DL_OP_BITMAP,               /* GUI_DrawBitmap(), bitmap must stay valid */
+    DL_OP_TEXT                  /* GUI_DispStringAt() */
+} dl_op_t;
+
+typedef struct {
+    uint8_t  op;
+    int16_t  x0, y0, x1, y1;
+    GUI_COLOR color;
+    GUI_COLOR bk_color;
+    union {
+        const GUI_BITMAP *pBitmap;
+        struct {
+            const GUI_FONT *pFont;
+            char s[DL_TEXT_LEN];
+        } text;
+    } u;
+} dl_cmd_t;
+
+void     DL_Init(void);
+
+/* Producer side (one game thread). Commands become visible to the
+ * render thread on DL_Submit(); a full ring submits early and
+ * waits for room (counted in DL_GetStalls()). */
+void     DL_FillRect(int x0, int y0, int x1, int y1, GUI_COLOR color);
+void     DL_Bitmap(const GUI_BITMAP *pBitmap, int x, int y);
+void     DL_Text(const char *s, int x, int y, const GUI_FONT *pFont,
+                 GUI_COLOR color, GUI_COLOR bk_color);
+void     DL_Submit(void);
+
+/* Wait until every submitted command has been drawn */
+void     DL_Flush(void);
+
+uint32_t DL_GetStalls(void);
+
+#endif
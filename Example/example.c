@@ -21,6 +21,10 @@
 #include "brick_game.h"
 #include "flappy_game.h"
 #include "2048_game.h"
+#include "perf.h"
+#include "lcd_hw.h"
+#include "dlist.h"
+#include "vsync.h"
 
 
 #define APP_MAIN_STK_SZ (1024U)
@@ -30,9 +34,44 @@ const osThreadAttr_t app_main_attr = {
   .stack_size = sizeof(app_main_stk)
 };
 
+static void Start2048Game3(void) { Start2048GameSize(3); }
+static void Start2048Game5(void) { Start2048GameSize(5); }
+static void Start2048Game6(void) { Start2048GameSize(6); }
+
+/* Game list: start key, menu line, entry point */
+typedef struct {
+  char        key;
+  const char *label;
+  void      (*start)(void);
+} menu_item_t;
+
+static const menu_item_t menu[] = {
+  { 'A', "Press 'A' to Start snake",  StartSnakeGame },
+  { 'B', "Press 'B' to Start brick",  StartBrickGame },
+  { 'C', "Press 'C' to Start flappy", StartFlappyGame },
+  { 'D', "Press 'D' to Start 2048",   Start2048Game },
+  { '*', "Press '*' for wide flappy", StartFlappyGameLandscape },
+  { '3', "Press '3' for 2048 3x3",    Start2048Game3 },
+  { '5', "Press '5' for 2048 5x5",    Start2048Game5 },
+  { '6', "Press '6' for 2048 6x6",    Start2048Game6 },
+};
+
+#define MENU_ITEMS  ((int32_t)(sizeof(menu) / sizeof(menu[0])))
+
+static void show_menu(int32_t xSize, int32_t ySize) {
+  GUI_SetBkColor(GUI_BLACK);
+  GUI_Clear();
+  GUI_SetColor(GUI_WHITE);
+  GUI_SetTextMode(GUI_TM_REV);
+  GUI_SetFont(GUI_FONT_20F_ASCII);
+  for (int32_t i = 0; i < MENU_ITEMS; i++)
+    GUI_DispStringHCenterAt(menu[i].label, xSize / 2, ySize / 4 + 20 * i);
+}
+
 __NO_RETURN void app_main (void *argument) {
-  int32_t xPos, yPos, xSize, ySize;
+  int32_t xSize, ySize;
   int32_t i = 0;
+  U32 hook_kBps, ref_kBps;
 
   (void)argument;
 
@@ -40,117 +79,34 @@ __NO_RETURN void app_main (void *argument) {
   Keypad_Init(); 
   /* ----------------------------------- */
 
+  Perf_Init();
+
   GUI_Init();
+  VSync_Init();
+  DL_Init();
 
   GUI_SetBkColor(GUI_BLACK);
   GUI_Clear();
 
+  /* LCD bus throughput, measured while the screen is still black */
+  LCD_X_Benchmark(&hook_kBps, &ref_kBps);
+  Perf_Report(PERF_EVT_LCD_BANDWIDTH, hook_kBps, ref_kBps);
+
   xSize = LCD_GetXSize();
   ySize = LCD_GetYSize();
 
-  xPos = xSize / 2;
-  yPos = ySize / 3;
+  show_menu(xSize, ySize);
 
-  GUI_SetColor(GUI_WHITE);
-  GUI_SetTextMode(GUI_TM_REV);
-  GUI_SetFont(GUI_FONT_20F_ASCII);
-  GUI_DispStringHCenterAt("Press 'A' to Start snake", xPos, yPos);
-	
-  xPos = xSize / 2;
-  yPos = ySize / 3 + 20;
-	
-	GUI_DispStringHCenterAt("Press 'B' to Start brick", xPos, yPos);
-	xPos = xSize / 2;
-  yPos = ySize / 3 + 40;
-	GUI_DispStringHCenterAt("Press 'C' to Start flappy", xPos, yPos);
-	xPos = xSize / 2;
-  yPos = ySize / 3 + 60;
-	GUI_DispStringHCenterAt("Press 'D' to Start 2048", xPos, yPos);
-	
-	
   /* MAIN LOOP */
   while (1) {
-    
-    /* Check for Start Key '5' */
-    if (Keypad_Get_Key() == 'A') {
-        StartSnakeGame();
-				GUI_SetBkColor(GUI_BLACK);
-				GUI_Clear();
-				xPos = xSize / 2;
-				yPos = ySize / 3;
-        GUI_SetColor(GUI_WHITE);
-				GUI_SetTextMode(GUI_TM_REV);
-				GUI_SetFont(GUI_FONT_20F_ASCII);
-				GUI_DispStringHCenterAt("Press 'A' to Start snake", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 + 20;
-				GUI_DispStringHCenterAt("Press 'B' to Start brick", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 + 40;
-				GUI_DispStringHCenterAt("Press 'C' to Start flappy", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 + 60;
-				GUI_DispStringHCenterAt("Press 'D' to Start 2048", xPos, yPos);
-    }
-		if (Keypad_Get_Key() == 'B') {
-        StartBrickGame();
-				GUI_SetBkColor(GUI_BLACK);
-				GUI_Clear();
-				xPos = xSize / 2;
-				yPos = ySize / 3;
-        GUI_SetColor(GUI_WHITE);
-				GUI_SetTextMode(GUI_TM_REV);
-				GUI_SetFont(GUI_FONT_20F_ASCII);
-				GUI_DispStringHCenterAt("Press 'A' to Start snake", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 + 20;
-				GUI_DispStringHCenterAt("Press 'B' to Start brick", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 + 40;
-				GUI_DispStringHCenterAt("Press 'C' to Start flappy", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 + 60;
-				GUI_DispStringHCenterAt("Press 'D' to Start 2048", xPos, yPos);
-    }
-		if (Keypad_Get_Key() == 'C') {
-        StartFlappyGame();
-				GUI_SetBkColor(GUI_BLACK);
-				GUI_Clear();
-				xPos = xSize / 2;
-				yPos = ySize / 3;
-        GUI_SetColor(GUI_WHITE);
-				GUI_SetTextMode(GUI_TM_REV);
-				GUI_SetFont(GUI_FONT_20F_ASCII);
-				GUI_DispStringHCenterAt("Press 'A' to Start snake", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 + 20;
-				GUI_DispStringHCenterAt("Press 'B' to Start brick", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 +40;
-				GUI_DispStringHCenterAt("Press 'C' to Start flappy", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 + 60;
-				GUI_DispStringHCenterAt("Press 'D' to Start 2048", xPos, yPos);
-    }
-		if (Keypad_Get_Key() == 'D') {
-        Start2048Game();
-				GUI_SetBkColor(GUI_BLACK);
-				GUI_Clear();
-				xPos = xSize / 2;
-				yPos = ySize / 3;
-        GUI_SetColor(GUI_WHITE);
-				GUI_SetTextMode(GUI_TM_REV);
-				GUI_SetFont(GUI_FONT_20F_ASCII);
-				GUI_DispStringHCenterAt("Press 'A' to Start snake", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 + 20;
-				GUI_DispStringHCenterAt("Press 'B' to Start brick", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 +40;
-				GUI_DispStringHCenterAt("Press 'C' to Start flappy", xPos, yPos);
-				xPos = xSize / 2;
-				yPos = ySize / 3 + 60;
-				GUI_DispStringHCenterAt("Press 'D' to Start 2048", xPos, yPos);
+    char key = Keypad_Get_Key();
+
+    for (i = 0; i < MENU_ITEMS; i++) {
+      if (key == menu[i].key) {
+        menu[i].start();
+        show_menu(xSize, ySize);   /* Back from a game */
+        break;
+      }
     }
 
     GUI_Delay(50); 
@@ -3,9 +3,14 @@
 #include "LCD.h"
 #include "cmsis_os2.h"
 #include <stdint.h>
-#include <stdio.h>
 #include <stdlib.h> // For rand()
+#include <string.h>
 #include "input.h"
+#include "gfx.h"
+#include "perf.h"
+#include "lcd_hw.h"
+#include "vsync.h"
+#include "hud.h"
 
 /************************************************************
  * FLAPPY BIRD  STANDALONE ENGINE
@@ -28,6 +33,22 @@
 
 #define GROUND_H        10     /* Height of the floor */
 #define GAME_SPEED_MS   40     /* Frame delay */
+#define MAX_FRAME_SKIP  3      /* Late ticks caught up before drawing again */
+
+/* --- COLORS & HUD --- */
+#define SKY_COLOR       0x00FFFF00  /* Cyan/Sky Blue in typical RGB hex, adapt to your LCD.h definitions */
+#define SCORE_Y0        10          /* Score box, redrawn when touched */
+#define SCORE_DIGITS    3
+#define SCORE_Y1        (SCORE_Y0 + 20)
+#define SCORE_X0        (screen_w / 2 - 30)
+#define SCORE_X1        (screen_w / 2 + 30)
+
+/* --- LANDSCAPE (HARDWARE SCROLL) ---
+ * The panel stays in portrait for emWin; the game turns it on its
+ * side itself. Landscape x runs along the 320 GRAM lines, which is
+ * the axis the HX8347 scrolls, so moving the world is one write to
+ * the scroll start register plus the newly exposed columns. */
+#define LAND_HUD_W      24     /* Fixed top area (left strip in landscape): score */
 
 typedef struct {
     int y;
@@ -48,9 +69,41 @@ static int score;
 static int game_active;
 static int high_score = 0;
 
+/*********** RENDER STATE ***********/
+/* Sky and ground are drawn once per game; afterwards only pipe
+ * edges, the bird box and the score are touched. */
+static int full_redraw;
+static int drawn_pipe_x[NUM_PIPES];
+static int drawn_gap_y[NUM_PIPES];
+static int drawn_bird_y;
+static int drawn_score;             /* Landscape HUD */
+static hud_style_t hud_style;
+static hud_field_t hud_score;
+
+/* Landscape mode: screen_w is the scroll area, scroll is the world
+ * column shown at its left edge (modulo screen_w) */
+static int landscape;
+static int scroll;
+static int drawn_scroll;
+
+/* Frame pacing on the panel's TE pulses */
+static vsync_frame_t frame;
+
 /*********** INTERNAL PROTOTYPES ***********/
+static void run_game(void);
 static void init_game(void);
 static void draw_scene(void);
+static void compose_scene(void *p);
+static void draw_pipe_area(int i, int x0, int y0, int x1, int y1);
+static void fill_sky_segments(int x0, int x1, int gap_y);
+static void restore_area(int x0, int y0, int x1, int y1);
+static void draw_bird(void);
+static void draw_score(int all);
+static void draw_scene_scrolled(void);
+static void draw_columns(int x0, int x1);
+static void draw_hud(void);
+static void fill_rect(int x0, int y0, int x1, int y1);
+static void draw_text_hcenter(const char *s, int x, int y, int h);
 static void update_physics(void);
 static void spawn_pipe(int index, int start_x);
 static int  check_collision(void);
@@ -62,10 +115,43 @@ static void game_over_screen(void);
 void StartFlappyGame(void)
 {
     GUI_Clear();
+    landscape = 0;
     screen_w = LCD_GetXSize();
     screen_h = LCD_GetYSize();
 
+    Hud_StyleInit(&hud_style, GUI_FONT_20_ASCII, GUI_BLACK, SKY_COLOR);
+    Hud_FieldInit(&hud_score, &hud_style, screen_w / 2 - SCORE_DIGITS * hud_style.cell_w / 2,
+                  SCORE_Y0, SCORE_DIGITS);
+
+    run_game();
+}
+
+void StartFlappyGameLandscape(void)
+{
+    GUI_Clear();
+    landscape = 1;
+    screen_w = LCD_GetYSize() - LAND_HUD_W;
+    screen_h = LCD_GetXSize();
+
+    LCD_X_SetScrollArea(LAND_HUD_W, screen_w, 0);
+    LCD_X_SetScrollStart(LAND_HUD_W);
+    LCD_X_EnableScroll(1);
+
+    run_game();
+
+    /* Back to a plain panel for the menu */
+    LCD_X_EnableScroll(0);
+    LCD_X_SetScrollStart(0);
+    LCD_X_SetScrollArea(0, LCD_GetYSize(), 0);
+    landscape = 0;
+}
+
+static void run_game(void)
+{
+    uint32_t frame_slots = VSync_FramesFor(GAME_SPEED_MS);
+
     init_game();
+    VSync_Resync(&frame);
 
     while (1)
     {
@@ -88,6 +174,7 @@ void StartFlappyGame(void)
         if (key == 'C') {
             init_game();
             osDelay(200);
+            VSync_Resync(&frame);
         }
 
         /* ------------------------------
@@ -98,9 +185,17 @@ void StartFlappyGame(void)
         }
 
         /* ------------------------------
-         * RENDER & DELAY
+         * RENDER ON THE PANEL'S FRAME CLOCK
          * ------------------------------ */
+        uint32_t skip = VSync_WaitFrame(&frame, frame_slots);
+
+        /* Ticks that lost their slot: run their physics, skip their drawing */
+        if (skip > MAX_FRAME_SKIP) skip = MAX_FRAME_SKIP;
+        for (; skip && game_active; skip--)
+            update_physics();
+
         draw_scene();
+        VSync_FrameDone(&frame);
 
         if (!game_active)
         {
@@ -112,16 +207,13 @@ void StartFlappyGame(void)
                 if (k == 'C') {
                     init_game();
                     osDelay(200);
+                    VSync_Resync(&frame);
                     break;
                 }
                 if (k == '#') return;
                 osDelay(50);
             }
         }
-        else
-        {
-            osDelay(GAME_SPEED_MS);
-        }
     }
 }
 
@@ -132,6 +224,8 @@ static void init_game(void)
 {
     score = 0;
     game_active = 1;
+    full_redraw = 1;
+    scroll = 0;
 
     /* Reset Bird */
     bird.y = screen_h / 2;
@@ -172,6 +266,9 @@ static void update_physics(void)
 
     bird.y += bird.vel_y;
 
+    /* The world moves with the pipes (only used in landscape) */
+    scroll = (scroll + PIPE_SPEED) % screen_w;
+
     /* 2. Move Pipes */
     for (int i = 0; i < NUM_PIPES; i++)
     {
@@ -237,49 +334,165 @@ static int check_collision(void)
  ************************************************************/
 static void draw_scene(void)
 {
-    /* 1. Clear Background (Sky Blue) */
-    GUI_SetBkColor(0x00FFFF00); // Cyan/Sky Blue in typical RGB hex, adapt to your LCD.h definitions
-    // If color format is different, fallback to:
-    // GUI_SetBkColor(GUI_LIGHTBLUE); 
-    GUI_Clear();
+    uint32_t pixels = Gfx_GetPixelWrites();
 
-    /* 2. Draw Pipes (Green) */
-    GUI_SetColor(GUI_GREEN);
+    if (landscape) {
+        draw_scene_scrolled();
+        return;
+    }
+
+    if (full_redraw) {
+        Gfx_DrawFrame(compose_scene, NULL);
+        full_redraw = 0;
+        Perf_Report(PERF_EVT_FLAPPY_PIXELS, Gfx_GetPixelWrites() - pixels, 0);
+        return;
+    }
+
+    int score_dirty = 0;        /* Something was drawn over the score */
+
+    /* 1. Scroll pipes: only the columns they entered and left */
     for (int i = 0; i < NUM_PIPES; i++)
     {
-        /* Top Pipe segment */
-        GUI_FillRect(pipes[i].x, 0, pipes[i].x + PIPE_WIDTH, pipes[i].gap_y);
+        int x  = pipes[i].x;
+        int ox = drawn_pipe_x[i];
+        int x1, ox1;
+
+        if (x == ox) continue;
+
+        if (x > ox || ox - x > PIPE_WIDTH) {
+            /* Recycled: wipe the old pipe, draw the new one whole */
+            x1 = x + PIPE_WIDTH;
+            ox1 = ox + PIPE_WIDTH;
+            fill_sky_segments(ox, ox1, drawn_gap_y[i]);
+            draw_pipe_area(i, x, 0, x1, screen_h);
+        } else {
+            /* Leading edge: new outline + the green it slid over */
+            x1 = x + (ox - x);
+            draw_pipe_area(i, x, 0, x1, screen_h);
+            /* Trailing edge: sky where it was, outline one step left */
+            x1 = x + PIPE_WIDTH;
+            ox1 = ox + PIPE_WIDTH;
+            fill_sky_segments(x1 + 1, ox1, pipes[i].gap_y);
+            draw_pipe_area(i, x1, 0, x1, screen_h);
+        }
+
+        score_dirty |= (x <= SCORE_X1 && x + PIPE_WIDTH + (ox - x) >= SCORE_X0) ||
+                       (ox <= SCORE_X1 && ox + PIPE_WIDTH >= SCORE_X0);
+
+        drawn_pipe_x[i] = x;
+        drawn_gap_y[i] = pipes[i].gap_y;
+    }
+
+    /* 2. Bird: restore its old box, draw it in the new one */
+    if (drawn_bird_y != bird.y) {
+        restore_area(BIRD_X_POS, drawn_bird_y, BIRD_X_POS + BIRD_SIZE, drawn_bird_y + BIRD_SIZE);
+        score_dirty |= (drawn_bird_y <= SCORE_Y1);
+    }
+    draw_bird();
+    score_dirty |= (bird.y <= SCORE_Y1);
+
+    /* 3. Score */
+    draw_score(score_dirty);
+
+    Perf_Report(PERF_EVT_FLAPPY_PIXELS, Gfx_GetPixelWrites() - pixels, 0);
+}
+
+/* Pipe i as it looks inside the clip box (x0,y0)-(x1,y1), outline included */
+static void draw_pipe_area(int i, int x0, int y0, int x1, int y1)
+{
+    int px0 = pipes[i].x;
+    int px1 = pipes[i].x + PIPE_WIDTH;
+    int seg[2][2] = {
+        { 0, pipes[i].gap_y },                                  /* Top */
+        { pipes[i].gap_y + PIPE_GAP_H, screen_h - GROUND_H - 1 } /* Bottom (last row is ground) */
+    };
+
+    if (x0 < px0) x0 = px0;
+    if (x1 > px1) x1 = px1;
+    if (x0 > x1) return;
+
+    for (int s = 0; s < 2; s++)
+    {
+        int sy0 = (seg[s][0] > y0) ? seg[s][0] : y0;
+        int sy1 = (seg[s][1] < y1) ? seg[s][1] : y1;
+        if (sy0 > sy1) continue;
+
+        GUI_SetColor(GUI_GREEN);
+        fill_rect(x0, sy0, x1, sy1);
 
-        /* Bottom Pipe segment */
-        GUI_FillRect(pipes[i].x, pipes[i].gap_y + PIPE_GAP_H, 
-                     pipes[i].x + PIPE_WIDTH, screen_h - GROUND_H);
-        
-        /* Optional: Draw Pipe Outline for better visibility */
         GUI_SetColor(GUI_BLACK);
-        GUI_DrawRect(pipes[i].x, 0, pipes[i].x + PIPE_WIDTH, pipes[i].gap_y);
-        GUI_DrawRect(pipes[i].x, pipes[i].gap_y + PIPE_GAP_H, 
-                     pipes[i].x + PIPE_WIDTH, screen_h - GROUND_H);
-        GUI_SetColor(GUI_GREEN); // Reset for fill
+        if (x0 == px0) fill_rect(px0, sy0, px0, sy1);
+        if (x1 == px1) fill_rect(px1, sy0, px1, sy1);
+        if (sy0 == seg[s][0]) fill_rect(x0, sy0, x1, sy0);
+        if (s == 0 && sy1 == seg[s][1]) fill_rect(x0, sy1, x1, sy1);
     }
+}
 
-    /* 3. Draw Ground (Brown) */
-    GUI_SetColor(GUI_BROWN);
-    GUI_FillRect(0, screen_h - GROUND_H, screen_w, screen_h);
+/* Sky over the pipe segment rows only, so a bird in the gap is left alone */
+static void fill_sky_segments(int x0, int x1, int gap_y)
+{
+    if (x0 > x1) return;
+
+    GUI_SetColor(SKY_COLOR);
+    fill_rect(x0, 0, x1, gap_y);
+    fill_rect(x0, gap_y + PIPE_GAP_H, x1, screen_h - GROUND_H - 1);
+}
+
+/* Repaint the background (sky + pipes) inside a box */
+static void restore_area(int x0, int y0, int x1, int y1)
+{
+    if (y1 > screen_h - GROUND_H - 1) y1 = screen_h - GROUND_H - 1;
+
+    GUI_SetColor(SKY_COLOR);
+    fill_rect(x0, y0, x1, y1);
+
+    for (int i = 0; i < NUM_PIPES; i++)
+        draw_pipe_area(i, x0, y0, x1, y1);
+}
 
+static void draw_bird(void)
+{
     /* 4. Draw Bird (Yellow) */
     GUI_SetColor(GUI_YELLOW);
-    GUI_FillRect(BIRD_X_POS, bird.y, BIRD_X_POS + BIRD_SIZE, bird.y + BIRD_SIZE);
+    fill_rect(BIRD_X_POS, bird.y, BIRD_X_POS + BIRD_SIZE, bird.y + BIRD_SIZE);
     
     /* Bird Eye (Pixel) */
     GUI_SetColor(GUI_BLACK);
-    GUI_DrawPixel(BIRD_X_POS + BIRD_SIZE - 2, bird.y + 2);
+    fill_rect(BIRD_X_POS + BIRD_SIZE - 2, bird.y + 2, BIRD_X_POS + BIRD_SIZE - 2, bird.y + 2);
 
-    /* 5. Draw Score */
-    GUI_SetColor(GUI_BLACK); // Text Color
-    GUI_SetFont(GUI_FONT_20_ASCII);
-    char buf[16];
-    sprintf(buf, "%d", score);
-    GUI_DispStringHCenterAt(buf, screen_w / 2, 10);
+    drawn_bird_y = bird.y;
+}
+
+static void draw_score(int all)
+{
+    /* 5. Draw Score: whole box if it was drawn over, else changed digits */
+    if (all) Hud_Draw(&hud_score, score);
+    else     Hud_Update(&hud_score, score);
+}
+
+/* Whole frame, composed band by band off-screen */
+static void compose_scene(void *p)
+{
+    (void)p;
+
+    /* 1. Clear Background (Sky Blue) */
+    GUI_SetBkColor(SKY_COLOR);
+    GUI_Clear();
+
+    /* 2. Draw Pipes (Green) */
+    for (int i = 0; i < NUM_PIPES; i++)
+    {
+        draw_pipe_area(i, pipes[i].x, 0, pipes[i].x + PIPE_WIDTH, screen_h);
+        drawn_pipe_x[i] = pipes[i].x;
+        drawn_gap_y[i] = pipes[i].gap_y;
+    }
+
+    /* 3. Draw Ground (Brown) */
+    GUI_SetColor(GUI_BROWN);
+    GUI_FillRect(0, screen_h - GROUND_H, screen_w, screen_h);
+
+    draw_bird();
+    draw_score(1);
 }
 
 static void game_over_screen(void)
@@ -290,26 +503,151 @@ static void game_over_screen(void)
     int box_x = (screen_w - box_w) / 2;
     int box_y = (screen_h - box_h) / 2;
 
+    if (landscape) {
+        /* Undo the wrap so the box is not split across the seam */
+        scroll = 0;
+        full_redraw = 1;
+        draw_scene_scrolled();
+    }
+
     GUI_SetColor(GUI_WHITE);
-    GUI_FillRect(box_x, box_y, box_x + box_w, box_y + box_h);
+    fill_rect(box_x, box_y, box_x + box_w, box_y + box_h);
     GUI_SetColor(GUI_BLACK);
-    GUI_DrawRect(box_x, box_y, box_x + box_w, box_y + box_h);
+    fill_rect(box_x, box_y, box_x + box_w, box_y);
+    fill_rect(box_x, box_y + box_h, box_x + box_w, box_y + box_h);
+    fill_rect(box_x, box_y, box_x, box_y + box_h);
+    fill_rect(box_x + box_w, box_y, box_x + box_w, box_y + box_h);
 
     /* Text */
     GUI_SetBkColor(GUI_WHITE);
     GUI_SetColor(GUI_RED);
     GUI_SetFont(GUI_FONT_20_ASCII);
-    GUI_DispStringHCenterAt("GAME OVER", screen_w / 2, box_y + 10);
+    draw_text_hcenter("GAME OVER", screen_w / 2, box_y + 10, 20);
 
     GUI_SetColor(GUI_BLACK);
     GUI_SetFont(GUI_FONT_13_ASCII);
     
     char buf[32];
-    sprintf(buf, "Score: %d", score);
-    GUI_DispStringHCenterAt(buf, screen_w / 2, box_y + 35);
+    strcpy(buf, "Score: ");
+    Hud_Format(buf + 7, score);
+    draw_text_hcenter(buf, screen_w / 2, box_y + 35, 13);
     
-    sprintf(buf, "High: %d", high_score);
-    GUI_DispStringHCenterAt(buf, screen_w / 2, box_y + 50);
+    strcpy(buf, "High: ");
+    Hud_Format(buf + 6, high_score);
+    draw_text_hcenter(buf, screen_w / 2, box_y + 50, 13);
+
+    draw_text_hcenter("Press 'C' to Restart", screen_w / 2, box_y + 65, 13);
+}
+
+/************************************************************
+ * LANDSCAPE RENDERING (HARDWARE SCROLL)
+ ************************************************************/
+static void draw_scene_scrolled(void)
+{
+    uint32_t pixels = Gfx_GetPixelWrites();
+
+    if (full_redraw) {
+        LCD_X_SetScrollStart(LAND_HUD_W + scroll);
+        draw_columns(0, screen_w - 1);
+        draw_bird();
+        draw_hud();
+        drawn_scroll = scroll;
+        full_redraw = 0;
+        Perf_Report(PERF_EVT_FLAPPY_PIXELS, Gfx_GetPixelWrites() - pixels, 1);
+        return;
+    }
+
+    int dx = (scroll - drawn_scroll + screen_w) % screen_w;
+
+    /* 1. The old bird box moved with the world, restore it there */
+    if (dx || drawn_bird_y != bird.y)
+        restore_area(BIRD_X_POS - dx, drawn_bird_y, BIRD_X_POS - dx + BIRD_SIZE, drawn_bird_y + BIRD_SIZE);
+
+    /* 2. Scroll, then paint the columns that wrapped round to the right */
+    if (dx) {
+        LCD_X_SetScrollStart(LAND_HUD_W + scroll);
+        draw_columns(screen_w - dx, screen_w - 1);
+        drawn_scroll = scroll;
+    }
+
+    /* 3. Bird and HUD */
+    draw_bird();
+    if (drawn_score != score) draw_hud();
+
+    Perf_Report(PERF_EVT_FLAPPY_PIXELS, Gfx_GetPixelWrites() - pixels, 1);
+}
+
+/* Everything in screen columns x0..x1: sky, pipes, ground */
+static void draw_columns(int x0, int x1)
+{
+    GUI_SetColor(SKY_COLOR);
+    fill_rect(x0, 0, x1, screen_h - GROUND_H - 1);
+
+    for (int i = 0; i < NUM_PIPES; i++)
+        draw_pipe_area(i, x0, 0, x1, screen_h);
+
+    GUI_SetColor(GUI_BROWN);
+    fill_rect(x0, screen_h - GROUND_H, x1, screen_h - 1);
+}
+
+/* Score in the fixed area, text turned to read in landscape */
+static void draw_hud(void)
+{
+    GUI_RECT r = { 0, 0, (I16)(LCD_GetXSize() - 1), LAND_HUD_W - 1 };
+    char buf[16];
+
+    GUI_SetColor(GUI_BLACK);
+    Gfx_FillRect(r.x0, r.y0, r.x1, r.y1);
+
+    GUI_SetBkColor(GUI_BLACK);
+    GUI_SetColor(GUI_WHITE);
+    GUI_SetFont(GUI_FONT_20_ASCII);
+    Hud_Format(buf, score);
+    GUI_DispStringInRectEx(buf, &r, GUI_TA_HCENTER | GUI_TA_VCENTER, sizeof(buf), GUI_ROTATE_CW);
+
+    drawn_score = score;
+}
+
+/* Fill in game coordinates. In landscape, x becomes the GRAM line
+ * (through the scroll offset, split at the wrap) and y the column */
+static void fill_rect(int x0, int y0, int x1, int y1)
+{
+    if (!landscape) {
+        Gfx_FillRect(x0, y0, x1, y1);
+        return;
+    }
+
+    if (x0 < 0)            x0 = 0;
+    if (y0 < 0)            y0 = 0;
+    if (x1 > screen_w - 1) x1 = screen_w - 1;
+    if (y1 > screen_h - 1) y1 = screen_h - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    int px0 = screen_h - 1 - y1;
+    int px1 = screen_h - 1 - y0;
+    int line = (scroll + x0) % screen_w;
+    int n = x1 - x0 + 1;
+    int first = screen_w - line;
+
+    if (first > n) first = n;
+    Gfx_FillRect(px0, LAND_HUD_W + line, px1, LAND_HUD_W + line + first - 1);
+    if (n > first)
+        Gfx_FillRect(px0, LAND_HUD_W, px1, LAND_HUD_W + n - first - 1);
+}
+
+/* One line of text centered on x, top at y, h pixels tall */
+static void draw_text_hcenter(const char *s, int x, int y, int h)
+{
+    if (!landscape) {
+        GUI_DispStringHCenterAt(s, x, y);
+        return;
+    }
 
-    GUI_DispStringHCenterAt("Press 'C' to Restart", screen_w / 2, box_y + 65);
+    /* Only called with scroll == 0, so x maps straight to a line */
+    GUI_RECT r;
+    r.x0 = (I16)(screen_h - y - h);
+    r.x1 = (I16)(screen_h - 1 - y);
+    r.y0 = (I16)(LAND_HUD_W + x - 60);
+    r.y1 = (I16)(LAND_HUD_W + x + 60);
+    GUI_DispStringInRectEx(s, &r, GUI_TA_HCENTER | GUI_TA_VCENTER, 32, GUI_ROTATE_CW);
 }
\ No newline at end of file
@@ -2,5 +2,7 @@
 #define FLAPPY_GAME_H
 
 void StartFlappyGame(void);
+/* Same game on its side, scrolled by the LCD controller */
+void StartFlappyGameLandscape(void);
 
 #endif
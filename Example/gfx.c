@@ -0,0 +1,162 @@
+/* gfx.c */
+#include <stddef.h>
+#include <string.h>
+#include "gfx.h"
+#include "GUI.h"
+#include "LCD.h"
+#include "perf.h"
+#include "vsync.h"
+
+static uint32_t pixel_writes;
+static int      composing;          // inside Gfx_DrawFrame(), count the frame once
+static int      band_lines = GFX_BAND_LINES;
+static uint32_t pool_peak;
+static vsync_frame_t frame_vsync;   // slot of the frame Gfx_DrawFrame() pushes
+
+typedef struct {
+    gfx_draw_fn pfDraw;
+    void       *p;
+} frame_ctx_t;
+
+/* Count only the part of the rectangle that lands on the panel */
+static void count_rect(int x0, int y0, int x1, int y1)
+{
+    if (composing) return;
+
+    int xmax = LCD_GetXSize() - 1;
+    int ymax = LCD_GetYSize() - 1;
+
+    if (x0 < 0)    x0 = 0;
+    if (y0 < 0)    y0 = 0;
+    if (x1 > xmax) x1 = xmax;
+    if (y1 > ymax) y1 = ymax;
+
+    if (x1 >= x0 && y1 >= y0)
+        pixel_writes += (uint32_t)(x1 - x0 + 1) * (uint32_t)(y1 - y0 + 1);
+}
+
+void Gfx_FillRect(int x0, int y0, int x1, int y1)
+{
+    count_rect(x0, y0, x1, y1);
+    GUI_FillRect(x0, y0, x1, y1);
+}
+
+void Gfx_Clear(void)
+{
+    count_rect(0, 0, LCD_GetXSize() - 1, LCD_GetYSize() - 1);
+    GUI_Clear();
+}
+
+/************************************************************
+ * BANDED FRAME COMPOSITION
+ ************************************************************/
+static void draw_band(void *p)
+{
+    frame_ctx_t *ctx = (frame_ctx_t *)p;
+
+    ctx->pfDraw(ctx->p);
+
+    /* The band device is allocated while we are in here */
+    uint32_t used = (uint32_t)GUI_ALLOC_GetNumUsedBytes();
+    if (used > pool_peak) {
+        pool_peak = used;
+        Perf_Report(PERF_EVT_FRAME_POOL, pool_peak, (uint32_t)band_lines);
+    }
+}
+
+void Gfx_DrawFrame(gfx_draw_fn pfDraw, void *p)
+{
+    /* A whole screen takes most of a refresh: start behind the scan */
+    VSync_WaitEdge(&frame_vsync);
+    Gfx_DrawArea(0, 0, LCD_GetXSize() - 1, LCD_GetYSize() - 1, pfDraw, p);
+    VSync_FrameDone(&frame_vsync);
+}
+
+void Gfx_DrawArea(int x0, int y0, int x1, int y1, gfx_draw_fn pfDraw, void *p)
+{
+    frame_ctx_t ctx = { pfDraw, p };
+    GUI_RECT rect = { (I16)x0, (I16)y0, (I16)x1, (I16)y1 };
+    int xsize = x1 - x0 + 1;
+    int lines = band_lines;
+
+    /* Never ask for a band bigger than what is left in the pool */
+    int max_lines = GUI_ALLOC_GetNumFreeBytes() / (xsize * 2) - 1;
+    if (lines > max_lines) lines = max_lines;
+
+    composing = 1;
+    int failed = (lines < 1) || GUI_MEMDEV_Draw(&rect, draw_band, &ctx, lines, 0);
+    composing = 0;
+
+    if (failed) {
+        /* Not enough pool for even one line: fall back to direct drawing */
+        pfDraw(p);
+        return;
+    }
+
+    count_rect(x0, y0, x1, y1);
+}
+
+void Gfx_SetBandLines(int lines)
+{
+    if (lines < 1) lines = 1;
+    band_lines = lines;
+}
+
+int Gfx_GetBandLines(void)
+{
+    return band_lines;
+}
+
+uint32_t Gfx_GetPeakPoolBytes(void)
+{
+    return pool_peak;
+}
+
+/************************************************************
+ * TEXT PRE-RENDERING
+ ************************************************************/
+int Gfx_RenderText1bpp(uint8_t *pDest, int xsize, int ysize,
+                       const GUI_FONT *pFont, const char *s)
+{
+    GUI_MEMDEV_Handle hMem = GUI_MEMDEV_CreateFixed(0, 0, xsize, ysize, GUI_MEMDEV_NOTRANS,
+                                                    GUI_MEMDEV_APILIST_1, GUICC_1);
+    if (hMem == 0) return -1;
+
+    GUI_MEMDEV_Handle hOld = GUI_MEMDEV_Select(hMem);
+    GUI_COLOR old_bk = GUI_GetBkColor();
+    GUI_COLOR old_fg = GUI_GetColor();
+    int old_tm = GUI_SetTextMode(GUI_TM_TRANS);
+
+    GUI_SetBkColor(GUI_BLACK);
+    GUI_Clear();
+    GUI_SetColor(GUI_WHITE);
+    GUI_SetFont(pFont);
+
+    GUI_RECT r = { 0, 0, (I16)(xsize - 1), (I16)(ysize - 1) };
+    GUI_DispStringInRect(s, &r, GUI_TA_HCENTER | GUI_TA_VCENTER);
+
+    /* Device lines are padded to 16 bits, bitmap lines to 8 */
+    const uint8_t *pSrc = (const uint8_t *)GUI_MEMDEV_GetDataPtr(hMem);
+    size_t src_stride = (size_t)((xsize + 15) / 16) * 2;
+    size_t dst_stride = (size_t)((xsize + 7) / 8);
+
+    for (int y = 0; y < ysize; y++)
+        memcpy(pDest + y * dst_stride, pSrc + y * src_stride, dst_stride);
+
+    GUI_SetTextMode(old_tm);
+    GUI_SetColor(old_fg);
+    GUI_SetBkColor(old_bk);
+    GUI_MEMDEV_Select(hOld);
+    GUI_MEMDEV_Delete(hMem);
+    return 0;
+}
+
+uint32_t Gfx_GetPixelWrites(void)
+{
+    return pixel_writes;
+}
+
+void Gfx_ResetPixelWrites(void)
+{
+    pixel_writes = 0;
+}
@@ -0,0 +1,42 @@
+/* gfx.h */
+#ifndef GFX_H
+#define GFX_H
+
+#include <stdint.h>
+#include "GUI.h"
+
+/************************************************************
+ * DRAWING HELPERS SHARED BY THE GAMES
+ * Thin wrappers around emWin that count how many pixels are
+ * pushed to the LCD, so renderers can be compared.
+ ************************************************************/
+
+/* Default band height for frame composition. A 240 px wide band
+ * costs 480 bytes per line of the GUI_NUMBYTES pool (64 KB). */
+#define GFX_BAND_LINES   48
+
+typedef void (*gfx_draw_fn)(void *p);
+
+void     Gfx_FillRect(int x0, int y0, int x1, int y1);
+void     Gfx_Clear(void);
+
+/* Build a whole frame off-screen in horizontal bands and copy
+ * each finished band to the LCD in one go. pfDraw is called
+ * once per band and must repaint everything (it is clipped). */
+void     Gfx_DrawFrame(gfx_draw_fn pfDraw, void *p);
+/* Same, limited to one rectangle of the screen */
+void     Gfx_DrawArea(int x0, int y0, int x1, int y1, gfx_draw_fn pfDraw, void *p);
+void     Gfx_SetBandLines(int lines);
+int      Gfx_GetBandLines(void);
+uint32_t Gfx_GetPeakPoolBytes(void);
+
+/* Rasterize a string once, centered, into a 1bpp buffer laid out
+ * like a GUI_BITMAP ((xsize + 7) / 8 bytes per line, MSB first).
+ * Glyph pixels are 1, background 0. Returns 0 on success. */
+int      Gfx_RenderText1bpp(uint8_t *pDest, int xsize, int ysize,
+                            const GUI_FONT *pFont, const char *s);
+
+uint32_t Gfx_GetPixelWrites(void);
+void     Gfx_ResetPixelWrites(void);
+
+#endif
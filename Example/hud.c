@@ -0,0 +1,244 @@
+/* hud.c */
+#include <stddef.h>
+#include <string.h>
+#include "hud.h"
+#include "gfx.h"
+#include "dlist.h"
+
+#define HUD_CELL_BYTES   (((HUD_CELL_MAX_W + 7) / 8) * HUD_CELL_MAX_H)
+#define HUD_NUM_ATLAS    2          /* Fonts in use at the same time */
+#define HUD_INVALID      '\xff'     /* Never a cell value */
+
+typedef struct {
+    const GUI_FONT *pFont;
+    int     w, h;
+    uint8_t bits[10][HUD_CELL_BYTES];
+} hud_atlas_t;
+
+static hud_atlas_t atlas[HUD_NUM_ATLAS];
+
+/************************************************************
+ * DIGIT ATLAS
+ ************************************************************/
+static const hud_atlas_t *get_atlas(const GUI_FONT *pFont)
+{
+    hud_atlas_t *a = NULL;
+
+    for (int i = 0; i < HUD_NUM_ATLAS; i++) {
+        if (atlas[i].pFont == pFont) return &atlas[i];
+        if (atlas[i].pFont == NULL && a == NULL) a = &atlas[i];
+    }
+    if (a == NULL) return NULL;     // styles point into the atlas, never evict
+
+    /* Cell = widest digit x font height */
+    GUI_SetFont(pFont);
+    int w = 0;
+    for (int d = 0; d < 10; d++) {
+        int dw = GUI_GetCharDistX((U16)('0' + d));
+        if (dw > w) w = dw;
+    }
+    int h = GUI_GetFontSizeY();
+    if (w > HUD_CELL_MAX_W || h > HUD_CELL_MAX_H) return NULL;
+
+    char s[2] = { 0, 0 };
+    for (int d = 0; d < 10; d++) {
+        s[0] = (char)('0' + d);
+        if (Gfx_RenderText1bpp(a->bits[d], w, h, pFont, s) != 0) return NULL;
+    }
+    a->pFont = pFont;
+    a->w = w;
+    a->h = h;
+    return a;
+}
+
+int Hud_StyleInit(hud_style_t *s, const GUI_FONT *pFont, GUI_COLOR color, GUI_COLOR bk_color)
+{
+    const hud_atlas_t *a = get_atlas(pFont);
+    int rev = (GUI_GetTextMode() & GUI_TM_REV) != 0;
+
+    s->pFont     = pFont;
+    s->colors[0] = rev ? color : bk_color;
+    s->colors[1] = rev ? bk_color : color;
+
+    if (a == NULL) {
+        /* No atlas: cells sized like get_atlas() would, digits drawn as text */
+        GUI_SetFont(pFont);
+        s->cell_w = 0;
+        for (int d = 0; d < 10; d++) {
+            int dw = GUI_GetCharDistX((U16)('0' + d));
+            if (dw > s->cell_w) s->cell_w = dw;
+            s->digit[d].pData = NULL;
+        }
+        s->cell_h = GUI_GetFontSizeY();
+        return -1;
+    }
+
+    s->cell_w    = a->w;
+    s->cell_h    = a->h;
+
+    s->pal.NumEntries  = 2;
+    s->pal.HasTrans    = 0;
+    s->pal.pPalEntries = s->colors;
+
+    for (int d = 0; d < 10; d++) {
+        s->digit[d].XSize        = (U16)a->w;
+        s->digit[d].YSize        = (U16)a->h;
+        s->digit[d].BytesPerLine = (U16)((a->w + 7) / 8);
+        s->digit[d].BitsPerPixel = 1;
+        s->digit[d].pData        = a->bits[d];
+        s->digit[d].pPal         = &s->pal;
+        s->digit[d].pMethods     = NULL;
+    }
+    return 0;
+}
+
+/************************************************************
+ * LABELS
+ ************************************************************/
+int Hud_Label(const hud_style_t *s, const char *text, int x, int y)
+{
+    int rev = (GUI_GetTextMode() & GUI_TM_REV) != 0;
+
+    /* Undo the swap done at init, the text mode applies it again */
+    GUI_SetColor(s->colors[rev ? 0 : 1]);
+    GUI_SetBkColor(s->colors[rev ? 1 : 0]);
+    GUI_SetFont(s->pFont);
+    GUI_DispStringAt(text, x, y);
+    return x + GUI_GetStringDistX(text);
+}
+
+int Hud_LabelWidth(const hud_style_t *s, const char *text)
+{
+    GUI_SetFont(s->pFont);
+    return GUI_GetStringDistX(text);
+}
+
+/************************************************************
+ * FIELDS
+ ************************************************************/
+void Hud_FieldInit(hud_field_t *f, const hud_style_t *s, int x, int y, int digits)
+{
+    if (digits > HUD_MAX_DIGITS) digits = HUD_MAX_DIGITS;
+
+    f->pStyle = s;
+    f->x      = (int16_t)x;
+    f->y      = (int16_t)y;
+    f->digits = (uint8_t)digits;
+    f->dlist  = 0;
+    Hud_Invalidate(f);
+}
+
+int Hud_FieldWidth(const hud_field_t *f)
+{
+    return f->digits * f->pStyle->cell_w;
+}
+
+void Hud_Invalidate(hud_field_t *f)
+{
+    memset(f->shown, HUD_INVALID, sizeof(f->shown));
+}
+
+/* Value -> left aligned cells, '0'..'9' or ' ' for blank */
+static void to_cells(const hud_field_t *f, int32_t value, char *cells)
+{
+    char buf[12];
+    int32_t max = 1;
+
+    for (int i = 0; i < f->digits; i++) max *= 10;
+    if (value < 0)    value = 0;
+    if (value >= max) value = max - 1;
+
+    int n = Hud_Format(buf, value);
+    for (int i = 0; i < f->digits; i++)
+        cells[i] = (i < n) ? buf[i] : ' ';
+}
+
+/* Style without an atlas: blank the cell, then the glyph as text */
+static void put_text_cell(const hud_field_t *f, int x, char c, int direct)
+{
+    const hud_style_t *s = f->pStyle;
+    int rev = (GUI_GetTextMode() & GUI_TM_REV) != 0;
+    char str[2] = { c, 0 };
+
+    if (direct || !f->dlist) {
+        GUI_SetColor(s->colors[0]);
+        Gfx_FillRect(x, f->y, x + s->cell_w - 1, f->y + s->cell_h - 1);
+        GUI_SetColor(s->colors[rev ? 0 : 1]);
+        GUI_SetBkColor(s->colors[rev ? 1 : 0]);
+        GUI_SetFont(s->pFont);
+        GUI_DispStringAt(str, x, f->y);
+    } else {
+        DL_FillRect(x, f->y, x + s->cell_w - 1, f->y + s->cell_h - 1, s->colors[0]);
+        DL_Text(str, x, f->y, s->pFont, s->colors[rev ? 0 : 1], s->colors[rev ? 1 : 0]);
+    }
+}
+
+static void put_cell(const hud_field_t *f, int i, char c, int direct)
+{
+    const hud_style_t *s = f->pStyle;
+    int x = f->x + i * s->cell_w;
+
+    if (c == ' ') {
+        if (direct || !f->dlist) {
+            GUI_SetColor(s->colors[0]);
+            Gfx_FillRect(x, f->y, x + s->cell_w - 1, f->y + s->cell_h - 1);
+        } else {
+            DL_FillRect(x, f->y, x + s->cell_w - 1, f->y + s->cell_h - 1, s->colors[0]);
+        }
+        return;
+    }
+
+    if (s->digit[c - '0'].pData == NULL) {
+        put_text_cell(f, x, c, direct);
+        return;
+    }
+
+    if (direct || !f->dlist) GUI_DrawBitmap(&s->digit[c - '0'], x, f->y);
+    else                     DL_Bitmap(&s->digit[c - '0'], x, f->y);
+}
+
+void Hud_Draw(hud_field_t *f, int32_t value)
+{
+    char cells[HUD_MAX_DIGITS];
+
+    to_cells(f, value, cells);
+    for (int i = 0; i < f->digits; i++) {
+        put_cell(f, i, cells[i], 1);
+        f->shown[i] = cells[i];
+    }
+}
+
+int Hud_Update(hud_field_t *f, int32_t value)
+{
+    char cells[HUD_MAX_DIGITS];
+    int drawn = 0;
+
+    to_cells(f, value, cells);
+    for (int i = 0; i < f->digits; i++) {
+        if (cells[i] == f->shown[i]) continue;
+        put_cell(f, i, cells[i], 0);
+        f->shown[i] = cells[i];
+        drawn++;
+    }
+    return drawn;
+}
+
+/************************************************************
+ * INTEGER -> TEXT
+ ************************************************************/
+int Hud_Format(char *buf, int32_t value)
+{
+    char tmp[11];
+    int n = 0, len = 0;
+    uint32_t v = (value < 0) ? 0U - (uint32_t)value : (uint32_t)value;
+
+    do {
+        tmp[n++] = (char)('0' + v % 10U);
+        v /= 10U;
+    } while (v);
+
+    if (value < 0) buf[len++] = '-';
+    while (n) buf[len++] = tmp[--n];
+    buf[len] = '\0';
+    return len;
+}
@@ -0,0 +1,63 @@
+/* hud.h */
+#ifndef HUD_FIELDS_H
+#define HUD_FIELDS_H
+
+#include <stdint.h>
+#include "GUI.h"
+
+/************************************************************
+ * HUD FIELDS
+ * Numbers are drawn from a digit atlas rasterized once per
+ * font, so a frame costs no formatting and no glyph
+ * rendering. A field remembers what it shows and redraws only
+ * the digit cells that changed.
+ ************************************************************/
+
+#define HUD_MAX_DIGITS   6
+#define HUD_CELL_MAX_W   16     /* Atlas limits, enough for 20 px fonts */
+#define HUD_CELL_MAX_H   24
+
+/* Font + colors, with one ready-made bitmap per digit. Colors follow
+ * the text mode at init time (GUI_TM_REV swaps them, as for text). */
+typedef struct {
+    const GUI_FONT *pFont;
+    GUI_COLOR       colors[2];          /* [0] background, [1] digit */
+    GUI_LOGPALETTE  pal;
+    GUI_BITMAP      digit[10];
+    int             cell_w, cell_h;
+} hud_style_t;
+
+typedef struct {
+    const hud_style_t *pStyle;
+    int16_t x, y;
+    uint8_t digits;                     /* Box width in cells, left aligned */
+    uint8_t dlist;                      /* Queue on the display list */
+    char    shown[HUD_MAX_DIGITS];      /* Cell contents on screen */
+} hud_field_t;
+
+/* Returns 0 on success, -1 if the font is too big for the atlas or
+ * the atlas is full. The style is usable either way: without an
+ * atlas its fields draw their digits as text, only slower. */
+int  Hud_StyleInit(hud_style_t *s, const GUI_FONT *pFont, GUI_COLOR color, GUI_COLOR bk_color);
+
+/* Static text in the style's font and colors. Returns the x just
+ * past it, where a field can start. Drawn directly. */
+int  Hud_Label(const hud_style_t *s, const char *text, int x, int y);
+int  Hud_LabelWidth(const hud_style_t *s, const char *text);
+
+void Hud_FieldInit(hud_field_t *f, const hud_style_t *s, int x, int y, int digits);
+int  Hud_FieldWidth(const hud_field_t *f);
+
+/* Whole box, unconditionally and directly (full or banded redraws) */
+void Hud_Draw(hud_field_t *f, int32_t value);
+/* Only the cells that differ from what is shown. Returns the number
+ * of cells drawn. */
+int  Hud_Update(hud_field_t *f, int32_t value);
+/* Screen under the field was overwritten: next update draws it all */
+void Hud_Invalidate(hud_field_t *f);
+
+/* Decimal text without the C library formatter. Negative values
+ * get a '-'. Returns the length; buf needs 12 bytes. */
+int  Hud_Format(char *buf, int32_t value);
+
+#endif
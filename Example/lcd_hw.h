@@ -0,0 +1,41 @@
+/* lcd_hw.h */
+#ifndef LCD_HW_H
+#define LCD_HW_H
+
+#include "GUI.h"
+
+/************************************************************
+ * HX8347-D CONTROLLER EXTRAS
+ * Features emWin does not know about, implemented next to the
+ * port functions in RTE/Graphics/LCDConf_MCBQVGA_LG.c.
+ * All values are physical GRAM lines (0..319, portrait rows).
+ ************************************************************/
+
+/* Vertical scroll: tfa fixed lines at the top, vsa scrolling
+ * lines, bfa fixed lines at the bottom (tfa + vsa + bfa = 320) */
+void LCD_X_SetScrollArea(int tfa, int vsa, int bfa);
+/* GRAM line shown on the first line of the scroll area */
+void LCD_X_SetScrollStart(int vsp);
+void LCD_X_EnableScroll(int on);
+
+/* Tearing effect output: one pulse per panel frame */
+void LCD_X_EnableTE(int on);
+
+/* Bulk pixel write (16-bit IF: DMA2 into the FSMC data address).
+ * Returns at once; pfDone runs in the DMA interrupt when done.
+ * The buffer must not be in CCM RAM. Short runs go out on the
+ * CPU before returning (result 1). */
+int  LCD_X_WriteM1_16_Async(const U16 *pData, int NumWords,
+                            void (*pfDone)(void *p), void *p);
+/* Sleep until the bus is free again; any number of threads may
+ * wait, all of them wake at the end of the transfer */
+void LCD_X_WaitM1_16(void);
+
+/* One black frame through the bulk hook and through a plain
+ * per-word loop (CPU copy on FSMC, one transfer per pixel on SPI),
+ * results in kB/s. Only while the screen is black. emWin's bulk
+ * hook is synchronous: the caller sleeps through each transfer,
+ * so the rate is bus throughput, not time handed back to it. */
+void LCD_X_Benchmark(U32 *pHook_kBps, U32 *pRef_kBps);
+
+#endif
@@ -0,0 +1,39 @@
+/* perf.c */
+#include "perf.h"
+#include "cmsis_os2.h"
+#ifdef _RTE_
+#include "RTE_Components.h"
+#endif
+#ifdef RTE_Compiler_EventRecorder
+#include "EventRecorder.h"
+#endif
+
+void Perf_Init(void)
+{
+#ifdef RTE_Compiler_EventRecorder
+    /* RTX already initialized the recorder (OS_EVR_INIT), just enable ours */
+    EventRecorderEnable(EventRecordAll, PERF_EVR_COMPONENT, PERF_EVR_COMPONENT);
+#endif
+}
+
+/* Free running cycle counter (SysTick based, CPU clock) */
+uint32_t Perf_Cycles(void)
+{
+    return osKernelGetSysTimerCount();
+}
+
+uint32_t Perf_CyclesToUs(uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)cycles * 1000000U) / osKernelGetSysTimerFreq());
+}
+
+void Perf_Report(uint32_t msg, uint32_t val1, uint32_t val2)
+{
+#ifdef RTE_Compiler_EventRecorder
+    EventRecord2(EventID(EventLevelOp, PERF_EVR_COMPONENT, msg), val1, val2);
+#else
+    (void)msg;
+    (void)val1;
+    (void)val2;
+#endif
+}
@@ -0,0 +1,41 @@
+/* perf.h */
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdint.h>
+
+/************************************************************
+ * TIMING & EVENT RECORDER REPORTING
+ * Measurements are sent to the uVision Event Recorder window
+ * (Debug target). In the Release target reporting is a no-op.
+ ************************************************************/
+
+#define PERF_EVR_COMPONENT      0x01    /* User component number */
+
+/* Message numbers: val1 / val2 meaning */
+#define PERF_EVT_SNAKE_PIXELS   0x01    /* pixels this tick / full frame */
+#define PERF_EVT_FRAME_POOL     0x02    /* peak GUI pool bytes / band lines */
+#define PERF_EVT_2048_ANIM      0x03    /* slowest frame us / frames over budget */
+#define PERF_EVT_BRICK_PIXELS   0x04    /* pixels this frame / - */
+#define PERF_EVT_FLAPPY_PIXELS  0x05    /* pixels this frame / 1 = landscape */
+#define PERF_EVT_LCD_BANDWIDTH  0x06    /* bulk hook kB/s / per-word loop kB/s */
+#define PERF_EVT_RENDER         0x07    /* render thread batch us / commands */
+#define PERF_EVT_VSYNC          0x08    /* missed slots / late frames (totals) */
+#define PERF_EVT_SNAKE_MOVE     0x09    /* move_snake() cycles / snake length */
+#define PERF_EVT_SNAKE_FRUIT    0x0A    /* worst place_fruit() cycles / free cells */
+#define PERF_EVT_SNAKE_RAM      0x0B    /* snake + autopilot/rival state bytes / grid cells */
+#define PERF_EVT_SNAKE_AI       0x0C    /* autopilot decision cycles / snake length */
+#define PERF_EVT_SNAKE_INPUT    0x0D    /* key press to move ms / turns still queued */
+#define PERF_EVT_SNAKE_RIVAL    0x0E    /* one rival's move cycles / rival index */
+#define PERF_EVT_2048_MOVE      0x0F    /* bitboard move cycles / direction */
+#define PERF_EVT_2048_AI        0x10    /* solver search depth / nodes per second */
+#define PERF_EVT_2048_GAME      0x11    /* final score / games finished */
+#define PERF_EVT_2048_SIZE      0x12    /* board size's table flash bytes / state RAM bytes */
+#define PERF_EVT_2048_SEED      0x13    /* new game's spawn seed / board size */
+
+void     Perf_Init(void);
+uint32_t Perf_Cycles(void);
+uint32_t Perf_CyclesToUs(uint32_t cycles);
+void     Perf_Report(uint32_t msg, uint32_t val1, uint32_t val2);
+
+#endif
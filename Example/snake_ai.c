@@ -0,0 +1,393 @@
+/* snake_ai.c */
+#include <string.h>
+#include "snake_ai.h"
+#include "snake_game.h"
+
+static int ai_w, ai_h, ai_cells;
+static int ai_cols;                 // cycle laid out on columns (odd number of rows)
+
+/* Scratch shared by the autopilot's BFS and the field repairs. Both
+ * run on the game thread and keep nothing in it between calls; the
+ * bitmap is all clear whenever neither is running. */
+static uint8_t mark[(MAX_CELLS + 7) / 8] SNAKE_CCM;   // BFS: cells seen; field: cells queued
+static union {
+    struct {
+        uint16_t queue[SNAKE_AI_BFS_NODES];
+        uint16_t qdist[SNAKE_AI_BFS_NODES];
+    } bfs;
+    uint16_t fd_work[MAX_CELLS];                  // invalidated cells, then the relax queue
+} scratch SNAKE_CCM;
+
+/* Distance field, kept across ticks */
+#define FD_INF      0xFFFF
+static uint16_t       fd_dist[MAX_CELLS] SNAKE_CCM;
+static const uint8_t *fd_occupied;
+static int            fd_target, fd_wrap;
+static int            fd_stale = 1;               // rebuild before the next query
+
+/************************************************************
+ * HAMILTONIAN CYCLE
+ * Row 0 left to right, then rows 1..h-1 back and forth over
+ * columns 1..w-1, then up column 0. Needs an even number of
+ * rows; with an odd one the same is done on columns. The
+ * position of a cell is computed, nothing is stored.
+ ************************************************************/
+static int tour_index(int cell)
+{
+    int x = cell % ai_w, y = cell / ai_w;
+    int w = ai_w, h = ai_h;
+
+    if (ai_cols) {
+        int t;
+        t = x; x = y; y = t;
+        t = w; w = h; h = t;
+    }
+
+    if (y == 0) return x;
+    if (x == 0) return w + (h - 1) * (w - 1) + (h - 1 - y);
+
+    int base = w + (y - 1) * (w - 1);
+    return (y & 1) ? base + (w - 1 - x) : base + (x - 1);
+}
+
+/* Steps along the cycle from a to b */
+static int tour_dist(int a, int b)
+{
+    int d = tour_index(b) - tour_index(a);
+    return (d < 0) ? d + ai_cells : d;
+}
+
+/* The four neighbours of a cell in SNAKE_AI_* order, -1 off the board */
+static void neighbours(int cell, int wrap, int nb[4])
+{
+    int x = cell % ai_w, y = cell / ai_w;
+    int last = ai_cells - ai_w;
+
+    nb[SNAKE_AI_UP]    = (y > 0)        ? cell - ai_w : (wrap ? cell + last : -1);
+    nb[SNAKE_AI_DOWN]  = (y < ai_h - 1) ? cell + ai_w : (wrap ? cell - last : -1);
+    nb[SNAKE_AI_LEFT]  = (x > 0)        ? cell - 1    : (wrap ? cell + ai_w - 1 : -1);
+    nb[SNAKE_AI_RIGHT] = (x < ai_w - 1) ? cell + 1    : (wrap ? cell - ai_w + 1 : -1);
+}
+
+static int bit_test(const uint8_t *bits, int i)
+{
+    return (bits[i >> 3] >> (i & 7)) & 1;
+}
+
+int SnakeAI_Init(int grid_w, int grid_h)
+{
+    if (grid_w < 2 || grid_h < 2 || grid_w * grid_h > MAX_CELLS) return -1;
+
+    ai_w     = grid_w;
+    ai_h     = grid_h;
+    ai_cells = grid_w * grid_h;
+    ai_cols  = (grid_h & 1);
+
+    /* CCM is not cleared at startup, and the 2048 solver's table
+     * shares it between games */
+    memset(mark, 0, sizeof(mark));
+    fd_stale = 1;
+
+    /* No Hamiltonian cycle, the distance field still works */
+    return ((grid_w & 1) && (grid_h & 1)) ? -1 : 0;
+}
+
+void SnakeAI_StartCells(int *pTail, int *pHead)
+{
+    int head = (ai_h / 2) * ai_w + ai_w / 2;
+    int prev = tour_index(head) - 1;
+    int nb[4];
+
+    if (prev < 0) prev += ai_cells;
+
+    /* The cell before it on the cycle is always a plain neighbour */
+    neighbours(head, 0, nb);
+    for (int dir = 0; dir < 4; dir++) {
+        if (nb[dir] >= 0 && tour_index(nb[dir]) == prev) {
+            *pTail = nb[dir];
+            break;
+        }
+    }
+    *pHead = head;
+}
+
+/************************************************************
+ * DECISION
+ * A move of d steps along the cycle is allowed as long as it
+ * stays well short of the tail and does not pass the fruit
+ * (same limits as the usual cycle-with-shortcuts player; no
+ * cuts at all once half the board is snake). Of the allowed
+ * moves the one nearest the fruit by BFS wins, ties and cells
+ * the BFS did not reach go to the longer cut.
+ ************************************************************/
+int SnakeAI_NextDir(const snake_ai_board_t *pBoard)
+{
+    int head      = pBoard->head;
+    int to_tail   = tour_dist(head, pBoard->tail);
+    int to_fruit  = tour_dist(head, pBoard->fruit);
+    int empty     = ai_cells - pBoard->len - 1;
+    int cut       = to_tail - pBoard->len - 3;
+
+    if (empty < ai_cells / 2) {
+        cut = 0;
+    } else if (to_fruit < to_tail) {
+        cut -= 1;                               // it grows on the way
+        if ((to_tail - to_fruit) * 4 > empty)
+            cut -= 10;
+    }
+    if (cut > to_fruit) cut = to_fruit;
+
+    /* Free neighbours of the head and their cycle distance */
+    int cand[4], jump[4], dist[4], nb[4];
+    int want = 0;
+
+    neighbours(head, pBoard->wrap, nb);
+    for (int dir = 0; dir < 4; dir++) {
+        int c = nb[dir];
+
+        cand[dir] = -1;
+        dist[dir] = 0xFFFF;
+        if (c < 0 || bit_test(pBoard->pOccupied, c)) continue;
+
+        cand[dir] = c;
+        jump[dir] = tour_dist(head, c);
+        if (jump[dir] <= cut) want |= 1 << dir;
+    }
+
+    /* Only one way to go: no need to rank it */
+    if (want && !(want & (want - 1))) {
+        for (int dir = 0; dir < 4; dir++)
+            if (want == (1 << dir)) return dir;
+    }
+
+    /* BFS from the fruit until every allowed neighbour has a distance */
+    if (want) {
+        uint8_t  *seen  = mark;
+        uint16_t *queue = scratch.bfs.queue;
+        uint16_t *qdist = scratch.bfs.qdist;
+        int n = 0;
+
+        memcpy(seen, pBoard->pOccupied, (size_t)(ai_cells + 7) / 8);
+        seen[pBoard->fruit >> 3] |= (uint8_t)(1u << (pBoard->fruit & 7));
+        queue[n] = (uint16_t)pBoard->fruit;
+        qdist[n++] = 0;
+
+        for (int dir = 0; dir < 4; dir++)
+            if (cand[dir] == pBoard->fruit) dist[dir] = 0;
+
+        int pending = want;
+        for (int q = 0; q < n && pending; q++) {
+            neighbours(queue[q], pBoard->wrap, nb);
+            for (int dir = 0; dir < 4; dir++) {
+                int c = nb[dir];
+                if (c < 0 || bit_test(seen, c)) continue;
+                seen[c >> 3] |= (uint8_t)(1u << (c & 7));
+
+                for (int k = 0; k < 4; k++) {
+                    if (cand[k] == c) {
+                        dist[k] = qdist[q] + 1;
+                        pending &= ~(1 << k);
+                    }
+                }
+                if (n < SNAKE_AI_BFS_NODES) {
+                    queue[n]   = (uint16_t)c;
+                    qdist[n++] = (uint16_t)(qdist[q] + 1);
+                }
+            }
+        }
+
+        memset(seen, 0, (size_t)(ai_cells + 7) / 8);    // the field expects it clear
+
+        int best = -1;
+        for (int dir = 0; dir < 4; dir++) {
+            if (!(want & (1 << dir))) continue;
+            if (best < 0 || dist[dir] < dist[best] ||
+                (dist[dir] == dist[best] && jump[dir] > jump[best]))
+                best = dir;
+        }
+        return best;
+    }
+
+    /* No cut allowed: next cell on the cycle */
+    for (int dir = 0; dir < 4; dir++)
+        if (cand[dir] >= 0 && jump[dir] == 1) return dir;
+
+    /* Off the cycle (should not happen): any free cell */
+    for (int dir = 0; dir < 4; dir++)
+        if (cand[dir] >= 0) return dir;
+
+    return SNAKE_AI_UP;
+}
+
+/************************************************************
+ * DISTANCE FIELD
+ * BFS steps from every free cell to the target, shared by all
+ * snakes chasing it. Only a moved target rebuilds it; a cell
+ * taken or freed repairs the part of the field it changes.
+ ************************************************************/
+static void fd_push(int *pTail, int c)
+{
+    if (bit_test(mark, c)) return;
+    mark[c >> 3] |= (uint8_t)(1u << (c & 7));
+    scratch.fd_work[*pTail] = (uint16_t)c;
+    *pTail = (*pTail + 1 == ai_cells) ? 0 : *pTail + 1;
+}
+
+/* Lower the neighbours of queued cells until nothing changes.
+ * The queue holds every cell at most once, so it cannot overrun. */
+static void fd_relax(int head, int tail)
+{
+    int nb[4];
+
+    while (head != tail) {
+        int c = scratch.fd_work[head];
+        head = (head + 1 == ai_cells) ? 0 : head + 1;
+        mark[c >> 3] &= (uint8_t)~(1u << (c & 7));
+
+        neighbours(c, fd_wrap, nb);
+        for (int dir = 0; dir < 4; dir++) {
+            int n = nb[dir];
+            if (n < 0 || bit_test(fd_occupied, n)) continue;
+            if (fd_dist[c] + 1 < fd_dist[n]) {
+                fd_dist[n] = (uint16_t)(fd_dist[c] + 1);
+                fd_push(&tail, n);
+            }
+        }
+    }
+}
+
+static void fd_rebuild(void)
+{
+    int tail = 0;
+
+    for (int i = 0; i < ai_cells; i++) fd_dist[i] = FD_INF;
+    memset(mark, 0, sizeof(mark));
+
+    fd_dist[fd_target] = 0;
+    fd_push(&tail, fd_target);
+    fd_relax(0, tail);
+    fd_stale = 0;
+}
+
+/* Lowest cell next to c that is still valid, + 1 */
+static uint16_t fd_best_neighbour(int c)
+{
+    uint16_t best = FD_INF;
+    int nb[4];
+
+    neighbours(c, fd_wrap, nb);
+    for (int dir = 0; dir < 4; dir++) {
+        int n = nb[dir];
+        if (n < 0 || bit_test(fd_occupied, n)) continue;
+        if (fd_dist[n] != FD_INF && fd_dist[n] + 1 < best) best = (uint16_t)(fd_dist[n] + 1);
+    }
+    return best;
+}
+
+void SnakeAI_FieldInit(const uint8_t *pOccupied, int wrap)
+{
+    fd_occupied = pOccupied;
+    fd_wrap     = wrap;
+    fd_target   = 0;
+    fd_stale    = 1;
+}
+
+void SnakeAI_FieldTarget(int cell)
+{
+    fd_target = cell;
+    fd_stale  = 1;
+}
+
+void SnakeAI_FieldTake(int cell)
+{
+    if (fd_stale) return;
+    if (cell == fd_target) { fd_stale = 1; return; }
+
+    uint16_t old = fd_dist[cell];
+    fd_dist[cell] = FD_INF;
+    if (old == FD_INF) return;
+
+    int nb[4];
+    int n_list = 0;
+
+    /* Walk outward from the cell, one distance level at a time. A cell
+     * keeps its distance if a neighbour one step closer still has one.
+     * Whole levels are settled before the next, so that test is final. */
+    neighbours(cell, fd_wrap, nb);
+    for (int dir = 0; dir < 4; dir++) {
+        int n = nb[dir];
+        if (n >= 0 && !bit_test(fd_occupied, n) && fd_dist[n] == old + 1 && !bit_test(mark, n)) {
+            mark[n >> 3] |= (uint8_t)(1u << (n & 7));
+            scratch.fd_work[n_list++] = (uint16_t)n;
+        }
+    }
+
+    for (int i = 0; i < n_list; i++) {
+        int      c = scratch.fd_work[i];
+        uint16_t d = fd_dist[c];
+        int      held = 0;
+
+        neighbours(c, fd_wrap, nb);
+        for (int dir = 0; dir < 4 && !held; dir++) {
+            int n = nb[dir];
+            held = (n >= 0 && !bit_test(fd_occupied, n) && fd_dist[n] == d - 1);
+        }
+        if (held) continue;
+
+        fd_dist[c] = FD_INF;
+        for (int dir = 0; dir < 4; dir++) {
+            int n = nb[dir];
+            if (n >= 0 && !bit_test(fd_occupied, n) && fd_dist[n] == d + 1 && !bit_test(mark, n)) {
+                mark[n >> 3] |= (uint8_t)(1u << (n & 7));
+                scratch.fd_work[n_list++] = (uint16_t)n;
+            }
+        }
+    }
+
+    /* Give the cells that lost their distance the best one next to them,
+     * then relax from those. The list is compacted into the queue. */
+    int tail = 0;
+    for (int i = 0; i < n_list; i++) {
+        int c = scratch.fd_work[i];
+
+        mark[c >> 3] &= (uint8_t)~(1u << (c & 7));
+        if (fd_dist[c] != FD_INF) continue;
+
+        fd_dist[c] = fd_best_neighbour(c);
+        if (fd_dist[c] != FD_INF) fd_push(&tail, c);
+    }
+    fd_relax(0, tail);
+}
+
+void SnakeAI_FieldFree(int cell)
+{
+    if (fd_stale) return;
+
+    int tail = 0;
+    fd_dist[cell] = fd_best_neighbour(cell);
+    if (fd_dist[cell] != FD_INF) {
+        fd_push(&tail, cell);
+        fd_relax(0, tail);
+    }
+}
+
+int SnakeAI_FieldDir(int head)
+{
+    int best = -1, nb[4];
+    uint32_t best_d = 0;
+
+    if (fd_stale) fd_rebuild();
+
+    /* Closest free neighbour; one the target cannot be reached from
+     * still beats running into something */
+    neighbours(head, fd_wrap, nb);
+    for (int dir = 0; dir < 4; dir++) {
+        int n = nb[dir];
+        if (n < 0 || bit_test(fd_occupied, n)) continue;
+        if (best < 0 || fd_dist[n] < best_d) {
+            best   = dir;
+            best_d = fd_dist[n];
+        }
+    }
+    return best;
+}
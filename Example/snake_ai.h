@@ -0,0 +1,65 @@
+/* snake_ai.h */
+#ifndef SNAKE_AI_H
+#define SNAKE_AI_H
+
+#include <stdint.h>
+
+/************************************************************
+ * SNAKE AUTOPILOT
+ * Follows a fixed Hamiltonian cycle over the board, which can
+ * never trap the snake, and cuts across it toward the fruit
+ * when the cut cannot run into the tail. Cuts are ranked by a
+ * BFS from the fruit limited to SNAKE_AI_BFS_NODES cells, so
+ * one decision has a fixed worst case.
+ *
+ * The rival snakes steer on a distance field to the fruit
+ * that is repaired cell by cell as bodies move.
+ *
+ * Plain C on top of the occupancy bitmap, no emWin or RTOS
+ * calls, so it also builds and runs on a PC.
+ ************************************************************/
+
+#define SNAKE_AI_BFS_NODES  1024    /* Cells queued per decision, at most */
+
+/* Static RAM for a MAX_CELLS board (snake_game.h): a bitmap and a
+ * scratch queue shared by the BFS and the field, plus the field */
+#define SNAKE_AI_SCRATCH_BYTES  ((4 * SNAKE_AI_BFS_NODES > 2 * MAX_CELLS) ? \
+                                 4 * SNAKE_AI_BFS_NODES : 2 * MAX_CELLS)
+#define SNAKE_AI_RAM_BYTES      ((MAX_CELLS + 7) / 8 + SNAKE_AI_SCRATCH_BYTES + 2 * MAX_CELLS)
+
+/* Directions, same order as the game's dir_t */
+enum { SNAKE_AI_UP, SNAKE_AI_RIGHT, SNAKE_AI_DOWN, SNAKE_AI_LEFT };
+
+typedef struct {
+    int wrap;                   /* Leaving one edge enters the opposite one */
+    const uint8_t *pOccupied;   /* One bit per cell (y * grid_w + x), LSB first */
+    int head, tail, fruit;      /* Cell indices */
+    int len;
+} snake_ai_board_t;
+
+/* Set up for a grid_w x grid_h board. Returns -1 when it has no
+ * Hamiltonian cycle (both sides odd): the autopilot is then not
+ * available, the distance field is. */
+int  SnakeAI_Init(int grid_w, int grid_h);
+
+/* Two neighbouring cells in cycle order near the middle of the
+ * board. A game started on them can be handed to the autopilot. */
+void SnakeAI_StartCells(int *pTail, int *pHead);
+
+/* Direction of the next move */
+int  SnakeAI_NextDir(const snake_ai_board_t *pBoard);
+
+/* Distance field: BFS steps from every free cell to one target
+ * (the fruit), shared by all AI snakes chasing it. Moving the
+ * target rebuilds it on the next query. A taken or freed cell
+ * repairs only the part of the field that depends on it. The
+ * caller updates pOccupied first, then reports the cell here. */
+void SnakeAI_FieldInit(const uint8_t *pOccupied, int wrap);
+void SnakeAI_FieldTarget(int cell);
+void SnakeAI_FieldTake(int cell);
+void SnakeAI_FieldFree(int cell);
+/* Direction to the free neighbour closest to the target, -1 when
+ * every neighbour is taken */
+int  SnakeAI_FieldDir(int head);
+
+#endif
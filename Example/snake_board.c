@@ -0,0 +1,112 @@
+/* snake_board.c */
+#include <string.h>
+#include "snake_board.h"
+#include "snake_ai.h"
+
+/* Body ring: body[body_head] is the head, body[body_tail] the last
+ * segment. Sized for the whole board, so the snake can fill it. */
+static uint16_t body[MAX_CELLS] SNAKE_CCM;
+static int      body_head, body_tail, body_len;
+
+static uint8_t  occupied[(MAX_CELLS + 7) / 8] SNAKE_CCM;    // one bit per cell, set under any body
+
+/* Cells not under a body: free_cells[0..free_count-1] in any order,
+ * free_pos[] gives each free cell's slot so it can be swap-removed */
+static uint16_t free_cells[MAX_CELLS] SNAKE_CCM;
+static uint16_t free_pos[MAX_CELLS] SNAKE_CCM;
+static int      free_count;
+static int      track_field;
+
+void SnakeBoard_Init(int cells, int field)
+{
+    memset(occupied, 0, (size_t)(cells + 7) / 8);
+    free_count = cells;
+    for (int i = 0; i < cells; i++) {
+        free_cells[i] = (uint16_t)i;
+        free_pos[i]   = (uint16_t)i;
+    }
+
+    /* Empty ring: the first Grow lands in slot 0 */
+    body_tail = 0;
+    body_head = MAX_CELLS - 1;
+    body_len  = 0;
+    track_field = field;
+}
+
+void SnakeBoard_Take(int cell)
+{
+    occupied[cell >> 3] |= (uint8_t)(1u << (cell & 7));
+
+    /* Move the last free cell into the slot this one leaves */
+    int last = free_cells[--free_count];
+    free_cells[free_pos[cell]] = (uint16_t)last;
+    free_pos[last] = free_pos[cell];
+
+    if (track_field)
+        SnakeAI_FieldTake(cell);
+}
+
+void SnakeBoard_Free(int cell)
+{
+    occupied[cell >> 3] &= (uint8_t)~(1u << (cell & 7));
+
+    free_pos[cell] = (uint16_t)free_count;
+    free_cells[free_count++] = (uint16_t)cell;
+
+    if (track_field)
+        SnakeAI_FieldFree(cell);
+}
+
+int SnakeBoard_IsTaken(int cell)
+{
+    return (occupied[cell >> 3] >> (cell & 7)) & 1;
+}
+
+const uint8_t *SnakeBoard_Occupied(void)
+{
+    return occupied;
+}
+
+int SnakeBoard_FreeCount(void)
+{
+    return free_count;
+}
+
+int SnakeBoard_FreeCell(int k)
+{
+    return free_cells[k];
+}
+
+/* Next slot in the body ring */
+static int ring_next(int i)
+{
+    return (i + 1 == MAX_CELLS) ? 0 : i + 1;
+}
+
+void SnakeBoard_Grow(int cell)
+{
+    body_head = ring_next(body_head);
+    body[body_head] = (uint16_t)cell;
+    body_len++;
+    SnakeBoard_Take(cell);
+}
+
+int SnakeBoard_Shrink(void)
+{
+    int cell = body[body_tail];
+
+    SnakeBoard_Free(cell);
+    body_tail = ring_next(body_tail);
+    body_len--;
+    return cell;
+}
+
+int SnakeBoard_Head(void)   { return body[body_head]; }
+int SnakeBoard_Tail(void)   { return body[body_tail]; }
+int SnakeBoard_Length(void) { return body_len; }
+
+int SnakeBoard_Segment(int n)
+{
+    int i = body_tail + n;
+    return body[(i >= MAX_CELLS) ? i - MAX_CELLS : i];
+}
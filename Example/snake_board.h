@@ -0,0 +1,55 @@
+/* snake_board.h */
+#ifndef SNAKE_BOARD_H
+#define SNAKE_BOARD_H
+
+#include <stdint.h>
+#include "snake_game.h"
+
+/************************************************************
+ * SNAKE BOARD
+ * The player's body as a ring of cell indices (y * grid_w + x),
+ * an occupancy bitmap of every body on the board (the player's
+ * and the rivals'), and the cells left free as a list with a
+ * position map. Moving, growing, taking or freeing a cell and
+ * drawing a random free cell are all O(1): nothing here
+ * depends on the length of the snake.
+ *
+ * Plain C, no emWin or RTOS calls, so it also builds and runs
+ * on a PC (tools/snake_board_bench.c).
+ ************************************************************/
+
+/* Static RAM: ring, bitmap, free list and its position map */
+#define SNAKE_BOARD_RAM_BYTES   (6 * MAX_CELLS + (MAX_CELLS + 7) / 8)
+
+/* Empty board of `cells` cells (at most MAX_CELLS), all free. With
+ * `field` set, every cell taken or freed is also reported to the
+ * AI's distance field (SnakeAI_FieldTake/Free). */
+void SnakeBoard_Init(int cells, int field);
+
+/* Occupancy of a cell not in the player's body (a rival's) */
+void SnakeBoard_Take(int cell);
+void SnakeBoard_Free(int cell);
+int  SnakeBoard_IsTaken(int cell);
+
+/* One bit per cell, LSB first, as snake_ai.h expects */
+const uint8_t *SnakeBoard_Occupied(void);
+
+/* The k-th free cell (0 <= k < SnakeBoard_FreeCount()), in no
+ * particular order */
+int  SnakeBoard_FreeCount(void);
+int  SnakeBoard_FreeCell(int k);
+
+/* Player's body. Grow takes a free cell as the new head; Shrink
+ * frees the last segment and returns it. A move is a Shrink, then
+ * a Grow; eating skips the Shrink. */
+void SnakeBoard_Grow(int cell);
+int  SnakeBoard_Shrink(void);
+
+int  SnakeBoard_Head(void);
+int  SnakeBoard_Tail(void);
+int  SnakeBoard_Length(void);
+
+/* Segment n counted from the tail (0 <= n < length) */
+int  SnakeBoard_Segment(int n);
+
+#endif
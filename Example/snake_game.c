@@ -3,36 +3,112 @@
 #include "LCD.h"
 #include "cmsis_os2.h"
 #include <stdint.h>
-#include <stdio.h>    // Added for sprintf
+#include <string.h>
 #include "input.h"    // Includes Keypad functions
+#include "gfx.h"
+#include "perf.h"
+#include "dlist.h"
+#include "hud.h"
+#include "snake_ai.h"
+#include "snake_board.h"
 
 /************************************************************
  * SNAKE GAME  COMPLETE STANDALONE ENGINE
  ************************************************************/
 
-#define CELL_SIZE        12
-#define MAX_SNAKE_LEN    128
 #define INITIAL_SPEED_MS 160
+#define DIR_QUEUE_LEN    4      /* Turns buffered ahead of the snake */
+#define INPUT_POLL_MS    10     /* Keypad scan period between moves */
+#define MAX_RIVALS       4      /* AI snakes, 'C' adds one and restarts */
+#define RIVAL_MAX_LEN    24
+#define RIVAL_RESPAWN    25     /* Moves a boxed-in rival sits out */
+
+/* Length text area, used to decide when cells under it need a HUD redraw */
+#define HUD_X            4
+#define HUD_Y            4
+#define HUD_W            60
+#define HUD_H            13
+#define HUD_LABEL        "LEN: "
+#define HUD_DIGITS       ((MAX_CELLS > 999) ? 4 : 3)
 
 typedef struct { int x, y; } cell_t;
 typedef enum { DIR_UP, DIR_RIGHT, DIR_DOWN, DIR_LEFT } dir_t;
+typedef struct { dir_t dir; uint32_t tick; } dir_input_t;
+
+typedef struct {
+    uint16_t body[RIVAL_MAX_LEN];   // ring of cell indices, like the player's
+    int      head, tail, len;
+    int      respawn;               // 0 on the board, else moves left to wait
+    cell_t   vacated;               // tail cell freed by the last move
+    int      has_vacated;
+} rival_t;
 
 /*********** GLOBAL GAME STATE  ***********/
-static cell_t snake[MAX_SNAKE_LEN];
-static int snake_len;
+/* The body, the occupancy bitmap and the free cells are in
+ * snake_board.c, indexed y * grid_w + x */
 static cell_t fruit;
 static dir_t cur_dir;
+static int   autopilot;         // moves come from snake_ai.c ('B' toggles)
+
+/*********** RIVAL SNAKES  ***********/
+/* Share the board and the occupancy bitmap with the player and follow
+ * the distance field in snake_ai.c to the fruit */
+static rival_t rivals[MAX_RIVALS];
+static int     rival_count;
+static const GUI_COLOR rival_color[MAX_RIVALS] = { GUI_ORANGE, GUI_MAGENTA, GUI_CYAN, GUI_YELLOW };
+
+/*********** INPUT STATE  ***********/
+static dir_input_t dir_queue[DIR_QUEUE_LEN];    // turns not yet made, oldest first
+static int         dir_q_head, dir_q_count;
+static char        last_key;                    // key seen by the previous scan
 
 static int grid_w, grid_h, pixel_w, pixel_h;
 
+/*********** RENDER STATE  ***********/
+static int    full_redraw;      // next draw_scene() repaints everything
+static cell_t vacated;          // tail cell freed by the last move
+static int    has_vacated;
+static int    fruit_moved;      // fruit was re-placed by the last move
+static hud_style_t hud_style;
+static hud_field_t hud_len;     // length shown in the HUD
+
 /*********** INTERNAL FUNCTION PROTOTYPES  ***********/
 static void     init_game(void);
 static void     draw_scene(void);
+static void     draw_full(void *p);
+static void     draw_cell(cell_t c, GUI_COLOR color);
+static void     draw_hud(void);
+static void     queue_cell(cell_t c, GUI_COLOR color);
+static void     queue_hud(int all);
+static int      hud_overlaps(cell_t c);
 static int      move_snake(void);
-static void     place_fruit(void);
+static int      place_fruit(void);
 static int      is_collision(cell_t h);
+static void     steer_autopilot(void);
+static void     spawn_rival(rival_t *r);
+static int      move_rivals(void);
+static cell_t   step_cell(cell_t c, dir_t d);
+static char     wait_for_move(uint32_t ms);
+static void     queue_dir(dir_t d, uint32_t tick);
+static void     take_queued_dir(void);
 static uint32_t rng_next(void);
-static void     game_over_screen(void);
+static void     game_over_screen(int won);
+
+static int rival_next(int i)
+{
+    return (i + 1 == RIVAL_MAX_LEN) ? 0 : i + 1;
+}
+
+static int cell_index(cell_t c)
+{
+    return c.y * grid_w + c.x;
+}
+
+static cell_t cell_at(int i)
+{
+    cell_t c = { i % grid_w, i / grid_w };
+    return c;
+}
 
 /*********** PSEUDO-RNG  ***********/
 static uint32_t rng_state = 0x12345678;
@@ -51,76 +127,82 @@ static uint32_t rng_next(void)
 void StartSnakeGame(void)
 {
     GUI_Clear();
+    Hud_StyleInit(&hud_style, GUI_FONT_13_ASCII, GUI_WHITE, GUI_BLACK);
+    Hud_FieldInit(&hud_len, &hud_style, HUD_X + Hud_LabelWidth(&hud_style, HUD_LABEL), HUD_Y, HUD_DIGITS);
+    hud_len.dlist = 1;
     init_game();
-		static uint32_t last_input_time = 0;
-    uint32_t current_time;
-    uint32_t debounce_delay = 150; // 150ms between inputs
+    Perf_Report(PERF_EVT_SNAKE_RAM,
+                SNAKE_BOARD_RAM_BYTES + SNAKE_AI_RAM_BYTES,
+                (uint32_t)(grid_w * grid_h));
+
     uint32_t speed = INITIAL_SPEED_MS;
+    char key = 0;
 
     while (1)
     {
         /* ------------------------------
          * MATRIX KEYPAD CONTROL
+         * Direction keys are queued while waiting for the move
+         * (wait_for_move), the other keys come back here.
          * ------------------------------ */
-        char key = Keypad_Get_Key();
-        current_time = osKernelGetTickCount();
-			if (key != 0 && (current_time - last_input_time > debounce_delay))
-        {
-            
-         if (key == '2' && cur_dir != DIR_DOWN) {
-            cur_dir = DIR_UP;
-        }
-        else if (key == '8' && cur_dir != DIR_UP) {
-            cur_dir = DIR_DOWN;
-        }
-        else if (key == '4' && cur_dir != DIR_RIGHT) {
-            cur_dir = DIR_LEFT;
-        }
-        else if (key == '6' && cur_dir != DIR_LEFT) {
-            cur_dir = DIR_RIGHT;
-        }
-
-        /* Hard reset (Key '5') */
         if (key == '#')
         {
+            DL_Flush();
             return;
         }
-				 if (key == '#')
-        {
-            return;
-        }
-				 if (key == 'A')
+        /* The autopilot's cycle does not know about rival bodies: no
+         * rivals while it drives, and turning it on removes them */
+        if (key == 'C' && autopilot)
+            key = 0;
+
+        /* Restart; 'B' also turns the autopilot on/off, 'C' adds a rival */
+        if (key == 'A' || key == 'B' || key == 'C')
         {
-						init_game();
+            if (key == 'B')
+                autopilot = !autopilot;
+            if (key == 'B' && autopilot)
+                rival_count = 0;
+            if (key == 'C')
+                rival_count = (rival_count + 1) % (MAX_RIVALS + 1);
+            init_game();
             speed = INITIAL_SPEED_MS;
+            key = 0;
             osDelay(200); // Wait for key release
             continue;
         }
-            last_input_time = current_time;
-        }
 
-        /* Direction Control - Maps 2,4,6,8 to directions */
-        /* Logic ensures we cannot reverse directly into ourselves */
-        
+        /* One queued turn per move */
+        if (autopilot)
+            steer_autopilot();
+        else
+            take_queued_dir();
 
         /* Move snake */
+        uint32_t t0 = Perf_Cycles();
         int result = move_snake();
+        Perf_Report(PERF_EVT_SNAKE_MOVE, Perf_Cycles() - t0, (uint32_t)SnakeBoard_Length());
 
-        /* Game Over */
-        if (result < 0)
+        /* Rivals move after the player; one that takes the last free cell ends it */
+        if ((result == 0 || result == 1) && move_rivals() < 0)
+            result = -1;
+
+        /* Game Over, or the body fills the whole board */
+        if (result < 0 || result == 2)
         {
+            full_redraw = 1;
             draw_scene();
-            game_over_screen();
+            game_over_screen(result == 2);
 
             // Wait for Key '5' to restart
             while (Keypad_Get_Key() != 'A') {                
-							if (Keypad_Get_Key() == '#'){return;}
+							if (Keypad_Get_Key() == '#'){DL_Flush(); return;}
 							osDelay(50);
 							
             }
 
             init_game();
             speed = INITIAL_SPEED_MS;
+            last_key = 'A';   // still down, not a new press
             osDelay(200); // Wait for key release
             continue;
         }
@@ -130,7 +212,7 @@ void StartSnakeGame(void)
             speed -= 5;
 
         draw_scene();
-        osDelay(speed);
+        key = wait_for_move(speed);
     }
 }
 
@@ -147,149 +229,481 @@ static void init_game(void)
 
     if (grid_w < 10) grid_w = 10;
     if (grid_h < 10) grid_h = 10;
+    if (grid_w * grid_h > MAX_CELLS) grid_h = MAX_CELLS / grid_w;
 
     int cx = grid_w / 2;
     int cy = grid_h / 2;
 
-    snake_len = 2;
+    /* Two segments, tail first */
+    int tail = cy * grid_w + cx - 1;
+    int head = tail + 1;
+
+    cur_dir = DIR_RIGHT;
+    dir_q_head  = 0;
+    dir_q_count = 0;
 
-    for (int i = 0; i < snake_len; i++)
+    /* The autopilot starts on two cells of its cycle */
+    int have_cycle = (SnakeAI_Init(grid_w, grid_h) == 0);
+    SnakeAI_FieldInit(SnakeBoard_Occupied(), 1);
+
+    if (autopilot && have_cycle)
     {
-        snake[i].x = cx - i;
-        snake[i].y = cy;
+        SnakeAI_StartCells(&tail, &head);
+
+        if (head == tail + 1)           cur_dir = DIR_RIGHT;
+        else if (head == tail - 1)      cur_dir = DIR_LEFT;
+        else if (head == tail + grid_w) cur_dir = DIR_DOWN;
+        else                            cur_dir = DIR_UP;
+    }
+    else
+    {
+        autopilot = 0;
     }
 
-    cur_dir = DIR_RIGHT;
+    SnakeBoard_Init(grid_w * grid_h, rival_count != 0);
+    SnakeBoard_Grow(tail);
+    SnakeBoard_Grow(head);
+
     place_fruit();
+
+    for (int i = 0; i < MAX_RIVALS; i++)
+    {
+        rivals[i].len     = 0;
+        rivals[i].respawn = RIVAL_RESPAWN;
+        if (i < rival_count)
+            spawn_rival(&rivals[i]);
+    }
+
+    full_redraw = 1;
+    has_vacated = 0;
+    fruit_moved = 0;
 }
 
 /************************************************************
- * DRAW EVERYTHING
+ * DRAW SCENE
+ * Full repaint after init / game over, otherwise only the
+ * cells touched by the last move: vacated tail, new head,
+ * re-placed fruit and the length text. The per-move cells go
+ * through the display list; the full repaint is drawn here.
  ************************************************************/
 static void draw_scene(void)
 {
+    /* Counted by the render thread, so mostly the previous tick */
+    uint32_t pixels = Gfx_GetPixelWrites();
+    int hud_dirty = 0;
+
+    if (full_redraw)
+    {
+        DL_Flush();
+        Gfx_DrawFrame(draw_full, NULL);
+
+        full_redraw = 0;
+        has_vacated = 0;
+        fruit_moved = 0;
+        for (int i = 0; i < rival_count; i++)
+            rivals[i].has_vacated = 0;
+    }
+    else
+    {
+        /* Erase tails, unless the body still covers it after growing.
+         * All of them first: a head may take a cell freed this tick. */
+        if (has_vacated)
+        {
+            queue_cell(vacated, GUI_BLACK);
+            hud_dirty |= hud_overlaps(vacated);
+            has_vacated = 0;
+        }
+        for (int i = 0; i < rival_count; i++)
+        {
+            rival_t *r = &rivals[i];
+            if (r->has_vacated)
+            {
+                queue_cell(r->vacated, GUI_BLACK);
+                hud_dirty |= hud_overlaps(r->vacated);
+                r->has_vacated = 0;
+            }
+        }
+
+        cell_t head = cell_at(SnakeBoard_Head());
+        queue_cell(head, GUI_GREEN);
+        hud_dirty |= hud_overlaps(head);
+
+        for (int i = 0; i < rival_count; i++)
+        {
+            if (rivals[i].respawn) continue;
+            cell_t rh = cell_at(rivals[i].body[rivals[i].head]);
+            queue_cell(rh, rival_color[i]);
+            hud_dirty |= hud_overlaps(rh);
+        }
+
+        if (fruit_moved)
+        {
+            queue_cell(fruit, GUI_RED);
+            hud_dirty |= hud_overlaps(fruit);
+            fruit_moved = 0;
+        }
+
+        /* Score: whole HUD if a cell was drawn over it, else changed digits */
+        queue_hud(hud_dirty);
+
+        DL_Submit();
+    }
+
+    pixels = Gfx_GetPixelWrites() - pixels;
+    Perf_Report(PERF_EVT_SNAKE_PIXELS, pixels, (uint32_t)pixel_w * pixel_h);
+}
+
+/* Whole frame, composed band by band off-screen */
+static void draw_full(void *p)
+{
+    (void)p;
+
     GUI_SetBkColor(GUI_BLACK);
-    GUI_Clear();
+    Gfx_Clear();
 
     /* Fruit */
-    GUI_SetColor(GUI_RED);
-    GUI_FillRect(
-        fruit.x * CELL_SIZE,
-        fruit.y * CELL_SIZE,
-        fruit.x * CELL_SIZE + CELL_SIZE - 1,
-        fruit.y * CELL_SIZE + CELL_SIZE - 1
-    );
+    draw_cell(fruit, GUI_RED);
+
+    /* Snake, tail to head */
+    for (int n = 0; n < SnakeBoard_Length(); n++)
+        draw_cell(cell_at(SnakeBoard_Segment(n)), GUI_GREEN);
 
-    /* Snake */
-    GUI_SetColor(GUI_GREEN);
-    for (int i = 0; i < snake_len; i++)
+    /* Rivals */
+    for (int k = 0; k < rival_count; k++)
     {
-        GUI_FillRect(
-            snake[i].x * CELL_SIZE,
-            snake[i].y * CELL_SIZE,
-            snake[i].x * CELL_SIZE + CELL_SIZE - 1,
-            snake[i].y * CELL_SIZE + CELL_SIZE - 1
-        );
+        const rival_t *r = &rivals[k];
+        for (int i = r->tail, n = 0; n < r->len; n++, i = rival_next(i))
+            draw_cell(cell_at(r->body[i]), rival_color[k]);
     }
 
     /* Score */
-    GUI_SetColor(GUI_WHITE);
-    GUI_SetFont(GUI_FONT_13_ASCII);
-    char buf[32];
-    sprintf(buf, "LEN: %d", snake_len);
-    GUI_DispStringAt(buf, 4, 4);
+    draw_hud();
+}
+
+static void draw_cell(cell_t c, GUI_COLOR color)
+{
+    GUI_SetColor(color);
+    Gfx_FillRect(
+        c.x * CELL_SIZE,
+        c.y * CELL_SIZE,
+        c.x * CELL_SIZE + CELL_SIZE - 1,
+        c.y * CELL_SIZE + CELL_SIZE - 1
+    );
+}
+
+static void draw_hud(void)
+{
+    Hud_Label(&hud_style, HUD_LABEL, HUD_X, HUD_Y);
+    Hud_Draw(&hud_len, SnakeBoard_Length());
+}
+
+static void queue_cell(cell_t c, GUI_COLOR color)
+{
+    DL_FillRect(
+        c.x * CELL_SIZE,
+        c.y * CELL_SIZE,
+        c.x * CELL_SIZE + CELL_SIZE - 1,
+        c.y * CELL_SIZE + CELL_SIZE - 1,
+        color
+    );
+}
+
+static void queue_hud(int all)
+{
+    if (all) {
+        DL_Text(HUD_LABEL, HUD_X, HUD_Y, GUI_FONT_13_ASCII, GUI_WHITE, GUI_BLACK);
+        Hud_Invalidate(&hud_len);
+    }
+    Hud_Update(&hud_len, SnakeBoard_Length());
+}
+
+/* Cells under the length text have to be followed by a HUD redraw */
+static int hud_overlaps(cell_t c)
+{
+    return (c.y * CELL_SIZE < HUD_Y + HUD_H) && (c.x * CELL_SIZE < HUD_X + HUD_W);
 }
 
 /************************************************************
  * MOVE SNAKE FORWARD ONE STEP
+ * Push the new head, pop the tail unless growing. The cost
+ * does not depend on the length of the snake.
  ************************************************************/
 static int move_snake(void)
 {
-    cell_t head = snake[0];
+    cell_t head = step_cell(cell_at(SnakeBoard_Head()), cur_dir);
+
+    if (is_collision(head))
+        return -1;   // hit wall or itself
 
+    int ate = (head.x == fruit.x && head.y == fruit.y);
+
+    /* The ring holds a whole board, so eating always grows */
+    has_vacated = !ate;
+    if (!ate)
+        vacated = cell_at(SnakeBoard_Shrink());
+
+    SnakeBoard_Grow(cell_index(head));
+
+    /* Fruit eaten: the next one goes on a free cell, if any is left */
+    if (ate)
+    {
+        if (!place_fruit())
+            return 2;
+        fruit_moved = 1;
+    }
+
+    return ate;
+}
+
+/* Neighbouring cell, wrapping to the opposite side */
+static cell_t step_cell(cell_t c, dir_t d)
+{
     /* Direction logic */
-    switch (cur_dir)
+    switch (d)
     {
-        case DIR_UP:    head.y--; break;
-        case DIR_DOWN:  head.y++; break;
-        case DIR_LEFT:  head.x--; break;
-        case DIR_RIGHT: head.x++; break;
+        case DIR_UP:    c.y--; break;
+        case DIR_DOWN:  c.y++; break;
+        case DIR_LEFT:  c.x--; break;
+        case DIR_RIGHT: c.x++; break;
     }
 		/* WRAPPING LOGIC: Loop to opposite side */
-    if (head.x < 0)             head.x = grid_w - 1;
-    else if (head.x >= grid_w)  head.x = 0;
+    if (c.x < 0)             c.x = grid_w - 1;
+    else if (c.x >= grid_w)  c.x = 0;
 
-    if (head.y < 0)             head.y = grid_h - 1;
-    else if (head.y >= grid_h)  head.y = 0;
+    if (c.y < 0)             c.y = grid_h - 1;
+    else if (c.y >= grid_h)  c.y = 0;
 
-    if (is_collision(head))
-        return -1;   // hit wall or itself
+    return c;
+}
+
+/************************************************************
+ * RIVAL SNAKES
+ * Each one steps to the free neighbour nearest the fruit on
+ * the shared distance field, which the occupancy updates keep
+ * current. A boxed-in rival leaves the board for a while.
+ ************************************************************/
+static void spawn_rival(rival_t *r)
+{
+    r->has_vacated = 0;
+    int free_count = SnakeBoard_FreeCount();
+    if (free_count < 2)
+    {
+        r->respawn = RIVAL_RESPAWN;
+        return;
+    }
 
-    for (int i = snake_len - 1; i > 0; i--)
-        snake[i] = snake[i - 1];
+    /* Any free cell but the fruit */
+    int k = (int)(rng_next() % (uint32_t)free_count);
+    if (SnakeBoard_FreeCell(k) == cell_index(fruit))
+        k = (k + 1) % free_count;
 
-    snake[0] = head;
+    r->head = r->tail = 0;
+    r->len  = 1;
+    r->body[0] = (uint16_t)SnakeBoard_FreeCell(k);
+    r->respawn = 0;
+    SnakeBoard_Take(r->body[0]);
+}
+
+static void remove_rival(rival_t *r)
+{
+    for (int i = r->tail, n = 0; n < r->len; n++, i = rival_next(i))
+        SnakeBoard_Free(r->body[i]);
 
-    /* Fruit eaten */
-    if (head.x == fruit.x && head.y == fruit.y)
+    r->len     = 0;
+    r->respawn = RIVAL_RESPAWN;
+    full_redraw = 1;    // whole body to erase
+}
+
+/* Returns -1 when a rival ate and no cell is left for the fruit */
+static int move_rival(rival_t *r)
+{
+    if (r->respawn)
     {
-        if (snake_len < MAX_SNAKE_LEN)
-            snake[snake_len++] = snake[snake_len - 1];
+        if (--r->respawn == 0)
+            spawn_rival(r);
+        return 0;
+    }
 
-        place_fruit();
-        return 1;
+    int dir = SnakeAI_FieldDir(r->body[r->head]);
+    if (dir < 0)
+    {
+        remove_rival(r);
+        return 0;
     }
 
+    int next = cell_index(step_cell(cell_at(r->body[r->head]), (dir_t)dir));
+    int ate  = (next == cell_index(fruit));
+
+    r->has_vacated = !(ate && r->len < RIVAL_MAX_LEN);
+    if (r->has_vacated)
+    {
+        r->vacated = cell_at(r->body[r->tail]);
+        SnakeBoard_Free(r->body[r->tail]);
+        r->tail = rival_next(r->tail);
+        r->len--;
+    }
+
+    r->head = rival_next(r->head);
+    r->body[r->head] = (uint16_t)next;
+    SnakeBoard_Take(next);
+    r->len++;
+
+    if (ate)
+    {
+        if (!place_fruit())
+            return -1;
+        fruit_moved = 1;
+    }
+    return 0;
+}
+
+static int move_rivals(void)
+{
+    for (int i = 0; i < rival_count; i++)
+    {
+        uint32_t t0 = Perf_Cycles();
+        int result = move_rival(&rivals[i]);
+        Perf_Report(PERF_EVT_SNAKE_RIVAL, Perf_Cycles() - t0, (uint32_t)i);
+
+        if (result < 0)
+            return -1;
+    }
     return 0;
 }
 
 /************************************************************
  * RANDOM FRUIT POSITION
+ * Uniform over the free cells, one draw. Returns 0 when the
+ * body covers the whole board.
  ************************************************************/
-static void place_fruit(void)
+static int place_fruit(void)
 {
-    while (1)
+    static uint32_t worst;
+    uint32_t t0 = Perf_Cycles();
+
+    int free_count = SnakeBoard_FreeCount();
+    if (free_count == 0)
+        return 0;
+
+    int i = SnakeBoard_FreeCell((int)(rng_next() % (uint32_t)free_count));
+    fruit.x = i % grid_w;
+    fruit.y = i / grid_w;
+    SnakeAI_FieldTarget(i);
+
+    uint32_t cycles = Perf_Cycles() - t0;
+    if (cycles > worst) {
+        worst = cycles;
+        Perf_Report(PERF_EVT_SNAKE_FRUIT, worst, (uint32_t)free_count);
+    }
+    return 1;
+}
+
+/************************************************************
+ * COLLISION CHECK
+ ************************************************************/
+static int is_collision(cell_t h)
+{
+    /* Head is already wrapped onto the board, the tail still counts */
+    return SnakeBoard_IsTaken(cell_index(h));
+}
+
+/************************************************************
+ * INPUT
+ * The keypad is scanned every INPUT_POLL_MS while waiting for
+ * the next move and a key counts once, when it goes down.
+ * Turns are queued and checked against the last queued turn,
+ * so "up, then left" inside one tick gives two turns. Each
+ * move takes one; its press-to-move time is reported.
+ ************************************************************/
+static char wait_for_move(uint32_t ms)
+{
+    uint32_t start = osKernelGetTickCount();
+    uint32_t elapsed;
+
+    while ((elapsed = osKernelGetTickCount() - start) < ms)
     {
-        int rx = rng_next() % grid_w;
-        int ry = rng_next() % grid_h;
+        char key = Keypad_Get_Key();
 
-        int collision = 0;
-        for (int i = 0; i < snake_len; i++)
+        if (key != last_key)
         {
-            if (snake[i].x == rx && snake[i].y == ry)
+            uint32_t now = osKernelGetTickCount();
+
+            last_key = key;
+            switch (key)
             {
-                collision = 1;
-                break;
+                case '2': queue_dir(DIR_UP,    now); break;
+                case '8': queue_dir(DIR_DOWN,  now); break;
+                case '4': queue_dir(DIR_LEFT,  now); break;
+                case '6': queue_dir(DIR_RIGHT, now); break;
+                case '#':
+                case 'A':
+                case 'B':
+                case 'C': return key;
+                default:  break;
             }
         }
 
-        if (!collision)
-        {
-            fruit.x = rx;
-            fruit.y = ry;
-            return;
-        }
+        osDelay((ms - elapsed < INPUT_POLL_MS) ? ms - elapsed : INPUT_POLL_MS);
     }
+
+    return 0;
+}
+
+static void queue_dir(dir_t d, uint32_t tick)
+{
+    if (autopilot || dir_q_count == DIR_QUEUE_LEN)
+        return;
+
+    dir_t last = dir_q_count ? dir_queue[(dir_q_head + dir_q_count - 1) % DIR_QUEUE_LEN].dir
+                             : cur_dir;
+
+    /* Same way, or straight back into the neck */
+    if (d == last || d == (dir_t)((last + 2) & 3))
+        return;
+
+    int i = (dir_q_head + dir_q_count++) % DIR_QUEUE_LEN;
+    dir_queue[i].dir  = d;
+    dir_queue[i].tick = tick;
+}
+
+static void take_queued_dir(void)
+{
+    if (dir_q_count == 0)
+        return;
+
+    dir_input_t in = dir_queue[dir_q_head];
+    dir_q_head = (dir_q_head + 1) % DIR_QUEUE_LEN;
+    dir_q_count--;
+
+    cur_dir = in.dir;
+    Perf_Report(PERF_EVT_SNAKE_INPUT, osKernelGetTickCount() - in.tick, (uint32_t)dir_q_count);
 }
 
 /************************************************************
- * COLLISION CHECK
+ * AUTOPILOT
  ************************************************************/
-static int is_collision(cell_t h)
+static void steer_autopilot(void)
 {
-    for (int i = 0; i < snake_len; i++)
-        if (snake[i].x == h.x && snake[i].y == h.y)
-            return 1;
-
-    return 0;
+    snake_ai_board_t board;
+
+    board.wrap      = 1;
+    board.pOccupied = SnakeBoard_Occupied();
+    board.head      = SnakeBoard_Head();
+    board.tail      = SnakeBoard_Tail();
+    board.fruit     = cell_index(fruit);
+    board.len       = SnakeBoard_Length();
+
+    uint32_t t0 = Perf_Cycles();
+    cur_dir = (dir_t)SnakeAI_NextDir(&board);
+    Perf_Report(PERF_EVT_SNAKE_AI, Perf_Cycles() - t0, (uint32_t)SnakeBoard_Length());
 }
 
 /************************************************************
  * GAME OVER SCREEN
  ************************************************************/
-static void game_over_screen(void)
+static void game_over_screen(int won)
 {
     GUI_SetColor(GUI_WHITE);
     GUI_SetFont(GUI_FONT_20_ASCII);
-    GUI_DispStringHCenterAt("GAME OVER", pixel_w / 2, pixel_h / 2 - 20);
+    GUI_DispStringHCenterAt(won ? "YOU WIN" : "GAME OVER", pixel_w / 2, pixel_h / 2 - 20);
 }
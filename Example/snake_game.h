@@ -1,6 +1,40 @@
 #ifndef SNAKE_GAME_H
 #define SNAKE_GAME_H
 
+/* Board size, shared with the autopilot (snake_ai.c).
+ * CELL_SIZE can be set from the project (-DCELL_SIZE=n), down to 4. */
+#ifndef CELL_SIZE
+#define CELL_SIZE        12
+#endif
+
+/* Largest board: the panel is 240x320, in either orientation */
+#define LCD_MAX_W        240
+#define LCD_MAX_H        320
+#define MAX_CELLS        ((LCD_MAX_W / CELL_SIZE) * (LCD_MAX_H / CELL_SIZE))
+
+/* The body and the free-cell index are sized for the whole board, so the
+ * snake can fill it. Board state is about 6 bytes per cell; the autopilot
+ * and the rivals add a bitmap, a scratch queue (4 KB, or 2 bytes per cell
+ * if more) and a 2-byte distance per cell (SNAKE_AI_RAM_BYTES):
+ *
+ *   CELL_SIZE   board    cells   board state   autopilot    total
+ *      12       20x26      520       3185 B       5201 B     8386 B
+ *       8       30x40     1200       7350 B       6646 B    13996 B
+ *       6       40x53     2120      12985 B       8745 B    21730 B
+ *       4       60x80     4800      29400 B      19800 B    49200 B
+ *
+ * All of it is CPU-only and only used while the snake game runs, so it
+ * goes in CCM (SNAKE_CCM): Example.sct overlays it on the 2048 solver's
+ * table, and armlink checks it against the 62 KB left after the Event
+ * Recorder. SnakeBoard_Init() and SnakeAI_Init() set it up on every
+ * start.
+ */
+#if defined(__ARMCC_VERSION)
+#define SNAKE_CCM        __attribute__((section(".bss.ccm")))
+#else
+#define SNAKE_CCM
+#endif
+
 void StartSnakeGame(void);
 
 #endif
@@ -0,0 +1,98 @@
+/* bench_2048_ai.c - host benchmark for the 2048 solver
+ *
+ * Plays whole games with 2048_ai.c choosing every move, spawns as in
+ * the game (a 2 at 90 %, a 4 at 10 %, on a random empty cell). Per
+ * game prints score and best tile, then the average score, the
+ * average depth of the last finished pass, nodes/s and how often
+ * each best tile was reached. No emWin, no RTOS.
+ *
+ *     gcc -O2 -I.. -o bench_2048_ai bench_2048_ai.c ../2048_ai.c ../2048_board.c ../2048_tables.c -lm
+ *     ./bench_2048_ai [games] [budget_ms]
+ *
+ * Host times are not target times: the budget sets how deep the
+ * search gets, so pick one that reaches the depth seen on the board.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "2048_ai.h"
+
+#define CELLS   (G2048_SIZE * G2048_SIZE)
+
+static uint32_t now_ms(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)(t.tv_sec * 1000 + t.tv_nsec / 1000000);
+}
+
+static uint32_t rng_state = 0x12345678u;
+static uint32_t rng_next(void)
+{
+    uint32_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return rng_state = x;
+}
+
+static g2048_board_t spawn(g2048_board_t b)
+{
+    int empty[CELLS], n = 0;
+
+    for (int i = 0; i < CELLS; i++)
+        if (G2048_CELL(b, i / G2048_SIZE, i % G2048_SIZE) == 0) empty[n++] = i;
+    if (n == 0) return b;
+
+    int i = empty[rng_next() % (uint32_t)n];
+    g2048_board_t e = (rng_next() % 10 == 0) ? 2 : 1;
+    return b | (e << G2048_SHIFT(i / G2048_SIZE, i % G2048_SIZE));
+}
+
+int main(int argc, char **argv)
+{
+    int      games  = (argc > 1) ? atoi(argv[1]) : 10;
+    uint32_t budget = (argc > 2) ? (uint32_t)atoi(argv[2]) : 20;
+    int      best_count[16] = { 0 };
+    double   total_score = 0.0;
+    uint64_t nodes = 0, ms = 0, depths = 0, searches = 0;
+
+    if (games < 1) return 1;
+    G2048AI_Init(now_ms);
+
+    for (int g = 0; g < games; g++) {
+        g2048_board_t b = spawn(spawn(0));
+        uint32_t score = 0;
+        int best = 0;
+
+        for (;;) {
+            g2048_ai_stats_t st;
+            int won = 0;
+            int dir = G2048AI_Search(b, budget, &st);
+
+            if (dir < 0) break;
+            nodes  += st.nodes;
+            ms     += st.ms;
+            depths += (uint64_t)st.depth;
+            searches++;
+            b = spawn(G2048_Move(b, dir, &score, &won));
+        }
+
+        for (int i = 0; i < CELLS; i++) {
+            int e = G2048_CELL(b, i / G2048_SIZE, i % G2048_SIZE);
+            if (e > best) best = e;
+        }
+        best_count[best]++;
+        total_score += score;
+        printf("game %d: score %u, best tile %d\n", g + 1, score, 1 << best);
+        fflush(stdout);
+    }
+
+    printf("%d games at %u ms: average score %.0f, average depth %.2f, %.0f nodes/s, %llu moves\n",
+           games, budget, total_score / games, searches ? (double)depths / searches : 0.0,
+           ms ? nodes * 1000.0 / ms : 0.0, (unsigned long long)searches);
+    for (int e = 15; e > 0; e--)
+        if (best_count[e]) printf("  best tile %5d: %d\n", 1 << e, best_count[e]);
+    return 0;
+}
@@ -0,0 +1,356 @@
+/* bench_2048_move.c - host check and benchmark of the 2048 move kernels
+ *
+ * Checks G2048_Move() (2048_board.c) against a plain per-line slide
+ * on random boards: board, score and the 2048 flag must agree. Then
+ * times it against the int-grid engine it replaced (copied below,
+ * less the animation vectors) on the same boards. Last, the same
+ * check and a timing for every size's kernel (G2048_Variant()).
+ * First of all, every entry of the committed tables (2048_tables.c)
+ * is checked against the slide below, so they cannot drift from
+ * what tools/gen_2048_tables.py means to generate.
+ *
+ *     gcc -O2 -I.. -o bench_2048_move bench_2048_move.c ../2048_board.c ../2048_tables.c
+ *     ./bench_2048_move [boards]
+ *
+ * The old engine stopped after the first merge in a line, so only
+ * its speed is compared, not its results.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "2048_board.h"
+#include "2048_tables.h"
+
+#define N   G2048_SIZE
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+static uint32_t rng_next(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)rng_state;
+}
+
+/* Mostly small tiles, often equal to a neighbour, some empty */
+static g2048_board_t random_board(void)
+{
+    g2048_board_t b = 0;
+
+    for (int i = 0; i < N * N; i++) {
+        int e = (rng_next() % 3) ? (int)(rng_next() % 16) : 0;
+        if (i > 0 && rng_next() % 3 == 0) e = G2048_CELL(b, (i - 1) / N, (i - 1) % N);
+        if (i >= N && rng_next() % 4 == 0) e = G2048_CELL(b, i / N - 1, i % N);
+        b |= (g2048_board_t)e << G2048_SHIFT(i / N, i % N);
+    }
+    return b;
+}
+
+/************************************************************
+ * REFERENCE: one line at a time, each pair merged once
+ ************************************************************/
+static void line_cell(int dir, int line, int k, int *r, int *c)
+{
+    switch (dir) {
+        case G2048_LEFT:  *r = line;         *c = k;         break;
+        case G2048_RIGHT: *r = line;         *c = N - 1 - k; break;
+        case G2048_UP:    *r = k;            *c = line;      break;
+        default:          *r = N - 1 - k;    *c = line;      break;
+    }
+}
+
+static g2048_board_t ref_move(g2048_board_t b, int dir, uint32_t *pScore, int *pWon)
+{
+    g2048_board_t out = 0;
+
+    for (int line = 0; line < N; line++) {
+        int t[N], m = 0, o[N] = { 0 }, s = 0, r, c;
+
+        for (int k = 0; k < N; k++) {
+            line_cell(dir, line, k, &r, &c);
+            if (G2048_CELL(b, r, c)) t[m++] = G2048_CELL(b, r, c);
+        }
+        for (int i = 0; i < m; i++) {
+            if (i + 1 < m && t[i] == t[i + 1] && t[i] < 15) {
+                o[s++] = t[i] + 1;
+                *pScore += 1u << (t[i] + 1);
+                if (t[i] + 1 == 11) *pWon = 1;
+                i++;
+            } else {
+                o[s++] = t[i];
+            }
+        }
+        for (int k = 0; k < N; k++) {
+            line_cell(dir, line, k, &r, &c);
+            out |= (g2048_board_t)o[k] << G2048_SHIFT(r, c);
+        }
+    }
+    return out;
+}
+
+/* Same for an n x n grid */
+static int grid_at(const g2048_grid_t *g, int n, int r, int c)
+{
+    return G2048_GRID_CELL(g, G2048_GRID_SLOT(n, r, c));
+}
+
+static g2048_grid_t random_grid(int n)
+{
+    g2048_grid_t g = { { 0 } };
+
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            int e = (rng_next() % 3) ? (int)(rng_next() % 16) : 0;
+            if (c > 0 && rng_next() % 3 == 0) e = grid_at(&g, n, r, c - 1);
+            if (r > 0 && rng_next() % 4 == 0) e = grid_at(&g, n, r - 1, c);
+            int i = G2048_GRID_SLOT(n, r, c);
+            g.w[G2048_GRID_WORD(i)] |= (uint64_t)e << G2048_GRID_SHIFT(i);
+        }
+    }
+    return g;
+}
+
+static void grid_line_cell(int n, int dir, int line, int k, int *r, int *c)
+{
+    switch (dir) {
+        case G2048_LEFT:  *r = line;         *c = k;         break;
+        case G2048_RIGHT: *r = line;         *c = n - 1 - k; break;
+        case G2048_UP:    *r = k;            *c = line;      break;
+        default:          *r = n - 1 - k;    *c = line;      break;
+    }
+}
+
+static g2048_grid_t ref_grid_move(const g2048_grid_t *g, int n, int dir, uint32_t *pScore, int *pWon)
+{
+    g2048_grid_t out = { { 0 } };
+
+    for (int line = 0; line < n; line++) {
+        int t[G2048_MAX_SIZE], m = 0, o[G2048_MAX_SIZE] = { 0 }, s = 0, r, c;
+
+        for (int k = 0; k < n; k++) {
+            grid_line_cell(n, dir, line, k, &r, &c);
+            if (grid_at(g, n, r, c)) t[m++] = grid_at(g, n, r, c);
+        }
+        for (int i = 0; i < m; i++) {
+            if (i + 1 < m && t[i] == t[i + 1] && t[i] < 15) {
+                o[s++] = t[i] + 1;
+                *pScore += 1u << (t[i] + 1);
+                if (t[i] + 1 == 11) *pWon = 1;
+                i++;
+            } else {
+                o[s++] = t[i];
+            }
+        }
+        for (int k = 0; k < n; k++) {
+            grid_line_cell(n, dir, line, k, &r, &c);
+            int i = G2048_GRID_SLOT(n, r, c);
+            out.w[G2048_GRID_WORD(i)] |= (uint64_t)o[k] << G2048_GRID_SHIFT(i);
+        }
+    }
+    return out;
+}
+
+/************************************************************
+ * TABLES: every entry against the slides above
+ ************************************************************/
+/* Entry of a row table for row (cell 0 in the low nibble) */
+static uint32_t ref_row_entry(uint32_t row, int n)
+{
+    int t[4], m = 0, s = 0, won = 0;
+    uint32_t out = 0, gained = 0;
+
+    for (int k = 0; k < n; k++)
+        if ((row >> (4 * k)) & 0xF) t[m++] = (int)((row >> (4 * k)) & 0xF);
+    for (int i = 0; i < m; i++) {
+        int e = t[i];
+        if (i + 1 < m && t[i + 1] == e && e < 15) {
+            e++;
+            gained += 1u << e;
+            won |= (e == 11);
+            i++;
+        }
+        out |= (uint32_t)e << (4 * s++);
+    }
+    return out | ((gained >> 2) << 16) | ((uint32_t)won << 31);
+}
+
+/* Entry of slide_pair_table: two cells after the open tile */
+static uint32_t ref_pair_entry(uint32_t index)
+{
+    uint32_t open = index >> 8, tiles = 0, count = 0, won = 0, gained = 0;
+
+    for (int k = 0; k < 2; k++) {
+        uint32_t e = (index >> (4 * k)) & 0xF;
+        if (e == 0) continue;
+        if (e == open && e < 15) {
+            tiles |= (e + 1) << (4 * count++);
+            gained += 1u << (e + 1);
+            won |= (e + 1 == 11);
+            open = 0;
+        } else {
+            if (open) tiles |= open << (4 * count++);
+            open = e;
+        }
+    }
+    return tiles | (count << 8) | (open << 10) | (won << 14) | (gained << 16);
+}
+
+static long check_tables(void)
+{
+    long bad = 0;
+
+    for (uint32_t r = 0; r < 65536; r++)
+        bad += (row_left_table[r] != ref_row_entry(r, 4));
+    for (uint32_t r = 0; r < 4096; r++)
+        bad += (row_left_table3[r] != ref_row_entry(r, 3));
+    for (uint32_t i = 0; i < 4096; i++)
+        bad += (slide_pair_table[i] != ref_pair_entry(i));
+    return bad;
+}
+
+/************************************************************
+ * OLD ENGINE: int grid of tile values, as before the bitboard
+ ************************************************************/
+static int old_board[N][N];
+static int old_score, old_victory;
+
+static int old_slide_line(int dir, int line)
+{
+    int success = 0;
+    int *cell[N];
+    int rr[N], cc[N];
+
+    for (int k = 0; k < N; k++) {
+        line_cell(dir, line, k, &rr[k], &cc[k]);
+        cell[k] = &old_board[rr[k]][cc[k]];
+    }
+
+    int temp_row[N] = { 0 };
+    int pos = 0;
+    for (int k = 0; k < N; k++)
+        if (*cell[k] != 0) temp_row[pos++] = *cell[k];
+
+    for (int i = 0; i < pos - 1; i++) {
+        if (temp_row[i] == temp_row[i + 1] && temp_row[i] != 0) {
+            temp_row[i] *= 2;
+            old_score += temp_row[i];
+            if (temp_row[i] == 2048) old_victory = 1;
+            temp_row[i + 1] = 0;
+            break;
+        }
+    }
+
+    int final_row[N] = { 0 };
+    int slot = 0;
+    for (int i = 0; i < pos; i++)
+        if (temp_row[i] != 0) final_row[slot++] = temp_row[i];
+
+    for (int k = 0; k < N; k++) {
+        if (*cell[k] != final_row[k]) {
+            *cell[k] = final_row[k];
+            success = 1;
+        }
+    }
+    return success;
+}
+
+static int old_move(int dir)
+{
+    int moved = 0;
+    for (int line = 0; line < N; line++)
+        moved |= old_slide_line(dir, line);
+    return moved;
+}
+
+int main(int argc, char **argv)
+{
+    long boards = (argc > 1) ? atol(argv[1]) : 2000000;
+    long bad = check_tables(), bad_4 = 0;
+
+    printf("tables vs reference: %d entries, %ld mismatches\n", 65536 + 4096 + 4096, bad);
+
+    for (long i = 0; i < boards; i++) {
+        g2048_board_t b = random_board();
+        int dir = (int)(rng_next() % 4);
+        uint32_t s1 = 0, s2 = 0;
+        int w1 = 0, w2 = 0;
+
+        if (G2048_Move(b, dir, &s1, &w1) != ref_move(b, dir, &s2, &w2) || s1 != s2 || w1 != w2)
+            bad_4++;
+    }
+    bad += bad_4;
+    printf("G2048_Move vs reference: %ld boards, %ld mismatches\n", boards, bad_4);
+
+    /* Same boards for both engines */
+    enum { SET = 4096, REPS = 500 };
+    static g2048_board_t set[SET];
+    static int grids[SET][N][N];
+    for (int i = 0; i < SET; i++) {
+        set[i] = random_board();
+        for (int k = 0; k < N * N; k++) {
+            int e = G2048_CELL(set[i], k / N, k % N);
+            grids[i][k / N][k % N] = e ? 1 << e : 0;
+        }
+    }
+
+    volatile uint64_t sink = 0;
+    clock_t t0 = clock();
+    for (int r = 0; r < REPS; r++) {
+        for (int i = 0; i < SET; i++) {
+            uint32_t s = 0;
+            int w = 0;
+            sink += G2048_Move(set[i], i & 3, &s, &w);
+        }
+    }
+    double t_new = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    for (int r = 0; r < REPS; r++) {
+        for (int i = 0; i < SET; i++) {
+            for (int k = 0; k < N * N; k++) old_board[k / N][k % N] = grids[i][k / N][k % N];
+            sink += (uint64_t)old_move(i & 3);
+        }
+    }
+    double t_old = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    double moves = (double)SET * REPS;
+    printf("bitboard: %.1f M moves/s, int grid: %.1f M moves/s (x%.1f)\n",
+           moves / t_new / 1e6, moves / t_old / 1e6, t_old / t_new);
+
+    /* Every size's kernel */
+    for (int n = G2048_MIN_SIZE; n <= G2048_MAX_SIZE; n++) {
+        const g2048_variant_t *v = G2048_Variant(n);
+        static g2048_grid_t grids_n[SET];
+        long bad_n = 0;
+
+        for (long i = 0; i < boards / 4; i++) {
+            g2048_grid_t g = random_grid(n), want;
+            int dir = (int)(rng_next() % 4);
+            uint32_t s1 = 0, s2 = 0;
+            int w1 = 0, w2 = 0;
+
+            want = ref_grid_move(&g, n, dir, &s2, &w2);
+            int changed = 0, differs = 0;
+            for (int w = 0; w < G2048_GRID_WORDS; w++) changed |= (want.w[w] != g.w[w]);
+            int moved = v->move(&g, dir, &s1, &w1);
+            for (int w = 0; w < G2048_GRID_WORDS; w++) differs |= (g.w[w] != want.w[w]);
+            if (differs || moved != changed || s1 != s2 || w1 != w2) bad_n++;
+        }
+        bad += bad_n;
+
+        for (int i = 0; i < SET; i++) grids_n[i] = random_grid(n);
+        t0 = clock();
+        for (int r = 0; r < REPS; r++) {
+            for (int i = 0; i < SET; i++) {
+                g2048_grid_t g = grids_n[i];
+                uint32_t s = 0;
+                int w = 0;
+                sink += (uint64_t)v->move(&g, i & 3, &s, &w);
+            }
+        }
+        double t_n = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("%dx%d kernel: %ld boards, %ld mismatches, %.1f M moves/s\n",
+               n, n, boards / 4, bad_n, moves / t_n / 1e6);
+    }
+    return bad ? 1 : 0;
+}
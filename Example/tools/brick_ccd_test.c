@@ -0,0 +1,214 @@
+/* brick_ccd_test.c - host tunneling check for the brick breaker ball
+ *
+ * Fires the ball along random trajectories through random brick
+ * fields laid out as in brick_game.c (240x320) and counts, per frame:
+ *   tunnel   no hit and no turn, yet the path crossed a live brick
+ *            or the paddle (sampled 64 times along the move)
+ *   inside   the frame ends with the ball overlapping a live brick
+ *   escape   the ball ends outside the walls
+ *   side     one brick hit entered through a side face, but vx kept
+ *            its sign and vy turned instead (frames that may have
+ *            reached a wall as well are left out)
+ * for BrickPhys_Step() (brick_physics.c) and for the step it replaced
+ * (integer move, then overlap test, vy turns on any brick), on the
+ * same trajectories with the speeds rounded to whole pixels.
+ *
+ *     gcc -O2 -I.. -o brick_ccd_test brick_ccd_test.c ../brick_physics.c -lm
+ *     ./brick_ccd_test [max_speed_px_per_frame] [trajectories]
+ *
+ * Exits 1 when the swept step has any tunnel, inside, escape or side
+ * count.
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "brick_physics.h"
+
+#define SCREEN_W        240
+#define SCREEN_H        320
+#define PADDLE_W        40
+#define PADDLE_H        6
+#define BALL_SIZE       6
+#define BRICK_ROWS      5
+#define BRICK_COLS      8
+#define BRICK_GAP       2
+#define BRICK_H         10
+#define BRICKS          (BRICK_ROWS * BRICK_COLS)
+#define FRAMES          400
+
+typedef struct { long frames, hits, tunnel, inside, escape, side; } counts_t;
+
+static uint64_t rng_state = 11;
+static uint32_t rng_next(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)rng_state;
+}
+
+static float rng_range(float a, float b)
+{
+    return a + (b - a) * (float)(rng_next() % 100000) / 100000.0f;
+}
+
+static int overlaps(float x, float y, brick_rect_t r)
+{
+    return x < r.x + r.w && x + BALL_SIZE > r.x && y < r.y + r.h && y + BALL_SIZE > r.y;
+}
+
+/* The step before brick_physics.c, on whole pixels */
+static int old_step(brick_ball_t *pBall, brick_field_t *pField)
+{
+    pBall->x += pBall->vx;
+    pBall->y += pBall->vy;
+
+    if (pBall->x <= 0) { pBall->x = 0; pBall->vx = -pBall->vx; }
+    else if (pBall->x >= pField->w - BALL_SIZE) { pBall->x = (float)(pField->w - BALL_SIZE); pBall->vx = -pBall->vx; }
+    if (pBall->y <= 0) { pBall->y = 0; pBall->vy = -pBall->vy; }
+    else if (pBall->y >= pField->h) return 0;
+
+    if (overlaps(pBall->x, pBall->y, pField->paddle)) {
+        pBall->vy = -fabsf(pBall->vy);
+        pBall->y = (float)(pField->paddle.y - BALL_SIZE - 1);
+    }
+    for (int i = 0; i < pField->count; i++) {
+        brick_block_t *b = &pField->pBricks[i];
+        if (b->active && overlaps(pBall->x, pBall->y, b->rect)) {
+            b->active = 0;
+            pBall->vy = -pBall->vy;
+            pField->remaining--;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Did the path (x0, y0) + t * (vx, vy), t in (0, 1], enter b through a side? */
+static int entered_side(float x0, float y0, float vx, float vy, brick_rect_t b)
+{
+    float py = y0;
+
+    for (int s = 1; s <= 4096; s++) {
+        float x = x0 + vx * s / 4096.0f, y = y0 + vy * s / 4096.0f;
+        if (overlaps(x, y, b)) return py + BALL_SIZE > b.y && py < b.y + b.h;
+        py = y;
+    }
+    return 0;
+}
+
+static void run(int old, const brick_block_t *pLayout, brick_rect_t paddle,
+                brick_ball_t start, counts_t *pCounts)
+{
+    brick_block_t bricks[BRICKS];
+    brick_field_t field = { SCREEN_W, SCREEN_H, BALL_SIZE, paddle, bricks, BRICKS, 0 };
+    brick_ball_t ball = start;
+
+    for (int i = 0; i < BRICKS; i++) {
+        bricks[i] = pLayout[i];
+        field.remaining += bricks[i].active;
+    }
+    if (old) {
+        ball.x  = floorf(ball.x);
+        ball.y  = floorf(ball.y);
+        ball.vx = roundf(ball.vx);
+        ball.vy = roundf(ball.vy);
+        if (ball.vy == 0) ball.vy = -1;
+    }
+
+    for (int f = 0; f < FRAMES && field.remaining > 0 && ball.y < SCREEN_H; f++) {
+        brick_ball_t b0 = ball;
+        int before[BRICKS];
+
+        for (int i = 0; i < BRICKS; i++) before[i] = bricks[i].active;
+
+        int hits = old ? old_step(&ball, &field) : BrickPhys_Step(&ball, &field);
+        pCounts->frames++;
+        pCounts->hits += hits;
+        if (field.remaining == 0 || ball.y >= SCREEN_H) break;
+
+        /* Straight frame: the path must miss every live brick, and the
+         * paddle unless a side wall may have turned the ball */
+        if (hits == 0 && ball.vx == b0.vx && ball.vy == b0.vy) {
+            int near_wall = b0.x < fabsf(b0.vx) + 1 || b0.x > SCREEN_W - BALL_SIZE - fabsf(b0.vx) - 1;
+            for (int s = 1; s <= 64; s++) {
+                float x = b0.x + b0.vx * s / 64.0f, y = b0.y + b0.vy * s / 64.0f;
+                int hit = !near_wall && overlaps(x, y, paddle);
+                for (int i = 0; i < BRICKS; i++)
+                    if (before[i] && overlaps(x, y, bricks[i].rect)) hit = 1;
+                if (hit) {
+                    pCounts->tunnel++;
+                    break;
+                }
+            }
+        }
+
+        /* One brick hit through its side: vx must turn. Not counted when
+         * the frame may have reached a wall, which turns it back */
+        int clear_of_walls = ball.x > fabsf(b0.vx) && ball.x < SCREEN_W - BALL_SIZE - fabsf(b0.vx) &&
+                             ball.y > fabsf(b0.vy);
+        if (hits == 1 && clear_of_walls && ball.vx == b0.vx && ball.vy == -b0.vy) {
+            for (int i = 0; i < BRICKS; i++)
+                if (before[i] && !bricks[i].active &&
+                    entered_side(b0.x, b0.y, b0.vx, b0.vy, bricks[i].rect))
+                    pCounts->side++;
+        }
+
+        for (int i = 0; i < BRICKS; i++) {
+            if (bricks[i].active && overlaps(ball.x, ball.y, bricks[i].rect)) {
+                pCounts->inside++;
+                break;
+            }
+        }
+        if (ball.x < -0.01f || ball.x > SCREEN_W - BALL_SIZE + 0.01f || ball.y < -0.01f)
+            pCounts->escape++;
+    }
+}
+
+static void print(const char *name, const counts_t *c)
+{
+    printf("%-7s frames %7ld, brick hits %6ld, tunnel %5ld, inside %5ld, escape %4ld, side %5ld\n",
+           name, c->frames, c->hits, c->tunnel, c->inside, c->escape, c->side);
+}
+
+int main(int argc, char **argv)
+{
+    float vmax  = (argc > 1) ? (float)atof(argv[1]) : 12.0f;
+    int   count = (argc > 2) ? atoi(argv[2]) : 5000;
+    counts_t swept = { 0 }, old = { 0 };
+    int brick_w = (SCREEN_W - BRICK_GAP * (BRICK_COLS + 1)) / BRICK_COLS;
+
+    for (int n = 0; n < count; n++) {
+        brick_block_t layout[BRICKS];
+        int active = 0;
+
+        for (int i = 0; i < BRICKS; i++) {
+            int r = i / BRICK_COLS, c = i % BRICK_COLS;
+            layout[i].rect.x = BRICK_GAP + c * (brick_w + BRICK_GAP);
+            layout[i].rect.y = BRICK_GAP + r * (BRICK_H + BRICK_GAP) + 25;
+            layout[i].rect.w = brick_w;
+            layout[i].rect.h = BRICK_H;
+            layout[i].active = (int)(rng_next() & 1);
+            active += layout[i].active;
+        }
+        if (active < 2) continue;
+
+        brick_rect_t paddle = { (int)(rng_next() % (SCREEN_W - PADDLE_W)), SCREEN_H - 20, PADDLE_W, PADDLE_H };
+
+        /* Upwards, never flat */
+        float speed = rng_range(1.0f, vmax), angle = rng_range(0.2f, 2.94f);
+        brick_ball_t ball = {
+            rng_range(0.0f, SCREEN_W - BALL_SIZE), rng_range(paddle.y - 80.0f, paddle.y - BALL_SIZE - 1.0f),
+            speed * cosf(angle), -speed * sinf(angle)
+        };
+
+        run(0, layout, paddle, ball, &swept);
+        run(1, layout, paddle, ball, &old);
+    }
+
+    printf("%d trajectories, speed up to %.0f px per frame\n", count, vmax);
+    print("swept:", &swept);
+    print("old:", &old);
+    return (swept.tunnel || swept.inside || swept.escape || swept.side) ? 1 : 0;
+}
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Generate 2048_tables.c: the lookup tables of the 2048 move kernels.
+
+Row tables, for the 3x3 and 4x4 boards. A row is 3 or 4 4-bit
+exponents (0 = empty, n = tile 2^n), cell 0 in the low nibble. The
+table entry for a row is that row slid towards cell 0:
+
+    bits  0-15  the row after the move
+    bits 16-30  score gained / 4 (every merge makes at least a 4)
+    bit  31     the move made a 2048 tile
+
+Two 32768 tiles do not merge, 65536 does not fit in a nibble.
+
+Pair table, for the 5x5 and 6x6 boards, whose rows would need
+4 MB and up: a row is slid two cells at a time, carrying the last
+tile that may still merge (the open tile). The entry for (open, two
+cells) is
+
+    bits  0-7   tiles finished, at most two, first in the low nibble
+    bits  8-9   how many
+    bits 10-13  the open tile after the two cells (0 = none)
+    bit  14     a merge made a 2048 tile
+    bits 16-31  score gained (one merge at most)
+
+indexed by open << 8 | cells, first cell in the low nibble.
+
+The output is committed; run this again when the table format or
+the merge rules change. It is not part of the uVision build: MDK
+ships no Python, and a "Before Build" user command would make it a
+dependency of every machine that opens the project. Instead --check
+regenerates the tables and compares them with the committed file,
+and tools/bench_2048_move.c checks every entry against a C slide.
+
+    python tools/gen_2048_tables.py > 2048_tables.c
+    python tools/gen_2048_tables.py --check 2048_tables.c
+"""
+
+import sys
+
+WIN_EXP = 11            # 2048
+MAX_EXP = 15
+
+
+def move_left(row, n):
+    cells = [(row >> (4 * k)) & 0xF for k in range(n)]
+    tiles = [e for e in cells if e]
+    out, gained, won = [], 0, 0
+    i = 0
+    while i < len(tiles):
+        e = tiles[i]
+        if i + 1 < len(tiles) and tiles[i + 1] == e and e < MAX_EXP:
+            e += 1
+            gained += 1 << e
+            won |= (e == WIN_EXP)
+            i += 2
+        else:
+            i += 1
+        out.append(e)
+    result = 0
+    for k, e in enumerate(out):
+        result |= e << (4 * k)
+    return result | ((gained >> 2) << 16) | (won << 31)
+
+
+def slide_pair(index):
+    open_tile = index >> 8
+    done, gained, won = [], 0, 0
+    for e in (index & 0xF, (index >> 4) & 0xF):
+        if e == 0:
+            continue
+        if e == open_tile and e < MAX_EXP:
+            done.append(e + 1)
+            gained += 1 << (e + 1)
+            won |= (e + 1 == WIN_EXP)
+            open_tile = 0
+        else:
+            if open_tile:
+                done.append(open_tile)
+            open_tile = e
+    tiles = 0
+    for k, e in enumerate(done):
+        tiles |= e << (4 * k)
+    return tiles | (len(done) << 8) | (open_tile << 10) | (won << 14) | (gained << 16)
+
+
+def pair_table(w):
+    w("\nconst uint32_t slide_pair_table[4096] = {\n")
+    for base in range(0, 4096, 8):
+        w("    " + " ".join("0x%08X," % slide_pair(i) for i in range(base, base + 8)) + "\n")
+    w("};\n")
+
+
+def row_table(w, name, n):
+    entries = 1 << (4 * n)
+    w("\nconst uint32_t %s[%d] = {\n" % (name, entries))
+    for base in range(0, entries, 8):
+        w("    " + " ".join("0x%08X," % move_left(r, n) for r in range(base, base + 8)) + "\n")
+    w("};\n")
+
+
+def generate(w):
+    w("/* 2048_tables.c - generated by tools/gen_2048_tables.py, do not edit */\n")
+    w('#include "2048_tables.h"\n')
+    row_table(w, "row_left_table", 4)
+    row_table(w, "row_left_table3", 3)
+    pair_table(w)
+
+
+def main():
+    if len(sys.argv) == 3 and sys.argv[1] == "--check":
+        out = []
+        generate(out.append)
+        with open(sys.argv[2], newline="") as f:
+            committed = f.read()
+        if committed.replace("\r\n", "\n") != "".join(out):
+            sys.stderr.write("%s differs from the generator, run it again\n" % sys.argv[2])
+            return 1
+        print("%s matches the generator" % sys.argv[2])
+        return 0
+    generate(sys.stdout.write)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
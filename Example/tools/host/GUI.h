@@ -0,0 +1,96 @@
+/* GUI.h - host stand-in for the emWin API that the games' drawing
+ * code uses (gfx.c, hud.c, dlist.h, snake_game.c). Host harnesses
+ * only; the calls are implemented in host/game_host.c, which counts
+ * the pixels they would write to the panel. */
+#ifndef HOST_GUI_H
+#define HOST_GUI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t  U8;
+typedef uint16_t U16;
+typedef uint32_t U32;
+typedef int16_t  I16;
+typedef int32_t  I32;
+
+typedef U32 GUI_COLOR;
+typedef U32 LCD_COLOR;
+
+typedef struct { I16 x0, y0, x1, y1; } GUI_RECT;
+
+/* Fonts are fixed-pitch boxes on the host */
+typedef struct GUI_FONT { int dist_x, size_y; } GUI_FONT;
+extern const GUI_FONT GUI_Font13_ASCII, GUI_Font20_ASCII;
+#define GUI_FONT_13_ASCII       &GUI_Font13_ASCII
+#define GUI_FONT_20_ASCII       &GUI_Font20_ASCII
+
+typedef struct {
+    int              NumEntries;
+    char             HasTrans;
+    const LCD_COLOR *pPalEntries;
+} GUI_LOGPALETTE;
+
+typedef struct GUI_BITMAP_METHODS GUI_BITMAP_METHODS;
+typedef struct {
+    U16 XSize, YSize, BytesPerLine, BitsPerPixel;
+    const U8                 *pData;
+    const GUI_LOGPALETTE     *pPal;
+    const GUI_BITMAP_METHODS *pMethods;
+} GUI_BITMAP;
+
+#define GUI_BLACK               0x00000000
+#define GUI_WHITE               0x00FFFFFF
+#define GUI_RED                 0x000000FF
+#define GUI_GREEN               0x0000FF00
+#define GUI_ORANGE              0x0000A5FF
+#define GUI_MAGENTA             0x00FF00FF
+#define GUI_CYAN                0x00FFFF00
+#define GUI_YELLOW              0x0000FFFF
+
+#define GUI_TM_TRANS            2
+#define GUI_TM_REV              4
+#define GUI_TA_HCENTER          2
+#define GUI_TA_VCENTER          12
+
+/* Memory devices: GUI_MEMDEV_Draw() draws off-screen and then
+ * writes the whole rectangle once, as emWin does; the others
+ * fail, so the HUD draws its digits as text */
+typedef int GUI_MEMDEV_Handle;
+typedef void GUI_CALLBACK_VOID_P(void *p);
+#define GUI_MEMDEV_NOTRANS      0
+#define GUI_MEMDEV_APILIST_1    NULL
+#define GUICC_1                 NULL
+
+void      GUI_Clear(void);
+void      GUI_FillRect(int x0, int y0, int x1, int y1);
+void      GUI_DrawBitmap(const GUI_BITMAP *pBM, int x0, int y0);
+void      GUI_SetColor(GUI_COLOR color);
+void      GUI_SetBkColor(GUI_COLOR color);
+GUI_COLOR GUI_GetColor(void);
+GUI_COLOR GUI_GetBkColor(void);
+
+const GUI_FONT *GUI_SetFont(const GUI_FONT *pFont);
+int       GUI_SetTextMode(int mode);
+int       GUI_GetTextMode(void);
+int       GUI_GetCharDistX(U16 c);
+int       GUI_GetFontSizeY(void);
+int       GUI_GetStringDistX(const char *s);
+void      GUI_DispStringAt(const char *s, int x, int y);
+void      GUI_DispStringHCenterAt(const char *s, int x, int y);
+void      GUI_DispStringInRect(const char *s, GUI_RECT *pRect, int align);
+
+int       GUI_MEMDEV_Draw(GUI_RECT *pRect, GUI_CALLBACK_VOID_P *pfDraw, void *p,
+                          int lines, int flags);
+GUI_MEMDEV_Handle GUI_MEMDEV_CreateFixed(int x0, int y0, int xsize, int ysize, int flags,
+                                         const void *pApi, const void *pColorConv);
+GUI_MEMDEV_Handle GUI_MEMDEV_Select(GUI_MEMDEV_Handle hMem);
+void      GUI_MEMDEV_Delete(GUI_MEMDEV_Handle hMem);
+void     *GUI_MEMDEV_GetDataPtr(GUI_MEMDEV_Handle hMem);
+int       GUI_ALLOC_GetNumUsedBytes(void);
+int       GUI_ALLOC_GetNumFreeBytes(void);
+
+int       LCD_GetXSize(void);
+int       LCD_GetYSize(void);
+
+#endif
@@ -0,0 +1,7 @@
+/* LCD.h - host stand-in, the LCD_ calls are in host/GUI.h */
+#ifndef HOST_LCD_H
+#define HOST_LCD_H
+
+#include "GUI.h"
+
+#endif
@@ -0,0 +1,10 @@
+/* cmsis_compiler.h - host stand-in for the interrupt masking the
+ * plain-C modules use. Masking is one lock that the harness's fake
+ * interrupt (tools/vsync_sim.c) also holds while it runs. */
+#ifndef HOST_CMSIS_COMPILER_H
+#define HOST_CMSIS_COMPILER_H
+
+void __disable_irq(void);
+void __enable_irq(void);
+
+#endif
@@ -0,0 +1,25 @@
+/* cmsis_os2.h - host stand-in for the CMSIS-RTOS2 calls that the
+ * plain-C modules make (vsync.c) and the games' RTOS calls. Host
+ * harnesses only: the thread flags are implemented on POSIX threads
+ * in tools/vsync_sim.c, the kernel tick and delays in
+ * host/game_host.c. */
+#ifndef HOST_CMSIS_OS2_H
+#define HOST_CMSIS_OS2_H
+
+#include <stdint.h>
+
+typedef void   *osThreadId_t;
+typedef int32_t osStatus_t;
+
+#define osWaitForever           0xFFFFFFFFU
+#define osFlagsWaitAny          0x00000000U
+#define osFlagsErrorTimeout     0xFFFFFFFEU
+
+osThreadId_t osThreadGetId(void);
+uint32_t     osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags);
+uint32_t     osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout);
+
+uint32_t     osKernelGetTickCount(void);
+osStatus_t   osDelay(uint32_t ticks);
+
+#endif
@@ -0,0 +1,229 @@
+/* game_host.c - host stand-ins for the calls a game makes outside
+ * its plain-C modules, so the game's own source (snake_game.c) runs
+ * in a host harness:
+ *   emWin      counts the pixels each call would write to the panel
+ *   dlist.c    commands are replayed at once, as the render thread
+ *              would (dl_execute())
+ *   vsync.c    no waiting
+ *   perf.c     keeps the last report of each message
+ *   RTOS       a kernel tick that only osDelay() advances
+ *   keypad     host_key
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <string.h>
+#include <time.h>
+#include "GUI.h"
+#include "cmsis_os2.h"
+#include "dlist.h"
+#include "gfx.h"
+#include "input.h"
+#include "perf.h"
+#include "vsync.h"
+#include "game_host.h"
+
+#define HOST_PERF_MSGS  64
+
+uint32_t host_fill_pixels;
+uint32_t host_text_pixels;
+char     host_key;
+
+static int       lcd_w = 240, lcd_h = 320;
+static int       offscreen;         // inside GUI_MEMDEV_Draw()
+static GUI_COLOR color, bk_color;
+static int       text_mode;
+static const GUI_FONT *font = GUI_FONT_13_ASCII;
+static uint32_t  tick;
+
+static struct { uint32_t val1, val2, count; } perf[HOST_PERF_MSGS];
+
+const GUI_FONT GUI_Font13_ASCII = { 7, 13 };
+const GUI_FONT GUI_Font20_ASCII = { 10, 20 };
+
+/************************************************************
+ * emWin
+ ************************************************************/
+static uint32_t clipped(int x0, int y0, int x1, int y1)
+{
+    if (x0 < 0)      x0 = 0;
+    if (y0 < 0)      y0 = 0;
+    if (x1 >= lcd_w) x1 = lcd_w - 1;
+    if (y1 >= lcd_h) y1 = lcd_h - 1;
+
+    if (offscreen || x1 < x0 || y1 < y0) return 0;
+    return (uint32_t)(x1 - x0 + 1) * (uint32_t)(y1 - y0 + 1);
+}
+
+void Host_SetLCDSize(int xsize, int ysize)
+{
+    lcd_w = xsize;
+    lcd_h = ysize;
+}
+
+int LCD_GetXSize(void) { return lcd_w; }
+int LCD_GetYSize(void) { return lcd_h; }
+
+void GUI_Clear(void)
+{
+    host_fill_pixels += clipped(0, 0, lcd_w - 1, lcd_h - 1);
+}
+
+void GUI_FillRect(int x0, int y0, int x1, int y1)
+{
+    host_fill_pixels += clipped(x0, y0, x1, y1);
+}
+
+void GUI_DrawBitmap(const GUI_BITMAP *pBM, int x0, int y0)
+{
+    host_text_pixels += clipped(x0, y0, x0 + pBM->XSize - 1, y0 + pBM->YSize - 1);
+}
+
+void      GUI_SetColor(GUI_COLOR c)   { color = c; }
+void      GUI_SetBkColor(GUI_COLOR c) { bk_color = c; }
+GUI_COLOR GUI_GetColor(void)          { return color; }
+GUI_COLOR GUI_GetBkColor(void)        { return bk_color; }
+
+const GUI_FONT *GUI_SetFont(const GUI_FONT *pFont)
+{
+    const GUI_FONT *old = font;
+    font = pFont;
+    return old;
+}
+
+int GUI_SetTextMode(int mode)
+{
+    int old = text_mode;
+    text_mode = mode;
+    return old;
+}
+
+int GUI_GetTextMode(void)           { return text_mode; }
+int GUI_GetCharDistX(U16 c)         { (void)c; return font->dist_x; }
+int GUI_GetFontSizeY(void)          { return font->size_y; }
+int GUI_GetStringDistX(const char *s) { return font->dist_x * (int)strlen(s); }
+
+void GUI_DispStringAt(const char *s, int x, int y)
+{
+    host_text_pixels += clipped(x, y, x + GUI_GetStringDistX(s) - 1, y + font->size_y - 1);
+}
+
+void GUI_DispStringHCenterAt(const char *s, int x, int y)
+{
+    GUI_DispStringAt(s, x - GUI_GetStringDistX(s) / 2, y);
+}
+
+void GUI_DispStringInRect(const char *s, GUI_RECT *pRect, int align)
+{
+    (void)align;
+    GUI_DispStringAt(s, pRect->x0, pRect->y0);
+}
+
+int GUI_MEMDEV_Draw(GUI_RECT *pRect, GUI_CALLBACK_VOID_P *pfDraw, void *p,
+                    int lines, int flags)
+{
+    (void)lines;
+    (void)flags;
+
+    offscreen = 1;
+    pfDraw(p);
+    offscreen = 0;
+
+    host_fill_pixels += clipped(pRect->x0, pRect->y0, pRect->x1, pRect->y1);
+    return 0;
+}
+
+GUI_MEMDEV_Handle GUI_MEMDEV_CreateFixed(int x0, int y0, int xsize, int ysize, int flags,
+                                         const void *pApi, const void *pColorConv)
+{
+    (void)x0; (void)y0; (void)xsize; (void)ysize; (void)flags;
+    (void)pApi; (void)pColorConv;
+    return 0;
+}
+
+GUI_MEMDEV_Handle GUI_MEMDEV_Select(GUI_MEMDEV_Handle hMem) { (void)hMem; return 0; }
+void  GUI_MEMDEV_Delete(GUI_MEMDEV_Handle hMem)             { (void)hMem; }
+void *GUI_MEMDEV_GetDataPtr(GUI_MEMDEV_Handle hMem)         { (void)hMem; return NULL; }
+int   GUI_ALLOC_GetNumUsedBytes(void)                       { return 0; }
+int   GUI_ALLOC_GetNumFreeBytes(void)                       { return 64 * 1024; }
+
+/************************************************************
+ * DISPLAY LIST
+ ************************************************************/
+void DL_Init(void) {}
+
+void DL_FillRect(int x0, int y0, int x1, int y1, GUI_COLOR c)
+{
+    GUI_SetColor(c);
+    Gfx_FillRect(x0, y0, x1, y1);
+}
+
+void DL_Bitmap(const GUI_BITMAP *pBitmap, int x, int y)
+{
+    GUI_DrawBitmap(pBitmap, x, y);
+}
+
+void DL_Text(const char *s, int x, int y, const GUI_FONT *pFont,
+             GUI_COLOR c, GUI_COLOR bk)
+{
+    GUI_SetColor(c);
+    GUI_SetBkColor(bk);
+    GUI_SetFont(pFont);
+    GUI_DispStringAt(s, x, y);
+}
+
+void     DL_Submit(void)      {}
+void     DL_Flush(void)       {}
+uint32_t DL_GetStalls(void)   { return 0; }
+
+/************************************************************
+ * VSYNC, PERF, RTOS, KEYPAD
+ ************************************************************/
+void VSync_WaitEdge(vsync_frame_t *pFrame)  { (void)pFrame; }
+void VSync_FrameDone(vsync_frame_t *pFrame) { (void)pFrame; }
+
+void Perf_Init(void) {}
+
+uint32_t Perf_Cycles(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)(t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec);
+}
+
+uint32_t Perf_CyclesToUs(uint32_t cycles)
+{
+    return cycles / 1000U;
+}
+
+void Perf_Report(uint32_t msg, uint32_t val1, uint32_t val2)
+{
+    if (msg >= HOST_PERF_MSGS) return;
+    perf[msg].val1 = val1;
+    perf[msg].val2 = val2;
+    perf[msg].count++;
+}
+
+uint32_t Host_PerfLast(uint32_t msg, uint32_t *pVal1, uint32_t *pVal2)
+{
+    if (msg >= HOST_PERF_MSGS) return 0;
+    if (pVal1) *pVal1 = perf[msg].val1;
+    if (pVal2) *pVal2 = perf[msg].val2;
+    return perf[msg].count;
+}
+
+uint32_t osKernelGetTickCount(void)
+{
+    return tick;
+}
+
+osStatus_t osDelay(uint32_t ticks)
+{
+    tick += ticks;
+    return 0;
+}
+
+void Keypad_Init(void) {}
+
+char Keypad_Get_Key(void)
+{
+    return host_key;
+}
@@ -0,0 +1,25 @@
+/* game_host.h - what the host stand-ins in game_host.c record */
+#ifndef HOST_GAME_HOST_H
+#define HOST_GAME_HOST_H
+
+#include <stdint.h>
+
+/* Pixels written to the panel, clipped to it: by GUI_FillRect() and
+ * GUI_Clear() (and the copy of a GUI_MEMDEV_Draw() rectangle), and
+ * by text and bitmaps (their boxes). Drawing inside GUI_MEMDEV_Draw()
+ * is off-screen and not counted. */
+extern uint32_t host_fill_pixels;
+extern uint32_t host_text_pixels;
+
+/* Panel size returned by LCD_GetXSize()/LCD_GetYSize(), 240x320 at
+ * start */
+void     Host_SetLCDSize(int xsize, int ysize);
+
+/* Key returned by Keypad_Get_Key(), 0 = none */
+extern char host_key;
+
+/* Last values sent with Perf_Report(msg) and how many times it was
+ * sent. Perf_Cycles() counts host nanoseconds. */
+uint32_t Host_PerfLast(uint32_t msg, uint32_t *pVal1, uint32_t *pVal2);
+
+#endif
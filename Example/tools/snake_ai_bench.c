@@ -0,0 +1,111 @@
+/* snake_ai_bench.c - host benchmark for the snake autopilot
+ *
+ * Plays whole games with snake_ai.c steering, on the game's board
+ * (snake_board.c): wrapping edges, fruit on a random free cell, head
+ * into any body cell ends the game. Reports games won, average final
+ * length, games/s and decisions/s. No emWin, no RTOS.
+ *
+ *     gcc -O2 -I.. -o snake_ai_bench snake_ai_bench.c ../snake_ai.c ../snake_board.c
+ *     ./snake_ai_bench [games] [grid_w grid_h]
+ *
+ * The board may not exceed MAX_CELLS (snake_game.h): build with
+ * -DCELL_SIZE=8 for 30x40, -DCELL_SIZE=4 for 60x80.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "snake_game.h"
+#include "snake_ai.h"
+#include "snake_board.h"
+
+static int grid_w, grid_h, cells;
+static int fruit;
+
+static uint32_t rng_state;
+static uint32_t rng_next(void)
+{
+    uint32_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return rng_state = x;
+}
+
+static int place_fruit(void)
+{
+    int free_count = SnakeBoard_FreeCount();
+
+    if (free_count == 0) return 0;
+    fruit = SnakeBoard_FreeCell((int)(rng_next() % (uint32_t)free_count));
+    return 1;
+}
+
+static int step(int cell, int dir)
+{
+    int x = cell % grid_w, y = cell / grid_w;
+
+    switch (dir) {
+        case SNAKE_AI_UP:    y = (y == 0) ? grid_h - 1 : y - 1; break;
+        case SNAKE_AI_DOWN:  y = (y == grid_h - 1) ? 0 : y + 1; break;
+        case SNAKE_AI_LEFT:  x = (x == 0) ? grid_w - 1 : x - 1; break;
+        default:             x = (x == grid_w - 1) ? 0 : x + 1; break;
+    }
+    return y * grid_w + x;
+}
+
+/* One game; returns 1 when the snake filled the board */
+static int play(long *pMoves)
+{
+    int tail, head;
+
+    SnakeAI_StartCells(&tail, &head);
+    SnakeBoard_Init(cells, 0);
+    SnakeBoard_Grow(tail);
+    SnakeBoard_Grow(head);
+    place_fruit();
+
+    for (;;) {
+        snake_ai_board_t b = { 1, SnakeBoard_Occupied(), SnakeBoard_Head(), SnakeBoard_Tail(),
+                               fruit, SnakeBoard_Length() };
+        int next = step(SnakeBoard_Head(), SnakeAI_NextDir(&b));
+
+        (*pMoves)++;
+        if (SnakeBoard_IsTaken(next)) return 0;
+
+        int ate = (next == fruit);
+        if (!ate)
+            SnakeBoard_Shrink();
+        SnakeBoard_Grow(next);
+
+        if (ate && !place_fruit()) return 1;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int games = (argc > 1) ? atoi(argv[1]) : 100;
+    grid_w = (argc > 3) ? atoi(argv[2]) : 20;
+    grid_h = (argc > 3) ? atoi(argv[3]) : 26;
+    cells  = grid_w * grid_h;
+
+    if (games < 1 || cells > MAX_CELLS || SnakeAI_Init(grid_w, grid_h) != 0) {
+        fprintf(stderr, "%dx%d: no cycle, or more than MAX_CELLS (%d)\n", grid_w, grid_h, MAX_CELLS);
+        return 1;
+    }
+
+    long moves = 0, total_len = 0;
+    int  wins = 0;
+    clock_t t0 = clock();
+
+    for (int g = 0; g < games; g++) {
+        rng_state = 0x12345678u + (uint32_t)g * 7919u;
+        wins += play(&moves);
+        total_len += SnakeBoard_Length();
+    }
+
+    double s = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    printf("%dx%d: %d games, %d won, average length %.1f, %.1f games/s, %.2f M decisions/s\n",
+           grid_w, grid_h, games, wins, (double)total_len / games,
+           games / s, moves / s / 1e6);
+    return (wins == games) ? 0 : 2;
+}
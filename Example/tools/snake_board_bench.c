@@ -0,0 +1,170 @@
+/* snake_board_bench.c - host benchmark for the snake's moves
+ *
+ * Times one move (collision test, SnakeBoard_Shrink(), SnakeBoard_Grow())
+ * and one grow (SnakeBoard_Grow() alone) at snake lengths from 2 to most
+ * of the board, next to the body the game had before snake_board.c: an
+ * array of (x, y) shifted down one slot per move, behind a linear
+ * collision scan. The snake runs along a Hamiltonian cycle of the board,
+ * so it never dies and holds any length.
+ *
+ *     gcc -O2 -DCELL_SIZE=4 -I.. -o snake_board_bench snake_board_bench.c ../snake_board.c ../snake_ai.c
+ *     ./snake_board_bench
+ *
+ * The board is the whole LCD_MAX_W x LCD_MAX_H panel at CELL_SIZE
+ * (60x80 at 4 px); its height must be even for the cycle.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "snake_board.h"
+
+#define GRID_W      (LCD_MAX_W / CELL_SIZE)
+#define GRID_H      (LCD_MAX_H / CELL_SIZE)
+#define CELLS       (GRID_W * GRID_H)
+#define GROW_BATCH  64          /* Grows timed between clock reads */
+#define MIN_NS      100000000.0 /* Time each figure for at least this */
+
+static int tour[CELLS];         /* Cells in cycle order */
+
+static double now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/* Row 0 left to right, rows 1..h-1 back and forth over columns
+ * 1..w-1, then up column 0 (as snake_ai.c) */
+static void build_tour(void)
+{
+    int n = 0;
+
+    for (int x = 0; x < GRID_W; x++) tour[n++] = x;
+    for (int y = 1; y < GRID_H; y++) {
+        for (int k = 1; k < GRID_W; k++) {
+            int x = (y & 1) ? GRID_W - k : k;
+            tour[n++] = y * GRID_W + x;
+        }
+    }
+    for (int y = GRID_H - 1; y > 0; y--) tour[n++] = y * GRID_W;
+}
+
+/* Snake on tour[0..len-1]; returns the tour position of the next cell */
+static int lay_snake(int len)
+{
+    SnakeBoard_Init(CELLS, 0);
+    for (int i = 0; i < len; i++) SnakeBoard_Grow(tour[i]);
+    return len;
+}
+
+static double ring_move_ns(int len)
+{
+    int pos = lay_snake(len);
+    long moves = 0;
+    double t0 = now_ns(), t;
+
+    do {
+        for (int k = 0; k < 10000; k++) {
+            int next = tour[pos];
+            if (SnakeBoard_IsTaken(next)) abort();
+            SnakeBoard_Shrink();
+            SnakeBoard_Grow(next);
+            pos = (pos + 1 == CELLS) ? 0 : pos + 1;
+        }
+        moves += 10000;
+    } while ((t = now_ns() - t0) < MIN_NS);
+    return t / moves;
+}
+
+/* GROW_BATCH grows from len, timed; the same number of shrinks, not
+ * timed, bring it back */
+static double ring_grow_ns(int len)
+{
+    int pos = lay_snake(len);
+    long grows = 0;
+    double spent = 0.0, t0 = now_ns();
+
+    while (now_ns() - t0 < 2 * MIN_NS) {
+        double t1 = now_ns();
+        for (int k = 0; k < GROW_BATCH; k++) {
+            SnakeBoard_Grow(tour[pos]);
+            pos = (pos + 1 == CELLS) ? 0 : pos + 1;
+        }
+        spent += now_ns() - t1;
+        grows += GROW_BATCH;
+
+        for (int k = 0; k < GROW_BATCH; k++) SnakeBoard_Shrink();
+    }
+    return spent / grows;
+}
+
+/************************************************************
+ * THE BODY BEFORE snake_board.c
+ ************************************************************/
+typedef struct { int x, y; } cell_t;
+static cell_t old_body[CELLS];
+
+static int old_collision(cell_t h, int len)
+{
+    for (int i = 0; i < len; i++)
+        if (old_body[i].x == h.x && old_body[i].y == h.y)
+            return 1;
+    return 0;
+}
+
+static double old_move_ns(int len)
+{
+    int pos = len;
+    long moves = 0;
+    double t0 = now_ns(), t;
+
+    /* Head first */
+    for (int i = 0; i < len; i++) {
+        old_body[i].x = tour[len - 1 - i] % GRID_W;
+        old_body[i].y = tour[len - 1 - i] / GRID_W;
+    }
+
+    do {
+        for (int k = 0; k < 100; k++) {
+            cell_t head = { tour[pos] % GRID_W, tour[pos] / GRID_W };
+            if (old_collision(head, len)) abort();
+            for (int i = len - 1; i > 0; i--)
+                old_body[i] = old_body[i - 1];
+            old_body[0] = head;
+            pos = (pos + 1 == CELLS) ? 0 : pos + 1;
+        }
+        moves += 100;
+    } while ((t = now_ns() - t0) < MIN_NS);
+    return t / moves;
+}
+
+int main(void)
+{
+    static const int lengths[] = { 2, 16, 128, 512, 1024, 2048, 4096, CELLS - 2 * GROW_BATCH };
+    double best = 1e9, worst = 0.0;
+
+    if (GRID_H & 1) {
+        fprintf(stderr, "%dx%d: odd height, no cycle\n", GRID_W, GRID_H);
+        return 1;
+    }
+    build_tour();
+
+    printf("%dx%d board (CELL_SIZE %d), ns per operation\n", GRID_W, GRID_H, CELL_SIZE);
+    printf("  length    move    grow   old move (array shift)\n");
+
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        int len = lengths[i];
+        if (len < 2 || len > CELLS - GROW_BATCH - 1) continue;
+
+        double move = ring_move_ns(len);
+        double grow = ring_grow_ns(len);
+        double old  = old_move_ns(len);
+
+        if (move < best)  best = move;
+        if (move > worst) worst = move;
+        printf("  %6d  %6.1f  %6.1f   %8.1f\n", len, move, grow, old);
+    }
+    printf("move: slowest / fastest length %.2f\n", worst / best);
+    return 0;
+}
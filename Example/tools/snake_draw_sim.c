@@ -0,0 +1,95 @@
+/* snake_draw_sim.c - host count of the snake renderer's pixel writes
+ *
+ * Runs snake_game.c itself (included below, for its static functions)
+ * on the stand-ins in host/, where GUI_FillRect() and GUI_Clear() only
+ * count the pixels they would write to the panel. The autopilot plays
+ * TICKS moves twice, with draw_scene() after each:
+ *   full         every tick repaints the whole scene, as before the
+ *                incremental renderer
+ *   incremental  the game as it is: only the cells the move changed
+ * Checked:
+ *   - Gfx_GetPixelWrites() (the on-target counter) and the
+ *     PERF_EVT_SNAKE_PIXELS report agree with the stubs' count
+ *   - an incremental tick writes the cells it changed and the HUD
+ *     cells, nothing else: at most 3 cells + the HUD box
+ *
+ *     gcc -O2 -Ihost -I.. -o snake_draw_sim snake_draw_sim.c host/game_host.c ../gfx.c ../hud.c ../snake_board.c ../snake_ai.c
+ *     ./snake_draw_sim
+ *
+ * Text and bitmaps (the HUD digits) are counted apart, by their boxes.
+ * Exits 1 when a check fails.
+ */
+#include "../snake_game.c"
+
+#include <stdio.h>
+#include "game_host.h"
+
+#define TICKS   2000
+
+static int failed;
+
+static void check(int ok, const char *what)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        failed = 1;
+    }
+}
+
+static void run(int full)
+{
+    uint32_t fills = 0, texts = 0, worst = 0;
+    int ticks = 0;
+
+    autopilot = 1;
+    init_game();
+    draw_scene();           /* First frame, not counted */
+
+    while (ticks < TICKS) {
+        steer_autopilot();
+        int result = move_snake();
+        if (result < 0 || result == 2) break;
+
+        uint32_t fill0 = host_fill_pixels, text0 = host_text_pixels;
+        uint32_t gfx0 = Gfx_GetPixelWrites();
+
+        full_redraw = full;
+        draw_scene();
+
+        uint32_t fill = host_fill_pixels - fill0;
+        uint32_t reported;
+        Host_PerfLast(PERF_EVT_SNAKE_PIXELS, &reported, NULL);
+
+        check(Gfx_GetPixelWrites() - gfx0 == fill, "Gfx counter differs from the stubs");
+        check(reported == fill, "PERF_EVT_SNAKE_PIXELS differs from the stubs");
+        if (!full)
+            check(fill <= 3 * CELL_SIZE * CELL_SIZE + HUD_W * HUD_H,
+                  "incremental tick wrote more than its cells and the HUD");
+
+        fills += fill;
+        texts += host_text_pixels - text0;
+        if (fill > worst) worst = fill;
+        ticks++;
+    }
+
+    printf("  %-11s  %5d  %10.1f  %8u  %10.1f\n", full ? "full" : "incremental",
+           ticks, (double)fills / ticks, worst, (double)texts / ticks);
+}
+
+int main(void)
+{
+    /* HUD as StartSnakeGame() sets it up */
+    Hud_StyleInit(&hud_style, GUI_FONT_13_ASCII, GUI_WHITE, GUI_BLACK);
+    Hud_FieldInit(&hud_len, &hud_style, HUD_X + Hud_LabelWidth(&hud_style, HUD_LABEL), HUD_Y, HUD_DIGITS);
+    hud_len.dlist = 1;
+
+    printf("%dx%d panel, %d px cells, pixels per tick\n",
+           LCD_GetXSize(), LCD_GetYSize(), CELL_SIZE);
+    printf("  renderer     ticks  fill/clear     worst  text/bitmap\n");
+
+    run(1);
+    run(0);
+
+    printf(failed ? "FAILED\n" : "all checks passed\n");
+    return failed;
+}
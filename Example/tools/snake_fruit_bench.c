@@ -0,0 +1,163 @@
+/* snake_fruit_bench.c - host benchmark for the snake's fruit placement
+ *
+ * Runs snake_game.c itself (included below, for its static functions)
+ * on the stand-ins in host/ and times place_fruit() on boards from
+ * half full to one free cell, next to the placement the game had
+ * before the free-cell list: random cells drawn until one is free.
+ * The snake is laid along a Hamiltonian cycle of the board. Then
+ * checks the end of the game:
+ *   - the last free cell gets the fruit, and eating it makes
+ *     move_snake() return 2 (board full, "YOU WIN")
+ *   - place_fruit() returns 0 on a full board
+ *   - a whole game on the autopilot ends the same way
+ *
+ *     gcc -O2 -DCELL_SIZE=4 -Ihost -I.. -o snake_fruit_bench snake_fruit_bench.c host/game_host.c ../gfx.c ../hud.c ../snake_board.c ../snake_ai.c
+ *     ./snake_fruit_bench
+ *
+ * The board is the 240x320 panel at CELL_SIZE (60x80 at 4 px); its
+ * height must be even for the cycle. place_fruit()'s times include
+ * its own two Perf_Cycles() reads, a clock call each on the host.
+ * Exits 1 when a check fails.
+ */
+#include "../snake_game.c"
+
+#include <stdio.h>
+
+#define PLACEMENTS  200000      /* Timed calls per board */
+
+static int tour[MAX_CELLS];     /* Cells in cycle order */
+static int cells;
+static int failed;
+
+static void check(int ok, const char *what)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        failed = 1;
+    }
+}
+
+/* Row 0 left to right, rows 1..h-1 back and forth over columns
+ * 1..w-1, then up column 0 */
+static void build_tour(void)
+{
+    int n = 0;
+
+    for (int x = 0; x < grid_w; x++) tour[n++] = x;
+    for (int y = 1; y < grid_h; y++) {
+        for (int k = 1; k < grid_w; k++) {
+            int x = (y & 1) ? grid_w - k : k;
+            tour[n++] = y * grid_w + x;
+        }
+    }
+    for (int y = grid_h - 1; y > 0; y--) tour[n++] = y * grid_w;
+}
+
+/* Snake on tour[0..len-1], head last */
+static void lay_snake(int len)
+{
+    SnakeBoard_Init(cells, 0);
+    for (int i = 0; i < len; i++) SnakeBoard_Grow(tour[i]);
+}
+
+/* The game's placement before the free-cell list; returns the draws */
+static int old_place_fruit(void)
+{
+    int draws = 0;
+
+    while (1) {
+        int rx = (int)(rng_next() % (uint32_t)grid_w);
+        int ry = (int)(rng_next() % (uint32_t)grid_h);
+        draws++;
+
+        if (!SnakeBoard_IsTaken(ry * grid_w + rx)) {
+            fruit.x = rx;
+            fruit.y = ry;
+            return draws;
+        }
+    }
+}
+
+static void time_placement(int free_cells)
+{
+    lay_snake(cells - free_cells);
+
+    /* Free list: one draw per call */
+    uint32_t t0 = Perf_Cycles();
+    for (int k = 0; k < PLACEMENTS; k++)
+        place_fruit();
+    double list_ns = (double)(Perf_Cycles() - t0) / PLACEMENTS;
+    check(!SnakeBoard_IsTaken(cell_index(fruit)), "fruit placed on the body");
+
+    /* Rejection sampling: fewer calls on crowded boards */
+    int calls = PLACEMENTS / (cells / free_cells) + 100;
+    int worst = 0;
+    t0 = Perf_Cycles();
+    for (int k = 0; k < calls; k++) {
+        int draws = old_place_fruit();
+        if (draws > worst) worst = draws;
+    }
+    double old_ns = (double)(Perf_Cycles() - t0) / calls;
+
+    printf("  %6d  %8.1f  %10.1f  %10d\n", free_cells, list_ns, old_ns, worst);
+}
+
+/* Snake on all but the last cell of the cycle, heading for it */
+static void check_last_fruit(void)
+{
+    lay_snake(cells - 1);
+    cur_dir = DIR_UP;       /* The cycle ends going up column 0 */
+
+    check(place_fruit() == 1, "no fruit with one free cell");
+    check(cell_index(fruit) == tour[cells - 1], "fruit not on the last free cell");
+    check(move_snake() == 2, "eating the last fruit did not return 2");
+    check(SnakeBoard_Length() == cells && SnakeBoard_FreeCount() == 0,
+          "board not full after the last fruit");
+    check(place_fruit() == 0, "place_fruit() on a full board did not return 0");
+}
+
+/* Whole game on the autopilot, as the game loop drives it */
+static void check_autopilot_game(void)
+{
+    long moves = 0;
+    int result;
+
+    autopilot = 1;
+    init_game();
+    check(autopilot, "no autopilot cycle for this board");
+    if (!autopilot) return;
+
+    do {
+        steer_autopilot();
+        result = move_snake();
+        moves++;
+    } while (result == 0 || result == 1);
+
+    printf("autopilot game: %ld moves, ended with %d, length %d of %d\n",
+           moves, result, SnakeBoard_Length(), cells);
+    check(result == 2, "autopilot game did not end with a full board");
+}
+
+int main(void)
+{
+    init_game();
+    cells = grid_w * grid_h;
+    if (grid_h & 1) {
+        printf("%dx%d: odd height, no cycle\n", grid_w, grid_h);
+        return 1;
+    }
+    build_tour();
+
+    printf("%dx%d board (CELL_SIZE %d), ns per place_fruit()\n", grid_w, grid_h, CELL_SIZE);
+    printf("    free  free list  old (draw)  old worst draws\n");
+
+    const int frees[] = { cells / 2, cells / 4, cells / 16, 8, 1 };
+    for (size_t i = 0; i < sizeof(frees) / sizeof(frees[0]); i++)
+        time_placement(frees[i]);
+
+    check_last_fruit();
+    check_autopilot_game();
+
+    printf(failed ? "FAILED\n" : "all checks passed\n");
+    return failed;
+}
@@ -0,0 +1,325 @@
+/* vsync_sim.c - host check of the TE frame pacing in vsync.c
+ *
+ * Fakes the panel's TE pulses every PERIOD_MS from a timer thread that
+ * stands in for the EXTI interrupt, and runs two threads on them at the
+ * same time, as on the board:
+ *   render  VSync_WaitEdge() + VSync_FrameDone(), like the display list
+ *   game    VSync_WaitFrame() every INTERVAL pulses with frame skip,
+ *           like flappy_game.c
+ * Every LONG_EVERY-th frame of each thread overruns: the render frame
+ * by half a period into the next scan, the game frame by two of its
+ * intervals. Checked:
+ *   - no wait fell back to a stand-in pulse while the real ones came
+ *   - every wake-up came within half a period of its pulse
+ *   - late frames = the overrunning ones, missed slots = INTERVAL + 1
+ *     per overrunning game frame
+ *   - game ticks drawn + skipped (+ the part not yet a whole tick)
+ *     account for every pulse
+ * Then the pulses stop: both threads must keep going on the timeout,
+ * with one stand-in pulse per timeout.
+ *
+ *     gcc -O2 -pthread -Ihost -I.. -DVSYNC_TIMEOUT_MS=100 -o vsync_sim vsync_sim.c ../vsync.c
+ *     ./vsync_sim
+ *
+ * The long timeout and the margins (half a period and more) keep
+ * the checks clear of host scheduling noise; a host that stalls the
+ * fake panel itself by a whole period fails the first check.
+ *
+ * host/ holds the few CMSIS calls vsync.c makes; they are implemented
+ * below on POSIX threads. Exits 1 when a check fails.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "cmsis_os2.h"
+#include "cmsis_compiler.h"
+#include "vsync.h"
+#include "perf.h"
+
+#define PERIOD_MS       20
+#define PERIOD_US       (PERIOD_MS * 1000)
+#define INTERVAL        3       /* Game frame: every third pulse */
+#define MAX_FRAME_SKIP  3       /* As flappy_game.c */
+#define LONG_EVERY      7
+#define GAME_FRAMES     40
+#define IDLE_FRAMES     5       /* Game frames once the pulses stop */
+
+static uint64_t now_us(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000u + (uint64_t)t.tv_nsec / 1000u;
+}
+
+static void sleep_us(uint64_t us)
+{
+    struct timespec t = { (time_t)(us / 1000000u), (long)(us % 1000000u) * 1000L };
+    while (nanosleep(&t, &t) != 0 && errno == EINTR) { }
+}
+
+/************************************************************
+ * HOST RTOS
+ * Thread flags on a mutex and a condition per thread. Masking
+ * interrupts is one lock, held by the fake TE interrupt too.
+ ************************************************************/
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    uint32_t        flags;
+} host_thread_t;
+
+static __thread host_thread_t *host_self;
+static pthread_mutex_t irq_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void __disable_irq(void) { pthread_mutex_lock(&irq_lock); }
+void __enable_irq(void)  { pthread_mutex_unlock(&irq_lock); }
+
+osThreadId_t osThreadGetId(void)
+{
+    if (host_self == NULL) {
+        pthread_condattr_t attr;
+
+        host_self = calloc(1, sizeof(*host_self));
+        pthread_mutex_init(&host_self->lock, NULL);
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&host_self->cond, &attr);
+    }
+    return host_self;
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
+{
+    host_thread_t *t = thread_id;
+
+    pthread_mutex_lock(&t->lock);
+    t->flags |= flags;
+    flags = t->flags;
+    pthread_cond_broadcast(&t->cond);
+    pthread_mutex_unlock(&t->lock);
+    return flags;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout)
+{
+    host_thread_t *t = osThreadGetId();
+    struct timespec until;
+    uint32_t got;
+
+    (void)options;  /* osFlagsWaitAny only */
+    clock_gettime(CLOCK_MONOTONIC, &until);
+    until.tv_sec  += timeout / 1000u;
+    until.tv_nsec += (long)(timeout % 1000u) * 1000000L;
+    if (until.tv_nsec >= 1000000000L) {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&t->lock);
+    while (!(t->flags & flags) && timeout != osWaitForever) {
+        if (pthread_cond_timedwait(&t->cond, &t->lock, &until) == ETIMEDOUT) break;
+    }
+    got = t->flags & flags;
+    t->flags &= ~got;
+    pthread_mutex_unlock(&t->lock);
+    return got ? got : osFlagsErrorTimeout;
+}
+
+/* Cycles are microseconds here */
+uint32_t Perf_Cycles(void)                 { return (uint32_t)now_us(); }
+uint32_t Perf_CyclesToUs(uint32_t cycles)  { return cycles; }
+void     Perf_Report(uint32_t msg, uint32_t val1, uint32_t val2) { (void)msg; (void)val1; (void)val2; }
+
+/************************************************************
+ * FAKE PANEL
+ ************************************************************/
+static pthread_t         te_thread;
+static volatile int      te_on;
+static volatile uint64_t te_last_us;    /* Time of the last pulse */
+static uint64_t          te_worst_gap_us;
+
+static void *te_thread_fn(void *arg)
+{
+    struct timespec next;
+
+    (void)arg;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    while (te_on) {
+        next.tv_nsec += PERIOD_US * 1000L;
+        if (next.tv_nsec >= 1000000000L) {
+            next.tv_sec++;
+            next.tv_nsec -= 1000000000L;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+        /* The interrupt: nothing masked runs meanwhile */
+        __disable_irq();
+        uint64_t t = now_us();
+        if (te_last_us && t - te_last_us > te_worst_gap_us) te_worst_gap_us = t - te_last_us;
+        te_last_us = t;
+        VSync_Pulse();
+        __enable_irq();
+    }
+    return NULL;
+}
+
+void VSync_PortInit(void)
+{
+    te_on = 1;
+    pthread_create(&te_thread, NULL, te_thread_fn, NULL);
+}
+
+/************************************************************
+ * PRESENTING THREADS
+ ************************************************************/
+typedef struct {
+    volatile int stop;          /* Render: finish after this frame */
+    int      frames;
+    int      long_frames;
+    int      overrun;           /* Long frames overrun at all */
+    uint64_t worst_wake_us;     /* Pulse to wake-up, with the pulses on */
+
+    /* Game only */
+    int      ticks, dropped;
+    uint32_t first_slot, last_slot, lost;
+} thread_stats_t;
+
+static thread_stats_t render, game;
+
+static void note_wake(thread_stats_t *s)
+{
+    if (!te_on) return;
+    uint64_t d = now_us() - te_last_us;
+    if (d > s->worst_wake_us) s->worst_wake_us = d;
+}
+
+static void *render_fn(void *arg)
+{
+    vsync_frame_t frame;
+
+    (void)arg;
+    while (!render.stop) {
+        VSync_WaitEdge(&frame);
+        note_wake(&render);
+
+        int slow = render.overrun && (render.frames % LONG_EVERY == LONG_EVERY - 1);
+        sleep_us(slow ? PERIOD_US * 3 / 2 : PERIOD_US / 5);
+        render.long_frames += slow;
+        render.frames++;
+
+        VSync_FrameDone(&frame);
+    }
+    return NULL;
+}
+
+static void *game_fn(void *arg)
+{
+    int frames = *(int *)arg;
+    vsync_frame_t frame;
+
+    VSync_Resync(&frame);
+    game.first_slot = frame.slot;
+
+    for (int f = 0; f < frames; f++) {
+        game.ticks++;                                   /* update_physics() */
+
+        uint32_t skip = VSync_WaitFrame(&frame, INTERVAL);
+        note_wake(&game);
+
+        if (skip > MAX_FRAME_SKIP) {
+            game.dropped += (int)(skip - MAX_FRAME_SKIP);
+            skip = MAX_FRAME_SKIP;
+        }
+        game.ticks += (int)skip;                        /* caught up, not drawn */
+
+        int slow = game.overrun && (f % LONG_EVERY == LONG_EVERY - 1);
+        sleep_us(slow ? (uint64_t)PERIOD_US * (2 * INTERVAL) + PERIOD_US / 2 : PERIOD_US / 5);
+        game.long_frames += slow;
+        game.frames++;
+
+        VSync_FrameDone(&frame);
+    }
+    game.last_slot = frame.slot;
+    game.lost = frame.lost;
+    return NULL;
+}
+
+/* Game for `frames`, render alongside it until the game is done */
+static void run_both(int frames, int overrun)
+{
+    pthread_t r, g;
+
+    render.stop = 0;
+    render.overrun = game.overrun = overrun;
+    pthread_create(&r, NULL, render_fn, NULL);
+    pthread_create(&g, NULL, game_fn, &frames);
+    pthread_join(g, NULL);
+    render.stop = 1;
+    pthread_join(r, NULL);
+}
+
+static int fails;
+
+static void check(int ok, const char *what)
+{
+    printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok) fails++;
+}
+
+int main(void)
+{
+    printf("TE every %d ms, game frame every %d pulses, timeout %d ms\n",
+           PERIOD_MS, INTERVAL, VSYNC_TIMEOUT_MS);
+
+    VSync_Init();
+    uint32_t period = VSync_GetPeriodUs();
+    printf("measured period %u us\n", period);
+    check(period > PERIOD_US * 95 / 100 && period < PERIOD_US * 105 / 100, "period measured from the pulses");
+
+    /* Both threads on the pulses */
+    run_both(GAME_FRAMES, 1);
+
+    uint32_t elapsed = game.last_slot - game.first_slot;
+    printf("pulses on: render %d frames (%d long), game %d frames (%d long), %d ticks, %u pulses\n",
+           render.frames, render.long_frames, game.frames, game.long_frames, game.ticks, elapsed);
+    printf("  timeouts %u, late %u, missed %u, worst wake-up %llu us (render) %llu us (game)\n",
+           VSync_GetTimeouts(), VSync_GetLate(), VSync_GetMissed(),
+           (unsigned long long)render.worst_wake_us, (unsigned long long)game.worst_wake_us);
+
+    printf("  pulses came at most %llu us apart\n", (unsigned long long)te_worst_gap_us);
+
+    check(te_worst_gap_us < 2 * PERIOD_US, "fake panel kept its period");
+    check(VSync_GetTimeouts() == 0, "no timeouts with two waiters");
+    check(render.worst_wake_us < PERIOD_US / 2 && game.worst_wake_us < PERIOD_US / 2,
+          "every wake-up within half a period");
+    check(VSync_GetLate() == (uint32_t)(render.long_frames + game.long_frames), "late frames = overrunning frames");
+    check(VSync_GetMissed() == (uint32_t)game.long_frames * (INTERVAL + 1), "missed slots = INTERVAL + 1 per long game frame");
+    check((uint32_t)(game.ticks + game.dropped) * INTERVAL + game.lost == elapsed,
+          "ticks drawn + skipped account for every pulse");
+
+    /* No panel: the timeouts keep both going */
+    te_on = 0;
+    pthread_join(te_thread, NULL);
+
+    vsync_frame_t probe;
+    VSync_Resync(&probe);
+    uint32_t pulses0 = probe.slot, timeouts0 = VSync_GetTimeouts();
+    uint64_t t0 = now_us();
+
+    game.ticks = game.frames = 0;
+    render.frames = render.long_frames = 0;
+    run_both(IDLE_FRAMES, 0);
+
+    VSync_Resync(&probe);
+    uint32_t pulses = probe.slot - pulses0, timeouts = VSync_GetTimeouts() - timeouts0;
+    printf("pulses off: render %d frames, game %d frames in %llu ms, %u stand-in pulses, %u timeouts\n",
+           render.frames, game.frames, (unsigned long long)((now_us() - t0) / 1000u), pulses, timeouts);
+    check(game.frames == IDLE_FRAMES && pulses >= IDLE_FRAMES * INTERVAL, "both threads keep going");
+    check(pulses == timeouts, "one stand-in pulse per timeout");
+
+    printf(fails ? "%d checks failed\n" : "all checks passed\n", fails);
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,174 @@
+/* vsync.c */
+#include <stddef.h>
+#include "cmsis_os2.h"
+#include "cmsis_compiler.h"
+#include "vsync.h"
+#include "perf.h"
+
+#define VSYNC_FLAG          0x0100U
+#define VSYNC_MEASURE       8           /* Pulses timed by VSync_Init() */
+
+static volatile uint32_t     vs_pulses;
+static volatile uint32_t     vs_pulse_cycles;   // Perf_Cycles() at the last pulse
+static osThreadId_t volatile vs_waiters[VSYNC_MAX_WAITERS];    // in wait_pulse(), NULL = free
+static uint32_t vs_missed;
+static uint32_t vs_late;
+static uint32_t vs_timeouts;
+static uint32_t vs_period_us;
+
+/************************************************************
+ * PULSES
+ * A pulse bumps vs_pulses and wakes every registered waiter;
+ * each one compares the count with the pulse it wants, so
+ * none of them can take a pulse away from another.
+ ************************************************************/
+static void wake_waiters(void)
+{
+    for (int i = 0; i < VSYNC_MAX_WAITERS; i++)
+    {
+        osThreadId_t waiter = vs_waiters[i];
+        if (waiter)
+            osThreadFlagsSet(waiter, VSYNC_FLAG);
+    }
+}
+
+void VSync_Pulse(void)
+{
+    vs_pulse_cycles = Perf_Cycles();
+    vs_pulses = vs_pulses + 1;
+    wake_waiters();
+}
+
+/* Stand-in pulse from a waiting thread, kept clear of the ISR */
+static void fake_pulse(void)
+{
+    __disable_irq();
+    vs_pulse_cycles = Perf_Cycles();
+    vs_pulses = vs_pulses + 1;
+    vs_timeouts++;
+    __enable_irq();
+
+    wake_waiters();
+}
+
+/* Totals are bumped by more than one thread */
+static void count(uint32_t *pTotal, uint32_t n)
+{
+    __disable_irq();
+    *pTotal += n;
+    __enable_irq();
+}
+
+/************************************************************
+ * INIT: TE ON, EXTI ARMED, PERIOD MEASURED
+ ************************************************************/
+void VSync_Init(void)
+{
+    vsync_frame_t frame;
+
+    VSync_PortInit();
+
+    /* Time a few frames; timeouts mean there is no TE */
+    uint32_t timeouts = vs_timeouts;
+    VSync_WaitEdge(&frame);
+    uint32_t t0 = vs_pulse_cycles;
+    for (int i = 0; i < VSYNC_MEASURE; i++)
+        VSync_WaitEdge(&frame);
+
+    if (vs_timeouts == timeouts)
+        vs_period_us = Perf_CyclesToUs(vs_pulse_cycles - t0) / VSYNC_MEASURE;
+}
+
+/************************************************************
+ * WAITING
+ * Up to VSYNC_MAX_WAITERS threads at once; one more than that
+ * only sees pulses through its timeout.
+ ************************************************************/
+static void wait_pulse(uint32_t target)
+{
+    osThreadId_t self = osThreadGetId();
+    int slot = -1;
+
+    __disable_irq();
+    for (int i = 0; i < VSYNC_MAX_WAITERS && slot < 0; i++)
+    {
+        if (vs_waiters[i] == NULL)
+        {
+            vs_waiters[i] = self;
+            slot = i;
+        }
+    }
+    __enable_irq();
+
+    while ((int32_t)(vs_pulses - target) < 0)
+    {
+        uint32_t seen = vs_pulses;
+        uint32_t r = osThreadFlagsWait(VSYNC_FLAG, osFlagsWaitAny, VSYNC_TIMEOUT_MS);
+
+        /* No pulse at all in time: stand in for the panel */
+        if (r == (uint32_t)osFlagsErrorTimeout && vs_pulses == seen)
+            fake_pulse();
+    }
+
+    if (slot >= 0)
+        vs_waiters[slot] = NULL;
+}
+
+void VSync_WaitEdge(vsync_frame_t *pFrame)
+{
+    uint32_t target = vs_pulses + 1;
+
+    wait_pulse(target);
+    pFrame->slot = target;
+}
+
+uint32_t VSync_WaitFrame(vsync_frame_t *pFrame, uint32_t interval)
+{
+    uint32_t target = pFrame->slot + interval;
+    uint32_t now = vs_pulses;
+    uint32_t missed = 0;
+
+    /* That slot has already begun: skip to the next pulse */
+    if ((int32_t)(now - target) >= 0)
+    {
+        missed = now - target + 1;
+        count(&vs_missed, missed);
+        target = now + 1;
+    }
+
+    wait_pulse(target);
+    pFrame->slot = target;
+
+    pFrame->lost += missed;
+    uint32_t frames = pFrame->lost / interval;
+    pFrame->lost -= frames * interval;
+    return frames;
+}
+
+void VSync_Resync(vsync_frame_t *pFrame)
+{
+    pFrame->slot = vs_pulses;
+    pFrame->lost = 0;
+}
+
+void VSync_FrameDone(vsync_frame_t *pFrame)
+{
+    if (vs_pulses != pFrame->slot)
+    {
+        count(&vs_late, 1);
+        Perf_Report(PERF_EVT_VSYNC, vs_missed, vs_late);
+    }
+}
+
+uint32_t VSync_FramesFor(uint32_t ms)
+{
+    uint32_t period = vs_period_us ? vs_period_us : VSYNC_TIMEOUT_MS * 1000U;
+    uint32_t n = (ms * 1000U + period / 2) / period;
+
+    return n ? n : 1;
+}
+
+uint32_t VSync_GetPeriodUs(void)  { return vs_period_us; }
+uint32_t VSync_GetMissed(void)    { return vs_missed; }
+uint32_t VSync_GetLate(void)      { return vs_late; }
+uint32_t VSync_GetTimeouts(void)  { return vs_timeouts; }
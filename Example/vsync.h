@@ -0,0 +1,70 @@
+/* vsync.h */
+#ifndef VSYNC_H
+#define VSYNC_H
+
+#include <stdint.h>
+
+/************************************************************
+ * FRAME PRESENTATION SYNCED TO THE PANEL (TE OUTPUT)
+ * The HX8347 pulses TE when it has finished scanning a frame.
+ * Starting a push right after the pulse keeps the write ahead
+ * of the scan, so big fills do not tear.
+ *
+ * Without a TE signal every wait times out after
+ * VSYNC_TIMEOUT_MS and counts as a pulse, so callers keep a
+ * steady (slower) pace instead of hanging.
+ *
+ * The board side (GPIO, EXTI) is in vsync_te.c; the rest only
+ * uses CMSIS-RTOS2, so it also runs on a PC against faked
+ * pulses (tools/vsync_sim.c).
+ ************************************************************/
+
+#ifndef VSYNC_TIMEOUT_MS
+#define VSYNC_TIMEOUT_MS   20
+#endif
+#define VSYNC_MAX_WAITERS  4    /* Threads waiting for a pulse at once */
+
+/* Pacing state of one caller. Every thread that presents frames
+ * (the render thread, a game thread) keeps its own. */
+typedef struct {
+    uint32_t slot;              /* Pulse the current frame started on */
+    uint32_t lost;              /* Missed slots short of a whole frame */
+} vsync_frame_t;
+
+/* TE on, EXTI armed, panel period measured */
+void     VSync_Init(void);
+
+/* Board side of VSync_Init() (vsync_te.c). A host harness
+ * supplies its own. */
+void     VSync_PortInit(void);
+
+/* One TE pulse, seen by every waiting thread. Called from the
+ * EXTI interrupt; anything else (a timer, a test harness) may
+ * call it to fake the panel. */
+void     VSync_Pulse(void);
+
+/* Wait for the next pulse, no pacing */
+void     VSync_WaitEdge(vsync_frame_t *pFrame);
+
+/* Paced presentation: wait until `interval` pulses after the last
+ * frame's slot. If that slot has already started the frame is
+ * late: it skips to the next pulse and the lost slots are counted
+ * as missed. Returns how many whole frames were missed, to be run
+ * without drawing; slots short of a frame carry to the next call. */
+uint32_t VSync_WaitFrame(vsync_frame_t *pFrame, uint32_t interval);
+
+/* Forget the pacing history (after a pause, a new game...) */
+void     VSync_Resync(vsync_frame_t *pFrame);
+
+/* Call when the push is over: if another pulse came in meanwhile
+ * the write ran into the next scan and the frame counts as late. */
+void     VSync_FrameDone(vsync_frame_t *pFrame);
+
+uint32_t VSync_FramesFor(uint32_t ms);
+
+uint32_t VSync_GetPeriodUs(void);      /* 0 = no TE seen */
+uint32_t VSync_GetMissed(void);
+uint32_t VSync_GetLate(void);
+uint32_t VSync_GetTimeouts(void);
+
+#endif
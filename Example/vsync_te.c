@@ -0,0 +1,37 @@
+/* vsync_te.c */
+#include "main.h"
+#include "vsync.h"
+#include "lcd_hw.h"
+
+/* TE output of the panel, wired to PB0 (EXTI0). Adapt to the board. */
+#define VSYNC_TE_PORT       GPIOB
+#define VSYNC_TE_PIN        GPIO_PIN_0
+#define VSYNC_TE_IRQn       EXTI0_IRQn
+
+/************************************************************
+ * TE INTERRUPT
+ ************************************************************/
+void EXTI0_IRQHandler(void)
+{
+    __HAL_GPIO_EXTI_CLEAR_IT(VSYNC_TE_PIN);
+    VSync_Pulse();
+}
+
+/************************************************************
+ * TE ON, EXTI ARMED
+ ************************************************************/
+void VSync_PortInit(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    LCD_X_EnableTE(1);
+
+    __HAL_RCC_GPIOB_CLK_ENABLE();
+    GPIO_InitStruct.Pin = VSYNC_TE_PIN;
+    GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+    GPIO_InitStruct.Pull = GPIO_PULLDOWN;      /* No TE wired: stays quiet */
+    HAL_GPIO_Init(VSYNC_TE_PORT, &GPIO_InitStruct);
+
+    HAL_NVIC_SetPriority(VSYNC_TE_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(VSYNC_TE_IRQn);
+}
@@ -3,19 +3,51 @@
 #include "LCD.h"
 #include "cmsis_os2.h"
 #include <stdint.h>
+#include <string.h>
 #include <stdio.h>
 #include "input.h"
 #include "sound.h"     // <-- ADDED
 
+#ifndef CELL_SIZE
 #define CELL_SIZE        12
-#define MAX_SNAKE_LEN    128
+#endif
 #define INITIAL_SPEED_MS 160
 
+/* Largest board: the panel is 240x320, in either orientation */
+#define LCD_MAX_W        240
+#define LCD_MAX_H        320
+#define MAX_CELLS        ((LCD_MAX_W / CELL_SIZE) * (LCD_MAX_H / CELL_SIZE))
+
+/* CELL_SIZE can be set from the project (-DCELL_SIZE=n), down to 4 px.
+ * The body and the free-cell index are sized for the whole board, so the
+ * snake can fill it. Board state is about 6 bytes per cell:
+ *
+ *   CELL_SIZE   board    cells   ring + bitmap + free list
+ *      12       20x26      520     1040 +   65 +   2080 =  3185 B
+ *       8       30x40     1200     2400 +  150 +   4800 =  7350 B
+ *       6       40x53     2120     4240 +  265 +   8480 = 12985 B
+ *       4       60x80     4800     9600 +  600 +  19200 = 29400 B
+ */
+
+#if CELL_SIZE < 4
+#error "CELL_SIZE below 4 px is not supported"
+#endif
+
 typedef struct { int x, y; } cell_t;
 typedef enum { DIR_UP, DIR_RIGHT, DIR_DOWN, DIR_LEFT } dir_t;
 
-static cell_t snake[MAX_SNAKE_LEN];
+/* Body ring of cell indices (y * grid_w + x): snake[snake_head] is the
+ * head, snake[snake_tail] the last segment */
+static uint16_t snake[MAX_CELLS];
+static int snake_head, snake_tail;
 static int snake_len;
+static uint8_t occupied[(MAX_CELLS + 7) / 8];   // one bit per grid cell, set under the body
+
+/* Cells not under the body: free_cells[0..free_count-1] in any order,
+ * free_pos[] gives each free cell's slot so it can be swap-removed */
+static uint16_t free_cells[MAX_CELLS];
+static uint16_t free_pos[MAX_CELLS];
+static int      free_count;
 static cell_t fruit;
 static dir_t cur_dir;
 
@@ -35,9 +67,50 @@ static uint32_t rng_next(void)
 static void init_game(void);
 static void draw_scene(void);
 static int move_snake(void);
-static void place_fruit(void);
+static int place_fruit(void);
 static int is_collision(cell_t h);
-static void game_over_screen(void);
+static void game_over_screen(int won);
+
+static int ring_next(int i)
+{
+    return (i + 1 == MAX_CELLS) ? 0 : i + 1;
+}
+
+static int cell_index(cell_t c)
+{
+    return c.y * grid_w + c.x;
+}
+
+static cell_t cell_at(int i)
+{
+    cell_t c = { i % grid_w, i / grid_w };
+    return c;
+}
+
+/* Occupancy bitmap and free-cell list, indexed y * grid_w + x */
+static void occ_set(int i)
+{
+    occupied[i >> 3] |= (uint8_t)(1u << (i & 7));
+
+    /* Move the last free cell into the slot this one leaves */
+    int last = free_cells[--free_count];
+    free_cells[free_pos[i]] = (uint16_t)last;
+    free_pos[last] = free_pos[i];
+}
+
+static void occ_clear(int i)
+{
+    occupied[i >> 3] &= (uint8_t)~(1u << (i & 7));
+
+    free_pos[i] = (uint16_t)free_count;
+    free_cells[free_count++] = (uint16_t)i;
+}
+
+static int occ_test(int x, int y)
+{
+    int i = y * grid_w + x;
+    return (occupied[i >> 3] >> (i & 7)) & 1;
+}
 
 /************************************************************
  * PUBLIC ENTRY FUNCTION
@@ -68,10 +141,11 @@ void StartSnakeGame(void)
 
         int result = move_snake();
 
-        if (result < 0)
+        /* Dead, or the body fills the whole board */
+        if (result < 0 || result == 2)
         {
             draw_scene();
-            game_over_screen();
+            game_over_screen(result == 2);
 
             while (Keypad_Get_Key() != '5')
                 osDelay(50);
@@ -103,17 +177,27 @@ static void init_game(void)
 
     if (grid_w < 10) grid_w = 10;
     if (grid_h < 10) grid_h = 10;
+    if (grid_w * grid_h > MAX_CELLS) grid_h = MAX_CELLS / grid_w;
 
     int cx = grid_w / 2;
     int cy = grid_h / 2;
 
-    snake_len = 2;
+    snake_len  = 2;
+    snake_tail = 0;
+    snake_head = 1;
 
     for (int i = 0; i < snake_len; i++)
+        snake[i] = (uint16_t)(cy * grid_w + cx - 1 + i);
+
+    memset(occupied, 0, sizeof(occupied));
+    free_count = grid_w * grid_h;
+    for (int i = 0; i < free_count; i++)
     {
-        snake[i].x = cx - i;
-        snake[i].y = cy;
+        free_cells[i] = (uint16_t)i;
+        free_pos[i]   = (uint16_t)i;
     }
+    for (int i = 0; i < snake_len; i++)
+        occ_set(snake[i]);
 
     cur_dir = DIR_RIGHT;
     place_fruit();
@@ -136,13 +220,13 @@ static void draw_scene(void)
 
     GUI_SetColor(GUI_GREEN);
 
-    for (int i = 0; i < snake_len; i++)
+    for (int i = snake_tail, n = 0; n < snake_len; n++, i = ring_next(i))
     {
         GUI_FillRect(
-            snake[i].x * CELL_SIZE,
-            snake[i].y * CELL_SIZE,
-            snake[i].x * CELL_SIZE + CELL_SIZE - 1,
-            snake[i].y * CELL_SIZE + CELL_SIZE - 1);
+            (snake[i] % grid_w) * CELL_SIZE,
+            (snake[i] / grid_w) * CELL_SIZE,
+            (snake[i] % grid_w) * CELL_SIZE + CELL_SIZE - 1,
+            (snake[i] / grid_w) * CELL_SIZE + CELL_SIZE - 1);
     }
 
     GUI_SetColor(GUI_WHITE);
@@ -157,7 +241,7 @@ static void draw_scene(void)
  ************************************************************/
 static int move_snake(void)
 {
-    cell_t head = snake[0];
+    cell_t head = cell_at(snake[snake_head]);
 
     switch (cur_dir)
     {
@@ -170,17 +254,25 @@ static int move_snake(void)
     if (is_collision(head))
         return -1;
 
-    for (int i = snake_len - 1; i > 0; i--)
-        snake[i] = snake[i - 1];
-
-    snake[0] = head;
+    int ate = (head.x == fruit.x && head.y == fruit.y);
 
-    if (head.x == fruit.x && head.y == fruit.y)
+    /* Pop the tail unless growing, then push the new head */
+    if (!ate)
     {
-        if (snake_len < MAX_SNAKE_LEN)
-            snake[snake_len++] = snake[snake_len - 1];
+        occ_clear(snake[snake_tail]);
+        snake_tail = ring_next(snake_tail);
+        snake_len--;
+    }
 
-        place_fruit();
+    snake_head = ring_next(snake_head);
+    snake[snake_head] = (uint16_t)cell_index(head);
+    occ_set(snake[snake_head]);
+    snake_len++;
+
+    if (ate)
+    {
+        if (!place_fruit())
+            return 2;
         Sound_EatFruit();        // <-- ADDED
         return 1;
     }
@@ -189,25 +281,16 @@ static int move_snake(void)
 }
 
 /************************************************************/
-static void place_fruit(void)
+/* Uniform over the free cells, 0 when the board is full */
+static int place_fruit(void)
 {
-    while (1)
-    {
-        int rx = rng_next() % grid_w;
-        int ry = rng_next() % grid_h;
-
-        int collision = 0;
-        for (int i = 0; i < snake_len; i++)
-            if (snake[i].x == rx && snake[i].y == ry)
-                collision = 1;
+    if (free_count == 0)
+        return 0;
 
-        if (!collision)
-        {
-            fruit.x = rx;
-            fruit.y = ry;
-            return;
-        }
-    }
+    int i = free_cells[rng_next() % (uint32_t)free_count];
+    fruit.x = i % grid_w;
+    fruit.y = i / grid_w;
+    return 1;
 }
 
 /************************************************************/
@@ -216,20 +299,19 @@ static int is_collision(cell_t h)
     if (h.x < 0 || h.x >= grid_w || h.y < 0 || h.y >= grid_h)
         return 1;
 
-    for (int i = 0; i < snake_len; i++)
-        if (snake[i].x == h.x && snake[i].y == h.y)
-            return 1;
-
-    return 0;
+    return occ_test(h.x, h.y);
 }
 
 /************************************************************/
-static void game_over_screen(void)
+static void game_over_screen(int won)
 {
     GUI_SetColor(GUI_WHITE);
     GUI_SetFont(GUI_FONT_20_ASCII);
-    GUI_DispStringHCenterAt("GAME OVER",
+    GUI_DispStringHCenterAt(won ? "YOU WIN" : "GAME OVER",
             pixel_w / 2, pixel_h / 2 - 20);
 
-    Sound_GameOver();      // <-- ADDED
+    if (won)
+        Sound_EatFruit();
+    else
+        Sound_GameOver();      // <-- ADDED
 }